@@ -0,0 +1,112 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+// Shared helpers for the libmath2 benchmark suites.
+// Each suite writes its benchmarks once in a macro taking the type suffix S
+// and instantiates it for f32 and f64; lm2_bench_##S names the scalar type.
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <vector>
+#include "lm2.h"
+
+// Number of elements processed per iteration by the throughput benchmarks
+#define LM2_BENCH_BATCH 1024
+
+typedef float lm2_bench_f32;
+typedef double lm2_bench_f64;
+
+namespace lm2_bench {
+
+  // Deterministic xorshift64* generator so every run sees the same inputs
+  class rng {
+   public:
+    explicit rng(uint64_t seed = 0x9E3779B97F4A7C15ull) : state_(seed ? seed : 1) {}
+
+    uint64_t next() {
+      state_ ^= state_ >> 12;
+      state_ ^= state_ << 25;
+      state_ ^= state_ >> 27;
+      return state_ * 0x2545F4914F6CDD1Dull;
+    }
+
+    // Uniform value in [lo, hi)
+    double uniform(double lo, double hi) {
+      return lo + (hi - lo) * ((double)(next() >> 11) * (1.0 / 9007199254740992.0));
+    }
+
+   private:
+    uint64_t state_;
+  };
+
+  template <typename T>
+  std::vector<T> random_scalars(size_t count, double lo, double hi, uint64_t seed = 1) {
+    rng r(seed);
+    std::vector<T> out(count);
+    for (T& v : out) v = (T)r.uniform(lo, hi);
+    return out;
+  }
+
+  template <typename T>
+  auto random_v2(rng& r, double lo, double hi) {
+    return lm2_v2_make((T)r.uniform(lo, hi), (T)r.uniform(lo, hi));
+  }
+
+  template <typename T>
+  auto random_v3(rng& r, double lo, double hi) {
+    return lm2_v3_make((T)r.uniform(lo, hi), (T)r.uniform(lo, hi), (T)r.uniform(lo, hi));
+  }
+
+  template <typename T>
+  auto random_v4(rng& r, double lo, double hi) {
+    return lm2_v4_make((T)r.uniform(lo, hi), (T)r.uniform(lo, hi), (T)r.uniform(lo, hi), (T)r.uniform(lo, hi));
+  }
+
+  template <typename T>
+  auto random_v2s(size_t count, double lo, double hi, uint64_t seed = 1) {
+    rng r(seed);
+    std::vector<decltype(random_v2<T>(r, lo, hi))> out(count);
+    for (auto& v : out) v = random_v2<T>(r, lo, hi);
+    return out;
+  }
+
+  template <typename T>
+  auto random_v3s(size_t count, double lo, double hi, uint64_t seed = 1) {
+    rng r(seed);
+    std::vector<decltype(random_v3<T>(r, lo, hi))> out(count);
+    for (auto& v : out) v = random_v3<T>(r, lo, hi);
+    return out;
+  }
+
+  template <typename T>
+  auto random_v4s(size_t count, double lo, double hi, uint64_t seed = 1) {
+    rng r(seed);
+    std::vector<decltype(random_v4<T>(r, lo, hi))> out(count);
+    for (auto& v : out) v = random_v4<T>(r, lo, hi);
+    return out;
+  }
+
+}  // namespace lm2_bench
@@ -0,0 +1,51 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+// Records the build flavour in the "context" block of the JSON output, so
+// result files from the safe and LM2_UNSAFE binaries are told apart.
+
+#include <benchmark/benchmark.h>
+#include <string>
+#include "lm2/lm2_base.h"
+
+namespace {
+
+  const bool lm2_bench_context_registered = [] {
+#ifdef LM2_UNSAFE
+    benchmark::AddCustomContext("lm2_unsafe", "true");
+#else
+    benchmark::AddCustomContext("lm2_unsafe", "false");
+#endif
+#ifdef LM2_INLINE_IMPLEMENTATION
+    benchmark::AddCustomContext("lm2_inline_implementation", "true");
+#else
+    benchmark::AddCustomContext("lm2_inline_implementation", "false");
+#endif
+#ifdef LM2_VERSION
+    benchmark::AddCustomContext("lm2_version", LM2_VERSION);
+#endif
+    return true;
+  }();
+
+}  // namespace
@@ -0,0 +1,90 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <cmath>
+#include "bench_common.h"
+
+// =============================================================================
+// Camera3 Ray Generation Benchmarks
+// =============================================================================
+// Primary rays for a 128 x 64 viewport per iteration: one ndc_to_world pair
+// and lm2_ray3_from_points per pixel, against the ray generator filling SoA
+// tiles and 8-wide packets.
+
+#define LM2_BENCH_RAYS_W 128
+#define LM2_BENCH_RAYS_H 64
+
+#define LM2_BENCH_CAMERA3_RAYS(S)                                                                                                         \
+  static lm2_camera3_##S bench_rays_camera_##S() {                                                                                        \
+    return lm2_camera3_perspective_##S(lm2_v3_make_##S(3, 2, 5), lm2_v3_make_##S(0, 0, -1), lm2_v3_make_##S(0, 1, 0), (lm2_bench_##S)1.0, \
+                                       (lm2_bench_##S)2.0, (lm2_bench_##S)0.1, (lm2_bench_##S)100);                                       \
+  }                                                                                                                                       \
+                                                                                                                                          \
+  static void BM_camera3_rays_ndc_to_world_##S(benchmark::State& state) {                                                                 \
+    lm2_camera3_##S camera = bench_rays_camera_##S();                                                                                     \
+    std::vector<lm2_ray3_##S> rays(LM2_BENCH_RAYS_W * LM2_BENCH_RAYS_H);                                                                  \
+    for (auto _ : state) {                                                                                                                \
+      for (uint32_t y = 0; y < LM2_BENCH_RAYS_H; y++) {                                                                                   \
+        for (uint32_t x = 0; x < LM2_BENCH_RAYS_W; x++) {                                                                                 \
+          lm2_bench_##S nx = (x + (lm2_bench_##S)0.5) / LM2_BENCH_RAYS_W * 2 - 1;                                                         \
+          lm2_bench_##S ny = 1 - (y + (lm2_bench_##S)0.5) / LM2_BENCH_RAYS_H * 2;                                                         \
+          lm2_v3_##S near_point = lm2_camera3_ndc_to_world_##S(camera, lm2_v3_make_##S(nx, ny, -1));                                      \
+          lm2_v3_##S far_point = lm2_camera3_ndc_to_world_##S(camera, lm2_v3_make_##S(nx, ny, 1));                                        \
+          rays[y * LM2_BENCH_RAYS_W + x] = lm2_ray3_from_points_##S(near_point, far_point);                                               \
+        }                                                                                                                                 \
+      }                                                                                                                                   \
+      benchmark::DoNotOptimize(rays.data());                                                                                              \
+    }                                                                                                                                     \
+    state.SetItemsProcessed(state.iterations() * rays.size());                                                                            \
+  }                                                                                                                                       \
+  BENCHMARK(BM_camera3_rays_ndc_to_world_##S);                                                                                            \
+                                                                                                                                          \
+  static void BM_camera3_raygen_tile_##S(benchmark::State& state) {                                                                       \
+    lm2_camera3_raygen_##S raygen = lm2_camera3_raygen_make_##S(bench_rays_camera_##S(), LM2_BENCH_RAYS_W, LM2_BENCH_RAYS_H);             \
+    raygen.jitter = state.range(0) != 0;                                                                                                  \
+    const size_t n = LM2_BENCH_RAYS_W * LM2_BENCH_RAYS_H;                                                                                 \
+    std::vector<lm2_bench_##S> ox(n), oy(n), oz(n), dx(n), dy(n), dz(n), t(n);                                                            \
+    lm2_v3_soa_##S origins = {ox.data(), oy.data(), oz.data(), n};                                                                        \
+    lm2_v3_soa_##S directions = {dx.data(), dy.data(), dz.data(), n};                                                                     \
+    for (auto _ : state) {                                                                                                                \
+      lm2_camera3_raygen_tile_##S(&raygen, 0, 0, LM2_BENCH_RAYS_W, LM2_BENCH_RAYS_H, origins, directions, t.data());                      \
+      benchmark::DoNotOptimize(dx.data());                                                                                                \
+    }                                                                                                                                     \
+    state.SetItemsProcessed(state.iterations() * n);                                                                                      \
+  }                                                                                                                                       \
+  BENCHMARK(BM_camera3_raygen_tile_##S)->Arg(0)->Arg(1);                                                                                  \
+                                                                                                                                          \
+  static void BM_camera3_raygen_packets8_##S(benchmark::State& state) {                                                                   \
+    lm2_camera3_raygen_##S raygen = lm2_camera3_raygen_make_##S(bench_rays_camera_##S(), LM2_BENCH_RAYS_W, LM2_BENCH_RAYS_H);             \
+    std::vector<lm2_ray3_packet8_##S> packets(LM2_BENCH_RAYS_W / 4 * (LM2_BENCH_RAYS_H / 2));                                             \
+    for (auto _ : state) {                                                                                                                \
+      lm2_camera3_raygen_packets8_##S(&raygen, 0, 0, LM2_BENCH_RAYS_W, LM2_BENCH_RAYS_H, packets.data());                                 \
+      benchmark::DoNotOptimize(packets.data());                                                                                           \
+    }                                                                                                                                     \
+    state.SetItemsProcessed(state.iterations() * packets.size() * 8);                                                                     \
+  }                                                                                                                                       \
+  BENCHMARK(BM_camera3_raygen_packets8_##S);
+
+LM2_BENCH_CAMERA3_RAYS(f32)
+LM2_BENCH_CAMERA3_RAYS(f64)
@@ -0,0 +1,97 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <cmath>
+#include "bench_common.h"
+
+// =============================================================================
+// Camera3 State Benchmarks
+// =============================================================================
+// 4096 points through the camera per iteration: the lm2_camera3 functions
+// rebuild the matrices (and invert one for ndc_to_world) for every point, the
+// state builds them once and runs the batch transform.
+
+#define LM2_BENCH_CAMERA3_STATE(S)                                                                                                        \
+  static lm2_camera3_##S bench_camera_##S() {                                                                                             \
+    return lm2_camera3_perspective_##S(lm2_v3_make_##S(3, 2, 5), lm2_v3_make_##S(0, 0, -1), lm2_v3_make_##S(0, 1, 0), (lm2_bench_##S)1.0, \
+                                       (lm2_bench_##S)1.78, (lm2_bench_##S)0.1, (lm2_bench_##S)100);                                      \
+  }                                                                                                                                       \
+                                                                                                                                          \
+  static void BM_camera3_ndc_to_world_##S(benchmark::State& state) {                                                                      \
+    lm2_camera3_##S camera = bench_camera_##S();                                                                                          \
+    auto src = lm2_bench::random_v3s<lm2_bench_##S>(LM2_BENCH_BATCH * 4, -0.9, 0.9);                                                      \
+    std::vector<lm2_v3_##S> dst(src.size());                                                                                              \
+    for (auto _ : state) {                                                                                                                \
+      for (size_t i = 0; i < src.size(); i++) {                                                                                           \
+        dst[i] = lm2_camera3_ndc_to_world_##S(camera, src[i]);                                                                            \
+      }                                                                                                                                   \
+      benchmark::DoNotOptimize(dst.data());                                                                                               \
+    }                                                                                                                                     \
+    state.SetItemsProcessed(state.iterations() * src.size());                                                                             \
+  }                                                                                                                                       \
+  BENCHMARK(BM_camera3_ndc_to_world_##S);                                                                                                 \
+                                                                                                                                          \
+  static void BM_camera3_state_ndc_to_world_array_##S(benchmark::State& state) {                                                          \
+    lm2_camera3_state_##S cam = lm2_camera3_state_make_##S(bench_camera_##S());                                                           \
+    auto src = lm2_bench::random_v3s<lm2_bench_##S>(LM2_BENCH_BATCH * 4, -0.9, 0.9);                                                      \
+    std::vector<lm2_v3_##S> dst(src.size());                                                                                              \
+    for (auto _ : state) {                                                                                                                \
+      /* Invalidate as a moving camera would once per frame */                                                                            \
+      lm2_camera3_state_move_##S(&cam, lm2_v3_make_##S(0, 0, 0));                                                                         \
+      lm2_camera3_state_ndc_to_world_array_##S(&cam, src.data(), dst.data(), (uint32_t)src.size());                                       \
+      benchmark::DoNotOptimize(dst.data());                                                                                               \
+    }                                                                                                                                     \
+    state.SetItemsProcessed(state.iterations() * src.size());                                                                             \
+  }                                                                                                                                       \
+  BENCHMARK(BM_camera3_state_ndc_to_world_array_##S);                                                                                     \
+                                                                                                                                          \
+  static void BM_camera3_world_to_ndc_##S(benchmark::State& state) {                                                                      \
+    lm2_camera3_##S camera = bench_camera_##S();                                                                                          \
+    auto src = lm2_bench::random_v3s<lm2_bench_##S>(LM2_BENCH_BATCH * 4, -10, 10);                                                        \
+    std::vector<lm2_v3_##S> dst(src.size());                                                                                              \
+    for (auto _ : state) {                                                                                                                \
+      for (size_t i = 0; i < src.size(); i++) {                                                                                           \
+        dst[i] = lm2_camera3_world_to_ndc_##S(camera, src[i]);                                                                            \
+      }                                                                                                                                   \
+      benchmark::DoNotOptimize(dst.data());                                                                                               \
+    }                                                                                                                                     \
+    state.SetItemsProcessed(state.iterations() * src.size());                                                                             \
+  }                                                                                                                                       \
+  BENCHMARK(BM_camera3_world_to_ndc_##S);                                                                                                 \
+                                                                                                                                          \
+  static void BM_camera3_state_world_to_ndc_array_##S(benchmark::State& state) {                                                          \
+    lm2_camera3_state_##S cam = lm2_camera3_state_make_##S(bench_camera_##S());                                                           \
+    auto src = lm2_bench::random_v3s<lm2_bench_##S>(LM2_BENCH_BATCH * 4, -10, 10);                                                        \
+    std::vector<lm2_v3_##S> dst(src.size());                                                                                              \
+    for (auto _ : state) {                                                                                                                \
+      lm2_camera3_state_move_##S(&cam, lm2_v3_make_##S(0, 0, 0));                                                                         \
+      lm2_camera3_state_world_to_ndc_array_##S(&cam, src.data(), dst.data(), (uint32_t)src.size());                                       \
+      benchmark::DoNotOptimize(dst.data());                                                                                               \
+    }                                                                                                                                     \
+    state.SetItemsProcessed(state.iterations() * src.size());                                                                             \
+  }                                                                                                                                       \
+  BENCHMARK(BM_camera3_state_world_to_ndc_array_##S);
+
+LM2_BENCH_CAMERA3_STATE(f32)
+LM2_BENCH_CAMERA3_STATE(f64)
@@ -0,0 +1,165 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <cmath>
+#include "bench_common.h"
+
+// =============================================================================
+// Broadphase2 Benchmarks
+// =============================================================================
+// Circles of radius 1 to 2 spread over a square whose side grows with the
+// square root of the count, so the density (and the pairs per proxy) stays the
+// same at 1k, 10k and 100k proxies. Moving bodies step by up to 0.1 per frame.
+
+#define LM2_BENCH_BROADPHASE2(S)                                                                                                   \
+  struct bench_world_##S {                                                                                                         \
+    std::vector<lm2_circle_##S> circles;                                                                                           \
+    std::vector<lm2_v2_##S> velocities;                                                                                            \
+    std::vector<lm2_broadphase2_node_##S> nodes;                                                                                   \
+    std::vector<lm2_broadphase2_proxy> proxies;                                                                                    \
+    lm2_broadphase2_##S bp;                                                                                                        \
+    lm2_bench_##S side;                                                                                                            \
+  };                                                                                                                               \
+  static void make_world_##S(bench_world_##S& world, size_t count, bool insert) {                                                  \
+    lm2_bench::rng r(1);                                                                                                           \
+    world.side = (lm2_bench_##S)(8.0 * std::sqrt((double)count));                                                                  \
+    world.circles.resize(count);                                                                                                   \
+    world.velocities.resize(count);                                                                                                \
+    for (size_t i = 0; i < count; i++) {                                                                                           \
+      world.circles[i].center = lm2_bench::random_v2<lm2_bench_##S>(r, 0, world.side);                                             \
+      world.circles[i].radius = (lm2_bench_##S)r.uniform(1, 2);                                                                    \
+      world.velocities[i] = lm2_bench::random_v2<lm2_bench_##S>(r, -0.1, 0.1);                                                     \
+    }                                                                                                                              \
+    world.nodes.resize(lm2_broadphase2_node_buffer_size_##S(count));                                                               \
+    world.bp = lm2_broadphase2_make_##S(world.nodes.data(), world.nodes.size(), (lm2_bench_##S)0.5);                               \
+    world.proxies.resize(count);                                                                                                   \
+    for (size_t i = 0; insert && i < count; i++) {                                                                                 \
+      world.proxies[i] = lm2_broadphase2_insert_shape_##S(&world.bp, lm2_shape2_from_circle_##S(&world.circles[i]));               \
+    }                                                                                                                              \
+  }                                                                                                                                \
+                                                                                                                                   \
+  static void BM_broadphase2_insert_##S(benchmark::State& state) {                                                                 \
+    bench_world_##S world;                                                                                                         \
+    make_world_##S(world, (size_t)state.range(0), false);                                                                          \
+    for (auto _ : state) {                                                                                                         \
+      world.bp = lm2_broadphase2_make_##S(world.nodes.data(), world.nodes.size(), (lm2_bench_##S)0.5);                             \
+      for (size_t i = 0; i < world.circles.size(); i++) {                                                                          \
+        world.proxies[i] = lm2_broadphase2_insert_shape_##S(&world.bp, lm2_shape2_from_circle_##S(&world.circles[i]));             \
+      }                                                                                                                            \
+      benchmark::ClobberMemory();                                                                                                  \
+    }                                                                                                                              \
+    state.counters["proxies/s"] = benchmark::Counter((double)world.circles.size(), benchmark::Counter::kIsIterationInvariantRate); \
+  }                                                                                                                                \
+  BENCHMARK(BM_broadphase2_insert_##S)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);                         \
+                                                                                                                                   \
+  /* One simulation frame: move every proxy, then enumerate the pairs */                                                           \
+  static void BM_broadphase2_step_##S(benchmark::State& state) {                                                                   \
+    bench_world_##S world;                                                                                                         \
+    make_world_##S(world, (size_t)state.range(0), true);                                                                           \
+    std::vector<lm2_broadphase2_pair> pairs(world.circles.size() * 4);                                                             \
+    size_t pair_count = 0;                                                                                                         \
+    for (auto _ : state) {                                                                                                         \
+      for (size_t i = 0; i < world.circles.size(); i++) {                                                                          \
+        world.circles[i].center = lm2_v2_add_##S(world.circles[i].center, world.velocities[i]);                                    \
+        lm2_r2_##S bounds = lm2_shape2_bounds_##S(lm2_shape2_from_circle_##S(&world.circles[i]));                                  \
+        lm2_broadphase2_move_##S(&world.bp, world.proxies[i], bounds, world.velocities[i]);                                        \
+      }                                                                                                                            \
+      pair_count = lm2_broadphase2_find_pairs_##S(&world.bp, pairs.data(), pairs.size());                                          \
+      benchmark::DoNotOptimize(pairs.data());                                                                                      \
+      benchmark::ClobberMemory();                                                                                                  \
+    }                                                                                                                              \
+    state.counters["pairs"] = (double)pair_count;                                                                                  \
+    state.counters["proxies/s"] = benchmark::Counter((double)world.circles.size(), benchmark::Counter::kIsIterationInvariantRate); \
+  }                                                                                                                                \
+  BENCHMARK(BM_broadphase2_step_##S)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);                           \
+                                                                                                                                   \
+  static void BM_broadphase2_find_pairs_##S(benchmark::State& state) {                                                             \
+    bench_world_##S world;                                                                                                         \
+    make_world_##S(world, (size_t)state.range(0), true);                                                                           \
+    std::vector<lm2_broadphase2_pair> pairs(world.circles.size() * 4);                                                             \
+    for (auto _ : state) {                                                                                                         \
+      size_t pair_count = lm2_broadphase2_find_pairs_##S(&world.bp, pairs.data(), pairs.size());                                   \
+      benchmark::DoNotOptimize(pair_count);                                                                                        \
+      benchmark::ClobberMemory();                                                                                                  \
+    }                                                                                                                              \
+    state.counters["proxies/s"] = benchmark::Counter((double)world.circles.size(), benchmark::Counter::kIsIterationInvariantRate); \
+  }                                                                                                                                \
+  BENCHMARK(BM_broadphase2_find_pairs_##S)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);                     \
+                                                                                                                                   \
+  /* All-pairs AABB test, the baseline the tree replaces */                                                                        \
+  static void BM_broadphase2_brute_force_pairs_##S(benchmark::State& state) {                                                      \
+    bench_world_##S world;                                                                                                         \
+    make_world_##S(world, (size_t)state.range(0), true);                                                                           \
+    std::vector<lm2_r2_##S> fat(world.circles.size());                                                                             \
+    for (size_t i = 0; i < fat.size(); i++) fat[i] = lm2_broadphase2_get_fat_bounds_##S(&world.bp, world.proxies[i]);              \
+    for (auto _ : state) {                                                                                                         \
+      size_t pair_count = 0;                                                                                                       \
+      for (size_t i = 0; i < fat.size(); i++) {                                                                                    \
+        for (size_t j = i + 1; j < fat.size(); j++) {                                                                              \
+          pair_count += fat[i].min.x <= fat[j].max.x && fat[j].min.x <= fat[i].max.x && fat[i].min.y <= fat[j].max.y &&            \
+                        fat[j].min.y <= fat[i].max.y;                                                                              \
+        }                                                                                                                          \
+      }                                                                                                                            \
+      benchmark::DoNotOptimize(pair_count);                                                                                        \
+    }                                                                                                                              \
+    state.counters["proxies/s"] = benchmark::Counter((double)fat.size(), benchmark::Counter::kIsIterationInvariantRate);           \
+  }                                                                                                                                \
+  BENCHMARK(BM_broadphase2_brute_force_pairs_##S)->Arg(1000)->Arg(10000)->Unit(benchmark::kMicrosecond);                           \
+                                                                                                                                   \
+  static void BM_broadphase2_query_aabb_##S(benchmark::State& state) {                                                             \
+    bench_world_##S world;                                                                                                         \
+    make_world_##S(world, (size_t)state.range(0), true);                                                                           \
+    auto corners = lm2_bench::random_v2s<lm2_bench_##S>(LM2_BENCH_BATCH, 0, world.side, 2);                                        \
+    std::vector<lm2_broadphase2_proxy> found(world.circles.size());                                                                \
+    size_t total = 0;                                                                                                              \
+    for (auto _ : state) {                                                                                                         \
+      for (size_t i = 0; i < LM2_BENCH_BATCH; i++) {                                                                               \
+        lm2_r2_##S query = lm2_r2_from_position_size_##S(corners[i], lm2_v2_make_##S(16, 16));                                     \
+        total += lm2_broadphase2_query_aabb_##S(&world.bp, query, found.data(), found.size());                                     \
+      }                                                                                                                            \
+      benchmark::DoNotOptimize(total);                                                                                             \
+    }                                                                                                                              \
+    state.SetItemsProcessed(state.iterations() * LM2_BENCH_BATCH);                                                                 \
+  }                                                                                                                                \
+  BENCHMARK(BM_broadphase2_query_aabb_##S)->Arg(1000)->Arg(10000)->Arg(100000);                                                    \
+                                                                                                                                   \
+  static void BM_broadphase2_raycast_##S(benchmark::State& state) {                                                                \
+    bench_world_##S world;                                                                                                         \
+    make_world_##S(world, (size_t)state.range(0), true);                                                                           \
+    auto from = lm2_bench::random_v2s<lm2_bench_##S>(LM2_BENCH_BATCH, 0, world.side, 3);                                           \
+    auto to = lm2_bench::random_v2s<lm2_bench_##S>(LM2_BENCH_BATCH, 0, world.side, 4);                                             \
+    std::vector<lm2_broadphase2_hit_##S> out(LM2_BENCH_BATCH);                                                                     \
+    for (auto _ : state) {                                                                                                         \
+      for (size_t i = 0; i < LM2_BENCH_BATCH; i++) {                                                                               \
+        out[i] = lm2_broadphase2_raycast_##S(&world.bp, lm2_ray2_from_points_##S(from[i], to[i]));                                 \
+      }                                                                                                                            \
+      benchmark::DoNotOptimize(out.data());                                                                                        \
+      benchmark::ClobberMemory();                                                                                                  \
+    }                                                                                                                              \
+    state.SetItemsProcessed(state.iterations() * LM2_BENCH_BATCH);                                                                 \
+  }                                                                                                                                \
+  BENCHMARK(BM_broadphase2_raycast_##S)->Arg(1000)->Arg(10000)->Arg(100000);
+
+LM2_BENCH_BROADPHASE2(f32)
+LM2_BENCH_BROADPHASE2(f64)
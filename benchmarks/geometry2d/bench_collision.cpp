@@ -0,0 +1,174 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "bench_common.h"
+
+// =============================================================================
+// 2D Collision Benchmarks
+// =============================================================================
+// Shapes are scattered so that roughly half of the pairs overlap, which keeps
+// both the early-out and the full manifold paths in the measurement.
+
+#define LM2_BENCH_COLLISION(S)                                                                               \
+  static void BM_manifold_circle_to_circle_##S(benchmark::State& state) {                                    \
+    auto c = lm2_bench::random_v2s<lm2_bench_##S>(2 * LM2_BENCH_BATCH, -4.0, 4.0, 1);                        \
+    std::vector<lm2_manifold_##S> out(LM2_BENCH_BATCH);                                                      \
+    for (auto _ : state) {                                                                                   \
+      for (size_t i = 0; i < LM2_BENCH_BATCH; i++) {                                                         \
+        lm2_circle_##S a = {c[2 * i], 1};                                                                    \
+        lm2_circle_##S b = {c[2 * i + 1], 1};                                                                \
+        lm2_manifold_circle_to_circle_##S(a, b, &out[i]);                                                    \
+      }                                                                                                      \
+      benchmark::DoNotOptimize(out.data());                                                                  \
+      benchmark::ClobberMemory();                                                                            \
+    }                                                                                                        \
+    state.SetItemsProcessed(state.iterations() * LM2_BENCH_BATCH);                                           \
+  }                                                                                                          \
+  BENCHMARK(BM_manifold_circle_to_circle_##S);                                                               \
+                                                                                                             \
+  static void BM_manifold_capsule_to_capsule_##S(benchmark::State& state) {                                  \
+    auto p = lm2_bench::random_v2s<lm2_bench_##S>(4 * LM2_BENCH_BATCH, -4.0, 4.0, 1);                        \
+    std::vector<lm2_manifold_##S> out(LM2_BENCH_BATCH);                                                      \
+    for (auto _ : state) {                                                                                   \
+      for (size_t i = 0; i < LM2_BENCH_BATCH; i++) {                                                         \
+        lm2_capsule2_##S a = {p[4 * i], p[4 * i + 1], (lm2_bench_##S)0.5};                                   \
+        lm2_capsule2_##S b = {p[4 * i + 2], p[4 * i + 3], (lm2_bench_##S)0.5};                               \
+        lm2_manifold_capsule_to_capsule_##S(a, b, &out[i]);                                                  \
+      }                                                                                                      \
+      benchmark::DoNotOptimize(out.data());                                                                  \
+      benchmark::ClobberMemory();                                                                            \
+    }                                                                                                        \
+    state.SetItemsProcessed(state.iterations() * LM2_BENCH_BATCH);                                           \
+  }                                                                                                          \
+  BENCHMARK(BM_manifold_capsule_to_capsule_##S);                                                             \
+                                                                                                             \
+  static void BM_collide_polygon_to_polygon_##S(benchmark::State& state) {                                   \
+    const size_t sides = (size_t)state.range(0);                                                             \
+    auto c = lm2_bench::random_v2s<lm2_bench_##S>(2 * LM2_BENCH_BATCH, -4.0, 4.0, 1);                        \
+    std::vector<lm2_v2_##S> verts(2 * LM2_BENCH_BATCH * sides);                                              \
+    for (size_t i = 0; i < c.size(); i++) {                                                                  \
+      lm2_polygon_make_regular_##S(&verts[i * sides], sides, c[i], 1);                                       \
+    }                                                                                                        \
+    size_t hits = 0;                                                                                         \
+    for (auto _ : state) {                                                                                   \
+      for (size_t i = 0; i < LM2_BENCH_BATCH; i++) {                                                         \
+        lm2_polygon_##S a = lm2_polygon_make_##S(&verts[(2 * i) * sides], sides);                            \
+        lm2_polygon_##S b = lm2_polygon_make_##S(&verts[(2 * i + 1) * sides], sides);                        \
+        hits += lm2_collide_polygon_to_polygon_##S(a, b);                                                    \
+      }                                                                                                      \
+      benchmark::DoNotOptimize(hits);                                                                        \
+    }                                                                                                        \
+    state.SetItemsProcessed(state.iterations() * LM2_BENCH_BATCH);                                           \
+  }                                                                                                          \
+  BENCHMARK(BM_collide_polygon_to_polygon_##S)->Arg(4)->Arg(8);                                              \
+                                                                                                             \
+  static void BM_manifold_polygon_to_polygon_##S(benchmark::State& state) {                                  \
+    const size_t sides = (size_t)state.range(0);                                                             \
+    auto c = lm2_bench::random_v2s<lm2_bench_##S>(2 * LM2_BENCH_BATCH, -4.0, 4.0, 1);                        \
+    std::vector<lm2_v2_##S> verts(2 * LM2_BENCH_BATCH * sides);                                              \
+    for (size_t i = 0; i < c.size(); i++) {                                                                  \
+      lm2_polygon_make_regular_##S(&verts[i * sides], sides, c[i], 1);                                       \
+    }                                                                                                        \
+    std::vector<lm2_manifold_##S> out(LM2_BENCH_BATCH);                                                      \
+    for (auto _ : state) {                                                                                   \
+      for (size_t i = 0; i < LM2_BENCH_BATCH; i++) {                                                         \
+        lm2_polygon_##S a = lm2_polygon_make_##S(&verts[(2 * i) * sides], sides);                            \
+        lm2_polygon_##S b = lm2_polygon_make_##S(&verts[(2 * i + 1) * sides], sides);                        \
+        lm2_manifold_polygon_to_polygon_##S(a, b, &out[i]);                                                  \
+      }                                                                                                      \
+      benchmark::DoNotOptimize(out.data());                                                                  \
+      benchmark::ClobberMemory();                                                                            \
+    }                                                                                                        \
+    state.SetItemsProcessed(state.iterations() * LM2_BENCH_BATCH);                                           \
+  }                                                                                                          \
+  BENCHMARK(BM_manifold_polygon_to_polygon_##S)->Arg(4)->Arg(8);                                             \
+                                                                                                             \
+  static void BM_collide_convex_polygon_to_convex_polygon_##S(benchmark::State& state) {                     \
+    const size_t sides = (size_t)state.range(0);                                                             \
+    auto c = lm2_bench::random_v2s<lm2_bench_##S>(2 * LM2_BENCH_BATCH, -4.0, 4.0, 1);                        \
+    std::vector<lm2_v2_##S> verts(2 * LM2_BENCH_BATCH * sides);                                              \
+    std::vector<lm2_v2_##S> norms(2 * LM2_BENCH_BATCH * sides);                                              \
+    std::vector<lm2_convex_polygon_##S> convex(2 * LM2_BENCH_BATCH);                                         \
+    for (size_t i = 0; i < c.size(); i++) {                                                                  \
+      lm2_polygon_make_regular_##S(&verts[i * sides], sides, c[i], 1);                                       \
+      lm2_polygon_##S polygon = lm2_polygon_make_##S(&verts[i * sides], sides);                              \
+      convex[i] = lm2_convex_polygon_make_##S(polygon, &norms[i * sides]);                                   \
+    }                                                                                                        \
+    size_t hits = 0;                                                                                         \
+    for (auto _ : state) {                                                                                   \
+      for (size_t i = 0; i < LM2_BENCH_BATCH; i++) {                                                         \
+        hits += lm2_collide_convex_polygon_to_convex_polygon_##S(convex[2 * i], convex[2 * i + 1]);          \
+      }                                                                                                      \
+      benchmark::DoNotOptimize(hits);                                                                        \
+    }                                                                                                        \
+    state.SetItemsProcessed(state.iterations() * LM2_BENCH_BATCH);                                           \
+  }                                                                                                          \
+  BENCHMARK(BM_collide_convex_polygon_to_convex_polygon_##S)->Arg(4)->Arg(8);                                \
+                                                                                                             \
+  static void BM_manifold_convex_polygon_to_convex_polygon_##S(benchmark::State& state) {                    \
+    const size_t sides = (size_t)state.range(0);                                                             \
+    auto c = lm2_bench::random_v2s<lm2_bench_##S>(2 * LM2_BENCH_BATCH, -4.0, 4.0, 1);                        \
+    std::vector<lm2_v2_##S> verts(2 * LM2_BENCH_BATCH * sides);                                              \
+    std::vector<lm2_v2_##S> norms(2 * LM2_BENCH_BATCH * sides);                                              \
+    std::vector<lm2_convex_polygon_##S> convex(2 * LM2_BENCH_BATCH);                                         \
+    for (size_t i = 0; i < c.size(); i++) {                                                                  \
+      lm2_polygon_make_regular_##S(&verts[i * sides], sides, c[i], 1);                                       \
+      lm2_polygon_##S polygon = lm2_polygon_make_##S(&verts[i * sides], sides);                              \
+      convex[i] = lm2_convex_polygon_make_##S(polygon, &norms[i * sides]);                                   \
+    }                                                                                                        \
+    std::vector<lm2_manifold_##S> out(LM2_BENCH_BATCH);                                                      \
+    for (auto _ : state) {                                                                                   \
+      for (size_t i = 0; i < LM2_BENCH_BATCH; i++) {                                                         \
+        lm2_manifold_convex_polygon_to_convex_polygon_##S(convex[2 * i], convex[2 * i + 1], &out[i]);        \
+      }                                                                                                      \
+      benchmark::DoNotOptimize(out.data());                                                                  \
+      benchmark::ClobberMemory();                                                                            \
+    }                                                                                                        \
+    state.SetItemsProcessed(state.iterations() * LM2_BENCH_BATCH);                                           \
+  }                                                                                                          \
+  BENCHMARK(BM_manifold_convex_polygon_to_convex_polygon_##S)->Arg(4)->Arg(8);                               \
+                                                                                                             \
+  static void BM_manifold_shape_to_shape_##S(benchmark::State& state) {                                      \
+    auto c = lm2_bench::random_v2s<lm2_bench_##S>(2 * LM2_BENCH_BATCH, -4.0, 4.0, 1);                        \
+    std::vector<lm2_circle_##S> circles(LM2_BENCH_BATCH);                                                    \
+    std::vector<lm2_capsule2_##S> capsules(LM2_BENCH_BATCH);                                                 \
+    for (size_t i = 0; i < LM2_BENCH_BATCH; i++) {                                                           \
+      circles[i] = {c[2 * i], 1};                                                                            \
+      capsules[i] = {c[2 * i + 1], lm2_v2_add_##S(c[2 * i + 1], lm2_v2_make_##S(1, 1)), (lm2_bench_##S)0.5}; \
+    }                                                                                                        \
+    std::vector<lm2_manifold_##S> out(LM2_BENCH_BATCH);                                                      \
+    for (auto _ : state) {                                                                                   \
+      for (size_t i = 0; i < LM2_BENCH_BATCH; i++) {                                                         \
+        lm2_manifold_shape_to_shape_##S(lm2_shape2_from_circle_##S(&circles[i]),                             \
+                                        lm2_shape2_from_capsule_##S(&capsules[i]), &out[i]);                 \
+      }                                                                                                      \
+      benchmark::DoNotOptimize(out.data());                                                                  \
+      benchmark::ClobberMemory();                                                                            \
+    }                                                                                                        \
+    state.SetItemsProcessed(state.iterations() * LM2_BENCH_BATCH);                                           \
+  }                                                                                                          \
+  BENCHMARK(BM_manifold_shape_to_shape_##S);
+
+LM2_BENCH_COLLISION(f32)
+LM2_BENCH_COLLISION(f64)
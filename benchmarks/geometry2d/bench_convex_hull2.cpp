@@ -0,0 +1,75 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <cmath>
+#include "bench_common.h"
+
+// =============================================================================
+// 2D Convex Hull Benchmarks
+// =============================================================================
+// Points spread uniformly over a disc, so the extreme point filter drops most of
+// them. The first argument is the point count; the threaded bench runs 4M
+// points and sweeps the thread count.
+
+#define LM2_BENCH_CONVEX_HULL2(S)                                                                                        \
+  static std::vector<lm2_v2_##S> disc_points_##S(size_t count) {                                                         \
+    lm2_bench::rng r(3);                                                                                                 \
+    std::vector<lm2_v2_##S> points(count);                                                                               \
+    for (auto& p : points) {                                                                                             \
+      double angle = r.uniform(0.0, 6.283185307179586);                                                                  \
+      double radius = 100.0 * std::sqrt(r.uniform(0.0, 1.0));                                                            \
+      p = lm2_v2_make_##S((lm2_bench_##S)(radius * std::cos(angle)), (lm2_bench_##S)(radius * std::sin(angle)));         \
+    }                                                                                                                    \
+    return points;                                                                                                       \
+  }                                                                                                                      \
+                                                                                                                         \
+  static void BM_convex_hull2_##S(benchmark::State& state) {                                                             \
+    auto points = disc_points_##S((size_t)state.range(0));                                                               \
+    std::vector<lm2_v2_##S> hull(points.size());                                                                         \
+    size_t count = 0;                                                                                                    \
+    for (auto _ : state) {                                                                                               \
+      count = lm2_convex_hull2_##S(points.data(), points.size(), hull.data(), hull.size(), 1);                           \
+      benchmark::DoNotOptimize(count);                                                                                   \
+      benchmark::ClobberMemory();                                                                                        \
+    }                                                                                                                    \
+    state.SetItemsProcessed(state.iterations() * state.range(0));                                                        \
+    state.counters["hull"] = (double)count;                                                                              \
+  }                                                                                                                      \
+  BENCHMARK(BM_convex_hull2_##S)->RangeMultiplier(16)->Range(1024, 4194304);                                             \
+                                                                                                                         \
+  static void BM_convex_hull2_threads_##S(benchmark::State& state) {                                                     \
+    auto points = disc_points_##S(4194304);                                                                              \
+    std::vector<lm2_v2_##S> hull(points.size());                                                                         \
+    uint32_t threads = (uint32_t)state.range(0);                                                                         \
+    for (auto _ : state) {                                                                                               \
+      size_t count = lm2_convex_hull2_##S(points.data(), points.size(), hull.data(), hull.size(), threads);              \
+      benchmark::DoNotOptimize(count);                                                                                   \
+      benchmark::ClobberMemory();                                                                                        \
+    }                                                                                                                    \
+    state.SetItemsProcessed(state.iterations() * (int64_t)points.size());                                                \
+  }                                                                                                                      \
+  BENCHMARK(BM_convex_hull2_threads_##S)->ArgName("threads")->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
+
+LM2_BENCH_CONVEX_HULL2(f32)
+LM2_BENCH_CONVEX_HULL2(f64)
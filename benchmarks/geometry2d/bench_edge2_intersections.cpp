@@ -0,0 +1,96 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <cmath>
+#include "bench_common.h"
+
+// =============================================================================
+// Edge Set Intersection Benchmarks
+// =============================================================================
+// A synthetic level map: closed rooms of 4 to 12 short walls scattered over a
+// square, plus a few long walls across the whole map. Rooms share wall corners
+// and some overlap their neighbours, so there are shared-endpoint touches and
+// real crossings. The first argument is the edge count; the threaded bench runs
+// 131072 edges and sweeps the thread count.
+
+#define LM2_BENCH_EDGE2_INTERSECTIONS(S)                                                                                 \
+  static std::vector<lm2_edge2_##S> level_edges_##S(size_t count) {                                                      \
+    lm2_bench::rng r(7);                                                                                                 \
+    std::vector<lm2_edge2_##S> edges;                                                                                    \
+    edges.reserve(count);                                                                                                \
+    double side = 4.0 * std::sqrt((double)count);                                                                        \
+    for (size_t w = 0; w < 8 && edges.size() < count; w++) {                                                             \
+      lm2_v2_##S a = lm2_bench::random_v2<lm2_bench_##S>(r, 0, side);                                                    \
+      lm2_v2_##S b = lm2_bench::random_v2<lm2_bench_##S>(r, 0, side);                                                    \
+      edges.push_back(lm2_edge2_make_##S(a, b));                                                                         \
+    }                                                                                                                    \
+    while (edges.size() < count) {                                                                                       \
+      lm2_v2_##S center = lm2_bench::random_v2<lm2_bench_##S>(r, 0, side);                                               \
+      size_t walls = 4 + (size_t)(r.next() % 9);                                                                         \
+      lm2_v2_##S first = lm2_v2_make_##S((lm2_bench_##S)(center.x + r.uniform(1.0, 3.0)), center.y);                     \
+      lm2_v2_##S prev = first;                                                                                           \
+      for (size_t k = 1; k <= walls && edges.size() < count; k++) {                                                      \
+        double angle = 6.283185307179586 * (double)k / (double)walls;                                                    \
+        double radius = r.uniform(1.0, 3.0);                                                                             \
+        lm2_v2_##S next = k == walls ? first                                                                             \
+                                     : lm2_v2_make_##S((lm2_bench_##S)(center.x + radius * std::cos(angle)),             \
+                                                       (lm2_bench_##S)(center.y + radius * std::sin(angle)));            \
+        edges.push_back(lm2_edge2_make_##S(prev, next));                                                                 \
+        prev = next;                                                                                                     \
+      }                                                                                                                  \
+    }                                                                                                                    \
+    return edges;                                                                                                        \
+  }                                                                                                                      \
+                                                                                                                         \
+  static void BM_edge2_find_intersections_##S(benchmark::State& state) {                                                 \
+    auto edges = level_edges_##S((size_t)state.range(0));                                                                \
+    size_t total = lm2_edge2_find_intersections_##S(edges.data(), edges.size(), true, NULL, 0, 1);                       \
+    std::vector<lm2_edge2_intersection_##S> hits(total);                                                                 \
+    for (auto _ : state) {                                                                                               \
+      size_t count = lm2_edge2_find_intersections_##S(edges.data(), edges.size(), true, hits.data(), total, 1);          \
+      benchmark::DoNotOptimize(count);                                                                                   \
+      benchmark::ClobberMemory();                                                                                        \
+    }                                                                                                                    \
+    state.SetItemsProcessed(state.iterations() * state.range(0));                                                        \
+    state.counters["hits"] = (double)total;                                                                              \
+  }                                                                                                                      \
+  BENCHMARK(BM_edge2_find_intersections_##S)->RangeMultiplier(8)->Range(1024, 131072);                                   \
+                                                                                                                         \
+  static void BM_edge2_find_intersections_threads_##S(benchmark::State& state) {                                         \
+    auto edges = level_edges_##S(131072);                                                                                \
+    uint32_t threads = (uint32_t)state.range(0);                                                                         \
+    size_t total = lm2_edge2_find_intersections_##S(edges.data(), edges.size(), true, NULL, 0, threads);                 \
+    std::vector<lm2_edge2_intersection_##S> hits(total);                                                                 \
+    for (auto _ : state) {                                                                                               \
+      size_t count =                                                                                                     \
+          lm2_edge2_find_intersections_##S(edges.data(), edges.size(), true, hits.data(), total, threads);               \
+      benchmark::DoNotOptimize(count);                                                                                   \
+      benchmark::ClobberMemory();                                                                                        \
+    }                                                                                                                    \
+    state.SetItemsProcessed(state.iterations() * (int64_t)edges.size());                                                 \
+  }                                                                                                                      \
+  BENCHMARK(BM_edge2_find_intersections_threads_##S)->ArgName("threads")->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
+
+LM2_BENCH_EDGE2_INTERSECTIONS(f32)
+LM2_BENCH_EDGE2_INTERSECTIONS(f64)
@@ -0,0 +1,144 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "bench_common.h"
+
+// =============================================================================
+// Mesh Indexing Benchmarks
+// =============================================================================
+// The triangle lists are N x N quad grids, so every interior vertex is shared
+// by six triangles and deduplication does real work. Welding goes through a
+// cell hash, so the time per triangle should stay flat as the grid grows; the
+// parallel runs weld a 512 x 512 grid (524288 triangles) on 1 to 8 threads.
+
+#define LM2_BENCH_MESH_INDEXING(S)                                                                                              \
+  static std::vector<lm2_triangle2_##S> grid2_##S(size_t n) {                                                                   \
+    std::vector<lm2_triangle2_##S> out(n * n * 2);                                                                              \
+    for (size_t y = 0; y < n; y++) {                                                                                            \
+      for (size_t x = 0; x < n; x++) {                                                                                          \
+        lm2_v2_##S a = lm2_v2_make_##S((lm2_bench_##S)x, (lm2_bench_##S)y);                                                     \
+        lm2_v2_##S b = lm2_v2_make_##S((lm2_bench_##S)(x + 1), (lm2_bench_##S)y);                                               \
+        lm2_v2_##S c = lm2_v2_make_##S((lm2_bench_##S)(x + 1), (lm2_bench_##S)(y + 1));                                         \
+        lm2_v2_##S d = lm2_v2_make_##S((lm2_bench_##S)x, (lm2_bench_##S)(y + 1));                                               \
+        lm2_triangle2_##S* t = &out[(y * n + x) * 2];                                                                           \
+        t[0][0] = a, t[0][1] = b, t[0][2] = c;                                                                                  \
+        t[1][0] = a, t[1][1] = c, t[1][2] = d;                                                                                  \
+      }                                                                                                                         \
+    }                                                                                                                           \
+    return out;                                                                                                                 \
+  }                                                                                                                             \
+                                                                                                                                \
+  static std::vector<lm2_triangle3_##S> grid3_##S(size_t n) {                                                                   \
+    auto flat = grid2_##S(n);                                                                                                   \
+    std::vector<lm2_triangle3_##S> out(flat.size());                                                                            \
+    for (size_t i = 0; i < flat.size(); i++) {                                                                                  \
+      for (int k = 0; k < 3; k++) {                                                                                             \
+        out[i][k] = lm2_v3_make_##S(flat[i][k].x, flat[i][k].y, 0);                                                             \
+      }                                                                                                                         \
+    }                                                                                                                           \
+    return out;                                                                                                                 \
+  }                                                                                                                             \
+                                                                                                                                \
+  static void BM_triangle2_list_to_indexed_mesh_##S(benchmark::State& state) {                                                  \
+    auto tris = grid2_##S((size_t)state.range(0));                                                                              \
+    lm2_indexed_mesh_size size = lm2_triangle2_list_to_indexed_mesh_size_##S(tris.data(), tris.size(), 0);                      \
+    std::vector<lm2_v2_##S> verts(size.vertex_count);                                                                           \
+    std::vector<uint32_t> indices(size.index_count);                                                                            \
+    for (auto _ : state) {                                                                                                      \
+      lm2_triangle2_list_to_indexed_mesh_##S(tris.data(), tris.size(), 0, verts.data(), verts.size(),                           \
+                                             indices.data(), indices.size());                                                   \
+      benchmark::DoNotOptimize(indices.data());                                                                                 \
+      benchmark::ClobberMemory();                                                                                               \
+    }                                                                                                                           \
+    state.SetItemsProcessed(state.iterations() * tris.size());                                                                  \
+  }                                                                                                                             \
+  BENCHMARK(BM_triangle2_list_to_indexed_mesh_##S)->Arg(8)->Arg(32)->Arg(64)->Arg(256);                                         \
+                                                                                                                                \
+  static void BM_triangle3_list_to_indexed_mesh_##S(benchmark::State& state) {                                                  \
+    auto tris = grid3_##S((size_t)state.range(0));                                                                              \
+    lm2_indexed_mesh3_size size = lm2_triangle3_list_to_indexed_mesh_size_##S(tris.data(), tris.size(), 0);                     \
+    std::vector<lm2_v3_##S> verts(size.vertex_count);                                                                           \
+    std::vector<uint32_t> indices(size.index_count);                                                                            \
+    for (auto _ : state) {                                                                                                      \
+      lm2_triangle3_list_to_indexed_mesh_##S(tris.data(), tris.size(), 0, verts.data(), verts.size(),                           \
+                                             indices.data(), indices.size());                                                   \
+      benchmark::DoNotOptimize(indices.data());                                                                                 \
+      benchmark::ClobberMemory();                                                                                               \
+    }                                                                                                                           \
+    state.SetItemsProcessed(state.iterations() * tris.size());                                                                  \
+  }                                                                                                                             \
+  BENCHMARK(BM_triangle3_list_to_indexed_mesh_##S)->Arg(8)->Arg(32)->Arg(64)->Arg(256);                                         \
+                                                                                                                                \
+  static void BM_triangle3_list_to_indexed_mesh_epsilon_##S(benchmark::State& state) {                                          \
+    auto tris = grid3_##S((size_t)state.range(0));                                                                              \
+    const lm2_bench_##S epsilon = (lm2_bench_##S)1e-3;                                                                          \
+    lm2_indexed_mesh3_size size = lm2_triangle3_list_to_indexed_mesh_size_##S(tris.data(), tris.size(), epsilon);               \
+    std::vector<lm2_v3_##S> verts(size.vertex_count);                                                                           \
+    std::vector<uint32_t> indices(size.index_count);                                                                            \
+    for (auto _ : state) {                                                                                                      \
+      lm2_triangle3_list_to_indexed_mesh_##S(tris.data(), tris.size(), epsilon, verts.data(), verts.size(),                     \
+                                             indices.data(), indices.size());                                                   \
+      benchmark::DoNotOptimize(indices.data());                                                                                 \
+      benchmark::ClobberMemory();                                                                                               \
+    }                                                                                                                           \
+    state.SetItemsProcessed(state.iterations() * tris.size());                                                                  \
+  }                                                                                                                             \
+  BENCHMARK(BM_triangle3_list_to_indexed_mesh_epsilon_##S)->Arg(64)->Arg(256);                                                  \
+                                                                                                                                \
+  static void BM_triangle3_list_to_indexed_mesh_parallel_##S(benchmark::State& state) {                                         \
+    auto tris = grid3_##S(512);                                                                                                 \
+    const uint32_t threads = (uint32_t)state.range(0);                                                                          \
+    lm2_indexed_mesh3_size size = lm2_triangle3_list_to_indexed_mesh_size_##S(tris.data(), tris.size(), 0);                     \
+    std::vector<lm2_v3_##S> verts(size.vertex_count);                                                                           \
+    std::vector<uint32_t> indices(size.index_count);                                                                            \
+    for (auto _ : state) {                                                                                                      \
+      lm2_triangle3_list_to_indexed_mesh_parallel_##S(tris.data(), tris.size(), 0, verts.data(), verts.size(),                  \
+                                                      indices.data(), indices.size(), threads);                                 \
+      benchmark::DoNotOptimize(indices.data());                                                                                 \
+      benchmark::ClobberMemory();                                                                                               \
+    }                                                                                                                           \
+    state.SetItemsProcessed(state.iterations() * tris.size());                                                                  \
+  }                                                                                                                             \
+  BENCHMARK(BM_triangle3_list_to_indexed_mesh_parallel_##S)->ArgName("threads")->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime(); \
+                                                                                                                                \
+  static void BM_indexed_mesh_to_triangle_list_##S(benchmark::State& state) {                                                   \
+    auto tris = grid2_##S((size_t)state.range(0));                                                                              \
+    lm2_indexed_mesh_size size = lm2_triangle2_list_to_indexed_mesh_size_##S(tris.data(), tris.size(), 0);                      \
+    std::vector<lm2_v2_##S> verts(size.vertex_count);                                                                           \
+    std::vector<uint32_t> indices(size.index_count);                                                                            \
+    lm2_triangle2_list_to_indexed_mesh_##S(tris.data(), tris.size(), 0, verts.data(), verts.size(),                             \
+                                           indices.data(), indices.size());                                                     \
+    std::vector<lm2_triangle2_##S> out(tris.size());                                                                            \
+    for (auto _ : state) {                                                                                                      \
+      lm2_indexed_mesh_to_triangle_list_##S(verts.data(), size.vertex_count, indices.data(), indices.size(),                    \
+                                            out.data(), out.size());                                                            \
+      benchmark::DoNotOptimize(out.data());                                                                                     \
+      benchmark::ClobberMemory();                                                                                               \
+    }                                                                                                                           \
+    state.SetItemsProcessed(state.iterations() * tris.size());                                                                  \
+  }                                                                                                                             \
+  BENCHMARK(BM_indexed_mesh_to_triangle_list_##S)->Arg(8)->Arg(32)->Arg(64);
+
+LM2_BENCH_MESH_INDEXING(f32)
+LM2_BENCH_MESH_INDEXING(f64)
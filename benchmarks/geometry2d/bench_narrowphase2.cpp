@@ -0,0 +1,106 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <cmath>
+#include "bench_common.h"
+
+// =============================================================================
+// Narrowphase2 Benchmarks
+// =============================================================================
+// 4096 circles, capsules and boxes (a third each) over a 64 x 64 square, with
+// 32k random pairs drawn from nearby shapes so most of them touch. The baseline
+// calls lm2_manifold_shape_to_shape per pair, in the shuffled pair order a
+// broadphase would produce. The argument of the batch bench is the thread count.
+
+#define LM2_BENCH_NARROWPHASE2(S)                                                                                               \
+  struct bench_pairs_##S {                                                                                                      \
+    std::vector<lm2_circle_##S> circles;                                                                                        \
+    std::vector<lm2_capsule2_##S> capsules;                                                                                     \
+    std::vector<lm2_aabb2_##S> aabbs;                                                                                           \
+    std::vector<lm2_shape2_##S> shapes;                                                                                         \
+    std::vector<lm2_narrowphase2_pair> pairs;                                                                                   \
+  };                                                                                                                            \
+                                                                                                                                \
+  static void make_pairs_##S(bench_pairs_##S& w) {                                                                              \
+    const size_t count = 4096;                                                                                                  \
+    lm2_bench::rng r(1);                                                                                                        \
+    w.circles.reserve(count);                                                                                                   \
+    w.capsules.reserve(count);                                                                                                  \
+    w.aabbs.reserve(count);                                                                                                     \
+    for (size_t i = 0; i < count; i++) {                                                                                        \
+      lm2_v2_##S c = lm2_bench::random_v2<lm2_bench_##S>(r, 0, 64);                                                             \
+      lm2_v2_##S d = lm2_bench::random_v2<lm2_bench_##S>(r, -1, 1);                                                             \
+      if (i % 3 == 0) {                                                                                                         \
+        w.circles.push_back(lm2_circle_make_##S(c, 1));                                                                         \
+        w.shapes.push_back(lm2_shape2_from_circle_##S(&w.circles.back()));                                                      \
+      } else if (i % 3 == 1) {                                                                                                  \
+        w.capsules.push_back(lm2_capsule2_make_##S(lm2_v2_sub_##S(c, d), lm2_v2_add_##S(c, d), (lm2_bench_##S)0.5));            \
+        w.shapes.push_back(lm2_shape2_from_capsule_##S(&w.capsules.back()));                                                    \
+      } else {                                                                                                                  \
+        w.aabbs.push_back(lm2_r2_from_min_max_##S(lm2_v2_sub_s_##S(c, 1), lm2_v2_add_s_##S(c, 1)));                             \
+        w.shapes.push_back(lm2_shape2_from_aabb2_##S(&w.aabbs.back()));                                                         \
+      }                                                                                                                         \
+    }                                                                                                                           \
+    for (size_t i = 0; i < 8 * count; i++) {                                                                                    \
+      uint32_t a = (uint32_t)(r.uniform(0, 1) * (count - 1));                                                                   \
+      uint32_t b = (uint32_t)(a + r.uniform(1, 64)) % count;                                                                    \
+      w.pairs.push_back({a, b});                                                                                                \
+    }                                                                                                                           \
+  }                                                                                                                             \
+                                                                                                                                \
+  static void BM_narrowphase2_per_pair_##S(benchmark::State& state) {                                                           \
+    bench_pairs_##S w;                                                                                                          \
+    make_pairs_##S(w);                                                                                                          \
+    std::vector<lm2_manifold_##S> out(w.pairs.size());                                                                          \
+    for (auto _ : state) {                                                                                                      \
+      size_t touching = 0;                                                                                                      \
+      for (const lm2_narrowphase2_pair& p : w.pairs) {                                                                          \
+        lm2_manifold_shape_to_shape_##S(w.shapes[p.a], w.shapes[p.b], &out[touching]);                                          \
+        touching += out[touching].count > 0;                                                                                    \
+      }                                                                                                                         \
+      benchmark::DoNotOptimize(touching);                                                                                       \
+      benchmark::ClobberMemory();                                                                                               \
+    }                                                                                                                           \
+    state.SetItemsProcessed(state.iterations() * w.pairs.size());                                                               \
+  }                                                                                                                             \
+  BENCHMARK(BM_narrowphase2_per_pair_##S);                                                                                      \
+                                                                                                                                \
+  static void BM_narrowphase2_collide_##S(benchmark::State& state) {                                                            \
+    bench_pairs_##S w;                                                                                                          \
+    make_pairs_##S(w);                                                                                                          \
+    std::vector<uint32_t> order(w.pairs.size());                                                                                \
+    std::vector<lm2_manifold_##S> out(w.pairs.size());                                                                          \
+    std::vector<uint32_t> out_pairs(w.pairs.size());                                                                            \
+    for (auto _ : state) {                                                                                                      \
+      size_t touching = lm2_narrowphase2_collide_##S(w.shapes.data(), w.pairs.data(), w.pairs.size(), order.data(), out.data(), \
+                                                     out_pairs.data(), (uint32_t)state.range(0));                               \
+      benchmark::DoNotOptimize(touching);                                                                                       \
+      benchmark::ClobberMemory();                                                                                               \
+    }                                                                                                                           \
+    state.SetItemsProcessed(state.iterations() * w.pairs.size());                                                               \
+  }                                                                                                                             \
+  BENCHMARK(BM_narrowphase2_collide_##S)->ArgName("threads")->Arg(1)->Arg(4)->Arg(0)->UseRealTime();
+
+LM2_BENCH_NARROWPHASE2(f32)
+LM2_BENCH_NARROWPHASE2(f64)
@@ -0,0 +1,77 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "bench_common.h"
+
+// =============================================================================
+// 2D Raycast Benchmarks
+// =============================================================================
+// Rays start on a ring around the origin and aim at jittered points near it,
+// so most of them hit the target shape.
+
+#define LM2_BENCH_RAYS2(S)                                                                           \
+  static std::vector<lm2_ray2_##S> random_rays2_##S(size_t count, uint64_t seed) {                   \
+    lm2_bench::rng r(seed);                                                                          \
+    std::vector<lm2_ray2_##S> out(count);                                                            \
+    for (auto& ray : out) {                                                                          \
+      lm2_bench_##S a = (lm2_bench_##S)r.uniform(0.0, 6.28);                                         \
+      lm2_v2_##S from = lm2_v2_make_##S((lm2_bench_##S)(10 * cos(a)), (lm2_bench_##S)(10 * sin(a))); \
+      lm2_v2_##S to = lm2_bench::random_v2<lm2_bench_##S>(r, -1.5, 1.5);                             \
+      ray = lm2_ray2_from_points_##S(from, to);                                                      \
+      ray.t_max = 20;                                                                                \
+    }                                                                                                \
+    return out;                                                                                      \
+  }
+
+#define LM2_BENCH_RAYCAST2(S, name, target)                                                        \
+  static void BM_raycast_##name##_##S(benchmark::State& state) {                                   \
+    auto rays = random_rays2_##S(LM2_BENCH_BATCH, 1);                                              \
+    std::vector<lm2_rayhit2_##S> out(rays.size());                                                 \
+    for (auto _ : state) {                                                                         \
+      for (size_t i = 0; i < rays.size(); i++) out[i] = lm2_raycast_##name##_##S(rays[i], target); \
+      benchmark::DoNotOptimize(out.data());                                                        \
+      benchmark::ClobberMemory();                                                                  \
+    }                                                                                              \
+    state.SetItemsProcessed(state.iterations() * LM2_BENCH_BATCH);                                 \
+  }                                                                                                \
+  BENCHMARK(BM_raycast_##name##_##S);
+
+#define LM2_BENCH_RAYCAST2_ALL(S)                                                              \
+  LM2_BENCH_RAYS2(S)                                                                           \
+  static const lm2_circle_##S bench_circle_##S = {{{0, 0}}, 1};                                \
+  static const lm2_capsule2_##S bench_capsule_##S = {{{-1, 0}}, {{1, 0}}, (lm2_bench_##S)0.5}; \
+  static const lm2_r2_##S bench_box_##S =                                                      \
+      lm2_r2_from_min_max_##S(lm2_v2_make_##S(-1, -1), lm2_v2_make_##S(1, 1));                 \
+  static lm2_v2_##S bench_hexagon_verts_##S[6];                                                \
+  static const lm2_polygon_##S bench_hexagon_##S = [] {                                        \
+    lm2_polygon_make_regular_##S(bench_hexagon_verts_##S, 6, lm2_v2_zero_##S(), 1);            \
+    return lm2_polygon_make_##S(bench_hexagon_verts_##S, 6);                                   \
+  }();                                                                                         \
+  LM2_BENCH_RAYCAST2(S, circle, bench_circle_##S)                                              \
+  LM2_BENCH_RAYCAST2(S, aabb, bench_box_##S)                                                   \
+  LM2_BENCH_RAYCAST2(S, capsule2, bench_capsule_##S)                                           \
+  LM2_BENCH_RAYCAST2(S, polygon, bench_hexagon_##S)
+
+LM2_BENCH_RAYCAST2_ALL(f32)
+LM2_BENCH_RAYCAST2_ALL(f64)
@@ -0,0 +1,99 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <cmath>
+#include "bench_common.h"
+
+// =============================================================================
+// Sat2 Benchmarks
+// =============================================================================
+// Pairs of regular polygons of radius 1 scattered over [-3, 3]^2, so roughly a
+// third of the pairs overlap. The argument is the vertex count of both shapes.
+
+#define LM2_BENCH_SAT2(S)                                                                        \
+  struct bench_polygons_##S {                                                                    \
+    std::vector<lm2_v2_##S> vertices;                                                            \
+    std::vector<lm2_v2_##S> normals;                                                             \
+    std::vector<lm2_convex_polygon_##S> convex;                                                  \
+  };                                                                                             \
+                                                                                                 \
+  static bench_polygons_##S make_polygons_##S(size_t count, size_t sides) {                      \
+    auto c = lm2_bench::random_v2s<lm2_bench_##S>(count, -3.0, 3.0, 1);                          \
+    bench_polygons_##S p;                                                                        \
+    p.vertices.resize(count * sides);                                                            \
+    p.normals.resize(count * sides);                                                             \
+    p.convex.resize(count);                                                                      \
+    for (size_t i = 0; i < count; i++) {                                                         \
+      lm2_polygon_make_regular_##S(&p.vertices[i * sides], sides, c[i], 1);                      \
+      lm2_polygon_##S polygon = lm2_polygon_make_##S(&p.vertices[i * sides], sides);             \
+      p.convex[i] = lm2_convex_polygon_make_##S(polygon, &p.normals[i * sides]);                 \
+    }                                                                                            \
+    return p;                                                                                    \
+  }                                                                                              \
+                                                                                                 \
+  static void BM_sat2_collide_polygon_to_polygon_##S(benchmark::State& state) {                  \
+    auto p = make_polygons_##S(2 * LM2_BENCH_BATCH, (size_t)state.range(0));                     \
+    size_t hits = 0;                                                                             \
+    for (auto _ : state) {                                                                       \
+      for (size_t i = 0; i < LM2_BENCH_BATCH; i++) {                                             \
+        hits += lm2_sat2_collide_polygon_to_polygon_##S(p.convex[2 * i], p.convex[2 * i + 1]);   \
+      }                                                                                          \
+      benchmark::DoNotOptimize(hits);                                                            \
+    }                                                                                            \
+    state.SetItemsProcessed(state.iterations() * LM2_BENCH_BATCH);                               \
+  }                                                                                              \
+  BENCHMARK(BM_sat2_collide_polygon_to_polygon_##S)->RangeMultiplier(2)->Range(8, 128);          \
+                                                                                                 \
+  static void BM_sat2_manifold_polygon_to_polygon_##S(benchmark::State& state) {                 \
+    auto p = make_polygons_##S(2 * LM2_BENCH_BATCH, (size_t)state.range(0));                     \
+    std::vector<lm2_manifold_##S> out(LM2_BENCH_BATCH);                                          \
+    for (auto _ : state) {                                                                       \
+      for (size_t i = 0; i < LM2_BENCH_BATCH; i++) {                                             \
+        lm2_sat2_manifold_polygon_to_polygon_##S(p.convex[2 * i], p.convex[2 * i + 1], &out[i]); \
+      }                                                                                          \
+      benchmark::DoNotOptimize(out.data());                                                      \
+      benchmark::ClobberMemory();                                                                \
+    }                                                                                            \
+    state.SetItemsProcessed(state.iterations() * LM2_BENCH_BATCH);                               \
+  }                                                                                              \
+  BENCHMARK(BM_sat2_manifold_polygon_to_polygon_##S)->RangeMultiplier(2)->Range(8, 128);         \
+                                                                                                 \
+  static void BM_sat2_manifold_circle_to_polygon_##S(benchmark::State& state) {                  \
+    auto p = make_polygons_##S(LM2_BENCH_BATCH, (size_t)state.range(0));                         \
+    auto c = lm2_bench::random_v2s<lm2_bench_##S>(LM2_BENCH_BATCH, -3.0, 3.0, 2);                \
+    std::vector<lm2_manifold_##S> out(LM2_BENCH_BATCH);                                          \
+    for (auto _ : state) {                                                                       \
+      for (size_t i = 0; i < LM2_BENCH_BATCH; i++) {                                             \
+        lm2_circle_##S circle = {c[i], 1};                                                       \
+        lm2_sat2_manifold_circle_to_polygon_##S(circle, p.convex[i], &out[i]);                   \
+      }                                                                                          \
+      benchmark::DoNotOptimize(out.data());                                                      \
+      benchmark::ClobberMemory();                                                                \
+    }                                                                                            \
+    state.SetItemsProcessed(state.iterations() * LM2_BENCH_BATCH);                               \
+  }                                                                                              \
+  BENCHMARK(BM_sat2_manifold_circle_to_polygon_##S)->RangeMultiplier(2)->Range(8, 128);
+
+LM2_BENCH_SAT2(f32)
+LM2_BENCH_SAT2(f64)
@@ -0,0 +1,128 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <cmath>
+#include "bench_common.h"
+
+// =============================================================================
+// Toi2 Benchmarks
+// =============================================================================
+// 4096 circles and boxes over a 64 x 64 square, each moving up to 4 units per
+// step, with 32k pairs of nearby shapes. The baseline is the sub-stepping the
+// time of impact replaces: 4 discrete manifold tests per pair along the path.
+// The argument of the batch bench is the thread count.
+
+#define LM2_BENCH_TOI2(S)                                                                                                             \
+  struct bench_toi_##S {                                                                                                              \
+    std::vector<lm2_circle_##S> circles;                                                                                              \
+    std::vector<lm2_aabb2_##S> aabbs;                                                                                                 \
+    std::vector<lm2_shape2_##S> shapes;                                                                                               \
+    std::vector<lm2_v2_##S> velocities;                                                                                               \
+    std::vector<lm2_narrowphase2_pair> pairs;                                                                                         \
+  };                                                                                                                                  \
+                                                                                                                                      \
+  static void make_toi_##S(bench_toi_##S& w) {                                                                                        \
+    const size_t count = 4096;                                                                                                        \
+    lm2_bench::rng r(1);                                                                                                              \
+    w.circles.reserve(count);                                                                                                         \
+    w.aabbs.reserve(count);                                                                                                           \
+    for (size_t i = 0; i < count; i++) {                                                                                              \
+      lm2_v2_##S c = lm2_bench::random_v2<lm2_bench_##S>(r, 0, 64);                                                                   \
+      w.velocities.push_back(lm2_bench::random_v2<lm2_bench_##S>(r, -4, 4));                                                          \
+      if (i % 2 == 0) {                                                                                                               \
+        w.circles.push_back(lm2_circle_make_##S(c, (lm2_bench_##S)0.5));                                                              \
+        w.shapes.push_back(lm2_shape2_from_circle_##S(&w.circles.back()));                                                            \
+      } else {                                                                                                                        \
+        w.aabbs.push_back(lm2_r2_from_min_max_##S(lm2_v2_sub_s_##S(c, (lm2_bench_##S)0.5), lm2_v2_add_s_##S(c, (lm2_bench_##S)0.5))); \
+        w.shapes.push_back(lm2_shape2_from_aabb2_##S(&w.aabbs.back()));                                                               \
+      }                                                                                                                               \
+    }                                                                                                                                 \
+    for (size_t i = 0; i < 8 * count; i++) {                                                                                          \
+      uint32_t a = (uint32_t)(r.uniform(0, 1) * (count - 1));                                                                         \
+      uint32_t b = (uint32_t)(a + r.uniform(1, 64)) % count;                                                                          \
+      w.pairs.push_back({a, b});                                                                                                      \
+    }                                                                                                                                 \
+  }                                                                                                                                   \
+                                                                                                                                      \
+  static void BM_toi2_substep_x4_##S(benchmark::State& state) {                                                                       \
+    bench_toi_##S w;                                                                                                                  \
+    make_toi_##S(w);                                                                                                                  \
+    bench_toi_##S moved;                                                                                                              \
+    make_toi_##S(moved);                                                                                                              \
+    for (auto _ : state) {                                                                                                            \
+      size_t touching = 0;                                                                                                            \
+      for (int step = 1; step <= 4; step++) {                                                                                         \
+        lm2_bench_##S t = (lm2_bench_##S)step / 4;                                                                                    \
+        for (size_t i = 0; i < w.circles.size(); i++) {                                                                               \
+          moved.circles[i].center = lm2_v2_add_##S(w.circles[i].center, lm2_v2_mul_s_##S(w.velocities[2 * i], t));                    \
+        }                                                                                                                             \
+        for (size_t i = 0; i < w.aabbs.size(); i++) {                                                                                 \
+          lm2_v2_##S d = lm2_v2_mul_s_##S(w.velocities[2 * i + 1], t);                                                                \
+          moved.aabbs[i] = lm2_r2_from_min_max_##S(lm2_v2_add_##S(w.aabbs[i].min, d), lm2_v2_add_##S(w.aabbs[i].max, d));             \
+        }                                                                                                                             \
+        for (const lm2_narrowphase2_pair& p : moved.pairs) {                                                                          \
+          lm2_manifold_##S m;                                                                                                         \
+          m.count = 0;                                                                                                                \
+          lm2_manifold_shape_to_shape_##S(moved.shapes[p.a], moved.shapes[p.b], &m);                                                  \
+          touching += m.count > 0;                                                                                                    \
+        }                                                                                                                             \
+      }                                                                                                                               \
+      benchmark::DoNotOptimize(touching);                                                                                             \
+      benchmark::ClobberMemory();                                                                                                     \
+    }                                                                                                                                 \
+    state.SetItemsProcessed(state.iterations() * w.pairs.size());                                                                     \
+  }                                                                                                                                   \
+  BENCHMARK(BM_toi2_substep_x4_##S);                                                                                                  \
+                                                                                                                                      \
+  static void BM_toi2_shape_to_shape_##S(benchmark::State& state) {                                                                   \
+    bench_toi_##S w;                                                                                                                  \
+    make_toi_##S(w);                                                                                                                  \
+    for (auto _ : state) {                                                                                                            \
+      size_t hits = 0;                                                                                                                \
+      for (const lm2_narrowphase2_pair& p : w.pairs) {                                                                                \
+        hits += lm2_toi2_shape_to_shape_##S(w.shapes[p.a], w.velocities[p.a], w.shapes[p.b], w.velocities[p.b]).hit;                  \
+      }                                                                                                                               \
+      benchmark::DoNotOptimize(hits);                                                                                                 \
+      benchmark::ClobberMemory();                                                                                                     \
+    }                                                                                                                                 \
+    state.SetItemsProcessed(state.iterations() * w.pairs.size());                                                                     \
+  }                                                                                                                                   \
+  BENCHMARK(BM_toi2_shape_to_shape_##S);                                                                                              \
+                                                                                                                                      \
+  static void BM_toi2_collide_##S(benchmark::State& state) {                                                                          \
+    bench_toi_##S w;                                                                                                                  \
+    make_toi_##S(w);                                                                                                                  \
+    std::vector<lm2_toi2_result_##S> out(w.pairs.size());                                                                             \
+    for (auto _ : state) {                                                                                                            \
+      size_t hits = lm2_toi2_collide_##S(w.shapes.data(), w.velocities.data(), w.pairs.data(), w.pairs.size(), out.data(),            \
+                                         (uint32_t)state.range(0));                                                                   \
+      benchmark::DoNotOptimize(hits);                                                                                                 \
+      benchmark::ClobberMemory();                                                                                                     \
+    }                                                                                                                                 \
+    state.SetItemsProcessed(state.iterations() * w.pairs.size());                                                                     \
+  }                                                                                                                                   \
+  BENCHMARK(BM_toi2_collide_##S)->ArgName("threads")->Arg(1)->Arg(4)->Arg(0)->UseRealTime();
+
+LM2_BENCH_TOI2(f32)
+LM2_BENCH_TOI2(f64)
@@ -0,0 +1,123 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <cmath>
+#include "bench_common.h"
+
+// =============================================================================
+// Polygon Triangulation Benchmarks
+// =============================================================================
+// The input is a star with alternating inner and outer radii, so it is concave
+// and the ear test rejects about half of the candidate vertices. Above 80
+// vertices the triangulator switches to z-order hashed ear tests. The hole
+// case punches a grid of small squares out of the star's center, measuring
+// hole bridging; the scratch case reuses one caller buffer across calls.
+
+#define LM2_BENCH_TRIANGULATION(S)                                                                            \
+  static std::vector<lm2_v2_##S> star_polygon_##S(size_t count) {                                             \
+    std::vector<lm2_v2_##S> out(count);                                                                       \
+    for (size_t i = 0; i < count; i++) {                                                                      \
+      double a = 6.283185307179586 * (double)i / (double)count;                                               \
+      double r = (i & 1) ? 0.5 : 1.0;                                                                         \
+      out[i] = lm2_v2_make_##S((lm2_bench_##S)(r * cos(a)), (lm2_bench_##S)(r * sin(a)));                     \
+    }                                                                                                         \
+    return out;                                                                                               \
+  }                                                                                                           \
+                                                                                                              \
+  static void BM_polygon_triangulate_ear_clipping_##S(benchmark::State& state) {                              \
+    auto verts = star_polygon_##S((size_t)state.range(0));                                                    \
+    lm2_polygon_##S polygon = lm2_polygon_make_##S(verts.data(), verts.size());                               \
+    std::vector<size_t> indices(lm2_polygon_max_triangle_count(verts.size()) * 3);                            \
+    for (auto _ : state) {                                                                                    \
+      size_t count = lm2_polygon_triangulate_ear_clipping_##S(polygon, indices.data());                       \
+      benchmark::DoNotOptimize(count);                                                                        \
+      benchmark::ClobberMemory();                                                                             \
+    }                                                                                                         \
+    state.SetItemsProcessed(state.iterations() * state.range(0));                                             \
+  }                                                                                                           \
+  BENCHMARK(BM_polygon_triangulate_ear_clipping_##S)->RangeMultiplier(4)->Range(16, 16384);                   \
+                                                                                                              \
+  static void BM_polygon_triangulate_scratch_##S(benchmark::State& state) {                                   \
+    auto verts = star_polygon_##S((size_t)state.range(0));                                                    \
+    lm2_polygon_##S polygon = lm2_polygon_make_##S(verts.data(), verts.size());                               \
+    std::vector<size_t> indices(lm2_polygon_max_triangle_count(verts.size()) * 3);                            \
+    std::vector<unsigned char> scratch(lm2_polygon_triangulate_scratch_size_##S(verts.size(), 0));            \
+    for (auto _ : state) {                                                                                    \
+      size_t count = lm2_polygon_triangulate_##S(polygon, NULL, 0, scratch.data(), scratch.size(),            \
+                                                 indices.data());                                             \
+      benchmark::DoNotOptimize(count);                                                                        \
+      benchmark::ClobberMemory();                                                                             \
+    }                                                                                                         \
+    state.SetItemsProcessed(state.iterations() * state.range(0));                                             \
+  }                                                                                                           \
+  BENCHMARK(BM_polygon_triangulate_scratch_##S)->RangeMultiplier(4)->Range(16, 16384);                        \
+                                                                                                              \
+  static void BM_polygon_triangulate_holes_##S(benchmark::State& state) {                                     \
+    size_t side = (size_t)state.range(0);                                                                     \
+    auto verts = star_polygon_##S(256);                                                                       \
+    std::vector<lm2_polygon_##S> holes;                                                                       \
+    verts.reserve(256 + side * side * 4);                                                                     \
+    double cell = 0.6 / (double)side;                                                                         \
+    for (size_t y = 0; y < side; y++) {                                                                       \
+      for (size_t x = 0; x < side; x++) {                                                                     \
+        double x0 = -0.3 + cell * ((double)x + 0.25);                                                         \
+        double y0 = -0.3 + cell * ((double)y + 0.25);                                                         \
+        double x1 = x0 + cell * 0.5;                                                                          \
+        double y1 = y0 + cell * 0.5;                                                                          \
+        verts.push_back(lm2_v2_make_##S((lm2_bench_##S)x0, (lm2_bench_##S)y0));                               \
+        verts.push_back(lm2_v2_make_##S((lm2_bench_##S)x0, (lm2_bench_##S)y1));                               \
+        verts.push_back(lm2_v2_make_##S((lm2_bench_##S)x1, (lm2_bench_##S)y1));                               \
+        verts.push_back(lm2_v2_make_##S((lm2_bench_##S)x1, (lm2_bench_##S)y0));                               \
+      }                                                                                                       \
+    }                                                                                                         \
+    for (size_t h = 0; h < side * side; h++) {                                                                \
+      holes.push_back(lm2_polygon_make_##S(verts.data() + 256 + h * 4, 4));                                   \
+    }                                                                                                         \
+    lm2_polygon_##S polygon = lm2_polygon_make_##S(verts.data(), 256);                                        \
+    std::vector<size_t> indices(lm2_polygon_max_triangle_count_with_holes(verts.size(), holes.size()) * 3);   \
+    std::vector<unsigned char> scratch(lm2_polygon_triangulate_scratch_size_##S(verts.size(), holes.size())); \
+    for (auto _ : state) {                                                                                    \
+      size_t count = lm2_polygon_triangulate_##S(polygon, holes.data(), holes.size(), scratch.data(),         \
+                                                 scratch.size(), indices.data());                             \
+      benchmark::DoNotOptimize(count);                                                                        \
+      benchmark::ClobberMemory();                                                                             \
+    }                                                                                                         \
+    state.SetItemsProcessed(state.iterations() * (int64_t)verts.size());                                      \
+    state.counters["holes"] = (double)holes.size();                                                           \
+  }                                                                                                           \
+  BENCHMARK(BM_polygon_triangulate_holes_##S)->Arg(2)->Arg(4)->Arg(8)->Arg(16);                               \
+                                                                                                              \
+  static void BM_polygon_is_simple_##S(benchmark::State& state) {                                             \
+    auto verts = star_polygon_##S((size_t)state.range(0));                                                    \
+    lm2_polygon_##S polygon = lm2_polygon_make_##S(verts.data(), verts.size());                               \
+    for (auto _ : state) {                                                                                    \
+      bool simple = lm2_polygon_is_simple_##S(polygon);                                                       \
+      benchmark::DoNotOptimize(simple);                                                                       \
+    }                                                                                                         \
+    state.SetItemsProcessed(state.iterations() * state.range(0));                                             \
+  }                                                                                                           \
+  BENCHMARK(BM_polygon_is_simple_##S)->RangeMultiplier(4)->Range(16, 16384);
+
+LM2_BENCH_TRIANGULATION(f32)
+LM2_BENCH_TRIANGULATION(f64)
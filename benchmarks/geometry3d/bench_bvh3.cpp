@@ -0,0 +1,210 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "bench_common.h"
+
+// =============================================================================
+// BVH3 Benchmarks
+// =============================================================================
+// The mesh is a wavy indexed grid of side x side quads (2 * side^2 triangles)
+// over [0, 100]^2; rays start above it and point down at random tilts, so
+// nearly all of them hit.
+
+#define LM2_BENCH_BVH3_MESH(S)                                                                                   \
+  struct bench_grid_##S {                                                                                        \
+    std::vector<lm2_v3_##S> vertices;                                                                            \
+    std::vector<uint32_t> indices;                                                                               \
+  };                                                                                                             \
+  static bench_grid_##S make_grid_##S(uint32_t side) {                                                           \
+    bench_grid_##S grid;                                                                                         \
+    const double step = 100.0 / side;                                                                            \
+    for (uint32_t z = 0; z <= side; z++) {                                                                       \
+      for (uint32_t x = 0; x <= side; x++) {                                                                     \
+        double height = 3.0 * std::sin(x * step * 0.2) * std::cos(z * step * 0.3);                               \
+        grid.vertices.push_back(                                                                                 \
+            lm2_v3_make_##S((lm2_bench_##S)(x * step), (lm2_bench_##S)height, (lm2_bench_##S)(z * step)));       \
+      }                                                                                                          \
+    }                                                                                                            \
+    for (uint32_t z = 0; z < side; z++) {                                                                        \
+      for (uint32_t x = 0; x < side; x++) {                                                                      \
+        uint32_t i0 = z * (side + 1) + x;                                                                        \
+        uint32_t i2 = i0 + side + 1;                                                                             \
+        grid.indices.insert(grid.indices.end(), {i0, i2, i0 + 1, i0 + 1, i2, i2 + 1});                           \
+      }                                                                                                          \
+    }                                                                                                            \
+    return grid;                                                                                                 \
+  }                                                                                                              \
+  static std::vector<lm2_ray3_##S> random_grid_rays_##S(size_t count, uint64_t seed) {                           \
+    lm2_bench::rng r(seed);                                                                                      \
+    std::vector<lm2_ray3_##S> out(count);                                                                        \
+    for (auto& ray : out) {                                                                                      \
+      lm2_v3_##S from = lm2_v3_make_##S((lm2_bench_##S)r.uniform(0, 100), 20, (lm2_bench_##S)r.uniform(0, 100)); \
+      lm2_v3_##S to = lm2_v3_make_##S((lm2_bench_##S)r.uniform(0, 100), 0, (lm2_bench_##S)r.uniform(0, 100));    \
+      ray = lm2_ray3_from_points_##S(from, to);                                                                  \
+      ray.t_max = 1000;                                                                                          \
+    }                                                                                                            \
+    return out;                                                                                                  \
+  }
+
+#define LM2_BENCH_BVH3(S)                                                                                            \
+  LM2_BENCH_BVH3_MESH(S)                                                                                             \
+  static void BM_bvh3_build_##S(benchmark::State& state) {                                                           \
+    auto grid = make_grid_##S((uint32_t)state.range(0));                                                             \
+    const size_t triangle_count = grid.indices.size() / 3;                                                           \
+    std::vector<lm2_bvh3_node_##S> nodes(lm2_bvh3_node_buffer_size_##S(triangle_count));                             \
+    std::vector<uint32_t> primitive_indices(lm2_bvh3_index_buffer_size_##S(triangle_count));                         \
+    for (auto _ : state) {                                                                                           \
+      lm2_bvh3_##S bvh = lm2_bvh3_build_indexed_##S(grid.vertices.data(), grid.vertices.size(), grid.indices.data(), \
+                                                    grid.indices.size(), nodes.data(), nodes.size(),                 \
+                                                    primitive_indices.data(), primitive_indices.size());             \
+      benchmark::DoNotOptimize(bvh);                                                                                 \
+      benchmark::ClobberMemory();                                                                                    \
+    }                                                                                                                \
+    state.counters["triangles/s"] =                                                                                  \
+        benchmark::Counter((double)triangle_count, benchmark::Counter::kIsIterationInvariantRate);                   \
+  }                                                                                                                  \
+  BENCHMARK(BM_bvh3_build_##S)->Arg(64)->Arg(256)->Arg(724)->Unit(benchmark::kMillisecond);                          \
+                                                                                                                     \
+  static void BM_bvh3_raycast_##S(benchmark::State& state) {                                                         \
+    auto grid = make_grid_##S((uint32_t)state.range(0));                                                             \
+    const size_t triangle_count = grid.indices.size() / 3;                                                           \
+    std::vector<lm2_bvh3_node_##S> nodes(lm2_bvh3_node_buffer_size_##S(triangle_count));                             \
+    std::vector<uint32_t> primitive_indices(lm2_bvh3_index_buffer_size_##S(triangle_count));                         \
+    lm2_bvh3_##S bvh = lm2_bvh3_build_indexed_##S(grid.vertices.data(), grid.vertices.size(), grid.indices.data(),   \
+                                                  grid.indices.size(), nodes.data(), nodes.size(),                   \
+                                                  primitive_indices.data(), primitive_indices.size());               \
+    auto rays = random_grid_rays_##S(LM2_BENCH_BATCH, 1);                                                            \
+    std::vector<lm2_bvh3_hit_##S> out(rays.size());                                                                  \
+    for (auto _ : state) {                                                                                           \
+      for (size_t i = 0; i < rays.size(); i++) out[i] = lm2_bvh3_raycast_##S(&bvh, rays[i]);                         \
+      benchmark::DoNotOptimize(out.data());                                                                          \
+      benchmark::ClobberMemory();                                                                                    \
+    }                                                                                                                \
+    state.SetItemsProcessed(state.iterations() * LM2_BENCH_BATCH);                                                   \
+  }                                                                                                                  \
+  BENCHMARK(BM_bvh3_raycast_##S)->Arg(64)->Arg(256)->Arg(724);                                                       \
+                                                                                                                     \
+  static void BM_bvh3_raycast_any_##S(benchmark::State& state) {                                                     \
+    auto grid = make_grid_##S((uint32_t)state.range(0));                                                             \
+    const size_t triangle_count = grid.indices.size() / 3;                                                           \
+    std::vector<lm2_bvh3_node_##S> nodes(lm2_bvh3_node_buffer_size_##S(triangle_count));                             \
+    std::vector<uint32_t> primitive_indices(lm2_bvh3_index_buffer_size_##S(triangle_count));                         \
+    lm2_bvh3_##S bvh = lm2_bvh3_build_indexed_##S(grid.vertices.data(), grid.vertices.size(), grid.indices.data(),   \
+                                                  grid.indices.size(), nodes.data(), nodes.size(),                   \
+                                                  primitive_indices.data(), primitive_indices.size());               \
+    auto rays = random_grid_rays_##S(LM2_BENCH_BATCH, 1);                                                            \
+    std::vector<lm2_bvh3_hit_##S> out(rays.size());                                                                  \
+    for (auto _ : state) {                                                                                           \
+      for (size_t i = 0; i < rays.size(); i++) out[i] = lm2_bvh3_raycast_any_##S(&bvh, rays[i]);                     \
+      benchmark::DoNotOptimize(out.data());                                                                          \
+      benchmark::ClobberMemory();                                                                                    \
+    }                                                                                                                \
+    state.SetItemsProcessed(state.iterations() * LM2_BENCH_BATCH);                                                   \
+  }                                                                                                                  \
+  BENCHMARK(BM_bvh3_raycast_any_##S)->Arg(64)->Arg(256)->Arg(724);                                                   \
+                                                                                                                     \
+  /* Linear scan with lm2_raycast_triangle, the baseline the BVH replaces */                                         \
+  static void BM_bvh3_linear_scan_##S(benchmark::State& state) {                                                     \
+    auto grid = make_grid_##S((uint32_t)state.range(0));                                                             \
+    auto rays = random_grid_rays_##S(64, 1);                                                                         \
+    std::vector<lm2_rayhit3_##S> out(rays.size());                                                                   \
+    for (auto _ : state) {                                                                                           \
+      for (size_t i = 0; i < rays.size(); i++) {                                                                     \
+        lm2_rayhit3_##S best = {};                                                                                   \
+        for (size_t k = 0; k < grid.indices.size(); k += 3) {                                                        \
+          lm2_rayhit3_##S hit = lm2_raycast_triangle_##S(rays[i], grid.vertices[grid.indices[k]],                    \
+                                                         grid.vertices[grid.indices[k + 1]],                         \
+                                                         grid.vertices[grid.indices[k + 2]]);                        \
+          if (hit.hit && (!best.hit || hit.t < best.t)) best = hit;                                                  \
+        }                                                                                                            \
+        out[i] = best;                                                                                               \
+      }                                                                                                              \
+      benchmark::DoNotOptimize(out.data());                                                                          \
+      benchmark::ClobberMemory();                                                                                    \
+    }                                                                                                                \
+    state.SetItemsProcessed(state.iterations() * rays.size());                                                       \
+  }                                                                                                                  \
+  BENCHMARK(BM_bvh3_linear_scan_##S)->Arg(64);
+
+// Box hierarchies over a scene of small random boxes in [0, 1000]^3. The
+// parallel build runs on 1, 2, 4 and all hardware threads (0).
+#define LM2_BENCH_BVH3_BOXES(S)                                                                                      \
+  static std::vector<lm2_r3_##S> random_scene_boxes_##S(size_t count, uint64_t seed) {                               \
+    lm2_bench::rng r(seed);                                                                                          \
+    std::vector<lm2_r3_##S> out(count);                                                                              \
+    for (auto& box : out) {                                                                                          \
+      box.min = lm2_bench::random_v3<lm2_bench_##S>(r, 0, 1000);                                                     \
+      lm2_v3_##S size = lm2_bench::random_v3<lm2_bench_##S>(r, 0.5, 4);                                              \
+      box.max = lm2_v3_add_##S(box.min, size);                                                                       \
+    }                                                                                                                \
+    return out;                                                                                                      \
+  }                                                                                                                  \
+                                                                                                                     \
+  static void BM_bvh3_build_bounds_parallel_##S(benchmark::State& state) {                                           \
+    const size_t count = (size_t)state.range(0);                                                                     \
+    const uint32_t thread_count = (uint32_t)state.range(1);                                                          \
+    auto boxes = random_scene_boxes_##S(count, 1);                                                                   \
+    std::vector<lm2_bvh3_node_##S> nodes(lm2_bvh3_node_buffer_size_##S(count));                                      \
+    std::vector<uint32_t> primitive_indices(lm2_bvh3_index_buffer_size_##S(count));                                  \
+    for (auto _ : state) {                                                                                           \
+      uint32_t node_count = lm2_bvh3_build_bounds_parallel_##S(boxes.data(), count, nodes.data(), nodes.size(),      \
+                                                               primitive_indices.data(), primitive_indices.size(),   \
+                                                               thread_count);                                        \
+      benchmark::DoNotOptimize(node_count);                                                                          \
+      benchmark::ClobberMemory();                                                                                    \
+    }                                                                                                                \
+    state.counters["boxes/s"] = benchmark::Counter((double)count, benchmark::Counter::kIsIterationInvariantRate);    \
+  }                                                                                                                  \
+  BENCHMARK(BM_bvh3_build_bounds_parallel_##S)                                                                       \
+      ->ArgsProduct({{1 << 16, 1 << 18, 1 << 20}, {1, 2, 4, 0}})                                                     \
+      ->Unit(benchmark::kMillisecond)                                                                                \
+      ->UseRealTime();                                                                                               \
+                                                                                                                     \
+  /* Every box moves a little each iteration, as in a simulation step */                                             \
+  static void BM_bvh3_refit_bounds_##S(benchmark::State& state) {                                                    \
+    const size_t count = (size_t)state.range(0);                                                                     \
+    auto boxes = random_scene_boxes_##S(count, 1);                                                                   \
+    std::vector<lm2_bvh3_node_##S> nodes(lm2_bvh3_node_buffer_size_##S(count));                                      \
+    std::vector<uint32_t> primitive_indices(lm2_bvh3_index_buffer_size_##S(count));                                  \
+    uint32_t node_count = lm2_bvh3_build_bounds_parallel_##S(boxes.data(), count, nodes.data(), nodes.size(),        \
+                                                             primitive_indices.data(), primitive_indices.size(), 0); \
+    auto offsets = lm2_bench::random_v3s<lm2_bench_##S>(count, -0.01, 0.01, 2);                                      \
+    for (auto _ : state) {                                                                                           \
+      state.PauseTiming();                                                                                           \
+      for (size_t i = 0; i < count; i++) {                                                                           \
+        boxes[i].min = lm2_v3_add_##S(boxes[i].min, offsets[i]);                                                     \
+        boxes[i].max = lm2_v3_add_##S(boxes[i].max, offsets[i]);                                                     \
+      }                                                                                                              \
+      state.ResumeTiming();                                                                                          \
+      lm2_bvh3_refit_bounds_##S(nodes.data(), node_count, primitive_indices.data(), boxes.data());                   \
+      benchmark::ClobberMemory();                                                                                    \
+    }                                                                                                                \
+    state.counters["boxes/s"] = benchmark::Counter((double)count, benchmark::Counter::kIsIterationInvariantRate);    \
+  }                                                                                                                  \
+  BENCHMARK(BM_bvh3_refit_bounds_##S)->Arg(1 << 16)->Arg(1 << 18)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+
+LM2_BENCH_BVH3(f32)
+LM2_BENCH_BVH3(f64)
+LM2_BENCH_BVH3_BOXES(f32)
+LM2_BENCH_BVH3_BOXES(f64)
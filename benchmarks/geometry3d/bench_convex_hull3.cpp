@@ -0,0 +1,88 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <cmath>
+#include "bench_common.h"
+
+// =============================================================================
+// 3D Convex Hull Benchmarks
+// =============================================================================
+// A synthetic scan: points on the surface of an ellipsoid with 1% radial
+// noise, like a scanned object fitted with a collision hull. Most points lie
+// close to the hull without being on it. The first argument is the point
+// count; the threaded bench runs 4M points and sweeps the thread count.
+
+#define LM2_BENCH_CONVEX_HULL3(S)                                                                                        \
+  static std::vector<lm2_v3_##S> scan_points_##S(size_t count) {                                                         \
+    lm2_bench::rng r(9);                                                                                                 \
+    std::vector<lm2_v3_##S> points(count);                                                                               \
+    for (auto& p : points) {                                                                                             \
+      double z = r.uniform(-1.0, 1.0);                                                                                   \
+      double angle = r.uniform(0.0, 6.283185307179586);                                                                  \
+      double ring = std::sqrt(1.0 - z * z);                                                                              \
+      double radius = r.uniform(0.99, 1.01);                                                                             \
+      p = lm2_v3_make_##S((lm2_bench_##S)(2.0 * radius * ring * std::cos(angle)),                                        \
+                          (lm2_bench_##S)(radius * ring * std::sin(angle)),                                              \
+                          (lm2_bench_##S)(0.5 * radius * z));                                                            \
+    }                                                                                                                    \
+    return points;                                                                                                       \
+  }                                                                                                                      \
+                                                                                                                         \
+  static void BM_convex_hull3_##S(benchmark::State& state) {                                                             \
+    auto points = scan_points_##S((size_t)state.range(0));                                                               \
+    lm2_indexed_mesh3_size size = lm2_convex_hull3_##S(points.data(), points.size(), NULL, 0, NULL, 0, 1);               \
+    std::vector<lm2_v3_##S> vertices(size.vertex_count);                                                                 \
+    std::vector<uint32_t> indices(size.index_count);                                                                     \
+    for (auto _ : state) {                                                                                               \
+      size = lm2_convex_hull3_##S(                                                                                       \
+          points.data(), points.size(), vertices.data(), vertices.size(), indices.data(), indices.size(), 1);            \
+      benchmark::DoNotOptimize(size);                                                                                    \
+      benchmark::ClobberMemory();                                                                                        \
+    }                                                                                                                    \
+    state.SetItemsProcessed(state.iterations() * state.range(0));                                                        \
+    state.counters["vertices"] = (double)size.vertex_count;                                                              \
+  }                                                                                                                      \
+  BENCHMARK(BM_convex_hull3_##S)->RangeMultiplier(16)->Range(1024, 4194304)->Unit(benchmark::kMillisecond);              \
+                                                                                                                         \
+  static void BM_convex_hull3_threads_##S(benchmark::State& state) {                                                     \
+    auto points = scan_points_##S(4194304);                                                                              \
+    uint32_t threads = (uint32_t)state.range(0);                                                                         \
+    for (auto _ : state) {                                                                                               \
+      lm2_indexed_mesh3_size size = lm2_convex_hull3_##S(points.data(), points.size(), NULL, 0, NULL, 0, threads);       \
+      benchmark::DoNotOptimize(size);                                                                                    \
+      benchmark::ClobberMemory();                                                                                        \
+    }                                                                                                                    \
+    state.SetItemsProcessed(state.iterations() * (int64_t)points.size());                                                \
+  }                                                                                                                      \
+  BENCHMARK(BM_convex_hull3_threads_##S)                                                                                 \
+      ->ArgName("threads")                                                                                               \
+      ->Arg(1)                                                                                                           \
+      ->Arg(2)                                                                                                           \
+      ->Arg(4)                                                                                                           \
+      ->Arg(8)                                                                                                           \
+      ->UseRealTime()                                                                                                    \
+      ->Unit(benchmark::kMillisecond);
+
+LM2_BENCH_CONVEX_HULL3(f32)
+LM2_BENCH_CONVEX_HULL3(f64)
@@ -0,0 +1,124 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <cmath>
+#include "bench_common.h"
+
+// =============================================================================
+// Frustum3 Benchmarks
+// =============================================================================
+// 262144 instances scattered over a 400^3 cube seen by a perspective camera
+// near its center, so about one in ten is visible. The corner loop is the
+// hand-rolled cull the batch functions replace: every plane against every
+// box corner through lm2_plane3_distance_to_point.
+
+#define LM2_BENCH_FRUSTUM3(S)                                                                                                                       \
+  static const size_t frustum_count_##S = 262144;                                                                                                   \
+                                                                                                                                                    \
+  static lm2_frustum3_##S bench_frustum_##S() {                                                                                                     \
+    lm2_camera3_##S camera = lm2_camera3_perspective_##S(lm2_v3_make_##S(0, 0, 0), lm2_v3_make_##S(1, 0, -2), lm2_v3_make_##S(0, 1, 0),             \
+                                                         (lm2_bench_##S)1.0, (lm2_bench_##S)1.78, (lm2_bench_##S)0.1, (lm2_bench_##S)200);          \
+    return lm2_frustum3_from_camera_##S(camera);                                                                                                    \
+  }                                                                                                                                                 \
+                                                                                                                                                    \
+  static std::vector<lm2_r3_##S> bench_boxes_##S() {                                                                                                \
+    lm2_bench::rng r(21);                                                                                                                           \
+    std::vector<lm2_r3_##S> boxes(frustum_count_##S);                                                                                               \
+    for (lm2_r3_##S& box : boxes) {                                                                                                                 \
+      lm2_v3_##S c = lm2_bench::random_v3<lm2_bench_##S>(r, -200, 200);                                                                             \
+      lm2_v3_##S e = lm2_bench::random_v3<lm2_bench_##S>(r, 0.5, 3);                                                                                \
+      box = lm2_r3_from_center_extents_##S(c, e);                                                                                                   \
+    }                                                                                                                                               \
+    return boxes;                                                                                                                                   \
+  }                                                                                                                                                 \
+                                                                                                                                                    \
+  static void BM_frustum3_cull_aabbs_corners_##S(benchmark::State& state) {                                                                         \
+    lm2_frustum3_##S frustum = bench_frustum_##S();                                                                                                 \
+    std::vector<lm2_r3_##S> boxes = bench_boxes_##S();                                                                                              \
+    std::vector<uint32_t> indices(boxes.size());                                                                                                    \
+    for (auto _ : state) {                                                                                                                          \
+      size_t visible = 0;                                                                                                                           \
+      for (size_t i = 0; i < boxes.size(); i++) {                                                                                                   \
+        const lm2_r3_##S& b = boxes[i];                                                                                                             \
+        bool inside = true;                                                                                                                         \
+        for (int p = 0; p < LM2_FRUSTUM3_PLANE_COUNT && inside; p++) {                                                                              \
+          int outside_corners = 0;                                                                                                                  \
+          for (int c = 0; c < 8; c++) {                                                                                                             \
+            lm2_v3_##S corner = lm2_v3_make_##S(c & 1 ? b.max.x : b.min.x, c & 2 ? b.max.y : b.min.y, c & 4 ? b.max.z : b.min.z);                   \
+            outside_corners += lm2_plane3_distance_to_point_##S(frustum.planes[p], corner) < 0;                                                     \
+          }                                                                                                                                         \
+          inside = outside_corners < 8;                                                                                                             \
+        }                                                                                                                                           \
+        if (inside) {                                                                                                                               \
+          indices[visible++] = (uint32_t)i;                                                                                                         \
+        }                                                                                                                                           \
+      }                                                                                                                                             \
+      benchmark::DoNotOptimize(visible);                                                                                                            \
+    }                                                                                                                                               \
+    state.SetItemsProcessed(state.iterations() * boxes.size());                                                                                     \
+  }                                                                                                                                                 \
+  BENCHMARK(BM_frustum3_cull_aabbs_corners_##S);                                                                                                    \
+                                                                                                                                                    \
+  static void BM_frustum3_cull_aabbs_##S(benchmark::State& state) {                                                                                 \
+    lm2_frustum3_##S frustum = bench_frustum_##S();                                                                                                 \
+    std::vector<lm2_r3_##S> boxes = bench_boxes_##S();                                                                                              \
+    std::vector<uint32_t> bits((boxes.size() + 31) / 32);                                                                                           \
+    for (auto _ : state) {                                                                                                                          \
+      size_t visible = lm2_frustum3_cull_aabbs_##S(&frustum, boxes.data(), boxes.size(), LM2_FRUSTUM3_ALL_PLANES, bits.data());                     \
+      benchmark::DoNotOptimize(visible);                                                                                                            \
+    }                                                                                                                                               \
+    state.SetItemsProcessed(state.iterations() * boxes.size());                                                                                     \
+  }                                                                                                                                                 \
+  BENCHMARK(BM_frustum3_cull_aabbs_##S);                                                                                                            \
+                                                                                                                                                    \
+  static void BM_frustum3_cull_aabbs_to_indices_##S(benchmark::State& state) {                                                                      \
+    lm2_frustum3_##S frustum = bench_frustum_##S();                                                                                                 \
+    std::vector<lm2_r3_##S> boxes = bench_boxes_##S();                                                                                              \
+    std::vector<uint32_t> indices(boxes.size());                                                                                                    \
+    for (auto _ : state) {                                                                                                                          \
+      size_t visible = lm2_frustum3_cull_aabbs_to_indices_##S(&frustum, boxes.data(), boxes.size(), LM2_FRUSTUM3_ALL_PLANES, indices.data());       \
+      benchmark::DoNotOptimize(visible);                                                                                                            \
+    }                                                                                                                                               \
+    state.SetItemsProcessed(state.iterations() * boxes.size());                                                                                     \
+  }                                                                                                                                                 \
+  BENCHMARK(BM_frustum3_cull_aabbs_to_indices_##S);                                                                                                 \
+                                                                                                                                                    \
+  static void BM_frustum3_cull_spheres_to_indices_##S(benchmark::State& state) {                                                                    \
+    lm2_frustum3_##S frustum = bench_frustum_##S();                                                                                                 \
+    lm2_bench::rng r(22);                                                                                                                           \
+    std::vector<lm2_sphere_##S> spheres(frustum_count_##S);                                                                                         \
+    for (lm2_sphere_##S& s : spheres) {                                                                                                             \
+      s = lm2_sphere_make_##S(lm2_bench::random_v3<lm2_bench_##S>(r, -200, 200), (lm2_bench_##S)r.uniform(0.5, 3));                                 \
+    }                                                                                                                                               \
+    std::vector<uint32_t> indices(spheres.size());                                                                                                  \
+    for (auto _ : state) {                                                                                                                          \
+      size_t visible = lm2_frustum3_cull_spheres_to_indices_##S(&frustum, spheres.data(), spheres.size(), LM2_FRUSTUM3_ALL_PLANES, indices.data()); \
+      benchmark::DoNotOptimize(visible);                                                                                                            \
+    }                                                                                                                                               \
+    state.SetItemsProcessed(state.iterations() * spheres.size());                                                                                   \
+  }                                                                                                                                                 \
+  BENCHMARK(BM_frustum3_cull_spheres_to_indices_##S);
+
+LM2_BENCH_FRUSTUM3(f32)
+LM2_BENCH_FRUSTUM3(f64)
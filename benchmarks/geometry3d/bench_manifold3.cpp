@@ -0,0 +1,107 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <cmath>
+#include "bench_common.h"
+
+// =============================================================================
+// 3D Manifold Benchmarks
+// =============================================================================
+// Shape pairs are scattered over [-3, 3]^3 with sizes around 1, so a fair share
+// of them overlap. The GJK benches compare a cold start with a warm start from
+// the cached simplex of the previous frame, as persistent pairs would use.
+
+#define LM2_BENCH_MANIFOLD3(S)                                                                                               \
+  static void BM_manifold3_sphere_to_sphere_##S(benchmark::State& state) {                                                   \
+    auto c = lm2_bench::random_v3s<lm2_bench_##S>(2 * LM2_BENCH_BATCH, -3.0, 3.0, 1);                                        \
+    std::vector<lm2_manifold3_##S> out(LM2_BENCH_BATCH);                                                                     \
+    for (auto _ : state) {                                                                                                   \
+      for (size_t i = 0; i < LM2_BENCH_BATCH; i++) {                                                                         \
+        lm2_manifold3_sphere_to_sphere_##S(lm2_sphere_make_##S(c[2 * i], 1), lm2_sphere_make_##S(c[2 * i + 1], 1), &out[i]); \
+      }                                                                                                                      \
+      benchmark::DoNotOptimize(out.data());                                                                                  \
+      benchmark::ClobberMemory();                                                                                            \
+    }                                                                                                                        \
+    state.SetItemsProcessed(state.iterations() * LM2_BENCH_BATCH);                                                           \
+  }                                                                                                                          \
+  BENCHMARK(BM_manifold3_sphere_to_sphere_##S);                                                                              \
+                                                                                                                             \
+  static void BM_manifold3_capsule_to_capsule_##S(benchmark::State& state) {                                                 \
+    auto p = lm2_bench::random_v3s<lm2_bench_##S>(4 * LM2_BENCH_BATCH, -3.0, 3.0, 2);                                        \
+    std::vector<lm2_manifold3_##S> out(LM2_BENCH_BATCH);                                                                     \
+    for (auto _ : state) {                                                                                                   \
+      for (size_t i = 0; i < LM2_BENCH_BATCH; i++) {                                                                         \
+        lm2_capsule3_##S a = lm2_capsule3_make_##S(p[4 * i], p[4 * i + 1], (lm2_bench_##S)0.5);                              \
+        lm2_capsule3_##S b = lm2_capsule3_make_##S(p[4 * i + 2], p[4 * i + 3], (lm2_bench_##S)0.5);                          \
+        lm2_manifold3_capsule_to_capsule_##S(a, b, &out[i]);                                                                 \
+      }                                                                                                                      \
+      benchmark::DoNotOptimize(out.data());                                                                                  \
+      benchmark::ClobberMemory();                                                                                            \
+    }                                                                                                                        \
+    state.SetItemsProcessed(state.iterations() * LM2_BENCH_BATCH);                                                           \
+  }                                                                                                                          \
+  BENCHMARK(BM_manifold3_capsule_to_capsule_##S);                                                                            \
+                                                                                                                             \
+  static void BM_manifold3_capsule_to_triangle_##S(benchmark::State& state) {                                                \
+    auto p = lm2_bench::random_v3s<lm2_bench_##S>(5 * LM2_BENCH_BATCH, -3.0, 3.0, 3);                                        \
+    std::vector<lm2_manifold3_##S> out(LM2_BENCH_BATCH);                                                                     \
+    for (auto _ : state) {                                                                                                   \
+      for (size_t i = 0; i < LM2_BENCH_BATCH; i++) {                                                                         \
+        lm2_capsule3_##S capsule = lm2_capsule3_make_##S(p[5 * i], p[5 * i + 1], (lm2_bench_##S)0.5);                        \
+        lm2_manifold3_capsule_to_triangle_##S(capsule, &p[5 * i + 2], &out[i]);                                              \
+      }                                                                                                                      \
+      benchmark::DoNotOptimize(out.data());                                                                                  \
+      benchmark::ClobberMemory();                                                                                            \
+    }                                                                                                                        \
+    state.SetItemsProcessed(state.iterations() * LM2_BENCH_BATCH);                                                           \
+  }                                                                                                                          \
+  BENCHMARK(BM_manifold3_capsule_to_triangle_##S);                                                                           \
+                                                                                                                             \
+  static void BM_manifold3_gjk_box_to_triangle_##S(benchmark::State& state) {                                                \
+    bool warm = state.range(0) != 0;                                                                                         \
+    auto p = lm2_bench::random_v3s<lm2_bench_##S>(4 * LM2_BENCH_BATCH, -3.0, 3.0, 4);                                        \
+    std::vector<lm2_gjk3_proxy_##S> boxes(LM2_BENCH_BATCH), tris(LM2_BENCH_BATCH);                                           \
+    for (size_t i = 0; i < LM2_BENCH_BATCH; i++) {                                                                           \
+      lm2_aabb3_##S box = lm2_r3_from_min_max_##S(lm2_v3_sub_s_##S(p[4 * i], 1), lm2_v3_add_s_##S(p[4 * i], 1));             \
+      boxes[i] = lm2_gjk3_proxy_from_shape_##S(lm2_shape3_from_aabb3_##S(&box));                                             \
+      tris[i] = lm2_gjk3_proxy_from_shape_##S(lm2_shape3_from_triangle_##S((lm2_triangle3_##S*)&p[4 * i + 1]));              \
+    }                                                                                                                        \
+    std::vector<lm2_gjk3_cache> caches(LM2_BENCH_BATCH);                                                                     \
+    std::vector<lm2_manifold3_##S> out(LM2_BENCH_BATCH);                                                                     \
+    for (size_t i = 0; i < LM2_BENCH_BATCH; i++) {                                                                           \
+      lm2_manifold3_proxy_to_proxy_##S(&boxes[i], &tris[i], &caches[i], &out[i]);                                            \
+    }                                                                                                                        \
+    for (auto _ : state) {                                                                                                   \
+      for (size_t i = 0; i < LM2_BENCH_BATCH; i++) {                                                                         \
+        lm2_manifold3_proxy_to_proxy_##S(&boxes[i], &tris[i], warm ? &caches[i] : NULL, &out[i]);                            \
+      }                                                                                                                      \
+      benchmark::DoNotOptimize(out.data());                                                                                  \
+      benchmark::ClobberMemory();                                                                                            \
+    }                                                                                                                        \
+    state.SetItemsProcessed(state.iterations() * LM2_BENCH_BATCH);                                                           \
+  }                                                                                                                          \
+  BENCHMARK(BM_manifold3_gjk_box_to_triangle_##S)->ArgName("warm")->Arg(0)->Arg(1);
+
+LM2_BENCH_MANIFOLD3(f32)
+LM2_BENCH_MANIFOLD3(f64)
@@ -0,0 +1,124 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <algorithm>
+#include <array>
+#include <random>
+#include "bench_common.h"
+
+// =============================================================================
+// Mesh Optimization Benchmarks
+// =============================================================================
+// N x N indexed quad grids with shuffled triangles and vertex numbers, the
+// worst case for both the post-transform cache and vertex fetch. The acmr
+// and overfetch counters report the mesh before and after each pass; acmr is
+// measured against a 16 entry FIFO cache.
+
+static std::vector<uint32_t> bench_shuffled_grid(uint32_t n) {
+  std::vector<std::array<uint32_t, 3>> triangles;
+  for (uint32_t y = 0; y < n; y++) {
+    for (uint32_t x = 0; x < n; x++) {
+      uint32_t a = y * (n + 1) + x;
+      triangles.push_back({a, a + 1, a + n + 2});
+      triangles.push_back({a, a + n + 2, a + n + 1});
+    }
+  }
+  std::mt19937 rng(5);
+  std::shuffle(triangles.begin(), triangles.end(), rng);
+
+  std::vector<uint32_t> numbers((size_t)(n + 1) * (n + 1));
+  for (uint32_t v = 0; v < numbers.size(); v++) {
+    numbers[v] = v;
+  }
+  std::shuffle(numbers.begin(), numbers.end(), rng);
+
+  std::vector<uint32_t> indices;
+  for (const auto& t : triangles) {
+    for (uint32_t v : t) {
+      indices.push_back(numbers[v]);
+    }
+  }
+  return indices;
+}
+
+static void BM_mesh_optimize_vertex_cache(benchmark::State& state) {
+  const uint32_t n = (uint32_t)state.range(0);
+  const size_t vertex_count = (size_t)(n + 1) * (n + 1);
+  std::vector<uint32_t> indices = bench_shuffled_grid(n);
+  std::vector<uint32_t> optimized(indices.size());
+  for (auto _ : state) {
+    lm2_mesh_optimize_vertex_cache(optimized.data(), indices.data(), indices.size(), vertex_count);
+    benchmark::DoNotOptimize(optimized.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * (indices.size() / 3));
+  state.counters["acmr_before"] = lm2_mesh_analyze_vertex_cache(indices.data(), indices.size(), vertex_count, 16).acmr;
+  state.counters["acmr_after"] = lm2_mesh_analyze_vertex_cache(optimized.data(), optimized.size(), vertex_count, 16).acmr;
+}
+BENCHMARK(BM_mesh_optimize_vertex_cache)->Arg(64)->Arg(256);
+
+static void BM_mesh_analyze_vertex_cache(benchmark::State& state) {
+  const uint32_t n = (uint32_t)state.range(0);
+  const size_t vertex_count = (size_t)(n + 1) * (n + 1);
+  std::vector<uint32_t> indices = bench_shuffled_grid(n);
+  for (auto _ : state) {
+    lm2_mesh_vertex_cache_stats stats = lm2_mesh_analyze_vertex_cache(indices.data(), indices.size(), vertex_count, 16);
+    benchmark::DoNotOptimize(stats);
+  }
+  state.SetItemsProcessed(state.iterations() * (indices.size() / 3));
+}
+BENCHMARK(BM_mesh_analyze_vertex_cache)->Arg(256);
+
+#define LM2_BENCH_MESH_OPTIMIZE(S)                                                                                          \
+  static void BM_mesh_optimize_vertex_fetch3_##S(benchmark::State& state) {                                                 \
+    const uint32_t n = (uint32_t)state.range(0);                                                                            \
+    const size_t vertex_count = (size_t)(n + 1) * (n + 1);                                                                  \
+    std::vector<uint32_t> source = bench_shuffled_grid(n);                                                                  \
+    lm2_mesh_optimize_vertex_cache(source.data(), source.data(), source.size(), vertex_count);                              \
+    lm2_bench::rng r(9);                                                                                                    \
+    std::vector<lm2_v3_##S> vertices(vertex_count);                                                                         \
+    for (lm2_v3_##S& v : vertices) {                                                                                        \
+      v = lm2_bench::random_v3<lm2_bench_##S>(r, -1, 1);                                                                    \
+    }                                                                                                                       \
+    std::vector<uint32_t> indices(source.size());                                                                           \
+    std::vector<lm2_v3_##S> optimized(vertex_count);                                                                        \
+    for (auto _ : state) {                                                                                                  \
+      state.PauseTiming();                                                                                                  \
+      indices = source;                                                                                                     \
+      state.ResumeTiming();                                                                                                 \
+      size_t count = lm2_mesh_optimize_vertex_fetch3_##S(optimized.data(), indices.data(), indices.size(), vertices.data(), \
+                                                         vertices.size());                                                  \
+      benchmark::DoNotOptimize(count);                                                                                      \
+      benchmark::ClobberMemory();                                                                                           \
+    }                                                                                                                       \
+    state.SetItemsProcessed(state.iterations() * vertex_count);                                                             \
+    state.counters["overfetch_before"] =                                                                                    \
+        lm2_mesh_analyze_vertex_fetch(source.data(), source.size(), vertex_count, sizeof(lm2_v3_##S)).overfetch;            \
+    state.counters["overfetch_after"] =                                                                                     \
+        lm2_mesh_analyze_vertex_fetch(indices.data(), indices.size(), vertex_count, sizeof(lm2_v3_##S)).overfetch;          \
+  }                                                                                                                         \
+  BENCHMARK(BM_mesh_optimize_vertex_fetch3_##S)->Arg(64)->Arg(256);
+
+LM2_BENCH_MESH_OPTIMIZE(f32)
+LM2_BENCH_MESH_OPTIMIZE(f64)
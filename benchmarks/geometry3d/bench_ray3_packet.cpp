@@ -0,0 +1,160 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <cmath>
+#include "bench_common.h"
+
+// =============================================================================
+// Ray Packet Benchmarks
+// =============================================================================
+// Closest hits of the 64 x 32 primary rays of a camera against 64 random
+// triangles or boxes in front of it, counted in ray-shape tests: one ray at a
+// time through lm2_raycast_triangle / lm2_raycast_aabb3, against 4- and
+// 8-wide packets sharing one hits struct per packet.
+
+#define LM2_BENCH_PACKET_W      64
+#define LM2_BENCH_PACKET_H      32
+#define LM2_BENCH_PACKET_SHAPES 64
+
+#define LM2_BENCH_RAY3_PACKET(S)                                                                                                           \
+  static lm2_camera3_raygen_##S bench_packet_raygen_##S() {                                                                                \
+    lm2_camera3_##S camera = lm2_camera3_perspective_##S(lm2_v3_make_##S(0, 0, 10), lm2_v3_make_##S(0, 0, 0), lm2_v3_make_##S(0, 1, 0),    \
+                                                         (lm2_bench_##S)1.0, (lm2_bench_##S)2.0, (lm2_bench_##S)0.1, (lm2_bench_##S)100);  \
+    return lm2_camera3_raygen_make_##S(camera, LM2_BENCH_PACKET_W, LM2_BENCH_PACKET_H);                                                    \
+  }                                                                                                                                        \
+                                                                                                                                           \
+  static std::vector<lm2_v3_##S> bench_packet_triangles_##S() {                                                                            \
+    lm2_bench::rng r(3);                                                                                                                   \
+    std::vector<lm2_v3_##S> v(LM2_BENCH_PACKET_SHAPES * 3);                                                                                \
+    for (size_t i = 0; i < v.size(); i += 3) {                                                                                             \
+      v[i] = lm2_bench::random_v3<lm2_bench_##S>(r, -5, 5);                                                                                \
+      v[i + 1] = lm2_v3_add_##S(v[i], lm2_bench::random_v3<lm2_bench_##S>(r, -2, 2));                                                      \
+      v[i + 2] = lm2_v3_add_##S(v[i], lm2_bench::random_v3<lm2_bench_##S>(r, -2, 2));                                                      \
+    }                                                                                                                                      \
+    return v;                                                                                                                              \
+  }                                                                                                                                        \
+                                                                                                                                           \
+  static std::vector<lm2_r3_##S> bench_packet_boxes_##S() {                                                                                \
+    lm2_bench::rng r(4);                                                                                                                   \
+    std::vector<lm2_r3_##S> boxes(LM2_BENCH_PACKET_SHAPES);                                                                                \
+    for (lm2_r3_##S& box : boxes) {                                                                                                        \
+      box = lm2_r3_from_center_extents_##S(lm2_bench::random_v3<lm2_bench_##S>(r, -5, 5), lm2_bench::random_v3<lm2_bench_##S>(r, 0.2, 1)); \
+    }                                                                                                                                      \
+    return boxes;                                                                                                                          \
+  }                                                                                                                                        \
+                                                                                                                                           \
+  static void BM_ray3_single_triangles_##S(benchmark::State& state) {                                                                      \
+    lm2_camera3_raygen_##S raygen = bench_packet_raygen_##S();                                                                             \
+    std::vector<lm2_v3_##S> v = bench_packet_triangles_##S();                                                                              \
+    for (auto _ : state) {                                                                                                                 \
+      for (uint32_t y = 0; y < LM2_BENCH_PACKET_H; y++) {                                                                                  \
+        for (uint32_t x = 0; x < LM2_BENCH_PACKET_W; x++) {                                                                                \
+          lm2_ray3_##S ray = lm2_camera3_raygen_ray_##S(&raygen, x + (lm2_bench_##S)0.5, y + (lm2_bench_##S)0.5);                          \
+          for (size_t i = 0; i < v.size(); i += 3) {                                                                                       \
+            lm2_rayhit3_##S hit = lm2_raycast_triangle_##S(ray, v[i], v[i + 1], v[i + 2]);                                                 \
+            ray.t_max = hit.hit ? hit.t : ray.t_max;                                                                                       \
+          }                                                                                                                                \
+          benchmark::DoNotOptimize(ray.t_max);                                                                                             \
+        }                                                                                                                                  \
+      }                                                                                                                                    \
+    }                                                                                                                                      \
+    state.SetItemsProcessed(state.iterations() * LM2_BENCH_PACKET_W * LM2_BENCH_PACKET_H * LM2_BENCH_PACKET_SHAPES);                       \
+  }                                                                                                                                        \
+  BENCHMARK(BM_ray3_single_triangles_##S);                                                                                                 \
+                                                                                                                                           \
+  static void BM_ray3_packet4_triangles_##S(benchmark::State& state) {                                                                     \
+    lm2_camera3_raygen_##S raygen = bench_packet_raygen_##S();                                                                             \
+    std::vector<lm2_v3_##S> v = bench_packet_triangles_##S();                                                                              \
+    std::vector<lm2_ray3_packet4_##S> packets(LM2_BENCH_PACKET_W * LM2_BENCH_PACKET_H / 4);                                                \
+    lm2_camera3_raygen_packets4_##S(&raygen, 0, 0, LM2_BENCH_PACKET_W, LM2_BENCH_PACKET_H, packets.data());                                \
+    for (auto _ : state) {                                                                                                                 \
+      for (const lm2_ray3_packet4_##S& packet : packets) {                                                                                 \
+        lm2_rayhit3_packet4_##S hits = {};                                                                                                 \
+        for (size_t i = 0; i < v.size(); i += 3) {                                                                                         \
+          lm2_raycast_packet4_triangle_##S(&packet, 0xFu, v[i], v[i + 1], v[i + 2], &hits);                                                \
+        }                                                                                                                                  \
+        benchmark::DoNotOptimize(hits);                                                                                                    \
+      }                                                                                                                                    \
+    }                                                                                                                                      \
+    state.SetItemsProcessed(state.iterations() * LM2_BENCH_PACKET_W * LM2_BENCH_PACKET_H * LM2_BENCH_PACKET_SHAPES);                       \
+  }                                                                                                                                        \
+  BENCHMARK(BM_ray3_packet4_triangles_##S);                                                                                                \
+                                                                                                                                           \
+  static void BM_ray3_packet8_triangles_##S(benchmark::State& state) {                                                                     \
+    lm2_camera3_raygen_##S raygen = bench_packet_raygen_##S();                                                                             \
+    std::vector<lm2_v3_##S> v = bench_packet_triangles_##S();                                                                              \
+    std::vector<lm2_ray3_packet8_##S> packets(LM2_BENCH_PACKET_W * LM2_BENCH_PACKET_H / 8);                                                \
+    lm2_camera3_raygen_packets8_##S(&raygen, 0, 0, LM2_BENCH_PACKET_W, LM2_BENCH_PACKET_H, packets.data());                                \
+    for (auto _ : state) {                                                                                                                 \
+      for (const lm2_ray3_packet8_##S& packet : packets) {                                                                                 \
+        lm2_rayhit3_packet8_##S hits = {};                                                                                                 \
+        for (size_t i = 0; i < v.size(); i += 3) {                                                                                         \
+          lm2_raycast_packet8_triangle_##S(&packet, 0xFFu, v[i], v[i + 1], v[i + 2], &hits);                                               \
+        }                                                                                                                                  \
+        benchmark::DoNotOptimize(hits);                                                                                                    \
+      }                                                                                                                                    \
+    }                                                                                                                                      \
+    state.SetItemsProcessed(state.iterations() * LM2_BENCH_PACKET_W * LM2_BENCH_PACKET_H * LM2_BENCH_PACKET_SHAPES);                       \
+  }                                                                                                                                        \
+  BENCHMARK(BM_ray3_packet8_triangles_##S);                                                                                                \
+                                                                                                                                           \
+  static void BM_ray3_single_aabbs_##S(benchmark::State& state) {                                                                          \
+    lm2_camera3_raygen_##S raygen = bench_packet_raygen_##S();                                                                             \
+    std::vector<lm2_r3_##S> boxes = bench_packet_boxes_##S();                                                                              \
+    for (auto _ : state) {                                                                                                                 \
+      for (uint32_t y = 0; y < LM2_BENCH_PACKET_H; y++) {                                                                                  \
+        for (uint32_t x = 0; x < LM2_BENCH_PACKET_W; x++) {                                                                                \
+          lm2_ray3_##S ray = lm2_camera3_raygen_ray_##S(&raygen, x + (lm2_bench_##S)0.5, y + (lm2_bench_##S)0.5);                          \
+          for (const lm2_r3_##S& box : boxes) {                                                                                            \
+            lm2_rayhit3_##S hit = lm2_raycast_aabb3_##S(ray, box);                                                                         \
+            ray.t_max = hit.hit ? hit.t : ray.t_max;                                                                                       \
+          }                                                                                                                                \
+          benchmark::DoNotOptimize(ray.t_max);                                                                                             \
+        }                                                                                                                                  \
+      }                                                                                                                                    \
+    }                                                                                                                                      \
+    state.SetItemsProcessed(state.iterations() * LM2_BENCH_PACKET_W * LM2_BENCH_PACKET_H * LM2_BENCH_PACKET_SHAPES);                       \
+  }                                                                                                                                        \
+  BENCHMARK(BM_ray3_single_aabbs_##S);                                                                                                     \
+                                                                                                                                           \
+  static void BM_ray3_packet8_aabbs_##S(benchmark::State& state) {                                                                         \
+    lm2_camera3_raygen_##S raygen = bench_packet_raygen_##S();                                                                             \
+    std::vector<lm2_r3_##S> boxes = bench_packet_boxes_##S();                                                                              \
+    std::vector<lm2_ray3_packet8_##S> packets(LM2_BENCH_PACKET_W * LM2_BENCH_PACKET_H / 8);                                                \
+    lm2_camera3_raygen_packets8_##S(&raygen, 0, 0, LM2_BENCH_PACKET_W, LM2_BENCH_PACKET_H, packets.data());                                \
+    for (auto _ : state) {                                                                                                                 \
+      for (const lm2_ray3_packet8_##S& packet : packets) {                                                                                 \
+        lm2_rayhit3_packet8_##S hits = {};                                                                                                 \
+        for (const lm2_r3_##S& box : boxes) {                                                                                              \
+          lm2_raycast_packet8_aabb3_##S(&packet, 0xFFu, box, &hits);                                                                       \
+        }                                                                                                                                  \
+        benchmark::DoNotOptimize(hits);                                                                                                    \
+      }                                                                                                                                    \
+    }                                                                                                                                      \
+    state.SetItemsProcessed(state.iterations() * LM2_BENCH_PACKET_W * LM2_BENCH_PACKET_H * LM2_BENCH_PACKET_SHAPES);                       \
+  }                                                                                                                                        \
+  BENCHMARK(BM_ray3_packet8_aabbs_##S);
+
+LM2_BENCH_RAY3_PACKET(f32)
+LM2_BENCH_RAY3_PACKET(f64)
@@ -0,0 +1,71 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "bench_common.h"
+
+// =============================================================================
+// 3D Raycast Benchmarks
+// =============================================================================
+// Rays start on a sphere around the origin and aim at jittered points near it,
+// so most of them hit the target shape.
+
+#define LM2_BENCH_RAYS3(S)                                                                  \
+  static std::vector<lm2_ray3_##S> random_rays3_##S(size_t count, uint64_t seed) {          \
+    lm2_bench::rng r(seed);                                                                 \
+    std::vector<lm2_ray3_##S> out(count);                                                   \
+    for (auto& ray : out) {                                                                 \
+      lm2_v3_##S dir = lm2_v3_norm_##S(lm2_bench::random_v3<lm2_bench_##S>(r, -1.0, 1.0));  \
+      lm2_v3_##S from = lm2_v3_mul_s_##S(dir, 10);                                          \
+      lm2_v3_##S to = lm2_bench::random_v3<lm2_bench_##S>(r, -1.5, 1.5);                    \
+      ray = lm2_ray3_from_points_##S(from, to);                                             \
+      ray.t_max = 20;                                                                       \
+    }                                                                                       \
+    return out;                                                                             \
+  }
+
+#define LM2_BENCH_RAYCAST3(S, name, ...)                                                                \
+  static void BM_raycast_##name##_##S(benchmark::State& state) {                                        \
+    auto rays = random_rays3_##S(LM2_BENCH_BATCH, 1);                                                   \
+    std::vector<lm2_rayhit3_##S> out(rays.size());                                                      \
+    for (auto _ : state) {                                                                              \
+      for (size_t i = 0; i < rays.size(); i++) out[i] = lm2_raycast_##name##_##S(rays[i], __VA_ARGS__); \
+      benchmark::DoNotOptimize(out.data());                                                             \
+      benchmark::ClobberMemory();                                                                       \
+    }                                                                                                   \
+    state.SetItemsProcessed(state.iterations() * LM2_BENCH_BATCH);                                      \
+  }                                                                                                     \
+  BENCHMARK(BM_raycast_##name##_##S);
+
+#define LM2_BENCH_RAYCAST3_ALL(S)                                                                                 \
+  LM2_BENCH_RAYS3(S)                                                                                              \
+  static const lm2_r3_##S bench_box3_##S =                                                                        \
+      lm2_r3_from_min_max_##S(lm2_v3_make_##S(-1, -1, -1), lm2_v3_make_##S(1, 1, 1));                             \
+  LM2_BENCH_RAYCAST3(S, sphere, lm2_v3_zero_##S(), 1)                                                             \
+  LM2_BENCH_RAYCAST3(S, aabb3, bench_box3_##S)                                                                    \
+  LM2_BENCH_RAYCAST3(S, triangle, lm2_v3_make_##S(-2, -1, 0), lm2_v3_make_##S(2, -1, 0), lm2_v3_make_##S(0, 2, 0)) \
+  LM2_BENCH_RAYCAST3(S, plane, lm2_v3_zero_##S(), lm2_v3_make_##S(0, 1, 0))                                       \
+  LM2_BENCH_RAYCAST3(S, capsule, lm2_v3_make_##S(-1, 0, 0), lm2_v3_make_##S(1, 0, 0), (lm2_bench_##S)0.5)
+
+LM2_BENCH_RAYCAST3_ALL(f32)
+LM2_BENCH_RAYCAST3_ALL(f64)
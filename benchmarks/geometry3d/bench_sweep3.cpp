@@ -0,0 +1,139 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <cmath>
+#include "bench_common.h"
+
+// =============================================================================
+// Sweep3 Benchmarks
+// =============================================================================
+// Character controller moves over a wavy indexed grid of 64 x 64 quads (8192
+// triangles) spanning [0, 100]^2 with heights in [-3, 3]. Upright capsules of
+// radius 0.4 start just above the surface and move down and sideways by a few
+// units, so most moves land on the ground. The indexed sweep is the brute
+// force loop over every triangle that the BVH query replaces.
+
+#define LM2_BENCH_SWEEP3(S)                                                                                                                        \
+  struct bench_level_##S {                                                                                                                         \
+    std::vector<lm2_v3_##S> vertices;                                                                                                              \
+    std::vector<uint32_t> indices;                                                                                                                 \
+    std::vector<lm2_bvh3_node_##S> nodes;                                                                                                          \
+    std::vector<uint32_t> primitive_indices;                                                                                                       \
+    lm2_bvh3_##S bvh;                                                                                                                              \
+    std::vector<lm2_capsule3_##S> capsules;                                                                                                        \
+    std::vector<lm2_v3_##S> deltas;                                                                                                                \
+  };                                                                                                                                               \
+                                                                                                                                                   \
+  static void make_level_##S(bench_level_##S& level) {                                                                                             \
+    const uint32_t side = 64;                                                                                                                      \
+    const double step = 100.0 / side;                                                                                                              \
+    for (uint32_t z = 0; z <= side; z++) {                                                                                                         \
+      for (uint32_t x = 0; x <= side; x++) {                                                                                                       \
+        double height = 3.0 * std::sin(x * step * 0.2) * std::cos(z * step * 0.3);                                                                 \
+        level.vertices.push_back(lm2_v3_make_##S((lm2_bench_##S)(x * step), (lm2_bench_##S)height, (lm2_bench_##S)(z * step)));                    \
+      }                                                                                                                                            \
+    }                                                                                                                                              \
+    for (uint32_t z = 0; z < side; z++) {                                                                                                          \
+      for (uint32_t x = 0; x < side; x++) {                                                                                                        \
+        uint32_t i0 = z * (side + 1) + x;                                                                                                          \
+        uint32_t i2 = i0 + side + 1;                                                                                                               \
+        level.indices.insert(level.indices.end(), {i0, i2, i0 + 1, i0 + 1, i2, i2 + 1});                                                           \
+      }                                                                                                                                            \
+    }                                                                                                                                              \
+    const size_t triangle_count = level.indices.size() / 3;                                                                                        \
+    level.nodes.resize(lm2_bvh3_node_buffer_size_##S(triangle_count));                                                                             \
+    level.primitive_indices.resize(lm2_bvh3_index_buffer_size_##S(triangle_count));                                                                \
+    level.bvh = lm2_bvh3_build_indexed_##S(level.vertices.data(), level.vertices.size(), level.indices.data(), level.indices.size(),               \
+                                           level.nodes.data(), level.nodes.size(), level.primitive_indices.data(),                                 \
+                                           level.primitive_indices.size());                                                                        \
+    lm2_bench::rng r(5);                                                                                                                           \
+    for (size_t i = 0; i < 1024; i++) {                                                                                                            \
+      lm2_bench_##S x = (lm2_bench_##S)r.uniform(5, 95);                                                                                           \
+      lm2_bench_##S z = (lm2_bench_##S)r.uniform(5, 95);                                                                                           \
+      lm2_v3_##S foot = lm2_v3_make_##S(x, (lm2_bench_##S)3.5, z);                                                                                 \
+      lm2_v3_##S head = lm2_v3_make_##S(x, (lm2_bench_##S)4.5, z);                                                                                 \
+      level.capsules.push_back({foot, head, (lm2_bench_##S)0.4});                                                                                  \
+      level.deltas.push_back(lm2_v3_make_##S((lm2_bench_##S)r.uniform(-2, 2), (lm2_bench_##S)r.uniform(-6, -2), (lm2_bench_##S)r.uniform(-2, 2))); \
+    }                                                                                                                                              \
+  }                                                                                                                                                \
+                                                                                                                                                   \
+  static void BM_sweep3_capsule_indexed_##S(benchmark::State& state) {                                                                             \
+    bench_level_##S level;                                                                                                                         \
+    make_level_##S(level);                                                                                                                         \
+    size_t i = 0;                                                                                                                                  \
+    for (auto _ : state) {                                                                                                                         \
+      lm2_sweep3_hit_##S hit = lm2_sweep3_capsule_indexed_##S(level.capsules[i], level.deltas[i], level.vertices.data(),                           \
+                                                              level.indices.data(), level.indices.size());                                         \
+      benchmark::DoNotOptimize(hit);                                                                                                               \
+      i = (i + 1) % level.capsules.size();                                                                                                         \
+    }                                                                                                                                              \
+    state.SetItemsProcessed(state.iterations());                                                                                                   \
+  }                                                                                                                                                \
+  BENCHMARK(BM_sweep3_capsule_indexed_##S);                                                                                                        \
+                                                                                                                                                   \
+  static void BM_sweep3_capsule_bvh_##S(benchmark::State& state) {                                                                                 \
+    bench_level_##S level;                                                                                                                         \
+    make_level_##S(level);                                                                                                                         \
+    for (auto _ : state) {                                                                                                                         \
+      for (size_t i = 0; i < LM2_BENCH_BATCH; i++) {                                                                                               \
+        lm2_sweep3_hit_##S hit = lm2_sweep3_capsule_bvh_##S(&level.bvh, level.capsules[i % level.capsules.size()],                                 \
+                                                            level.deltas[i % level.deltas.size()]);                                                \
+        benchmark::DoNotOptimize(hit);                                                                                                             \
+      }                                                                                                                                            \
+    }                                                                                                                                              \
+    state.SetItemsProcessed(state.iterations() * LM2_BENCH_BATCH);                                                                                 \
+  }                                                                                                                                                \
+  BENCHMARK(BM_sweep3_capsule_bvh_##S);                                                                                                            \
+                                                                                                                                                   \
+  static void BM_sweep3_sphere_bvh_##S(benchmark::State& state) {                                                                                  \
+    bench_level_##S level;                                                                                                                         \
+    make_level_##S(level);                                                                                                                         \
+    for (auto _ : state) {                                                                                                                         \
+      for (size_t i = 0; i < LM2_BENCH_BATCH; i++) {                                                                                               \
+        const lm2_capsule3_##S& c = level.capsules[i % level.capsules.size()];                                                                     \
+        lm2_sphere_##S sphere = {c.start, c.radius};                                                                                               \
+        lm2_sweep3_hit_##S hit = lm2_sweep3_sphere_bvh_##S(&level.bvh, sphere, level.deltas[i % level.deltas.size()]);                             \
+        benchmark::DoNotOptimize(hit);                                                                                                             \
+      }                                                                                                                                            \
+    }                                                                                                                                              \
+    state.SetItemsProcessed(state.iterations() * LM2_BENCH_BATCH);                                                                                 \
+  }                                                                                                                                                \
+  BENCHMARK(BM_sweep3_sphere_bvh_##S);                                                                                                             \
+                                                                                                                                                   \
+  static void BM_sweep3_slide_capsule_##S(benchmark::State& state) {                                                                               \
+    bench_level_##S level;                                                                                                                         \
+    make_level_##S(level);                                                                                                                         \
+    for (auto _ : state) {                                                                                                                         \
+      for (size_t i = 0; i < LM2_BENCH_BATCH; i++) {                                                                                               \
+        lm2_v3_##S moved = lm2_sweep3_slide_capsule_##S(&level.bvh, level.capsules[i % level.capsules.size()],                                     \
+                                                        level.deltas[i % level.deltas.size()], (lm2_bench_##S)0.01, 4, NULL, NULL);                \
+        benchmark::DoNotOptimize(moved);                                                                                                           \
+      }                                                                                                                                            \
+    }                                                                                                                                              \
+    state.SetItemsProcessed(state.iterations() * LM2_BENCH_BATCH);                                                                                 \
+  }                                                                                                                                                \
+  BENCHMARK(BM_sweep3_slide_capsule_##S);
+
+LM2_BENCH_SWEEP3(f32)
+LM2_BENCH_SWEEP3(f64)
@@ -0,0 +1,145 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+// Shared body of the inline implementation benchmarks.
+// Included by bench_inline_linked.cpp (calls into the library) and
+// bench_inline_static.cpp (LM2_INLINE_IMPLEMENTATION), with
+// LM2_BENCH_INLINE_NAME giving the registered names a distinct suffix.
+
+#include <benchmark/benchmark.h>
+#include <vector>
+#include "lm2/matrices/lm2_matrix4x4.h"
+#include "lm2/misc/lm2_quaternion.h"
+#include "lm2/scalar/lm2_safe_ops.h"
+#include "lm2/vectors/lm2_vector3.h"
+#include "lm2/vectors/lm2_vector_specifics.h"
+
+#ifndef LM2_BENCH_INLINE_NAME
+#  error "LM2_BENCH_INLINE_NAME must be defined before including bench_inline.h"
+#endif
+
+// Number of elements processed per benchmark iteration
+#define LM2_BENCH_INLINE_COUNT 1024
+
+// Expands the suffixed name before BENCHMARK stringifies it
+#define LM2_BENCH_INLINE_REGISTER(fn) BENCHMARK(fn)
+
+namespace {
+
+  std::vector<lm2_v3_f32> make_points(size_t count) {
+    std::vector<lm2_v3_f32> points(count);
+    for (size_t i = 0; i < count; i++) {
+      float f = (float)i;
+      points[i] = lm2_v3_make_f32(f * 0.25f + 1.0f, f * 0.5f + 2.0f, f * 0.75f + 3.0f);
+    }
+    return points;
+  }
+
+  void LM2_BENCH_INLINE_NAME(BM_add_f32)(benchmark::State& state) {
+    std::vector<float> values(LM2_BENCH_INLINE_COUNT);
+    for (size_t i = 0; i < values.size(); i++) values[i] = (float)i + 1.0f;
+    for (auto _ : state) {
+      float sum = 0.0f;
+      for (float v : values) sum = lm2_add_f32(sum, v);
+      benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * LM2_BENCH_INLINE_COUNT);
+  }
+  LM2_BENCH_INLINE_REGISTER(LM2_BENCH_INLINE_NAME(BM_add_f32));
+
+  void LM2_BENCH_INLINE_NAME(BM_v3_add_f32)(benchmark::State& state) {
+    std::vector<lm2_v3_f32> points = make_points(LM2_BENCH_INLINE_COUNT);
+    for (auto _ : state) {
+      lm2_v3_f32 sum = lm2_v3_zero_f32();
+      for (const lm2_v3_f32& p : points) sum = lm2_v3_add_f32(sum, p);
+      benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * LM2_BENCH_INLINE_COUNT);
+  }
+  LM2_BENCH_INLINE_REGISTER(LM2_BENCH_INLINE_NAME(BM_v3_add_f32));
+
+  void LM2_BENCH_INLINE_NAME(BM_v3_dot_f32)(benchmark::State& state) {
+    std::vector<lm2_v3_f32> points = make_points(LM2_BENCH_INLINE_COUNT);
+    lm2_v3_f32 axis = lm2_v3_make_f32(0.0f, 1.0f, 0.0f);
+    for (auto _ : state) {
+      float sum = 0.0f;
+      for (const lm2_v3_f32& p : points) sum = lm2_add_f32(sum, lm2_v3_dot_f32(p, axis));
+      benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * LM2_BENCH_INLINE_COUNT);
+  }
+  LM2_BENCH_INLINE_REGISTER(LM2_BENCH_INLINE_NAME(BM_v3_dot_f32));
+
+  void LM2_BENCH_INLINE_NAME(BM_v3_norm_f32)(benchmark::State& state) {
+    std::vector<lm2_v3_f32> points = make_points(LM2_BENCH_INLINE_COUNT);
+    std::vector<lm2_v3_f32> out(points.size());
+    for (auto _ : state) {
+      for (size_t i = 0; i < points.size(); i++) out[i] = lm2_v3_norm_f32(points[i]);
+      benchmark::DoNotOptimize(out.data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * LM2_BENCH_INLINE_COUNT);
+  }
+  LM2_BENCH_INLINE_REGISTER(LM2_BENCH_INLINE_NAME(BM_v3_norm_f32));
+
+  void LM2_BENCH_INLINE_NAME(BM_quat_rotate_vector_f32)(benchmark::State& state) {
+    std::vector<lm2_v3_f32> points = make_points(LM2_BENCH_INLINE_COUNT);
+    std::vector<lm2_v3_f32> out(points.size());
+    lm2_quat_f32 q = lm2_quat_from_axis_angle_f32(lm2_v3_make_f32(0.0f, 1.0f, 0.0f), 0.5f);
+    for (auto _ : state) {
+      for (size_t i = 0; i < points.size(); i++) out[i] = lm2_quat_rotate_vector_f32(q, points[i]);
+      benchmark::DoNotOptimize(out.data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * LM2_BENCH_INLINE_COUNT);
+  }
+  LM2_BENCH_INLINE_REGISTER(LM2_BENCH_INLINE_NAME(BM_quat_rotate_vector_f32));
+
+  void LM2_BENCH_INLINE_NAME(BM_m4x4_mul_f32)(benchmark::State& state) {
+    lm2_m4x4_f32 a = lm2_m4x4_rotate_y_f32(0.5f);
+    lm2_m4x4_f32 b = lm2_m4x4_translate_f32(lm2_v3_make_f32(1.0f, 2.0f, 3.0f));
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(a);
+      benchmark::DoNotOptimize(b);
+      lm2_m4x4_f32 r = lm2_m4x4_mul_f32(a, b);
+      benchmark::DoNotOptimize(r);
+    }
+    state.SetItemsProcessed(state.iterations());
+  }
+  LM2_BENCH_INLINE_REGISTER(LM2_BENCH_INLINE_NAME(BM_m4x4_mul_f32));
+
+  void LM2_BENCH_INLINE_NAME(BM_m4x4_transform_point_f32)(benchmark::State& state) {
+    std::vector<lm2_v3_f32> points = make_points(LM2_BENCH_INLINE_COUNT);
+    std::vector<lm2_v3_f32> out(points.size());
+    lm2_m4x4_f32 m = lm2_m4x4_mul_f32(lm2_m4x4_rotate_y_f32(0.5f), lm2_m4x4_scale_uniform_f32(2.0f));
+    for (auto _ : state) {
+      for (size_t i = 0; i < points.size(); i++) out[i] = lm2_m4x4_transform_point_f32(m, points[i]);
+      benchmark::DoNotOptimize(out.data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * LM2_BENCH_INLINE_COUNT);
+  }
+  LM2_BENCH_INLINE_REGISTER(LM2_BENCH_INLINE_NAME(BM_m4x4_transform_point_f32));
+
+}  // namespace
@@ -0,0 +1,245 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "bench_common.h"
+
+// =============================================================================
+// Matrix Benchmarks
+// =============================================================================
+
+// Random affine transforms with scales in [0.5, 2] so inverses stay well-conditioned
+#define LM2_BENCH_MAT_RANDOM(S)                                                                               \
+  static std::vector<lm2_m3x2_##S> random_m3x2s_##S(size_t count, uint64_t seed) {                            \
+    lm2_bench::rng r(seed);                                                                                   \
+    std::vector<lm2_m3x2_##S> out(count);                                                                     \
+    for (auto& m : out) {                                                                                     \
+      m = lm2_m3x2_world_transform_##S(lm2_bench::random_v2<lm2_bench_##S>(r, -10.0, 10.0),                   \
+                                       lm2_bench::random_v2<lm2_bench_##S>(r, 0.5, 2.0),                      \
+                                       (lm2_bench_##S)r.uniform(-3.0, 3.0));                                  \
+    }                                                                                                         \
+    return out;                                                                                               \
+  }                                                                                                           \
+  static std::vector<lm2_m3x3_##S> random_m3x3s_##S(size_t count, uint64_t seed) {                            \
+    lm2_bench::rng r(seed);                                                                                   \
+    std::vector<lm2_m3x3_##S> out(count);                                                                     \
+    for (auto& m : out) {                                                                                     \
+      m = lm2_m3x3_mul_##S(lm2_m3x3_scale_translate_##S(lm2_bench::random_v2<lm2_bench_##S>(r, 0.5, 2.0),     \
+                                                        lm2_bench::random_v2<lm2_bench_##S>(r, -10.0, 10.0)), \
+                           lm2_m3x3_rotate_##S((lm2_bench_##S)r.uniform(-3.0, 3.0)));                         \
+    }                                                                                                         \
+    return out;                                                                                               \
+  }                                                                                                           \
+  static std::vector<lm2_m4x4_##S> random_m4x4s_##S(size_t count, uint64_t seed) {                            \
+    lm2_bench::rng r(seed);                                                                                   \
+    std::vector<lm2_m4x4_##S> out(count);                                                                     \
+    for (auto& m : out) {                                                                                     \
+      m = lm2_m4x4_world_transform_##S(lm2_bench::random_v3<lm2_bench_##S>(r, -10.0, 10.0),                   \
+                                       lm2_bench::random_v3<lm2_bench_##S>(r, 0.5, 2.0),                      \
+                                       lm2_bench::random_v3<lm2_bench_##S>(r, -3.0, 3.0));                    \
+    }                                                                                                         \
+    return out;                                                                                               \
+  }
+
+LM2_BENCH_MAT_RANDOM(f32)
+LM2_BENCH_MAT_RANDOM(f64)
+
+// Matrix-matrix ops over a batch of LM2_BENCH_BATCH matrices per iteration
+#define LM2_BENCH_MAT_BINARY(MAT, S, op)                           \
+  static void BM_##MAT##_##op##_##S(benchmark::State& state) {     \
+    auto a = random_##MAT##s_##S(LM2_BENCH_BATCH, 1);              \
+    auto b = random_##MAT##s_##S(LM2_BENCH_BATCH, 2);              \
+    std::vector<typename decltype(a)::value_type> out(a.size());   \
+    for (auto _ : state) {                                         \
+      for (size_t i = 0; i < a.size(); i++) {                      \
+        out[i] = lm2_##MAT##_##op##_##S(a[i], b[i]);               \
+      }                                                            \
+      benchmark::DoNotOptimize(out.data());                        \
+      benchmark::ClobberMemory();                                  \
+    }                                                              \
+    state.SetItemsProcessed(state.iterations() * LM2_BENCH_BATCH); \
+  }                                                                \
+  BENCHMARK(BM_##MAT##_##op##_##S);
+
+#define LM2_BENCH_MAT_UNARY(MAT, S, op)                                \
+  static void BM_##MAT##_##op##_##S(benchmark::State& state) {         \
+    auto a = random_##MAT##s_##S(LM2_BENCH_BATCH, 1);                  \
+    std::vector<decltype(lm2_##MAT##_##op##_##S(a[0]))> out(a.size()); \
+    for (auto _ : state) {                                             \
+      for (size_t i = 0; i < a.size(); i++) {                          \
+        out[i] = lm2_##MAT##_##op##_##S(a[i]);                         \
+      }                                                                \
+      benchmark::DoNotOptimize(out.data());                            \
+      benchmark::ClobberMemory();                                      \
+    }                                                                  \
+    state.SetItemsProcessed(state.iterations() * LM2_BENCH_BATCH);     \
+  }                                                                    \
+  BENCHMARK(BM_##MAT##_##op##_##S);
+
+// Rate counter reporting processed points (or matrices) per second of benchmark time
+static benchmark::Counter lm2_bench_points_per_second(uint32_t count) {
+  return benchmark::Counter((double)count, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+// Single point transforms, one matrix per point
+#define LM2_BENCH_MAT_TRANSFORM_POINT(MAT, VEC, S)                                         \
+  static void BM_##MAT##_transform_point_##S(benchmark::State& state) {                    \
+    auto m = random_##MAT##s_##S(LM2_BENCH_BATCH, 1);                                      \
+    auto p = lm2_bench::random_##VEC##s<lm2_bench_##S>(LM2_BENCH_BATCH, -100.0, 100.0, 2); \
+    std::vector<typename decltype(p)::value_type> out(p.size());                           \
+    for (auto _ : state) {                                                                 \
+      for (size_t i = 0; i < p.size(); i++) {                                              \
+        out[i] = lm2_##MAT##_transform_point_##S(m[i], p[i]);                              \
+      }                                                                                    \
+      benchmark::DoNotOptimize(out.data());                                                \
+      benchmark::ClobberMemory();                                                          \
+    }                                                                                      \
+    state.SetItemsProcessed(state.iterations() * LM2_BENCH_BATCH);                         \
+  }                                                                                        \
+  BENCHMARK(BM_##MAT##_transform_point_##S);
+
+// Bulk point transforms with one matrix, parameterized by point count
+#define LM2_BENCH_MAT_TRANSFORM_POINTS(MAT, VEC, S)                                    \
+  static void BM_##MAT##_transform_points_##S(benchmark::State& state) {               \
+    const uint32_t count = (uint32_t)state.range(0);                                   \
+    auto m = random_##MAT##s_##S(1, 1);                                                \
+    auto src = lm2_bench::random_##VEC##s<lm2_bench_##S>(count, -100.0, 100.0, 2);     \
+    std::vector<typename decltype(src)::value_type> dst(count);                        \
+    for (auto _ : state) {                                                             \
+      lm2_##MAT##_transform_points_src_dst_##S(m[0], src.data(), dst.data(), count);   \
+      benchmark::DoNotOptimize(dst.data());                                            \
+      benchmark::ClobberMemory();                                                      \
+    }                                                                                  \
+    state.SetItemsProcessed(state.iterations() * count);                               \
+    state.counters["points/s"] = lm2_bench_points_per_second(count);                   \
+  }                                                                                    \
+  BENCHMARK(BM_##MAT##_transform_points_##S)->RangeMultiplier(16)->Range(64, 1 << 20);
+
+// Parallel bulk transforms over {count, thread_count}, thread_count 0 meaning
+// one per hardware thread. Timed on the wall clock since the work is spread over
+// worker threads.
+#define LM2_BENCH_MAT_TRANSFORM_POINTS_PARALLEL(MAT, VEC, S)                                        \
+  static void BM_##MAT##_transform_points_parallel_##S(benchmark::State& state) {                   \
+    const uint32_t count = (uint32_t)state.range(0);                                                \
+    const uint32_t thread_count = (uint32_t)state.range(1);                                         \
+    auto m = random_##MAT##s_##S(1, 1);                                                             \
+    auto src = lm2_bench::random_##VEC##s<lm2_bench_##S>(count, -100.0, 100.0, 2);                  \
+    std::vector<typename decltype(src)::value_type> dst(count);                                     \
+    for (auto _ : state) {                                                                          \
+      lm2_##MAT##_transform_points_parallel_##S(m[0], src.data(), dst.data(), count, thread_count); \
+      benchmark::DoNotOptimize(dst.data());                                                         \
+      benchmark::ClobberMemory();                                                                   \
+    }                                                                                               \
+    state.SetItemsProcessed(state.iterations() * count);                                            \
+    state.counters["points/s"] = lm2_bench_points_per_second(count);                                \
+  }                                                                                                 \
+  BENCHMARK(BM_##MAT##_transform_points_parallel_##S)                                               \
+      ->ArgsProduct({{1 << 16, 1 << 20, 1 << 22}, {1, 2, 4, 0}})                                    \
+      ->UseRealTime();
+
+#define LM2_BENCH_MAT_ALL(MAT, VEC, S)                 \
+  LM2_BENCH_MAT_BINARY(MAT, S, mul)                    \
+  LM2_BENCH_MAT_UNARY(MAT, S, inverse)                 \
+  LM2_BENCH_MAT_UNARY(MAT, S, determinant)             \
+  LM2_BENCH_MAT_TRANSFORM_POINT(MAT, VEC, S)           \
+  LM2_BENCH_MAT_TRANSFORM_POINTS(MAT, VEC, S)          \
+  LM2_BENCH_MAT_TRANSFORM_POINTS_PARALLEL(MAT, VEC, S)
+
+LM2_BENCH_MAT_ALL(m3x2, v2, f32)
+LM2_BENCH_MAT_ALL(m3x2, v2, f64)
+LM2_BENCH_MAT_ALL(m3x3, v2, f32)
+LM2_BENCH_MAT_ALL(m3x3, v2, f64)
+LM2_BENCH_MAT_ALL(m4x4, v3, f32)
+LM2_BENCH_MAT_ALL(m4x4, v3, f64)
+
+LM2_BENCH_MAT_UNARY(m3x3, f32, transpose)
+LM2_BENCH_MAT_UNARY(m3x3, f64, transpose)
+LM2_BENCH_MAT_UNARY(m4x4, f32, transpose)
+LM2_BENCH_MAT_UNARY(m4x4, f64, transpose)
+
+// Batched 4x4 products against a loop of lm2_m4x4_mul, reported in matrices per second
+#define LM2_BENCH_M4X4_MUL_ARRAY(S)                                                    \
+  static void BM_m4x4_mul_loop_##S(benchmark::State& state) {                          \
+    const uint32_t count = (uint32_t)state.range(0);                                   \
+    auto a = random_m4x4s_##S(count, 1);                                               \
+    auto b = random_m4x4s_##S(count, 2);                                               \
+    std::vector<lm2_m4x4_##S> dst(count);                                              \
+    for (auto _ : state) {                                                             \
+      for (uint32_t i = 0; i < count; i++) {                                           \
+        dst[i] = lm2_m4x4_mul_##S(a[i], b[i]);                                         \
+      }                                                                                \
+      benchmark::DoNotOptimize(dst.data());                                            \
+      benchmark::ClobberMemory();                                                      \
+    }                                                                                  \
+    state.counters["matrices/s"] = lm2_bench_points_per_second(count);                 \
+  }                                                                                    \
+  BENCHMARK(BM_m4x4_mul_loop_##S)->RangeMultiplier(16)->Range(64, 1 << 16);            \
+  static void BM_m4x4_mul_array_##S(benchmark::State& state) {                         \
+    const uint32_t count = (uint32_t)state.range(0);                                   \
+    auto a = random_m4x4s_##S(count, 1);                                               \
+    auto b = random_m4x4s_##S(count, 2);                                               \
+    std::vector<lm2_m4x4_##S> dst(count);                                              \
+    for (auto _ : state) {                                                             \
+      lm2_m4x4_mul_array_##S(a.data(), b.data(), dst.data(), count);                   \
+      benchmark::DoNotOptimize(dst.data());                                            \
+      benchmark::ClobberMemory();                                                      \
+    }                                                                                  \
+    state.counters["matrices/s"] = lm2_bench_points_per_second(count);                 \
+  }                                                                                    \
+  BENCHMARK(BM_m4x4_mul_array_##S)->RangeMultiplier(16)->Range(64, 1 << 16);           \
+  static void BM_m4x4_premul_array_##S(benchmark::State& state) {                      \
+    const uint32_t count = (uint32_t)state.range(0);                                   \
+    auto m = random_m4x4s_##S(1, 1);                                                   \
+    auto b = random_m4x4s_##S(count, 2);                                               \
+    std::vector<lm2_m4x4_##S> dst(count);                                              \
+    for (auto _ : state) {                                                             \
+      lm2_m4x4_premul_array_##S(&m[0], b.data(), dst.data(), count);                   \
+      benchmark::DoNotOptimize(dst.data());                                            \
+      benchmark::ClobberMemory();                                                      \
+    }                                                                                  \
+    state.counters["matrices/s"] = lm2_bench_points_per_second(count);                 \
+  }                                                                                    \
+  BENCHMARK(BM_m4x4_premul_array_##S)->RangeMultiplier(16)->Range(64, 1 << 16);        \
+  static void BM_m4x4_propagate_hierarchy_##S(benchmark::State& state) {               \
+    const uint32_t count = (uint32_t)state.range(0);                                   \
+    auto local = random_m4x4s_##S(count, 1);                                           \
+    std::vector<int32_t> parents(count);                                               \
+    lm2_bench::rng r(3);                                                               \
+    for (uint32_t i = 0; i < count; i++) {                                             \
+      parents[i] = i == 0 ? -1 : (int32_t)(r.uniform(0.0, (double)i)) % (int32_t)i;    \
+    }                                                                                  \
+    std::vector<lm2_m4x4_##S> world(count);                                            \
+    for (auto _ : state) {                                                             \
+      state.PauseTiming();                                                             \
+      world = local;                                                                   \
+      state.ResumeTiming();                                                            \
+      lm2_m4x4_propagate_hierarchy_##S(world.data(), parents.data(), count);           \
+      benchmark::DoNotOptimize(world.data());                                          \
+      benchmark::ClobberMemory();                                                      \
+    }                                                                                  \
+    state.counters["matrices/s"] = lm2_bench_points_per_second(count);                 \
+  }                                                                                    \
+  BENCHMARK(BM_m4x4_propagate_hierarchy_##S)->RangeMultiplier(16)->Range(64, 1 << 16);
+
+LM2_BENCH_M4X4_MUL_ARRAY(f32)
+LM2_BENCH_M4X4_MUL_ARRAY(f64)
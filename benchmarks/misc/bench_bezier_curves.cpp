@@ -0,0 +1,87 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "bench_common.h"
+
+// =============================================================================
+// Bezier Curve Benchmarks
+// =============================================================================
+
+#define LM2_BENCH_BEZIER_CUBIC(S, VEC, N)                                                   \
+  static void BM_bezier_cubic##N##_##S(benchmark::State& state) {                           \
+    lm2_bench::rng r(1);                                                                    \
+    auto p0 = lm2_bench::random_##VEC<lm2_bench_##S>(r, -10.0, 10.0);                       \
+    auto p1 = lm2_bench::random_##VEC<lm2_bench_##S>(r, -10.0, 10.0);                       \
+    auto p2 = lm2_bench::random_##VEC<lm2_bench_##S>(r, -10.0, 10.0);                       \
+    auto p3 = lm2_bench::random_##VEC<lm2_bench_##S>(r, -10.0, 10.0);                       \
+    auto t = lm2_bench::random_scalars<lm2_bench_##S>(LM2_BENCH_BATCH, 0.0, 1.0, 2);        \
+    std::vector<decltype(p0)> out(t.size());                                                \
+    for (auto _ : state) {                                                                  \
+      for (size_t i = 0; i < t.size(); i++) {                                               \
+        out[i] = lm2_bezier_cubic##N##_##S(p0, p1, p2, p3, t[i]);                           \
+      }                                                                                     \
+      benchmark::DoNotOptimize(out.data());                                                 \
+      benchmark::ClobberMemory();                                                           \
+    }                                                                                       \
+    state.SetItemsProcessed(state.iterations() * LM2_BENCH_BATCH);                          \
+  }                                                                                         \
+  BENCHMARK(BM_bezier_cubic##N##_##S);                                                      \
+                                                                                            \
+  static void BM_bezier_cubic_derivative##N##_##S(benchmark::State& state) {                \
+    lm2_bench::rng r(1);                                                                    \
+    auto p0 = lm2_bench::random_##VEC<lm2_bench_##S>(r, -10.0, 10.0);                       \
+    auto p1 = lm2_bench::random_##VEC<lm2_bench_##S>(r, -10.0, 10.0);                       \
+    auto p2 = lm2_bench::random_##VEC<lm2_bench_##S>(r, -10.0, 10.0);                       \
+    auto p3 = lm2_bench::random_##VEC<lm2_bench_##S>(r, -10.0, 10.0);                       \
+    auto t = lm2_bench::random_scalars<lm2_bench_##S>(LM2_BENCH_BATCH, 0.0, 1.0, 2);        \
+    std::vector<decltype(p0)> out(t.size());                                                \
+    for (auto _ : state) {                                                                  \
+      for (size_t i = 0; i < t.size(); i++) {                                               \
+        out[i] = lm2_bezier_cubic_derivative##N##_##S(p0, p1, p2, p3, t[i]);                \
+      }                                                                                     \
+      benchmark::DoNotOptimize(out.data());                                                 \
+      benchmark::ClobberMemory();                                                           \
+    }                                                                                       \
+    state.SetItemsProcessed(state.iterations() * LM2_BENCH_BATCH);                          \
+  }                                                                                         \
+  BENCHMARK(BM_bezier_cubic_derivative##N##_##S);                                           \
+                                                                                            \
+  static void BM_bezier_cubic_length##N##_##S(benchmark::State& state) {                    \
+    lm2_bench::rng r(1);                                                                    \
+    auto p0 = lm2_bench::random_##VEC<lm2_bench_##S>(r, -10.0, 10.0);                       \
+    auto p1 = lm2_bench::random_##VEC<lm2_bench_##S>(r, -10.0, 10.0);                       \
+    auto p2 = lm2_bench::random_##VEC<lm2_bench_##S>(r, -10.0, 10.0);                       \
+    auto p3 = lm2_bench::random_##VEC<lm2_bench_##S>(r, -10.0, 10.0);                       \
+    const int segments = (int)state.range(0);                                               \
+    for (auto _ : state) {                                                                  \
+      benchmark::DoNotOptimize(lm2_bezier_cubic_length##N##_##S(p0, p1, p2, p3, segments)); \
+    }                                                                                       \
+    state.SetItemsProcessed(state.iterations() * segments);                                 \
+  }                                                                                         \
+  BENCHMARK(BM_bezier_cubic_length##N##_##S)->Arg(16)->Arg(256);
+
+LM2_BENCH_BEZIER_CUBIC(f32, v2, 2)
+LM2_BENCH_BEZIER_CUBIC(f64, v2, 2)
+LM2_BENCH_BEZIER_CUBIC(f32, v3, 3)
+LM2_BENCH_BEZIER_CUBIC(f64, v3, 3)
@@ -0,0 +1,64 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "bench_common.h"
+
+// =============================================================================
+// Easing Benchmarks
+// =============================================================================
+// t stays inside (0, 1) so the exponential and elastic curves never produce
+// subnormals that the safe ops would reject.
+
+#define LM2_BENCH_EASE(S, name)                                                        \
+  static void BM_ease_##name##_##S(benchmark::State& state) {                          \
+    auto t = lm2_bench::random_scalars<lm2_bench_##S>(LM2_BENCH_BATCH, 0.05, 0.95, 1); \
+    for (auto _ : state) {                                                             \
+      lm2_bench_##S sum = 0;                                                           \
+      for (lm2_bench_##S x : t) sum += lm2_ease_##name##_##S(x);                       \
+      benchmark::DoNotOptimize(sum);                                                   \
+    }                                                                                  \
+    state.SetItemsProcessed(state.iterations() * LM2_BENCH_BATCH);                     \
+  }                                                                                    \
+  BENCHMARK(BM_ease_##name##_##S);
+
+#define LM2_BENCH_EASE_FAMILY(S, family) \
+  LM2_BENCH_EASE(S, family##_in)         \
+  LM2_BENCH_EASE(S, family##_out)        \
+  LM2_BENCH_EASE(S, family##_in_out)
+
+#define LM2_BENCH_EASINGS(S)        \
+  LM2_BENCH_EASE(S, linear)         \
+  LM2_BENCH_EASE_FAMILY(S, sin)     \
+  LM2_BENCH_EASE_FAMILY(S, quad)    \
+  LM2_BENCH_EASE_FAMILY(S, cubic)   \
+  LM2_BENCH_EASE_FAMILY(S, quart)   \
+  LM2_BENCH_EASE_FAMILY(S, quint)   \
+  LM2_BENCH_EASE_FAMILY(S, exp)     \
+  LM2_BENCH_EASE_FAMILY(S, circ)    \
+  LM2_BENCH_EASE_FAMILY(S, back)    \
+  LM2_BENCH_EASE_FAMILY(S, elastic) \
+  LM2_BENCH_EASE_FAMILY(S, bounce)
+
+LM2_BENCH_EASINGS(f32)
+LM2_BENCH_EASINGS(f64)
@@ -0,0 +1,95 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "bench_common.h"
+
+// =============================================================================
+// Hash Benchmarks
+// =============================================================================
+
+#define LM2_BENCH_HASH_FLOAT(S)                                                             \
+  static void BM_hash_##S(benchmark::State& state) {                                        \
+    auto v = lm2_bench::random_scalars<lm2_bench_##S>(LM2_BENCH_BATCH, -1000.0, 1000.0, 1); \
+    for (auto _ : state) {                                                                  \
+      uint64_t acc = 0;                                                                     \
+      for (lm2_bench_##S x : v) acc ^= lm2_hash_##S(x);                                     \
+      benchmark::DoNotOptimize(acc);                                                        \
+    }                                                                                       \
+    state.SetItemsProcessed(state.iterations() * LM2_BENCH_BATCH);                          \
+  }                                                                                         \
+  BENCHMARK(BM_hash_##S);
+
+LM2_BENCH_HASH_FLOAT(f32)
+LM2_BENCH_HASH_FLOAT(f64)
+
+static void BM_hash_mix_u32(benchmark::State& state) {
+  for (auto _ : state) {
+    uint32_t h = 1;
+    for (uint32_t i = 0; i < LM2_BENCH_BATCH; i++) h = lm2_hash_mix_u32(h + i);
+    benchmark::DoNotOptimize(h);
+  }
+  state.SetItemsProcessed(state.iterations() * LM2_BENCH_BATCH);
+}
+BENCHMARK(BM_hash_mix_u32);
+
+static void BM_hash_mix_u64(benchmark::State& state) {
+  for (auto _ : state) {
+    uint64_t h = 1;
+    for (uint64_t i = 0; i < LM2_BENCH_BATCH; i++) h = lm2_hash_mix_u64(h + i);
+    benchmark::DoNotOptimize(h);
+  }
+  state.SetItemsProcessed(state.iterations() * LM2_BENCH_BATCH);
+}
+BENCHMARK(BM_hash_mix_u64);
+
+static void BM_hash_combine_u64(benchmark::State& state) {
+  for (auto _ : state) {
+    uint64_t h = 0;
+    for (uint64_t i = 0; i < LM2_BENCH_BATCH; i++) h = lm2_hash_combine_u64(h, i);
+    benchmark::DoNotOptimize(h);
+  }
+  state.SetItemsProcessed(state.iterations() * LM2_BENCH_BATCH);
+}
+BENCHMARK(BM_hash_combine_u64);
+
+// Byte hashes, parameterized by buffer size
+static void BM_hash_fnv1a_u32(benchmark::State& state) {
+  std::vector<uint8_t> data((size_t)state.range(0));
+  for (size_t i = 0; i < data.size(); i++) data[i] = (uint8_t)(i * 31u);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(lm2_hash_fnv1a_u32(data.data(), data.size()));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_hash_fnv1a_u32)->RangeMultiplier(8)->Range(8, 1 << 16);
+
+static void BM_hash_fnv1a_u64(benchmark::State& state) {
+  std::vector<uint8_t> data((size_t)state.range(0));
+  for (size_t i = 0; i < data.size(); i++) data[i] = (uint8_t)(i * 31u);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(lm2_hash_fnv1a_u64(data.data(), data.size()));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_hash_fnv1a_u64)->RangeMultiplier(8)->Range(8, 1 << 16);
@@ -0,0 +1,64 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "bench_common.h"
+
+// =============================================================================
+// Noise Benchmarks
+// =============================================================================
+// Samples are spread over a few hundred lattice cells so the permutation table
+// lookups are not all cache-hot.
+
+#define LM2_BENCH_NOISE2(S, fn)                                                       \
+  static void BM_##fn##_##S(benchmark::State& state) {                                \
+    auto p = lm2_bench::random_v2s<lm2_bench_##S>(LM2_BENCH_BATCH, -256.0, 256.0, 1); \
+    for (auto _ : state) {                                                            \
+      lm2_bench_##S sum = 0;                                                          \
+      for (const auto& v : p) sum += lm2_##fn##_##S(v.x, v.y);                        \
+      benchmark::DoNotOptimize(sum);                                                  \
+    }                                                                                 \
+    state.SetItemsProcessed(state.iterations() * LM2_BENCH_BATCH);                    \
+  }                                                                                   \
+  BENCHMARK(BM_##fn##_##S);
+
+#define LM2_BENCH_NOISE3(S, fn)                                                       \
+  static void BM_##fn##_##S(benchmark::State& state) {                                \
+    auto p = lm2_bench::random_v3s<lm2_bench_##S>(LM2_BENCH_BATCH, -256.0, 256.0, 1); \
+    for (auto _ : state) {                                                            \
+      lm2_bench_##S sum = 0;                                                          \
+      for (const auto& v : p) sum += lm2_##fn##_##S(v.x, v.y, v.z);                   \
+      benchmark::DoNotOptimize(sum);                                                  \
+    }                                                                                 \
+    state.SetItemsProcessed(state.iterations() * LM2_BENCH_BATCH);                    \
+  }                                                                                   \
+  BENCHMARK(BM_##fn##_##S);
+
+#define LM2_BENCH_NOISE(S)      \
+  LM2_BENCH_NOISE2(S, perlin2)  \
+  LM2_BENCH_NOISE3(S, perlin3)  \
+  LM2_BENCH_NOISE2(S, voronoi2) \
+  LM2_BENCH_NOISE3(S, voronoi3)
+
+LM2_BENCH_NOISE(f32)
+LM2_BENCH_NOISE(f64)
@@ -0,0 +1,110 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "bench_common.h"
+
+// =============================================================================
+// Quaternion Benchmarks
+// =============================================================================
+
+#define LM2_BENCH_QUAT_RANDOM(S)                                                          \
+  static std::vector<lm2_quat_##S> random_quats_##S(size_t count, uint64_t seed) {        \
+    lm2_bench::rng r(seed);                                                               \
+    std::vector<lm2_quat_##S> out(count);                                                 \
+    for (auto& q : out) {                                                                 \
+      q = lm2_quat_from_euler_vec_##S(lm2_bench::random_v3<lm2_bench_##S>(r, -3.0, 3.0)); \
+    }                                                                                     \
+    return out;                                                                           \
+  }
+
+#define LM2_BENCH_QUAT(S)                                                                    \
+  LM2_BENCH_QUAT_RANDOM(S)                                                                   \
+  static void BM_quat_multiply_##S(benchmark::State& state) {                                \
+    auto a = random_quats_##S(LM2_BENCH_BATCH, 1);                                           \
+    auto b = random_quats_##S(LM2_BENCH_BATCH, 2);                                           \
+    std::vector<lm2_quat_##S> out(a.size());                                                 \
+    for (auto _ : state) {                                                                   \
+      for (size_t i = 0; i < a.size(); i++) out[i] = lm2_quat_multiply_##S(a[i], b[i]);      \
+      benchmark::DoNotOptimize(out.data());                                                  \
+      benchmark::ClobberMemory();                                                            \
+    }                                                                                        \
+    state.SetItemsProcessed(state.iterations() * LM2_BENCH_BATCH);                           \
+  }                                                                                          \
+  BENCHMARK(BM_quat_multiply_##S);                                                           \
+                                                                                             \
+  static void BM_quat_rotate_vector_##S(benchmark::State& state) {                           \
+    auto q = random_quats_##S(LM2_BENCH_BATCH, 1);                                           \
+    auto v = lm2_bench::random_v3s<lm2_bench_##S>(LM2_BENCH_BATCH, -100.0, 100.0, 2);        \
+    std::vector<lm2_v3_##S> out(q.size());                                                   \
+    for (auto _ : state) {                                                                   \
+      for (size_t i = 0; i < q.size(); i++) out[i] = lm2_quat_rotate_vector_##S(q[i], v[i]); \
+      benchmark::DoNotOptimize(out.data());                                                  \
+      benchmark::ClobberMemory();                                                            \
+    }                                                                                        \
+    state.SetItemsProcessed(state.iterations() * LM2_BENCH_BATCH);                           \
+  }                                                                                          \
+  BENCHMARK(BM_quat_rotate_vector_##S);                                                      \
+                                                                                             \
+  static void BM_quat_slerp_##S(benchmark::State& state) {                                   \
+    auto a = random_quats_##S(LM2_BENCH_BATCH, 1);                                           \
+    auto b = random_quats_##S(LM2_BENCH_BATCH, 2);                                           \
+    auto t = lm2_bench::random_scalars<lm2_bench_##S>(LM2_BENCH_BATCH, 0.0, 1.0, 3);         \
+    std::vector<lm2_quat_##S> out(a.size());                                                 \
+    for (auto _ : state) {                                                                   \
+      for (size_t i = 0; i < a.size(); i++) out[i] = lm2_quat_slerp_##S(a[i], b[i], t[i]);   \
+      benchmark::DoNotOptimize(out.data());                                                  \
+      benchmark::ClobberMemory();                                                            \
+    }                                                                                        \
+    state.SetItemsProcessed(state.iterations() * LM2_BENCH_BATCH);                           \
+  }                                                                                          \
+  BENCHMARK(BM_quat_slerp_##S);                                                              \
+                                                                                             \
+  static void BM_quat_nlerp_##S(benchmark::State& state) {                                   \
+    auto a = random_quats_##S(LM2_BENCH_BATCH, 1);                                           \
+    auto b = random_quats_##S(LM2_BENCH_BATCH, 2);                                           \
+    auto t = lm2_bench::random_scalars<lm2_bench_##S>(LM2_BENCH_BATCH, 0.0, 1.0, 3);         \
+    std::vector<lm2_quat_##S> out(a.size());                                                 \
+    for (auto _ : state) {                                                                   \
+      for (size_t i = 0; i < a.size(); i++) out[i] = lm2_quat_nlerp_##S(a[i], b[i], t[i]);   \
+      benchmark::DoNotOptimize(out.data());                                                  \
+      benchmark::ClobberMemory();                                                            \
+    }                                                                                        \
+    state.SetItemsProcessed(state.iterations() * LM2_BENCH_BATCH);                           \
+  }                                                                                          \
+  BENCHMARK(BM_quat_nlerp_##S);                                                              \
+                                                                                             \
+  static void BM_quat_to_m4x4_##S(benchmark::State& state) {                                 \
+    auto q = random_quats_##S(LM2_BENCH_BATCH, 1);                                           \
+    std::vector<lm2_m4x4_##S> out(q.size());                                                 \
+    for (auto _ : state) {                                                                   \
+      for (size_t i = 0; i < q.size(); i++) out[i] = lm2_m4x4_from_quat_##S(q[i]);           \
+      benchmark::DoNotOptimize(out.data());                                                  \
+      benchmark::ClobberMemory();                                                            \
+    }                                                                                        \
+    state.SetItemsProcessed(state.iterations() * LM2_BENCH_BATCH);                           \
+  }                                                                                          \
+  BENCHMARK(BM_quat_to_m4x4_##S);
+
+LM2_BENCH_QUAT(f32)
+LM2_BENCH_QUAT(f64)
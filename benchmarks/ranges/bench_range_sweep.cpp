@@ -0,0 +1,117 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <cmath>
+#include "bench_common.h"
+
+// =============================================================================
+// Sweep and Prune Benchmarks
+// =============================================================================
+// Boxes with half extents of 0.5 to 2 in a square (cube) whose side grows with
+// the count, so every box overlaps a handful of others at any size. Moving
+// boxes step by up to 0.1 per frame.
+
+#define LM2_BENCH_SWEEP(R, D, S)                                                                                                 \
+  static std::vector<lm2_##R##_##S> random_boxes_##R##_##S(size_t count, uint64_t seed) {                                        \
+    lm2_bench::rng r(seed);                                                                                                      \
+    const double side = (D == 2 ? 6.0 : 4.0) * std::pow((double)count, 1.0 / D);                                                 \
+    std::vector<lm2_##R##_##S> boxes(count);                                                                                     \
+    for (auto& box : boxes) {                                                                                                    \
+      for (int a = 0; a < D; a++) {                                                                                              \
+        double center = r.uniform(0, side);                                                                                      \
+        double half = r.uniform(0.5, 2);                                                                                         \
+        box.min.e[a] = (lm2_bench_##S)(center - half);                                                                           \
+        box.max.e[a] = (lm2_bench_##S)(center + half);                                                                           \
+      }                                                                                                                          \
+    }                                                                                                                            \
+    return boxes;                                                                                                                \
+  }                                                                                                                              \
+                                                                                                                                 \
+  static void BM_sweep_pairs_##R##_##S(benchmark::State& state) {                                                                \
+    const size_t count = (size_t)state.range(0);                                                                                 \
+    auto boxes = random_boxes_##R##_##S(count, 1);                                                                               \
+    std::vector<uint64_t> buffer((lm2_##R##_sweep_buffer_size_##S(count) + 7) / 8);                                              \
+    std::vector<lm2_sweep_pair> pairs(count * 8);                                                                                \
+    size_t pair_count = 0;                                                                                                       \
+    for (auto _ : state) {                                                                                                       \
+      pair_count = lm2_##R##_sweep_pairs_##S(boxes.data(), count, buffer.data(), buffer.size() * 8, pairs.data(), pairs.size()); \
+      benchmark::DoNotOptimize(pairs.data());                                                                                    \
+      benchmark::ClobberMemory();                                                                                                \
+    }                                                                                                                            \
+    state.counters["pairs"] = (double)pair_count;                                                                                \
+    state.counters["boxes/s"] = benchmark::Counter((double)count, benchmark::Counter::kIsIterationInvariantRate);                \
+  }                                                                                                                              \
+  BENCHMARK(BM_sweep_pairs_##R##_##S)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);                        \
+                                                                                                                                 \
+  /* One frame: move every box, then update the kept order and sweep */                                                          \
+  static void BM_sweep_update_##R##_##S(benchmark::State& state) {                                                               \
+    const size_t count = (size_t)state.range(0);                                                                                 \
+    auto boxes = random_boxes_##R##_##S(count, 1);                                                                               \
+    lm2_bench::rng r(2);                                                                                                         \
+    std::vector<lm2_bench_##S> steps(count * D);                                                                                 \
+    for (auto& step : steps) step = (lm2_bench_##S)r.uniform(-0.1, 0.1);                                                         \
+    std::vector<uint64_t> buffer((lm2_##R##_sweep_buffer_size_##S(count) + 7) / 8);                                              \
+    std::vector<lm2_sweep_pair> pairs(count * 8);                                                                                \
+    lm2_sweep_##S sweep = lm2_sweep_make_##S(buffer.data(), buffer.size() * 8);                                                  \
+    lm2_##R##_sweep_update_##S(&sweep, boxes.data(), count, pairs.data(), pairs.size());                                         \
+    for (auto _ : state) {                                                                                                       \
+      for (size_t i = 0; i < count; i++) {                                                                                       \
+        for (int a = 0; a < D; a++) {                                                                                            \
+          boxes[i].min.e[a] += steps[i * D + a];                                                                                 \
+          boxes[i].max.e[a] += steps[i * D + a];                                                                                 \
+        }                                                                                                                        \
+      }                                                                                                                          \
+      size_t pair_count = lm2_##R##_sweep_update_##S(&sweep, boxes.data(), count, pairs.data(), pairs.size());                   \
+      benchmark::DoNotOptimize(pair_count);                                                                                      \
+      benchmark::ClobberMemory();                                                                                                \
+    }                                                                                                                            \
+    state.counters["boxes/s"] = benchmark::Counter((double)count, benchmark::Counter::kIsIterationInvariantRate);                \
+  }                                                                                                                              \
+  BENCHMARK(BM_sweep_update_##R##_##S)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);                       \
+                                                                                                                                 \
+  /* All-pairs test, the baseline the sweep replaces */                                                                          \
+  static void BM_sweep_brute_force_##R##_##S(benchmark::State& state) {                                                          \
+    const size_t count = (size_t)state.range(0);                                                                                 \
+    auto boxes = random_boxes_##R##_##S(count, 1);                                                                               \
+    for (auto _ : state) {                                                                                                       \
+      size_t pair_count = 0;                                                                                                     \
+      for (size_t i = 0; i < count; i++) {                                                                                       \
+        for (size_t j = i + 1; j < count; j++) {                                                                                 \
+          bool overlap = true;                                                                                                   \
+          for (int a = 0; a < D; a++) {                                                                                          \
+            overlap &= boxes[i].min.e[a] <= boxes[j].max.e[a] && boxes[j].min.e[a] <= boxes[i].max.e[a];                         \
+          }                                                                                                                      \
+          pair_count += overlap;                                                                                                 \
+        }                                                                                                                        \
+      }                                                                                                                          \
+      benchmark::DoNotOptimize(pair_count);                                                                                      \
+    }                                                                                                                            \
+    state.counters["boxes/s"] = benchmark::Counter((double)count, benchmark::Counter::kIsIterationInvariantRate);                \
+  }                                                                                                                              \
+  BENCHMARK(BM_sweep_brute_force_##R##_##S)->Arg(1000)->Arg(10000)->Unit(benchmark::kMicrosecond);
+
+LM2_BENCH_SWEEP(r2, 2, f32)
+LM2_BENCH_SWEEP(r2, 2, f64)
+LM2_BENCH_SWEEP(r3, 3, f32)
+LM2_BENCH_SWEEP(r3, 3, f64)
@@ -0,0 +1,114 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "bench_common.h"
+
+// =============================================================================
+// SoA Vector Stream Benchmarks
+// =============================================================================
+// Same batch size and inputs as bench_vectors.cpp, so BM_v3_soa_add_f32 can be
+// compared with BM_v3_add_f32 directly.
+
+namespace lm2_bench {
+
+  // Owns the component arrays of a 3D stream, filled from random AoS vectors
+  template <typename T>
+  struct soa3 {
+    std::vector<T> x, y, z;
+    soa3(size_t count, uint64_t seed) : x(count), y(count), z(count) {
+      auto aos = random_v3s<T>(count, -100.0, 100.0, seed);
+      for (size_t i = 0; i < count; i++) x[i] = aos[i].x, y[i] = aos[i].y, z[i] = aos[i].z;
+    }
+  };
+
+}  // namespace lm2_bench
+
+#define LM2_BENCH_SOA_BINARY(S, op)                                                         \
+  static void BM_v3_soa_##op##_##S(benchmark::State& state) {                               \
+    lm2_bench::soa3<lm2_bench_##S> sa(LM2_BENCH_BATCH, 1), sb(LM2_BENCH_BATCH, 2);          \
+    lm2_bench::soa3<lm2_bench_##S> so(LM2_BENCH_BATCH, 3);                                  \
+    auto a = lm2_v3_soa_make_##S(sa.x.data(), sa.y.data(), sa.z.data(), LM2_BENCH_BATCH);   \
+    auto b = lm2_v3_soa_make_##S(sb.x.data(), sb.y.data(), sb.z.data(), LM2_BENCH_BATCH);   \
+    auto out = lm2_v3_soa_make_##S(so.x.data(), so.y.data(), so.z.data(), LM2_BENCH_BATCH); \
+    for (auto _ : state) {                                                                  \
+      lm2_v3_soa_##op##_##S(a, b, out);                                                     \
+      benchmark::DoNotOptimize(so.x.data());                                                \
+      benchmark::ClobberMemory();                                                           \
+    }                                                                                       \
+    state.SetItemsProcessed(state.iterations() * LM2_BENCH_BATCH);                          \
+  }                                                                                         \
+  BENCHMARK(BM_v3_soa_##op##_##S);
+
+#define LM2_BENCH_SOA_SCALAR_OUT(S, op, ...)                                              \
+  static void BM_v3_soa_##op##_##S(benchmark::State& state) {                             \
+    lm2_bench::soa3<lm2_bench_##S> sa(LM2_BENCH_BATCH, 1), sb(LM2_BENCH_BATCH, 2);        \
+    auto a = lm2_v3_soa_make_##S(sa.x.data(), sa.y.data(), sa.z.data(), LM2_BENCH_BATCH); \
+    auto b = lm2_v3_soa_make_##S(sb.x.data(), sb.y.data(), sb.z.data(), LM2_BENCH_BATCH); \
+    std::vector<lm2_bench_##S> out(LM2_BENCH_BATCH);                                      \
+    (void)b;                                                                              \
+    for (auto _ : state) {                                                                \
+      lm2_v3_soa_##op##_##S(__VA_ARGS__, out.data());                                     \
+      benchmark::DoNotOptimize(out.data());                                               \
+      benchmark::ClobberMemory();                                                         \
+    }                                                                                     \
+    state.SetItemsProcessed(state.iterations() * LM2_BENCH_BATCH);                        \
+  }                                                                                       \
+  BENCHMARK(BM_v3_soa_##op##_##S);
+
+#define LM2_BENCH_SOA_ALL(S)                                                                \
+  LM2_BENCH_SOA_BINARY(S, add)                                                              \
+  LM2_BENCH_SOA_BINARY(S, mul)                                                              \
+  LM2_BENCH_SOA_BINARY(S, cross)                                                            \
+  LM2_BENCH_SOA_SCALAR_OUT(S, dot, a, b)                                                    \
+  LM2_BENCH_SOA_SCALAR_OUT(S, length, a)                                                    \
+  LM2_BENCH_SOA_SCALAR_OUT(S, distance, a, b)                                               \
+                                                                                            \
+  static void BM_v3_soa_norm_##S(benchmark::State& state) {                                 \
+    lm2_bench::soa3<lm2_bench_##S> sa(LM2_BENCH_BATCH, 1), so(LM2_BENCH_BATCH, 2);          \
+    auto a = lm2_v3_soa_make_##S(sa.x.data(), sa.y.data(), sa.z.data(), LM2_BENCH_BATCH);   \
+    auto out = lm2_v3_soa_make_##S(so.x.data(), so.y.data(), so.z.data(), LM2_BENCH_BATCH); \
+    for (auto _ : state) {                                                                  \
+      lm2_v3_soa_norm_##S(a, out);                                                          \
+      benchmark::DoNotOptimize(so.x.data());                                                \
+      benchmark::ClobberMemory();                                                           \
+    }                                                                                       \
+    state.SetItemsProcessed(state.iterations() * LM2_BENCH_BATCH);                          \
+  }                                                                                         \
+  BENCHMARK(BM_v3_soa_norm_##S);                                                            \
+                                                                                            \
+  static void BM_v3_soa_from_aos_##S(benchmark::State& state) {                             \
+    auto src = lm2_bench::random_v3s<lm2_bench_##S>(LM2_BENCH_BATCH, -100.0, 100.0, 1);     \
+    lm2_bench::soa3<lm2_bench_##S> so(LM2_BENCH_BATCH, 2);                                  \
+    auto out = lm2_v3_soa_make_##S(so.x.data(), so.y.data(), so.z.data(), LM2_BENCH_BATCH); \
+    for (auto _ : state) {                                                                  \
+      lm2_v3_soa_from_aos_##S(src.data(), out);                                             \
+      benchmark::DoNotOptimize(so.x.data());                                                \
+      benchmark::ClobberMemory();                                                           \
+    }                                                                                       \
+    state.SetItemsProcessed(state.iterations() * LM2_BENCH_BATCH);                          \
+  }                                                                                         \
+  BENCHMARK(BM_v3_soa_from_aos_##S);
+
+LM2_BENCH_SOA_ALL(f32)
+LM2_BENCH_SOA_ALL(f64)
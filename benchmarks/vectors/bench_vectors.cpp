@@ -0,0 +1,103 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "bench_common.h"
+
+// =============================================================================
+// Vector Benchmarks
+// =============================================================================
+// Binary and unary ops over a batch of LM2_BENCH_BATCH vectors per iteration.
+
+#define LM2_BENCH_VEC_BINARY(VEC, S, op)                                                   \
+  static void BM_##VEC##_##op##_##S(benchmark::State& state) {                             \
+    auto a = lm2_bench::random_##VEC##s<lm2_bench_##S>(LM2_BENCH_BATCH, -100.0, 100.0, 1); \
+    auto b = lm2_bench::random_##VEC##s<lm2_bench_##S>(LM2_BENCH_BATCH, -100.0, 100.0, 2); \
+    std::vector<decltype(lm2_##VEC##_##op##_##S(a[0], b[0]))> out(a.size());               \
+    for (auto _ : state) {                                                                 \
+      for (size_t i = 0; i < a.size(); i++) {                                              \
+        out[i] = lm2_##VEC##_##op##_##S(a[i], b[i]);                                       \
+      }                                                                                    \
+      benchmark::DoNotOptimize(out.data());                                                \
+      benchmark::ClobberMemory();                                                          \
+    }                                                                                      \
+    state.SetItemsProcessed(state.iterations() * LM2_BENCH_BATCH);                         \
+  }                                                                                        \
+  BENCHMARK(BM_##VEC##_##op##_##S);
+
+#define LM2_BENCH_VEC_UNARY(VEC, S, op)                                                    \
+  static void BM_##VEC##_##op##_##S(benchmark::State& state) {                             \
+    auto a = lm2_bench::random_##VEC##s<lm2_bench_##S>(LM2_BENCH_BATCH, -100.0, 100.0, 1); \
+    std::vector<decltype(lm2_##VEC##_##op##_##S(a[0]))> out(a.size());                     \
+    for (auto _ : state) {                                                                 \
+      for (size_t i = 0; i < a.size(); i++) {                                              \
+        out[i] = lm2_##VEC##_##op##_##S(a[i]);                                             \
+      }                                                                                    \
+      benchmark::DoNotOptimize(out.data());                                                \
+      benchmark::ClobberMemory();                                                          \
+    }                                                                                      \
+    state.SetItemsProcessed(state.iterations() * LM2_BENCH_BATCH);                         \
+  }                                                                                        \
+  BENCHMARK(BM_##VEC##_##op##_##S);
+
+#define LM2_BENCH_VEC_LERP(VEC, S)                                                         \
+  static void BM_##VEC##_lerp_##S(benchmark::State& state) {                               \
+    auto a = lm2_bench::random_##VEC##s<lm2_bench_##S>(LM2_BENCH_BATCH, -100.0, 100.0, 1); \
+    auto b = lm2_bench::random_##VEC##s<lm2_bench_##S>(LM2_BENCH_BATCH, -100.0, 100.0, 2); \
+    auto t = lm2_bench::random_##VEC##s<lm2_bench_##S>(LM2_BENCH_BATCH, 0.0, 1.0, 3);      \
+    std::vector<typename decltype(a)::value_type> out(a.size());                           \
+    for (auto _ : state) {                                                                 \
+      for (size_t i = 0; i < a.size(); i++) {                                              \
+        out[i] = lm2_##VEC##_lerp_##S(a[i], t[i], b[i]);                                   \
+      }                                                                                    \
+      benchmark::DoNotOptimize(out.data());                                                \
+      benchmark::ClobberMemory();                                                          \
+    }                                                                                      \
+    state.SetItemsProcessed(state.iterations() * LM2_BENCH_BATCH);                         \
+  }                                                                                        \
+  BENCHMARK(BM_##VEC##_lerp_##S);
+
+#define LM2_BENCH_VEC_ALL(VEC, S)        \
+  LM2_BENCH_VEC_BINARY(VEC, S, add)      \
+  LM2_BENCH_VEC_BINARY(VEC, S, mul)      \
+  LM2_BENCH_VEC_BINARY(VEC, S, div)      \
+  LM2_BENCH_VEC_BINARY(VEC, S, min)      \
+  LM2_BENCH_VEC_BINARY(VEC, S, dot)      \
+  LM2_BENCH_VEC_BINARY(VEC, S, distance) \
+  LM2_BENCH_VEC_UNARY(VEC, S, length)    \
+  LM2_BENCH_VEC_UNARY(VEC, S, norm)      \
+  LM2_BENCH_VEC_LERP(VEC, S)
+
+LM2_BENCH_VEC_ALL(v2, f32)
+LM2_BENCH_VEC_ALL(v2, f64)
+LM2_BENCH_VEC_ALL(v3, f32)
+LM2_BENCH_VEC_ALL(v3, f64)
+LM2_BENCH_VEC_ALL(v4, f32)
+LM2_BENCH_VEC_ALL(v4, f64)
+
+LM2_BENCH_VEC_BINARY(v3, f32, cross)
+LM2_BENCH_VEC_BINARY(v3, f64, cross)
+LM2_BENCH_VEC_BINARY(v2, f32, reflect)
+LM2_BENCH_VEC_BINARY(v2, f64, reflect)
+LM2_BENCH_VEC_BINARY(v3, f32, reflect)
+LM2_BENCH_VEC_BINARY(v3, f64, reflect)
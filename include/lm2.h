@@ -29,27 +29,42 @@ SOFTWARE.
 // - LM2_NO_CPP_OPERATORS: Disable C++ operators for all types (for C compatibility)
 // - LM2_NO_GENERICS: Disable C11 or C++ generics
 // - LM2_ENABLE_UNPREFIXED_NAMES: Enable unprefixed names (e.g. v2 instead of lm2_v2)
+// - LM2_INLINE_IMPLEMENTATION: Define the hot modules as static inline in the headers
 
 #include "lm2/camera/lm2_camera2.h"
 #include "lm2/camera/lm2_camera3.h"
+#include "lm2/camera/lm2_camera3_rays.h"
+#include "lm2/camera/lm2_camera3_state.h"
 #include "lm2/geometry2d/lm2_aabb2.h"
+#include "lm2/geometry2d/lm2_broadphase2.h"
 #include "lm2/geometry2d/lm2_capsule2.h"
 #include "lm2/geometry2d/lm2_circle.h"
+#include "lm2/geometry2d/lm2_convex_hull2.h"
 #include "lm2/geometry2d/lm2_edge2.h"
 #include "lm2/geometry2d/lm2_manifold2.h"
+#include "lm2/geometry2d/lm2_narrowphase2.h"
 #include "lm2/geometry2d/lm2_plane2.h"
 #include "lm2/geometry2d/lm2_polygon.h"
 #include "lm2/geometry2d/lm2_raycast2.h"
+#include "lm2/geometry2d/lm2_sat2.h"
 #include "lm2/geometry2d/lm2_shape2.h"
+#include "lm2/geometry2d/lm2_toi2.h"
 #include "lm2/geometry2d/lm2_triangle2.h"
 #include "lm2/geometry2d/lm2_triangle2_geometry.h"
 #include "lm2/geometry3d/lm2_aabb3.h"
+#include "lm2/geometry3d/lm2_bvh3.h"
 #include "lm2/geometry3d/lm2_capsule3.h"
+#include "lm2/geometry3d/lm2_convex_hull3.h"
 #include "lm2/geometry3d/lm2_edge3.h"
+#include "lm2/geometry3d/lm2_frustum3.h"
+#include "lm2/geometry3d/lm2_manifold3.h"
+#include "lm2/geometry3d/lm2_mesh_optimize.h"
 #include "lm2/geometry3d/lm2_plane3.h"
+#include "lm2/geometry3d/lm2_ray3_packet.h"
 #include "lm2/geometry3d/lm2_raycast3.h"
 #include "lm2/geometry3d/lm2_shape3.h"
 #include "lm2/geometry3d/lm2_sphere.h"
+#include "lm2/geometry3d/lm2_sweep3.h"
 #include "lm2/geometry3d/lm2_triangle3.h"
 #include "lm2/geometry3d/lm2_triangle3_geometry.h"
 #include "lm2/lm2_base.h"
@@ -57,6 +72,7 @@ SOFTWARE.
 #include "lm2/matrices/lm2_matrix3x2.h"
 #include "lm2/matrices/lm2_matrix3x3.h"
 #include "lm2/matrices/lm2_matrix4x4.h"
+#include "lm2/misc/lm2_allocator.h"
 #include "lm2/misc/lm2_bezier_curves.h"
 #include "lm2/misc/lm2_easings.h"
 #include "lm2/misc/lm2_hash.h"
@@ -66,6 +82,7 @@ SOFTWARE.
 #include "lm2/ranges/lm2_range3.h"
 #include "lm2/ranges/lm2_range4.h"
 #include "lm2/ranges/lm2_range_conversions.h"
+#include "lm2/ranges/lm2_range_sweep.h"
 #include "lm2/scalar/lm2_safe_ops.h"
 #include "lm2/scalar/lm2_scalar.h"
 #include "lm2/scalar/lm2_trigonometry.h"
@@ -73,6 +90,7 @@ SOFTWARE.
 #include "lm2/vectors/lm2_vector3.h"
 #include "lm2/vectors/lm2_vector4.h"
 #include "lm2/vectors/lm2_vector_conversions.h"
+#include "lm2/vectors/lm2_vector_soa.h"
 #include "lm2/vectors/lm2_vector_specifics.h"
 
 #ifndef LM2_NO_GENERICS
@@ -0,0 +1,148 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include "lm2/camera/lm2_camera3.h"
+#include "lm2/geometry3d/lm2_ray3_packet.h"
+#include "lm2/geometry3d/lm2_raycast3.h"
+#include "lm2/lm2_base.h"
+#include "lm2/vectors/lm2_vector3.h"
+#include "lm2/vectors/lm2_vector_soa.h"
+
+// #############################################################################
+LM2_HEADER_BEGIN;
+// #############################################################################
+
+// =============================================================================
+// Camera 3D Primary Rays
+// =============================================================================
+// Generates one ray per pixel of a width x height viewport over the camera's
+// view volume. lm2_camera3_ndc_to_world inverts the view-projection matrix on
+// every call; the ray generator derives the ray through the top-left corner
+// of the viewport and its change per pixel once, after which the origin and
+// direction of any pixel are base + px * dx + py * dy, evaluated a SIMD
+// vector of pixels at a time.
+//
+// Conventions:
+//   - Pixel (0, 0) is the top-left pixel, x grows to the right, y downwards
+//   - Pixel coordinates are continuous: pixel (px, py) covers
+//     [px, px + 1) x [py, py + 1) and its center is (px + 0.5, py + 0.5)
+//   - The viewport spans the camera's whole view volume; camera.aspect is
+//     used as is, so it should match width / height for square pixels
+//   - Directions are normalized. Perspective rays start at the eye,
+//     orthographic rays on the plane through the eye; t_max reaches the far
+//     plane, so t measures world-space distance from the origin
+//
+// With jitter set, each pixel's sample moves from its center to a position
+// hashed from the pixel and the seed, uniform over the pixel. Changing the
+// seed between passes accumulates anti-aliased images; the same seed always
+// gives the same rays.
+
+// =============================================================================
+// Camera3 Ray Generator Types - f64
+// =============================================================================
+
+typedef struct lm2_camera3_raygen_f64 {
+  lm2_v3_f64 origin;        // Ray origin at pixel coordinate (0, 0)
+  lm2_v3_f64 origin_dx;     // Origin change per pixel to the right
+  lm2_v3_f64 origin_dy;     // Origin change per pixel downwards
+  lm2_v3_f64 direction;     // Unnormalized direction at pixel coordinate (0, 0)
+  lm2_v3_f64 direction_dx;  // Direction change per pixel to the right
+  lm2_v3_f64 direction_dy;  // Direction change per pixel downwards
+  double far_plane;         // Far clipping distance along the view axis
+  uint32_t width;           // Viewport width in pixels
+  uint32_t height;          // Viewport height in pixels
+  bool jitter;              // Sample at hashed sub-pixel positions instead of pixel centers
+  uint32_t seed;            // Jitter seed, change it per pass
+} lm2_camera3_raygen_f64;
+
+// =============================================================================
+// Camera3 Ray Generator Functions - f64
+// =============================================================================
+
+// Construction, without jitter
+LM2_API lm2_camera3_raygen_f64 lm2_camera3_raygen_make_f64(lm2_camera3_f64 camera, uint32_t width, uint32_t height);
+
+// Ray through a continuous pixel coordinate, e.g. a mouse position. Ignores jitter
+LM2_API lm2_ray3_f64 lm2_camera3_raygen_ray_f64(const lm2_camera3_raygen_f64* raygen, double px, double py);
+
+// Rays of the w x h pixel tile at (x, y), row by row: the ray of pixel
+// (x + i, y + j) goes to index j * w + i. origins and directions need room
+// for w * h rays; t_max may be NULL
+LM2_API void lm2_camera3_raygen_tile_f64(const lm2_camera3_raygen_f64* raygen, uint32_t x, uint32_t y, uint32_t w, uint32_t h, lm2_v3_soa_f64 origins, lm2_v3_soa_f64 directions, double* t_max);
+
+// Rays of the same tile as packets of 2 x 2 (packet4) or 4 x 2 (packet8)
+// pixels, lane k at (k % 2, k / 2) or (k % 4, k / 4) within its block.
+// Packets go row by row over the blocks; lanes past the tile's right or
+// bottom edge are inactive. Returns the packet count,
+// ceil(w / 2) * ceil(h / 2) or ceil(w / 4) * ceil(h / 2)
+LM2_API size_t lm2_camera3_raygen_packets4_f64(const lm2_camera3_raygen_f64* raygen, uint32_t x, uint32_t y, uint32_t w, uint32_t h, lm2_ray3_packet4_f64* out);
+LM2_API size_t lm2_camera3_raygen_packets8_f64(const lm2_camera3_raygen_f64* raygen, uint32_t x, uint32_t y, uint32_t w, uint32_t h, lm2_ray3_packet8_f64* out);
+
+// =============================================================================
+// Camera3 Ray Generator Types - f32
+// =============================================================================
+
+typedef struct lm2_camera3_raygen_f32 {
+  lm2_v3_f32 origin;        // Ray origin at pixel coordinate (0, 0)
+  lm2_v3_f32 origin_dx;     // Origin change per pixel to the right
+  lm2_v3_f32 origin_dy;     // Origin change per pixel downwards
+  lm2_v3_f32 direction;     // Unnormalized direction at pixel coordinate (0, 0)
+  lm2_v3_f32 direction_dx;  // Direction change per pixel to the right
+  lm2_v3_f32 direction_dy;  // Direction change per pixel downwards
+  float far_plane;          // Far clipping distance along the view axis
+  uint32_t width;           // Viewport width in pixels
+  uint32_t height;          // Viewport height in pixels
+  bool jitter;              // Sample at hashed sub-pixel positions instead of pixel centers
+  uint32_t seed;            // Jitter seed, change it per pass
+} lm2_camera3_raygen_f32;
+
+// =============================================================================
+// Camera3 Ray Generator Functions - f32
+// =============================================================================
+
+// Construction, without jitter
+LM2_API lm2_camera3_raygen_f32 lm2_camera3_raygen_make_f32(lm2_camera3_f32 camera, uint32_t width, uint32_t height);
+
+// Ray through a continuous pixel coordinate, e.g. a mouse position. Ignores jitter
+LM2_API lm2_ray3_f32 lm2_camera3_raygen_ray_f32(const lm2_camera3_raygen_f32* raygen, float px, float py);
+
+// Rays of the w x h pixel tile at (x, y), row by row: the ray of pixel
+// (x + i, y + j) goes to index j * w + i. origins and directions need room
+// for w * h rays; t_max may be NULL
+LM2_API void lm2_camera3_raygen_tile_f32(const lm2_camera3_raygen_f32* raygen, uint32_t x, uint32_t y, uint32_t w, uint32_t h, lm2_v3_soa_f32 origins, lm2_v3_soa_f32 directions, float* t_max);
+
+// Rays of the same tile as packets of 2 x 2 (packet4) or 4 x 2 (packet8)
+// pixels, lane k at (k % 2, k / 2) or (k % 4, k / 4) within its block.
+// Packets go row by row over the blocks; lanes past the tile's right or
+// bottom edge are inactive. Returns the packet count,
+// ceil(w / 2) * ceil(h / 2) or ceil(w / 4) * ceil(h / 2)
+LM2_API size_t lm2_camera3_raygen_packets4_f32(const lm2_camera3_raygen_f32* raygen, uint32_t x, uint32_t y, uint32_t w, uint32_t h, lm2_ray3_packet4_f32* out);
+LM2_API size_t lm2_camera3_raygen_packets8_f32(const lm2_camera3_raygen_f32* raygen, uint32_t x, uint32_t y, uint32_t w, uint32_t h, lm2_ray3_packet8_f32* out);
+
+// #############################################################################
+LM2_HEADER_END;
+// #############################################################################
@@ -0,0 +1,151 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include "lm2/camera/lm2_camera3.h"
+#include "lm2/geometry3d/lm2_frustum3.h"
+#include "lm2/lm2_base.h"
+#include "lm2/matrices/lm2_matrix4x4.h"
+#include "lm2/misc/lm2_quaternion.h"
+#include "lm2/vectors/lm2_vector3.h"
+
+// #############################################################################
+LM2_HEADER_BEGIN;
+// #############################################################################
+
+// =============================================================================
+// Camera 3D State
+// =============================================================================
+// An lm2_camera3 together with its view, projection and view-projection
+// matrices, their inverses and its frustum. The lm2_camera3 getters rebuild
+// these on every call; the state computes each one on first use after the
+// camera changed and returns the cached copy until the next change.
+//
+// Change the camera only through the state functions, which record what went
+// out of date: moving or turning the camera invalidates the view and
+// everything derived from it, changing the aspect or FOV the projection.
+// Reading the cache goes through a mutable pointer because it may fill it.
+// A state is not safe to read from several threads while it is out of date.
+
+// =============================================================================
+// Camera3 State Types - f64
+// =============================================================================
+
+typedef struct lm2_camera3_state_f64 {
+  lm2_camera3_f64 camera;            // Current camera, change it through the state functions
+  lm2_m4x4_f64 view;                 // World to view space
+  lm2_m4x4_f64 projection;           // View to clip space
+  lm2_m4x4_f64 view_projection;      // World to clip space
+  lm2_m4x4_f64 inv_view;             // View to world space
+  lm2_m4x4_f64 inv_view_projection;  // Clip to world space
+  lm2_frustum3_f64 frustum;          // World-space frustum planes
+  uint32_t dirty;                    // Cached values that are out of date
+} lm2_camera3_state_f64;
+
+// =============================================================================
+// Camera3 State Functions - f64
+// =============================================================================
+
+// Construction
+LM2_API lm2_camera3_state_f64 lm2_camera3_state_make_f64(lm2_camera3_f64 camera);
+LM2_API void lm2_camera3_state_set_camera_f64(lm2_camera3_state_f64* state, lm2_camera3_f64 camera);
+
+// Camera manipulation, same as the lm2_camera3 functions of the same name
+LM2_API void lm2_camera3_state_move_f64(lm2_camera3_state_f64* state, lm2_v3_f64 delta);
+LM2_API void lm2_camera3_state_look_at_f64(lm2_camera3_state_f64* state, lm2_v3_f64 target);
+LM2_API void lm2_camera3_state_orbit_f64(lm2_camera3_state_f64* state, double yaw, double pitch);
+LM2_API void lm2_camera3_state_set_aspect_f64(lm2_camera3_state_f64* state, double aspect);
+LM2_API void lm2_camera3_state_set_fov_y_f64(lm2_camera3_state_f64* state, double fov_y);
+LM2_API void lm2_camera3_state_set_orientation_f64(lm2_camera3_state_f64* state, lm2_quat_f64 orientation);
+LM2_API void lm2_camera3_state_rotate_local_f64(lm2_camera3_state_f64* state, lm2_quat_f64 rotation);
+
+// Cached matrices and frustum, recomputed on first use after a change
+LM2_API lm2_m4x4_f64 lm2_camera3_state_get_view_f64(lm2_camera3_state_f64* state);
+LM2_API lm2_m4x4_f64 lm2_camera3_state_get_projection_f64(lm2_camera3_state_f64* state);
+LM2_API lm2_m4x4_f64 lm2_camera3_state_get_view_projection_f64(lm2_camera3_state_f64* state);
+LM2_API lm2_m4x4_f64 lm2_camera3_state_get_inv_view_f64(lm2_camera3_state_f64* state);
+LM2_API lm2_m4x4_f64 lm2_camera3_state_get_inv_view_projection_f64(lm2_camera3_state_f64* state);
+LM2_API lm2_frustum3_f64 lm2_camera3_state_get_frustum_f64(lm2_camera3_state_f64* state);
+
+// Space transforms
+LM2_API lm2_v3_f64 lm2_camera3_state_world_to_ndc_f64(lm2_camera3_state_f64* state, lm2_v3_f64 world_pos);
+LM2_API lm2_v3_f64 lm2_camera3_state_ndc_to_world_f64(lm2_camera3_state_f64* state, lm2_v3_f64 ndc_pos);
+
+// Batch space transforms, through lm2_m4x4_transform_points_src_dst (src and dst may alias)
+LM2_API void lm2_camera3_state_world_to_ndc_array_f64(lm2_camera3_state_f64* state, const lm2_v3_f64* world_pos, lm2_v3_f64* ndc_pos, uint32_t count);
+LM2_API void lm2_camera3_state_ndc_to_world_array_f64(lm2_camera3_state_f64* state, const lm2_v3_f64* ndc_pos, lm2_v3_f64* world_pos, uint32_t count);
+
+// =============================================================================
+// Camera3 State Types - f32
+// =============================================================================
+
+typedef struct lm2_camera3_state_f32 {
+  lm2_camera3_f32 camera;            // Current camera, change it through the state functions
+  lm2_m4x4_f32 view;                 // World to view space
+  lm2_m4x4_f32 projection;           // View to clip space
+  lm2_m4x4_f32 view_projection;      // World to clip space
+  lm2_m4x4_f32 inv_view;             // View to world space
+  lm2_m4x4_f32 inv_view_projection;  // Clip to world space
+  lm2_frustum3_f32 frustum;          // World-space frustum planes
+  uint32_t dirty;                    // Cached values that are out of date
+} lm2_camera3_state_f32;
+
+// =============================================================================
+// Camera3 State Functions - f32
+// =============================================================================
+
+// Construction
+LM2_API lm2_camera3_state_f32 lm2_camera3_state_make_f32(lm2_camera3_f32 camera);
+LM2_API void lm2_camera3_state_set_camera_f32(lm2_camera3_state_f32* state, lm2_camera3_f32 camera);
+
+// Camera manipulation, same as the lm2_camera3 functions of the same name
+LM2_API void lm2_camera3_state_move_f32(lm2_camera3_state_f32* state, lm2_v3_f32 delta);
+LM2_API void lm2_camera3_state_look_at_f32(lm2_camera3_state_f32* state, lm2_v3_f32 target);
+LM2_API void lm2_camera3_state_orbit_f32(lm2_camera3_state_f32* state, float yaw, float pitch);
+LM2_API void lm2_camera3_state_set_aspect_f32(lm2_camera3_state_f32* state, float aspect);
+LM2_API void lm2_camera3_state_set_fov_y_f32(lm2_camera3_state_f32* state, float fov_y);
+LM2_API void lm2_camera3_state_set_orientation_f32(lm2_camera3_state_f32* state, lm2_quat_f32 orientation);
+LM2_API void lm2_camera3_state_rotate_local_f32(lm2_camera3_state_f32* state, lm2_quat_f32 rotation);
+
+// Cached matrices and frustum, recomputed on first use after a change
+LM2_API lm2_m4x4_f32 lm2_camera3_state_get_view_f32(lm2_camera3_state_f32* state);
+LM2_API lm2_m4x4_f32 lm2_camera3_state_get_projection_f32(lm2_camera3_state_f32* state);
+LM2_API lm2_m4x4_f32 lm2_camera3_state_get_view_projection_f32(lm2_camera3_state_f32* state);
+LM2_API lm2_m4x4_f32 lm2_camera3_state_get_inv_view_f32(lm2_camera3_state_f32* state);
+LM2_API lm2_m4x4_f32 lm2_camera3_state_get_inv_view_projection_f32(lm2_camera3_state_f32* state);
+LM2_API lm2_frustum3_f32 lm2_camera3_state_get_frustum_f32(lm2_camera3_state_f32* state);
+
+// Space transforms
+LM2_API lm2_v3_f32 lm2_camera3_state_world_to_ndc_f32(lm2_camera3_state_f32* state, lm2_v3_f32 world_pos);
+LM2_API lm2_v3_f32 lm2_camera3_state_ndc_to_world_f32(lm2_camera3_state_f32* state, lm2_v3_f32 ndc_pos);
+
+// Batch space transforms, through lm2_m4x4_transform_points_src_dst (src and dst may alias)
+LM2_API void lm2_camera3_state_world_to_ndc_array_f32(lm2_camera3_state_f32* state, const lm2_v3_f32* world_pos, lm2_v3_f32* ndc_pos, uint32_t count);
+LM2_API void lm2_camera3_state_ndc_to_world_array_f32(lm2_camera3_state_f32* state, const lm2_v3_f32* ndc_pos, lm2_v3_f32* world_pos, uint32_t count);
+
+// #############################################################################
+LM2_HEADER_END;
+// #############################################################################
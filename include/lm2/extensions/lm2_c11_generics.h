@@ -422,7 +422,7 @@ SOFTWARE.
 #  define lm2_v3_mul_s(a, b) \
     _Generic((a), lm2_v3_f64: lm2_v3_mul_s_f64, lm2_v3_f32: lm2_v3_mul_s_f32, lm2_v3_i64: lm2_v3_mul_s_i64, lm2_v3_i32: lm2_v3_mul_s_i32, lm2_v3_i16: lm2_v3_mul_s_i16, lm2_v3_i8: lm2_v3_mul_s_i8, lm2_v3_u64: lm2_v3_mul_s_u64, lm2_v3_u32: lm2_v3_mul_s_u32, lm2_v3_u16: lm2_v3_mul_s_u16, lm2_v3_u8: lm2_v3_mul_s_u8)(a, b)
 #  define lm2_v3_neg(a) \
-    _Generic((a), lm2_v3_f64: lm2_v3_neg_f64, lm2_v3_f32: lm2_v3_neg_f32, lm2_v3_i64: lm2_v3_neg_i64, lm2_v3_i32: lm2_v3_neg_i32, lm2_v3_i16: lm2_v3_neg_i16, lm2_v3_i8: lm2_v3_neg_i8, lm2_v3_u64: lm2_v3_neg_u64)(a)
+    _Generic((a), lm2_v3_f64: lm2_v3_neg_f64, lm2_v3_f32: lm2_v3_neg_f32, lm2_v3_i64: lm2_v3_neg_i64, lm2_v3_i32: lm2_v3_neg_i32, lm2_v3_i16: lm2_v3_neg_i16, lm2_v3_i8: lm2_v3_neg_i8)(a)
 #  define lm2_v3_norm(v) \
     _Generic((v), lm2_v3_f64: lm2_v3_norm_f64, lm2_v3_f32: lm2_v3_norm_f32)(v)
 #  define lm2_v3_pow(a, b) \
@@ -532,7 +532,7 @@ SOFTWARE.
 #  define lm2_v4_mul_s(a, b) \
     _Generic((a), lm2_v4_f64: lm2_v4_mul_s_f64, lm2_v4_f32: lm2_v4_mul_s_f32, lm2_v4_i64: lm2_v4_mul_s_i64, lm2_v4_i32: lm2_v4_mul_s_i32, lm2_v4_i16: lm2_v4_mul_s_i16, lm2_v4_i8: lm2_v4_mul_s_i8, lm2_v4_u64: lm2_v4_mul_s_u64, lm2_v4_u32: lm2_v4_mul_s_u32, lm2_v4_u16: lm2_v4_mul_s_u16, lm2_v4_u8: lm2_v4_mul_s_u8)(a, b)
 #  define lm2_v4_neg(a) \
-    _Generic((a), lm2_v4_f64: lm2_v4_neg_f64, lm2_v4_f32: lm2_v4_neg_f32, lm2_v4_i64: lm2_v4_neg_i64, lm2_v4_i32: lm2_v4_neg_i32, lm2_v4_i16: lm2_v4_neg_i16, lm2_v4_i8: lm2_v4_neg_i8, lm2_v4_u32: lm2_v4_neg_u32, lm2_v4_u8: lm2_v4_neg_u8)(a)
+    _Generic((a), lm2_v4_f64: lm2_v4_neg_f64, lm2_v4_f32: lm2_v4_neg_f32, lm2_v4_i64: lm2_v4_neg_i64, lm2_v4_i32: lm2_v4_neg_i32, lm2_v4_i16: lm2_v4_neg_i16, lm2_v4_i8: lm2_v4_neg_i8)(a)
 #  define lm2_v4_norm(v) \
     _Generic((v), lm2_v4_f64: lm2_v4_norm_f64, lm2_v4_f32: lm2_v4_norm_f32)(v)
 #  define lm2_v4_pow(a, b) \
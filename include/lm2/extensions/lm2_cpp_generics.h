@@ -1911,8 +1911,6 @@ static inline auto lm2_v3_neg(A a) {
     return lm2_v3_neg_i16(a);
   else if constexpr (std::is_same_v<A, lm2_v3_i8>)
     return lm2_v3_neg_i8(a);
-  else if constexpr (std::is_same_v<A, lm2_v3_u64>)
-    return lm2_v3_neg_u64(a);
   else
     static_assert(sizeof(A) == 0, "Unsupported type");
 }
@@ -2941,10 +2939,6 @@ static inline auto lm2_v4_neg(A a) {
     return lm2_v4_neg_i16(a);
   else if constexpr (std::is_same_v<A, lm2_v4_i8>)
     return lm2_v4_neg_i8(a);
-  else if constexpr (std::is_same_v<A, lm2_v4_u32>)
-    return lm2_v4_neg_u32(a);
-  else if constexpr (std::is_same_v<A, lm2_v4_u8>)
-    return lm2_v4_neg_u8(a);
   else
     static_assert(sizeof(A) == 0, "Unsupported type");
 }
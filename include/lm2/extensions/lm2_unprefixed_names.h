@@ -290,6 +290,12 @@ SOFTWARE.
 #define hash_fnv1a_u64                          lm2_hash_fnv1a_u64
 #define hash_combine_u32                        lm2_hash_combine_u32
 #define hash_combine_u64                        lm2_hash_combine_u64
+#define arena_make                              lm2_arena_make
+#define arena_destroy                           lm2_arena_destroy
+#define arena_alloc                             lm2_arena_alloc
+#define arena_mark                              lm2_arena_mark
+#define arena_reset                             lm2_arena_reset
+#define arena_thread_default                    lm2_arena_thread_default
 #define perlin2_f64                             lm2_perlin2_f64
 #define perlin2_f32                             lm2_perlin2_f32
 #define perlin3_f64                             lm2_perlin3_f64
@@ -745,7 +751,6 @@ SOFTWARE.
 #define v3_sub_s_u64                            lm2_v3_sub_s_u64
 #define v3_mul_s_u64                            lm2_v3_mul_s_u64
 #define v3_div_s_u64                            lm2_v3_div_s_u64
-#define v3_neg_u64                              lm2_v3_neg_u64
 #define v3_mod_u64                              lm2_v3_mod_u64
 #define v3_min_u64                              lm2_v3_min_u64
 #define v3_max_u64                              lm2_v3_max_u64
@@ -987,7 +992,6 @@ SOFTWARE.
 #define v4_sub_s_u32                            lm2_v4_sub_s_u32
 #define v4_mul_s_u32                            lm2_v4_mul_s_u32
 #define v4_div_s_u32                            lm2_v4_div_s_u32
-#define v4_neg_u32                              lm2_v4_neg_u32
 #define v4_mod_u32                              lm2_v4_mod_u32
 #define v4_min_u32                              lm2_v4_min_u32
 #define v4_max_u32                              lm2_v4_max_u32
@@ -1018,7 +1022,6 @@ SOFTWARE.
 #define v4_sub_s_u8                             lm2_v4_sub_s_u8
 #define v4_mul_s_u8                             lm2_v4_mul_s_u8
 #define v4_div_s_u8                             lm2_v4_div_s_u8
-#define v4_neg_u8                               lm2_v4_neg_u8
 #define v4_mod_u8                               lm2_v4_mod_u8
 #define v4_min_u8                               lm2_v4_min_u8
 #define v4_max_u8                               lm2_v4_max_u8
@@ -1693,6 +1696,8 @@ SOFTWARE.
 #define edge2                                   lm2_edge2
 #define edge2_f32                               lm2_edge2_f32
 #define edge2_f64                               lm2_edge2_f64
+#define edge2_find_intersections_f32            lm2_edge2_find_intersections_f32
+#define edge2_find_intersections_f64            lm2_edge2_find_intersections_f64
 #define edge2_from_plane_f32                    lm2_edge2_from_plane_f32
 #define edge2_from_plane_f64                    lm2_edge2_from_plane_f64
 #define edge2_from_ray_f32                      lm2_edge2_from_ray_f32
@@ -1705,6 +1710,8 @@ SOFTWARE.
 #define edge2_make_coords_f64                   lm2_edge2_make_coords_f64
 #define edge2_make_f32                          lm2_edge2_make_f32
 #define edge2_make_f64                          lm2_edge2_make_f64
+#define edge2_intersection_f32                  lm2_edge2_intersection_f32
+#define edge2_intersection_f64                  lm2_edge2_intersection_f64
 #define edge2_result                            lm2_edge2_result
 #define edge2_result_f32                        lm2_edge2_result_f32
 #define edge2_result_f64                        lm2_edge2_result_f64
@@ -1863,6 +1870,7 @@ SOFTWARE.
 #define polygon_make_triangle_f32               lm2_polygon_make_triangle_f32
 #define polygon_make_triangle_f64               lm2_polygon_make_triangle_f64
 #define polygon_max_triangle_count              lm2_polygon_max_triangle_count
+#define polygon_max_triangle_count_with_holes   lm2_polygon_max_triangle_count_with_holes
 #define polygon_perimeter_f32                   lm2_polygon_perimeter_f32
 #define polygon_perimeter_f64                   lm2_polygon_perimeter_f64
 #define polygon_place_at_center_f32             lm2_polygon_place_at_center_f32
@@ -1883,16 +1891,32 @@ SOFTWARE.
 #define polygon_translate_f64                   lm2_polygon_translate_f64
 #define polygon_triangulate_ear_clipping_f32    lm2_polygon_triangulate_ear_clipping_f32
 #define polygon_triangulate_ear_clipping_f64    lm2_polygon_triangulate_ear_clipping_f64
+#define polygon_triangulate_ear_clipping_scratch_f32 lm2_polygon_triangulate_ear_clipping_scratch_f32
+#define polygon_triangulate_ear_clipping_scratch_f64 lm2_polygon_triangulate_ear_clipping_scratch_f64
+#define polygon_triangulate_f32                 lm2_polygon_triangulate_f32
+#define polygon_triangulate_f64                 lm2_polygon_triangulate_f64
+#define polygon_triangulate_scratch_size_f32    lm2_polygon_triangulate_scratch_size_f32
+#define polygon_triangulate_scratch_size_f64    lm2_polygon_triangulate_scratch_size_f64
 #define polygon_validate_f32                    lm2_polygon_validate_f32
 #define polygon_validate_f64                    lm2_polygon_validate_f64
 #define polygon_winding_order_f32               lm2_polygon_winding_order_f32
 #define polygon_winding_order_f64               lm2_polygon_winding_order_f64
 #define make_convex_polygon_f32                 lm2_make_convex_polygon_f32
 #define make_convex_polygon_f64                 lm2_make_convex_polygon_f64
+#define make_convex_polygon_scratch_f32         lm2_make_convex_polygon_scratch_f32
+#define make_convex_polygon_scratch_f64         lm2_make_convex_polygon_scratch_f64
 #define compute_normals_f32                     lm2_compute_normals_f32
 #define compute_normals_f64                     lm2_compute_normals_f64
 #define convex_hull_f32                         lm2_convex_hull_f32
 #define convex_hull_f64                         lm2_convex_hull_f64
+#define convex_hull_scratch_f32                 lm2_convex_hull_scratch_f32
+#define convex_hull_scratch_f64                 lm2_convex_hull_scratch_f64
+#define convex_hull2_f32                        lm2_convex_hull2_f32
+#define convex_hull2_f64                        lm2_convex_hull2_f64
+#define convex_hull2_scratch_f32                lm2_convex_hull2_scratch_f32
+#define convex_hull2_scratch_f64                lm2_convex_hull2_scratch_f64
+#define convex_hull3_f32                        lm2_convex_hull3_f32
+#define convex_hull3_f64                        lm2_convex_hull3_f64
 #define winding_order                           lm2_winding_order
 #define ray2                                    lm2_ray2
 #define ray2_f32                                lm2_ray2_f32
@@ -1977,6 +2001,10 @@ SOFTWARE.
 #define triangle2_list_to_indexed_mesh_f64      lm2_triangle2_list_to_indexed_mesh_f64
 #define triangle2_list_to_indexed_mesh_size_f32 lm2_triangle2_list_to_indexed_mesh_size_f32
 #define triangle2_list_to_indexed_mesh_size_f64 lm2_triangle2_list_to_indexed_mesh_size_f64
+#define triangle2_list_to_indexed_mesh_scratch_f32 lm2_triangle2_list_to_indexed_mesh_scratch_f32
+#define triangle2_list_to_indexed_mesh_scratch_f64 lm2_triangle2_list_to_indexed_mesh_scratch_f64
+#define triangle2_list_to_indexed_mesh_size_scratch_f32 lm2_triangle2_list_to_indexed_mesh_size_scratch_f32
+#define triangle2_list_to_indexed_mesh_size_scratch_f64 lm2_triangle2_list_to_indexed_mesh_size_scratch_f64
 #define triangle2_list_to_vertex_array_f32      lm2_triangle2_list_to_vertex_array_f32
 #define triangle2_list_to_vertex_array_f64      lm2_triangle2_list_to_vertex_array_f64
 #define triangle2_list_to_vertex_array_size_f32 lm2_triangle2_list_to_vertex_array_size_f32
@@ -2244,6 +2272,10 @@ SOFTWARE.
 #define triangle3_list_to_indexed_mesh_f64      lm2_triangle3_list_to_indexed_mesh_f64
 #define triangle3_list_to_indexed_mesh_size_f32 lm2_triangle3_list_to_indexed_mesh_size_f32
 #define triangle3_list_to_indexed_mesh_size_f64 lm2_triangle3_list_to_indexed_mesh_size_f64
+#define triangle3_list_to_indexed_mesh_scratch_f32 lm2_triangle3_list_to_indexed_mesh_scratch_f32
+#define triangle3_list_to_indexed_mesh_scratch_f64 lm2_triangle3_list_to_indexed_mesh_scratch_f64
+#define triangle3_list_to_indexed_mesh_size_scratch_f32 lm2_triangle3_list_to_indexed_mesh_size_scratch_f32
+#define triangle3_list_to_indexed_mesh_size_scratch_f64 lm2_triangle3_list_to_indexed_mesh_size_scratch_f64
 #define triangle3_list_to_vertex_array_f32      lm2_triangle3_list_to_vertex_array_f32
 #define triangle3_list_to_vertex_array_f64      lm2_triangle3_list_to_vertex_array_f64
 #define triangle3_list_to_vertex_array_size_f32 lm2_triangle3_list_to_vertex_array_size_f32
@@ -0,0 +1,195 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include "lm2/geometry2d/lm2_ray2.h"
+#include "lm2/geometry2d/lm2_rayhit2.h"
+#include "lm2/geometry2d/lm2_shape2.h"
+#include "lm2/lm2_base.h"
+#include "lm2/ranges/lm2_range2.h"
+#include "lm2/vectors/lm2_vector2.h"
+
+// #############################################################################
+LM2_HEADER_BEGIN;
+// #############################################################################
+
+// =============================================================================
+// Broadphase Types
+// =============================================================================
+// Incremental dynamic AABB tree over 2D shapes. Every proxy stores a shape and
+// a fat AABB: its bounds inflated by a margin (plus the predicted motion), so
+// small moves do not touch the tree. Inserting searches for the sibling with
+// the lowest perimeter cost and the path back to the root is improved with
+// perimeter-reducing tree rotations, keeping queries fast without rebuilds.
+//
+// Proxy handles are node indices and stay valid until the proxy is removed;
+// a removed handle may be handed out again by a later insert. The tree lives in
+// a caller-managed node buffer sized with lm2_broadphase2_node_buffer_size.
+// The shape data pointers are stored, not copied.
+//
+// The queries report proxies whose fat AABBs overlap; run the narrowphase
+// (lm2_manifold_shape_to_shape, lm2_raycast_shape2) on the results.
+
+// Proxy handle
+typedef uint32_t lm2_broadphase2_proxy;
+
+// Invalid proxy handle (also marks missing parents and children)
+#define LM2_BROADPHASE2_NULL_PROXY UINT32_MAX
+
+// Fat AABB margin scale applied to the displacement passed to lm2_broadphase2_move
+#define LM2_BROADPHASE2_DISPLACEMENT_MULTIPLIER 4
+
+// Tree node
+typedef struct lm2_broadphase2_node_f64 {
+  lm2_r2_f64 bounds;      // Fat AABB (leaves) or union of the children
+  lm2_shape2_f64 shape;   // Shape of the proxy (leaves only)
+  uint32_t parent;        // Parent node (next free node while unused)
+  uint32_t children[2];   // Children, LM2_BROADPHASE2_NULL_PROXY for leaves
+  int32_t height;         // 0 for leaves, -1 while unused
+} lm2_broadphase2_node_f64;
+
+typedef struct lm2_broadphase2_node_f32 {
+  lm2_r2_f32 bounds;      // Fat AABB (leaves) or union of the children
+  lm2_shape2_f32 shape;   // Shape of the proxy (leaves only)
+  uint32_t parent;        // Parent node (next free node while unused)
+  uint32_t children[2];   // Children, LM2_BROADPHASE2_NULL_PROXY for leaves
+  int32_t height;         // 0 for leaves, -1 while unused
+} lm2_broadphase2_node_f32;
+
+// Dynamic AABB tree
+typedef struct lm2_broadphase2_f64 {
+  lm2_broadphase2_node_f64* nodes;  // Node buffer (caller-managed)
+  uint32_t node_capacity;           // Size of nodes
+  uint32_t node_count;              // Nodes handed out so far (high-water mark)
+  uint32_t root;                    // Root node, LM2_BROADPHASE2_NULL_PROXY when empty
+  uint32_t free_list;               // First unused node below node_count
+  uint32_t proxy_count;             // Number of proxies in the tree
+  double margin;                    // Fat AABB margin
+} lm2_broadphase2_f64;
+
+typedef struct lm2_broadphase2_f32 {
+  lm2_broadphase2_node_f32* nodes;  // Node buffer (caller-managed)
+  uint32_t node_capacity;           // Size of nodes
+  uint32_t node_count;              // Nodes handed out so far (high-water mark)
+  uint32_t root;                    // Root node, LM2_BROADPHASE2_NULL_PROXY when empty
+  uint32_t free_list;               // First unused node below node_count
+  uint32_t proxy_count;             // Number of proxies in the tree
+  float margin;                     // Fat AABB margin
+} lm2_broadphase2_f32;
+
+// Pair of proxies with overlapping fat AABBs (a < b)
+typedef struct lm2_broadphase2_pair {
+  lm2_broadphase2_proxy a;
+  lm2_broadphase2_proxy b;
+} lm2_broadphase2_pair;
+
+// Closest ray hit
+typedef struct lm2_broadphase2_hit_f64 {
+  lm2_rayhit2_f64 rayhit;       // Hit result, as returned by lm2_raycast_shape2_f64
+  lm2_broadphase2_proxy proxy;  // Hit proxy (only valid if rayhit.hit)
+} lm2_broadphase2_hit_f64;
+
+typedef struct lm2_broadphase2_hit_f32 {
+  lm2_rayhit2_f32 rayhit;       // Hit result, as returned by lm2_raycast_shape2_f32
+  lm2_broadphase2_proxy proxy;  // Hit proxy (only valid if rayhit.hit)
+} lm2_broadphase2_hit_f32;
+
+// =============================================================================
+// Construction
+// =============================================================================
+
+// Query the number of nodes needed for up to max_proxies proxies
+// Returns: 2 * max_proxies - 1 (0 for no proxies)
+LM2_API size_t lm2_broadphase2_node_buffer_size_f64(size_t max_proxies);
+LM2_API size_t lm2_broadphase2_node_buffer_size_f32(size_t max_proxies);
+
+// Make an empty tree
+// nodes: node buffer (see lm2_broadphase2_node_buffer_size)
+// node_buffer_size: size of nodes in number of nodes
+// margin: distance the fat AABBs extend past the proxy bounds
+LM2_API lm2_broadphase2_f64 lm2_broadphase2_make_f64(lm2_broadphase2_node_f64* nodes, size_t node_buffer_size, double margin);
+LM2_API lm2_broadphase2_f32 lm2_broadphase2_make_f32(lm2_broadphase2_node_f32* nodes, size_t node_buffer_size, float margin);
+
+// =============================================================================
+// Proxies
+// =============================================================================
+
+// Insert a proxy with the given bounds and shape
+// Returns: the proxy handle
+LM2_API lm2_broadphase2_proxy lm2_broadphase2_insert_f64(lm2_broadphase2_f64* bp, lm2_r2_f64 bounds, lm2_shape2_f64 shape);
+LM2_API lm2_broadphase2_proxy lm2_broadphase2_insert_f32(lm2_broadphase2_f32* bp, lm2_r2_f32 bounds, lm2_shape2_f32 shape);
+
+// Insert a proxy using the shape's own bounds (see lm2_shape2_bounds)
+LM2_API lm2_broadphase2_proxy lm2_broadphase2_insert_shape_f64(lm2_broadphase2_f64* bp, lm2_shape2_f64 shape);
+LM2_API lm2_broadphase2_proxy lm2_broadphase2_insert_shape_f32(lm2_broadphase2_f32* bp, lm2_shape2_f32 shape);
+
+// Remove a proxy, its handle becomes invalid
+LM2_API void lm2_broadphase2_remove_f64(lm2_broadphase2_f64* bp, lm2_broadphase2_proxy proxy);
+LM2_API void lm2_broadphase2_remove_f32(lm2_broadphase2_f32* bp, lm2_broadphase2_proxy proxy);
+
+// Update the bounds of a moved proxy. displacement is the motion expected until
+// the next update; the fat AABB is stretched by LM2_BROADPHASE2_DISPLACEMENT_MULTIPLIER
+// times it in that direction. Pass zero when unknown.
+// Returns: true if the proxy was reinserted, false if its fat AABB still contains bounds
+LM2_API bool lm2_broadphase2_move_f64(lm2_broadphase2_f64* bp, lm2_broadphase2_proxy proxy, lm2_r2_f64 bounds, lm2_v2_f64 displacement);
+LM2_API bool lm2_broadphase2_move_f32(lm2_broadphase2_f32* bp, lm2_broadphase2_proxy proxy, lm2_r2_f32 bounds, lm2_v2_f32 displacement);
+
+// Get the fat AABB of a proxy
+LM2_API lm2_r2_f64 lm2_broadphase2_get_fat_bounds_f64(const lm2_broadphase2_f64* bp, lm2_broadphase2_proxy proxy);
+LM2_API lm2_r2_f32 lm2_broadphase2_get_fat_bounds_f32(const lm2_broadphase2_f32* bp, lm2_broadphase2_proxy proxy);
+
+// Get the shape of a proxy
+LM2_API lm2_shape2_f64 lm2_broadphase2_get_shape_f64(const lm2_broadphase2_f64* bp, lm2_broadphase2_proxy proxy);
+LM2_API lm2_shape2_f32 lm2_broadphase2_get_shape_f32(const lm2_broadphase2_f32* bp, lm2_broadphase2_proxy proxy);
+
+// Get the tree height (0 for a single proxy or an empty tree)
+LM2_API uint32_t lm2_broadphase2_height_f64(const lm2_broadphase2_f64* bp);
+LM2_API uint32_t lm2_broadphase2_height_f32(const lm2_broadphase2_f32* bp);
+
+// =============================================================================
+// Queries
+// =============================================================================
+// The output functions write at most max_* results and return the total
+// number found; a return value above max_* means the output was truncated.
+
+// Find every pair of proxies with overlapping fat AABBs
+LM2_API size_t lm2_broadphase2_find_pairs_f64(const lm2_broadphase2_f64* bp, lm2_broadphase2_pair* out_pairs, size_t max_pairs);
+LM2_API size_t lm2_broadphase2_find_pairs_f32(const lm2_broadphase2_f32* bp, lm2_broadphase2_pair* out_pairs, size_t max_pairs);
+
+// Find the proxies whose fat AABBs overlap aabb
+LM2_API size_t lm2_broadphase2_query_aabb_f64(const lm2_broadphase2_f64* bp, lm2_r2_f64 aabb, lm2_broadphase2_proxy* out_proxies, size_t max_proxies);
+LM2_API size_t lm2_broadphase2_query_aabb_f32(const lm2_broadphase2_f32* bp, lm2_r2_f32 aabb, lm2_broadphase2_proxy* out_proxies, size_t max_proxies);
+
+// Find the proxies whose fat AABBs the ray crosses within [0, ray.t_max]
+LM2_API size_t lm2_broadphase2_query_ray_f64(const lm2_broadphase2_f64* bp, lm2_ray2_f64 ray, lm2_broadphase2_proxy* out_proxies, size_t max_proxies);
+LM2_API size_t lm2_broadphase2_query_ray_f32(const lm2_broadphase2_f32* bp, lm2_ray2_f32 ray, lm2_broadphase2_proxy* out_proxies, size_t max_proxies);
+
+// Closest hit of the ray against the proxy shapes (lm2_raycast_shape2 on every candidate)
+LM2_API lm2_broadphase2_hit_f64 lm2_broadphase2_raycast_f64(const lm2_broadphase2_f64* bp, lm2_ray2_f64 ray);
+LM2_API lm2_broadphase2_hit_f32 lm2_broadphase2_raycast_f32(const lm2_broadphase2_f32* bp, lm2_ray2_f32 ray);
+
+// #############################################################################
+LM2_HEADER_END;
+// #############################################################################
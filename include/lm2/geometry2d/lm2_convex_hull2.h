@@ -0,0 +1,90 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "lm2/lm2_base.h"
+#include "lm2/misc/lm2_allocator.h"
+#include "lm2/vectors/lm2_vector2.h"
+
+// #############################################################################
+LM2_HEADER_BEGIN;
+// #############################################################################
+
+// =============================================================================
+// Convex Hull of a Point Set
+// =============================================================================
+// Points strictly inside the polygon spanned by the extreme points in sixteen
+// directions cannot be on the hull and are dropped first (Akl-Toussaint).
+// Every chunk of the input then builds the hull of its remaining points with
+// Andrew's monotone chain, and a last monotone chain over the chunk hulls gives
+// the result. Chunks run on thread_count threads (0 = one per hardware thread);
+// inputs below about 16384 points per thread run on the calling thread.
+//
+// The hull is counter-clockwise, starts at the point with the lowest x (then
+// lowest y) and has no collinear vertices. Points with a NaN or infinite
+// coordinate are ignored. The result does not depend on the thread count.
+// Inputs of a single chunk take their buffers from the calling thread's
+// lm2_arena_thread_default, so repeated small hulls do not touch the heap.
+
+// Compute the convex hull of point_count points
+// out_vertices: capacity entries (or NULL with capacity 0), filled with the first hull vertices
+// Returns: number of hull vertices, which may exceed capacity
+//          (0 if memory could not be allocated)
+LM2_API size_t lm2_convex_hull2_f64(
+    const lm2_v2_f64* points,
+    size_t point_count,
+    lm2_v2_f64* out_vertices,
+    size_t capacity,
+    uint32_t thread_count);
+
+LM2_API size_t lm2_convex_hull2_f32(
+    const lm2_v2_f32* points,
+    size_t point_count,
+    lm2_v2_f32* out_vertices,
+    size_t capacity,
+    uint32_t thread_count);
+
+// Same on the calling thread, with the buffers taken from arena instead
+// Above one chunk the chunk buffers still come from the heap.
+// arena: caller-owned arena; buffers that do not fit, or all of them for NULL, come from the heap
+LM2_API size_t lm2_convex_hull2_scratch_f64(
+    const lm2_v2_f64* points,
+    size_t point_count,
+    lm2_v2_f64* out_vertices,
+    size_t capacity,
+    lm2_arena* arena);
+
+LM2_API size_t lm2_convex_hull2_scratch_f32(
+    const lm2_v2_f32* points,
+    size_t point_count,
+    lm2_v2_f32* out_vertices,
+    size_t capacity,
+    lm2_arena* arena);
+
+// #############################################################################
+LM2_HEADER_END;
+// #############################################################################
@@ -138,6 +138,52 @@ LM2_API float lm2_edge2_to_edge2_distance_sq_f32(lm2_edge2_f32 e1, lm2_edge2_f32
 LM2_API int lm2_edge2_segments_intersect_f64(lm2_v2_f64 a0, lm2_v2_f64 a1, lm2_v2_f64 b0, lm2_v2_f64 b1);
 LM2_API int lm2_edge2_segments_intersect_f32(lm2_v2_f32 a0, lm2_v2_f32 a1, lm2_v2_f32 b0, lm2_v2_f32 b1);
 
+// =============================================================================
+// Edge Set Intersection
+// =============================================================================
+// Finds every intersecting pair in a set of edges. Candidate pairs come from a
+// sweep and prune over the edge bounding boxes (see lm2_range_sweep.h), and the
+// exact tests are split across thread_count threads (0 = one per hardware
+// thread). Pairs are tested with lm2_edge2_segments_intersect, so touching and
+// collinear overlaps count. Edges with a non-finite coordinate are ignored.
+
+// One intersecting pair, edge_a < edge_b. The point is an endpoint of one edge
+// that lies on the other when there is one (always the case for overlaps),
+// else the crossing point.
+typedef struct lm2_edge2_intersection_f64 {
+  lm2_v2_f64 point;
+  uint32_t edge_a;
+  uint32_t edge_b;
+} lm2_edge2_intersection_f64;
+
+typedef struct lm2_edge2_intersection_f32 {
+  lm2_v2_f32 point;
+  uint32_t edge_a;
+  uint32_t edge_b;
+} lm2_edge2_intersection_f32;
+
+// Find the intersecting pairs among edge_count edges.
+// skip_shared_endpoints: ignore pairs that only touch at an exactly shared endpoint,
+//                        such as consecutive edges of a polyline
+// out_intersections: capacity entries (or NULL with capacity 0), filled in (edge_a, edge_b) order
+// Returns: total number of intersecting pairs, which may exceed capacity
+//          (0 if memory could not be allocated)
+LM2_API size_t lm2_edge2_find_intersections_f64(
+    const lm2_edge2_f64* edges,
+    size_t edge_count,
+    bool skip_shared_endpoints,
+    lm2_edge2_intersection_f64* out_intersections,
+    size_t capacity,
+    uint32_t thread_count);
+
+LM2_API size_t lm2_edge2_find_intersections_f32(
+    const lm2_edge2_f32* edges,
+    size_t edge_count,
+    bool skip_shared_endpoints,
+    lm2_edge2_intersection_f32* out_intersections,
+    size_t capacity,
+    uint32_t thread_count);
+
 // =============================================================================
 // Raycasting Against an Edge
 // =============================================================================
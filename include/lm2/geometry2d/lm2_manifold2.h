@@ -25,6 +25,7 @@ SOFTWARE.
 #pragma once
 
 #include "lm2/lm2_base.h"
+#include "lm2/misc/lm2_allocator.h"
 #include "lm2/ranges/lm2_range2.h"
 #include "lm2/vectors/lm2_vector2.h"
 #include "lm2_capsule2.h"
@@ -192,6 +193,56 @@ LM2_API void lm2_manifold_triangle_to_capsule_f32(const lm2_triangle2_f32 tri, l
 LM2_API void lm2_manifold_triangle_to_polygon_f64(const lm2_triangle2_f64 tri, lm2_polygon_f64 polygon, lm2_manifold_f64* out_manifold);
 LM2_API void lm2_manifold_triangle_to_polygon_f32(const lm2_triangle2_f32 tri, lm2_polygon_f32 polygon, lm2_manifold_f32* out_manifold);
 
+// =============================================================================
+// Convex Polygon Collision Detection (Fast, YES/NO only)
+// =============================================================================
+// Overloads taking a prepared lm2_convex_polygon (see lm2_convex_polygon_make).
+// Normals are not recomputed and the cached bounds reject separated pairs early.
+
+// Circle to Convex Polygon
+LM2_API bool lm2_collide_circle_to_convex_polygon_f64(lm2_circle_f64 circle, lm2_convex_polygon_f64 convex);
+LM2_API bool lm2_collide_circle_to_convex_polygon_f32(lm2_circle_f32 circle, lm2_convex_polygon_f32 convex);
+
+// AABB to Convex Polygon
+LM2_API bool lm2_collide_aabb_to_convex_polygon_f64(lm2_r2_f64 aabb, lm2_convex_polygon_f64 convex);
+LM2_API bool lm2_collide_aabb_to_convex_polygon_f32(lm2_r2_f32 aabb, lm2_convex_polygon_f32 convex);
+
+// Capsule to Convex Polygon
+LM2_API bool lm2_collide_capsule_to_convex_polygon_f64(lm2_capsule2_f64 capsule, lm2_convex_polygon_f64 convex);
+LM2_API bool lm2_collide_capsule_to_convex_polygon_f32(lm2_capsule2_f32 capsule, lm2_convex_polygon_f32 convex);
+
+// Triangle to Convex Polygon
+LM2_API bool lm2_collide_triangle_to_convex_polygon_f64(const lm2_triangle2_f64 tri, lm2_convex_polygon_f64 convex);
+LM2_API bool lm2_collide_triangle_to_convex_polygon_f32(const lm2_triangle2_f32 tri, lm2_convex_polygon_f32 convex);
+
+// Convex Polygon to Convex Polygon
+LM2_API bool lm2_collide_convex_polygon_to_convex_polygon_f64(lm2_convex_polygon_f64 a, lm2_convex_polygon_f64 b);
+LM2_API bool lm2_collide_convex_polygon_to_convex_polygon_f32(lm2_convex_polygon_f32 a, lm2_convex_polygon_f32 b);
+
+// =============================================================================
+// Convex Polygon Manifold Generation (Slower, provides collision details)
+// =============================================================================
+
+// Circle to Convex Polygon Manifold
+LM2_API void lm2_manifold_circle_to_convex_polygon_f64(lm2_circle_f64 circle, lm2_convex_polygon_f64 convex, lm2_manifold_f64* out_manifold);
+LM2_API void lm2_manifold_circle_to_convex_polygon_f32(lm2_circle_f32 circle, lm2_convex_polygon_f32 convex, lm2_manifold_f32* out_manifold);
+
+// AABB to Convex Polygon Manifold
+LM2_API void lm2_manifold_aabb_to_convex_polygon_f64(lm2_r2_f64 aabb, lm2_convex_polygon_f64 convex, lm2_manifold_f64* out_manifold);
+LM2_API void lm2_manifold_aabb_to_convex_polygon_f32(lm2_r2_f32 aabb, lm2_convex_polygon_f32 convex, lm2_manifold_f32* out_manifold);
+
+// Capsule to Convex Polygon Manifold
+LM2_API void lm2_manifold_capsule_to_convex_polygon_f64(lm2_capsule2_f64 capsule, lm2_convex_polygon_f64 convex, lm2_manifold_f64* out_manifold);
+LM2_API void lm2_manifold_capsule_to_convex_polygon_f32(lm2_capsule2_f32 capsule, lm2_convex_polygon_f32 convex, lm2_manifold_f32* out_manifold);
+
+// Triangle to Convex Polygon Manifold
+LM2_API void lm2_manifold_triangle_to_convex_polygon_f64(const lm2_triangle2_f64 tri, lm2_convex_polygon_f64 convex, lm2_manifold_f64* out_manifold);
+LM2_API void lm2_manifold_triangle_to_convex_polygon_f32(const lm2_triangle2_f32 tri, lm2_convex_polygon_f32 convex, lm2_manifold_f32* out_manifold);
+
+// Convex Polygon to Convex Polygon Manifold
+LM2_API void lm2_manifold_convex_polygon_to_convex_polygon_f64(lm2_convex_polygon_f64 a, lm2_convex_polygon_f64 b, lm2_manifold_f64* out_manifold);
+LM2_API void lm2_manifold_convex_polygon_to_convex_polygon_f32(lm2_convex_polygon_f32 a, lm2_convex_polygon_f32 b, lm2_manifold_f32* out_manifold);
+
 // =============================================================================
 // Plane Manifold Generation (Slower, provides collision details)
 // =============================================================================
@@ -232,18 +283,31 @@ LM2_API void lm2_manifold_shape_to_shape_f32(lm2_shape2_f32 shape_a, lm2_shape2_
 
 // Compute convex hull of a set of points
 // Returns the number of vertices in the hull (fills out_vertices with hull points)
+// Runs lm2_convex_hull2 on the calling thread; the hull is cut to max_vertices
+// The working buffers come from the calling thread's lm2_arena_thread_default.
 LM2_API int lm2_convex_hull_f64(lm2_v2_f64* points, int point_count, lm2_v2_f64* out_vertices, int max_vertices);
 LM2_API int lm2_convex_hull_f32(lm2_v2_f32* points, int point_count, lm2_v2_f32* out_vertices, int max_vertices);
 
+// Convex hull with the working buffers taken from a caller-owned arena (NULL for the heap)
+LM2_API int lm2_convex_hull_scratch_f64(lm2_v2_f64* points, int point_count, lm2_v2_f64* out_vertices, int max_vertices, lm2_arena* arena);
+LM2_API int lm2_convex_hull_scratch_f32(lm2_v2_f32* points, int point_count, lm2_v2_f32* out_vertices, int max_vertices, lm2_arena* arena);
+
 // Compute polygon normals
+// Outward for counter-clockwise vertices: every edge rotated clockwise by 90 degrees, normalized
 LM2_API void lm2_compute_normals_f64(lm2_v2_f64* vertices, lm2_v2_f64* out_normals, int vertex_count);
 LM2_API void lm2_compute_normals_f32(lm2_v2_f32* vertices, lm2_v2_f32* out_normals, int vertex_count);
 
 // Make a convex polygon (runs convex hull + computes normals)
-// Modifies the polygon's vertices in place if needed
+// Replaces the polygon's vertices in place with its counter-clockwise hull, or sets
+// vertex_count to 0 when the hull has fewer than three vertices. The hull buffers come
+// from the calling thread's lm2_arena_thread_default.
 LM2_API void lm2_make_convex_polygon_f64(lm2_polygon_f64* polygon, lm2_v2_f64* out_normals);
 LM2_API void lm2_make_convex_polygon_f32(lm2_polygon_f32* polygon, lm2_v2_f32* out_normals);
 
+// Make a convex polygon with the hull buffers taken from a caller-owned arena (NULL for the heap)
+LM2_API void lm2_make_convex_polygon_scratch_f64(lm2_polygon_f64* polygon, lm2_v2_f64* out_normals, lm2_arena* arena);
+LM2_API void lm2_make_convex_polygon_scratch_f32(lm2_polygon_f32* polygon, lm2_v2_f32* out_normals, lm2_arena* arena);
+
 // #############################################################################
 LM2_HEADER_END;
 // #############################################################################
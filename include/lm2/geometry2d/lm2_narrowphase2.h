@@ -0,0 +1,81 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include "lm2/geometry2d/lm2_manifold2.h"
+#include "lm2/geometry2d/lm2_shape2.h"
+#include "lm2/lm2_base.h"
+
+// #############################################################################
+LM2_HEADER_BEGIN;
+// #############################################################################
+
+// =============================================================================
+// Batched Narrowphase
+// =============================================================================
+// Builds the manifolds of a whole pair list in one call. The pairs are first
+// bucketed by shape type combination with a counting sort. Each bucket then
+// runs a loop that calls one manifold function directly, so the per-pair
+// double switch of lm2_manifold_shape_to_shape is gone. The sorted list is
+// split across thread_count threads (0 = one per hardware thread).
+//
+// Results are the same as calling lm2_manifold_shape_to_shape on every pair.
+// The touching pairs come out compacted and in pair order, so the output does
+// not depend on the thread count.
+
+// Pair of indices into a shape array. Same layout as lm2_broadphase2_pair, so
+// broadphase pairs can be passed directly when the shape array is indexed by proxy.
+typedef struct lm2_narrowphase2_pair {
+  uint32_t a;
+  uint32_t b;
+} lm2_narrowphase2_pair;
+
+// Build the manifolds of pair_count pairs of shapes.
+// order_buffer: scratch space for pair_count indices
+// out_manifolds: pair_count entries, the first <return> hold the touching pairs
+// out_pair_indices: pair_count entries (or NULL), index of the pair behind each manifold
+// Returns: number of touching pairs
+LM2_API size_t lm2_narrowphase2_collide_f64(
+    const lm2_shape2_f64* shapes,
+    const lm2_narrowphase2_pair* pairs,
+    size_t pair_count,
+    uint32_t* order_buffer,
+    lm2_manifold_f64* out_manifolds,
+    uint32_t* out_pair_indices,
+    uint32_t thread_count);
+
+LM2_API size_t lm2_narrowphase2_collide_f32(
+    const lm2_shape2_f32* shapes,
+    const lm2_narrowphase2_pair* pairs,
+    size_t pair_count,
+    uint32_t* order_buffer,
+    lm2_manifold_f32* out_manifolds,
+    uint32_t* out_pair_indices,
+    uint32_t thread_count);
+
+// #############################################################################
+LM2_HEADER_END;
+// #############################################################################
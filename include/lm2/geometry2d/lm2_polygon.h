@@ -26,6 +26,7 @@ SOFTWARE.
 
 #include <stddef.h>
 #include "lm2/lm2_base.h"
+#include "lm2/misc/lm2_allocator.h"
 #include "lm2/ranges/lm2_range2.h"
 #include "lm2/vectors/lm2_vector2.h"
 #include "lm2_triangle2.h"
@@ -49,6 +50,23 @@ typedef struct lm2_polygon_f32 {
   size_t vertex_count;   // Number of vertices
 } lm2_polygon_f32;
 
+// Convex polygon prepared for repeated collision queries - caller manages the
+// vertices and normals arrays memory. Edge normals and bounds are computed once
+// by lm2_convex_polygon_make and reused by every collide/manifold/raycast call.
+typedef struct lm2_convex_polygon_f64 {
+  lm2_v2_f64* vertices;  // Pointer to array of vertices (caller-managed, CCW)
+  lm2_v2_f64* normals;   // Pointer to array of edge normals (caller-managed, one per vertex)
+  size_t vertex_count;   // Number of vertices (and normals)
+  lm2_r2_f64 bounds;     // Cached axis-aligned bounds of the vertices
+} lm2_convex_polygon_f64;
+
+typedef struct lm2_convex_polygon_f32 {
+  lm2_v2_f32* vertices;  // Pointer to array of vertices (caller-managed, CCW)
+  lm2_v2_f32* normals;   // Pointer to array of edge normals (caller-managed, one per vertex)
+  size_t vertex_count;   // Number of vertices (and normals)
+  lm2_r2_f32 bounds;     // Cached axis-aligned bounds of the vertices
+} lm2_convex_polygon_f32;
+
 // =============================================================================
 // Construction Helpers
 // =============================================================================
@@ -169,6 +187,28 @@ LM2_API void lm2_polygon_remove_vertex_f32(lm2_v2_f32* vertices, size_t* vertex_
 LM2_API void lm2_polygon_place_at_center_f64(lm2_polygon_f64 polygon, lm2_v2_f64 position);
 LM2_API void lm2_polygon_place_at_center_f32(lm2_polygon_f32 polygon, lm2_v2_f32 position);
 
+// =============================================================================
+// Convex Polygon Preparation
+// =============================================================================
+
+// Prepare a convex polygon: computes the outward edge normals into out_normals
+// (caller provides array of size vertex_count) and caches the bounds.
+// The polygon vertices are referenced, not copied.
+LM2_API lm2_convex_polygon_f64 lm2_convex_polygon_make_f64(lm2_polygon_f64 polygon, lm2_v2_f64* out_normals);
+LM2_API lm2_convex_polygon_f32 lm2_convex_polygon_make_f32(lm2_polygon_f32 polygon, lm2_v2_f32* out_normals);
+
+// Recompute the normals and bounds after the vertices were modified in-place
+LM2_API void lm2_convex_polygon_refresh_f64(lm2_convex_polygon_f64* convex);
+LM2_API void lm2_convex_polygon_refresh_f32(lm2_convex_polygon_f32* convex);
+
+// Translate a convex polygon by an offset (moves vertices and bounds, normals are unchanged)
+LM2_API void lm2_convex_polygon_translate_f64(lm2_convex_polygon_f64* convex, lm2_v2_f64 offset);
+LM2_API void lm2_convex_polygon_translate_f32(lm2_convex_polygon_f32* convex, lm2_v2_f32 offset);
+
+// View a convex polygon as a plain polygon (shares the vertices array)
+LM2_API lm2_polygon_f64 lm2_convex_polygon_as_polygon_f64(lm2_convex_polygon_f64 convex);
+LM2_API lm2_polygon_f32 lm2_convex_polygon_as_polygon_f32(lm2_convex_polygon_f32 convex);
+
 // =============================================================================
 // Polygon Triangulation
 // =============================================================================
@@ -182,6 +222,33 @@ LM2_API size_t lm2_polygon_max_triangle_count(size_t vertex_count);
 LM2_API size_t lm2_polygon_triangulate_ear_clipping_f64(lm2_polygon_f64 polygon, size_t* out_indices);
 LM2_API size_t lm2_polygon_triangulate_ear_clipping_f32(lm2_polygon_f32 polygon, size_t* out_indices);
 
+// Ear clipping with the scratch buffer taken from arena instead of the calling thread's
+// lm2_arena_thread_default
+// arena: caller-owned arena; NULL or a full arena falls back to the heap
+LM2_API size_t lm2_polygon_triangulate_ear_clipping_scratch_f64(lm2_polygon_f64 polygon, size_t* out_indices, lm2_arena* arena);
+LM2_API size_t lm2_polygon_triangulate_ear_clipping_scratch_f32(lm2_polygon_f32 polygon, size_t* out_indices, lm2_arena* arena);
+
+// Calculate the maximum number of triangles for a polygon with holes
+// vertex_count: outline and hole vertices together
+// Returns: vertex_count + 2 * hole_count - 2
+LM2_API size_t lm2_polygon_max_triangle_count_with_holes(size_t vertex_count, size_t hole_count);
+
+// Calculate the scratch buffer size in bytes needed by lm2_polygon_triangulate
+// vertex_count: outline and hole vertices together
+LM2_API size_t lm2_polygon_triangulate_scratch_size_f64(size_t vertex_count, size_t hole_count);
+LM2_API size_t lm2_polygon_triangulate_scratch_size_f32(size_t vertex_count, size_t hole_count);
+
+// Triangulate a polygon with holes (earcut: linked vertex ring, z-order hashing for large inputs)
+// The outline and the holes may have either winding order
+// holes: hole_count hole outlines inside the polygon, may be NULL when hole_count is 0
+// scratch: caller-provided buffer of at least lm2_polygon_triangulate_scratch_size bytes,
+//          or NULL to take one from the calling thread's lm2_arena_thread_default
+// out_indices: caller-provided array of max_triangle_count_with_holes * 3 indices; triangles are
+//              counter-clockwise, outline vertices are numbered first, then each hole in order
+// Returns: actual number of triangles generated
+LM2_API size_t lm2_polygon_triangulate_f64(lm2_polygon_f64 polygon, const lm2_polygon_f64* holes, size_t hole_count, void* scratch, size_t scratch_size, size_t* out_indices);
+LM2_API size_t lm2_polygon_triangulate_f32(lm2_polygon_f32 polygon, const lm2_polygon_f32* holes, size_t hole_count, void* scratch, size_t scratch_size, size_t* out_indices);
+
 // =============================================================================
 // Polygon Splitting
 // =============================================================================
@@ -75,6 +75,10 @@ LM2_API lm2_rayhit2_f32 lm2_raycast_capsule2_f32(lm2_ray2_f32 ray, lm2_capsule2_
 LM2_API lm2_rayhit2_f64 lm2_raycast_polygon_f64(lm2_ray2_f64 ray, lm2_polygon_f64 polygon);
 LM2_API lm2_rayhit2_f32 lm2_raycast_polygon_f32(lm2_ray2_f32 ray, lm2_polygon_f32 polygon);
 
+// Ray vs Convex Polygon (prepared, no normal recomputation)
+LM2_API lm2_rayhit2_f64 lm2_raycast_convex_polygon_f64(lm2_ray2_f64 ray, lm2_convex_polygon_f64 convex);
+LM2_API lm2_rayhit2_f32 lm2_raycast_convex_polygon_f32(lm2_ray2_f32 ray, lm2_convex_polygon_f32 convex);
+
 // Ray vs Line Segment (edge)
 // NOTE: Prefer lm2_raycast_edge2_f64/f32 (from lm2_edge2.h) which accepts an
 // lm2_edge2 struct and is the canonical edge2 API.  These wrappers are kept
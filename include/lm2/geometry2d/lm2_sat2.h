@@ -0,0 +1,94 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include "lm2/geometry2d/lm2_capsule2.h"
+#include "lm2/geometry2d/lm2_circle.h"
+#include "lm2/geometry2d/lm2_manifold2.h"
+#include "lm2/geometry2d/lm2_polygon.h"
+#include "lm2/geometry2d/lm2_ray2.h"
+#include "lm2/geometry2d/lm2_rayhit2.h"
+#include "lm2/lm2_base.h"
+
+// #############################################################################
+LM2_HEADER_BEGIN;
+// #############################################################################
+
+// =============================================================================
+// Native Convex Polygon Narrowphase
+// =============================================================================
+// Separating axis tests for prepared convex polygons with any vertex count.
+// The polygons must be convex and wound counter-clockwise, with the outward
+// normals cached by lm2_convex_polygon_make.
+//
+// Support points are found by hill climbing from the previous edge's support
+// vertex. Successive edge normals rotate monotonically, so one sweep over the
+// edges costs O(n + m) instead of O(n * m). Face contacts clip the incident
+// edge against the reference face and yield up to two contact points. Manifold
+// normals point from the first shape to the second, as in lm2_manifold2.h.
+//
+// The *_convex_polygon_* overloads in lm2_manifold2.h and lm2_raycast2.h route
+// here for polygons beyond the cute_c2 vertex limit. These functions can also
+// be called directly for any vertex count.
+
+// Reference face hysteresis and vertex-region threshold, in world units
+#define LM2_SAT2_TOLERANCE_F64 5e-4
+#define LM2_SAT2_TOLERANCE_F32 5e-4f
+
+// =============================================================================
+// Boolean Collision Detection
+// =============================================================================
+
+// Convex Polygon to Convex Polygon (exits at the first separating axis)
+LM2_API bool lm2_sat2_collide_polygon_to_polygon_f64(lm2_convex_polygon_f64 a, lm2_convex_polygon_f64 b);
+LM2_API bool lm2_sat2_collide_polygon_to_polygon_f32(lm2_convex_polygon_f32 a, lm2_convex_polygon_f32 b);
+
+// =============================================================================
+// Manifold Generation
+// =============================================================================
+
+// Convex Polygon to Convex Polygon Manifold
+LM2_API void lm2_sat2_manifold_polygon_to_polygon_f64(lm2_convex_polygon_f64 a, lm2_convex_polygon_f64 b, lm2_manifold_f64* out_manifold);
+LM2_API void lm2_sat2_manifold_polygon_to_polygon_f32(lm2_convex_polygon_f32 a, lm2_convex_polygon_f32 b, lm2_manifold_f32* out_manifold);
+
+// Circle to Convex Polygon Manifold
+LM2_API void lm2_sat2_manifold_circle_to_polygon_f64(lm2_circle_f64 circle, lm2_convex_polygon_f64 convex, lm2_manifold_f64* out_manifold);
+LM2_API void lm2_sat2_manifold_circle_to_polygon_f32(lm2_circle_f32 circle, lm2_convex_polygon_f32 convex, lm2_manifold_f32* out_manifold);
+
+// Capsule to Convex Polygon Manifold
+LM2_API void lm2_sat2_manifold_capsule_to_polygon_f64(lm2_capsule2_f64 capsule, lm2_convex_polygon_f64 convex, lm2_manifold_f64* out_manifold);
+LM2_API void lm2_sat2_manifold_capsule_to_polygon_f32(lm2_capsule2_f32 capsule, lm2_convex_polygon_f32 convex, lm2_manifold_f32* out_manifold);
+
+// =============================================================================
+// Raycasting
+// =============================================================================
+
+// Ray vs Convex Polygon (clips the ray against every edge half-plane, misses when the origin is inside)
+LM2_API lm2_rayhit2_f64 lm2_sat2_raycast_polygon_f64(lm2_ray2_f64 ray, lm2_convex_polygon_f64 convex);
+LM2_API lm2_rayhit2_f32 lm2_sat2_raycast_polygon_f32(lm2_ray2_f32 ray, lm2_convex_polygon_f32 convex);
+
+// #############################################################################
+LM2_HEADER_END;
+// #############################################################################
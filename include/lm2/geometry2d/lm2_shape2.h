@@ -131,6 +131,14 @@ LM2_API bool lm2_shape2_is_type_f32(const lm2_shape2_f32* shape, lm2_shape2_type
 LM2_API lm2_shape2_type lm2_shape2_get_type_f64(const lm2_shape2_f64* shape);
 LM2_API lm2_shape2_type lm2_shape2_get_type_f32(const lm2_shape2_f32* shape);
 
+// =============================================================================
+// Bounds
+// =============================================================================
+
+// Get the axis-aligned bounds of the shape
+LM2_API lm2_r2_f64 lm2_shape2_bounds_f64(lm2_shape2_f64 shape);
+LM2_API lm2_r2_f32 lm2_shape2_bounds_f32(lm2_shape2_f32 shape);
+
 // #############################################################################
 LM2_HEADER_END;
 // #############################################################################
@@ -25,6 +25,7 @@ SOFTWARE.
 #pragma once
 
 #include "lm2/lm2_base.h"
+#include "lm2/misc/lm2_allocator.h"
 #include "lm2/vectors/lm2_vector2.h"
 #include "lm2_triangle2.h"
 
@@ -118,11 +119,13 @@ LM2_API lm2_indexed_mesh_size lm2_triangle2_list_to_indexed_mesh_size_f32(
 
 // Generate indexed mesh (vertices + indices) from triangle list
 // This function deduplicates vertices within the specified epsilon tolerance
+// Each vertex maps to the first unique vertex within epsilon on every axis;
+// unique vertices keep the order of their first occurrence
 // triangles: array of triangles
 // triangle_count: number of triangles
 // epsilon: tolerance for vertex comparison (use 0.0 for exact comparison)
 // vertices: output buffer for unique vertices
-// vertex_buffer_size: size of vertices buffer in number of vertices
+// vertex_buffer_size: size of vertices buffer in number of vertices (at least the queried vertex_count)
 // indices: output buffer for indices
 // index_buffer_size: size of indices buffer in number of indices
 LM2_API void lm2_triangle2_list_to_indexed_mesh_f64(
@@ -143,6 +146,79 @@ LM2_API void lm2_triangle2_list_to_indexed_mesh_f32(
     uint32_t* indices,
     size_t index_buffer_size);
 
+// Parallel variants on thread_count threads (0 = one per hardware thread)
+// Every thread welds exact duplicates within its part of the list, then the
+// first occurrences weld within epsilon on the calling thread. The results are
+// identical to the functions above. Threads are started per call, so lists
+// below about 5500 triangles per thread run on the calling thread.
+LM2_API lm2_indexed_mesh_size lm2_triangle2_list_to_indexed_mesh_size_parallel_f64(
+    const lm2_triangle2_f64* triangles,
+    size_t triangle_count,
+    double epsilon,
+    uint32_t thread_count);
+
+LM2_API lm2_indexed_mesh_size lm2_triangle2_list_to_indexed_mesh_size_parallel_f32(
+    const lm2_triangle2_f32* triangles,
+    size_t triangle_count,
+    float epsilon,
+    uint32_t thread_count);
+
+LM2_API void lm2_triangle2_list_to_indexed_mesh_parallel_f64(
+    const lm2_triangle2_f64* triangles,
+    size_t triangle_count,
+    double epsilon,
+    lm2_v2_f64* vertices,
+    size_t vertex_buffer_size,
+    uint32_t* indices,
+    size_t index_buffer_size,
+    uint32_t thread_count);
+
+LM2_API void lm2_triangle2_list_to_indexed_mesh_parallel_f32(
+    const lm2_triangle2_f32* triangles,
+    size_t triangle_count,
+    float epsilon,
+    lm2_v2_f32* vertices,
+    size_t vertex_buffer_size,
+    uint32_t* indices,
+    size_t index_buffer_size,
+    uint32_t thread_count);
+
+// Variants that take the weld's temporary buffers from arena, running on the calling thread
+// The functions above use the calling thread's lm2_arena_thread_default, so they
+// only allocate until it has grown to the largest list seen.
+// arena: caller-owned arena; buffers that do not fit, or all of them for NULL, come from the heap
+LM2_API lm2_indexed_mesh_size lm2_triangle2_list_to_indexed_mesh_size_scratch_f64(
+    const lm2_triangle2_f64* triangles,
+    size_t triangle_count,
+    double epsilon,
+    lm2_arena* arena);
+
+LM2_API lm2_indexed_mesh_size lm2_triangle2_list_to_indexed_mesh_size_scratch_f32(
+    const lm2_triangle2_f32* triangles,
+    size_t triangle_count,
+    float epsilon,
+    lm2_arena* arena);
+
+LM2_API void lm2_triangle2_list_to_indexed_mesh_scratch_f64(
+    const lm2_triangle2_f64* triangles,
+    size_t triangle_count,
+    double epsilon,
+    lm2_v2_f64* vertices,
+    size_t vertex_buffer_size,
+    uint32_t* indices,
+    size_t index_buffer_size,
+    lm2_arena* arena);
+
+LM2_API void lm2_triangle2_list_to_indexed_mesh_scratch_f32(
+    const lm2_triangle2_f32* triangles,
+    size_t triangle_count,
+    float epsilon,
+    lm2_v2_f32* vertices,
+    size_t vertex_buffer_size,
+    uint32_t* indices,
+    size_t index_buffer_size,
+    lm2_arena* arena);
+
 // =============================================================================
 // Indexed Mesh to Triangle List Conversion (Inverse)
 // =============================================================================
@@ -0,0 +1,267 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include "lm2/geometry3d/lm2_raycast3.h"
+#include "lm2/geometry3d/lm2_triangle3.h"
+#include "lm2/lm2_base.h"
+#include "lm2/ranges/lm2_range3.h"
+#include "lm2/vectors/lm2_vector3.h"
+
+// #############################################################################
+LM2_HEADER_BEGIN;
+// #############################################################################
+
+// =============================================================================
+// BVH Types
+// =============================================================================
+// Bounding volume hierarchy over a triangle list or an indexed triangle mesh,
+// built with binned SAH into a flat node array. The two children of an interior
+// node are stored next to each other, so a node only needs one index.
+//
+// The BVH references the caller's node and primitive index buffers and the
+// source geometry without copying them; all of them must outlive it. Size the
+// buffers with lm2_bvh3_node_buffer_size / lm2_bvh3_index_buffer_size.
+//
+// The same node layout serves hierarchies over arbitrary boxes (see
+// lm2_bvh3_build_bounds). Children are always stored after their parent.
+
+// Flat BVH node
+typedef struct lm2_bvh3_node_f64 {
+  lm2_r3_f64 bounds;  // Bounds of every triangle below this node
+  uint32_t first;     // Interior: index of the left child (right child is first + 1). Leaf: first primitive slot
+  uint32_t count;     // Interior: 0. Leaf: number of triangles
+} lm2_bvh3_node_f64;
+
+typedef struct lm2_bvh3_node_f32 {
+  lm2_r3_f32 bounds;  // Bounds of every triangle below this node
+  uint32_t first;     // Interior: index of the left child (right child is first + 1). Leaf: first primitive slot
+  uint32_t count;     // Interior: 0. Leaf: number of triangles
+} lm2_bvh3_node_f32;
+
+// Triangle BVH
+typedef struct lm2_bvh3_f64 {
+  lm2_bvh3_node_f64* nodes;            // Node buffer (caller-managed), root at nodes[0]
+  uint32_t node_count;                 // Number of nodes in use
+  uint32_t* primitive_indices;         // Triangle index per leaf slot (caller-managed)
+  uint32_t triangle_count;             // Number of triangles
+  const lm2_triangle3_f64* triangles;  // Triangle list, or NULL for an indexed mesh
+  const lm2_v3_f64* vertices;          // Indexed mesh vertices, or NULL for a triangle list
+  const uint32_t* indices;             // Indexed mesh indices (3 per triangle), or NULL for a triangle list
+} lm2_bvh3_f64;
+
+typedef struct lm2_bvh3_f32 {
+  lm2_bvh3_node_f32* nodes;            // Node buffer (caller-managed), root at nodes[0]
+  uint32_t node_count;                 // Number of nodes in use
+  uint32_t* primitive_indices;         // Triangle index per leaf slot (caller-managed)
+  uint32_t triangle_count;             // Number of triangles
+  const lm2_triangle3_f32* triangles;  // Triangle list, or NULL for an indexed mesh
+  const lm2_v3_f32* vertices;          // Indexed mesh vertices, or NULL for a triangle list
+  const uint32_t* indices;             // Indexed mesh indices (3 per triangle), or NULL for a triangle list
+} lm2_bvh3_f32;
+
+// BVH ray query result
+typedef struct lm2_bvh3_hit_f64 {
+  lm2_rayhit3_f64 rayhit;   // Hit result, as returned by lm2_raycast_triangle_f64
+  uint32_t triangle_index;  // Index of the hit triangle (only valid if rayhit.hit)
+} lm2_bvh3_hit_f64;
+
+typedef struct lm2_bvh3_hit_f32 {
+  lm2_rayhit3_f32 rayhit;   // Hit result, as returned by lm2_raycast_triangle_f32
+  uint32_t triangle_index;  // Index of the hit triangle (only valid if rayhit.hit)
+} lm2_bvh3_hit_f32;
+
+// =============================================================================
+// Build Parameters
+// =============================================================================
+
+// Number of SAH bins per axis
+#define LM2_BVH3_BIN_COUNT 16
+
+// Leaves larger than this are always split, smaller ones only when SAH says so
+#define LM2_BVH3_MAX_LEAF_SIZE 8
+
+// Maximum tree depth (size of the traversal stack). Below half this depth the
+// builder switches from SAH to median splits, which keeps any input in bounds.
+#define LM2_BVH3_MAX_DEPTH 64
+
+// =============================================================================
+// Buffer Sizes
+// =============================================================================
+
+// Query the number of nodes needed for a BVH over triangle_count triangles
+// Returns: 2 * triangle_count - 1 (0 for an empty mesh)
+LM2_API size_t lm2_bvh3_node_buffer_size_f64(size_t triangle_count);
+LM2_API size_t lm2_bvh3_node_buffer_size_f32(size_t triangle_count);
+
+// Query the number of primitive indices needed for a BVH over triangle_count triangles
+// Returns: triangle_count
+LM2_API size_t lm2_bvh3_index_buffer_size_f64(size_t triangle_count);
+LM2_API size_t lm2_bvh3_index_buffer_size_f32(size_t triangle_count);
+
+// =============================================================================
+// Construction
+// =============================================================================
+
+// Build a BVH over a triangle list
+// triangles: triangle list (referenced by the BVH, not copied)
+// triangle_count: number of triangles
+// nodes: output buffer for nodes
+// node_buffer_size: size of nodes in number of nodes (see lm2_bvh3_node_buffer_size)
+// primitive_indices: output buffer for the leaf triangle indices
+// index_buffer_size: size of primitive_indices in number of indices (see lm2_bvh3_index_buffer_size)
+LM2_API lm2_bvh3_f64 lm2_bvh3_build_f64(
+    const lm2_triangle3_f64* triangles,
+    size_t triangle_count,
+    lm2_bvh3_node_f64* nodes,
+    size_t node_buffer_size,
+    uint32_t* primitive_indices,
+    size_t index_buffer_size);
+
+LM2_API lm2_bvh3_f32 lm2_bvh3_build_f32(
+    const lm2_triangle3_f32* triangles,
+    size_t triangle_count,
+    lm2_bvh3_node_f32* nodes,
+    size_t node_buffer_size,
+    uint32_t* primitive_indices,
+    size_t index_buffer_size);
+
+// Build a BVH over an indexed mesh
+// vertices: mesh vertices (referenced by the BVH, not copied)
+// vertex_count: number of vertices
+// indices: mesh indices, 3 per triangle (referenced by the BVH, not copied)
+// index_count: number of indices (must be divisible by 3)
+// nodes, node_buffer_size, primitive_indices, index_buffer_size: as for lm2_bvh3_build
+LM2_API lm2_bvh3_f64 lm2_bvh3_build_indexed_f64(
+    const lm2_v3_f64* vertices,
+    size_t vertex_count,
+    const uint32_t* indices,
+    size_t index_count,
+    lm2_bvh3_node_f64* nodes,
+    size_t node_buffer_size,
+    uint32_t* primitive_indices,
+    size_t index_buffer_size);
+
+LM2_API lm2_bvh3_f32 lm2_bvh3_build_indexed_f32(
+    const lm2_v3_f32* vertices,
+    size_t vertex_count,
+    const uint32_t* indices,
+    size_t index_count,
+    lm2_bvh3_node_f32* nodes,
+    size_t node_buffer_size,
+    uint32_t* primitive_indices,
+    size_t index_buffer_size);
+
+// =============================================================================
+// Box Hierarchies
+// =============================================================================
+// Hierarchies over an array of primitive bounds (scene objects, broadphase
+// proxies), using the triangle BVH's nodes and build. Leaf slots hold indices
+// into the bounds array. The arguments of the box functions mirror the
+// triangle builds, with count boxes in place of triangles.
+//
+// The parallel build computes the same tree as the single-threaded one: the
+// top splits bin their primitives across threads, smaller nodes become subtree
+// tasks. Threads are started per call, so inputs below about 32768 boxes build
+// on the calling thread.
+//
+// Refitting recomputes the node bounds bottom-up for moved primitives, keeping
+// the tree structure. Queries stay correct; their cost drifts up as the boxes
+// move away from where they were built, so rebuild from time to time.
+
+// Build a hierarchy over count boxes
+// Returns: number of nodes written
+LM2_API uint32_t lm2_bvh3_build_bounds_f64(
+    const lm2_r3_f64* bounds,
+    size_t count,
+    lm2_bvh3_node_f64* nodes,
+    size_t node_buffer_size,
+    uint32_t* primitive_indices,
+    size_t index_buffer_size);
+
+LM2_API uint32_t lm2_bvh3_build_bounds_f32(
+    const lm2_r3_f32* bounds,
+    size_t count,
+    lm2_bvh3_node_f32* nodes,
+    size_t node_buffer_size,
+    uint32_t* primitive_indices,
+    size_t index_buffer_size);
+
+// Build a hierarchy over count boxes on thread_count threads (0 = one per hardware thread)
+// Returns: number of nodes written
+LM2_API uint32_t lm2_bvh3_build_bounds_parallel_f64(
+    const lm2_r3_f64* bounds,
+    size_t count,
+    lm2_bvh3_node_f64* nodes,
+    size_t node_buffer_size,
+    uint32_t* primitive_indices,
+    size_t index_buffer_size,
+    uint32_t thread_count);
+
+LM2_API uint32_t lm2_bvh3_build_bounds_parallel_f32(
+    const lm2_r3_f32* bounds,
+    size_t count,
+    lm2_bvh3_node_f32* nodes,
+    size_t node_buffer_size,
+    uint32_t* primitive_indices,
+    size_t index_buffer_size,
+    uint32_t thread_count);
+
+// Refit a box hierarchy to updated bounds (same array layout as for the build)
+LM2_API void lm2_bvh3_refit_bounds_f64(
+    lm2_bvh3_node_f64* nodes,
+    uint32_t node_count,
+    const uint32_t* primitive_indices,
+    const lm2_r3_f64* bounds);
+
+LM2_API void lm2_bvh3_refit_bounds_f32(
+    lm2_bvh3_node_f32* nodes,
+    uint32_t node_count,
+    const uint32_t* primitive_indices,
+    const lm2_r3_f32* bounds);
+
+// Refit a triangle BVH after its vertices moved (same triangle count and indices)
+LM2_API void lm2_bvh3_refit_f64(lm2_bvh3_f64* bvh);
+LM2_API void lm2_bvh3_refit_f32(lm2_bvh3_f32* bvh);
+
+// =============================================================================
+// Ray Queries
+// =============================================================================
+
+// Closest hit along the ray (same hit rules as lm2_raycast_triangle)
+LM2_API lm2_bvh3_hit_f64 lm2_bvh3_raycast_f64(const lm2_bvh3_f64* bvh, lm2_ray3_f64 ray);
+LM2_API lm2_bvh3_hit_f32 lm2_bvh3_raycast_f32(const lm2_bvh3_f32* bvh, lm2_ray3_f32 ray);
+
+// Any hit along the ray, returning the first triangle found (line of sight, shadow rays)
+LM2_API lm2_bvh3_hit_f64 lm2_bvh3_raycast_any_f64(const lm2_bvh3_f64* bvh, lm2_ray3_f64 ray);
+LM2_API lm2_bvh3_hit_f32 lm2_bvh3_raycast_any_f32(const lm2_bvh3_f32* bvh, lm2_ray3_f32 ray);
+
+// Get the vertices of triangle triangle_index of the BVH source geometry
+LM2_API void lm2_bvh3_get_triangle_f64(const lm2_bvh3_f64* bvh, uint32_t triangle_index, lm2_triangle3_f64 tri);
+LM2_API void lm2_bvh3_get_triangle_f32(const lm2_bvh3_f32* bvh, uint32_t triangle_index, lm2_triangle3_f32 tri);
+
+// #############################################################################
+LM2_HEADER_END;
+// #############################################################################
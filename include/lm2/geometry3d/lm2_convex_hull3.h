@@ -0,0 +1,83 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "lm2/geometry3d/lm2_triangle3_geometry.h"
+#include "lm2/lm2_base.h"
+#include "lm2/vectors/lm2_vector3.h"
+
+// #############################################################################
+LM2_HEADER_BEGIN;
+// #############################################################################
+
+// =============================================================================
+// Convex Hull of a Point Set
+// =============================================================================
+// Quickhull: start from a tetrahedron of extreme points, then repeatedly take
+// the point farthest outside a face, remove the faces it sees and close the
+// hole with a fan of triangles to that point. Points within a small tolerance
+// of a face (scaled by the coordinate magnitudes) count as inside, so nearly
+// coplanar faces are not split further.
+//
+// Large inputs are cut into chunks of 32768 points. Each chunk builds its hull
+// on one of thread_count threads (0 = one per hardware thread), and the hull of
+// all chunk hull vertices is the result. Points with a NaN or infinite
+// coordinate are ignored.
+//
+// The result is an indexed triangle mesh: the hull vertices in order of first
+// use, and triangles that are counter-clockwise seen from outside, so
+// lm2_triangle3_normal points out of the hull. Faces are not merged, so a flat
+// side of the hull comes out as several coplanar triangles.
+
+// Compute the convex hull of point_count points as an indexed mesh
+// out_vertices: vertex_capacity entries (or NULL with vertex_capacity 0)
+// out_indices: index_capacity entries (or NULL with index_capacity 0)
+// Returns: vertex and index counts of the hull. The buffers are only written
+//          when both are large enough, so a call with empty buffers sizes them.
+//          Both counts are 0 when the points do not span a volume or memory
+//          could not be allocated.
+LM2_API lm2_indexed_mesh3_size lm2_convex_hull3_f64(
+    const lm2_v3_f64* points,
+    size_t point_count,
+    lm2_v3_f64* out_vertices,
+    size_t vertex_capacity,
+    uint32_t* out_indices,
+    size_t index_capacity,
+    uint32_t thread_count);
+
+LM2_API lm2_indexed_mesh3_size lm2_convex_hull3_f32(
+    const lm2_v3_f32* points,
+    size_t point_count,
+    lm2_v3_f32* out_vertices,
+    size_t vertex_capacity,
+    uint32_t* out_indices,
+    size_t index_capacity,
+    uint32_t thread_count);
+
+// #############################################################################
+LM2_HEADER_END;
+// #############################################################################
@@ -0,0 +1,145 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "lm2/camera/lm2_camera3.h"
+#include "lm2/geometry3d/lm2_plane3.h"
+#include "lm2/geometry3d/lm2_sphere.h"
+#include "lm2/lm2_base.h"
+#include "lm2/matrices/lm2_matrix4x4.h"
+#include "lm2/ranges/lm2_range3.h"
+
+// #############################################################################
+LM2_HEADER_BEGIN;
+// #############################################################################
+
+// =============================================================================
+// View Frustum
+// =============================================================================
+// Six planes with unit normals pointing into the frustum. A point p is inside
+// a plane when lm2_plane3_distance_to_point(plane, p) >= 0.
+//
+// The planes are extracted from a view-projection matrix that maps world
+// space to clip space with column vectors and depth in [-1, 1], the
+// convention of lm2_m4x4_perspective, lm2_m4x4_ortho and lm2_camera3.
+//
+// Culling is conservative: a box or sphere is rejected only when it lies
+// entirely outside one plane. Large shapes near a frustum corner can pass
+// although they miss the frustum; they are never rejected wrongly.
+//
+// Plane masks select the planes to test, bit i for plane i. A shape that is
+// fully inside a plane is fully inside it for everything it contains, so a
+// hierarchy passes the mask a node returned down to its children and stops
+// testing planes early. A mask of 0 means the node is inside the frustum.
+
+// Plane order in lm2_frustum3_f64/f32
+typedef enum lm2_frustum3_plane {
+  LM2_FRUSTUM3_LEFT,
+  LM2_FRUSTUM3_RIGHT,
+  LM2_FRUSTUM3_BOTTOM,
+  LM2_FRUSTUM3_TOP,
+  LM2_FRUSTUM3_NEAR,
+  LM2_FRUSTUM3_FAR,
+  LM2_FRUSTUM3_PLANE_COUNT,
+} lm2_frustum3_plane;
+
+// Plane mask with every plane set
+#define LM2_FRUSTUM3_ALL_PLANES 0x3Fu
+
+// Where a shape lies relative to the frustum
+typedef enum lm2_frustum3_result {
+  LM2_FRUSTUM3_OUTSIDE,       // Entirely outside at least one plane
+  LM2_FRUSTUM3_INTERSECTING,  // Crosses at least one of the tested planes
+  LM2_FRUSTUM3_INSIDE,        // Inside every tested plane
+} lm2_frustum3_result;
+
+typedef struct lm2_frustum3_f64 {
+  lm2_plane3_f64 planes[LM2_FRUSTUM3_PLANE_COUNT];
+} lm2_frustum3_f64;
+
+typedef struct lm2_frustum3_f32 {
+  lm2_plane3_f32 planes[LM2_FRUSTUM3_PLANE_COUNT];
+} lm2_frustum3_f32;
+
+// =============================================================================
+// Construction
+// =============================================================================
+
+// Extract the planes of a view-projection matrix (clip = m * world)
+LM2_API lm2_frustum3_f64 lm2_frustum3_from_matrix_f64(lm2_m4x4_f64 view_projection);
+LM2_API lm2_frustum3_f32 lm2_frustum3_from_matrix_f32(lm2_m4x4_f32 view_projection);
+
+// Frustum of a camera (perspective or orthographic)
+LM2_API lm2_frustum3_f64 lm2_frustum3_from_camera_f64(lm2_camera3_f64 camera);
+LM2_API lm2_frustum3_f32 lm2_frustum3_from_camera_f32(lm2_camera3_f32 camera);
+
+// =============================================================================
+// Single Shape Tests
+// =============================================================================
+
+// Test a point against every plane
+LM2_API bool lm2_frustum3_contains_point_f64(const lm2_frustum3_f64* frustum, lm2_v3_f64 point);
+LM2_API bool lm2_frustum3_contains_point_f32(const lm2_frustum3_f32* frustum, lm2_v3_f32 point);
+
+// Classify a box against the planes in plane_mask
+// out_plane_mask: the planes the box crosses, to pass to its children (or NULL)
+LM2_API lm2_frustum3_result lm2_frustum3_classify_aabb_f64(const lm2_frustum3_f64* frustum, lm2_r3_f64 box, uint32_t plane_mask, uint32_t* out_plane_mask);
+LM2_API lm2_frustum3_result lm2_frustum3_classify_aabb_f32(const lm2_frustum3_f32* frustum, lm2_r3_f32 box, uint32_t plane_mask, uint32_t* out_plane_mask);
+
+// Classify a sphere against the planes in plane_mask
+// out_plane_mask: the planes the sphere crosses (or NULL)
+LM2_API lm2_frustum3_result lm2_frustum3_classify_sphere_f64(const lm2_frustum3_f64* frustum, lm2_sphere_f64 sphere, uint32_t plane_mask, uint32_t* out_plane_mask);
+LM2_API lm2_frustum3_result lm2_frustum3_classify_sphere_f32(const lm2_frustum3_f32* frustum, lm2_sphere_f32 sphere, uint32_t plane_mask, uint32_t* out_plane_mask);
+
+// =============================================================================
+// Batch Culling
+// =============================================================================
+// Test arrays of boxes or spheres against the planes in plane_mask. Each shape
+// is tested against all six planes at once with SIMD lanes. Use
+// LM2_FRUSTUM3_ALL_PLANES, or the mask returned for a node that contains all
+// the shapes.
+//
+// The bitmask variants write (count + 31) / 32 words: bit i % 32 of word
+// i / 32 is set when shape i is visible. The index variants write the indices
+// of the visible shapes in increasing order and need room for count indices.
+// Both return the number of visible shapes.
+
+LM2_API size_t lm2_frustum3_cull_aabbs_f64(const lm2_frustum3_f64* frustum, const lm2_r3_f64* boxes, size_t count, uint32_t plane_mask, uint32_t* out_visible);
+LM2_API size_t lm2_frustum3_cull_aabbs_f32(const lm2_frustum3_f32* frustum, const lm2_r3_f32* boxes, size_t count, uint32_t plane_mask, uint32_t* out_visible);
+
+LM2_API size_t lm2_frustum3_cull_spheres_f64(const lm2_frustum3_f64* frustum, const lm2_sphere_f64* spheres, size_t count, uint32_t plane_mask, uint32_t* out_visible);
+LM2_API size_t lm2_frustum3_cull_spheres_f32(const lm2_frustum3_f32* frustum, const lm2_sphere_f32* spheres, size_t count, uint32_t plane_mask, uint32_t* out_visible);
+
+LM2_API size_t lm2_frustum3_cull_aabbs_to_indices_f64(const lm2_frustum3_f64* frustum, const lm2_r3_f64* boxes, size_t count, uint32_t plane_mask, uint32_t* out_indices);
+LM2_API size_t lm2_frustum3_cull_aabbs_to_indices_f32(const lm2_frustum3_f32* frustum, const lm2_r3_f32* boxes, size_t count, uint32_t plane_mask, uint32_t* out_indices);
+
+LM2_API size_t lm2_frustum3_cull_spheres_to_indices_f64(const lm2_frustum3_f64* frustum, const lm2_sphere_f64* spheres, size_t count, uint32_t plane_mask, uint32_t* out_indices);
+LM2_API size_t lm2_frustum3_cull_spheres_to_indices_f32(const lm2_frustum3_f32* frustum, const lm2_sphere_f32* spheres, size_t count, uint32_t plane_mask, uint32_t* out_indices);
+
+// #############################################################################
+LM2_HEADER_END;
+// #############################################################################
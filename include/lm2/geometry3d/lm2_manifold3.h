@@ -0,0 +1,176 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include "lm2/geometry3d/lm2_aabb3.h"
+#include "lm2/geometry3d/lm2_capsule3.h"
+#include "lm2/geometry3d/lm2_shape3.h"
+#include "lm2/geometry3d/lm2_sphere.h"
+#include "lm2/geometry3d/lm2_triangle3.h"
+#include "lm2/lm2_base.h"
+#include "lm2/vectors/lm2_vector3.h"
+
+// #############################################################################
+LM2_HEADER_BEGIN;
+// #############################################################################
+
+// =============================================================================
+// 3D Collision Manifolds
+// =============================================================================
+// Every 3D shape is a convex point set (its core) grown by a radius: a sphere
+// is a point, a capsule and an edge are segments, a triangle and an AABB are
+// their corners. GJK finds the distance between the cores and the radii are
+// subtracted afterwards, so rounded shapes never need a curved support
+// function. When the cores themselves overlap, EPA expands the final GJK
+// simplex to find the penetration depth.
+//
+// Sphere, capsule, AABB-sphere and capsule-triangle pairs have closed form
+// fast paths. lm2_manifold3_shape_to_shape picks them by shape type and
+// routes every other pair through GJK/EPA.
+//
+// Normals point from A to B. Contact points lie on the surface of B.
+
+// Most vertices a proxy can hold (an AABB has 8 corners)
+#define LM2_GJK3_MAX_VERTICES 8
+
+// =============================================================================
+// Manifold and GJK Types
+// =============================================================================
+
+// Collision manifold structure to describe how 3D shapes collide
+typedef struct lm2_manifold3_f64 {
+  int count;                     // Number of contact points (0, 1, or 2)
+  double depths[2];              // Penetration depths
+  lm2_v3_f64 contact_points[2];  // Contact points
+  lm2_v3_f64 normal;             // Collision normal (from A to B)
+} lm2_manifold3_f64;
+
+typedef struct lm2_manifold3_f32 {
+  int count;                     // Number of contact points (0, 1, or 2)
+  float depths[2];               // Penetration depths
+  lm2_v3_f32 contact_points[2];  // Contact points
+  lm2_v3_f32 normal;             // Collision normal (from A to B)
+} lm2_manifold3_f32;
+
+// Convex point set with a radius, the input to GJK
+typedef struct lm2_gjk3_proxy_f64 {
+  lm2_v3_f64 vertices[LM2_GJK3_MAX_VERTICES];
+  int count;
+  double radius;
+} lm2_gjk3_proxy_f64;
+
+typedef struct lm2_gjk3_proxy_f32 {
+  lm2_v3_f32 vertices[LM2_GJK3_MAX_VERTICES];
+  int count;
+  float radius;
+} lm2_gjk3_proxy_f32;
+
+// Final GJK simplex as proxy vertex indices. Zero-initialize it for a cold
+// start and keep it per pair: the next query starts from the cached simplex,
+// so a pair that moved a little converges in one or two iterations.
+typedef struct lm2_gjk3_cache {
+  uint8_t count;
+  uint8_t index_a[4];
+  uint8_t index_b[4];
+} lm2_gjk3_cache;
+
+// GJK distance query result
+typedef struct lm2_gjk3_result_f64 {
+  lm2_v3_f64 point_a;  // Closest point on the surface of A
+  lm2_v3_f64 point_b;  // Closest point on the surface of B
+  lm2_v3_f64 normal;   // Unit vector from A to B, zero when the cores overlap
+  double distance;     // Surface distance, negative when the shapes overlap
+  int iterations;      // Number of support queries
+} lm2_gjk3_result_f64;
+
+typedef struct lm2_gjk3_result_f32 {
+  lm2_v3_f32 point_a;  // Closest point on the surface of A
+  lm2_v3_f32 point_b;  // Closest point on the surface of B
+  lm2_v3_f32 normal;   // Unit vector from A to B, zero when the cores overlap
+  float distance;      // Surface distance, negative when the shapes overlap
+  int iterations;      // Number of support queries
+} lm2_gjk3_result_f32;
+
+// =============================================================================
+// GJK / EPA
+// =============================================================================
+
+// Build the proxy of any shape
+LM2_API lm2_gjk3_proxy_f64 lm2_gjk3_proxy_from_shape_f64(lm2_shape3_f64 shape);
+LM2_API lm2_gjk3_proxy_f32 lm2_gjk3_proxy_from_shape_f32(lm2_shape3_f32 shape);
+
+// Distance between two proxies. cache may be NULL.
+// When the cores overlap the distance is -(radius_a + radius_b); use the manifold for the real depth.
+LM2_API lm2_gjk3_result_f64 lm2_gjk3_distance_f64(const lm2_gjk3_proxy_f64* a, const lm2_gjk3_proxy_f64* b, lm2_gjk3_cache* cache);
+LM2_API lm2_gjk3_result_f32 lm2_gjk3_distance_f32(const lm2_gjk3_proxy_f32* a, const lm2_gjk3_proxy_f32* b, lm2_gjk3_cache* cache);
+
+// Manifold of two proxies (GJK, then EPA when the cores overlap). cache may be NULL.
+LM2_API void lm2_manifold3_proxy_to_proxy_f64(const lm2_gjk3_proxy_f64* a, const lm2_gjk3_proxy_f64* b, lm2_gjk3_cache* cache, lm2_manifold3_f64* out_manifold);
+LM2_API void lm2_manifold3_proxy_to_proxy_f32(const lm2_gjk3_proxy_f32* a, const lm2_gjk3_proxy_f32* b, lm2_gjk3_cache* cache, lm2_manifold3_f32* out_manifold);
+
+// =============================================================================
+// Manifold Generation Fast Paths
+// =============================================================================
+
+// Sphere to Sphere Manifold
+LM2_API void lm2_manifold3_sphere_to_sphere_f64(lm2_sphere_f64 a, lm2_sphere_f64 b, lm2_manifold3_f64* out_manifold);
+LM2_API void lm2_manifold3_sphere_to_sphere_f32(lm2_sphere_f32 a, lm2_sphere_f32 b, lm2_manifold3_f32* out_manifold);
+
+// Sphere to Capsule Manifold
+LM2_API void lm2_manifold3_sphere_to_capsule_f64(lm2_sphere_f64 sphere, lm2_capsule3_f64 capsule, lm2_manifold3_f64* out_manifold);
+LM2_API void lm2_manifold3_sphere_to_capsule_f32(lm2_sphere_f32 sphere, lm2_capsule3_f32 capsule, lm2_manifold3_f32* out_manifold);
+
+// Sphere to AABB Manifold
+LM2_API void lm2_manifold3_sphere_to_aabb_f64(lm2_sphere_f64 sphere, lm2_aabb3_f64 aabb, lm2_manifold3_f64* out_manifold);
+LM2_API void lm2_manifold3_sphere_to_aabb_f32(lm2_sphere_f32 sphere, lm2_aabb3_f32 aabb, lm2_manifold3_f32* out_manifold);
+
+// Sphere to Triangle Manifold
+LM2_API void lm2_manifold3_sphere_to_triangle_f64(lm2_sphere_f64 sphere, const lm2_triangle3_f64 triangle, lm2_manifold3_f64* out_manifold);
+LM2_API void lm2_manifold3_sphere_to_triangle_f32(lm2_sphere_f32 sphere, const lm2_triangle3_f32 triangle, lm2_manifold3_f32* out_manifold);
+
+// Capsule to Capsule Manifold (two contacts when the capsules lie side by side)
+LM2_API void lm2_manifold3_capsule_to_capsule_f64(lm2_capsule3_f64 a, lm2_capsule3_f64 b, lm2_manifold3_f64* out_manifold);
+LM2_API void lm2_manifold3_capsule_to_capsule_f32(lm2_capsule3_f32 a, lm2_capsule3_f32 b, lm2_manifold3_f32* out_manifold);
+
+// Capsule to Triangle Manifold (two contacts when the capsule lies on the face)
+LM2_API void lm2_manifold3_capsule_to_triangle_f64(lm2_capsule3_f64 capsule, const lm2_triangle3_f64 triangle, lm2_manifold3_f64* out_manifold);
+LM2_API void lm2_manifold3_capsule_to_triangle_f32(lm2_capsule3_f32 capsule, const lm2_triangle3_f32 triangle, lm2_manifold3_f32* out_manifold);
+
+// =============================================================================
+// Generic Shape Collision
+// =============================================================================
+
+// Check if two shapes overlap
+LM2_API bool lm2_collide3_shape_to_shape_f64(lm2_shape3_f64 shape_a, lm2_shape3_f64 shape_b);
+LM2_API bool lm2_collide3_shape_to_shape_f32(lm2_shape3_f32 shape_a, lm2_shape3_f32 shape_b);
+
+// Manifold of any two shapes. cache may be NULL and is only used by the GJK/EPA path.
+LM2_API void lm2_manifold3_shape_to_shape_f64(lm2_shape3_f64 shape_a, lm2_shape3_f64 shape_b, lm2_gjk3_cache* cache, lm2_manifold3_f64* out_manifold);
+LM2_API void lm2_manifold3_shape_to_shape_f32(lm2_shape3_f32 shape_a, lm2_shape3_f32 shape_b, lm2_gjk3_cache* cache, lm2_manifold3_f32* out_manifold);
+
+// #############################################################################
+LM2_HEADER_END;
+// #############################################################################
@@ -0,0 +1,165 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "lm2/lm2_base.h"
+#include "lm2/vectors/lm2_vector2.h"
+#include "lm2/vectors/lm2_vector3.h"
+
+// #############################################################################
+LM2_HEADER_BEGIN;
+// #############################################################################
+
+// =============================================================================
+// Index Buffer Optimization
+// =============================================================================
+// Reordering passes for indexed triangle meshes such as the ones produced by
+// lm2_triangle3_list_to_indexed_mesh and lm2_triangle2_list_to_indexed_mesh.
+// Neither pass changes what is drawn: triangles keep their winding, and the
+// vertex data is only permuted.
+//
+// The vertex cache pass reorders triangles so that consecutive triangles
+// share vertices, following Tom Forsyth's linear-speed vertex cache
+// optimisation with a 32 entry LRU model. The result is not tuned to one
+// cache size and suits the FIFO post-transform caches of 16 to 32 entries
+// of current GPUs.
+//
+// The vertex fetch pass renumbers vertices in the order of their first use in
+// the index buffer, so that the vertex shader reads the vertex buffer mostly
+// front to back. Run it after the vertex cache pass, which decides that
+// order. Vertices that no triangle references are dropped.
+//
+// Index buffers hold index_count / 3 triangles; every index must be below
+// vertex_count.
+
+// Marks a vertex that no triangle references in a remap table
+#define LM2_MESH_UNUSED_VERTEX UINT32_MAX
+
+// Post-transform cache statistics of an index buffer
+typedef struct lm2_mesh_vertex_cache_stats {
+  size_t vertices_transformed;  // Cache misses, each one a vertex shader run
+  double acmr;                  // Average cache miss ratio: misses per triangle, 0.5 at best, 3 at worst
+  double atvr;                  // Average transformed vertex ratio: misses per referenced vertex, 1 at best
+} lm2_mesh_vertex_cache_stats;
+
+// Vertex buffer read statistics of an index buffer
+typedef struct lm2_mesh_vertex_fetch_stats {
+  size_t bytes_fetched;  // Bytes read from memory in whole 64 byte lines
+  double overfetch;      // bytes_fetched over the size of the referenced vertices, 1 at best
+} lm2_mesh_vertex_fetch_stats;
+
+// Reorder triangles for the post-transform vertex cache
+// destination: index_count indices, may be the same buffer as indices
+LM2_API void lm2_mesh_optimize_vertex_cache(
+    uint32_t* destination,
+    const uint32_t* indices,
+    size_t index_count,
+    size_t vertex_count);
+
+// Compute the table that renumbers vertices in first-use order
+// remap: vertex_count entries, remap[old] = new index or LM2_MESH_UNUSED_VERTEX
+// Returns: number of referenced vertices
+LM2_API size_t lm2_mesh_vertex_fetch_remap(
+    uint32_t* remap,
+    const uint32_t* indices,
+    size_t index_count,
+    size_t vertex_count);
+
+// Apply a remap table to an index buffer
+// destination: index_count indices, may be the same buffer as indices
+LM2_API void lm2_mesh_remap_indices(
+    uint32_t* destination,
+    const uint32_t* indices,
+    size_t index_count,
+    const uint32_t* remap);
+
+// Apply a remap table to vertices of any layout
+// destination: room for the referenced vertices, must not overlap vertices
+LM2_API void lm2_mesh_remap_vertices(
+    void* destination,
+    const void* vertices,
+    size_t vertex_count,
+    size_t vertex_size,
+    const uint32_t* remap);
+
+// =============================================================================
+// Vertex Fetch Optimization
+// =============================================================================
+// Remap indices in place and write the referenced vertices in first-use order
+// destination: room for vertex_count vertices, must not overlap vertices
+// Returns: number of vertices written
+
+LM2_API size_t lm2_mesh_optimize_vertex_fetch3_f64(
+    lm2_v3_f64* destination,
+    uint32_t* indices,
+    size_t index_count,
+    const lm2_v3_f64* vertices,
+    size_t vertex_count);
+
+LM2_API size_t lm2_mesh_optimize_vertex_fetch3_f32(
+    lm2_v3_f32* destination,
+    uint32_t* indices,
+    size_t index_count,
+    const lm2_v3_f32* vertices,
+    size_t vertex_count);
+
+LM2_API size_t lm2_mesh_optimize_vertex_fetch2_f64(
+    lm2_v2_f64* destination,
+    uint32_t* indices,
+    size_t index_count,
+    const lm2_v2_f64* vertices,
+    size_t vertex_count);
+
+LM2_API size_t lm2_mesh_optimize_vertex_fetch2_f32(
+    lm2_v2_f32* destination,
+    uint32_t* indices,
+    size_t index_count,
+    const lm2_v2_f32* vertices,
+    size_t vertex_count);
+
+// =============================================================================
+// Analysis
+// =============================================================================
+
+// Simulate a FIFO post-transform cache of cache_size vertices
+LM2_API lm2_mesh_vertex_cache_stats lm2_mesh_analyze_vertex_cache(
+    const uint32_t* indices,
+    size_t index_count,
+    size_t vertex_count,
+    uint32_t cache_size);
+
+// Simulate vertex buffer reads through a 16 KiB direct-mapped cache of 64 byte lines
+// vertex_size: stride of the vertex buffer in bytes
+LM2_API lm2_mesh_vertex_fetch_stats lm2_mesh_analyze_vertex_fetch(
+    const uint32_t* indices,
+    size_t index_count,
+    size_t vertex_count,
+    size_t vertex_size);
+
+// #############################################################################
+LM2_HEADER_END;
+// #############################################################################
@@ -0,0 +1,197 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include "lm2/geometry3d/lm2_raycast3.h"
+#include "lm2/lm2_base.h"
+#include "lm2/ranges/lm2_range3.h"
+#include "lm2/vectors/lm2_vector3.h"
+
+// #############################################################################
+LM2_HEADER_BEGIN;
+// #############################################################################
+
+// =============================================================================
+// Ray Packets (3D)
+// =============================================================================
+// Four or eight rays stored component by component, so one SIMD register holds
+// the same component of every ray: origin_x[k] is the x of lane k's origin.
+// Coherent rays, such as the primary rays of neighbouring pixels, are traced
+// together one packet at a time.
+//
+// A lane with t_max <= 0 is inactive: it carries no ray and reports no hit.
+// Packets that cover less than their full width leave the missing lanes
+// inactive.
+//
+// The packet raycasts test every lane against one shape without branching
+// per lane, and return a bitmask with bit k set when lane k hit. Only the
+// lanes set in active_mask are tested, so a traversal can drop the lanes that
+// left a subtree. For those that hit, the hit distance and normal are written
+// to lane k of hits (NULL to get the mask only, e.g. for shadow rays) and bit
+// k of hits->hit_mask is set. A lane that already holds a hit only hits again
+// closer than hits->t, so casting a packet against many shapes with the same
+// zero-initialized hits keeps the closest hit per lane.
+//
+// The hits match lm2_raycast_aabb3 and lm2_raycast_triangle. A ray starting
+// inside a box hits it at t = 0; its normal is zero, where the single-ray
+// raycast guesses a face. Box normals otherwise belong to the face the ray
+// enters through. Triangle normals are those of the winding, not flipped
+// towards the ray.
+
+#define LM2_RAY3_PACKET4_WIDTH 4
+#define LM2_RAY3_PACKET8_WIDTH 8
+
+// =============================================================================
+// Ray Packet Types - f64
+// =============================================================================
+
+typedef struct lm2_ray3_packet4_f64 {
+  double origin_x[LM2_RAY3_PACKET4_WIDTH];     // Origin x per lane
+  double origin_y[LM2_RAY3_PACKET4_WIDTH];     // Origin y per lane
+  double origin_z[LM2_RAY3_PACKET4_WIDTH];     // Origin z per lane
+  double direction_x[LM2_RAY3_PACKET4_WIDTH];  // Direction x per lane (normalized)
+  double direction_y[LM2_RAY3_PACKET4_WIDTH];  // Direction y per lane (normalized)
+  double direction_z[LM2_RAY3_PACKET4_WIDTH];  // Direction z per lane (normalized)
+  double t_max[LM2_RAY3_PACKET4_WIDTH];        // Maximum distance per lane, <= 0 when inactive
+} lm2_ray3_packet4_f64;
+
+typedef struct lm2_ray3_packet8_f64 {
+  double origin_x[LM2_RAY3_PACKET8_WIDTH];     // Origin x per lane
+  double origin_y[LM2_RAY3_PACKET8_WIDTH];     // Origin y per lane
+  double origin_z[LM2_RAY3_PACKET8_WIDTH];     // Origin z per lane
+  double direction_x[LM2_RAY3_PACKET8_WIDTH];  // Direction x per lane (normalized)
+  double direction_y[LM2_RAY3_PACKET8_WIDTH];  // Direction y per lane (normalized)
+  double direction_z[LM2_RAY3_PACKET8_WIDTH];  // Direction z per lane (normalized)
+  double t_max[LM2_RAY3_PACKET8_WIDTH];        // Maximum distance per lane, <= 0 when inactive
+} lm2_ray3_packet8_f64;
+
+typedef struct lm2_rayhit3_packet4_f64 {
+  double t[LM2_RAY3_PACKET4_WIDTH];         // Hit distance per lane
+  double normal_x[LM2_RAY3_PACKET4_WIDTH];  // Hit normal x per lane
+  double normal_y[LM2_RAY3_PACKET4_WIDTH];  // Hit normal y per lane
+  double normal_z[LM2_RAY3_PACKET4_WIDTH];  // Hit normal z per lane
+  uint32_t hit_mask;                     // Bit k set when lane k holds a hit
+} lm2_rayhit3_packet4_f64;
+
+typedef struct lm2_rayhit3_packet8_f64 {
+  double t[LM2_RAY3_PACKET8_WIDTH];         // Hit distance per lane
+  double normal_x[LM2_RAY3_PACKET8_WIDTH];  // Hit normal x per lane
+  double normal_y[LM2_RAY3_PACKET8_WIDTH];  // Hit normal y per lane
+  double normal_z[LM2_RAY3_PACKET8_WIDTH];  // Hit normal z per lane
+  uint32_t hit_mask;                     // Bit k set when lane k holds a hit
+} lm2_rayhit3_packet8_f64;
+
+// =============================================================================
+// Ray Packet Functions - f64
+// =============================================================================
+
+// Lane access, lane must be below the packet width
+LM2_API lm2_ray3_f64 lm2_ray3_packet4_get_f64(const lm2_ray3_packet4_f64* packet, uint32_t lane);
+LM2_API void lm2_ray3_packet4_set_f64(lm2_ray3_packet4_f64* packet, uint32_t lane, lm2_ray3_f64 ray);
+LM2_API lm2_ray3_f64 lm2_ray3_packet8_get_f64(const lm2_ray3_packet8_f64* packet, uint32_t lane);
+LM2_API void lm2_ray3_packet8_set_f64(lm2_ray3_packet8_f64* packet, uint32_t lane, lm2_ray3_f64 ray);
+
+// Bit k set when lane k is active
+LM2_API uint32_t lm2_ray3_packet4_active_mask_f64(const lm2_ray3_packet4_f64* packet);
+LM2_API uint32_t lm2_ray3_packet8_active_mask_f64(const lm2_ray3_packet8_f64* packet);
+
+// Lane k of a packet hit as a single hit, point included
+LM2_API lm2_rayhit3_f64 lm2_rayhit3_packet4_get_f64(const lm2_rayhit3_packet4_f64* hits, const lm2_ray3_packet4_f64* packet, uint32_t lane);
+LM2_API lm2_rayhit3_f64 lm2_rayhit3_packet8_get_f64(const lm2_rayhit3_packet8_f64* hits, const lm2_ray3_packet8_f64* packet, uint32_t lane);
+
+// Packet raycasts, return the lanes that hit; hits may be NULL
+LM2_API uint32_t lm2_raycast_packet4_aabb3_f64(const lm2_ray3_packet4_f64* packet, uint32_t active_mask, lm2_r3_f64 aabb, lm2_rayhit3_packet4_f64* hits);
+LM2_API uint32_t lm2_raycast_packet8_aabb3_f64(const lm2_ray3_packet8_f64* packet, uint32_t active_mask, lm2_r3_f64 aabb, lm2_rayhit3_packet8_f64* hits);
+LM2_API uint32_t lm2_raycast_packet4_triangle_f64(const lm2_ray3_packet4_f64* packet, uint32_t active_mask, lm2_v3_f64 v0, lm2_v3_f64 v1, lm2_v3_f64 v2, lm2_rayhit3_packet4_f64* hits);
+LM2_API uint32_t lm2_raycast_packet8_triangle_f64(const lm2_ray3_packet8_f64* packet, uint32_t active_mask, lm2_v3_f64 v0, lm2_v3_f64 v1, lm2_v3_f64 v2, lm2_rayhit3_packet8_f64* hits);
+
+// =============================================================================
+// Ray Packet Types - f32
+// =============================================================================
+
+typedef struct lm2_ray3_packet4_f32 {
+  float origin_x[LM2_RAY3_PACKET4_WIDTH];     // Origin x per lane
+  float origin_y[LM2_RAY3_PACKET4_WIDTH];     // Origin y per lane
+  float origin_z[LM2_RAY3_PACKET4_WIDTH];     // Origin z per lane
+  float direction_x[LM2_RAY3_PACKET4_WIDTH];  // Direction x per lane (normalized)
+  float direction_y[LM2_RAY3_PACKET4_WIDTH];  // Direction y per lane (normalized)
+  float direction_z[LM2_RAY3_PACKET4_WIDTH];  // Direction z per lane (normalized)
+  float t_max[LM2_RAY3_PACKET4_WIDTH];        // Maximum distance per lane, <= 0 when inactive
+} lm2_ray3_packet4_f32;
+
+typedef struct lm2_ray3_packet8_f32 {
+  float origin_x[LM2_RAY3_PACKET8_WIDTH];     // Origin x per lane
+  float origin_y[LM2_RAY3_PACKET8_WIDTH];     // Origin y per lane
+  float origin_z[LM2_RAY3_PACKET8_WIDTH];     // Origin z per lane
+  float direction_x[LM2_RAY3_PACKET8_WIDTH];  // Direction x per lane (normalized)
+  float direction_y[LM2_RAY3_PACKET8_WIDTH];  // Direction y per lane (normalized)
+  float direction_z[LM2_RAY3_PACKET8_WIDTH];  // Direction z per lane (normalized)
+  float t_max[LM2_RAY3_PACKET8_WIDTH];        // Maximum distance per lane, <= 0 when inactive
+} lm2_ray3_packet8_f32;
+
+typedef struct lm2_rayhit3_packet4_f32 {
+  float t[LM2_RAY3_PACKET4_WIDTH];         // Hit distance per lane
+  float normal_x[LM2_RAY3_PACKET4_WIDTH];  // Hit normal x per lane
+  float normal_y[LM2_RAY3_PACKET4_WIDTH];  // Hit normal y per lane
+  float normal_z[LM2_RAY3_PACKET4_WIDTH];  // Hit normal z per lane
+  uint32_t hit_mask;                     // Bit k set when lane k holds a hit
+} lm2_rayhit3_packet4_f32;
+
+typedef struct lm2_rayhit3_packet8_f32 {
+  float t[LM2_RAY3_PACKET8_WIDTH];         // Hit distance per lane
+  float normal_x[LM2_RAY3_PACKET8_WIDTH];  // Hit normal x per lane
+  float normal_y[LM2_RAY3_PACKET8_WIDTH];  // Hit normal y per lane
+  float normal_z[LM2_RAY3_PACKET8_WIDTH];  // Hit normal z per lane
+  uint32_t hit_mask;                     // Bit k set when lane k holds a hit
+} lm2_rayhit3_packet8_f32;
+
+// =============================================================================
+// Ray Packet Functions - f32
+// =============================================================================
+
+// Lane access, lane must be below the packet width
+LM2_API lm2_ray3_f32 lm2_ray3_packet4_get_f32(const lm2_ray3_packet4_f32* packet, uint32_t lane);
+LM2_API void lm2_ray3_packet4_set_f32(lm2_ray3_packet4_f32* packet, uint32_t lane, lm2_ray3_f32 ray);
+LM2_API lm2_ray3_f32 lm2_ray3_packet8_get_f32(const lm2_ray3_packet8_f32* packet, uint32_t lane);
+LM2_API void lm2_ray3_packet8_set_f32(lm2_ray3_packet8_f32* packet, uint32_t lane, lm2_ray3_f32 ray);
+
+// Bit k set when lane k is active
+LM2_API uint32_t lm2_ray3_packet4_active_mask_f32(const lm2_ray3_packet4_f32* packet);
+LM2_API uint32_t lm2_ray3_packet8_active_mask_f32(const lm2_ray3_packet8_f32* packet);
+
+// Lane k of a packet hit as a single hit, point included
+LM2_API lm2_rayhit3_f32 lm2_rayhit3_packet4_get_f32(const lm2_rayhit3_packet4_f32* hits, const lm2_ray3_packet4_f32* packet, uint32_t lane);
+LM2_API lm2_rayhit3_f32 lm2_rayhit3_packet8_get_f32(const lm2_rayhit3_packet8_f32* hits, const lm2_ray3_packet8_f32* packet, uint32_t lane);
+
+// Packet raycasts, return the lanes that hit; hits may be NULL
+LM2_API uint32_t lm2_raycast_packet4_aabb3_f32(const lm2_ray3_packet4_f32* packet, uint32_t active_mask, lm2_r3_f32 aabb, lm2_rayhit3_packet4_f32* hits);
+LM2_API uint32_t lm2_raycast_packet8_aabb3_f32(const lm2_ray3_packet8_f32* packet, uint32_t active_mask, lm2_r3_f32 aabb, lm2_rayhit3_packet8_f32* hits);
+LM2_API uint32_t lm2_raycast_packet4_triangle_f32(const lm2_ray3_packet4_f32* packet, uint32_t active_mask, lm2_v3_f32 v0, lm2_v3_f32 v1, lm2_v3_f32 v2, lm2_rayhit3_packet4_f32* hits);
+LM2_API uint32_t lm2_raycast_packet8_triangle_f32(const lm2_ray3_packet8_f32* packet, uint32_t active_mask, lm2_v3_f32 v0, lm2_v3_f32 v1, lm2_v3_f32 v2, lm2_rayhit3_packet8_f32* hits);
+
+// #############################################################################
+LM2_HEADER_END;
+// #############################################################################
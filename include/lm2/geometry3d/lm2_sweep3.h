@@ -0,0 +1,164 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include "lm2/geometry3d/lm2_bvh3.h"
+#include "lm2/geometry3d/lm2_capsule3.h"
+#include "lm2/geometry3d/lm2_sphere.h"
+#include "lm2/geometry3d/lm2_triangle3.h"
+#include "lm2/lm2_base.h"
+#include "lm2/vectors/lm2_vector3.h"
+
+// #############################################################################
+LM2_HEADER_BEGIN;
+// #############################################################################
+
+// =============================================================================
+// Swept Shape Queries
+// =============================================================================
+// Move a sphere or a capsule by delta against triangles and find the first
+// contact. The sweeps are closed form: a sphere against a triangle is a ray
+// against the triangle grown by the radius (its face plane, edge cylinders
+// and vertex spheres). A capsule adds its axis against the triangle edges
+// and the triangle vertices against its axis cylinder.
+//
+// Triangles are double sided. A shape that already overlaps a triangle hits
+// it at t = 0, but only when delta moves it further in, so a shape resting
+// on a surface can still slide along it or leave it.
+//
+// The mesh queries take a triangle list, an indexed mesh (the layouts of
+// lm2_triangle3_geometry.h) or a BVH over either. The BVH query visits the
+// nodes nearest along delta first and skips subtrees beyond the best hit.
+
+// Triangle feature touched by a sweep
+typedef enum lm2_sweep3_feature {
+  LM2_SWEEP3_FEATURE_FACE,    // Interior of the triangle
+  LM2_SWEEP3_FEATURE_EDGE,    // Edge feature_index: 0 = v0 v1, 1 = v1 v2, 2 = v2 v0
+  LM2_SWEEP3_FEATURE_VERTEX,  // Vertex feature_index
+} lm2_sweep3_feature;
+
+// Sweep query result
+typedef struct lm2_sweep3_hit_f64 {
+  bool hit;                    // Whether the shape touches a triangle along delta
+  double t;                    // Fraction of delta travelled at the first contact, in [0, 1]
+  lm2_v3_f64 point;            // Contact point on the triangle
+  lm2_v3_f64 normal;           // Contact normal, from the triangle towards the shape (unit length)
+  uint32_t triangle_index;     // Index of the hit triangle (0 for single triangle queries)
+  lm2_sweep3_feature feature;  // Triangle feature at the contact
+  uint32_t feature_index;      // Edge or vertex index of the feature (0 for faces)
+} lm2_sweep3_hit_f64;
+
+typedef struct lm2_sweep3_hit_f32 {
+  bool hit;                    // Whether the shape touches a triangle along delta
+  float t;                     // Fraction of delta travelled at the first contact, in [0, 1]
+  lm2_v3_f32 point;            // Contact point on the triangle
+  lm2_v3_f32 normal;           // Contact normal, from the triangle towards the shape (unit length)
+  uint32_t triangle_index;     // Index of the hit triangle (0 for single triangle queries)
+  lm2_sweep3_feature feature;  // Triangle feature at the contact
+  uint32_t feature_index;      // Edge or vertex index of the feature (0 for faces)
+} lm2_sweep3_hit_f32;
+
+// =============================================================================
+// Single Triangle
+// =============================================================================
+
+// Sweep a sphere by delta against the triangle v0 v1 v2
+LM2_API lm2_sweep3_hit_f64 lm2_sweep3_sphere_triangle_f64(lm2_sphere_f64 sphere, lm2_v3_f64 delta, lm2_v3_f64 v0, lm2_v3_f64 v1, lm2_v3_f64 v2);
+LM2_API lm2_sweep3_hit_f32 lm2_sweep3_sphere_triangle_f32(lm2_sphere_f32 sphere, lm2_v3_f32 delta, lm2_v3_f32 v0, lm2_v3_f32 v1, lm2_v3_f32 v2);
+
+// Sweep a capsule by delta against the triangle v0 v1 v2
+LM2_API lm2_sweep3_hit_f64 lm2_sweep3_capsule_triangle_f64(lm2_capsule3_f64 capsule, lm2_v3_f64 delta, lm2_v3_f64 v0, lm2_v3_f64 v1, lm2_v3_f64 v2);
+LM2_API lm2_sweep3_hit_f32 lm2_sweep3_capsule_triangle_f32(lm2_capsule3_f32 capsule, lm2_v3_f32 delta, lm2_v3_f32 v0, lm2_v3_f32 v1, lm2_v3_f32 v2);
+
+// =============================================================================
+// Triangle Lists and Indexed Meshes
+// =============================================================================
+// Every triangle whose bounds touch the swept bounds is tested. Use a BVH
+// for anything but small meshes.
+
+// Sweep a sphere against a triangle list
+LM2_API lm2_sweep3_hit_f64 lm2_sweep3_sphere_triangles_f64(lm2_sphere_f64 sphere, lm2_v3_f64 delta, const lm2_triangle3_f64* triangles, size_t triangle_count);
+LM2_API lm2_sweep3_hit_f32 lm2_sweep3_sphere_triangles_f32(lm2_sphere_f32 sphere, lm2_v3_f32 delta, const lm2_triangle3_f32* triangles, size_t triangle_count);
+
+// Sweep a capsule against a triangle list
+LM2_API lm2_sweep3_hit_f64 lm2_sweep3_capsule_triangles_f64(lm2_capsule3_f64 capsule, lm2_v3_f64 delta, const lm2_triangle3_f64* triangles, size_t triangle_count);
+LM2_API lm2_sweep3_hit_f32 lm2_sweep3_capsule_triangles_f32(lm2_capsule3_f32 capsule, lm2_v3_f32 delta, const lm2_triangle3_f32* triangles, size_t triangle_count);
+
+// Sweep a sphere against an indexed mesh (3 indices per triangle)
+LM2_API lm2_sweep3_hit_f64 lm2_sweep3_sphere_indexed_f64(lm2_sphere_f64 sphere, lm2_v3_f64 delta, const lm2_v3_f64* vertices, const uint32_t* indices, size_t index_count);
+LM2_API lm2_sweep3_hit_f32 lm2_sweep3_sphere_indexed_f32(lm2_sphere_f32 sphere, lm2_v3_f32 delta, const lm2_v3_f32* vertices, const uint32_t* indices, size_t index_count);
+
+// Sweep a capsule against an indexed mesh (3 indices per triangle)
+LM2_API lm2_sweep3_hit_f64 lm2_sweep3_capsule_indexed_f64(lm2_capsule3_f64 capsule, lm2_v3_f64 delta, const lm2_v3_f64* vertices, const uint32_t* indices, size_t index_count);
+LM2_API lm2_sweep3_hit_f32 lm2_sweep3_capsule_indexed_f32(lm2_capsule3_f32 capsule, lm2_v3_f32 delta, const lm2_v3_f32* vertices, const uint32_t* indices, size_t index_count);
+
+// =============================================================================
+// BVH Queries
+// =============================================================================
+
+// Sweep a sphere against the triangles of a BVH
+LM2_API lm2_sweep3_hit_f64 lm2_sweep3_sphere_bvh_f64(const lm2_bvh3_f64* bvh, lm2_sphere_f64 sphere, lm2_v3_f64 delta);
+LM2_API lm2_sweep3_hit_f32 lm2_sweep3_sphere_bvh_f32(const lm2_bvh3_f32* bvh, lm2_sphere_f32 sphere, lm2_v3_f32 delta);
+
+// Sweep a capsule against the triangles of a BVH
+LM2_API lm2_sweep3_hit_f64 lm2_sweep3_capsule_bvh_f64(const lm2_bvh3_f64* bvh, lm2_capsule3_f64 capsule, lm2_v3_f64 delta);
+LM2_API lm2_sweep3_hit_f32 lm2_sweep3_capsule_bvh_f32(const lm2_bvh3_f32* bvh, lm2_capsule3_f32 capsule, lm2_v3_f32 delta);
+
+// =============================================================================
+// Collide and Slide
+// =============================================================================
+// Character controller move: sweep the capsule along delta, stop skin short
+// of the first contact, remove the part of the remaining motion that goes
+// into the contact plane and sweep again with what is left. When two planes
+// meet in a crease the motion continues along the crease. A sphere is a
+// capsule with start == end.
+
+// Move a capsule by delta against a BVH, sliding along up to max_iterations contacts
+// skin: distance kept between the capsule and the surfaces it stops against
+// out_hits: max_iterations entries (or NULL), the contacts in order
+// out_hit_count: number of contacts written (or NULL)
+// Returns: displacement to apply to the capsule
+LM2_API lm2_v3_f64 lm2_sweep3_slide_capsule_f64(
+    const lm2_bvh3_f64* bvh,
+    lm2_capsule3_f64 capsule,
+    lm2_v3_f64 delta,
+    double skin,
+    int max_iterations,
+    lm2_sweep3_hit_f64* out_hits,
+    int* out_hit_count);
+
+LM2_API lm2_v3_f32 lm2_sweep3_slide_capsule_f32(
+    const lm2_bvh3_f32* bvh,
+    lm2_capsule3_f32 capsule,
+    lm2_v3_f32 delta,
+    float skin,
+    int max_iterations,
+    lm2_sweep3_hit_f32* out_hits,
+    int* out_hit_count);
+
+// #############################################################################
+LM2_HEADER_END;
+// #############################################################################
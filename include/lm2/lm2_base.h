@@ -67,6 +67,23 @@ LM2_HEADER_BEGIN;
 #  define LM2_API
 #endif
 
+// #############################################################################
+// LM2_INLINE macro for the hot modules (scalar, safe ops, vectors, vector
+// specifics, quaternion, matrices)
+// #############################################################################
+// With LM2_INLINE_IMPLEMENTATION defined, the headers of these modules also
+// pull in their definitions from lm2/inline/ as static inline functions, so
+// calls get inlined instead of going through the library (or the PLT).
+// The library sources undefine it, so the out-of-line symbols always exist as
+// a fallback. Define it consistently for every translation unit that includes
+// the C++ extension headers.
+
+#if defined(LM2_INLINE_IMPLEMENTATION)
+#  define LM2_INLINE static inline
+#else
+#  define LM2_INLINE LM2_API
+#endif
+
 // #############################################################################
 // LM2_ASSERT macro for internal assertions
 // #############################################################################
@@ -57,6 +57,10 @@ LM2_HEADER_BEGIN;
 // COMPOSITION: lm2_m3x2_mul(A, B) applies B first, then A (A*B).
 //   To build TRS: multiply(translate, multiply(rotate, scale)).
 //
+// BATCH: transform_points* are SIMD library functions, and
+//   transform_points_parallel splits large counts across threads; see
+//   lm2_matrix4x4.h.
+//
 // Can represent: translation, rotation, scaling, shearing, and combinations.
 // Efficient for 2D transformations (only stores 6 values vs 9 for full 3x3).
 
@@ -77,27 +81,28 @@ typedef union lm2_m3x2_f64 {
   _LM2_SUBSCRIPT_OP(double, 6)
 } lm2_m3x2_f64;
 
-LM2_API lm2_m3x2_f64 lm2_m3x2_identity_f64(void);
-LM2_API lm2_m3x2_f64 lm2_m3x2_zero_f64(void);
-LM2_API lm2_m3x2_f64 lm2_m3x2_make_f64(double m00, double m01, double m02, double m10, double m11, double m12);
-LM2_API lm2_m3x2_f64 lm2_m3x2_scale_f64(lm2_v2_f64 scale);
-LM2_API lm2_m3x2_f64 lm2_m3x2_scale_uniform_f64(double scale);
-LM2_API lm2_m3x2_f64 lm2_m3x2_translate_f64(lm2_v2_f64 translation);
-LM2_API lm2_m3x2_f64 lm2_m3x2_rotate_f64(double angle);
-LM2_API lm2_m3x2_f64 lm2_m3x2_rotate_around_pivot_f64(double angle, lm2_v2_f64 pivot);
-LM2_API lm2_m3x2_f64 lm2_m3x2_scale_translate_f64(lm2_v2_f64 scale, lm2_v2_f64 translation);
-LM2_API lm2_m3x2_f64 lm2_m3x2_world_transform_f64(lm2_v2_f64 translation, lm2_v2_f64 scale, double rotation);
-LM2_API lm2_m3x2_f64 lm2_m3x2_mul_f64(lm2_m3x2_f64 a, lm2_m3x2_f64 b);
-LM2_API lm2_m3x2_f64 lm2_m3x2_inverse_f64(lm2_m3x2_f64 m);
-LM2_API double lm2_m3x2_determinant_f64(lm2_m3x2_f64 m);
-LM2_API lm2_v2_f64 lm2_m3x2_transform_point_f64(lm2_m3x2_f64 m, lm2_v2_f64 v);
-LM2_API lm2_v2_f64 lm2_m3x2_transform_vector_f64(lm2_m3x2_f64 m, lm2_v2_f64 v);
+LM2_INLINE lm2_m3x2_f64 lm2_m3x2_identity_f64(void);
+LM2_INLINE lm2_m3x2_f64 lm2_m3x2_zero_f64(void);
+LM2_INLINE lm2_m3x2_f64 lm2_m3x2_make_f64(double m00, double m01, double m02, double m10, double m11, double m12);
+LM2_INLINE lm2_m3x2_f64 lm2_m3x2_scale_f64(lm2_v2_f64 scale);
+LM2_INLINE lm2_m3x2_f64 lm2_m3x2_scale_uniform_f64(double scale);
+LM2_INLINE lm2_m3x2_f64 lm2_m3x2_translate_f64(lm2_v2_f64 translation);
+LM2_INLINE lm2_m3x2_f64 lm2_m3x2_rotate_f64(double angle);
+LM2_INLINE lm2_m3x2_f64 lm2_m3x2_rotate_around_pivot_f64(double angle, lm2_v2_f64 pivot);
+LM2_INLINE lm2_m3x2_f64 lm2_m3x2_scale_translate_f64(lm2_v2_f64 scale, lm2_v2_f64 translation);
+LM2_INLINE lm2_m3x2_f64 lm2_m3x2_world_transform_f64(lm2_v2_f64 translation, lm2_v2_f64 scale, double rotation);
+LM2_INLINE lm2_m3x2_f64 lm2_m3x2_mul_f64(lm2_m3x2_f64 a, lm2_m3x2_f64 b);
+LM2_INLINE lm2_m3x2_f64 lm2_m3x2_inverse_f64(lm2_m3x2_f64 m);
+LM2_INLINE double lm2_m3x2_determinant_f64(lm2_m3x2_f64 m);
+LM2_INLINE lm2_v2_f64 lm2_m3x2_transform_point_f64(lm2_m3x2_f64 m, lm2_v2_f64 v);
+LM2_INLINE lm2_v2_f64 lm2_m3x2_transform_vector_f64(lm2_m3x2_f64 m, lm2_v2_f64 v);
 LM2_API void lm2_m3x2_transform_points_f64(lm2_m3x2_f64 m, lm2_v2_f64* points, uint32_t count);
 LM2_API void lm2_m3x2_transform_points_src_dst_f64(lm2_m3x2_f64 m, const lm2_v2_f64* src, lm2_v2_f64* dst, uint32_t count);
-LM2_API double lm2_m3x2_get_rotation_f64(lm2_m3x2_f64 m);
-LM2_API lm2_v2_f64 lm2_m3x2_get_scale_f64(lm2_m3x2_f64 m);
-LM2_API lm2_v2_f64 lm2_m3x2_get_translation_f64(lm2_m3x2_f64 m);
-LM2_API lm2_m3x2_f64 lm2_m3x2_ortho_f64(double left, double right, double bottom, double top);
+LM2_API void lm2_m3x2_transform_points_parallel_f64(lm2_m3x2_f64 m, const lm2_v2_f64* src, lm2_v2_f64* dst, uint32_t count, uint32_t thread_count);
+LM2_INLINE double lm2_m3x2_get_rotation_f64(lm2_m3x2_f64 m);
+LM2_INLINE lm2_v2_f64 lm2_m3x2_get_scale_f64(lm2_m3x2_f64 m);
+LM2_INLINE lm2_v2_f64 lm2_m3x2_get_translation_f64(lm2_m3x2_f64 m);
+LM2_INLINE lm2_m3x2_f64 lm2_m3x2_ortho_f64(double left, double right, double bottom, double top);
 
 // =============================================================================
 // Matrix 3x2 Function Declarations - f32
@@ -116,28 +121,33 @@ typedef union lm2_m3x2_f32 {
   _LM2_SUBSCRIPT_OP(float, 6)
 } lm2_m3x2_f32;
 
-LM2_API lm2_m3x2_f32 lm2_m3x2_identity_f32(void);
-LM2_API lm2_m3x2_f32 lm2_m3x2_zero_f32(void);
-LM2_API lm2_m3x2_f32 lm2_m3x2_make_f32(float m00, float m01, float m02, float m10, float m11, float m12);
-LM2_API lm2_m3x2_f32 lm2_m3x2_scale_f32(lm2_v2_f32 scale);
-LM2_API lm2_m3x2_f32 lm2_m3x2_scale_uniform_f32(float scale);
-LM2_API lm2_m3x2_f32 lm2_m3x2_translate_f32(lm2_v2_f32 translation);
-LM2_API lm2_m3x2_f32 lm2_m3x2_rotate_f32(float angle);
-LM2_API lm2_m3x2_f32 lm2_m3x2_rotate_around_pivot_f32(float angle, lm2_v2_f32 pivot);
-LM2_API lm2_m3x2_f32 lm2_m3x2_scale_translate_f32(lm2_v2_f32 scale, lm2_v2_f32 translation);
-LM2_API lm2_m3x2_f32 lm2_m3x2_world_transform_f32(lm2_v2_f32 translation, lm2_v2_f32 scale, float rotation);
-LM2_API lm2_m3x2_f32 lm2_m3x2_mul_f32(lm2_m3x2_f32 a, lm2_m3x2_f32 b);
-LM2_API lm2_m3x2_f32 lm2_m3x2_inverse_f32(lm2_m3x2_f32 m);
-LM2_API float lm2_m3x2_determinant_f32(lm2_m3x2_f32 m);
-LM2_API lm2_v2_f32 lm2_m3x2_transform_point_f32(lm2_m3x2_f32 m, lm2_v2_f32 v);
-LM2_API lm2_v2_f32 lm2_m3x2_transform_vector_f32(lm2_m3x2_f32 m, lm2_v2_f32 v);
+LM2_INLINE lm2_m3x2_f32 lm2_m3x2_identity_f32(void);
+LM2_INLINE lm2_m3x2_f32 lm2_m3x2_zero_f32(void);
+LM2_INLINE lm2_m3x2_f32 lm2_m3x2_make_f32(float m00, float m01, float m02, float m10, float m11, float m12);
+LM2_INLINE lm2_m3x2_f32 lm2_m3x2_scale_f32(lm2_v2_f32 scale);
+LM2_INLINE lm2_m3x2_f32 lm2_m3x2_scale_uniform_f32(float scale);
+LM2_INLINE lm2_m3x2_f32 lm2_m3x2_translate_f32(lm2_v2_f32 translation);
+LM2_INLINE lm2_m3x2_f32 lm2_m3x2_rotate_f32(float angle);
+LM2_INLINE lm2_m3x2_f32 lm2_m3x2_rotate_around_pivot_f32(float angle, lm2_v2_f32 pivot);
+LM2_INLINE lm2_m3x2_f32 lm2_m3x2_scale_translate_f32(lm2_v2_f32 scale, lm2_v2_f32 translation);
+LM2_INLINE lm2_m3x2_f32 lm2_m3x2_world_transform_f32(lm2_v2_f32 translation, lm2_v2_f32 scale, float rotation);
+LM2_INLINE lm2_m3x2_f32 lm2_m3x2_mul_f32(lm2_m3x2_f32 a, lm2_m3x2_f32 b);
+LM2_INLINE lm2_m3x2_f32 lm2_m3x2_inverse_f32(lm2_m3x2_f32 m);
+LM2_INLINE float lm2_m3x2_determinant_f32(lm2_m3x2_f32 m);
+LM2_INLINE lm2_v2_f32 lm2_m3x2_transform_point_f32(lm2_m3x2_f32 m, lm2_v2_f32 v);
+LM2_INLINE lm2_v2_f32 lm2_m3x2_transform_vector_f32(lm2_m3x2_f32 m, lm2_v2_f32 v);
 LM2_API void lm2_m3x2_transform_points_f32(lm2_m3x2_f32 m, lm2_v2_f32* points, uint32_t count);
 LM2_API void lm2_m3x2_transform_points_src_dst_f32(lm2_m3x2_f32 m, const lm2_v2_f32* src, lm2_v2_f32* dst, uint32_t count);
-LM2_API float lm2_m3x2_get_rotation_f32(lm2_m3x2_f32 m);
-LM2_API lm2_v2_f32 lm2_m3x2_get_scale_f32(lm2_m3x2_f32 m);
-LM2_API lm2_v2_f32 lm2_m3x2_get_translation_f32(lm2_m3x2_f32 m);
-LM2_API lm2_m3x2_f32 lm2_m3x2_ortho_f32(float left, float right, float bottom, float top);
+LM2_API void lm2_m3x2_transform_points_parallel_f32(lm2_m3x2_f32 m, const lm2_v2_f32* src, lm2_v2_f32* dst, uint32_t count, uint32_t thread_count);
+LM2_INLINE float lm2_m3x2_get_rotation_f32(lm2_m3x2_f32 m);
+LM2_INLINE lm2_v2_f32 lm2_m3x2_get_scale_f32(lm2_m3x2_f32 m);
+LM2_INLINE lm2_v2_f32 lm2_m3x2_get_translation_f32(lm2_m3x2_f32 m);
+LM2_INLINE lm2_m3x2_f32 lm2_m3x2_ortho_f32(float left, float right, float bottom, float top);
 
 // #############################################################################
 LM2_HEADER_END;
 // #############################################################################
+
+#ifdef LM2_INLINE_IMPLEMENTATION
+#  include "lm2/inline/lm2_matrix3x2_inline.h"
+#endif
\ No newline at end of file
@@ -60,6 +60,18 @@ LM2_HEADER_BEGIN;
 //   Extracting orientation via lm2_m4x4_to_quat_f64 from a view matrix yields
 //   the conjugate of the camera's world orientation quaternion.
 //
+// BATCH: transform_points* are library functions (also with
+//   LM2_INLINE_IMPLEMENTATION) that transform several points per iteration
+//   with SIMD. transform_points_parallel also splits the count across
+//   thread_count threads (0 = one per hardware thread) once it is large enough
+//   to pay for them. src and dst may be the same array but must not otherwise
+//   overlap.
+//   mul_array (dst[i] = a[i] * b[i]), premul_array (dst[i] = m * b[i]) and
+//   propagate_hierarchy (matrices[i] = matrices[parents[i]] * matrices[i] in
+//   index order, parents[i] < i or negative for roots) work on arrays through
+//   pointers with SIMD row broadcasting; f64 rows use AVX when the library is
+//   built with it. dst may alias a or b.
+//
 // Can represent: translation, rotation, scaling, projection, and combinations.
 // Standard format for 3D graphics transformations.
 
@@ -78,33 +90,37 @@ typedef union lm2_m4x4_f64 {
   _LM2_SUBSCRIPT_OP(double, 16)
 } lm2_m4x4_f64;
 
-LM2_API lm2_m4x4_f64 lm2_m4x4_identity_f64(void);
-LM2_API lm2_m4x4_f64 lm2_m4x4_zero_f64(void);
-LM2_API lm2_m4x4_f64 lm2_m4x4_make_f64(double m00, double m01, double m02, double m03, double m10, double m11, double m12, double m13, double m20, double m21, double m22, double m23, double m30, double m31, double m32, double m33);
-LM2_API lm2_m4x4_f64 lm2_m4x4_scale_f64(lm2_v3_f64 scale);
-LM2_API lm2_m4x4_f64 lm2_m4x4_scale_uniform_f64(double scale);
-LM2_API lm2_m4x4_f64 lm2_m4x4_translate_f64(lm2_v3_f64 translation);
-LM2_API lm2_m4x4_f64 lm2_m4x4_rotate_x_f64(double angle);
-LM2_API lm2_m4x4_f64 lm2_m4x4_rotate_y_f64(double angle);
-LM2_API lm2_m4x4_f64 lm2_m4x4_rotate_z_f64(double angle);
-LM2_API lm2_m4x4_f64 lm2_m4x4_rotate_axis_f64(lm2_v3_f64 axis, double angle);
-LM2_API lm2_m4x4_f64 lm2_m4x4_scale_translate_f64(lm2_v3_f64 scale, lm2_v3_f64 translation);
-LM2_API lm2_m4x4_f64 lm2_m4x4_world_transform_f64(lm2_v3_f64 translation, lm2_v3_f64 scale, lm2_v3_f64 rotation_euler);
-LM2_API lm2_m4x4_f64 lm2_m4x4_mul_f64(lm2_m4x4_f64 a, lm2_m4x4_f64 b);
-LM2_API lm2_m4x4_f64 lm2_m4x4_transpose_f64(lm2_m4x4_f64 m);
-LM2_API lm2_m4x4_f64 lm2_m4x4_inverse_f64(lm2_m4x4_f64 m);
-LM2_API double lm2_m4x4_determinant_f64(lm2_m4x4_f64 m);
-LM2_API double lm2_m4x4_trace_f64(lm2_m4x4_f64 m);
-LM2_API lm2_v3_f64 lm2_m4x4_transform_point_f64(lm2_m4x4_f64 m, lm2_v3_f64 v);
-LM2_API lm2_v3_f64 lm2_m4x4_transform_vector_f64(lm2_m4x4_f64 m, lm2_v3_f64 v);
-LM2_API lm2_v4_f64 lm2_m4x4_transform_f64(lm2_m4x4_f64 m, lm2_v4_f64 v);
+LM2_INLINE lm2_m4x4_f64 lm2_m4x4_identity_f64(void);
+LM2_INLINE lm2_m4x4_f64 lm2_m4x4_zero_f64(void);
+LM2_INLINE lm2_m4x4_f64 lm2_m4x4_make_f64(double m00, double m01, double m02, double m03, double m10, double m11, double m12, double m13, double m20, double m21, double m22, double m23, double m30, double m31, double m32, double m33);
+LM2_INLINE lm2_m4x4_f64 lm2_m4x4_scale_f64(lm2_v3_f64 scale);
+LM2_INLINE lm2_m4x4_f64 lm2_m4x4_scale_uniform_f64(double scale);
+LM2_INLINE lm2_m4x4_f64 lm2_m4x4_translate_f64(lm2_v3_f64 translation);
+LM2_INLINE lm2_m4x4_f64 lm2_m4x4_rotate_x_f64(double angle);
+LM2_INLINE lm2_m4x4_f64 lm2_m4x4_rotate_y_f64(double angle);
+LM2_INLINE lm2_m4x4_f64 lm2_m4x4_rotate_z_f64(double angle);
+LM2_INLINE lm2_m4x4_f64 lm2_m4x4_rotate_axis_f64(lm2_v3_f64 axis, double angle);
+LM2_INLINE lm2_m4x4_f64 lm2_m4x4_scale_translate_f64(lm2_v3_f64 scale, lm2_v3_f64 translation);
+LM2_INLINE lm2_m4x4_f64 lm2_m4x4_world_transform_f64(lm2_v3_f64 translation, lm2_v3_f64 scale, lm2_v3_f64 rotation_euler);
+LM2_INLINE lm2_m4x4_f64 lm2_m4x4_mul_f64(lm2_m4x4_f64 a, lm2_m4x4_f64 b);
+LM2_INLINE lm2_m4x4_f64 lm2_m4x4_transpose_f64(lm2_m4x4_f64 m);
+LM2_INLINE lm2_m4x4_f64 lm2_m4x4_inverse_f64(lm2_m4x4_f64 m);
+LM2_INLINE double lm2_m4x4_determinant_f64(lm2_m4x4_f64 m);
+LM2_INLINE double lm2_m4x4_trace_f64(lm2_m4x4_f64 m);
+LM2_INLINE lm2_v3_f64 lm2_m4x4_transform_point_f64(lm2_m4x4_f64 m, lm2_v3_f64 v);
+LM2_INLINE lm2_v3_f64 lm2_m4x4_transform_vector_f64(lm2_m4x4_f64 m, lm2_v3_f64 v);
+LM2_INLINE lm2_v4_f64 lm2_m4x4_transform_f64(lm2_m4x4_f64 m, lm2_v4_f64 v);
 LM2_API void lm2_m4x4_transform_points_f64(lm2_m4x4_f64 m, lm2_v3_f64* points, uint32_t count);
 LM2_API void lm2_m4x4_transform_points_src_dst_f64(lm2_m4x4_f64 m, const lm2_v3_f64* src, lm2_v3_f64* dst, uint32_t count);
-LM2_API lm2_v3_f64 lm2_m4x4_get_scale_f64(lm2_m4x4_f64 m);
-LM2_API lm2_v3_f64 lm2_m4x4_get_translation_f64(lm2_m4x4_f64 m);
-LM2_API lm2_m4x4_f64 lm2_m4x4_ortho_f64(double left, double right, double bottom, double top, double near_plane, double far_plane);
-LM2_API lm2_m4x4_f64 lm2_m4x4_perspective_f64(double fov_y, double aspect, double near_plane, double far_plane);
-LM2_API lm2_m4x4_f64 lm2_m4x4_look_at_f64(lm2_v3_f64 eye, lm2_v3_f64 target, lm2_v3_f64 up);
+LM2_API void lm2_m4x4_transform_points_parallel_f64(lm2_m4x4_f64 m, const lm2_v3_f64* src, lm2_v3_f64* dst, uint32_t count, uint32_t thread_count);
+LM2_API void lm2_m4x4_mul_array_f64(const lm2_m4x4_f64* a, const lm2_m4x4_f64* b, lm2_m4x4_f64* dst, uint32_t count);
+LM2_API void lm2_m4x4_premul_array_f64(const lm2_m4x4_f64* m, const lm2_m4x4_f64* b, lm2_m4x4_f64* dst, uint32_t count);
+LM2_API void lm2_m4x4_propagate_hierarchy_f64(lm2_m4x4_f64* matrices, const int32_t* parents, uint32_t count);
+LM2_INLINE lm2_v3_f64 lm2_m4x4_get_scale_f64(lm2_m4x4_f64 m);
+LM2_INLINE lm2_v3_f64 lm2_m4x4_get_translation_f64(lm2_m4x4_f64 m);
+LM2_INLINE lm2_m4x4_f64 lm2_m4x4_ortho_f64(double left, double right, double bottom, double top, double near_plane, double far_plane);
+LM2_INLINE lm2_m4x4_f64 lm2_m4x4_perspective_f64(double fov_y, double aspect, double near_plane, double far_plane);
+LM2_INLINE lm2_m4x4_f64 lm2_m4x4_look_at_f64(lm2_v3_f64 eye, lm2_v3_f64 target, lm2_v3_f64 up);
 
 // =============================================================================
 // Matrix 4x4 Function Declarations - f32
@@ -121,42 +137,50 @@ typedef union lm2_m4x4_f32 {
   _LM2_SUBSCRIPT_OP(float, 16)
 } lm2_m4x4_f32;
 
-LM2_API lm2_m4x4_f32 lm2_m4x4_identity_f32(void);
-LM2_API lm2_m4x4_f32 lm2_m4x4_zero_f32(void);
-LM2_API lm2_m4x4_f32 lm2_m4x4_make_f32(float m00, float m01, float m02, float m03, float m10, float m11, float m12, float m13, float m20, float m21, float m22, float m23, float m30, float m31, float m32, float m33);
-LM2_API lm2_m4x4_f32 lm2_m4x4_scale_f32(lm2_v3_f32 scale);
-LM2_API lm2_m4x4_f32 lm2_m4x4_scale_uniform_f32(float scale);
-LM2_API lm2_m4x4_f32 lm2_m4x4_translate_f32(lm2_v3_f32 translation);
-LM2_API lm2_m4x4_f32 lm2_m4x4_rotate_x_f32(float angle);
-LM2_API lm2_m4x4_f32 lm2_m4x4_rotate_y_f32(float angle);
-LM2_API lm2_m4x4_f32 lm2_m4x4_rotate_z_f32(float angle);
-LM2_API lm2_m4x4_f32 lm2_m4x4_rotate_axis_f32(lm2_v3_f32 axis, float angle);
-LM2_API lm2_m4x4_f32 lm2_m4x4_scale_translate_f32(lm2_v3_f32 scale, lm2_v3_f32 translation);
-LM2_API lm2_m4x4_f32 lm2_m4x4_world_transform_f32(lm2_v3_f32 translation, lm2_v3_f32 scale, lm2_v3_f32 rotation_euler);
-LM2_API lm2_m4x4_f32 lm2_m4x4_mul_f32(lm2_m4x4_f32 a, lm2_m4x4_f32 b);
-LM2_API lm2_m4x4_f32 lm2_m4x4_transpose_f32(lm2_m4x4_f32 m);
-LM2_API lm2_m4x4_f32 lm2_m4x4_inverse_f32(lm2_m4x4_f32 m);
-LM2_API float lm2_m4x4_determinant_f32(lm2_m4x4_f32 m);
-LM2_API float lm2_m4x4_trace_f32(lm2_m4x4_f32 m);
-LM2_API lm2_v3_f32 lm2_m4x4_transform_point_f32(lm2_m4x4_f32 m, lm2_v3_f32 v);
-LM2_API lm2_v3_f32 lm2_m4x4_transform_vector_f32(lm2_m4x4_f32 m, lm2_v3_f32 v);
-LM2_API lm2_v4_f32 lm2_m4x4_transform_f32(lm2_m4x4_f32 m, lm2_v4_f32 v);
+LM2_INLINE lm2_m4x4_f32 lm2_m4x4_identity_f32(void);
+LM2_INLINE lm2_m4x4_f32 lm2_m4x4_zero_f32(void);
+LM2_INLINE lm2_m4x4_f32 lm2_m4x4_make_f32(float m00, float m01, float m02, float m03, float m10, float m11, float m12, float m13, float m20, float m21, float m22, float m23, float m30, float m31, float m32, float m33);
+LM2_INLINE lm2_m4x4_f32 lm2_m4x4_scale_f32(lm2_v3_f32 scale);
+LM2_INLINE lm2_m4x4_f32 lm2_m4x4_scale_uniform_f32(float scale);
+LM2_INLINE lm2_m4x4_f32 lm2_m4x4_translate_f32(lm2_v3_f32 translation);
+LM2_INLINE lm2_m4x4_f32 lm2_m4x4_rotate_x_f32(float angle);
+LM2_INLINE lm2_m4x4_f32 lm2_m4x4_rotate_y_f32(float angle);
+LM2_INLINE lm2_m4x4_f32 lm2_m4x4_rotate_z_f32(float angle);
+LM2_INLINE lm2_m4x4_f32 lm2_m4x4_rotate_axis_f32(lm2_v3_f32 axis, float angle);
+LM2_INLINE lm2_m4x4_f32 lm2_m4x4_scale_translate_f32(lm2_v3_f32 scale, lm2_v3_f32 translation);
+LM2_INLINE lm2_m4x4_f32 lm2_m4x4_world_transform_f32(lm2_v3_f32 translation, lm2_v3_f32 scale, lm2_v3_f32 rotation_euler);
+LM2_INLINE lm2_m4x4_f32 lm2_m4x4_mul_f32(lm2_m4x4_f32 a, lm2_m4x4_f32 b);
+LM2_INLINE lm2_m4x4_f32 lm2_m4x4_transpose_f32(lm2_m4x4_f32 m);
+LM2_INLINE lm2_m4x4_f32 lm2_m4x4_inverse_f32(lm2_m4x4_f32 m);
+LM2_INLINE float lm2_m4x4_determinant_f32(lm2_m4x4_f32 m);
+LM2_INLINE float lm2_m4x4_trace_f32(lm2_m4x4_f32 m);
+LM2_INLINE lm2_v3_f32 lm2_m4x4_transform_point_f32(lm2_m4x4_f32 m, lm2_v3_f32 v);
+LM2_INLINE lm2_v3_f32 lm2_m4x4_transform_vector_f32(lm2_m4x4_f32 m, lm2_v3_f32 v);
+LM2_INLINE lm2_v4_f32 lm2_m4x4_transform_f32(lm2_m4x4_f32 m, lm2_v4_f32 v);
 LM2_API void lm2_m4x4_transform_points_f32(lm2_m4x4_f32 m, lm2_v3_f32* points, uint32_t count);
 LM2_API void lm2_m4x4_transform_points_src_dst_f32(lm2_m4x4_f32 m, const lm2_v3_f32* src, lm2_v3_f32* dst, uint32_t count);
-LM2_API lm2_v3_f32 lm2_m4x4_get_scale_f32(lm2_m4x4_f32 m);
-LM2_API lm2_v3_f32 lm2_m4x4_get_translation_f32(lm2_m4x4_f32 m);
-LM2_API lm2_m4x4_f32 lm2_m4x4_ortho_f32(float left, float right, float bottom, float top, float near_plane, float far_plane);
-LM2_API lm2_m4x4_f32 lm2_m4x4_perspective_f32(float fov_y, float aspect, float near_plane, float far_plane);
-LM2_API lm2_m4x4_f32 lm2_m4x4_look_at_f32(lm2_v3_f32 eye, lm2_v3_f32 target, lm2_v3_f32 up);
+LM2_API void lm2_m4x4_transform_points_parallel_f32(lm2_m4x4_f32 m, const lm2_v3_f32* src, lm2_v3_f32* dst, uint32_t count, uint32_t thread_count);
+LM2_API void lm2_m4x4_mul_array_f32(const lm2_m4x4_f32* a, const lm2_m4x4_f32* b, lm2_m4x4_f32* dst, uint32_t count);
+LM2_API void lm2_m4x4_premul_array_f32(const lm2_m4x4_f32* m, const lm2_m4x4_f32* b, lm2_m4x4_f32* dst, uint32_t count);
+LM2_API void lm2_m4x4_propagate_hierarchy_f32(lm2_m4x4_f32* matrices, const int32_t* parents, uint32_t count);
+LM2_INLINE lm2_v3_f32 lm2_m4x4_get_scale_f32(lm2_m4x4_f32 m);
+LM2_INLINE lm2_v3_f32 lm2_m4x4_get_translation_f32(lm2_m4x4_f32 m);
+LM2_INLINE lm2_m4x4_f32 lm2_m4x4_ortho_f32(float left, float right, float bottom, float top, float near_plane, float far_plane);
+LM2_INLINE lm2_m4x4_f32 lm2_m4x4_perspective_f32(float fov_y, float aspect, float near_plane, float far_plane);
+LM2_INLINE lm2_m4x4_f32 lm2_m4x4_look_at_f32(lm2_v3_f32 eye, lm2_v3_f32 target, lm2_v3_f32 up);
 
 // Quaternion conversions - f64
-LM2_API lm2_m4x4_f64 lm2_m4x4_from_quat_f64(lm2_quat_f64 q);
-LM2_API lm2_quat_f64 lm2_m4x4_to_quat_f64(lm2_m4x4_f64 m);
+LM2_INLINE lm2_m4x4_f64 lm2_m4x4_from_quat_f64(lm2_quat_f64 q);
+LM2_INLINE lm2_quat_f64 lm2_m4x4_to_quat_f64(lm2_m4x4_f64 m);
 
 // Quaternion conversions - f32
-LM2_API lm2_m4x4_f32 lm2_m4x4_from_quat_f32(lm2_quat_f32 q);
-LM2_API lm2_quat_f32 lm2_m4x4_to_quat_f32(lm2_m4x4_f32 m);
+LM2_INLINE lm2_m4x4_f32 lm2_m4x4_from_quat_f32(lm2_quat_f32 q);
+LM2_INLINE lm2_quat_f32 lm2_m4x4_to_quat_f32(lm2_m4x4_f32 m);
 
 // #############################################################################
 LM2_HEADER_END;
 // #############################################################################
+
+#ifdef LM2_INLINE_IMPLEMENTATION
+#  include "lm2/inline/lm2_matrix4x4_inline.h"
+#endif
\ No newline at end of file
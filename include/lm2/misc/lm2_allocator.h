@@ -0,0 +1,109 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include "lm2/lm2_base.h"
+
+// #############################################################################
+LM2_HEADER_BEGIN;
+// #############################################################################
+
+// Memory used by the functions that need temporary buffers
+// Heap memory goes through a process-wide allocator hook that defaults to
+// malloc, realloc and free. Functions with a _scratch variant can take their
+// temporary buffers from a caller-owned bump arena instead. The plain variants
+// of these functions use a per-thread default arena, so after the first calls
+// have sized it, repeated calls do not touch the heap.
+
+// =============================================================================
+// Allocator Hook
+// =============================================================================
+
+// Heap functions with the semantics of malloc, realloc and free
+// user_data is passed through to every call
+typedef struct lm2_allocator {
+  void* (*allocate)(void* user_data, size_t size);
+  void* (*reallocate)(void* user_data, void* ptr, size_t size);
+  void (*deallocate)(void* user_data, void* ptr);
+  void* user_data;
+} lm2_allocator;
+
+// Replace the allocator used for every internal heap allocation
+// allocator: the functions to use, or NULL to restore malloc, realloc and free
+// Set it once at startup, before any other lm2 call and before threads use the library.
+// Memory is always released through the allocator that was active when it was allocated,
+// so swapping allocators while per-thread arenas hold memory is not supported.
+LM2_API void lm2_set_allocator(const lm2_allocator* allocator);
+
+// Get the allocator currently in use
+LM2_API lm2_allocator lm2_get_allocator(void);
+
+// =============================================================================
+// Bump Arena
+// =============================================================================
+
+// Linear allocator over one memory block
+// Allocations are 16-byte aligned and are released together by resetting the
+// arena to an earlier mark. When a _scratch function finds the arena full it
+// takes the rest from the heap, so a too small arena is slower but never fails.
+typedef struct lm2_arena {
+  unsigned char* memory;  // Memory block
+  size_t capacity;        // Size of the memory block in bytes
+  size_t offset;          // Bytes in use
+  size_t peak;            // Most bytes ever needed at once, including requests that did not fit
+  size_t overflow;        // Bytes that did not fit since the arena was last empty
+  bool owns_memory;       // The block comes from the allocator hook and grows to peak
+} lm2_arena;
+
+// Make an arena
+// memory: caller-owned block of capacity bytes, used as is and never grown,
+//         or NULL for an arena that owns a block of capacity bytes (0 allowed) and grows
+//         it to peak whenever it is reset to empty
+LM2_API lm2_arena lm2_arena_make(void* memory, size_t capacity);
+
+// Release an owned block and leave the arena empty
+LM2_API void lm2_arena_destroy(lm2_arena* arena);
+
+// Allocate size bytes (16-byte aligned); size 0 takes one byte
+// Returns: NULL when the arena is full; peak still counts the request
+LM2_API void* lm2_arena_alloc(lm2_arena* arena, size_t size);
+
+// Current position, to reset to later
+LM2_API size_t lm2_arena_mark(const lm2_arena* arena);
+
+// Release every allocation made after mark
+// Resetting an owning arena to 0 grows its block to peak if needed, so the next
+// call of the same size fits without heap fallbacks.
+LM2_API void lm2_arena_reset(lm2_arena* arena, size_t mark);
+
+// Default arena of the calling thread, used by the plain variants of the _scratch functions
+// It owns its block, which is released when the thread exits.
+// Returns: NULL if the per-thread storage could not be set up, and always NULL when built
+//          with LM2_ENABLE_THREADS=OFF; the functions then use the heap
+LM2_API lm2_arena* lm2_arena_thread_default(void);
+
+// #############################################################################
+LM2_HEADER_END;
+// #############################################################################
@@ -68,69 +68,73 @@ typedef union lm2_quat_f32 {
 // =============================================================================
 
 // Basic constructors
-LM2_API lm2_quat_f64 lm2_quat_identity_f64(void);
-LM2_API lm2_quat_f64 lm2_quat_zero_f64(void);
-LM2_API lm2_quat_f64 lm2_quat_make_f64(double x, double y, double z, double w);
+LM2_INLINE lm2_quat_f64 lm2_quat_identity_f64(void);
+LM2_INLINE lm2_quat_f64 lm2_quat_zero_f64(void);
+LM2_INLINE lm2_quat_f64 lm2_quat_make_f64(double x, double y, double z, double w);
 
 // Conversions from other representations
-LM2_API lm2_quat_f64 lm2_quat_from_axis_angle_f64(lm2_v3_f64 axis, double angle);
-LM2_API lm2_quat_f64 lm2_quat_from_euler_f64(double pitch, double yaw, double roll);
-LM2_API lm2_quat_f64 lm2_quat_from_euler_vec_f64(lm2_v3_f64 euler);
+LM2_INLINE lm2_quat_f64 lm2_quat_from_axis_angle_f64(lm2_v3_f64 axis, double angle);
+LM2_INLINE lm2_quat_f64 lm2_quat_from_euler_f64(double pitch, double yaw, double roll);
+LM2_INLINE lm2_quat_f64 lm2_quat_from_euler_vec_f64(lm2_v3_f64 euler);
 
 // Conversions to other representations
-LM2_API void lm2_quat_to_axis_angle_f64(lm2_quat_f64 q, lm2_v3_f64* axis, double* angle);
-LM2_API lm2_v3_f64 lm2_quat_to_euler_f64(lm2_quat_f64 q);
+LM2_INLINE void lm2_quat_to_axis_angle_f64(lm2_quat_f64 q, lm2_v3_f64* axis, double* angle);
+LM2_INLINE lm2_v3_f64 lm2_quat_to_euler_f64(lm2_quat_f64 q);
 
 // Operations
-LM2_API lm2_quat_f64 lm2_quat_conjugate_f64(lm2_quat_f64 q);
-LM2_API lm2_quat_f64 lm2_quat_inverse_f64(lm2_quat_f64 q);
-LM2_API lm2_quat_f64 lm2_quat_norm_f64(lm2_quat_f64 q);
-LM2_API lm2_quat_f64 lm2_quat_multiply_f64(lm2_quat_f64 a, lm2_quat_f64 b);
-LM2_API lm2_quat_f64 lm2_quat_add_f64(lm2_quat_f64 a, lm2_quat_f64 b);
-LM2_API lm2_quat_f64 lm2_quat_sub_f64(lm2_quat_f64 a, lm2_quat_f64 b);
-LM2_API lm2_quat_f64 lm2_quat_scale_f64(lm2_quat_f64 q, double s);
-LM2_API double lm2_quat_dot_f64(lm2_quat_f64 a, lm2_quat_f64 b);
-LM2_API double lm2_quat_length_squared_f64(lm2_quat_f64 q);
-LM2_API double lm2_quat_length_f64(lm2_quat_f64 q);
-LM2_API lm2_v3_f64 lm2_quat_rotate_vector_f64(lm2_quat_f64 q, lm2_v3_f64 v);
-LM2_API lm2_quat_f64 lm2_quat_slerp_f64(lm2_quat_f64 a, lm2_quat_f64 b, double t);
-LM2_API lm2_quat_f64 lm2_quat_nlerp_f64(lm2_quat_f64 a, lm2_quat_f64 b, double t);
-LM2_API bool lm2_quat_equals_f64(lm2_quat_f64 a, lm2_quat_f64 b, double epsilon);
+LM2_INLINE lm2_quat_f64 lm2_quat_conjugate_f64(lm2_quat_f64 q);
+LM2_INLINE lm2_quat_f64 lm2_quat_inverse_f64(lm2_quat_f64 q);
+LM2_INLINE lm2_quat_f64 lm2_quat_norm_f64(lm2_quat_f64 q);
+LM2_INLINE lm2_quat_f64 lm2_quat_multiply_f64(lm2_quat_f64 a, lm2_quat_f64 b);
+LM2_INLINE lm2_quat_f64 lm2_quat_add_f64(lm2_quat_f64 a, lm2_quat_f64 b);
+LM2_INLINE lm2_quat_f64 lm2_quat_sub_f64(lm2_quat_f64 a, lm2_quat_f64 b);
+LM2_INLINE lm2_quat_f64 lm2_quat_scale_f64(lm2_quat_f64 q, double s);
+LM2_INLINE double lm2_quat_dot_f64(lm2_quat_f64 a, lm2_quat_f64 b);
+LM2_INLINE double lm2_quat_length_squared_f64(lm2_quat_f64 q);
+LM2_INLINE double lm2_quat_length_f64(lm2_quat_f64 q);
+LM2_INLINE lm2_v3_f64 lm2_quat_rotate_vector_f64(lm2_quat_f64 q, lm2_v3_f64 v);
+LM2_INLINE lm2_quat_f64 lm2_quat_slerp_f64(lm2_quat_f64 a, lm2_quat_f64 b, double t);
+LM2_INLINE lm2_quat_f64 lm2_quat_nlerp_f64(lm2_quat_f64 a, lm2_quat_f64 b, double t);
+LM2_INLINE bool lm2_quat_equals_f64(lm2_quat_f64 a, lm2_quat_f64 b, double epsilon);
 
 // =============================================================================
 // Quaternion Function Declarations - f32
 // =============================================================================
 
 // Basic constructors
-LM2_API lm2_quat_f32 lm2_quat_identity_f32(void);
-LM2_API lm2_quat_f32 lm2_quat_zero_f32(void);
-LM2_API lm2_quat_f32 lm2_quat_make_f32(float x, float y, float z, float w);
+LM2_INLINE lm2_quat_f32 lm2_quat_identity_f32(void);
+LM2_INLINE lm2_quat_f32 lm2_quat_zero_f32(void);
+LM2_INLINE lm2_quat_f32 lm2_quat_make_f32(float x, float y, float z, float w);
 
 // Conversions from other representations
-LM2_API lm2_quat_f32 lm2_quat_from_axis_angle_f32(lm2_v3_f32 axis, float angle);
-LM2_API lm2_quat_f32 lm2_quat_from_euler_f32(float pitch, float yaw, float roll);
-LM2_API lm2_quat_f32 lm2_quat_from_euler_vec_f32(lm2_v3_f32 euler);
+LM2_INLINE lm2_quat_f32 lm2_quat_from_axis_angle_f32(lm2_v3_f32 axis, float angle);
+LM2_INLINE lm2_quat_f32 lm2_quat_from_euler_f32(float pitch, float yaw, float roll);
+LM2_INLINE lm2_quat_f32 lm2_quat_from_euler_vec_f32(lm2_v3_f32 euler);
 
 // Conversions to other representations
-LM2_API void lm2_quat_to_axis_angle_f32(lm2_quat_f32 q, lm2_v3_f32* axis, float* angle);
-LM2_API lm2_v3_f32 lm2_quat_to_euler_f32(lm2_quat_f32 q);
+LM2_INLINE void lm2_quat_to_axis_angle_f32(lm2_quat_f32 q, lm2_v3_f32* axis, float* angle);
+LM2_INLINE lm2_v3_f32 lm2_quat_to_euler_f32(lm2_quat_f32 q);
 
 // Operations
-LM2_API lm2_quat_f32 lm2_quat_conjugate_f32(lm2_quat_f32 q);
-LM2_API lm2_quat_f32 lm2_quat_inverse_f32(lm2_quat_f32 q);
-LM2_API lm2_quat_f32 lm2_quat_norm_f32(lm2_quat_f32 q);
-LM2_API lm2_quat_f32 lm2_quat_multiply_f32(lm2_quat_f32 a, lm2_quat_f32 b);
-LM2_API lm2_quat_f32 lm2_quat_add_f32(lm2_quat_f32 a, lm2_quat_f32 b);
-LM2_API lm2_quat_f32 lm2_quat_sub_f32(lm2_quat_f32 a, lm2_quat_f32 b);
-LM2_API lm2_quat_f32 lm2_quat_scale_f32(lm2_quat_f32 q, float s);
-LM2_API float lm2_quat_dot_f32(lm2_quat_f32 a, lm2_quat_f32 b);
-LM2_API float lm2_quat_length_squared_f32(lm2_quat_f32 q);
-LM2_API float lm2_quat_length_f32(lm2_quat_f32 q);
-LM2_API lm2_v3_f32 lm2_quat_rotate_vector_f32(lm2_quat_f32 q, lm2_v3_f32 v);
-LM2_API lm2_quat_f32 lm2_quat_slerp_f32(lm2_quat_f32 a, lm2_quat_f32 b, float t);
-LM2_API lm2_quat_f32 lm2_quat_nlerp_f32(lm2_quat_f32 a, lm2_quat_f32 b, float t);
-LM2_API bool lm2_quat_equals_f32(lm2_quat_f32 a, lm2_quat_f32 b, float epsilon);
+LM2_INLINE lm2_quat_f32 lm2_quat_conjugate_f32(lm2_quat_f32 q);
+LM2_INLINE lm2_quat_f32 lm2_quat_inverse_f32(lm2_quat_f32 q);
+LM2_INLINE lm2_quat_f32 lm2_quat_norm_f32(lm2_quat_f32 q);
+LM2_INLINE lm2_quat_f32 lm2_quat_multiply_f32(lm2_quat_f32 a, lm2_quat_f32 b);
+LM2_INLINE lm2_quat_f32 lm2_quat_add_f32(lm2_quat_f32 a, lm2_quat_f32 b);
+LM2_INLINE lm2_quat_f32 lm2_quat_sub_f32(lm2_quat_f32 a, lm2_quat_f32 b);
+LM2_INLINE lm2_quat_f32 lm2_quat_scale_f32(lm2_quat_f32 q, float s);
+LM2_INLINE float lm2_quat_dot_f32(lm2_quat_f32 a, lm2_quat_f32 b);
+LM2_INLINE float lm2_quat_length_squared_f32(lm2_quat_f32 q);
+LM2_INLINE float lm2_quat_length_f32(lm2_quat_f32 q);
+LM2_INLINE lm2_v3_f32 lm2_quat_rotate_vector_f32(lm2_quat_f32 q, lm2_v3_f32 v);
+LM2_INLINE lm2_quat_f32 lm2_quat_slerp_f32(lm2_quat_f32 a, lm2_quat_f32 b, float t);
+LM2_INLINE lm2_quat_f32 lm2_quat_nlerp_f32(lm2_quat_f32 a, lm2_quat_f32 b, float t);
+LM2_INLINE bool lm2_quat_equals_f32(lm2_quat_f32 a, lm2_quat_f32 b, float epsilon);
 
 // #############################################################################
 LM2_HEADER_END;
 // #############################################################################
+
+#ifdef LM2_INLINE_IMPLEMENTATION
+#  include "lm2/inline/lm2_quaternion_inline.h"
+#endif
\ No newline at end of file
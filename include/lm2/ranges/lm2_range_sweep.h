@@ -0,0 +1,126 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include "lm2/lm2_base.h"
+#include "lm2/ranges/lm2_range2.h"
+#include "lm2/ranges/lm2_range3.h"
+
+// #############################################################################
+LM2_HEADER_BEGIN;
+// #############################################################################
+
+// =============================================================================
+// Sweep and Prune Types
+// =============================================================================
+// Batch broadphase over plain arrays of lm2_r2 / lm2_r3 boxes: every pair of
+// overlapping boxes is reported by index. Boxes that only touch count as
+// overlapping.
+//
+// The boxes are radix sorted by their min on the sweep axis, the axis along
+// which the box centers have the largest variance. The sweep then visits each
+// box's successors until their min passes its max, testing the other axes
+// several candidates at a time with SIMD.
+//
+// All work memory is one caller-managed buffer sized with
+// lm2_r2_sweep_buffer_size / lm2_r3_sweep_buffer_size; no call allocates. The
+// buffer must be aligned for a uint64_t.
+//
+// For boxes that move a little between calls, keep an lm2_sweep and call
+// lm2_r2_sweep_update / lm2_r3_sweep_update every frame: the previous order is
+// kept and repaired with an insertion sort, which is linear when few boxes
+// swap places.
+
+// Pair of overlapping boxes, as indices into the box array (a < b)
+typedef struct lm2_sweep_pair {
+  uint32_t a;
+  uint32_t b;
+} lm2_sweep_pair;
+
+// Persistent sweep state for the incremental mode
+typedef struct lm2_sweep_f64 {
+  void* buffer;        // Work buffer (caller-managed)
+  size_t buffer_size;  // Size of buffer in bytes
+  uint32_t count;      // Number of boxes in the kept order, 0 before the first update
+  uint32_t axis;       // Sweep axis of the kept order
+} lm2_sweep_f64;
+
+typedef struct lm2_sweep_f32 {
+  void* buffer;        // Work buffer (caller-managed)
+  size_t buffer_size;  // Size of buffer in bytes
+  uint32_t count;      // Number of boxes in the kept order, 0 before the first update
+  uint32_t axis;       // Sweep axis of the kept order
+} lm2_sweep_f32;
+
+// =============================================================================
+// Buffer Sizes
+// =============================================================================
+
+// Query the work buffer size for sweeping up to count boxes
+// Returns: the buffer size in bytes
+LM2_API size_t lm2_r2_sweep_buffer_size_f64(size_t count);
+LM2_API size_t lm2_r2_sweep_buffer_size_f32(size_t count);
+LM2_API size_t lm2_r3_sweep_buffer_size_f64(size_t count);
+LM2_API size_t lm2_r3_sweep_buffer_size_f32(size_t count);
+
+// =============================================================================
+// Batch Sweep
+// =============================================================================
+// The sweep functions write at most max_pairs pairs and return the total
+// number found; a return value above max_pairs means the output was truncated.
+
+// Find every pair of overlapping boxes
+// boxes: box array
+// count: number of boxes
+// buffer: work buffer (see lm2_r2_sweep_buffer_size / lm2_r3_sweep_buffer_size)
+// buffer_size: size of buffer in bytes
+LM2_API size_t lm2_r2_sweep_pairs_f64(const lm2_r2_f64* boxes, size_t count, void* buffer, size_t buffer_size, lm2_sweep_pair* out_pairs, size_t max_pairs);
+LM2_API size_t lm2_r2_sweep_pairs_f32(const lm2_r2_f32* boxes, size_t count, void* buffer, size_t buffer_size, lm2_sweep_pair* out_pairs, size_t max_pairs);
+LM2_API size_t lm2_r3_sweep_pairs_f64(const lm2_r3_f64* boxes, size_t count, void* buffer, size_t buffer_size, lm2_sweep_pair* out_pairs, size_t max_pairs);
+LM2_API size_t lm2_r3_sweep_pairs_f32(const lm2_r3_f32* boxes, size_t count, void* buffer, size_t buffer_size, lm2_sweep_pair* out_pairs, size_t max_pairs);
+
+// =============================================================================
+// Incremental Sweep
+// =============================================================================
+
+// Make a sweep state with no kept order
+// buffer: work buffer, kept between updates (see lm2_r2_sweep_buffer_size / lm2_r3_sweep_buffer_size)
+// buffer_size: size of buffer in bytes
+LM2_API lm2_sweep_f64 lm2_sweep_make_f64(void* buffer, size_t buffer_size);
+LM2_API lm2_sweep_f32 lm2_sweep_make_f32(void* buffer, size_t buffer_size);
+
+// Find every pair of overlapping boxes, reusing the order of the previous update.
+// The box at each index must be the same object between updates. When count
+// changes, or the boxes moved so far that repairing the order would cost more
+// than sorting, the boxes are sorted again and a new sweep axis is chosen; make
+// a new state to force this.
+LM2_API size_t lm2_r2_sweep_update_f64(lm2_sweep_f64* sweep, const lm2_r2_f64* boxes, size_t count, lm2_sweep_pair* out_pairs, size_t max_pairs);
+LM2_API size_t lm2_r2_sweep_update_f32(lm2_sweep_f32* sweep, const lm2_r2_f32* boxes, size_t count, lm2_sweep_pair* out_pairs, size_t max_pairs);
+LM2_API size_t lm2_r3_sweep_update_f64(lm2_sweep_f64* sweep, const lm2_r3_f64* boxes, size_t count, lm2_sweep_pair* out_pairs, size_t max_pairs);
+LM2_API size_t lm2_r3_sweep_update_f32(lm2_sweep_f32* sweep, const lm2_r3_f32* boxes, size_t count, lm2_sweep_pair* out_pairs, size_t max_pairs);
+
+// #############################################################################
+LM2_HEADER_END;
+// #############################################################################
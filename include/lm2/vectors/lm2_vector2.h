@@ -46,42 +46,42 @@ typedef union lm2_v2_f64 {
   _LM2_SUBSCRIPT_OP(double, 2)
 } lm2_v2_f64;
 
-LM2_API lm2_v2_f64 lm2_v2_add_f64(lm2_v2_f64 a, lm2_v2_f64 b);
-LM2_API lm2_v2_f64 lm2_v2_sub_f64(lm2_v2_f64 a, lm2_v2_f64 b);
-LM2_API lm2_v2_f64 lm2_v2_mul_f64(lm2_v2_f64 a, lm2_v2_f64 b);
-LM2_API lm2_v2_f64 lm2_v2_div_f64(lm2_v2_f64 a, lm2_v2_f64 b);
-LM2_API lm2_v2_f64 lm2_v2_add_s_f64(lm2_v2_f64 a, double b);
-LM2_API lm2_v2_f64 lm2_v2_sub_s_f64(lm2_v2_f64 a, double b);
-LM2_API lm2_v2_f64 lm2_v2_mul_s_f64(lm2_v2_f64 a, double b);
-LM2_API lm2_v2_f64 lm2_v2_div_s_f64(lm2_v2_f64 a, double b);
-LM2_API lm2_v2_f64 lm2_v2_neg_f64(lm2_v2_f64 a);
-LM2_API lm2_v2_f64 lm2_v2_floor_f64(lm2_v2_f64 a);
-LM2_API lm2_v2_f64 lm2_v2_ceil_f64(lm2_v2_f64 a);
-LM2_API lm2_v2_f64 lm2_v2_round_f64(lm2_v2_f64 a);
-LM2_API lm2_v2_f64 lm2_v2_trunc_f64(lm2_v2_f64 a);
-LM2_API lm2_v2_f64 lm2_v2_abs_f64(lm2_v2_f64 a);
-LM2_API lm2_v2_f64 lm2_v2_sign_f64(lm2_v2_f64 a);
-LM2_API lm2_v2_f64 lm2_v2_sign0_f64(lm2_v2_f64 a);
-LM2_API lm2_v2_f64 lm2_v2_saturate_f64(lm2_v2_f64 a);
-LM2_API lm2_v2_f64 lm2_v2_fract_f64(lm2_v2_f64 a);
-LM2_API lm2_v2_f64 lm2_v2_sqrt_f64(lm2_v2_f64 a);
-LM2_API lm2_v2_f64 lm2_v2_floor_multiple_f64(lm2_v2_f64 a, lm2_v2_f64 b);
-LM2_API lm2_v2_f64 lm2_v2_ceil_multiple_f64(lm2_v2_f64 a, lm2_v2_f64 b);
-LM2_API lm2_v2_f64 lm2_v2_round_multiple_f64(lm2_v2_f64 a, lm2_v2_f64 b);
-LM2_API lm2_v2_f64 lm2_v2_trunc_multiple_f64(lm2_v2_f64 a, lm2_v2_f64 b);
-LM2_API lm2_v2_f64 lm2_v2_min_f64(lm2_v2_f64 a, lm2_v2_f64 b);
-LM2_API lm2_v2_f64 lm2_v2_min_abs_f64(lm2_v2_f64 a, lm2_v2_f64 b);
-LM2_API lm2_v2_f64 lm2_v2_max_f64(lm2_v2_f64 a, lm2_v2_f64 b);
-LM2_API lm2_v2_f64 lm2_v2_max_abs_f64(lm2_v2_f64 a, lm2_v2_f64 b);
-LM2_API lm2_v2_f64 lm2_v2_mod_f64(lm2_v2_f64 a, lm2_v2_f64 b);
-LM2_API lm2_v2_f64 lm2_v2_pow_f64(lm2_v2_f64 a, lm2_v2_f64 b);
-LM2_API lm2_v2_f64 lm2_v2_clamp_f64(lm2_v2_f64 a, lm2_v2_f64 b, lm2_v2_f64 c);
-LM2_API lm2_v2_f64 lm2_v2_lerp_f64(lm2_v2_f64 a, lm2_v2_f64 b, lm2_v2_f64 c);
-LM2_API lm2_v2_f64 lm2_v2_smoothstep_f64(lm2_v2_f64 a, lm2_v2_f64 b, lm2_v2_f64 c);
-LM2_API lm2_v2_f64 lm2_v2_alpha_f64(lm2_v2_f64 a, lm2_v2_f64 b, lm2_v2_f64 c);
-LM2_API lm2_v2_f64 lm2_v2_make_f64(double x, double y);
-LM2_API lm2_v2_f64 lm2_v2_splat_f64(double v);
-LM2_API lm2_v2_f64 lm2_v2_zero_f64(void);
+LM2_INLINE lm2_v2_f64 lm2_v2_add_f64(lm2_v2_f64 a, lm2_v2_f64 b);
+LM2_INLINE lm2_v2_f64 lm2_v2_sub_f64(lm2_v2_f64 a, lm2_v2_f64 b);
+LM2_INLINE lm2_v2_f64 lm2_v2_mul_f64(lm2_v2_f64 a, lm2_v2_f64 b);
+LM2_INLINE lm2_v2_f64 lm2_v2_div_f64(lm2_v2_f64 a, lm2_v2_f64 b);
+LM2_INLINE lm2_v2_f64 lm2_v2_add_s_f64(lm2_v2_f64 a, double b);
+LM2_INLINE lm2_v2_f64 lm2_v2_sub_s_f64(lm2_v2_f64 a, double b);
+LM2_INLINE lm2_v2_f64 lm2_v2_mul_s_f64(lm2_v2_f64 a, double b);
+LM2_INLINE lm2_v2_f64 lm2_v2_div_s_f64(lm2_v2_f64 a, double b);
+LM2_INLINE lm2_v2_f64 lm2_v2_neg_f64(lm2_v2_f64 a);
+LM2_INLINE lm2_v2_f64 lm2_v2_floor_f64(lm2_v2_f64 a);
+LM2_INLINE lm2_v2_f64 lm2_v2_ceil_f64(lm2_v2_f64 a);
+LM2_INLINE lm2_v2_f64 lm2_v2_round_f64(lm2_v2_f64 a);
+LM2_INLINE lm2_v2_f64 lm2_v2_trunc_f64(lm2_v2_f64 a);
+LM2_INLINE lm2_v2_f64 lm2_v2_abs_f64(lm2_v2_f64 a);
+LM2_INLINE lm2_v2_f64 lm2_v2_sign_f64(lm2_v2_f64 a);
+LM2_INLINE lm2_v2_f64 lm2_v2_sign0_f64(lm2_v2_f64 a);
+LM2_INLINE lm2_v2_f64 lm2_v2_saturate_f64(lm2_v2_f64 a);
+LM2_INLINE lm2_v2_f64 lm2_v2_fract_f64(lm2_v2_f64 a);
+LM2_INLINE lm2_v2_f64 lm2_v2_sqrt_f64(lm2_v2_f64 a);
+LM2_INLINE lm2_v2_f64 lm2_v2_floor_multiple_f64(lm2_v2_f64 a, lm2_v2_f64 b);
+LM2_INLINE lm2_v2_f64 lm2_v2_ceil_multiple_f64(lm2_v2_f64 a, lm2_v2_f64 b);
+LM2_INLINE lm2_v2_f64 lm2_v2_round_multiple_f64(lm2_v2_f64 a, lm2_v2_f64 b);
+LM2_INLINE lm2_v2_f64 lm2_v2_trunc_multiple_f64(lm2_v2_f64 a, lm2_v2_f64 b);
+LM2_INLINE lm2_v2_f64 lm2_v2_min_f64(lm2_v2_f64 a, lm2_v2_f64 b);
+LM2_INLINE lm2_v2_f64 lm2_v2_min_abs_f64(lm2_v2_f64 a, lm2_v2_f64 b);
+LM2_INLINE lm2_v2_f64 lm2_v2_max_f64(lm2_v2_f64 a, lm2_v2_f64 b);
+LM2_INLINE lm2_v2_f64 lm2_v2_max_abs_f64(lm2_v2_f64 a, lm2_v2_f64 b);
+LM2_INLINE lm2_v2_f64 lm2_v2_mod_f64(lm2_v2_f64 a, lm2_v2_f64 b);
+LM2_INLINE lm2_v2_f64 lm2_v2_pow_f64(lm2_v2_f64 a, lm2_v2_f64 b);
+LM2_INLINE lm2_v2_f64 lm2_v2_clamp_f64(lm2_v2_f64 a, lm2_v2_f64 b, lm2_v2_f64 c);
+LM2_INLINE lm2_v2_f64 lm2_v2_lerp_f64(lm2_v2_f64 a, lm2_v2_f64 b, lm2_v2_f64 c);
+LM2_INLINE lm2_v2_f64 lm2_v2_smoothstep_f64(lm2_v2_f64 a, lm2_v2_f64 b, lm2_v2_f64 c);
+LM2_INLINE lm2_v2_f64 lm2_v2_alpha_f64(lm2_v2_f64 a, lm2_v2_f64 b, lm2_v2_f64 c);
+LM2_INLINE lm2_v2_f64 lm2_v2_make_f64(double x, double y);
+LM2_INLINE lm2_v2_f64 lm2_v2_splat_f64(double v);
+LM2_INLINE lm2_v2_f64 lm2_v2_zero_f64(void);
 
 // =============================================================================
 // lm2_v2_f32
@@ -99,42 +99,42 @@ typedef union lm2_v2_f32 {
   _LM2_SUBSCRIPT_OP(float, 2)
 } lm2_v2_f32;
 
-LM2_API lm2_v2_f32 lm2_v2_add_f32(lm2_v2_f32 a, lm2_v2_f32 b);
-LM2_API lm2_v2_f32 lm2_v2_sub_f32(lm2_v2_f32 a, lm2_v2_f32 b);
-LM2_API lm2_v2_f32 lm2_v2_mul_f32(lm2_v2_f32 a, lm2_v2_f32 b);
-LM2_API lm2_v2_f32 lm2_v2_div_f32(lm2_v2_f32 a, lm2_v2_f32 b);
-LM2_API lm2_v2_f32 lm2_v2_add_s_f32(lm2_v2_f32 a, float b);
-LM2_API lm2_v2_f32 lm2_v2_sub_s_f32(lm2_v2_f32 a, float b);
-LM2_API lm2_v2_f32 lm2_v2_mul_s_f32(lm2_v2_f32 a, float b);
-LM2_API lm2_v2_f32 lm2_v2_div_s_f32(lm2_v2_f32 a, float b);
-LM2_API lm2_v2_f32 lm2_v2_neg_f32(lm2_v2_f32 a);
-LM2_API lm2_v2_f32 lm2_v2_floor_f32(lm2_v2_f32 a);
-LM2_API lm2_v2_f32 lm2_v2_ceil_f32(lm2_v2_f32 a);
-LM2_API lm2_v2_f32 lm2_v2_round_f32(lm2_v2_f32 a);
-LM2_API lm2_v2_f32 lm2_v2_trunc_f32(lm2_v2_f32 a);
-LM2_API lm2_v2_f32 lm2_v2_abs_f32(lm2_v2_f32 a);
-LM2_API lm2_v2_f32 lm2_v2_sign_f32(lm2_v2_f32 a);
-LM2_API lm2_v2_f32 lm2_v2_sign0_f32(lm2_v2_f32 a);
-LM2_API lm2_v2_f32 lm2_v2_saturate_f32(lm2_v2_f32 a);
-LM2_API lm2_v2_f32 lm2_v2_fract_f32(lm2_v2_f32 a);
-LM2_API lm2_v2_f32 lm2_v2_sqrt_f32(lm2_v2_f32 a);
-LM2_API lm2_v2_f32 lm2_v2_floor_multiple_f32(lm2_v2_f32 a, lm2_v2_f32 b);
-LM2_API lm2_v2_f32 lm2_v2_ceil_multiple_f32(lm2_v2_f32 a, lm2_v2_f32 b);
-LM2_API lm2_v2_f32 lm2_v2_round_multiple_f32(lm2_v2_f32 a, lm2_v2_f32 b);
-LM2_API lm2_v2_f32 lm2_v2_trunc_multiple_f32(lm2_v2_f32 a, lm2_v2_f32 b);
-LM2_API lm2_v2_f32 lm2_v2_min_f32(lm2_v2_f32 a, lm2_v2_f32 b);
-LM2_API lm2_v2_f32 lm2_v2_min_abs_f32(lm2_v2_f32 a, lm2_v2_f32 b);
-LM2_API lm2_v2_f32 lm2_v2_max_f32(lm2_v2_f32 a, lm2_v2_f32 b);
-LM2_API lm2_v2_f32 lm2_v2_max_abs_f32(lm2_v2_f32 a, lm2_v2_f32 b);
-LM2_API lm2_v2_f32 lm2_v2_mod_f32(lm2_v2_f32 a, lm2_v2_f32 b);
-LM2_API lm2_v2_f32 lm2_v2_pow_f32(lm2_v2_f32 a, lm2_v2_f32 b);
-LM2_API lm2_v2_f32 lm2_v2_clamp_f32(lm2_v2_f32 a, lm2_v2_f32 b, lm2_v2_f32 c);
-LM2_API lm2_v2_f32 lm2_v2_lerp_f32(lm2_v2_f32 a, lm2_v2_f32 b, lm2_v2_f32 c);
-LM2_API lm2_v2_f32 lm2_v2_smoothstep_f32(lm2_v2_f32 a, lm2_v2_f32 b, lm2_v2_f32 c);
-LM2_API lm2_v2_f32 lm2_v2_alpha_f32(lm2_v2_f32 a, lm2_v2_f32 b, lm2_v2_f32 c);
-LM2_API lm2_v2_f32 lm2_v2_make_f32(float x, float y);
-LM2_API lm2_v2_f32 lm2_v2_splat_f32(float v);
-LM2_API lm2_v2_f32 lm2_v2_zero_f32(void);
+LM2_INLINE lm2_v2_f32 lm2_v2_add_f32(lm2_v2_f32 a, lm2_v2_f32 b);
+LM2_INLINE lm2_v2_f32 lm2_v2_sub_f32(lm2_v2_f32 a, lm2_v2_f32 b);
+LM2_INLINE lm2_v2_f32 lm2_v2_mul_f32(lm2_v2_f32 a, lm2_v2_f32 b);
+LM2_INLINE lm2_v2_f32 lm2_v2_div_f32(lm2_v2_f32 a, lm2_v2_f32 b);
+LM2_INLINE lm2_v2_f32 lm2_v2_add_s_f32(lm2_v2_f32 a, float b);
+LM2_INLINE lm2_v2_f32 lm2_v2_sub_s_f32(lm2_v2_f32 a, float b);
+LM2_INLINE lm2_v2_f32 lm2_v2_mul_s_f32(lm2_v2_f32 a, float b);
+LM2_INLINE lm2_v2_f32 lm2_v2_div_s_f32(lm2_v2_f32 a, float b);
+LM2_INLINE lm2_v2_f32 lm2_v2_neg_f32(lm2_v2_f32 a);
+LM2_INLINE lm2_v2_f32 lm2_v2_floor_f32(lm2_v2_f32 a);
+LM2_INLINE lm2_v2_f32 lm2_v2_ceil_f32(lm2_v2_f32 a);
+LM2_INLINE lm2_v2_f32 lm2_v2_round_f32(lm2_v2_f32 a);
+LM2_INLINE lm2_v2_f32 lm2_v2_trunc_f32(lm2_v2_f32 a);
+LM2_INLINE lm2_v2_f32 lm2_v2_abs_f32(lm2_v2_f32 a);
+LM2_INLINE lm2_v2_f32 lm2_v2_sign_f32(lm2_v2_f32 a);
+LM2_INLINE lm2_v2_f32 lm2_v2_sign0_f32(lm2_v2_f32 a);
+LM2_INLINE lm2_v2_f32 lm2_v2_saturate_f32(lm2_v2_f32 a);
+LM2_INLINE lm2_v2_f32 lm2_v2_fract_f32(lm2_v2_f32 a);
+LM2_INLINE lm2_v2_f32 lm2_v2_sqrt_f32(lm2_v2_f32 a);
+LM2_INLINE lm2_v2_f32 lm2_v2_floor_multiple_f32(lm2_v2_f32 a, lm2_v2_f32 b);
+LM2_INLINE lm2_v2_f32 lm2_v2_ceil_multiple_f32(lm2_v2_f32 a, lm2_v2_f32 b);
+LM2_INLINE lm2_v2_f32 lm2_v2_round_multiple_f32(lm2_v2_f32 a, lm2_v2_f32 b);
+LM2_INLINE lm2_v2_f32 lm2_v2_trunc_multiple_f32(lm2_v2_f32 a, lm2_v2_f32 b);
+LM2_INLINE lm2_v2_f32 lm2_v2_min_f32(lm2_v2_f32 a, lm2_v2_f32 b);
+LM2_INLINE lm2_v2_f32 lm2_v2_min_abs_f32(lm2_v2_f32 a, lm2_v2_f32 b);
+LM2_INLINE lm2_v2_f32 lm2_v2_max_f32(lm2_v2_f32 a, lm2_v2_f32 b);
+LM2_INLINE lm2_v2_f32 lm2_v2_max_abs_f32(lm2_v2_f32 a, lm2_v2_f32 b);
+LM2_INLINE lm2_v2_f32 lm2_v2_mod_f32(lm2_v2_f32 a, lm2_v2_f32 b);
+LM2_INLINE lm2_v2_f32 lm2_v2_pow_f32(lm2_v2_f32 a, lm2_v2_f32 b);
+LM2_INLINE lm2_v2_f32 lm2_v2_clamp_f32(lm2_v2_f32 a, lm2_v2_f32 b, lm2_v2_f32 c);
+LM2_INLINE lm2_v2_f32 lm2_v2_lerp_f32(lm2_v2_f32 a, lm2_v2_f32 b, lm2_v2_f32 c);
+LM2_INLINE lm2_v2_f32 lm2_v2_smoothstep_f32(lm2_v2_f32 a, lm2_v2_f32 b, lm2_v2_f32 c);
+LM2_INLINE lm2_v2_f32 lm2_v2_alpha_f32(lm2_v2_f32 a, lm2_v2_f32 b, lm2_v2_f32 c);
+LM2_INLINE lm2_v2_f32 lm2_v2_make_f32(float x, float y);
+LM2_INLINE lm2_v2_f32 lm2_v2_splat_f32(float v);
+LM2_INLINE lm2_v2_f32 lm2_v2_zero_f32(void);
 
 // =============================================================================
 // lm2_v2_i64
@@ -152,27 +152,27 @@ typedef union lm2_v2_i64 {
   _LM2_SUBSCRIPT_OP(int64_t, 2)
 } lm2_v2_i64;
 
-LM2_API lm2_v2_i64 lm2_v2_add_i64(lm2_v2_i64 a, lm2_v2_i64 b);
-LM2_API lm2_v2_i64 lm2_v2_sub_i64(lm2_v2_i64 a, lm2_v2_i64 b);
-LM2_API lm2_v2_i64 lm2_v2_mul_i64(lm2_v2_i64 a, lm2_v2_i64 b);
-LM2_API lm2_v2_i64 lm2_v2_div_i64(lm2_v2_i64 a, lm2_v2_i64 b);
-LM2_API lm2_v2_i64 lm2_v2_add_s_i64(lm2_v2_i64 a, int64_t b);
-LM2_API lm2_v2_i64 lm2_v2_sub_s_i64(lm2_v2_i64 a, int64_t b);
-LM2_API lm2_v2_i64 lm2_v2_mul_s_i64(lm2_v2_i64 a, int64_t b);
-LM2_API lm2_v2_i64 lm2_v2_div_s_i64(lm2_v2_i64 a, int64_t b);
-LM2_API lm2_v2_i64 lm2_v2_neg_i64(lm2_v2_i64 a);
-LM2_API lm2_v2_i64 lm2_v2_abs_i64(lm2_v2_i64 a);
-LM2_API lm2_v2_i64 lm2_v2_sign_i64(lm2_v2_i64 a);
-LM2_API lm2_v2_i64 lm2_v2_sign0_i64(lm2_v2_i64 a);
-LM2_API lm2_v2_i64 lm2_v2_min_i64(lm2_v2_i64 a, lm2_v2_i64 b);
-LM2_API lm2_v2_i64 lm2_v2_min_abs_i64(lm2_v2_i64 a, lm2_v2_i64 b);
-LM2_API lm2_v2_i64 lm2_v2_max_i64(lm2_v2_i64 a, lm2_v2_i64 b);
-LM2_API lm2_v2_i64 lm2_v2_max_abs_i64(lm2_v2_i64 a, lm2_v2_i64 b);
-LM2_API lm2_v2_i64 lm2_v2_mod_i64(lm2_v2_i64 a, lm2_v2_i64 b);
-LM2_API lm2_v2_i64 lm2_v2_clamp_i64(lm2_v2_i64 a, lm2_v2_i64 b, lm2_v2_i64 c);
-LM2_API lm2_v2_i64 lm2_v2_make_i64(int64_t x, int64_t y);
-LM2_API lm2_v2_i64 lm2_v2_splat_i64(int64_t v);
-LM2_API lm2_v2_i64 lm2_v2_zero_i64(void);
+LM2_INLINE lm2_v2_i64 lm2_v2_add_i64(lm2_v2_i64 a, lm2_v2_i64 b);
+LM2_INLINE lm2_v2_i64 lm2_v2_sub_i64(lm2_v2_i64 a, lm2_v2_i64 b);
+LM2_INLINE lm2_v2_i64 lm2_v2_mul_i64(lm2_v2_i64 a, lm2_v2_i64 b);
+LM2_INLINE lm2_v2_i64 lm2_v2_div_i64(lm2_v2_i64 a, lm2_v2_i64 b);
+LM2_INLINE lm2_v2_i64 lm2_v2_add_s_i64(lm2_v2_i64 a, int64_t b);
+LM2_INLINE lm2_v2_i64 lm2_v2_sub_s_i64(lm2_v2_i64 a, int64_t b);
+LM2_INLINE lm2_v2_i64 lm2_v2_mul_s_i64(lm2_v2_i64 a, int64_t b);
+LM2_INLINE lm2_v2_i64 lm2_v2_div_s_i64(lm2_v2_i64 a, int64_t b);
+LM2_INLINE lm2_v2_i64 lm2_v2_neg_i64(lm2_v2_i64 a);
+LM2_INLINE lm2_v2_i64 lm2_v2_abs_i64(lm2_v2_i64 a);
+LM2_INLINE lm2_v2_i64 lm2_v2_sign_i64(lm2_v2_i64 a);
+LM2_INLINE lm2_v2_i64 lm2_v2_sign0_i64(lm2_v2_i64 a);
+LM2_INLINE lm2_v2_i64 lm2_v2_min_i64(lm2_v2_i64 a, lm2_v2_i64 b);
+LM2_INLINE lm2_v2_i64 lm2_v2_min_abs_i64(lm2_v2_i64 a, lm2_v2_i64 b);
+LM2_INLINE lm2_v2_i64 lm2_v2_max_i64(lm2_v2_i64 a, lm2_v2_i64 b);
+LM2_INLINE lm2_v2_i64 lm2_v2_max_abs_i64(lm2_v2_i64 a, lm2_v2_i64 b);
+LM2_INLINE lm2_v2_i64 lm2_v2_mod_i64(lm2_v2_i64 a, lm2_v2_i64 b);
+LM2_INLINE lm2_v2_i64 lm2_v2_clamp_i64(lm2_v2_i64 a, lm2_v2_i64 b, lm2_v2_i64 c);
+LM2_INLINE lm2_v2_i64 lm2_v2_make_i64(int64_t x, int64_t y);
+LM2_INLINE lm2_v2_i64 lm2_v2_splat_i64(int64_t v);
+LM2_INLINE lm2_v2_i64 lm2_v2_zero_i64(void);
 
 // =============================================================================
 // lm2_v2_i32
@@ -190,27 +190,27 @@ typedef union lm2_v2_i32 {
   _LM2_SUBSCRIPT_OP(int32_t, 2)
 } lm2_v2_i32;
 
-LM2_API lm2_v2_i32 lm2_v2_add_i32(lm2_v2_i32 a, lm2_v2_i32 b);
-LM2_API lm2_v2_i32 lm2_v2_sub_i32(lm2_v2_i32 a, lm2_v2_i32 b);
-LM2_API lm2_v2_i32 lm2_v2_mul_i32(lm2_v2_i32 a, lm2_v2_i32 b);
-LM2_API lm2_v2_i32 lm2_v2_div_i32(lm2_v2_i32 a, lm2_v2_i32 b);
-LM2_API lm2_v2_i32 lm2_v2_add_s_i32(lm2_v2_i32 a, int32_t b);
-LM2_API lm2_v2_i32 lm2_v2_sub_s_i32(lm2_v2_i32 a, int32_t b);
-LM2_API lm2_v2_i32 lm2_v2_mul_s_i32(lm2_v2_i32 a, int32_t b);
-LM2_API lm2_v2_i32 lm2_v2_div_s_i32(lm2_v2_i32 a, int32_t b);
-LM2_API lm2_v2_i32 lm2_v2_neg_i32(lm2_v2_i32 a);
-LM2_API lm2_v2_i32 lm2_v2_abs_i32(lm2_v2_i32 a);
-LM2_API lm2_v2_i32 lm2_v2_sign_i32(lm2_v2_i32 a);
-LM2_API lm2_v2_i32 lm2_v2_sign0_i32(lm2_v2_i32 a);
-LM2_API lm2_v2_i32 lm2_v2_min_i32(lm2_v2_i32 a, lm2_v2_i32 b);
-LM2_API lm2_v2_i32 lm2_v2_min_abs_i32(lm2_v2_i32 a, lm2_v2_i32 b);
-LM2_API lm2_v2_i32 lm2_v2_max_i32(lm2_v2_i32 a, lm2_v2_i32 b);
-LM2_API lm2_v2_i32 lm2_v2_max_abs_i32(lm2_v2_i32 a, lm2_v2_i32 b);
-LM2_API lm2_v2_i32 lm2_v2_mod_i32(lm2_v2_i32 a, lm2_v2_i32 b);
-LM2_API lm2_v2_i32 lm2_v2_clamp_i32(lm2_v2_i32 a, lm2_v2_i32 b, lm2_v2_i32 c);
-LM2_API lm2_v2_i32 lm2_v2_make_i32(int32_t x, int32_t y);
-LM2_API lm2_v2_i32 lm2_v2_splat_i32(int32_t v);
-LM2_API lm2_v2_i32 lm2_v2_zero_i32(void);
+LM2_INLINE lm2_v2_i32 lm2_v2_add_i32(lm2_v2_i32 a, lm2_v2_i32 b);
+LM2_INLINE lm2_v2_i32 lm2_v2_sub_i32(lm2_v2_i32 a, lm2_v2_i32 b);
+LM2_INLINE lm2_v2_i32 lm2_v2_mul_i32(lm2_v2_i32 a, lm2_v2_i32 b);
+LM2_INLINE lm2_v2_i32 lm2_v2_div_i32(lm2_v2_i32 a, lm2_v2_i32 b);
+LM2_INLINE lm2_v2_i32 lm2_v2_add_s_i32(lm2_v2_i32 a, int32_t b);
+LM2_INLINE lm2_v2_i32 lm2_v2_sub_s_i32(lm2_v2_i32 a, int32_t b);
+LM2_INLINE lm2_v2_i32 lm2_v2_mul_s_i32(lm2_v2_i32 a, int32_t b);
+LM2_INLINE lm2_v2_i32 lm2_v2_div_s_i32(lm2_v2_i32 a, int32_t b);
+LM2_INLINE lm2_v2_i32 lm2_v2_neg_i32(lm2_v2_i32 a);
+LM2_INLINE lm2_v2_i32 lm2_v2_abs_i32(lm2_v2_i32 a);
+LM2_INLINE lm2_v2_i32 lm2_v2_sign_i32(lm2_v2_i32 a);
+LM2_INLINE lm2_v2_i32 lm2_v2_sign0_i32(lm2_v2_i32 a);
+LM2_INLINE lm2_v2_i32 lm2_v2_min_i32(lm2_v2_i32 a, lm2_v2_i32 b);
+LM2_INLINE lm2_v2_i32 lm2_v2_min_abs_i32(lm2_v2_i32 a, lm2_v2_i32 b);
+LM2_INLINE lm2_v2_i32 lm2_v2_max_i32(lm2_v2_i32 a, lm2_v2_i32 b);
+LM2_INLINE lm2_v2_i32 lm2_v2_max_abs_i32(lm2_v2_i32 a, lm2_v2_i32 b);
+LM2_INLINE lm2_v2_i32 lm2_v2_mod_i32(lm2_v2_i32 a, lm2_v2_i32 b);
+LM2_INLINE lm2_v2_i32 lm2_v2_clamp_i32(lm2_v2_i32 a, lm2_v2_i32 b, lm2_v2_i32 c);
+LM2_INLINE lm2_v2_i32 lm2_v2_make_i32(int32_t x, int32_t y);
+LM2_INLINE lm2_v2_i32 lm2_v2_splat_i32(int32_t v);
+LM2_INLINE lm2_v2_i32 lm2_v2_zero_i32(void);
 
 // =============================================================================
 // lm2_v2_i16
@@ -228,27 +228,27 @@ typedef union lm2_v2_i16 {
   _LM2_SUBSCRIPT_OP(int16_t, 2)
 } lm2_v2_i16;
 
-LM2_API lm2_v2_i16 lm2_v2_add_i16(lm2_v2_i16 a, lm2_v2_i16 b);
-LM2_API lm2_v2_i16 lm2_v2_sub_i16(lm2_v2_i16 a, lm2_v2_i16 b);
-LM2_API lm2_v2_i16 lm2_v2_mul_i16(lm2_v2_i16 a, lm2_v2_i16 b);
-LM2_API lm2_v2_i16 lm2_v2_div_i16(lm2_v2_i16 a, lm2_v2_i16 b);
-LM2_API lm2_v2_i16 lm2_v2_add_s_i16(lm2_v2_i16 a, int16_t b);
-LM2_API lm2_v2_i16 lm2_v2_sub_s_i16(lm2_v2_i16 a, int16_t b);
-LM2_API lm2_v2_i16 lm2_v2_mul_s_i16(lm2_v2_i16 a, int16_t b);
-LM2_API lm2_v2_i16 lm2_v2_div_s_i16(lm2_v2_i16 a, int16_t b);
-LM2_API lm2_v2_i16 lm2_v2_neg_i16(lm2_v2_i16 a);
-LM2_API lm2_v2_i16 lm2_v2_abs_i16(lm2_v2_i16 a);
-LM2_API lm2_v2_i16 lm2_v2_sign_i16(lm2_v2_i16 a);
-LM2_API lm2_v2_i16 lm2_v2_sign0_i16(lm2_v2_i16 a);
-LM2_API lm2_v2_i16 lm2_v2_min_i16(lm2_v2_i16 a, lm2_v2_i16 b);
-LM2_API lm2_v2_i16 lm2_v2_min_abs_i16(lm2_v2_i16 a, lm2_v2_i16 b);
-LM2_API lm2_v2_i16 lm2_v2_max_i16(lm2_v2_i16 a, lm2_v2_i16 b);
-LM2_API lm2_v2_i16 lm2_v2_max_abs_i16(lm2_v2_i16 a, lm2_v2_i16 b);
-LM2_API lm2_v2_i16 lm2_v2_mod_i16(lm2_v2_i16 a, lm2_v2_i16 b);
-LM2_API lm2_v2_i16 lm2_v2_clamp_i16(lm2_v2_i16 a, lm2_v2_i16 b, lm2_v2_i16 c);
-LM2_API lm2_v2_i16 lm2_v2_make_i16(int16_t x, int16_t y);
-LM2_API lm2_v2_i16 lm2_v2_splat_i16(int16_t v);
-LM2_API lm2_v2_i16 lm2_v2_zero_i16(void);
+LM2_INLINE lm2_v2_i16 lm2_v2_add_i16(lm2_v2_i16 a, lm2_v2_i16 b);
+LM2_INLINE lm2_v2_i16 lm2_v2_sub_i16(lm2_v2_i16 a, lm2_v2_i16 b);
+LM2_INLINE lm2_v2_i16 lm2_v2_mul_i16(lm2_v2_i16 a, lm2_v2_i16 b);
+LM2_INLINE lm2_v2_i16 lm2_v2_div_i16(lm2_v2_i16 a, lm2_v2_i16 b);
+LM2_INLINE lm2_v2_i16 lm2_v2_add_s_i16(lm2_v2_i16 a, int16_t b);
+LM2_INLINE lm2_v2_i16 lm2_v2_sub_s_i16(lm2_v2_i16 a, int16_t b);
+LM2_INLINE lm2_v2_i16 lm2_v2_mul_s_i16(lm2_v2_i16 a, int16_t b);
+LM2_INLINE lm2_v2_i16 lm2_v2_div_s_i16(lm2_v2_i16 a, int16_t b);
+LM2_INLINE lm2_v2_i16 lm2_v2_neg_i16(lm2_v2_i16 a);
+LM2_INLINE lm2_v2_i16 lm2_v2_abs_i16(lm2_v2_i16 a);
+LM2_INLINE lm2_v2_i16 lm2_v2_sign_i16(lm2_v2_i16 a);
+LM2_INLINE lm2_v2_i16 lm2_v2_sign0_i16(lm2_v2_i16 a);
+LM2_INLINE lm2_v2_i16 lm2_v2_min_i16(lm2_v2_i16 a, lm2_v2_i16 b);
+LM2_INLINE lm2_v2_i16 lm2_v2_min_abs_i16(lm2_v2_i16 a, lm2_v2_i16 b);
+LM2_INLINE lm2_v2_i16 lm2_v2_max_i16(lm2_v2_i16 a, lm2_v2_i16 b);
+LM2_INLINE lm2_v2_i16 lm2_v2_max_abs_i16(lm2_v2_i16 a, lm2_v2_i16 b);
+LM2_INLINE lm2_v2_i16 lm2_v2_mod_i16(lm2_v2_i16 a, lm2_v2_i16 b);
+LM2_INLINE lm2_v2_i16 lm2_v2_clamp_i16(lm2_v2_i16 a, lm2_v2_i16 b, lm2_v2_i16 c);
+LM2_INLINE lm2_v2_i16 lm2_v2_make_i16(int16_t x, int16_t y);
+LM2_INLINE lm2_v2_i16 lm2_v2_splat_i16(int16_t v);
+LM2_INLINE lm2_v2_i16 lm2_v2_zero_i16(void);
 
 // =============================================================================
 // lm2_v2_i8
@@ -266,27 +266,27 @@ typedef union lm2_v2_i8 {
   _LM2_SUBSCRIPT_OP(int8_t, 2)
 } lm2_v2_i8;
 
-LM2_API lm2_v2_i8 lm2_v2_add_i8(lm2_v2_i8 a, lm2_v2_i8 b);
-LM2_API lm2_v2_i8 lm2_v2_sub_i8(lm2_v2_i8 a, lm2_v2_i8 b);
-LM2_API lm2_v2_i8 lm2_v2_mul_i8(lm2_v2_i8 a, lm2_v2_i8 b);
-LM2_API lm2_v2_i8 lm2_v2_div_i8(lm2_v2_i8 a, lm2_v2_i8 b);
-LM2_API lm2_v2_i8 lm2_v2_add_s_i8(lm2_v2_i8 a, int8_t b);
-LM2_API lm2_v2_i8 lm2_v2_sub_s_i8(lm2_v2_i8 a, int8_t b);
-LM2_API lm2_v2_i8 lm2_v2_mul_s_i8(lm2_v2_i8 a, int8_t b);
-LM2_API lm2_v2_i8 lm2_v2_div_s_i8(lm2_v2_i8 a, int8_t b);
-LM2_API lm2_v2_i8 lm2_v2_neg_i8(lm2_v2_i8 a);
-LM2_API lm2_v2_i8 lm2_v2_abs_i8(lm2_v2_i8 a);
-LM2_API lm2_v2_i8 lm2_v2_sign_i8(lm2_v2_i8 a);
-LM2_API lm2_v2_i8 lm2_v2_sign0_i8(lm2_v2_i8 a);
-LM2_API lm2_v2_i8 lm2_v2_min_i8(lm2_v2_i8 a, lm2_v2_i8 b);
-LM2_API lm2_v2_i8 lm2_v2_min_abs_i8(lm2_v2_i8 a, lm2_v2_i8 b);
-LM2_API lm2_v2_i8 lm2_v2_max_i8(lm2_v2_i8 a, lm2_v2_i8 b);
-LM2_API lm2_v2_i8 lm2_v2_max_abs_i8(lm2_v2_i8 a, lm2_v2_i8 b);
-LM2_API lm2_v2_i8 lm2_v2_mod_i8(lm2_v2_i8 a, lm2_v2_i8 b);
-LM2_API lm2_v2_i8 lm2_v2_clamp_i8(lm2_v2_i8 a, lm2_v2_i8 b, lm2_v2_i8 c);
-LM2_API lm2_v2_i8 lm2_v2_make_i8(int8_t x, int8_t y);
-LM2_API lm2_v2_i8 lm2_v2_splat_i8(int8_t v);
-LM2_API lm2_v2_i8 lm2_v2_zero_i8(void);
+LM2_INLINE lm2_v2_i8 lm2_v2_add_i8(lm2_v2_i8 a, lm2_v2_i8 b);
+LM2_INLINE lm2_v2_i8 lm2_v2_sub_i8(lm2_v2_i8 a, lm2_v2_i8 b);
+LM2_INLINE lm2_v2_i8 lm2_v2_mul_i8(lm2_v2_i8 a, lm2_v2_i8 b);
+LM2_INLINE lm2_v2_i8 lm2_v2_div_i8(lm2_v2_i8 a, lm2_v2_i8 b);
+LM2_INLINE lm2_v2_i8 lm2_v2_add_s_i8(lm2_v2_i8 a, int8_t b);
+LM2_INLINE lm2_v2_i8 lm2_v2_sub_s_i8(lm2_v2_i8 a, int8_t b);
+LM2_INLINE lm2_v2_i8 lm2_v2_mul_s_i8(lm2_v2_i8 a, int8_t b);
+LM2_INLINE lm2_v2_i8 lm2_v2_div_s_i8(lm2_v2_i8 a, int8_t b);
+LM2_INLINE lm2_v2_i8 lm2_v2_neg_i8(lm2_v2_i8 a);
+LM2_INLINE lm2_v2_i8 lm2_v2_abs_i8(lm2_v2_i8 a);
+LM2_INLINE lm2_v2_i8 lm2_v2_sign_i8(lm2_v2_i8 a);
+LM2_INLINE lm2_v2_i8 lm2_v2_sign0_i8(lm2_v2_i8 a);
+LM2_INLINE lm2_v2_i8 lm2_v2_min_i8(lm2_v2_i8 a, lm2_v2_i8 b);
+LM2_INLINE lm2_v2_i8 lm2_v2_min_abs_i8(lm2_v2_i8 a, lm2_v2_i8 b);
+LM2_INLINE lm2_v2_i8 lm2_v2_max_i8(lm2_v2_i8 a, lm2_v2_i8 b);
+LM2_INLINE lm2_v2_i8 lm2_v2_max_abs_i8(lm2_v2_i8 a, lm2_v2_i8 b);
+LM2_INLINE lm2_v2_i8 lm2_v2_mod_i8(lm2_v2_i8 a, lm2_v2_i8 b);
+LM2_INLINE lm2_v2_i8 lm2_v2_clamp_i8(lm2_v2_i8 a, lm2_v2_i8 b, lm2_v2_i8 c);
+LM2_INLINE lm2_v2_i8 lm2_v2_make_i8(int8_t x, int8_t y);
+LM2_INLINE lm2_v2_i8 lm2_v2_splat_i8(int8_t v);
+LM2_INLINE lm2_v2_i8 lm2_v2_zero_i8(void);
 
 // =============================================================================
 // lm2_v2_u64
@@ -304,21 +304,21 @@ typedef union lm2_v2_u64 {
   _LM2_SUBSCRIPT_OP(uint64_t, 2)
 } lm2_v2_u64;
 
-LM2_API lm2_v2_u64 lm2_v2_add_u64(lm2_v2_u64 a, lm2_v2_u64 b);
-LM2_API lm2_v2_u64 lm2_v2_sub_u64(lm2_v2_u64 a, lm2_v2_u64 b);
-LM2_API lm2_v2_u64 lm2_v2_mul_u64(lm2_v2_u64 a, lm2_v2_u64 b);
-LM2_API lm2_v2_u64 lm2_v2_div_u64(lm2_v2_u64 a, lm2_v2_u64 b);
-LM2_API lm2_v2_u64 lm2_v2_add_s_u64(lm2_v2_u64 a, uint64_t b);
-LM2_API lm2_v2_u64 lm2_v2_sub_s_u64(lm2_v2_u64 a, uint64_t b);
-LM2_API lm2_v2_u64 lm2_v2_mul_s_u64(lm2_v2_u64 a, uint64_t b);
-LM2_API lm2_v2_u64 lm2_v2_div_s_u64(lm2_v2_u64 a, uint64_t b);
-LM2_API lm2_v2_u64 lm2_v2_min_u64(lm2_v2_u64 a, lm2_v2_u64 b);
-LM2_API lm2_v2_u64 lm2_v2_mod_u64(lm2_v2_u64 a, lm2_v2_u64 b);
-LM2_API lm2_v2_u64 lm2_v2_max_u64(lm2_v2_u64 a, lm2_v2_u64 b);
-LM2_API lm2_v2_u64 lm2_v2_clamp_u64(lm2_v2_u64 a, lm2_v2_u64 b, lm2_v2_u64 c);
-LM2_API lm2_v2_u64 lm2_v2_make_u64(uint64_t x, uint64_t y);
-LM2_API lm2_v2_u64 lm2_v2_splat_u64(uint64_t v);
-LM2_API lm2_v2_u64 lm2_v2_zero_u64(void);
+LM2_INLINE lm2_v2_u64 lm2_v2_add_u64(lm2_v2_u64 a, lm2_v2_u64 b);
+LM2_INLINE lm2_v2_u64 lm2_v2_sub_u64(lm2_v2_u64 a, lm2_v2_u64 b);
+LM2_INLINE lm2_v2_u64 lm2_v2_mul_u64(lm2_v2_u64 a, lm2_v2_u64 b);
+LM2_INLINE lm2_v2_u64 lm2_v2_div_u64(lm2_v2_u64 a, lm2_v2_u64 b);
+LM2_INLINE lm2_v2_u64 lm2_v2_add_s_u64(lm2_v2_u64 a, uint64_t b);
+LM2_INLINE lm2_v2_u64 lm2_v2_sub_s_u64(lm2_v2_u64 a, uint64_t b);
+LM2_INLINE lm2_v2_u64 lm2_v2_mul_s_u64(lm2_v2_u64 a, uint64_t b);
+LM2_INLINE lm2_v2_u64 lm2_v2_div_s_u64(lm2_v2_u64 a, uint64_t b);
+LM2_INLINE lm2_v2_u64 lm2_v2_min_u64(lm2_v2_u64 a, lm2_v2_u64 b);
+LM2_INLINE lm2_v2_u64 lm2_v2_mod_u64(lm2_v2_u64 a, lm2_v2_u64 b);
+LM2_INLINE lm2_v2_u64 lm2_v2_max_u64(lm2_v2_u64 a, lm2_v2_u64 b);
+LM2_INLINE lm2_v2_u64 lm2_v2_clamp_u64(lm2_v2_u64 a, lm2_v2_u64 b, lm2_v2_u64 c);
+LM2_INLINE lm2_v2_u64 lm2_v2_make_u64(uint64_t x, uint64_t y);
+LM2_INLINE lm2_v2_u64 lm2_v2_splat_u64(uint64_t v);
+LM2_INLINE lm2_v2_u64 lm2_v2_zero_u64(void);
 
 // =============================================================================
 // lm2_v2_u32
@@ -336,21 +336,21 @@ typedef union lm2_v2_u32 {
   _LM2_SUBSCRIPT_OP(uint32_t, 2)
 } lm2_v2_u32;
 
-LM2_API lm2_v2_u32 lm2_v2_add_u32(lm2_v2_u32 a, lm2_v2_u32 b);
-LM2_API lm2_v2_u32 lm2_v2_sub_u32(lm2_v2_u32 a, lm2_v2_u32 b);
-LM2_API lm2_v2_u32 lm2_v2_mul_u32(lm2_v2_u32 a, lm2_v2_u32 b);
-LM2_API lm2_v2_u32 lm2_v2_div_u32(lm2_v2_u32 a, lm2_v2_u32 b);
-LM2_API lm2_v2_u32 lm2_v2_add_s_u32(lm2_v2_u32 a, uint32_t b);
-LM2_API lm2_v2_u32 lm2_v2_sub_s_u32(lm2_v2_u32 a, uint32_t b);
-LM2_API lm2_v2_u32 lm2_v2_mul_s_u32(lm2_v2_u32 a, uint32_t b);
-LM2_API lm2_v2_u32 lm2_v2_div_s_u32(lm2_v2_u32 a, uint32_t b);
-LM2_API lm2_v2_u32 lm2_v2_mod_u32(lm2_v2_u32 a, lm2_v2_u32 b);
-LM2_API lm2_v2_u32 lm2_v2_min_u32(lm2_v2_u32 a, lm2_v2_u32 b);
-LM2_API lm2_v2_u32 lm2_v2_max_u32(lm2_v2_u32 a, lm2_v2_u32 b);
-LM2_API lm2_v2_u32 lm2_v2_clamp_u32(lm2_v2_u32 a, lm2_v2_u32 b, lm2_v2_u32 c);
-LM2_API lm2_v2_u32 lm2_v2_make_u32(uint32_t x, uint32_t y);
-LM2_API lm2_v2_u32 lm2_v2_splat_u32(uint32_t v);
-LM2_API lm2_v2_u32 lm2_v2_zero_u32(void);
+LM2_INLINE lm2_v2_u32 lm2_v2_add_u32(lm2_v2_u32 a, lm2_v2_u32 b);
+LM2_INLINE lm2_v2_u32 lm2_v2_sub_u32(lm2_v2_u32 a, lm2_v2_u32 b);
+LM2_INLINE lm2_v2_u32 lm2_v2_mul_u32(lm2_v2_u32 a, lm2_v2_u32 b);
+LM2_INLINE lm2_v2_u32 lm2_v2_div_u32(lm2_v2_u32 a, lm2_v2_u32 b);
+LM2_INLINE lm2_v2_u32 lm2_v2_add_s_u32(lm2_v2_u32 a, uint32_t b);
+LM2_INLINE lm2_v2_u32 lm2_v2_sub_s_u32(lm2_v2_u32 a, uint32_t b);
+LM2_INLINE lm2_v2_u32 lm2_v2_mul_s_u32(lm2_v2_u32 a, uint32_t b);
+LM2_INLINE lm2_v2_u32 lm2_v2_div_s_u32(lm2_v2_u32 a, uint32_t b);
+LM2_INLINE lm2_v2_u32 lm2_v2_mod_u32(lm2_v2_u32 a, lm2_v2_u32 b);
+LM2_INLINE lm2_v2_u32 lm2_v2_min_u32(lm2_v2_u32 a, lm2_v2_u32 b);
+LM2_INLINE lm2_v2_u32 lm2_v2_max_u32(lm2_v2_u32 a, lm2_v2_u32 b);
+LM2_INLINE lm2_v2_u32 lm2_v2_clamp_u32(lm2_v2_u32 a, lm2_v2_u32 b, lm2_v2_u32 c);
+LM2_INLINE lm2_v2_u32 lm2_v2_make_u32(uint32_t x, uint32_t y);
+LM2_INLINE lm2_v2_u32 lm2_v2_splat_u32(uint32_t v);
+LM2_INLINE lm2_v2_u32 lm2_v2_zero_u32(void);
 
 // =============================================================================
 // lm2_v2_u16
@@ -368,21 +368,21 @@ typedef union lm2_v2_u16 {
   _LM2_SUBSCRIPT_OP(uint16_t, 2)
 } lm2_v2_u16;
 
-LM2_API lm2_v2_u16 lm2_v2_add_u16(lm2_v2_u16 a, lm2_v2_u16 b);
-LM2_API lm2_v2_u16 lm2_v2_sub_u16(lm2_v2_u16 a, lm2_v2_u16 b);
-LM2_API lm2_v2_u16 lm2_v2_mul_u16(lm2_v2_u16 a, lm2_v2_u16 b);
-LM2_API lm2_v2_u16 lm2_v2_div_u16(lm2_v2_u16 a, lm2_v2_u16 b);
-LM2_API lm2_v2_u16 lm2_v2_add_s_u16(lm2_v2_u16 a, uint16_t b);
-LM2_API lm2_v2_u16 lm2_v2_sub_s_u16(lm2_v2_u16 a, uint16_t b);
-LM2_API lm2_v2_u16 lm2_v2_mul_s_u16(lm2_v2_u16 a, uint16_t b);
-LM2_API lm2_v2_u16 lm2_v2_div_s_u16(lm2_v2_u16 a, uint16_t b);
-LM2_API lm2_v2_u16 lm2_v2_mod_u16(lm2_v2_u16 a, lm2_v2_u16 b);
-LM2_API lm2_v2_u16 lm2_v2_min_u16(lm2_v2_u16 a, lm2_v2_u16 b);
-LM2_API lm2_v2_u16 lm2_v2_max_u16(lm2_v2_u16 a, lm2_v2_u16 b);
-LM2_API lm2_v2_u16 lm2_v2_clamp_u16(lm2_v2_u16 a, lm2_v2_u16 b, lm2_v2_u16 c);
-LM2_API lm2_v2_u16 lm2_v2_make_u16(uint16_t x, uint16_t y);
-LM2_API lm2_v2_u16 lm2_v2_splat_u16(uint16_t v);
-LM2_API lm2_v2_u16 lm2_v2_zero_u16(void);
+LM2_INLINE lm2_v2_u16 lm2_v2_add_u16(lm2_v2_u16 a, lm2_v2_u16 b);
+LM2_INLINE lm2_v2_u16 lm2_v2_sub_u16(lm2_v2_u16 a, lm2_v2_u16 b);
+LM2_INLINE lm2_v2_u16 lm2_v2_mul_u16(lm2_v2_u16 a, lm2_v2_u16 b);
+LM2_INLINE lm2_v2_u16 lm2_v2_div_u16(lm2_v2_u16 a, lm2_v2_u16 b);
+LM2_INLINE lm2_v2_u16 lm2_v2_add_s_u16(lm2_v2_u16 a, uint16_t b);
+LM2_INLINE lm2_v2_u16 lm2_v2_sub_s_u16(lm2_v2_u16 a, uint16_t b);
+LM2_INLINE lm2_v2_u16 lm2_v2_mul_s_u16(lm2_v2_u16 a, uint16_t b);
+LM2_INLINE lm2_v2_u16 lm2_v2_div_s_u16(lm2_v2_u16 a, uint16_t b);
+LM2_INLINE lm2_v2_u16 lm2_v2_mod_u16(lm2_v2_u16 a, lm2_v2_u16 b);
+LM2_INLINE lm2_v2_u16 lm2_v2_min_u16(lm2_v2_u16 a, lm2_v2_u16 b);
+LM2_INLINE lm2_v2_u16 lm2_v2_max_u16(lm2_v2_u16 a, lm2_v2_u16 b);
+LM2_INLINE lm2_v2_u16 lm2_v2_clamp_u16(lm2_v2_u16 a, lm2_v2_u16 b, lm2_v2_u16 c);
+LM2_INLINE lm2_v2_u16 lm2_v2_make_u16(uint16_t x, uint16_t y);
+LM2_INLINE lm2_v2_u16 lm2_v2_splat_u16(uint16_t v);
+LM2_INLINE lm2_v2_u16 lm2_v2_zero_u16(void);
 
 // =============================================================================
 // lm2_v2_u8
@@ -400,22 +400,26 @@ typedef union lm2_v2_u8 {
   _LM2_SUBSCRIPT_OP(uint8_t, 2)
 } lm2_v2_u8;
 
-LM2_API lm2_v2_u8 lm2_v2_add_u8(lm2_v2_u8 a, lm2_v2_u8 b);
-LM2_API lm2_v2_u8 lm2_v2_sub_u8(lm2_v2_u8 a, lm2_v2_u8 b);
-LM2_API lm2_v2_u8 lm2_v2_mul_u8(lm2_v2_u8 a, lm2_v2_u8 b);
-LM2_API lm2_v2_u8 lm2_v2_div_u8(lm2_v2_u8 a, lm2_v2_u8 b);
-LM2_API lm2_v2_u8 lm2_v2_add_s_u8(lm2_v2_u8 a, uint8_t b);
-LM2_API lm2_v2_u8 lm2_v2_sub_s_u8(lm2_v2_u8 a, uint8_t b);
-LM2_API lm2_v2_u8 lm2_v2_mul_s_u8(lm2_v2_u8 a, uint8_t b);
-LM2_API lm2_v2_u8 lm2_v2_div_s_u8(lm2_v2_u8 a, uint8_t b);
-LM2_API lm2_v2_u8 lm2_v2_mod_u8(lm2_v2_u8 a, lm2_v2_u8 b);
-LM2_API lm2_v2_u8 lm2_v2_min_u8(lm2_v2_u8 a, lm2_v2_u8 b);
-LM2_API lm2_v2_u8 lm2_v2_max_u8(lm2_v2_u8 a, lm2_v2_u8 b);
-LM2_API lm2_v2_u8 lm2_v2_clamp_u8(lm2_v2_u8 a, lm2_v2_u8 b, lm2_v2_u8 c);
-LM2_API lm2_v2_u8 lm2_v2_make_u8(uint8_t x, uint8_t y);
-LM2_API lm2_v2_u8 lm2_v2_splat_u8(uint8_t v);
-LM2_API lm2_v2_u8 lm2_v2_zero_u8(void);
+LM2_INLINE lm2_v2_u8 lm2_v2_add_u8(lm2_v2_u8 a, lm2_v2_u8 b);
+LM2_INLINE lm2_v2_u8 lm2_v2_sub_u8(lm2_v2_u8 a, lm2_v2_u8 b);
+LM2_INLINE lm2_v2_u8 lm2_v2_mul_u8(lm2_v2_u8 a, lm2_v2_u8 b);
+LM2_INLINE lm2_v2_u8 lm2_v2_div_u8(lm2_v2_u8 a, lm2_v2_u8 b);
+LM2_INLINE lm2_v2_u8 lm2_v2_add_s_u8(lm2_v2_u8 a, uint8_t b);
+LM2_INLINE lm2_v2_u8 lm2_v2_sub_s_u8(lm2_v2_u8 a, uint8_t b);
+LM2_INLINE lm2_v2_u8 lm2_v2_mul_s_u8(lm2_v2_u8 a, uint8_t b);
+LM2_INLINE lm2_v2_u8 lm2_v2_div_s_u8(lm2_v2_u8 a, uint8_t b);
+LM2_INLINE lm2_v2_u8 lm2_v2_mod_u8(lm2_v2_u8 a, lm2_v2_u8 b);
+LM2_INLINE lm2_v2_u8 lm2_v2_min_u8(lm2_v2_u8 a, lm2_v2_u8 b);
+LM2_INLINE lm2_v2_u8 lm2_v2_max_u8(lm2_v2_u8 a, lm2_v2_u8 b);
+LM2_INLINE lm2_v2_u8 lm2_v2_clamp_u8(lm2_v2_u8 a, lm2_v2_u8 b, lm2_v2_u8 c);
+LM2_INLINE lm2_v2_u8 lm2_v2_make_u8(uint8_t x, uint8_t y);
+LM2_INLINE lm2_v2_u8 lm2_v2_splat_u8(uint8_t v);
+LM2_INLINE lm2_v2_u8 lm2_v2_zero_u8(void);
 
 // #############################################################################
 LM2_HEADER_END;
-// #############################################################################
\ No newline at end of file
+// #############################################################################
+
+#ifdef LM2_INLINE_IMPLEMENTATION
+#  include "lm2/inline/lm2_vector2_inline.h"
+#endif
\ No newline at end of file
@@ -0,0 +1,338 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include "lm2/lm2_base.h"
+#include "lm2/vectors/lm2_vector2.h"
+#include "lm2/vectors/lm2_vector3.h"
+#include "lm2/vectors/lm2_vector4.h"
+
+// #############################################################################
+LM2_HEADER_BEGIN;
+// #############################################################################
+
+// =============================================================================
+// SoA Stream Types
+// =============================================================================
+// Structure-of-arrays views over caller-managed component arrays: element i of
+// a lm2_v3_soa_f32 is (x[i], y[i], z[i]). The batch kernels below mirror the
+// per-element vector API and are vectorized (SSE2/AVX on x86, NEON on AArch64)
+// with a scalar loop for the remaining elements, so any count is valid.
+//
+// All streams passed to one call must have the same count. Outputs may alias
+// inputs element for element (out == a is fine), but must not partially
+// overlap them. The kernels skip the per-element safe-op assertions.
+
+typedef struct lm2_v2_soa_f64 {
+  double* x;     // X components (caller-managed)
+  double* y;     // Y components (caller-managed)
+  size_t count;  // Number of vectors
+} lm2_v2_soa_f64;
+
+typedef struct lm2_v2_soa_f32 {
+  float* x;      // X components (caller-managed)
+  float* y;      // Y components (caller-managed)
+  size_t count;  // Number of vectors
+} lm2_v2_soa_f32;
+
+typedef struct lm2_v3_soa_f64 {
+  double* x;     // X components (caller-managed)
+  double* y;     // Y components (caller-managed)
+  double* z;     // Z components (caller-managed)
+  size_t count;  // Number of vectors
+} lm2_v3_soa_f64;
+
+typedef struct lm2_v3_soa_f32 {
+  float* x;      // X components (caller-managed)
+  float* y;      // Y components (caller-managed)
+  float* z;      // Z components (caller-managed)
+  size_t count;  // Number of vectors
+} lm2_v3_soa_f32;
+
+typedef struct lm2_v4_soa_f64 {
+  double* x;     // X components (caller-managed)
+  double* y;     // Y components (caller-managed)
+  double* z;     // Z components (caller-managed)
+  double* w;     // W components (caller-managed)
+  size_t count;  // Number of vectors
+} lm2_v4_soa_f64;
+
+typedef struct lm2_v4_soa_f32 {
+  float* x;      // X components (caller-managed)
+  float* y;      // Y components (caller-managed)
+  float* z;      // Z components (caller-managed)
+  float* w;      // W components (caller-managed)
+  size_t count;  // Number of vectors
+} lm2_v4_soa_f32;
+
+// =============================================================================
+// lm2_v2_soa_f64
+// =============================================================================
+
+// Create a stream view over component arrays (caller manages memory)
+LM2_API lm2_v2_soa_f64 lm2_v2_soa_make_f64(double* x, double* y, size_t count);
+
+// Component-wise arithmetic: out[i] = a[i] op b[i]
+LM2_API void lm2_v2_soa_add_f64(lm2_v2_soa_f64 a, lm2_v2_soa_f64 b, lm2_v2_soa_f64 out);
+LM2_API void lm2_v2_soa_sub_f64(lm2_v2_soa_f64 a, lm2_v2_soa_f64 b, lm2_v2_soa_f64 out);
+LM2_API void lm2_v2_soa_mul_f64(lm2_v2_soa_f64 a, lm2_v2_soa_f64 b, lm2_v2_soa_f64 out);
+LM2_API void lm2_v2_soa_div_f64(lm2_v2_soa_f64 a, lm2_v2_soa_f64 b, lm2_v2_soa_f64 out);
+
+// Scalar arithmetic: out[i] = a[i] op s
+LM2_API void lm2_v2_soa_add_s_f64(lm2_v2_soa_f64 a, double s, lm2_v2_soa_f64 out);
+LM2_API void lm2_v2_soa_sub_s_f64(lm2_v2_soa_f64 a, double s, lm2_v2_soa_f64 out);
+LM2_API void lm2_v2_soa_mul_s_f64(lm2_v2_soa_f64 a, double s, lm2_v2_soa_f64 out);
+LM2_API void lm2_v2_soa_div_s_f64(lm2_v2_soa_f64 a, double s, lm2_v2_soa_f64 out);
+
+// Component-wise min/max, clamp to [min, max] and lerp with a shared t
+LM2_API void lm2_v2_soa_min_f64(lm2_v2_soa_f64 a, lm2_v2_soa_f64 b, lm2_v2_soa_f64 out);
+LM2_API void lm2_v2_soa_max_f64(lm2_v2_soa_f64 a, lm2_v2_soa_f64 b, lm2_v2_soa_f64 out);
+LM2_API void lm2_v2_soa_clamp_f64(lm2_v2_soa_f64 a, lm2_v2_f64 min, lm2_v2_f64 max, lm2_v2_soa_f64 out);
+LM2_API void lm2_v2_soa_lerp_f64(lm2_v2_soa_f64 a, double t, lm2_v2_soa_f64 b, lm2_v2_soa_f64 out);
+
+// Per-element scalar results written to out[0..count)
+LM2_API void lm2_v2_soa_dot_f64(lm2_v2_soa_f64 a, lm2_v2_soa_f64 b, double* out);
+LM2_API void lm2_v2_soa_length_f64(lm2_v2_soa_f64 a, double* out);
+LM2_API void lm2_v2_soa_length_sq_f64(lm2_v2_soa_f64 a, double* out);
+LM2_API void lm2_v2_soa_distance_f64(lm2_v2_soa_f64 a, lm2_v2_soa_f64 b, double* out);
+
+// Normalize each element (zero-length elements become zero)
+LM2_API void lm2_v2_soa_norm_f64(lm2_v2_soa_f64 a, lm2_v2_soa_f64 out);
+
+// Reflect each element around its normal: v - 2 * dot(v, n) * n
+LM2_API void lm2_v2_soa_reflect_f64(lm2_v2_soa_f64 v, lm2_v2_soa_f64 normal, lm2_v2_soa_f64 out);
+
+// AoS <-> SoA transposes (count elements)
+LM2_API void lm2_v2_soa_from_aos_f64(const lm2_v2_f64* src, lm2_v2_soa_f64 out);
+LM2_API void lm2_v2_soa_to_aos_f64(lm2_v2_soa_f64 a, lm2_v2_f64* dst);
+
+// =============================================================================
+// lm2_v2_soa_f32
+// =============================================================================
+
+// Create a stream view over component arrays (caller manages memory)
+LM2_API lm2_v2_soa_f32 lm2_v2_soa_make_f32(float* x, float* y, size_t count);
+
+// Component-wise arithmetic: out[i] = a[i] op b[i]
+LM2_API void lm2_v2_soa_add_f32(lm2_v2_soa_f32 a, lm2_v2_soa_f32 b, lm2_v2_soa_f32 out);
+LM2_API void lm2_v2_soa_sub_f32(lm2_v2_soa_f32 a, lm2_v2_soa_f32 b, lm2_v2_soa_f32 out);
+LM2_API void lm2_v2_soa_mul_f32(lm2_v2_soa_f32 a, lm2_v2_soa_f32 b, lm2_v2_soa_f32 out);
+LM2_API void lm2_v2_soa_div_f32(lm2_v2_soa_f32 a, lm2_v2_soa_f32 b, lm2_v2_soa_f32 out);
+
+// Scalar arithmetic: out[i] = a[i] op s
+LM2_API void lm2_v2_soa_add_s_f32(lm2_v2_soa_f32 a, float s, lm2_v2_soa_f32 out);
+LM2_API void lm2_v2_soa_sub_s_f32(lm2_v2_soa_f32 a, float s, lm2_v2_soa_f32 out);
+LM2_API void lm2_v2_soa_mul_s_f32(lm2_v2_soa_f32 a, float s, lm2_v2_soa_f32 out);
+LM2_API void lm2_v2_soa_div_s_f32(lm2_v2_soa_f32 a, float s, lm2_v2_soa_f32 out);
+
+// Component-wise min/max, clamp to [min, max] and lerp with a shared t
+LM2_API void lm2_v2_soa_min_f32(lm2_v2_soa_f32 a, lm2_v2_soa_f32 b, lm2_v2_soa_f32 out);
+LM2_API void lm2_v2_soa_max_f32(lm2_v2_soa_f32 a, lm2_v2_soa_f32 b, lm2_v2_soa_f32 out);
+LM2_API void lm2_v2_soa_clamp_f32(lm2_v2_soa_f32 a, lm2_v2_f32 min, lm2_v2_f32 max, lm2_v2_soa_f32 out);
+LM2_API void lm2_v2_soa_lerp_f32(lm2_v2_soa_f32 a, float t, lm2_v2_soa_f32 b, lm2_v2_soa_f32 out);
+
+// Per-element scalar results written to out[0..count)
+LM2_API void lm2_v2_soa_dot_f32(lm2_v2_soa_f32 a, lm2_v2_soa_f32 b, float* out);
+LM2_API void lm2_v2_soa_length_f32(lm2_v2_soa_f32 a, float* out);
+LM2_API void lm2_v2_soa_length_sq_f32(lm2_v2_soa_f32 a, float* out);
+LM2_API void lm2_v2_soa_distance_f32(lm2_v2_soa_f32 a, lm2_v2_soa_f32 b, float* out);
+
+// Normalize each element (zero-length elements become zero)
+LM2_API void lm2_v2_soa_norm_f32(lm2_v2_soa_f32 a, lm2_v2_soa_f32 out);
+
+// Reflect each element around its normal: v - 2 * dot(v, n) * n
+LM2_API void lm2_v2_soa_reflect_f32(lm2_v2_soa_f32 v, lm2_v2_soa_f32 normal, lm2_v2_soa_f32 out);
+
+// AoS <-> SoA transposes (count elements)
+LM2_API void lm2_v2_soa_from_aos_f32(const lm2_v2_f32* src, lm2_v2_soa_f32 out);
+LM2_API void lm2_v2_soa_to_aos_f32(lm2_v2_soa_f32 a, lm2_v2_f32* dst);
+
+// =============================================================================
+// lm2_v3_soa_f64
+// =============================================================================
+
+// Create a stream view over component arrays (caller manages memory)
+LM2_API lm2_v3_soa_f64 lm2_v3_soa_make_f64(double* x, double* y, double* z, size_t count);
+
+// Component-wise arithmetic: out[i] = a[i] op b[i]
+LM2_API void lm2_v3_soa_add_f64(lm2_v3_soa_f64 a, lm2_v3_soa_f64 b, lm2_v3_soa_f64 out);
+LM2_API void lm2_v3_soa_sub_f64(lm2_v3_soa_f64 a, lm2_v3_soa_f64 b, lm2_v3_soa_f64 out);
+LM2_API void lm2_v3_soa_mul_f64(lm2_v3_soa_f64 a, lm2_v3_soa_f64 b, lm2_v3_soa_f64 out);
+LM2_API void lm2_v3_soa_div_f64(lm2_v3_soa_f64 a, lm2_v3_soa_f64 b, lm2_v3_soa_f64 out);
+
+// Scalar arithmetic: out[i] = a[i] op s
+LM2_API void lm2_v3_soa_add_s_f64(lm2_v3_soa_f64 a, double s, lm2_v3_soa_f64 out);
+LM2_API void lm2_v3_soa_sub_s_f64(lm2_v3_soa_f64 a, double s, lm2_v3_soa_f64 out);
+LM2_API void lm2_v3_soa_mul_s_f64(lm2_v3_soa_f64 a, double s, lm2_v3_soa_f64 out);
+LM2_API void lm2_v3_soa_div_s_f64(lm2_v3_soa_f64 a, double s, lm2_v3_soa_f64 out);
+
+// Component-wise min/max, clamp to [min, max] and lerp with a shared t
+LM2_API void lm2_v3_soa_min_f64(lm2_v3_soa_f64 a, lm2_v3_soa_f64 b, lm2_v3_soa_f64 out);
+LM2_API void lm2_v3_soa_max_f64(lm2_v3_soa_f64 a, lm2_v3_soa_f64 b, lm2_v3_soa_f64 out);
+LM2_API void lm2_v3_soa_clamp_f64(lm2_v3_soa_f64 a, lm2_v3_f64 min, lm2_v3_f64 max, lm2_v3_soa_f64 out);
+LM2_API void lm2_v3_soa_lerp_f64(lm2_v3_soa_f64 a, double t, lm2_v3_soa_f64 b, lm2_v3_soa_f64 out);
+
+// Per-element scalar results written to out[0..count)
+LM2_API void lm2_v3_soa_dot_f64(lm2_v3_soa_f64 a, lm2_v3_soa_f64 b, double* out);
+LM2_API void lm2_v3_soa_length_f64(lm2_v3_soa_f64 a, double* out);
+LM2_API void lm2_v3_soa_length_sq_f64(lm2_v3_soa_f64 a, double* out);
+LM2_API void lm2_v3_soa_distance_f64(lm2_v3_soa_f64 a, lm2_v3_soa_f64 b, double* out);
+
+// Normalize each element (zero-length elements become zero)
+LM2_API void lm2_v3_soa_norm_f64(lm2_v3_soa_f64 a, lm2_v3_soa_f64 out);
+
+// Cross product: out[i] = cross(a[i], b[i])
+LM2_API void lm2_v3_soa_cross_f64(lm2_v3_soa_f64 a, lm2_v3_soa_f64 b, lm2_v3_soa_f64 out);
+
+// Reflect each element around its normal: v - 2 * dot(v, n) * n
+LM2_API void lm2_v3_soa_reflect_f64(lm2_v3_soa_f64 v, lm2_v3_soa_f64 normal, lm2_v3_soa_f64 out);
+
+// AoS <-> SoA transposes (count elements)
+LM2_API void lm2_v3_soa_from_aos_f64(const lm2_v3_f64* src, lm2_v3_soa_f64 out);
+LM2_API void lm2_v3_soa_to_aos_f64(lm2_v3_soa_f64 a, lm2_v3_f64* dst);
+
+// =============================================================================
+// lm2_v3_soa_f32
+// =============================================================================
+
+// Create a stream view over component arrays (caller manages memory)
+LM2_API lm2_v3_soa_f32 lm2_v3_soa_make_f32(float* x, float* y, float* z, size_t count);
+
+// Component-wise arithmetic: out[i] = a[i] op b[i]
+LM2_API void lm2_v3_soa_add_f32(lm2_v3_soa_f32 a, lm2_v3_soa_f32 b, lm2_v3_soa_f32 out);
+LM2_API void lm2_v3_soa_sub_f32(lm2_v3_soa_f32 a, lm2_v3_soa_f32 b, lm2_v3_soa_f32 out);
+LM2_API void lm2_v3_soa_mul_f32(lm2_v3_soa_f32 a, lm2_v3_soa_f32 b, lm2_v3_soa_f32 out);
+LM2_API void lm2_v3_soa_div_f32(lm2_v3_soa_f32 a, lm2_v3_soa_f32 b, lm2_v3_soa_f32 out);
+
+// Scalar arithmetic: out[i] = a[i] op s
+LM2_API void lm2_v3_soa_add_s_f32(lm2_v3_soa_f32 a, float s, lm2_v3_soa_f32 out);
+LM2_API void lm2_v3_soa_sub_s_f32(lm2_v3_soa_f32 a, float s, lm2_v3_soa_f32 out);
+LM2_API void lm2_v3_soa_mul_s_f32(lm2_v3_soa_f32 a, float s, lm2_v3_soa_f32 out);
+LM2_API void lm2_v3_soa_div_s_f32(lm2_v3_soa_f32 a, float s, lm2_v3_soa_f32 out);
+
+// Component-wise min/max, clamp to [min, max] and lerp with a shared t
+LM2_API void lm2_v3_soa_min_f32(lm2_v3_soa_f32 a, lm2_v3_soa_f32 b, lm2_v3_soa_f32 out);
+LM2_API void lm2_v3_soa_max_f32(lm2_v3_soa_f32 a, lm2_v3_soa_f32 b, lm2_v3_soa_f32 out);
+LM2_API void lm2_v3_soa_clamp_f32(lm2_v3_soa_f32 a, lm2_v3_f32 min, lm2_v3_f32 max, lm2_v3_soa_f32 out);
+LM2_API void lm2_v3_soa_lerp_f32(lm2_v3_soa_f32 a, float t, lm2_v3_soa_f32 b, lm2_v3_soa_f32 out);
+
+// Per-element scalar results written to out[0..count)
+LM2_API void lm2_v3_soa_dot_f32(lm2_v3_soa_f32 a, lm2_v3_soa_f32 b, float* out);
+LM2_API void lm2_v3_soa_length_f32(lm2_v3_soa_f32 a, float* out);
+LM2_API void lm2_v3_soa_length_sq_f32(lm2_v3_soa_f32 a, float* out);
+LM2_API void lm2_v3_soa_distance_f32(lm2_v3_soa_f32 a, lm2_v3_soa_f32 b, float* out);
+
+// Normalize each element (zero-length elements become zero)
+LM2_API void lm2_v3_soa_norm_f32(lm2_v3_soa_f32 a, lm2_v3_soa_f32 out);
+
+// Cross product: out[i] = cross(a[i], b[i])
+LM2_API void lm2_v3_soa_cross_f32(lm2_v3_soa_f32 a, lm2_v3_soa_f32 b, lm2_v3_soa_f32 out);
+
+// Reflect each element around its normal: v - 2 * dot(v, n) * n
+LM2_API void lm2_v3_soa_reflect_f32(lm2_v3_soa_f32 v, lm2_v3_soa_f32 normal, lm2_v3_soa_f32 out);
+
+// AoS <-> SoA transposes (count elements)
+LM2_API void lm2_v3_soa_from_aos_f32(const lm2_v3_f32* src, lm2_v3_soa_f32 out);
+LM2_API void lm2_v3_soa_to_aos_f32(lm2_v3_soa_f32 a, lm2_v3_f32* dst);
+
+// =============================================================================
+// lm2_v4_soa_f64
+// =============================================================================
+
+// Create a stream view over component arrays (caller manages memory)
+LM2_API lm2_v4_soa_f64 lm2_v4_soa_make_f64(double* x, double* y, double* z, double* w, size_t count);
+
+// Component-wise arithmetic: out[i] = a[i] op b[i]
+LM2_API void lm2_v4_soa_add_f64(lm2_v4_soa_f64 a, lm2_v4_soa_f64 b, lm2_v4_soa_f64 out);
+LM2_API void lm2_v4_soa_sub_f64(lm2_v4_soa_f64 a, lm2_v4_soa_f64 b, lm2_v4_soa_f64 out);
+LM2_API void lm2_v4_soa_mul_f64(lm2_v4_soa_f64 a, lm2_v4_soa_f64 b, lm2_v4_soa_f64 out);
+LM2_API void lm2_v4_soa_div_f64(lm2_v4_soa_f64 a, lm2_v4_soa_f64 b, lm2_v4_soa_f64 out);
+
+// Scalar arithmetic: out[i] = a[i] op s
+LM2_API void lm2_v4_soa_add_s_f64(lm2_v4_soa_f64 a, double s, lm2_v4_soa_f64 out);
+LM2_API void lm2_v4_soa_sub_s_f64(lm2_v4_soa_f64 a, double s, lm2_v4_soa_f64 out);
+LM2_API void lm2_v4_soa_mul_s_f64(lm2_v4_soa_f64 a, double s, lm2_v4_soa_f64 out);
+LM2_API void lm2_v4_soa_div_s_f64(lm2_v4_soa_f64 a, double s, lm2_v4_soa_f64 out);
+
+// Component-wise min/max, clamp to [min, max] and lerp with a shared t
+LM2_API void lm2_v4_soa_min_f64(lm2_v4_soa_f64 a, lm2_v4_soa_f64 b, lm2_v4_soa_f64 out);
+LM2_API void lm2_v4_soa_max_f64(lm2_v4_soa_f64 a, lm2_v4_soa_f64 b, lm2_v4_soa_f64 out);
+LM2_API void lm2_v4_soa_clamp_f64(lm2_v4_soa_f64 a, lm2_v4_f64 min, lm2_v4_f64 max, lm2_v4_soa_f64 out);
+LM2_API void lm2_v4_soa_lerp_f64(lm2_v4_soa_f64 a, double t, lm2_v4_soa_f64 b, lm2_v4_soa_f64 out);
+
+// Per-element scalar results written to out[0..count)
+LM2_API void lm2_v4_soa_dot_f64(lm2_v4_soa_f64 a, lm2_v4_soa_f64 b, double* out);
+LM2_API void lm2_v4_soa_length_f64(lm2_v4_soa_f64 a, double* out);
+LM2_API void lm2_v4_soa_length_sq_f64(lm2_v4_soa_f64 a, double* out);
+LM2_API void lm2_v4_soa_distance_f64(lm2_v4_soa_f64 a, lm2_v4_soa_f64 b, double* out);
+
+// Normalize each element (zero-length elements become zero)
+LM2_API void lm2_v4_soa_norm_f64(lm2_v4_soa_f64 a, lm2_v4_soa_f64 out);
+
+// AoS <-> SoA transposes (count elements)
+LM2_API void lm2_v4_soa_from_aos_f64(const lm2_v4_f64* src, lm2_v4_soa_f64 out);
+LM2_API void lm2_v4_soa_to_aos_f64(lm2_v4_soa_f64 a, lm2_v4_f64* dst);
+
+// =============================================================================
+// lm2_v4_soa_f32
+// =============================================================================
+
+// Create a stream view over component arrays (caller manages memory)
+LM2_API lm2_v4_soa_f32 lm2_v4_soa_make_f32(float* x, float* y, float* z, float* w, size_t count);
+
+// Component-wise arithmetic: out[i] = a[i] op b[i]
+LM2_API void lm2_v4_soa_add_f32(lm2_v4_soa_f32 a, lm2_v4_soa_f32 b, lm2_v4_soa_f32 out);
+LM2_API void lm2_v4_soa_sub_f32(lm2_v4_soa_f32 a, lm2_v4_soa_f32 b, lm2_v4_soa_f32 out);
+LM2_API void lm2_v4_soa_mul_f32(lm2_v4_soa_f32 a, lm2_v4_soa_f32 b, lm2_v4_soa_f32 out);
+LM2_API void lm2_v4_soa_div_f32(lm2_v4_soa_f32 a, lm2_v4_soa_f32 b, lm2_v4_soa_f32 out);
+
+// Scalar arithmetic: out[i] = a[i] op s
+LM2_API void lm2_v4_soa_add_s_f32(lm2_v4_soa_f32 a, float s, lm2_v4_soa_f32 out);
+LM2_API void lm2_v4_soa_sub_s_f32(lm2_v4_soa_f32 a, float s, lm2_v4_soa_f32 out);
+LM2_API void lm2_v4_soa_mul_s_f32(lm2_v4_soa_f32 a, float s, lm2_v4_soa_f32 out);
+LM2_API void lm2_v4_soa_div_s_f32(lm2_v4_soa_f32 a, float s, lm2_v4_soa_f32 out);
+
+// Component-wise min/max, clamp to [min, max] and lerp with a shared t
+LM2_API void lm2_v4_soa_min_f32(lm2_v4_soa_f32 a, lm2_v4_soa_f32 b, lm2_v4_soa_f32 out);
+LM2_API void lm2_v4_soa_max_f32(lm2_v4_soa_f32 a, lm2_v4_soa_f32 b, lm2_v4_soa_f32 out);
+LM2_API void lm2_v4_soa_clamp_f32(lm2_v4_soa_f32 a, lm2_v4_f32 min, lm2_v4_f32 max, lm2_v4_soa_f32 out);
+LM2_API void lm2_v4_soa_lerp_f32(lm2_v4_soa_f32 a, float t, lm2_v4_soa_f32 b, lm2_v4_soa_f32 out);
+
+// Per-element scalar results written to out[0..count)
+LM2_API void lm2_v4_soa_dot_f32(lm2_v4_soa_f32 a, lm2_v4_soa_f32 b, float* out);
+LM2_API void lm2_v4_soa_length_f32(lm2_v4_soa_f32 a, float* out);
+LM2_API void lm2_v4_soa_length_sq_f32(lm2_v4_soa_f32 a, float* out);
+LM2_API void lm2_v4_soa_distance_f32(lm2_v4_soa_f32 a, lm2_v4_soa_f32 b, float* out);
+
+// Normalize each element (zero-length elements become zero)
+LM2_API void lm2_v4_soa_norm_f32(lm2_v4_soa_f32 a, lm2_v4_soa_f32 out);
+
+// AoS <-> SoA transposes (count elements)
+LM2_API void lm2_v4_soa_from_aos_f32(const lm2_v4_f32* src, lm2_v4_soa_f32 out);
+LM2_API void lm2_v4_soa_to_aos_f32(lm2_v4_soa_f32 a, lm2_v4_f32* dst);
+
+// #############################################################################
+LM2_HEADER_END;
+// #############################################################################
@@ -0,0 +1,285 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <lm2/camera/lm2_camera3_rays.h>
+#include <lm2/misc/lm2_hash.h>
+#include <lm2/scalar/lm2_trigonometry.h>
+#include <lm2/vectors/lm2_vector_specifics.h>
+#include <string.h>
+#include "../vectors/lm2_simd.h"
+
+// Rays generated per kernel call; tiles and packets are processed in batches
+// of this many so the sample positions fit in a stack buffer
+#define _LM2_CAMERA3_RAYGEN_BATCH 64
+
+// base + u * base_dx + v * base_dy for one component of a raygen vector
+#define _LM2_CAMERA3_RAYGEN_LERP(P, S, g, base, c, u, v)                                        \
+  P##_add_##S(P##_set1_##S(g.base.c), P##_add_##S(P##_mul_##S(u, P##_set1_##S(g.base##_dx.c)),  \
+                                                  P##_mul_##S(v, P##_set1_##S(g.base##_dy.c))))
+
+// Ray at sample position (fx[i], fy[i]); g is a local copy of the generator so
+// the broadcasts do not have to be reloaded after every store
+#define _LM2_CAMERA3_RAYGEN_BODY(P, S, i, g)                                                                             \
+  {                                                                                                                      \
+    P##_##S u = P##_load_##S(fx + i), v = P##_load_##S(fy + i);                                                          \
+    P##_##S rx = _LM2_CAMERA3_RAYGEN_LERP(P, S, g, direction, x, u, v);                                                  \
+    P##_##S ry = _LM2_CAMERA3_RAYGEN_LERP(P, S, g, direction, y, u, v);                                                  \
+    P##_##S rz = _LM2_CAMERA3_RAYGEN_LERP(P, S, g, direction, z, u, v);                                                  \
+    P##_##S len = P##_sqrt_##S(P##_add_##S(P##_add_##S(P##_mul_##S(rx, rx), P##_mul_##S(ry, ry)), P##_mul_##S(rz, rz))); \
+    P##_##S inv = P##_rcp_nz_##S(len);                                                                                   \
+    P##_store_##S(dx + i, P##_mul_##S(rx, inv));                                                                         \
+    P##_store_##S(dy + i, P##_mul_##S(ry, inv));                                                                         \
+    P##_store_##S(dz + i, P##_mul_##S(rz, inv));                                                                         \
+    P##_store_##S(t + i, P##_mul_##S(len, P##_set1_##S(g.far_plane)));                                                   \
+    P##_store_##S(ox + i, _LM2_CAMERA3_RAYGEN_LERP(P, S, g, origin, x, u, v));                                           \
+    P##_store_##S(oy + i, _LM2_CAMERA3_RAYGEN_LERP(P, S, g, origin, y, u, v));                                           \
+    P##_store_##S(oz + i, _LM2_CAMERA3_RAYGEN_LERP(P, S, g, origin, z, u, v));                                           \
+  }
+
+// Jittered sample offset of a pixel, 16 bits per axis
+static inline uint32_t _lm2_camera3_raygen_hash(uint32_t px, uint32_t py, uint32_t seed) {
+  return lm2_hash_mix_u32(px * 374761393u + py * 668265263u + seed * 2246822519u);
+}
+
+// Packets of BW x 2 pixels, N = 2 * BW lanes. Lane k samples pixel
+// (k % BW, k / BW) of its block; lanes outside the tile get t_max = 0
+#define _LM2_IMPL_CAMERA3_RAYGEN_PACKETS(N, BW, S)                                                                                                                          \
+  LM2_API size_t lm2_camera3_raygen_packets##N##_##S(const lm2_camera3_raygen_##S* raygen, uint32_t x, uint32_t y, uint32_t w, uint32_t h, lm2_ray3_packet##N##_##S* out) { \
+    LM2_ASSERT(raygen != NULL);                                                                                                                                             \
+    LM2_ASSERT(out != NULL || w == 0 || h == 0);                                                                                                                            \
+    LM2_ASSERT(x + w <= raygen->width && y + h <= raygen->height);                                                                                                          \
+    const size_t cols = (w + BW - 1) / BW;                                                                                                                                  \
+    const size_t count = cols * ((h + 1) / 2);                                                                                                                              \
+    const size_t per_batch = _LM2_CAMERA3_RAYGEN_BATCH / N;                                                                                                                 \
+    _lm2_camera3_raygen_batch_##S b;                                                                                                                                        \
+    for (size_t first = 0; first < count; first += per_batch) {                                                                                                             \
+      const size_t n = count - first < per_batch ? count - first : per_batch;                                                                                               \
+      for (size_t p = 0; p < n; p++) {                                                                                                                                      \
+        const uint32_t bx = (uint32_t)((first + p) % cols) * BW, by = (uint32_t)((first + p) / cols) * 2;                                                                   \
+        for (uint32_t k = 0; k < N; k++) {                                                                                                                                  \
+          _lm2_camera3_raygen_sample_##S(raygen, x + bx + k % BW, y + by + k / BW, b.fx + p * N + k, b.fy + p * N + k);                                                     \
+        }                                                                                                                                                                   \
+      }                                                                                                                                                                     \
+      _lm2_camera3_raygen_run_##S(raygen, b.fx, b.fy, n * N, b.ox, b.oy, b.oz, b.dx, b.dy, b.dz, b.t);                                                                      \
+      for (size_t p = 0; p < n; p++) {                                                                                                                                      \
+        lm2_ray3_packet##N##_##S* packet = out + first + p;                                                                                                                 \
+        memcpy(packet->origin_x, b.ox + p * N, sizeof(packet->origin_x));                                                                                                   \
+        memcpy(packet->origin_y, b.oy + p * N, sizeof(packet->origin_y));                                                                                                   \
+        memcpy(packet->origin_z, b.oz + p * N, sizeof(packet->origin_z));                                                                                                   \
+        memcpy(packet->direction_x, b.dx + p * N, sizeof(packet->direction_x));                                                                                             \
+        memcpy(packet->direction_y, b.dy + p * N, sizeof(packet->direction_y));                                                                                             \
+        memcpy(packet->direction_z, b.dz + p * N, sizeof(packet->direction_z));                                                                                             \
+        memcpy(packet->t_max, b.t + p * N, sizeof(packet->t_max));                                                                                                          \
+        const uint32_t bx = (uint32_t)((first + p) % cols) * BW, by = (uint32_t)((first + p) / cols) * 2;                                                                   \
+        for (uint32_t k = 0; k < N; k++) {                                                                                                                                  \
+          if (bx + k % BW >= w || by + k / BW >= h) {                                                                                                                       \
+            packet->t_max[k] = 0;                                                                                                                                           \
+          }                                                                                                                                                                 \
+        }                                                                                                                                                                   \
+      }                                                                                                                                                                     \
+    }                                                                                                                                                                       \
+    return count;                                                                                                                                                           \
+  }
+
+// =============================================================================
+// Camera 3D Ray Generator Functions - f64
+// =============================================================================
+
+typedef struct _lm2_camera3_raygen_batch_f64 {
+  double fx[_LM2_CAMERA3_RAYGEN_BATCH], fy[_LM2_CAMERA3_RAYGEN_BATCH];
+  double ox[_LM2_CAMERA3_RAYGEN_BATCH], oy[_LM2_CAMERA3_RAYGEN_BATCH], oz[_LM2_CAMERA3_RAYGEN_BATCH];
+  double dx[_LM2_CAMERA3_RAYGEN_BATCH], dy[_LM2_CAMERA3_RAYGEN_BATCH], dz[_LM2_CAMERA3_RAYGEN_BATCH];
+  double t[_LM2_CAMERA3_RAYGEN_BATCH];
+} _lm2_camera3_raygen_batch_f64;
+
+// Sample position of pixel (px, py): its center, or a hashed point inside it
+static inline void _lm2_camera3_raygen_sample_f64(const lm2_camera3_raygen_f64* raygen, uint32_t px, uint32_t py, double* fx, double* fy) {
+  if (!raygen->jitter) {
+    *fx = (double)px + 0.5;
+    *fy = (double)py + 0.5;
+    return;
+  }
+  uint32_t hash = _lm2_camera3_raygen_hash(px, py, raygen->seed);
+  *fx = (double)px + (double)(hash & 0xFFFFu) * (1.0 / 65536.0);
+  *fy = (double)py + (double)(hash >> 16) * (1.0 / 65536.0);
+}
+
+static void _lm2_camera3_raygen_run_f64(const lm2_camera3_raygen_f64* raygen, const double* fx, const double* fy, size_t count, double* ox, double* oy, double* oz, double* dx, double* dy, double* dz, double* t) {
+  const lm2_camera3_raygen_f64 g = *raygen;
+  _LM2_SIMD_LOOP(f64, count, _LM2_CAMERA3_RAYGEN_BODY, g);
+}
+
+LM2_API lm2_camera3_raygen_f64 lm2_camera3_raygen_make_f64(lm2_camera3_f64 camera, uint32_t width, uint32_t height) {
+  LM2_ASSERT(width > 0 && height > 0);
+  lm2_v3_f64 forward = lm2_camera3_get_forward_f64(camera);
+  lm2_v3_f64 right = lm2_camera3_get_right_f64(camera);
+  lm2_v3_f64 up = lm2_camera3_get_up_f64(camera);
+
+  lm2_camera3_raygen_f64 raygen;
+  memset(&raygen, 0, sizeof(raygen));
+  if (camera.projection == LM2_CAMERA3_PERSPECTIVE) {
+    // Directions through the z = -1 view plane, whose edges are at tan(fov / 2)
+    double half_h = lm2_tan_f64(camera.fov_y * 0.5);
+    double half_w = half_h * camera.aspect;
+    raygen.origin = camera.position;
+    raygen.direction = lm2_v3_add_f64(forward, lm2_v3_sub_f64(lm2_v3_mul_s_f64(up, half_h), lm2_v3_mul_s_f64(right, half_w)));
+    raygen.direction_dx = lm2_v3_mul_s_f64(right, 2.0 * half_w / (double)width);
+    raygen.direction_dy = lm2_v3_mul_s_f64(up, -2.0 * half_h / (double)height);
+  } else {
+    // Parallel rays from the eye plane
+    double half_h = camera.ortho_size;
+    double half_w = half_h * camera.aspect;
+    raygen.origin = lm2_v3_add_f64(camera.position, lm2_v3_sub_f64(lm2_v3_mul_s_f64(up, half_h), lm2_v3_mul_s_f64(right, half_w)));
+    raygen.origin_dx = lm2_v3_mul_s_f64(right, 2.0 * half_w / (double)width);
+    raygen.origin_dy = lm2_v3_mul_s_f64(up, -2.0 * half_h / (double)height);
+    raygen.direction = forward;
+  }
+  raygen.far_plane = camera.far_plane;
+  raygen.width = width;
+  raygen.height = height;
+  return raygen;
+}
+
+LM2_API lm2_ray3_f64 lm2_camera3_raygen_ray_f64(const lm2_camera3_raygen_f64* raygen, double px, double py) {
+  LM2_ASSERT(raygen != NULL);
+  lm2_v3_f64 origin = lm2_v3_add_f64(raygen->origin, lm2_v3_add_f64(lm2_v3_mul_s_f64(raygen->origin_dx, px), lm2_v3_mul_s_f64(raygen->origin_dy, py)));
+  lm2_v3_f64 direction = lm2_v3_add_f64(raygen->direction, lm2_v3_add_f64(lm2_v3_mul_s_f64(raygen->direction_dx, px), lm2_v3_mul_s_f64(raygen->direction_dy, py)));
+  double len = lm2_v3_length_f64(direction);
+  lm2_ray3_f64 ray;
+  ray.origin = origin;
+  ray.direction = len > 0.0 ? lm2_v3_mul_s_f64(direction, 1.0 / len) : direction;
+  ray.t_max = raygen->far_plane * len;
+  return ray;
+}
+
+LM2_API void lm2_camera3_raygen_tile_f64(const lm2_camera3_raygen_f64* raygen, uint32_t x, uint32_t y, uint32_t w, uint32_t h, lm2_v3_soa_f64 origins, lm2_v3_soa_f64 directions, double* t_max) {
+  LM2_ASSERT(raygen != NULL);
+  LM2_ASSERT(x + w <= raygen->width && y + h <= raygen->height);
+  LM2_ASSERT(origins.count >= (size_t)w * h && directions.count >= (size_t)w * h);
+  _lm2_camera3_raygen_batch_f64 b;
+  for (uint32_t j = 0; j < h; j++) {
+    for (uint32_t i = 0; i < w; i += _LM2_CAMERA3_RAYGEN_BATCH) {
+      const uint32_t n = w - i < _LM2_CAMERA3_RAYGEN_BATCH ? w - i : _LM2_CAMERA3_RAYGEN_BATCH;
+      const size_t at = (size_t)j * w + i;
+      for (uint32_t k = 0; k < n; k++) {
+        _lm2_camera3_raygen_sample_f64(raygen, x + i + k, y + j, b.fx + k, b.fy + k);
+      }
+      _lm2_camera3_raygen_run_f64(raygen, b.fx, b.fy, n, origins.x + at, origins.y + at, origins.z + at, directions.x + at, directions.y + at, directions.z + at, t_max ? t_max + at : b.t);
+    }
+  }
+}
+
+_LM2_IMPL_CAMERA3_RAYGEN_PACKETS(4, 2, f64)
+_LM2_IMPL_CAMERA3_RAYGEN_PACKETS(8, 4, f64)
+
+// =============================================================================
+// Camera 3D Ray Generator Functions - f32
+// =============================================================================
+
+typedef struct _lm2_camera3_raygen_batch_f32 {
+  float fx[_LM2_CAMERA3_RAYGEN_BATCH], fy[_LM2_CAMERA3_RAYGEN_BATCH];
+  float ox[_LM2_CAMERA3_RAYGEN_BATCH], oy[_LM2_CAMERA3_RAYGEN_BATCH], oz[_LM2_CAMERA3_RAYGEN_BATCH];
+  float dx[_LM2_CAMERA3_RAYGEN_BATCH], dy[_LM2_CAMERA3_RAYGEN_BATCH], dz[_LM2_CAMERA3_RAYGEN_BATCH];
+  float t[_LM2_CAMERA3_RAYGEN_BATCH];
+} _lm2_camera3_raygen_batch_f32;
+
+// Sample position of pixel (px, py): its center, or a hashed point inside it
+static inline void _lm2_camera3_raygen_sample_f32(const lm2_camera3_raygen_f32* raygen, uint32_t px, uint32_t py, float* fx, float* fy) {
+  if (!raygen->jitter) {
+    *fx = (float)px + 0.5f;
+    *fy = (float)py + 0.5f;
+    return;
+  }
+  uint32_t hash = _lm2_camera3_raygen_hash(px, py, raygen->seed);
+  *fx = (float)px + (float)(hash & 0xFFFFu) * (1.0f / 65536.0f);
+  *fy = (float)py + (float)(hash >> 16) * (1.0f / 65536.0f);
+}
+
+static void _lm2_camera3_raygen_run_f32(const lm2_camera3_raygen_f32* raygen, const float* fx, const float* fy, size_t count, float* ox, float* oy, float* oz, float* dx, float* dy, float* dz, float* t) {
+  const lm2_camera3_raygen_f32 g = *raygen;
+  _LM2_SIMD_LOOP(f32, count, _LM2_CAMERA3_RAYGEN_BODY, g);
+}
+
+LM2_API lm2_camera3_raygen_f32 lm2_camera3_raygen_make_f32(lm2_camera3_f32 camera, uint32_t width, uint32_t height) {
+  LM2_ASSERT(width > 0 && height > 0);
+  lm2_v3_f32 forward = lm2_camera3_get_forward_f32(camera);
+  lm2_v3_f32 right = lm2_camera3_get_right_f32(camera);
+  lm2_v3_f32 up = lm2_camera3_get_up_f32(camera);
+
+  lm2_camera3_raygen_f32 raygen;
+  memset(&raygen, 0, sizeof(raygen));
+  if (camera.projection == LM2_CAMERA3_PERSPECTIVE) {
+    // Directions through the z = -1 view plane, whose edges are at tan(fov / 2)
+    float half_h = lm2_tan_f32(camera.fov_y * 0.5f);
+    float half_w = half_h * camera.aspect;
+    raygen.origin = camera.position;
+    raygen.direction = lm2_v3_add_f32(forward, lm2_v3_sub_f32(lm2_v3_mul_s_f32(up, half_h), lm2_v3_mul_s_f32(right, half_w)));
+    raygen.direction_dx = lm2_v3_mul_s_f32(right, 2.0f * half_w / (float)width);
+    raygen.direction_dy = lm2_v3_mul_s_f32(up, -2.0f * half_h / (float)height);
+  } else {
+    // Parallel rays from the eye plane
+    float half_h = camera.ortho_size;
+    float half_w = half_h * camera.aspect;
+    raygen.origin = lm2_v3_add_f32(camera.position, lm2_v3_sub_f32(lm2_v3_mul_s_f32(up, half_h), lm2_v3_mul_s_f32(right, half_w)));
+    raygen.origin_dx = lm2_v3_mul_s_f32(right, 2.0f * half_w / (float)width);
+    raygen.origin_dy = lm2_v3_mul_s_f32(up, -2.0f * half_h / (float)height);
+    raygen.direction = forward;
+  }
+  raygen.far_plane = camera.far_plane;
+  raygen.width = width;
+  raygen.height = height;
+  return raygen;
+}
+
+LM2_API lm2_ray3_f32 lm2_camera3_raygen_ray_f32(const lm2_camera3_raygen_f32* raygen, float px, float py) {
+  LM2_ASSERT(raygen != NULL);
+  lm2_v3_f32 origin = lm2_v3_add_f32(raygen->origin, lm2_v3_add_f32(lm2_v3_mul_s_f32(raygen->origin_dx, px), lm2_v3_mul_s_f32(raygen->origin_dy, py)));
+  lm2_v3_f32 direction = lm2_v3_add_f32(raygen->direction, lm2_v3_add_f32(lm2_v3_mul_s_f32(raygen->direction_dx, px), lm2_v3_mul_s_f32(raygen->direction_dy, py)));
+  float len = lm2_v3_length_f32(direction);
+  lm2_ray3_f32 ray;
+  ray.origin = origin;
+  ray.direction = len > 0.0f ? lm2_v3_mul_s_f32(direction, 1.0f / len) : direction;
+  ray.t_max = raygen->far_plane * len;
+  return ray;
+}
+
+LM2_API void lm2_camera3_raygen_tile_f32(const lm2_camera3_raygen_f32* raygen, uint32_t x, uint32_t y, uint32_t w, uint32_t h, lm2_v3_soa_f32 origins, lm2_v3_soa_f32 directions, float* t_max) {
+  LM2_ASSERT(raygen != NULL);
+  LM2_ASSERT(x + w <= raygen->width && y + h <= raygen->height);
+  LM2_ASSERT(origins.count >= (size_t)w * h && directions.count >= (size_t)w * h);
+  _lm2_camera3_raygen_batch_f32 b;
+  for (uint32_t j = 0; j < h; j++) {
+    for (uint32_t i = 0; i < w; i += _LM2_CAMERA3_RAYGEN_BATCH) {
+      const uint32_t n = w - i < _LM2_CAMERA3_RAYGEN_BATCH ? w - i : _LM2_CAMERA3_RAYGEN_BATCH;
+      const size_t at = (size_t)j * w + i;
+      for (uint32_t k = 0; k < n; k++) {
+        _lm2_camera3_raygen_sample_f32(raygen, x + i + k, y + j, b.fx + k, b.fy + k);
+      }
+      _lm2_camera3_raygen_run_f32(raygen, b.fx, b.fy, n, origins.x + at, origins.y + at, origins.z + at, directions.x + at, directions.y + at, directions.z + at, t_max ? t_max + at : b.t);
+    }
+  }
+}
+
+_LM2_IMPL_CAMERA3_RAYGEN_PACKETS(4, 2, f32)
+_LM2_IMPL_CAMERA3_RAYGEN_PACKETS(8, 4, f32)
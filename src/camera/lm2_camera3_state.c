@@ -0,0 +1,327 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <lm2/camera/lm2_camera3_state.h>
+#include <lm2/geometry3d/lm2_frustum3.h>
+#include <lm2/matrices/lm2_matrix4x4.h>
+#include <string.h>
+
+// Cached values, one bit each in lm2_camera3_state.dirty
+#define _LM2_CAMERA3_STATE_VIEW                (1u << 0)
+#define _LM2_CAMERA3_STATE_PROJECTION          (1u << 1)
+#define _LM2_CAMERA3_STATE_VIEW_PROJECTION     (1u << 2)
+#define _LM2_CAMERA3_STATE_INV_VIEW            (1u << 3)
+#define _LM2_CAMERA3_STATE_INV_VIEW_PROJECTION (1u << 4)
+#define _LM2_CAMERA3_STATE_FRUSTUM             (1u << 5)
+#define _LM2_CAMERA3_STATE_ALL                 0x3Fu
+
+// Everything derived from the view matrix, and from the projection matrix
+#define _LM2_CAMERA3_STATE_VIEW_CHANGED \
+  (_LM2_CAMERA3_STATE_VIEW | _LM2_CAMERA3_STATE_VIEW_PROJECTION | _LM2_CAMERA3_STATE_INV_VIEW | _LM2_CAMERA3_STATE_INV_VIEW_PROJECTION | _LM2_CAMERA3_STATE_FRUSTUM)
+#define _LM2_CAMERA3_STATE_PROJECTION_CHANGED \
+  (_LM2_CAMERA3_STATE_PROJECTION | _LM2_CAMERA3_STATE_VIEW_PROJECTION | _LM2_CAMERA3_STATE_INV_VIEW_PROJECTION | _LM2_CAMERA3_STATE_FRUSTUM)
+
+// =============================================================================
+// Camera 3D State Functions - f64
+// =============================================================================
+
+// Inverse of a look-at matrix: transpose the rotation, rotate back the translation
+static lm2_m4x4_f64 _lm2_camera3_state_rigid_inverse_f64(lm2_m4x4_f64 m) {
+  lm2_m4x4_f64 r = lm2_m4x4_identity_f64();
+  r.m00 = m.m00, r.m01 = m.m10, r.m02 = m.m20;
+  r.m10 = m.m01, r.m11 = m.m11, r.m12 = m.m21;
+  r.m20 = m.m02, r.m21 = m.m12, r.m22 = m.m22;
+  r.m03 = -(m.m00 * m.m03 + m.m10 * m.m13 + m.m20 * m.m23);
+  r.m13 = -(m.m01 * m.m03 + m.m11 * m.m13 + m.m21 * m.m23);
+  r.m23 = -(m.m02 * m.m03 + m.m12 * m.m13 + m.m22 * m.m23);
+  return r;
+}
+
+LM2_API lm2_camera3_state_f64 lm2_camera3_state_make_f64(lm2_camera3_f64 camera) {
+  lm2_camera3_state_f64 state;
+  memset(&state, 0, sizeof(state));
+  state.camera = camera;
+  state.dirty = _LM2_CAMERA3_STATE_ALL;
+  return state;
+}
+
+LM2_API void lm2_camera3_state_set_camera_f64(lm2_camera3_state_f64* state, lm2_camera3_f64 camera) {
+  state->camera = camera;
+  state->dirty = _LM2_CAMERA3_STATE_ALL;
+}
+
+LM2_API void lm2_camera3_state_move_f64(lm2_camera3_state_f64* state, lm2_v3_f64 delta) {
+  state->camera = lm2_camera3_move_f64(state->camera, delta);
+  state->dirty |= _LM2_CAMERA3_STATE_VIEW_CHANGED;
+}
+
+LM2_API void lm2_camera3_state_look_at_f64(lm2_camera3_state_f64* state, lm2_v3_f64 target) {
+  state->camera = lm2_camera3_look_at_f64(state->camera, target);
+  state->dirty |= _LM2_CAMERA3_STATE_VIEW_CHANGED;
+}
+
+LM2_API void lm2_camera3_state_orbit_f64(lm2_camera3_state_f64* state, double yaw, double pitch) {
+  state->camera = lm2_camera3_orbit_f64(state->camera, yaw, pitch);
+  state->dirty |= _LM2_CAMERA3_STATE_VIEW_CHANGED;
+}
+
+LM2_API void lm2_camera3_state_set_aspect_f64(lm2_camera3_state_f64* state, double aspect) {
+  state->camera = lm2_camera3_set_aspect_f64(state->camera, aspect);
+  state->dirty |= _LM2_CAMERA3_STATE_PROJECTION_CHANGED;
+}
+
+LM2_API void lm2_camera3_state_set_fov_y_f64(lm2_camera3_state_f64* state, double fov_y) {
+  state->camera = lm2_camera3_set_fov_y_f64(state->camera, fov_y);
+  state->dirty |= _LM2_CAMERA3_STATE_PROJECTION_CHANGED;
+}
+
+LM2_API void lm2_camera3_state_set_orientation_f64(lm2_camera3_state_f64* state, lm2_quat_f64 orientation) {
+  state->camera = lm2_camera3_set_orientation_f64(state->camera, orientation);
+  state->dirty |= _LM2_CAMERA3_STATE_VIEW_CHANGED;
+}
+
+LM2_API void lm2_camera3_state_rotate_local_f64(lm2_camera3_state_f64* state, lm2_quat_f64 rotation) {
+  state->camera = lm2_camera3_rotate_local_f64(state->camera, rotation);
+  state->dirty |= _LM2_CAMERA3_STATE_VIEW_CHANGED;
+}
+
+LM2_API lm2_m4x4_f64 lm2_camera3_state_get_view_f64(lm2_camera3_state_f64* state) {
+  if (state->dirty & _LM2_CAMERA3_STATE_VIEW) {
+    state->view = lm2_camera3_get_view_f64(state->camera);
+    state->dirty &= ~_LM2_CAMERA3_STATE_VIEW;
+  }
+  return state->view;
+}
+
+LM2_API lm2_m4x4_f64 lm2_camera3_state_get_projection_f64(lm2_camera3_state_f64* state) {
+  if (state->dirty & _LM2_CAMERA3_STATE_PROJECTION) {
+    state->projection = lm2_camera3_get_projection_f64(state->camera);
+    state->dirty &= ~_LM2_CAMERA3_STATE_PROJECTION;
+  }
+  return state->projection;
+}
+
+LM2_API lm2_m4x4_f64 lm2_camera3_state_get_view_projection_f64(lm2_camera3_state_f64* state) {
+  if (state->dirty & _LM2_CAMERA3_STATE_VIEW_PROJECTION) {
+    lm2_m4x4_f64 p = lm2_camera3_state_get_projection_f64(state);
+    lm2_m4x4_f64 v = lm2_camera3_state_get_view_f64(state);
+    state->view_projection = lm2_m4x4_mul_f64(p, v);
+    state->dirty &= ~_LM2_CAMERA3_STATE_VIEW_PROJECTION;
+  }
+  return state->view_projection;
+}
+
+LM2_API lm2_m4x4_f64 lm2_camera3_state_get_inv_view_f64(lm2_camera3_state_f64* state) {
+  if (state->dirty & _LM2_CAMERA3_STATE_INV_VIEW) {
+    state->inv_view = _lm2_camera3_state_rigid_inverse_f64(lm2_camera3_state_get_view_f64(state));
+    state->dirty &= ~_LM2_CAMERA3_STATE_INV_VIEW;
+  }
+  return state->inv_view;
+}
+
+LM2_API lm2_m4x4_f64 lm2_camera3_state_get_inv_view_projection_f64(lm2_camera3_state_f64* state) {
+  if (state->dirty & _LM2_CAMERA3_STATE_INV_VIEW_PROJECTION) {
+    state->inv_view_projection = lm2_m4x4_inverse_f64(lm2_camera3_state_get_view_projection_f64(state));
+    state->dirty &= ~_LM2_CAMERA3_STATE_INV_VIEW_PROJECTION;
+  }
+  return state->inv_view_projection;
+}
+
+LM2_API lm2_frustum3_f64 lm2_camera3_state_get_frustum_f64(lm2_camera3_state_f64* state) {
+  if (state->dirty & _LM2_CAMERA3_STATE_FRUSTUM) {
+    state->frustum = lm2_frustum3_from_matrix_f64(lm2_camera3_state_get_view_projection_f64(state));
+    state->dirty &= ~_LM2_CAMERA3_STATE_FRUSTUM;
+  }
+  return state->frustum;
+}
+
+LM2_API lm2_v3_f64 lm2_camera3_state_world_to_ndc_f64(lm2_camera3_state_f64* state, lm2_v3_f64 world_pos) {
+  lm2_m4x4_f64 vp = lm2_camera3_state_get_view_projection_f64(state);
+  lm2_v4_f64 clip = lm2_m4x4_transform_f64(vp, (lm2_v4_f64) {world_pos.x, world_pos.y, world_pos.z, 1});
+  lm2_v3_f64 ndc;
+  ndc.x = clip.x / clip.w;
+  ndc.y = clip.y / clip.w;
+  ndc.z = clip.z / clip.w;
+  return ndc;
+}
+
+LM2_API lm2_v3_f64 lm2_camera3_state_ndc_to_world_f64(lm2_camera3_state_f64* state, lm2_v3_f64 ndc_pos) {
+  lm2_m4x4_f64 inv_vp = lm2_camera3_state_get_inv_view_projection_f64(state);
+  lm2_v4_f64 clip = lm2_m4x4_transform_f64(inv_vp, (lm2_v4_f64) {ndc_pos.x, ndc_pos.y, ndc_pos.z, 1});
+  lm2_v3_f64 world;
+  world.x = clip.x / clip.w;
+  world.y = clip.y / clip.w;
+  world.z = clip.z / clip.w;
+  return world;
+}
+
+LM2_API void lm2_camera3_state_world_to_ndc_array_f64(lm2_camera3_state_f64* state, const lm2_v3_f64* world_pos, lm2_v3_f64* ndc_pos, uint32_t count) {
+  lm2_m4x4_transform_points_src_dst_f64(lm2_camera3_state_get_view_projection_f64(state), world_pos, ndc_pos, count);
+}
+
+LM2_API void lm2_camera3_state_ndc_to_world_array_f64(lm2_camera3_state_f64* state, const lm2_v3_f64* ndc_pos, lm2_v3_f64* world_pos, uint32_t count) {
+  lm2_m4x4_transform_points_src_dst_f64(lm2_camera3_state_get_inv_view_projection_f64(state), ndc_pos, world_pos, count);
+}
+
+// =============================================================================
+// Camera 3D State Functions - f32
+// =============================================================================
+
+// Inverse of a look-at matrix: transpose the rotation, rotate back the translation
+static lm2_m4x4_f32 _lm2_camera3_state_rigid_inverse_f32(lm2_m4x4_f32 m) {
+  lm2_m4x4_f32 r = lm2_m4x4_identity_f32();
+  r.m00 = m.m00, r.m01 = m.m10, r.m02 = m.m20;
+  r.m10 = m.m01, r.m11 = m.m11, r.m12 = m.m21;
+  r.m20 = m.m02, r.m21 = m.m12, r.m22 = m.m22;
+  r.m03 = -(m.m00 * m.m03 + m.m10 * m.m13 + m.m20 * m.m23);
+  r.m13 = -(m.m01 * m.m03 + m.m11 * m.m13 + m.m21 * m.m23);
+  r.m23 = -(m.m02 * m.m03 + m.m12 * m.m13 + m.m22 * m.m23);
+  return r;
+}
+
+LM2_API lm2_camera3_state_f32 lm2_camera3_state_make_f32(lm2_camera3_f32 camera) {
+  lm2_camera3_state_f32 state;
+  memset(&state, 0, sizeof(state));
+  state.camera = camera;
+  state.dirty = _LM2_CAMERA3_STATE_ALL;
+  return state;
+}
+
+LM2_API void lm2_camera3_state_set_camera_f32(lm2_camera3_state_f32* state, lm2_camera3_f32 camera) {
+  state->camera = camera;
+  state->dirty = _LM2_CAMERA3_STATE_ALL;
+}
+
+LM2_API void lm2_camera3_state_move_f32(lm2_camera3_state_f32* state, lm2_v3_f32 delta) {
+  state->camera = lm2_camera3_move_f32(state->camera, delta);
+  state->dirty |= _LM2_CAMERA3_STATE_VIEW_CHANGED;
+}
+
+LM2_API void lm2_camera3_state_look_at_f32(lm2_camera3_state_f32* state, lm2_v3_f32 target) {
+  state->camera = lm2_camera3_look_at_f32(state->camera, target);
+  state->dirty |= _LM2_CAMERA3_STATE_VIEW_CHANGED;
+}
+
+LM2_API void lm2_camera3_state_orbit_f32(lm2_camera3_state_f32* state, float yaw, float pitch) {
+  state->camera = lm2_camera3_orbit_f32(state->camera, yaw, pitch);
+  state->dirty |= _LM2_CAMERA3_STATE_VIEW_CHANGED;
+}
+
+LM2_API void lm2_camera3_state_set_aspect_f32(lm2_camera3_state_f32* state, float aspect) {
+  state->camera = lm2_camera3_set_aspect_f32(state->camera, aspect);
+  state->dirty |= _LM2_CAMERA3_STATE_PROJECTION_CHANGED;
+}
+
+LM2_API void lm2_camera3_state_set_fov_y_f32(lm2_camera3_state_f32* state, float fov_y) {
+  state->camera = lm2_camera3_set_fov_y_f32(state->camera, fov_y);
+  state->dirty |= _LM2_CAMERA3_STATE_PROJECTION_CHANGED;
+}
+
+LM2_API void lm2_camera3_state_set_orientation_f32(lm2_camera3_state_f32* state, lm2_quat_f32 orientation) {
+  state->camera = lm2_camera3_set_orientation_f32(state->camera, orientation);
+  state->dirty |= _LM2_CAMERA3_STATE_VIEW_CHANGED;
+}
+
+LM2_API void lm2_camera3_state_rotate_local_f32(lm2_camera3_state_f32* state, lm2_quat_f32 rotation) {
+  state->camera = lm2_camera3_rotate_local_f32(state->camera, rotation);
+  state->dirty |= _LM2_CAMERA3_STATE_VIEW_CHANGED;
+}
+
+LM2_API lm2_m4x4_f32 lm2_camera3_state_get_view_f32(lm2_camera3_state_f32* state) {
+  if (state->dirty & _LM2_CAMERA3_STATE_VIEW) {
+    state->view = lm2_camera3_get_view_f32(state->camera);
+    state->dirty &= ~_LM2_CAMERA3_STATE_VIEW;
+  }
+  return state->view;
+}
+
+LM2_API lm2_m4x4_f32 lm2_camera3_state_get_projection_f32(lm2_camera3_state_f32* state) {
+  if (state->dirty & _LM2_CAMERA3_STATE_PROJECTION) {
+    state->projection = lm2_camera3_get_projection_f32(state->camera);
+    state->dirty &= ~_LM2_CAMERA3_STATE_PROJECTION;
+  }
+  return state->projection;
+}
+
+LM2_API lm2_m4x4_f32 lm2_camera3_state_get_view_projection_f32(lm2_camera3_state_f32* state) {
+  if (state->dirty & _LM2_CAMERA3_STATE_VIEW_PROJECTION) {
+    lm2_m4x4_f32 p = lm2_camera3_state_get_projection_f32(state);
+    lm2_m4x4_f32 v = lm2_camera3_state_get_view_f32(state);
+    state->view_projection = lm2_m4x4_mul_f32(p, v);
+    state->dirty &= ~_LM2_CAMERA3_STATE_VIEW_PROJECTION;
+  }
+  return state->view_projection;
+}
+
+LM2_API lm2_m4x4_f32 lm2_camera3_state_get_inv_view_f32(lm2_camera3_state_f32* state) {
+  if (state->dirty & _LM2_CAMERA3_STATE_INV_VIEW) {
+    state->inv_view = _lm2_camera3_state_rigid_inverse_f32(lm2_camera3_state_get_view_f32(state));
+    state->dirty &= ~_LM2_CAMERA3_STATE_INV_VIEW;
+  }
+  return state->inv_view;
+}
+
+LM2_API lm2_m4x4_f32 lm2_camera3_state_get_inv_view_projection_f32(lm2_camera3_state_f32* state) {
+  if (state->dirty & _LM2_CAMERA3_STATE_INV_VIEW_PROJECTION) {
+    state->inv_view_projection = lm2_m4x4_inverse_f32(lm2_camera3_state_get_view_projection_f32(state));
+    state->dirty &= ~_LM2_CAMERA3_STATE_INV_VIEW_PROJECTION;
+  }
+  return state->inv_view_projection;
+}
+
+LM2_API lm2_frustum3_f32 lm2_camera3_state_get_frustum_f32(lm2_camera3_state_f32* state) {
+  if (state->dirty & _LM2_CAMERA3_STATE_FRUSTUM) {
+    state->frustum = lm2_frustum3_from_matrix_f32(lm2_camera3_state_get_view_projection_f32(state));
+    state->dirty &= ~_LM2_CAMERA3_STATE_FRUSTUM;
+  }
+  return state->frustum;
+}
+
+LM2_API lm2_v3_f32 lm2_camera3_state_world_to_ndc_f32(lm2_camera3_state_f32* state, lm2_v3_f32 world_pos) {
+  lm2_m4x4_f32 vp = lm2_camera3_state_get_view_projection_f32(state);
+  lm2_v4_f32 clip = lm2_m4x4_transform_f32(vp, (lm2_v4_f32) {world_pos.x, world_pos.y, world_pos.z, 1});
+  lm2_v3_f32 ndc;
+  ndc.x = clip.x / clip.w;
+  ndc.y = clip.y / clip.w;
+  ndc.z = clip.z / clip.w;
+  return ndc;
+}
+
+LM2_API lm2_v3_f32 lm2_camera3_state_ndc_to_world_f32(lm2_camera3_state_f32* state, lm2_v3_f32 ndc_pos) {
+  lm2_m4x4_f32 inv_vp = lm2_camera3_state_get_inv_view_projection_f32(state);
+  lm2_v4_f32 clip = lm2_m4x4_transform_f32(inv_vp, (lm2_v4_f32) {ndc_pos.x, ndc_pos.y, ndc_pos.z, 1});
+  lm2_v3_f32 world;
+  world.x = clip.x / clip.w;
+  world.y = clip.y / clip.w;
+  world.z = clip.z / clip.w;
+  return world;
+}
+
+LM2_API void lm2_camera3_state_world_to_ndc_array_f32(lm2_camera3_state_f32* state, const lm2_v3_f32* world_pos, lm2_v3_f32* ndc_pos, uint32_t count) {
+  lm2_m4x4_transform_points_src_dst_f32(lm2_camera3_state_get_view_projection_f32(state), world_pos, ndc_pos, count);
+}
+
+LM2_API void lm2_camera3_state_ndc_to_world_array_f32(lm2_camera3_state_f32* state, const lm2_v3_f32* ndc_pos, lm2_v3_f32* world_pos, uint32_t count) {
+  lm2_m4x4_transform_points_src_dst_f32(lm2_camera3_state_get_inv_view_projection_f32(state), ndc_pos, world_pos, count);
+}
@@ -0,0 +1,554 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <lm2/geometry2d/lm2_broadphase2.h>
+#include <lm2/geometry2d/lm2_raycast2.h>
+#include <math.h>
+
+// =============================================================================
+// Dynamic AABB tree
+// =============================================================================
+// Leaves hold the proxies and every interior node has exactly two children, so
+// n proxies use 2n - 1 nodes. Proxy handles are leaf node indices: rotations
+// only relink nodes, they never move a node within the buffer.
+//
+// Every insert and remove refits the path back to the root and rotates each
+// ancestor's children with its grandchildren when that shrinks the total
+// perimeter, the cost that queries pay. Traversals use fixed stacks that are
+// far deeper than these trees grow in practice; overflowing one asserts.
+
+#define _LM2_BROADPHASE2_NULL LM2_BROADPHASE2_NULL_PROXY
+
+// Depth-first stack size, one slot per level plus the pushed siblings
+#define _LM2_BROADPHASE2_STACK_SIZE 256
+
+// Pair traversal stack size: a node pair can push up to three pairs per level
+#define _LM2_BROADPHASE2_PAIR_STACK_SIZE (3 * _LM2_BROADPHASE2_STACK_SIZE)
+
+#define _LM2_IMPL_BROADPHASE2_HELPERS(scalar_type, S)                                                                                  \
+  static inline lm2_r2_##S _lm2_broadphase2_union_##S(lm2_r2_##S a, lm2_r2_##S b) {                                                    \
+    lm2_r2_##S r;                                                                                                                      \
+    r.min.x = a.min.x < b.min.x ? a.min.x : b.min.x;                                                                                   \
+    r.min.y = a.min.y < b.min.y ? a.min.y : b.min.y;                                                                                   \
+    r.max.x = a.max.x > b.max.x ? a.max.x : b.max.x;                                                                                   \
+    r.max.y = a.max.y > b.max.y ? a.max.y : b.max.y;                                                                                   \
+    return r;                                                                                                                          \
+  }                                                                                                                                    \
+  static inline scalar_type _lm2_broadphase2_perimeter_##S(lm2_r2_##S r) {                                                             \
+    return 2 * ((r.max.x - r.min.x) + (r.max.y - r.min.y));                                                                            \
+  }                                                                                                                                    \
+  static inline bool _lm2_broadphase2_overlap_##S(const lm2_r2_##S* a, const lm2_r2_##S* b) {                                          \
+    return a->min.x <= b->max.x && b->min.x <= a->max.x && a->min.y <= b->max.y && b->min.y <= a->max.y;                               \
+  }                                                                                                                                    \
+  static inline bool _lm2_broadphase2_contains_##S(lm2_r2_##S outer, lm2_r2_##S inner) {                                               \
+    return outer.min.x <= inner.min.x && outer.min.y <= inner.min.y && inner.max.x <= outer.max.x && inner.max.y <= outer.max.y;       \
+  }                                                                                                                                    \
+  /* Slab test of the segment [0, t_max] against r, inv_dir holds 1 / direction (huge for zero components) */                          \
+  static inline bool _lm2_broadphase2_ray_overlap_##S(const lm2_r2_##S* r, lm2_v2_##S origin, lm2_v2_##S inv_dir, scalar_type t_max) { \
+    scalar_type x0 = (r->min.x - origin.x) * inv_dir.x;                                                                                \
+    scalar_type x1 = (r->max.x - origin.x) * inv_dir.x;                                                                                \
+    scalar_type y0 = (r->min.y - origin.y) * inv_dir.y;                                                                                \
+    scalar_type y1 = (r->max.y - origin.y) * inv_dir.y;                                                                                \
+    scalar_type t_enter = x0 < x1 ? x0 : x1;                                                                                           \
+    scalar_type t_exit = x0 < x1 ? x1 : x0;                                                                                            \
+    scalar_type ty_enter = y0 < y1 ? y0 : y1;                                                                                          \
+    scalar_type ty_exit = y0 < y1 ? y1 : y0;                                                                                           \
+    t_enter = ty_enter > t_enter ? ty_enter : t_enter;                                                                                 \
+    t_exit = ty_exit < t_exit ? ty_exit : t_exit;                                                                                      \
+    t_enter = t_enter > 0 ? t_enter : 0;                                                                                               \
+    t_exit = t_exit < t_max ? t_exit : t_max;                                                                                          \
+    return t_enter <= t_exit;                                                                                                          \
+  }                                                                                                                                    \
+  static inline lm2_v2_##S _lm2_broadphase2_inv_dir_##S(lm2_v2_##S d, scalar_type huge) {                                              \
+    lm2_v2_##S r;                                                                                                                      \
+    r.x = d.x != 0 ? 1 / d.x : huge;                                                                                                   \
+    r.y = d.y != 0 ? 1 / d.y : huge;                                                                                                   \
+    return r;                                                                                                                          \
+  }
+
+_LM2_IMPL_BROADPHASE2_HELPERS(double, f64)
+_LM2_IMPL_BROADPHASE2_HELPERS(float, f32)
+
+// Node pool: a free list of released nodes below the high-water mark
+#define _LM2_IMPL_BROADPHASE2_POOL(S)                                                 \
+  static uint32_t _lm2_broadphase2_allocate_##S(lm2_broadphase2_##S* bp) {            \
+    uint32_t index;                                                                   \
+    if (bp->free_list != _LM2_BROADPHASE2_NULL) {                                     \
+      index = bp->free_list;                                                          \
+      bp->free_list = bp->nodes[index].parent;                                        \
+    } else {                                                                          \
+      LM2_ASSERT(bp->node_count < bp->node_capacity);                                 \
+      index = bp->node_count++;                                                       \
+    }                                                                                 \
+    lm2_broadphase2_node_##S* node = &bp->nodes[index];                               \
+    node->parent = _LM2_BROADPHASE2_NULL;                                             \
+    node->children[0] = _LM2_BROADPHASE2_NULL;                                        \
+    node->children[1] = _LM2_BROADPHASE2_NULL;                                        \
+    node->height = 0;                                                                 \
+    node->shape.type = LM2_SHAPE2_AABB2;                                              \
+    node->shape.data = NULL;                                                          \
+    return index;                                                                     \
+  }                                                                                   \
+  static void _lm2_broadphase2_release_##S(lm2_broadphase2_##S* bp, uint32_t index) { \
+    bp->nodes[index].parent = bp->free_list;                                          \
+    bp->nodes[index].height = -1;                                                     \
+    bp->free_list = index;                                                            \
+  }
+
+_LM2_IMPL_BROADPHASE2_POOL(f64)
+_LM2_IMPL_BROADPHASE2_POOL(f32)
+
+// Tree maintenance: perimeter-reducing rotations and leaf insertion and removal
+#define _LM2_IMPL_BROADPHASE2_TREE(scalar_type, S)                                                                                          \
+  static inline void _lm2_broadphase2_replace_child_##S(lm2_broadphase2_##S* bp, uint32_t parent, uint32_t old_child, uint32_t new_child) { \
+    if (parent == _LM2_BROADPHASE2_NULL) {                                                                                                  \
+      bp->root = new_child;                                                                                                                 \
+    } else if (bp->nodes[parent].children[0] == old_child) {                                                                                \
+      bp->nodes[parent].children[0] = new_child;                                                                                            \
+    } else {                                                                                                                                \
+      bp->nodes[parent].children[1] = new_child;                                                                                            \
+    }                                                                                                                                       \
+  }                                                                                                                                         \
+                                                                                                                                            \
+  static inline void _lm2_broadphase2_fit_##S(lm2_broadphase2_node_##S* nodes, uint32_t index) {                                            \
+    lm2_broadphase2_node_##S* node = &nodes[index];                                                                                         \
+    const lm2_broadphase2_node_##S* a = &nodes[node->children[0]];                                                                          \
+    const lm2_broadphase2_node_##S* b = &nodes[node->children[1]];                                                                          \
+    node->bounds = _lm2_broadphase2_union_##S(a->bounds, b->bounds);                                                                        \
+    node->height = 1 + (a->height > b->height ? a->height : b->height);                                                                     \
+  }                                                                                                                                         \
+                                                                                                                                            \
+  /* Swap the child a->children[side] with the grandchild at */                                                                             \
+  /* a->children[1 - side]->children[grand_side], then refit the node that */                                                               \
+  /* received it */                                                                                                                         \
+  static void _lm2_broadphase2_swap_##S(lm2_broadphase2_node_##S* nodes, uint32_t a, int side, int grand_side) {                            \
+    const uint32_t child = nodes[a].children[side];                                                                                         \
+    const uint32_t other = nodes[a].children[1 - side];                                                                                     \
+    const uint32_t grand_child = nodes[other].children[grand_side];                                                                         \
+    nodes[a].children[side] = grand_child;                                                                                                  \
+    nodes[grand_child].parent = a;                                                                                                          \
+    nodes[other].children[grand_side] = child;                                                                                              \
+    nodes[child].parent = other;                                                                                                            \
+    _lm2_broadphase2_fit_##S(nodes, other);                                                                                                 \
+    _lm2_broadphase2_fit_##S(nodes, a);                                                                                                     \
+  }                                                                                                                                         \
+                                                                                                                                            \
+  /* Try the four rotations of a's children with its grandchildren and apply */                                                             \
+  /* the one that shrinks the perimeter of the modified child the most. The */                                                              \
+  /* bounds of a itself do not change. */                                                                                                   \
+  static void _lm2_broadphase2_rotate_##S(lm2_broadphase2_node_##S* nodes, uint32_t a) {                                                    \
+    const uint32_t b = nodes[a].children[0];                                                                                                \
+    const uint32_t c = nodes[a].children[1];                                                                                                \
+    scalar_type best_gain = 0;                                                                                                              \
+    int best_side = -1;                                                                                                                     \
+    int best_grand_side = 0;                                                                                                                \
+    for (int side = 0; side < 2; side++) {                                                                                                  \
+      const uint32_t child = side == 0 ? b : c;                                                                                             \
+      const uint32_t other = side == 0 ? c : b;                                                                                             \
+      if (nodes[other].height == 0) {                                                                                                       \
+        continue;                                                                                                                           \
+      }                                                                                                                                     \
+      const scalar_type other_perimeter = _lm2_broadphase2_perimeter_##S(nodes[other].bounds);                                              \
+      for (int grand_side = 0; grand_side < 2; grand_side++) {                                                                              \
+        /* child moves down next to the grandchild it does not replace */                                                                   \
+        const uint32_t stays = nodes[other].children[1 - grand_side];                                                                       \
+        const lm2_r2_##S moved = _lm2_broadphase2_union_##S(nodes[child].bounds, nodes[stays].bounds);                                      \
+        const scalar_type gain = other_perimeter - _lm2_broadphase2_perimeter_##S(moved);                                                   \
+        if (gain > best_gain) {                                                                                                             \
+          best_gain = gain;                                                                                                                 \
+          best_side = side;                                                                                                                 \
+          best_grand_side = grand_side;                                                                                                     \
+        }                                                                                                                                   \
+      }                                                                                                                                     \
+    }                                                                                                                                       \
+    if (best_side >= 0) {                                                                                                                   \
+      _lm2_broadphase2_swap_##S(nodes, a, best_side, best_grand_side);                                                                      \
+    }                                                                                                                                       \
+  }                                                                                                                                         \
+                                                                                                                                            \
+  /* Refit and rotate every ancestor, starting at index */                                                                                  \
+  static void _lm2_broadphase2_refit_up_##S(lm2_broadphase2_##S* bp, uint32_t index) {                                                      \
+    while (index != _LM2_BROADPHASE2_NULL) {                                                                                                \
+      _lm2_broadphase2_fit_##S(bp->nodes, index);                                                                                           \
+      _lm2_broadphase2_rotate_##S(bp->nodes, index);                                                                                        \
+      index = bp->nodes[index].parent;                                                                                                      \
+    }                                                                                                                                       \
+  }                                                                                                                                         \
+                                                                                                                                            \
+  /* Branch and bound search for the sibling that minimizes the total perimeter */                                                          \
+  /* added to the tree: the new parent's perimeter plus the growth of every */                                                              \
+  /* ancestor. Descends towards the child with the lower cost bound and stops */                                                            \
+  /* once no subtree can beat the best sibling found so far. */                                                                             \
+  static uint32_t _lm2_broadphase2_find_sibling_##S(const lm2_broadphase2_##S* bp, lm2_r2_##S leaf_bounds) {                                \
+    const lm2_broadphase2_node_##S* nodes = bp->nodes;                                                                                      \
+    const scalar_type leaf_perimeter = _lm2_broadphase2_perimeter_##S(leaf_bounds);                                                         \
+    uint32_t index = bp->root;                                                                                                              \
+    uint32_t best = index;                                                                                                                  \
+    scalar_type best_cost = _lm2_broadphase2_perimeter_##S(_lm2_broadphase2_union_##S(nodes[index].bounds, leaf_bounds));                   \
+    scalar_type inherited = 0;                                                                                                              \
+    while (nodes[index].height > 0) {                                                                                                       \
+      const scalar_type perimeter = _lm2_broadphase2_perimeter_##S(nodes[index].bounds);                                                    \
+      const scalar_type combined = _lm2_broadphase2_perimeter_##S(_lm2_broadphase2_union_##S(nodes[index].bounds, leaf_bounds));            \
+      inherited += combined - perimeter;                                                                                                    \
+                                                                                                                                            \
+      scalar_type lower_bound[2];                                                                                                           \
+      for (int k = 0; k < 2; k++) {                                                                                                         \
+        const uint32_t child = nodes[index].children[k];                                                                                    \
+        const scalar_type child_perimeter = _lm2_broadphase2_perimeter_##S(nodes[child].bounds);                                            \
+        const scalar_type direct = _lm2_broadphase2_perimeter_##S(_lm2_broadphase2_union_##S(nodes[child].bounds, leaf_bounds));            \
+        const scalar_type cost = direct + inherited;                                                                                        \
+        if (cost < best_cost) {                                                                                                             \
+          best_cost = cost;                                                                                                                 \
+          best = child;                                                                                                                     \
+        }                                                                                                                                   \
+        /* Below an interior child, the child grows and a new parent at least */                                                            \
+        /* as large as the leaf is added */                                                                                                 \
+        lower_bound[k] = nodes[child].height > 0 ? inherited + (direct - child_perimeter) + leaf_perimeter : best_cost;                     \
+      }                                                                                                                                     \
+      const int k = lower_bound[1] < lower_bound[0] ? 1 : 0;                                                                                \
+      if (lower_bound[k] >= best_cost) {                                                                                                    \
+        break;                                                                                                                              \
+      }                                                                                                                                     \
+      index = nodes[index].children[k];                                                                                                     \
+    }                                                                                                                                       \
+    return best;                                                                                                                            \
+  }                                                                                                                                         \
+                                                                                                                                            \
+  static void _lm2_broadphase2_insert_leaf_##S(lm2_broadphase2_##S* bp, uint32_t leaf) {                                                    \
+    lm2_broadphase2_node_##S* nodes = bp->nodes;                                                                                            \
+    if (bp->root == _LM2_BROADPHASE2_NULL) {                                                                                                \
+      bp->root = leaf;                                                                                                                      \
+      nodes[leaf].parent = _LM2_BROADPHASE2_NULL;                                                                                           \
+      return;                                                                                                                               \
+    }                                                                                                                                       \
+                                                                                                                                            \
+    const uint32_t sibling = _lm2_broadphase2_find_sibling_##S(bp, nodes[leaf].bounds);                                                     \
+    const uint32_t old_parent = nodes[sibling].parent;                                                                                      \
+    const uint32_t new_parent = _lm2_broadphase2_allocate_##S(bp);                                                                          \
+    nodes[new_parent].parent = old_parent;                                                                                                  \
+    nodes[new_parent].children[0] = sibling;                                                                                                \
+    nodes[new_parent].children[1] = leaf;                                                                                                   \
+    _lm2_broadphase2_replace_child_##S(bp, old_parent, sibling, new_parent);                                                                \
+    nodes[sibling].parent = new_parent;                                                                                                     \
+    nodes[leaf].parent = new_parent;                                                                                                        \
+    _lm2_broadphase2_refit_up_##S(bp, new_parent);                                                                                          \
+  }                                                                                                                                         \
+                                                                                                                                            \
+  static void _lm2_broadphase2_remove_leaf_##S(lm2_broadphase2_##S* bp, uint32_t leaf) {                                                    \
+    lm2_broadphase2_node_##S* nodes = bp->nodes;                                                                                            \
+    if (leaf == bp->root) {                                                                                                                 \
+      bp->root = _LM2_BROADPHASE2_NULL;                                                                                                     \
+      return;                                                                                                                               \
+    }                                                                                                                                       \
+    const uint32_t parent = nodes[leaf].parent;                                                                                             \
+    const uint32_t grand_parent = nodes[parent].parent;                                                                                     \
+    const uint32_t sibling = nodes[parent].children[nodes[parent].children[0] == leaf ? 1 : 0];                                             \
+    _lm2_broadphase2_replace_child_##S(bp, grand_parent, parent, sibling);                                                                  \
+    nodes[sibling].parent = grand_parent;                                                                                                   \
+    _lm2_broadphase2_release_##S(bp, parent);                                                                                               \
+    _lm2_broadphase2_refit_up_##S(bp, grand_parent);                                                                                        \
+  }
+
+_LM2_IMPL_BROADPHASE2_TREE(double, f64)
+_LM2_IMPL_BROADPHASE2_TREE(float, f32)
+
+// Queries. find_pairs walks the tree against itself: a node pair (n, n) yields
+// the pairs inside each child and across the two children; a pair of distinct
+// nodes with overlapping bounds descends into the taller one.
+#define _LM2_IMPL_BROADPHASE2_QUERY(scalar_type, S, huge)                                                                                        \
+  static inline void _lm2_broadphase2_emit_##S(lm2_broadphase2_pair* out, size_t max, size_t* count, uint32_t a, uint32_t b) {                   \
+    if (*count < max) {                                                                                                                          \
+      out[*count].a = a < b ? a : b;                                                                                                             \
+      out[*count].b = a < b ? b : a;                                                                                                             \
+    }                                                                                                                                            \
+    (*count)++;                                                                                                                                  \
+  }                                                                                                                                              \
+                                                                                                                                                 \
+  static size_t _lm2_broadphase2_find_pairs_##S(const lm2_broadphase2_##S* bp, lm2_broadphase2_pair* out, size_t max) {                          \
+    const lm2_broadphase2_node_##S* nodes = bp->nodes;                                                                                           \
+    size_t count = 0;                                                                                                                            \
+    if (bp->root == _LM2_BROADPHASE2_NULL) {                                                                                                     \
+      return 0;                                                                                                                                  \
+    }                                                                                                                                            \
+    uint32_t stack[_LM2_BROADPHASE2_PAIR_STACK_SIZE][2];                                                                                         \
+    size_t top = 0;                                                                                                                              \
+    stack[top][0] = bp->root;                                                                                                                    \
+    stack[top][1] = bp->root;                                                                                                                    \
+    top++;                                                                                                                                       \
+    while (top > 0) {                                                                                                                            \
+      top--;                                                                                                                                     \
+      uint32_t a = stack[top][0];                                                                                                                \
+      uint32_t b = stack[top][1];                                                                                                                \
+      if (a == b) {                                                                                                                              \
+        if (nodes[a].height == 0) {                                                                                                              \
+          continue;                                                                                                                              \
+        }                                                                                                                                        \
+        LM2_ASSERT(top + 3 <= _LM2_BROADPHASE2_PAIR_STACK_SIZE);                                                                                 \
+        const uint32_t c0 = nodes[a].children[0];                                                                                                \
+        const uint32_t c1 = nodes[a].children[1];                                                                                                \
+        stack[top][0] = c0;                                                                                                                      \
+        stack[top][1] = c1;                                                                                                                      \
+        top++;                                                                                                                                   \
+        stack[top][0] = c1;                                                                                                                      \
+        stack[top][1] = c1;                                                                                                                      \
+        top++;                                                                                                                                   \
+        stack[top][0] = c0;                                                                                                                      \
+        stack[top][1] = c0;                                                                                                                      \
+        top++;                                                                                                                                   \
+        continue;                                                                                                                                \
+      }                                                                                                                                          \
+      if (!_lm2_broadphase2_overlap_##S(&nodes[a].bounds, &nodes[b].bounds)) {                                                                   \
+        continue;                                                                                                                                \
+      }                                                                                                                                          \
+      if (nodes[a].height == 0 && nodes[b].height == 0) {                                                                                        \
+        _lm2_broadphase2_emit_##S(out, max, &count, a, b);                                                                                       \
+        continue;                                                                                                                                \
+      }                                                                                                                                          \
+      /* Split the taller node, keep the other */                                                                                                \
+      if (nodes[b].height > nodes[a].height) {                                                                                                   \
+        uint32_t t = a;                                                                                                                          \
+        a = b;                                                                                                                                   \
+        b = t;                                                                                                                                   \
+      }                                                                                                                                          \
+      LM2_ASSERT(top + 2 <= _LM2_BROADPHASE2_PAIR_STACK_SIZE);                                                                                   \
+      stack[top][0] = nodes[a].children[1];                                                                                                      \
+      stack[top][1] = b;                                                                                                                         \
+      top++;                                                                                                                                     \
+      stack[top][0] = nodes[a].children[0];                                                                                                      \
+      stack[top][1] = b;                                                                                                                         \
+      top++;                                                                                                                                     \
+    }                                                                                                                                            \
+    return count;                                                                                                                                \
+  }                                                                                                                                              \
+                                                                                                                                                 \
+  static size_t _lm2_broadphase2_query_aabb_##S(const lm2_broadphase2_##S* bp, const lm2_r2_##S* aabb, lm2_broadphase2_proxy* out, size_t max) { \
+    const lm2_broadphase2_node_##S* nodes = bp->nodes;                                                                                           \
+    size_t count = 0;                                                                                                                            \
+    if (bp->root == _LM2_BROADPHASE2_NULL) {                                                                                                     \
+      return 0;                                                                                                                                  \
+    }                                                                                                                                            \
+    uint32_t stack[_LM2_BROADPHASE2_STACK_SIZE];                                                                                                 \
+    size_t top = 0;                                                                                                                              \
+    stack[top++] = bp->root;                                                                                                                     \
+    while (top > 0) {                                                                                                                            \
+      const uint32_t index = stack[--top];                                                                                                       \
+      if (!_lm2_broadphase2_overlap_##S(&nodes[index].bounds, aabb)) {                                                                           \
+        continue;                                                                                                                                \
+      }                                                                                                                                          \
+      if (nodes[index].height == 0) {                                                                                                            \
+        if (count < max) {                                                                                                                       \
+          out[count] = index;                                                                                                                    \
+        }                                                                                                                                        \
+        count++;                                                                                                                                 \
+        continue;                                                                                                                                \
+      }                                                                                                                                          \
+      LM2_ASSERT(top + 2 <= _LM2_BROADPHASE2_STACK_SIZE);                                                                                        \
+      stack[top++] = nodes[index].children[1];                                                                                                   \
+      stack[top++] = nodes[index].children[0];                                                                                                   \
+    }                                                                                                                                            \
+    return count;                                                                                                                                \
+  }                                                                                                                                              \
+                                                                                                                                                 \
+  /* With shapes, leaves are raycast and t_max shrinks to the closest hit */                                                                     \
+  static size_t _lm2_broadphase2_query_ray_##S(                                                                                                  \
+      const lm2_broadphase2_##S* bp,                                                                                                             \
+      lm2_ray2_##S ray,                                                                                                                          \
+      lm2_broadphase2_proxy* out,                                                                                                                \
+      size_t max,                                                                                                                                \
+      lm2_broadphase2_hit_##S* closest) {                                                                                                        \
+    const lm2_broadphase2_node_##S* nodes = bp->nodes;                                                                                           \
+    size_t count = 0;                                                                                                                            \
+    if (bp->root == _LM2_BROADPHASE2_NULL) {                                                                                                     \
+      return 0;                                                                                                                                  \
+    }                                                                                                                                            \
+    const lm2_v2_##S inv_dir = _lm2_broadphase2_inv_dir_##S(ray.direction, huge);                                                                \
+    uint32_t stack[_LM2_BROADPHASE2_STACK_SIZE];                                                                                                 \
+    size_t top = 0;                                                                                                                              \
+    stack[top++] = bp->root;                                                                                                                     \
+    while (top > 0) {                                                                                                                            \
+      const uint32_t index = stack[--top];                                                                                                       \
+      if (!_lm2_broadphase2_ray_overlap_##S(&nodes[index].bounds, ray.origin, inv_dir, ray.t_max)) {                                             \
+        continue;                                                                                                                                \
+      }                                                                                                                                          \
+      if (nodes[index].height == 0) {                                                                                                            \
+        if (closest == NULL) {                                                                                                                   \
+          if (count < max) {                                                                                                                     \
+            out[count] = index;                                                                                                                  \
+          }                                                                                                                                      \
+          count++;                                                                                                                               \
+          continue;                                                                                                                              \
+        }                                                                                                                                        \
+        lm2_rayhit2_##S hit = lm2_raycast_shape2_##S(ray, nodes[index].shape);                                                                   \
+        if (hit.hit && hit.t <= ray.t_max && (!closest->rayhit.hit || hit.t < closest->rayhit.t)) {                                              \
+          closest->rayhit = hit;                                                                                                                 \
+          closest->proxy = index;                                                                                                                \
+          ray.t_max = hit.t;                                                                                                                     \
+        }                                                                                                                                        \
+        continue;                                                                                                                                \
+      }                                                                                                                                          \
+      LM2_ASSERT(top + 2 <= _LM2_BROADPHASE2_STACK_SIZE);                                                                                        \
+      stack[top++] = nodes[index].children[1];                                                                                                   \
+      stack[top++] = nodes[index].children[0];                                                                                                   \
+    }                                                                                                                                            \
+    return count;                                                                                                                                \
+  }
+
+_LM2_IMPL_BROADPHASE2_QUERY(double, f64, 1e300)
+_LM2_IMPL_BROADPHASE2_QUERY(float, f32, 1e30f)
+
+#define _LM2_IMPL_BROADPHASE2_API(scalar_type, S)                                                                                           \
+  LM2_API size_t lm2_broadphase2_node_buffer_size_##S(size_t max_proxies) {                                                                 \
+    return max_proxies > 0 ? 2 * max_proxies - 1 : 0;                                                                                       \
+  }                                                                                                                                         \
+                                                                                                                                            \
+  LM2_API lm2_broadphase2_##S lm2_broadphase2_make_##S(lm2_broadphase2_node_##S* nodes, size_t node_buffer_size, scalar_type margin) {      \
+    LM2_ASSERT(node_buffer_size == 0 || nodes != NULL);                                                                                     \
+    LM2_ASSERT(margin >= 0);                                                                                                                \
+    lm2_broadphase2_##S bp;                                                                                                                 \
+    bp.nodes = nodes;                                                                                                                       \
+    bp.node_capacity = node_buffer_size < UINT32_MAX ? (uint32_t)node_buffer_size : UINT32_MAX - 1;                                         \
+    bp.node_count = 0;                                                                                                                      \
+    bp.root = _LM2_BROADPHASE2_NULL;                                                                                                        \
+    bp.free_list = _LM2_BROADPHASE2_NULL;                                                                                                   \
+    bp.proxy_count = 0;                                                                                                                     \
+    bp.margin = margin;                                                                                                                     \
+    return bp;                                                                                                                              \
+  }                                                                                                                                         \
+                                                                                                                                            \
+  LM2_API lm2_broadphase2_proxy lm2_broadphase2_insert_##S(lm2_broadphase2_##S* bp, lm2_r2_##S bounds, lm2_shape2_##S shape) {              \
+    LM2_ASSERT(bp != NULL);                                                                                                                 \
+    LM2_ASSERT(bounds.min.x <= bounds.max.x && bounds.min.y <= bounds.max.y);                                                               \
+    const uint32_t leaf = _lm2_broadphase2_allocate_##S(bp);                                                                                \
+    lm2_broadphase2_node_##S* node = &bp->nodes[leaf];                                                                                      \
+    node->bounds.min.x = bounds.min.x - bp->margin;                                                                                         \
+    node->bounds.min.y = bounds.min.y - bp->margin;                                                                                         \
+    node->bounds.max.x = bounds.max.x + bp->margin;                                                                                         \
+    node->bounds.max.y = bounds.max.y + bp->margin;                                                                                         \
+    node->shape = shape;                                                                                                                    \
+    _lm2_broadphase2_insert_leaf_##S(bp, leaf);                                                                                             \
+    bp->proxy_count++;                                                                                                                      \
+    return leaf;                                                                                                                            \
+  }                                                                                                                                         \
+                                                                                                                                            \
+  LM2_API lm2_broadphase2_proxy lm2_broadphase2_insert_shape_##S(lm2_broadphase2_##S* bp, lm2_shape2_##S shape) {                           \
+    return lm2_broadphase2_insert_##S(bp, lm2_shape2_bounds_##S(shape), shape);                                                             \
+  }                                                                                                                                         \
+                                                                                                                                            \
+  LM2_API void lm2_broadphase2_remove_##S(lm2_broadphase2_##S* bp, lm2_broadphase2_proxy proxy) {                                           \
+    LM2_ASSERT(bp != NULL);                                                                                                                 \
+    LM2_ASSERT(proxy < bp->node_count && bp->nodes[proxy].height == 0);                                                                     \
+    _lm2_broadphase2_remove_leaf_##S(bp, proxy);                                                                                            \
+    _lm2_broadphase2_release_##S(bp, proxy);                                                                                                \
+    bp->proxy_count--;                                                                                                                      \
+  }                                                                                                                                         \
+                                                                                                                                            \
+  LM2_API bool lm2_broadphase2_move_##S(lm2_broadphase2_##S* bp, lm2_broadphase2_proxy proxy, lm2_r2_##S bounds, lm2_v2_##S displacement) { \
+    LM2_ASSERT(bp != NULL);                                                                                                                 \
+    LM2_ASSERT(proxy < bp->node_count && bp->nodes[proxy].height == 0);                                                                     \
+    LM2_ASSERT(bounds.min.x <= bounds.max.x && bounds.min.y <= bounds.max.y);                                                               \
+    lm2_broadphase2_node_##S* node = &bp->nodes[proxy];                                                                                     \
+    if (_lm2_broadphase2_contains_##S(node->bounds, bounds)) {                                                                              \
+      return false;                                                                                                                         \
+    }                                                                                                                                       \
+                                                                                                                                            \
+    _lm2_broadphase2_remove_leaf_##S(bp, proxy);                                                                                            \
+    lm2_r2_##S fat;                                                                                                                         \
+    fat.min.x = bounds.min.x - bp->margin;                                                                                                  \
+    fat.min.y = bounds.min.y - bp->margin;                                                                                                  \
+    fat.max.x = bounds.max.x + bp->margin;                                                                                                  \
+    fat.max.y = bounds.max.y + bp->margin;                                                                                                  \
+    const scalar_type dx = LM2_BROADPHASE2_DISPLACEMENT_MULTIPLIER * displacement.x;                                                        \
+    const scalar_type dy = LM2_BROADPHASE2_DISPLACEMENT_MULTIPLIER * displacement.y;                                                        \
+    if (dx < 0) {                                                                                                                           \
+      fat.min.x += dx;                                                                                                                      \
+    } else {                                                                                                                                \
+      fat.max.x += dx;                                                                                                                      \
+    }                                                                                                                                       \
+    if (dy < 0) {                                                                                                                           \
+      fat.min.y += dy;                                                                                                                      \
+    } else {                                                                                                                                \
+      fat.max.y += dy;                                                                                                                      \
+    }                                                                                                                                       \
+    node->bounds = fat;                                                                                                                     \
+    _lm2_broadphase2_insert_leaf_##S(bp, proxy);                                                                                            \
+    return true;                                                                                                                            \
+  }                                                                                                                                         \
+                                                                                                                                            \
+  LM2_API lm2_r2_##S lm2_broadphase2_get_fat_bounds_##S(const lm2_broadphase2_##S* bp, lm2_broadphase2_proxy proxy) {                       \
+    LM2_ASSERT(bp != NULL);                                                                                                                 \
+    LM2_ASSERT(proxy < bp->node_count && bp->nodes[proxy].height == 0);                                                                     \
+    return bp->nodes[proxy].bounds;                                                                                                         \
+  }                                                                                                                                         \
+                                                                                                                                            \
+  LM2_API lm2_shape2_##S lm2_broadphase2_get_shape_##S(const lm2_broadphase2_##S* bp, lm2_broadphase2_proxy proxy) {                        \
+    LM2_ASSERT(bp != NULL);                                                                                                                 \
+    LM2_ASSERT(proxy < bp->node_count && bp->nodes[proxy].height == 0);                                                                     \
+    return bp->nodes[proxy].shape;                                                                                                          \
+  }                                                                                                                                         \
+                                                                                                                                            \
+  LM2_API uint32_t lm2_broadphase2_height_##S(const lm2_broadphase2_##S* bp) {                                                              \
+    LM2_ASSERT(bp != NULL);                                                                                                                 \
+    return bp->root != _LM2_BROADPHASE2_NULL ? (uint32_t)bp->nodes[bp->root].height : 0;                                                    \
+  }                                                                                                                                         \
+                                                                                                                                            \
+  LM2_API size_t lm2_broadphase2_find_pairs_##S(const lm2_broadphase2_##S* bp, lm2_broadphase2_pair* out_pairs, size_t max_pairs) {         \
+    LM2_ASSERT(bp != NULL);                                                                                                                 \
+    LM2_ASSERT(max_pairs == 0 || out_pairs != NULL);                                                                                        \
+    return _lm2_broadphase2_find_pairs_##S(bp, out_pairs, max_pairs);                                                                       \
+  }                                                                                                                                         \
+                                                                                                                                            \
+  LM2_API size_t lm2_broadphase2_query_aabb_##S(                                                                                            \
+      const lm2_broadphase2_##S* bp,                                                                                                        \
+      lm2_r2_##S aabb,                                                                                                                      \
+      lm2_broadphase2_proxy* out_proxies,                                                                                                   \
+      size_t max_proxies) {                                                                                                                 \
+    LM2_ASSERT(bp != NULL);                                                                                                                 \
+    LM2_ASSERT(max_proxies == 0 || out_proxies != NULL);                                                                                    \
+    return _lm2_broadphase2_query_aabb_##S(bp, &aabb, out_proxies, max_proxies);                                                            \
+  }                                                                                                                                         \
+                                                                                                                                            \
+  LM2_API size_t lm2_broadphase2_query_ray_##S(                                                                                             \
+      const lm2_broadphase2_##S* bp,                                                                                                        \
+      lm2_ray2_##S ray,                                                                                                                     \
+      lm2_broadphase2_proxy* out_proxies,                                                                                                   \
+      size_t max_proxies) {                                                                                                                 \
+    LM2_ASSERT(bp != NULL);                                                                                                                 \
+    LM2_ASSERT(max_proxies == 0 || out_proxies != NULL);                                                                                    \
+    return _lm2_broadphase2_query_ray_##S(bp, ray, out_proxies, max_proxies, NULL);                                                         \
+  }                                                                                                                                         \
+                                                                                                                                            \
+  LM2_API lm2_broadphase2_hit_##S lm2_broadphase2_raycast_##S(const lm2_broadphase2_##S* bp, lm2_ray2_##S ray) {                            \
+    LM2_ASSERT(bp != NULL);                                                                                                                 \
+    lm2_broadphase2_hit_##S result;                                                                                                         \
+    result.rayhit.hit = false;                                                                                                              \
+    result.rayhit.t = 0;                                                                                                                    \
+    result.rayhit.point = lm2_v2_make_##S(0, 0);                                                                                            \
+    result.rayhit.normal = lm2_v2_make_##S(0, 0);                                                                                           \
+    result.proxy = LM2_BROADPHASE2_NULL_PROXY;                                                                                              \
+    _lm2_broadphase2_query_ray_##S(bp, ray, NULL, 0, &result);                                                                              \
+    return result;                                                                                                                          \
+  }
+
+_LM2_IMPL_BROADPHASE2_API(double, f64)
+_LM2_IMPL_BROADPHASE2_API(float, f32)
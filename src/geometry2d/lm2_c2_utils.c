@@ -24,6 +24,7 @@ SOFTWARE.
 
 #define CUTE_C2_IMPLEMENTATION
 #include "lm2_c2_utils.h"
+#include "../misc/lm2_scratch.h"
 
 // =============================================================================
 // Vector Conversions
@@ -121,36 +122,76 @@ c2Capsule lm2_capsule2_f64_to_c2(lm2_capsule2_f64 capsule) {
   return result;
 }
 
-c2Poly lm2_polygon_f32_to_c2(lm2_polygon_f32 polygon) {
+c2Poly lm2_convex_polygon_f32_to_c2(lm2_convex_polygon_f32 convex) {
   c2Poly result;
-  LM2_ASSERT(polygon.vertices != NULL);
-  LM2_ASSERT(polygon.vertex_count <= C2_MAX_POLYGON_VERTS);
+  LM2_ASSERT(convex.vertices != NULL && convex.normals != NULL);
+  LM2_ASSERT(convex.vertex_count <= C2_MAX_POLYGON_VERTS);
 
-  result.count = (int)polygon.vertex_count;
-  for (size_t i = 0; i < polygon.vertex_count && i < C2_MAX_POLYGON_VERTS; ++i) {
-    result.verts[i] = lm22_f32_to_c2v(polygon.vertices[i]);
+  result.count = (int)convex.vertex_count;
+  for (size_t i = 0; i < convex.vertex_count && i < C2_MAX_POLYGON_VERTS; ++i) {
+    result.verts[i] = lm22_f32_to_c2v(convex.vertices[i]);
+    result.norms[i] = lm22_f32_to_c2v(convex.normals[i]);
   }
 
-  // Compute normals
-  c2Norms(result.verts, result.norms, result.count);
-
   return result;
 }
 
-c2Poly lm2_polygon_f64_to_c2(lm2_polygon_f64 polygon) {
+c2Poly lm2_convex_polygon_f64_to_c2(lm2_convex_polygon_f64 convex) {
   c2Poly result;
+  LM2_ASSERT(convex.vertices != NULL && convex.normals != NULL);
+  LM2_ASSERT(convex.vertex_count <= C2_MAX_POLYGON_VERTS);
+
+  result.count = (int)convex.vertex_count;
+  for (size_t i = 0; i < convex.vertex_count && i < C2_MAX_POLYGON_VERTS; ++i) {
+    result.verts[i] = lm22_f64_to_c2v(convex.vertices[i]);
+    result.norms[i] = lm22_f64_to_c2v(convex.normals[i]);
+  }
+
+  return result;
+}
+
+lm2_convex_polygon_f32 lm2_polygon_f32_to_convex(lm2_polygon_f32 polygon, lm2_polygon_normals_f32* normals) {
   LM2_ASSERT(polygon.vertices != NULL);
-  LM2_ASSERT(polygon.vertex_count <= C2_MAX_POLYGON_VERTS);
+  LM2_ASSERT(normals != NULL);
+  normals->normals = normals->inline_normals;
+  normals->arena = NULL;
+  normals->mark = 0;
+  if (polygon.vertex_count > C2_MAX_POLYGON_VERTS) {
+    normals->arena = lm2_arena_thread_default();
+    normals->mark = lm2_scratch_begin(normals->arena);
+    normals->normals = (lm2_v2_f32*)lm2_scratch_alloc(normals->arena, polygon.vertex_count * sizeof(lm2_v2_f32));
+    LM2_ASSERT(normals->normals != NULL);
+  }
+  return lm2_convex_polygon_make_f32(polygon, normals->normals);
+}
 
-  result.count = (int)polygon.vertex_count;
-  for (size_t i = 0; i < polygon.vertex_count && i < C2_MAX_POLYGON_VERTS; ++i) {
-    result.verts[i] = lm22_f64_to_c2v(polygon.vertices[i]);
+void lm2_polygon_normals_f32_release(lm2_polygon_normals_f32* normals) {
+  if (normals->normals != normals->inline_normals) {
+    lm2_scratch_free(normals->arena, normals->normals);
+    lm2_scratch_end(normals->arena, normals->mark);
   }
+}
 
-  // Compute normals
-  c2Norms(result.verts, result.norms, result.count);
+lm2_convex_polygon_f64 lm2_polygon_f64_to_convex(lm2_polygon_f64 polygon, lm2_polygon_normals_f64* normals) {
+  LM2_ASSERT(polygon.vertices != NULL);
+  LM2_ASSERT(normals != NULL);
+  normals->normals = normals->inline_normals;
+  normals->arena = NULL;
+  normals->mark = 0;
+  if (polygon.vertex_count > C2_MAX_POLYGON_VERTS) {
+    normals->arena = lm2_arena_thread_default();
+    normals->mark = lm2_scratch_begin(normals->arena);
+    normals->normals = (lm2_v2_f64*)lm2_scratch_alloc(normals->arena, polygon.vertex_count * sizeof(lm2_v2_f64));
+    LM2_ASSERT(normals->normals != NULL);
+  }
+  return lm2_convex_polygon_make_f64(polygon, normals->normals);
+}
 
-  return result;
+void lm2_polygon_normals_f64_release(lm2_polygon_normals_f64* normals) {
+  if (normals->normals != normals->inline_normals) {
+    lm2_scratch_free(normals->arena, normals->normals);
+    lm2_scratch_end(normals->arena, normals->mark);
+  }
 }
 
 c2Poly lm2_triangle2_f32_to_c2(const lm2_triangle2_f32 tri) {
@@ -34,6 +34,7 @@ SOFTWARE.
 #include "lm2/geometry2d/lm2_raycast2.h"
 #include "lm2/geometry2d/lm2_triangle2.h"
 #include "lm2/lm2_base.h"
+#include "lm2/misc/lm2_allocator.h"
 #include "lm2/ranges/lm2_range2.h"
 #include "lm2/vectors/lm2_vector2.h"
 
@@ -64,8 +65,33 @@ c2AABB lm2_r2_f64_to_c2(lm2_r2_f64 aabb);
 c2Capsule lm2_capsule2_f32_to_c2(lm2_capsule2_f32 capsule);
 c2Capsule lm2_capsule2_f64_to_c2(lm2_capsule2_f64 capsule);
 
-c2Poly lm2_polygon_f32_to_c2(lm2_polygon_f32 polygon);
-c2Poly lm2_polygon_f64_to_c2(lm2_polygon_f64 polygon);
+// Copies the cached vertices and normals (no normal recomputation)
+c2Poly lm2_convex_polygon_f32_to_c2(lm2_convex_polygon_f32 convex);
+c2Poly lm2_convex_polygon_f64_to_c2(lm2_convex_polygon_f64 convex);
+
+// Normal storage for preparing a plain polygon: inline up to the cute_c2 limit,
+// bigger polygons take theirs from the thread default arena (or the heap)
+typedef struct lm2_polygon_normals_f32 {
+  lm2_v2_f32 inline_normals[C2_MAX_POLYGON_VERTS];
+  lm2_v2_f32* normals;
+  lm2_arena* arena;
+  size_t mark;
+} lm2_polygon_normals_f32;
+
+typedef struct lm2_polygon_normals_f64 {
+  lm2_v2_f64 inline_normals[C2_MAX_POLYGON_VERTS];
+  lm2_v2_f64* normals;
+  lm2_arena* arena;
+  size_t mark;
+} lm2_polygon_normals_f64;
+
+// Prepares a plain polygon of any vertex count for the convex entry points
+// Release normals once the convex polygon is no longer used, in reverse order of preparation
+lm2_convex_polygon_f32 lm2_polygon_f32_to_convex(lm2_polygon_f32 polygon, lm2_polygon_normals_f32* normals);
+lm2_convex_polygon_f64 lm2_polygon_f64_to_convex(lm2_polygon_f64 polygon, lm2_polygon_normals_f64* normals);
+
+void lm2_polygon_normals_f32_release(lm2_polygon_normals_f32* normals);
+void lm2_polygon_normals_f64_release(lm2_polygon_normals_f64* normals);
 
 c2Poly lm2_triangle2_f32_to_c2(const lm2_triangle2_f32 tri);
 c2Poly lm2_triangle2_f64_to_c2(const lm2_triangle2_f64 tri);
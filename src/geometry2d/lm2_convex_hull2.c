@@ -0,0 +1,343 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <lm2/geometry2d/lm2_convex_hull2.h>
+#include <math.h>
+#include <stdlib.h>  // For qsort
+#include <string.h>  // For memset
+#include "../misc/lm2_parallel.h"
+#include "../misc/lm2_scratch.h"
+
+// =============================================================================
+// Convex Hull of a Point Set
+// =============================================================================
+// The input is cut into fixed chunks, so the partial hulls and therefore the
+// result are the same for every thread count. A first parallel pass finds the
+// extreme points of each chunk in sixteen directions around the circle. The
+// extremes of the whole set span the Akl-Toussaint polygon; sixteen corners
+// instead of the usual eight leave about a quarter as many points of a round
+// cloud outside it. A second pass drops the points strictly inside the
+// polygon, then sorts the rest of each chunk and runs the monotone chain on
+// it. The chunk hulls are merged by one more monotone chain on the calling
+// thread. A single chunk takes its buffers from the arena, more chunks take
+// theirs from the heap because they may run on worker threads.
+
+// Points per chunk; inputs up to this size run on the calling thread
+#define _LM2_CONVEX_HULL2_CHUNK_SIZE 16384
+
+// Number of extreme point directions
+#define _LM2_CONVEX_HULL2_DIRECTIONS 16
+
+// Extreme point directions in counter-clockwise order, starting at -y
+static const int _lm2_convex_hull2_directions[_LM2_CONVEX_HULL2_DIRECTIONS][2] = {
+    {0, -1}, {1, -2}, {1, -1}, {2, -1}, {1, 0}, {2, 1}, {1, 1}, {1, 2},
+    {0, 1}, {-1, 2}, {-1, 1}, {-2, 1}, {-1, 0}, {-2, -1}, {-1, -1}, {-1, -2},
+};
+
+#define _LM2_IMPL_CONVEX_HULL2(scalar_type, S)                                                                                          \
+  typedef struct _lm2_convex_hull2_chunk_##S {                                                                                          \
+    lm2_v2_##S extremes[_LM2_CONVEX_HULL2_DIRECTIONS];                                                                                  \
+    bool has_points; /* at least one finite point */                                                                                    \
+    lm2_v2_##S* hull;                                                                                                                   \
+    size_t hull_count;                                                                                                                  \
+    bool failed;                                                                                                                        \
+  } _lm2_convex_hull2_chunk_##S;                                                                                                        \
+                                                                                                                                        \
+  typedef struct _lm2_convex_hull2_context_##S {                                                                                        \
+    const lm2_v2_##S* points;                                                                                                           \
+    size_t point_count;                                                                                                                 \
+    lm2_v2_##S polygon[_LM2_CONVEX_HULL2_DIRECTIONS];                                                                                   \
+    size_t polygon_count; /* 0 when the polygon is degenerate and filters nothing */                                                    \
+    _lm2_convex_hull2_chunk_##S* chunks;                                                                                                \
+    lm2_arena* arena; /* for the chunk buffers of a single chunk, NULL for the heap */                                                  \
+  } _lm2_convex_hull2_context_##S;                                                                                                      \
+                                                                                                                                        \
+  static inline scalar_type _lm2_convex_hull2_cross3_##S(lm2_v2_##S a, lm2_v2_##S b, lm2_v2_##S c) {                                    \
+    return (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);                                                                       \
+  }                                                                                                                                     \
+                                                                                                                                        \
+  static int _lm2_convex_hull2_compare_##S(const void* a, const void* b) {                                                              \
+    const lm2_v2_##S* pa = (const lm2_v2_##S*)a;                                                                                        \
+    const lm2_v2_##S* pb = (const lm2_v2_##S*)b;                                                                                        \
+    if (pa->x != pb->x) {                                                                                                               \
+      return pa->x < pb->x ? -1 : 1;                                                                                                    \
+    }                                                                                                                                   \
+    if (pa->y != pb->y) {                                                                                                               \
+      return pa->y < pb->y ? -1 : 1;                                                                                                    \
+    }                                                                                                                                   \
+    return 0;                                                                                                                           \
+  }                                                                                                                                     \
+                                                                                                                                        \
+  /* Monotone chain over points sorted by x then y, which it deduplicates in place; hull needs room for count + 1 points */             \
+  static size_t _lm2_convex_hull2_monotone_chain_##S(lm2_v2_##S* points, size_t count, lm2_v2_##S* hull) {                              \
+    size_t unique = 0;                                                                                                                  \
+    for (size_t i = 0; i < count; i++) {                                                                                                \
+      if (unique == 0 || points[i].x != points[unique - 1].x || points[i].y != points[unique - 1].y) {                                  \
+        points[unique++] = points[i];                                                                                                   \
+      }                                                                                                                                 \
+    }                                                                                                                                   \
+    if (unique < 3) {                                                                                                                   \
+      for (size_t i = 0; i < unique; i++) {                                                                                             \
+        hull[i] = points[i];                                                                                                            \
+      }                                                                                                                                 \
+      return unique;                                                                                                                    \
+    }                                                                                                                                   \
+                                                                                                                                        \
+    size_t k = 0;                                                                                                                       \
+    for (size_t i = 0; i < unique; i++) {                                                                                               \
+      while (k >= 2 && _lm2_convex_hull2_cross3_##S(hull[k - 2], hull[k - 1], points[i]) <= 0) {                                        \
+        k--;                                                                                                                            \
+      }                                                                                                                                 \
+      hull[k++] = points[i];                                                                                                            \
+    }                                                                                                                                   \
+    size_t lower = k + 1;                                                                                                               \
+    for (size_t i = unique - 1; i-- > 0;) {                                                                                             \
+      while (k >= lower && _lm2_convex_hull2_cross3_##S(hull[k - 2], hull[k - 1], points[i]) <= 0) {                                    \
+        k--;                                                                                                                            \
+      }                                                                                                                                 \
+      hull[k++] = points[i];                                                                                                            \
+    }                                                                                                                                   \
+    return k - 1; /* the last point repeats the first */                                                                                \
+  }                                                                                                                                     \
+                                                                                                                                        \
+  static void _lm2_convex_hull2_extremes_task_##S(void* context, size_t begin, size_t end) {                                            \
+    _lm2_convex_hull2_context_##S* hull = (_lm2_convex_hull2_context_##S*)context;                                                      \
+    for (size_t c = begin; c < end; c++) {                                                                                              \
+      _lm2_convex_hull2_chunk_##S* chunk = &hull->chunks[c];                                                                            \
+      size_t first = c * _LM2_CONVEX_HULL2_CHUNK_SIZE;                                                                                  \
+      size_t last = first + _LM2_CONVEX_HULL2_CHUNK_SIZE < hull->point_count ? first + _LM2_CONVEX_HULL2_CHUNK_SIZE                     \
+                                                                             : hull->point_count;                                       \
+      scalar_type best[_LM2_CONVEX_HULL2_DIRECTIONS];                                                                                   \
+      for (int d = 0; d < _LM2_CONVEX_HULL2_DIRECTIONS; d++) {                                                                          \
+        best[d] = -INFINITY;                                                                                                            \
+      }                                                                                                                                 \
+      for (size_t i = first; i < last; i++) {                                                                                           \
+        lm2_v2_##S p = hull->points[i];                                                                                                 \
+        if (!isfinite(p.x) || !isfinite(p.y)) {                                                                                         \
+          continue;                                                                                                                     \
+        }                                                                                                                               \
+        for (int d = 0; d < _LM2_CONVEX_HULL2_DIRECTIONS; d++) {                                                                        \
+          scalar_type score = (scalar_type)_lm2_convex_hull2_directions[d][0] * p.x +                                                   \
+                              (scalar_type)_lm2_convex_hull2_directions[d][1] * p.y;                                                    \
+          if (score > best[d]) {                                                                                                        \
+            best[d] = score;                                                                                                            \
+            chunk->extremes[d] = p;                                                                                                     \
+          }                                                                                                                             \
+        }                                                                                                                               \
+        chunk->has_points = true;                                                                                                       \
+      }                                                                                                                                 \
+    }                                                                                                                                   \
+  }                                                                                                                                     \
+                                                                                                                                        \
+  static void _lm2_convex_hull2_chunk_task_##S(void* context, size_t begin, size_t end) {                                               \
+    _lm2_convex_hull2_context_##S* hull = (_lm2_convex_hull2_context_##S*)context;                                                      \
+    for (size_t c = begin; c < end; c++) {                                                                                              \
+      _lm2_convex_hull2_chunk_##S* chunk = &hull->chunks[c];                                                                            \
+      if (!chunk->has_points) {                                                                                                         \
+        continue;                                                                                                                       \
+      }                                                                                                                                 \
+      size_t first = c * _LM2_CONVEX_HULL2_CHUNK_SIZE;                                                                                  \
+      size_t last = first + _LM2_CONVEX_HULL2_CHUNK_SIZE < hull->point_count ? first + _LM2_CONVEX_HULL2_CHUNK_SIZE                     \
+                                                                             : hull->point_count;                                       \
+                                                                                                                                        \
+      /* Survivors of the polygon test, sorted for the monotone chain */                                                                \
+      size_t count = 0;                                                                                                                 \
+      lm2_v2_##S* kept = (lm2_v2_##S*)lm2_scratch_alloc(hull->arena, (last - first) * sizeof(lm2_v2_##S));                              \
+      if (kept == NULL) {                                                                                                               \
+        chunk->failed = true;                                                                                                           \
+        continue;                                                                                                                       \
+      }                                                                                                                                 \
+      for (size_t i = first; i < last; i++) {                                                                                           \
+        lm2_v2_##S p = hull->points[i];                                                                                                 \
+        if (!isfinite(p.x) || !isfinite(p.y)) {                                                                                         \
+          continue;                                                                                                                     \
+        }                                                                                                                               \
+        bool inside = hull->polygon_count > 0;                                                                                          \
+        for (size_t e = 0; e < hull->polygon_count && inside; e++) {                                                                    \
+          lm2_v2_##S a = hull->polygon[e];                                                                                              \
+          lm2_v2_##S b = hull->polygon[e + 1 < hull->polygon_count ? e + 1 : 0];                                                        \
+          inside = _lm2_convex_hull2_cross3_##S(a, b, p) > 0;                                                                           \
+        }                                                                                                                               \
+        if (inside) {                                                                                                                   \
+          continue;                                                                                                                     \
+        }                                                                                                                               \
+        kept[count++] = p;                                                                                                              \
+      }                                                                                                                                 \
+      if (!chunk->failed) {                                                                                                             \
+        qsort(kept, count, sizeof(*kept), _lm2_convex_hull2_compare_##S);                                                               \
+        chunk->hull = (lm2_v2_##S*)lm2_scratch_alloc(hull->arena, (count + 1) * sizeof(lm2_v2_##S));                                    \
+        chunk->failed = chunk->hull == NULL;                                                                                            \
+      }                                                                                                                                 \
+      if (!chunk->failed) {                                                                                                             \
+        chunk->hull_count = _lm2_convex_hull2_monotone_chain_##S(kept, count, chunk->hull);                                             \
+      }                                                                                                                                 \
+      lm2_scratch_free(hull->arena, kept);                                                                                              \
+    }                                                                                                                                   \
+  }                                                                                                                                     \
+                                                                                                                                        \
+  static size_t _lm2_convex_hull2_run_##S(                                                                                              \
+      const lm2_v2_##S* points,                                                                                                         \
+      size_t point_count,                                                                                                               \
+      lm2_v2_##S* out_vertices,                                                                                                         \
+      size_t capacity,                                                                                                                  \
+      uint32_t thread_count,                                                                                                            \
+      lm2_arena* arena) {                                                                                                               \
+    LM2_ASSERT(points != NULL || point_count == 0);                                                                                     \
+    LM2_ASSERT(out_vertices != NULL || capacity == 0);                                                                                  \
+    if (point_count == 0) {                                                                                                             \
+      return 0;                                                                                                                         \
+    }                                                                                                                                   \
+                                                                                                                                        \
+    size_t chunk_count = (point_count + _LM2_CONVEX_HULL2_CHUNK_SIZE - 1) / _LM2_CONVEX_HULL2_CHUNK_SIZE;                               \
+    uint32_t threads = chunk_count == 1 ? 1 : lm2_parallel_thread_count(thread_count);                                                  \
+    size_t mark = lm2_scratch_begin(arena);                                                                                             \
+    _lm2_convex_hull2_context_##S hull;                                                                                                 \
+    hull.points = points;                                                                                                               \
+    hull.point_count = point_count;                                                                                                     \
+    hull.polygon_count = 0;                                                                                                             \
+    hull.chunks = (_lm2_convex_hull2_chunk_##S*)lm2_scratch_alloc(arena, chunk_count * sizeof(_lm2_convex_hull2_chunk_##S));            \
+    hull.arena = chunk_count == 1 ? arena : NULL;                                                                                       \
+    if (hull.chunks == NULL) {                                                                                                          \
+      lm2_scratch_end(arena, mark);                                                                                                     \
+      return 0;                                                                                                                         \
+    }                                                                                                                                   \
+    memset(hull.chunks, 0, chunk_count * sizeof(_lm2_convex_hull2_chunk_##S));                                                          \
+    lm2_parallel_for(chunk_count, 1, threads, _lm2_convex_hull2_extremes_task_##S, &hull);                                              \
+                                                                                                                                        \
+    /* Polygon of the extremes of the whole set, with repeated corners removed */                                                       \
+    bool has_points = false;                                                                                                            \
+    scalar_type best[_LM2_CONVEX_HULL2_DIRECTIONS];                                                                                     \
+    for (int d = 0; d < _LM2_CONVEX_HULL2_DIRECTIONS; d++) {                                                                            \
+      best[d] = -INFINITY;                                                                                                              \
+    }                                                                                                                                   \
+    lm2_v2_##S extremes[_LM2_CONVEX_HULL2_DIRECTIONS];                                                                                  \
+    for (size_t c = 0; c < chunk_count; c++) {                                                                                          \
+      if (!hull.chunks[c].has_points) {                                                                                                 \
+        continue;                                                                                                                       \
+      }                                                                                                                                 \
+      for (int d = 0; d < _LM2_CONVEX_HULL2_DIRECTIONS; d++) {                                                                          \
+        lm2_v2_##S p = hull.chunks[c].extremes[d];                                                                                      \
+        scalar_type score = (scalar_type)_lm2_convex_hull2_directions[d][0] * p.x +                                                     \
+                            (scalar_type)_lm2_convex_hull2_directions[d][1] * p.y;                                                      \
+        if (score > best[d]) {                                                                                                          \
+          best[d] = score;                                                                                                              \
+          extremes[d] = p;                                                                                                              \
+        }                                                                                                                               \
+      }                                                                                                                                 \
+      has_points = true;                                                                                                                \
+    }                                                                                                                                   \
+    if (!has_points) {                                                                                                                  \
+      lm2_scratch_free(arena, hull.chunks);                                                                                             \
+      lm2_scratch_end(arena, mark);                                                                                                     \
+      return 0;                                                                                                                         \
+    }                                                                                                                                   \
+    for (int d = 0; d < _LM2_CONVEX_HULL2_DIRECTIONS; d++) {                                                                            \
+      lm2_v2_##S p = extremes[d];                                                                                                       \
+      lm2_v2_##S previous = hull.polygon_count > 0 ? hull.polygon[hull.polygon_count - 1] : extremes[_LM2_CONVEX_HULL2_DIRECTIONS - 1]; \
+      if (p.x != previous.x || p.y != previous.y) {                                                                                     \
+        hull.polygon[hull.polygon_count++] = p;                                                                                         \
+      }                                                                                                                                 \
+    }                                                                                                                                   \
+    scalar_type area = 0;                                                                                                               \
+    for (size_t e = 2; e < hull.polygon_count; e++) {                                                                                   \
+      area += _lm2_convex_hull2_cross3_##S(hull.polygon[0], hull.polygon[e - 1], hull.polygon[e]);                                      \
+    }                                                                                                                                   \
+    if (hull.polygon_count < 3 || !(area > 0)) {                                                                                        \
+      hull.polygon_count = 0;                                                                                                           \
+    }                                                                                                                                   \
+    lm2_parallel_for(chunk_count, 1, threads, _lm2_convex_hull2_chunk_task_##S, &hull);                                                 \
+                                                                                                                                        \
+    /* Merge the chunk hulls; a single chunk hull is already the result */                                                              \
+    bool failed = false;                                                                                                                \
+    size_t merged_count = 0;                                                                                                            \
+    for (size_t c = 0; c < chunk_count; c++) {                                                                                          \
+      failed |= hull.chunks[c].failed;                                                                                                  \
+      merged_count += hull.chunks[c].hull_count;                                                                                        \
+    }                                                                                                                                   \
+    lm2_v2_##S* result = NULL;                                                                                                          \
+    size_t result_count = 0;                                                                                                            \
+    if (!failed && chunk_count == 1) {                                                                                                  \
+      result = hull.chunks[0].hull;                                                                                                     \
+      result_count = hull.chunks[0].hull_count;                                                                                         \
+      hull.chunks[0].hull = NULL;                                                                                                       \
+    } else if (!failed) {                                                                                                               \
+      lm2_v2_##S* merged = (lm2_v2_##S*)lm2_scratch_alloc(arena, merged_count * sizeof(lm2_v2_##S));                                    \
+      result = (lm2_v2_##S*)lm2_scratch_alloc(arena, (merged_count + 1) * sizeof(lm2_v2_##S));                                          \
+      failed = merged == NULL || result == NULL;                                                                                        \
+      if (!failed) {                                                                                                                    \
+        size_t offset = 0;                                                                                                              \
+        for (size_t c = 0; c < chunk_count; c++) {                                                                                      \
+          for (size_t k = 0; k < hull.chunks[c].hull_count; k++) {                                                                      \
+            merged[offset++] = hull.chunks[c].hull[k];                                                                                  \
+          }                                                                                                                             \
+        }                                                                                                                               \
+        qsort(merged, merged_count, sizeof(*merged), _lm2_convex_hull2_compare_##S);                                                    \
+        result_count = _lm2_convex_hull2_monotone_chain_##S(merged, merged_count, result);                                              \
+      }                                                                                                                                 \
+      lm2_scratch_free(arena, merged);                                                                                                  \
+    }                                                                                                                                   \
+    if (!failed) {                                                                                                                      \
+      for (size_t k = 0; k < result_count && k < capacity; k++) {                                                                       \
+        out_vertices[k] = result[k];                                                                                                    \
+      }                                                                                                                                 \
+    }                                                                                                                                   \
+                                                                                                                                        \
+    lm2_scratch_free(arena, result);                                                                                                    \
+    for (size_t c = 0; c < chunk_count; c++) {                                                                                          \
+      lm2_scratch_free(arena, hull.chunks[c].hull);                                                                                     \
+    }                                                                                                                                   \
+    lm2_scratch_free(arena, hull.chunks);                                                                                               \
+    lm2_scratch_end(arena, mark);                                                                                                       \
+    return failed ? 0 : result_count;                                                                                                   \
+  }                                                                                                                                     \
+                                                                                                                                        \
+  LM2_API size_t lm2_convex_hull2_##S(                                                                                                  \
+      const lm2_v2_##S* points,                                                                                                         \
+      size_t point_count,                                                                                                               \
+      lm2_v2_##S* out_vertices,                                                                                                         \
+      size_t capacity,                                                                                                                  \
+      uint32_t thread_count) {                                                                                                          \
+    return _lm2_convex_hull2_run_##S(points, point_count, out_vertices, capacity, thread_count, lm2_arena_thread_default());            \
+  }                                                                                                                                     \
+                                                                                                                                        \
+  LM2_API size_t lm2_convex_hull2_scratch_##S(                                                                                          \
+      const lm2_v2_##S* points,                                                                                                         \
+      size_t point_count,                                                                                                               \
+      lm2_v2_##S* out_vertices,                                                                                                         \
+      size_t capacity,                                                                                                                  \
+      lm2_arena* arena) {                                                                                                               \
+    return _lm2_convex_hull2_run_##S(points, point_count, out_vertices, capacity, 1, arena);                                            \
+  }
+
+// =============================================================================
+// f64 Implementation
+// =============================================================================
+
+_LM2_IMPL_CONVEX_HULL2(double, f64)
+
+// =============================================================================
+// f32 Implementation
+// =============================================================================
+
+_LM2_IMPL_CONVEX_HULL2(float, f32)
@@ -0,0 +1,297 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <lm2/geometry2d/lm2_edge2.h>
+#include <lm2/ranges/lm2_range2.h>
+#include <lm2/ranges/lm2_range_sweep.h>
+#include <lm2/scalar/lm2_scalar.h>
+#include <lm2/vectors/lm2_vector_specifics.h>
+#include <math.h>
+#include <stdlib.h>  // For qsort
+#include "../misc/lm2_parallel.h"
+#include "../misc/lm2_scratch.h"
+
+// =============================================================================
+// Edge Set Intersection
+// =============================================================================
+// The bounding boxes of the edges go through the radix-sorted sweep and prune
+// of lm2_range_sweep.h, and only pairs whose boxes overlap get the exact
+// segment test. Those tests are split across threads in chunks of the pair
+// list, each chunk appending to its own buffer. The results are sorted by
+// edge pair at the end, so they do not depend on the thread count.
+
+// Below this candidate pair count the segment tests run on the calling thread
+#define _LM2_EDGE2_INTERSECTIONS_PARALLEL_MIN 8192
+
+// Pair chunks per thread, to even out chunks that hit more often
+#define _LM2_EDGE2_INTERSECTIONS_CHUNKS_PER_THREAD 8
+
+#define _LM2_IMPL_EDGE2_INTERSECTIONS(scalar_type, S)                                                                        \
+  typedef struct _lm2_edge2_hits_##S {                                                                                       \
+    lm2_edge2_intersection_##S* items;                                                                                       \
+    size_t count;                                                                                                            \
+    size_t capacity;                                                                                                         \
+    bool failed;                                                                                                             \
+  } _lm2_edge2_hits_##S;                                                                                                     \
+                                                                                                                             \
+  typedef struct _lm2_edge2_tests_##S {                                                                                      \
+    const lm2_edge2_##S* edges;                                                                                              \
+    const uint32_t* edge_indices; /* box index to edge index */                                                              \
+    const lm2_sweep_pair* pairs;                                                                                             \
+    size_t pair_count;                                                                                                       \
+    size_t chunk_size;                                                                                                       \
+    bool skip_shared_endpoints;                                                                                              \
+    _lm2_edge2_hits_##S* hits;                                                                                               \
+  } _lm2_edge2_tests_##S;                                                                                                    \
+                                                                                                                             \
+  static int _lm2_edge2_intersection_compare_##S(const void* a, const void* b) {                                             \
+    const lm2_edge2_intersection_##S* ia = (const lm2_edge2_intersection_##S*)a;                                             \
+    const lm2_edge2_intersection_##S* ib = (const lm2_edge2_intersection_##S*)b;                                             \
+    if (ia->edge_a != ib->edge_a) {                                                                                          \
+      return ia->edge_a < ib->edge_a ? -1 : 1;                                                                               \
+    }                                                                                                                        \
+    return ia->edge_b < ib->edge_b ? -1 : (ia->edge_b > ib->edge_b ? 1 : 0);                                                 \
+  }                                                                                                                          \
+                                                                                                                             \
+  static inline bool _lm2_edge2_point_on_##S(lm2_v2_##S a, lm2_v2_##S b, lm2_v2_##S p) {                                     \
+    return lm2_v2_cross3_##S(a, b, p) == 0 &&                                                                                \
+           p.x >= lm2_min_##S(a.x, b.x) && p.x <= lm2_max_##S(a.x, b.x) &&                                                   \
+           p.y >= lm2_min_##S(a.y, b.y) && p.y <= lm2_max_##S(a.y, b.y);                                                     \
+  }                                                                                                                          \
+                                                                                                                             \
+  static inline bool _lm2_edge2_points_equal_##S(lm2_v2_##S a, lm2_v2_##S b) {                                               \
+    return a.x == b.x && a.y == b.y;                                                                                         \
+  }                                                                                                                          \
+                                                                                                                             \
+  /* Edges joined at an exact common endpoint that do not overlap beyond it */                                               \
+  static bool _lm2_edge2_only_share_endpoint_##S(lm2_v2_##S a0, lm2_v2_##S a1, lm2_v2_##S b0, lm2_v2_##S b1) {               \
+    /* Endpoint k of a against endpoint m of b, k and m in {0, 1} */                                                         \
+    lm2_v2_##S pa[2] = {a0, a1};                                                                                             \
+    lm2_v2_##S pb[2] = {b0, b1};                                                                                             \
+    int k = 0;                                                                                                               \
+    int m = 0;                                                                                                               \
+    while (!_lm2_edge2_points_equal_##S(pa[k], pb[m])) {                                                                     \
+      if (++m == 2) {                                                                                                        \
+        m = 0;                                                                                                               \
+        if (++k == 2) {                                                                                                      \
+          return false;                                                                                                      \
+        }                                                                                                                    \
+      }                                                                                                                      \
+    }                                                                                                                        \
+    lm2_v2_##S joint = pa[k];                                                                                                \
+    lm2_v2_##S a_far = pa[1 - k];                                                                                            \
+    lm2_v2_##S b_far = pb[1 - m];                                                                                            \
+    if (lm2_v2_cross3_##S(joint, a_far, b_far) != 0) {                                                                       \
+      return true;                                                                                                           \
+    }                                                                                                                        \
+    /* Collinear: they overlap when both run the same way from the joint */                                                  \
+    scalar_type dot = (a_far.x - joint.x) * (b_far.x - joint.x) + (a_far.y - joint.y) * (b_far.y - joint.y);                 \
+    return dot <= 0;                                                                                                         \
+  }                                                                                                                          \
+                                                                                                                             \
+  /* A point shared by two intersecting edges: an endpoint lying on the other edge, else the crossing */                     \
+  static lm2_v2_##S _lm2_edge2_intersection_point_##S(lm2_v2_##S a0, lm2_v2_##S a1, lm2_v2_##S b0, lm2_v2_##S b1) {          \
+    if (_lm2_edge2_point_on_##S(b0, b1, a0)) {                                                                               \
+      return a0;                                                                                                             \
+    }                                                                                                                        \
+    if (_lm2_edge2_point_on_##S(b0, b1, a1)) {                                                                               \
+      return a1;                                                                                                             \
+    }                                                                                                                        \
+    if (_lm2_edge2_point_on_##S(a0, a1, b0)) {                                                                               \
+      return b0;                                                                                                             \
+    }                                                                                                                        \
+    if (_lm2_edge2_point_on_##S(a0, a1, b1)) {                                                                               \
+      return b1;                                                                                                             \
+    }                                                                                                                        \
+    scalar_type dax = a1.x - a0.x;                                                                                           \
+    scalar_type day = a1.y - a0.y;                                                                                           \
+    scalar_type dbx = b1.x - b0.x;                                                                                           \
+    scalar_type dby = b1.y - b0.y;                                                                                           \
+    scalar_type denom = dax * dby - day * dbx;                                                                               \
+    scalar_type t = denom != 0 ? ((b0.x - a0.x) * dby - (b0.y - a0.y) * dbx) / denom : 0;                                    \
+    t = lm2_clamp_##S(0, t, 1);                                                                                              \
+    return lm2_v2_make_##S(a0.x + dax * t, a0.y + day * t);                                                                  \
+  }                                                                                                                          \
+                                                                                                                             \
+  static void _lm2_edge2_hits_push_##S(_lm2_edge2_hits_##S* hits, uint32_t a, uint32_t b, lm2_v2_##S point) {                \
+    if (hits->count == hits->capacity) {                                                                                     \
+      size_t capacity = hits->capacity ? hits->capacity * 2 : 64;                                                            \
+      lm2_edge2_intersection_##S* items =                                                                                    \
+          (lm2_edge2_intersection_##S*)lm2_realloc(hits->items, capacity * sizeof(lm2_edge2_intersection_##S));              \
+      if (items == NULL) {                                                                                                   \
+        hits->failed = true;                                                                                                 \
+        return;                                                                                                              \
+      }                                                                                                                      \
+      hits->items = items;                                                                                                   \
+      hits->capacity = capacity;                                                                                             \
+    }                                                                                                                        \
+    lm2_edge2_intersection_##S* hit = &hits->items[hits->count++];                                                           \
+    hit->point = point;                                                                                                      \
+    hit->edge_a = a < b ? a : b;                                                                                             \
+    hit->edge_b = a < b ? b : a;                                                                                             \
+  }                                                                                                                          \
+                                                                                                                             \
+  static void _lm2_edge2_tests_task_##S(void* context, size_t begin, size_t end) {                                           \
+    _lm2_edge2_tests_##S* tests = (_lm2_edge2_tests_##S*)context;                                                            \
+    for (size_t chunk = begin; chunk < end; chunk++) {                                                                       \
+      _lm2_edge2_hits_##S* hits = &tests->hits[chunk];                                                                       \
+      size_t first = chunk * tests->chunk_size;                                                                              \
+      size_t last = (size_t)lm2_min_u64(first + tests->chunk_size, tests->pair_count);                                       \
+      for (size_t k = first; k < last && !hits->failed; k++) {                                                               \
+        uint32_t ia = tests->edge_indices[tests->pairs[k].a];                                                                \
+        uint32_t ib = tests->edge_indices[tests->pairs[k].b];                                                                \
+        lm2_edge2_##S a = tests->edges[ia];                                                                                  \
+        lm2_edge2_##S b = tests->edges[ib];                                                                                  \
+        if (!lm2_edge2_segments_intersect_##S(a.start, a.end, b.start, b.end)) {                                             \
+          continue;                                                                                                          \
+        }                                                                                                                    \
+        if (tests->skip_shared_endpoints && _lm2_edge2_only_share_endpoint_##S(a.start, a.end, b.start, b.end)) {            \
+          continue;                                                                                                          \
+        }                                                                                                                    \
+        _lm2_edge2_hits_push_##S(hits, ia, ib, _lm2_edge2_intersection_point_##S(a.start, a.end, b.start, b.end));           \
+      }                                                                                                                      \
+    }                                                                                                                        \
+  }                                                                                                                          \
+                                                                                                                             \
+  LM2_API size_t lm2_edge2_find_intersections_##S(                                                                           \
+      const lm2_edge2_##S* edges,                                                                                            \
+      size_t edge_count,                                                                                                     \
+      bool skip_shared_endpoints,                                                                                            \
+      lm2_edge2_intersection_##S* out_intersections,                                                                         \
+      size_t capacity,                                                                                                       \
+      uint32_t thread_count) {                                                                                               \
+    LM2_ASSERT(edges != NULL || edge_count == 0);                                                                            \
+    LM2_ASSERT(out_intersections != NULL || capacity == 0);                                                                  \
+    LM2_ASSERT(edge_count <= UINT32_MAX);                                                                                    \
+    if (edge_count < 2) {                                                                                                    \
+      return 0;                                                                                                              \
+    }                                                                                                                        \
+                                                                                                                             \
+    /* Boxes of the finite edges; an edge with a NaN or infinite coordinate never intersects anything */                     \
+    size_t box_count = 0;                                                                                                    \
+    lm2_r2_##S* boxes = (lm2_r2_##S*)lm2_malloc(edge_count * sizeof(lm2_r2_##S));                                            \
+    uint32_t* edge_indices = (uint32_t*)lm2_malloc(edge_count * sizeof(uint32_t));                                           \
+    void* buffer = lm2_malloc(lm2_r2_sweep_buffer_size_##S(edge_count));                                                     \
+    size_t pair_capacity = edge_count * 4;                                                                                   \
+    lm2_sweep_pair* pairs = (lm2_sweep_pair*)lm2_malloc(pair_capacity * sizeof(lm2_sweep_pair));                             \
+    _lm2_edge2_hits_##S* hits = NULL;                                                                                        \
+    size_t chunk_count = 0;                                                                                                  \
+    bool failed = boxes == NULL || edge_indices == NULL || buffer == NULL || pairs == NULL;                                  \
+    if (!failed) {                                                                                                           \
+      for (size_t i = 0; i < edge_count; i++) {                                                                              \
+        lm2_v2_##S a = edges[i].start;                                                                                       \
+        lm2_v2_##S b = edges[i].end;                                                                                         \
+        if (!isfinite(a.x) || !isfinite(a.y) || !isfinite(b.x) || !isfinite(b.y)) {                                          \
+          continue;                                                                                                          \
+        }                                                                                                                    \
+        boxes[box_count].min = lm2_v2_make_##S(lm2_min_##S(a.x, b.x), lm2_min_##S(a.y, b.y));                                \
+        boxes[box_count].max = lm2_v2_make_##S(lm2_max_##S(a.x, b.x), lm2_max_##S(a.y, b.y));                                \
+        edge_indices[box_count++] = (uint32_t)i;                                                                             \
+      }                                                                                                                      \
+                                                                                                                             \
+      /* The first guess of the pair count is usually enough; otherwise sweep again */                                       \
+      size_t buffer_size = lm2_r2_sweep_buffer_size_##S(box_count);                                                          \
+      size_t pair_count = lm2_r2_sweep_pairs_##S(boxes, box_count, buffer, buffer_size, pairs, pair_capacity);               \
+      if (pair_count > pair_capacity) {                                                                                      \
+        lm2_sweep_pair* grown = (lm2_sweep_pair*)lm2_realloc(pairs, pair_count * sizeof(lm2_sweep_pair));                    \
+        failed = grown == NULL;                                                                                              \
+        if (!failed) {                                                                                                       \
+          pairs = grown;                                                                                                     \
+          lm2_r2_sweep_pairs_##S(boxes, box_count, buffer, buffer_size, pairs, pair_count);                                  \
+        }                                                                                                                    \
+      }                                                                                                                      \
+                                                                                                                             \
+      if (!failed) {                                                                                                         \
+        uint32_t threads = pair_count < _LM2_EDGE2_INTERSECTIONS_PARALLEL_MIN ? 1 : lm2_parallel_thread_count(thread_count); \
+        chunk_count = threads == 1 ? 1 : (size_t)threads * _LM2_EDGE2_INTERSECTIONS_CHUNKS_PER_THREAD;                       \
+        hits = (_lm2_edge2_hits_##S*)lm2_calloc(chunk_count, sizeof(_lm2_edge2_hits_##S));                                   \
+        failed = hits == NULL;                                                                                               \
+        if (!failed) {                                                                                                       \
+          _lm2_edge2_tests_##S tests;                                                                                        \
+          tests.edges = edges;                                                                                               \
+          tests.edge_indices = edge_indices;                                                                                 \
+          tests.pairs = pairs;                                                                                               \
+          tests.pair_count = pair_count;                                                                                     \
+          tests.chunk_size = (pair_count + chunk_count - 1) / chunk_count;                                                   \
+          tests.skip_shared_endpoints = skip_shared_endpoints;                                                               \
+          tests.hits = hits;                                                                                                 \
+          lm2_parallel_for(chunk_count, 1, threads, _lm2_edge2_tests_task_##S, &tests);                                      \
+        }                                                                                                                    \
+      }                                                                                                                      \
+    }                                                                                                                        \
+    lm2_free(pairs);                                                                                                         \
+    lm2_free(buffer);                                                                                                        \
+    lm2_free(edge_indices);                                                                                                  \
+    lm2_free(boxes);                                                                                                         \
+    if (failed) {                                                                                                            \
+      lm2_free(hits);                                                                                                        \
+      return 0;                                                                                                              \
+    }                                                                                                                        \
+                                                                                                                             \
+    size_t total = 0;                                                                                                        \
+    for (size_t c = 0; c < chunk_count; c++) {                                                                               \
+      total += hits[c].count;                                                                                                \
+      failed |= hits[c].failed;                                                                                              \
+    }                                                                                                                        \
+                                                                                                                             \
+    /* Gather in pair order; when out_intersections is too small, sort a copy and keep the head */                           \
+    lm2_edge2_intersection_##S* sorted = out_intersections;                                                                  \
+    if (!failed && total > capacity) {                                                                                       \
+      sorted = (lm2_edge2_intersection_##S*)lm2_malloc(total * sizeof(lm2_edge2_intersection_##S));                          \
+      failed = sorted == NULL;                                                                                               \
+    }                                                                                                                        \
+    if (!failed) {                                                                                                           \
+      size_t offset = 0;                                                                                                     \
+      for (size_t c = 0; c < chunk_count; c++) {                                                                             \
+        for (size_t k = 0; k < hits[c].count; k++) {                                                                         \
+          sorted[offset++] = hits[c].items[k];                                                                               \
+        }                                                                                                                    \
+      }                                                                                                                      \
+      qsort(sorted, total, sizeof(*sorted), _lm2_edge2_intersection_compare_##S);                                            \
+      if (sorted != out_intersections) {                                                                                     \
+        for (size_t k = 0; k < capacity; k++) {                                                                              \
+          out_intersections[k] = sorted[k];                                                                                  \
+        }                                                                                                                    \
+        lm2_free(sorted);                                                                                                    \
+      }                                                                                                                      \
+    }                                                                                                                        \
+                                                                                                                             \
+    for (size_t c = 0; c < chunk_count; c++) {                                                                               \
+      lm2_free(hits[c].items);                                                                                               \
+    }                                                                                                                        \
+    lm2_free(hits);                                                                                                          \
+    return failed ? 0 : total;                                                                                               \
+  }
+
+// =============================================================================
+// f64 Implementation
+// =============================================================================
+
+_LM2_IMPL_EDGE2_INTERSECTIONS(double, f64)
+
+// =============================================================================
+// f32 Implementation
+// =============================================================================
+
+_LM2_IMPL_EDGE2_INTERSECTIONS(float, f32)
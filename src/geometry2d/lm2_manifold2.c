@@ -23,8 +23,10 @@ SOFTWARE.
 */
 
 #include "lm2_c2_utils.h"
+#include "lm2/geometry2d/lm2_convex_hull2.h"
 #include "lm2/geometry2d/lm2_manifold2.h"
 #include "lm2/geometry2d/lm2_plane2.h"
+#include "lm2/geometry2d/lm2_sat2.h"
 #include "lm2/geometry2d/lm2_shape2.h"
 #include "lm2/scalar/lm2_safe_ops.h"
 #include "lm2/scalar/lm2_scalar.h"
@@ -53,8 +55,10 @@ LM2_API bool lm2_collide_circle_to_capsule_f64(lm2_circle_f64 circle, lm2_capsul
 }
 
 LM2_API bool lm2_collide_circle_to_polygon_f64(lm2_circle_f64 circle, lm2_polygon_f64 polygon) {
-  c2Poly poly = lm2_polygon_f64_to_c2(polygon);
-  return c2CircletoPoly(lm2_circle_f64_to_c2(circle), &poly, NULL) != 0;
+  lm2_polygon_normals_f64 normals;
+  bool result = lm2_collide_circle_to_convex_polygon_f64(circle, lm2_polygon_f64_to_convex(polygon, &normals));
+  lm2_polygon_normals_f64_release(&normals);
+  return result;
 }
 
 LM2_API bool lm2_collide_aabb_to_aabb_f64(lm2_r2_f64 a, lm2_r2_f64 b) {
@@ -66,8 +70,10 @@ LM2_API bool lm2_collide_aabb_to_capsule_f64(lm2_r2_f64 aabb, lm2_capsule2_f64 c
 }
 
 LM2_API bool lm2_collide_aabb_to_polygon_f64(lm2_r2_f64 aabb, lm2_polygon_f64 polygon) {
-  c2Poly poly = lm2_polygon_f64_to_c2(polygon);
-  return c2AABBtoPoly(lm2_r2_f64_to_c2(aabb), &poly, NULL) != 0;
+  lm2_polygon_normals_f64 normals;
+  bool result = lm2_collide_aabb_to_convex_polygon_f64(aabb, lm2_polygon_f64_to_convex(polygon, &normals));
+  lm2_polygon_normals_f64_release(&normals);
+  return result;
 }
 
 LM2_API bool lm2_collide_capsule_to_capsule_f64(lm2_capsule2_f64 a, lm2_capsule2_f64 b) {
@@ -75,14 +81,21 @@ LM2_API bool lm2_collide_capsule_to_capsule_f64(lm2_capsule2_f64 a, lm2_capsule2
 }
 
 LM2_API bool lm2_collide_capsule_to_polygon_f64(lm2_capsule2_f64 capsule, lm2_polygon_f64 polygon) {
-  c2Poly poly = lm2_polygon_f64_to_c2(polygon);
-  return c2CapsuletoPoly(lm2_capsule2_f64_to_c2(capsule), &poly, NULL) != 0;
+  lm2_polygon_normals_f64 normals;
+  bool result = lm2_collide_capsule_to_convex_polygon_f64(capsule, lm2_polygon_f64_to_convex(polygon, &normals));
+  lm2_polygon_normals_f64_release(&normals);
+  return result;
 }
 
 LM2_API bool lm2_collide_polygon_to_polygon_f64(lm2_polygon_f64 a, lm2_polygon_f64 b) {
-  c2Poly poly_a = lm2_polygon_f64_to_c2(a);
-  c2Poly poly_b = lm2_polygon_f64_to_c2(b);
-  return c2PolytoPoly(&poly_a, NULL, &poly_b, NULL) != 0;
+  lm2_polygon_normals_f64 normals_a;
+  lm2_polygon_normals_f64 normals_b;
+  lm2_convex_polygon_f64 convex_a = lm2_polygon_f64_to_convex(a, &normals_a);
+  lm2_convex_polygon_f64 convex_b = lm2_polygon_f64_to_convex(b, &normals_b);
+  bool result = lm2_collide_convex_polygon_to_convex_polygon_f64(convex_a, convex_b);
+  lm2_polygon_normals_f64_release(&normals_b);
+  lm2_polygon_normals_f64_release(&normals_a);
+  return result;
 }
 
 // =============================================================================
@@ -106,8 +119,10 @@ LM2_API bool lm2_collide_circle_to_capsule_f32(lm2_circle_f32 circle, lm2_capsul
 }
 
 LM2_API bool lm2_collide_circle_to_polygon_f32(lm2_circle_f32 circle, lm2_polygon_f32 polygon) {
-  c2Poly poly = lm2_polygon_f32_to_c2(polygon);
-  return c2CircletoPoly(lm2_circle_f32_to_c2(circle), &poly, NULL) != 0;
+  lm2_polygon_normals_f32 normals;
+  bool result = lm2_collide_circle_to_convex_polygon_f32(circle, lm2_polygon_f32_to_convex(polygon, &normals));
+  lm2_polygon_normals_f32_release(&normals);
+  return result;
 }
 
 LM2_API bool lm2_collide_aabb_to_aabb_f32(lm2_r2_f32 a, lm2_r2_f32 b) {
@@ -119,8 +134,10 @@ LM2_API bool lm2_collide_aabb_to_capsule_f32(lm2_r2_f32 aabb, lm2_capsule2_f32 c
 }
 
 LM2_API bool lm2_collide_aabb_to_polygon_f32(lm2_r2_f32 aabb, lm2_polygon_f32 polygon) {
-  c2Poly poly = lm2_polygon_f32_to_c2(polygon);
-  return c2AABBtoPoly(lm2_r2_f32_to_c2(aabb), &poly, NULL) != 0;
+  lm2_polygon_normals_f32 normals;
+  bool result = lm2_collide_aabb_to_convex_polygon_f32(aabb, lm2_polygon_f32_to_convex(polygon, &normals));
+  lm2_polygon_normals_f32_release(&normals);
+  return result;
 }
 
 LM2_API bool lm2_collide_capsule_to_capsule_f32(lm2_capsule2_f32 a, lm2_capsule2_f32 b) {
@@ -128,14 +145,21 @@ LM2_API bool lm2_collide_capsule_to_capsule_f32(lm2_capsule2_f32 a, lm2_capsule2
 }
 
 LM2_API bool lm2_collide_capsule_to_polygon_f32(lm2_capsule2_f32 capsule, lm2_polygon_f32 polygon) {
-  c2Poly poly = lm2_polygon_f32_to_c2(polygon);
-  return c2CapsuletoPoly(lm2_capsule2_f32_to_c2(capsule), &poly, NULL) != 0;
+  lm2_polygon_normals_f32 normals;
+  bool result = lm2_collide_capsule_to_convex_polygon_f32(capsule, lm2_polygon_f32_to_convex(polygon, &normals));
+  lm2_polygon_normals_f32_release(&normals);
+  return result;
 }
 
 LM2_API bool lm2_collide_polygon_to_polygon_f32(lm2_polygon_f32 a, lm2_polygon_f32 b) {
-  c2Poly poly_a = lm2_polygon_f32_to_c2(a);
-  c2Poly poly_b = lm2_polygon_f32_to_c2(b);
-  return c2PolytoPoly(&poly_a, NULL, &poly_b, NULL) != 0;
+  lm2_polygon_normals_f32 normals_a;
+  lm2_polygon_normals_f32 normals_b;
+  lm2_convex_polygon_f32 convex_a = lm2_polygon_f32_to_convex(a, &normals_a);
+  lm2_convex_polygon_f32 convex_b = lm2_polygon_f32_to_convex(b, &normals_b);
+  bool result = lm2_collide_convex_polygon_to_convex_polygon_f32(convex_a, convex_b);
+  lm2_polygon_normals_f32_release(&normals_b);
+  lm2_polygon_normals_f32_release(&normals_a);
+  return result;
 }
 
 // =============================================================================
@@ -164,11 +188,9 @@ LM2_API void lm2_manifold_circle_to_capsule_f64(lm2_circle_f64 circle, lm2_capsu
 }
 
 LM2_API void lm2_manifold_circle_to_polygon_f64(lm2_circle_f64 circle, lm2_polygon_f64 polygon, lm2_manifold_f64* out_manifold) {
-  LM2_ASSERT(out_manifold != NULL);
-  c2Manifold m;
-  c2Poly poly = lm2_polygon_f64_to_c2(polygon);
-  c2CircletoPolyManifold(lm2_circle_f64_to_c2(circle), &poly, NULL, &m);
-  c2_manifold_to_lm2_f64(m, out_manifold);
+  lm2_polygon_normals_f64 normals;
+  lm2_manifold_circle_to_convex_polygon_f64(circle, lm2_polygon_f64_to_convex(polygon, &normals), out_manifold);
+  lm2_polygon_normals_f64_release(&normals);
 }
 
 LM2_API void lm2_manifold_aabb_to_aabb_f64(lm2_r2_f64 a, lm2_r2_f64 b, lm2_manifold_f64* out_manifold) {
@@ -186,11 +208,9 @@ LM2_API void lm2_manifold_aabb_to_capsule_f64(lm2_r2_f64 aabb, lm2_capsule2_f64
 }
 
 LM2_API void lm2_manifold_aabb_to_polygon_f64(lm2_r2_f64 aabb, lm2_polygon_f64 polygon, lm2_manifold_f64* out_manifold) {
-  LM2_ASSERT(out_manifold != NULL);
-  c2Manifold m;
-  c2Poly poly = lm2_polygon_f64_to_c2(polygon);
-  c2AABBtoPolyManifold(lm2_r2_f64_to_c2(aabb), &poly, NULL, &m);
-  c2_manifold_to_lm2_f64(m, out_manifold);
+  lm2_polygon_normals_f64 normals;
+  lm2_manifold_aabb_to_convex_polygon_f64(aabb, lm2_polygon_f64_to_convex(polygon, &normals), out_manifold);
+  lm2_polygon_normals_f64_release(&normals);
 }
 
 LM2_API void lm2_manifold_capsule_to_capsule_f64(lm2_capsule2_f64 a, lm2_capsule2_f64 b, lm2_manifold_f64* out_manifold) {
@@ -201,20 +221,19 @@ LM2_API void lm2_manifold_capsule_to_capsule_f64(lm2_capsule2_f64 a, lm2_capsule
 }
 
 LM2_API void lm2_manifold_capsule_to_polygon_f64(lm2_capsule2_f64 capsule, lm2_polygon_f64 polygon, lm2_manifold_f64* out_manifold) {
-  LM2_ASSERT(out_manifold != NULL);
-  c2Manifold m;
-  c2Poly poly = lm2_polygon_f64_to_c2(polygon);
-  c2CapsuletoPolyManifold(lm2_capsule2_f64_to_c2(capsule), &poly, NULL, &m);
-  c2_manifold_to_lm2_f64(m, out_manifold);
+  lm2_polygon_normals_f64 normals;
+  lm2_manifold_capsule_to_convex_polygon_f64(capsule, lm2_polygon_f64_to_convex(polygon, &normals), out_manifold);
+  lm2_polygon_normals_f64_release(&normals);
 }
 
 LM2_API void lm2_manifold_polygon_to_polygon_f64(lm2_polygon_f64 a, lm2_polygon_f64 b, lm2_manifold_f64* out_manifold) {
-  LM2_ASSERT(out_manifold != NULL);
-  c2Manifold m;
-  c2Poly poly_a = lm2_polygon_f64_to_c2(a);
-  c2Poly poly_b = lm2_polygon_f64_to_c2(b);
-  c2PolytoPolyManifold(&poly_a, NULL, &poly_b, NULL, &m);
-  c2_manifold_to_lm2_f64(m, out_manifold);
+  lm2_polygon_normals_f64 normals_a;
+  lm2_polygon_normals_f64 normals_b;
+  lm2_convex_polygon_f64 convex_a = lm2_polygon_f64_to_convex(a, &normals_a);
+  lm2_convex_polygon_f64 convex_b = lm2_polygon_f64_to_convex(b, &normals_b);
+  lm2_manifold_convex_polygon_to_convex_polygon_f64(convex_a, convex_b, out_manifold);
+  lm2_polygon_normals_f64_release(&normals_b);
+  lm2_polygon_normals_f64_release(&normals_a);
 }
 
 // =============================================================================
@@ -243,11 +262,9 @@ LM2_API void lm2_manifold_circle_to_capsule_f32(lm2_circle_f32 circle, lm2_capsu
 }
 
 LM2_API void lm2_manifold_circle_to_polygon_f32(lm2_circle_f32 circle, lm2_polygon_f32 polygon, lm2_manifold_f32* out_manifold) {
-  LM2_ASSERT(out_manifold != NULL);
-  c2Manifold m;
-  c2Poly poly = lm2_polygon_f32_to_c2(polygon);
-  c2CircletoPolyManifold(lm2_circle_f32_to_c2(circle), &poly, NULL, &m);
-  c2_manifold_to_lm2_f32(m, out_manifold);
+  lm2_polygon_normals_f32 normals;
+  lm2_manifold_circle_to_convex_polygon_f32(circle, lm2_polygon_f32_to_convex(polygon, &normals), out_manifold);
+  lm2_polygon_normals_f32_release(&normals);
 }
 
 LM2_API void lm2_manifold_aabb_to_aabb_f32(lm2_r2_f32 a, lm2_r2_f32 b, lm2_manifold_f32* out_manifold) {
@@ -265,11 +282,9 @@ LM2_API void lm2_manifold_aabb_to_capsule_f32(lm2_r2_f32 aabb, lm2_capsule2_f32
 }
 
 LM2_API void lm2_manifold_aabb_to_polygon_f32(lm2_r2_f32 aabb, lm2_polygon_f32 polygon, lm2_manifold_f32* out_manifold) {
-  LM2_ASSERT(out_manifold != NULL);
-  c2Manifold m;
-  c2Poly poly = lm2_polygon_f32_to_c2(polygon);
-  c2AABBtoPolyManifold(lm2_r2_f32_to_c2(aabb), &poly, NULL, &m);
-  c2_manifold_to_lm2_f32(m, out_manifold);
+  lm2_polygon_normals_f32 normals;
+  lm2_manifold_aabb_to_convex_polygon_f32(aabb, lm2_polygon_f32_to_convex(polygon, &normals), out_manifold);
+  lm2_polygon_normals_f32_release(&normals);
 }
 
 LM2_API void lm2_manifold_capsule_to_capsule_f32(lm2_capsule2_f32 a, lm2_capsule2_f32 b, lm2_manifold_f32* out_manifold) {
@@ -280,20 +295,19 @@ LM2_API void lm2_manifold_capsule_to_capsule_f32(lm2_capsule2_f32 a, lm2_capsule
 }
 
 LM2_API void lm2_manifold_capsule_to_polygon_f32(lm2_capsule2_f32 capsule, lm2_polygon_f32 polygon, lm2_manifold_f32* out_manifold) {
-  LM2_ASSERT(out_manifold != NULL);
-  c2Manifold m;
-  c2Poly poly = lm2_polygon_f32_to_c2(polygon);
-  c2CapsuletoPolyManifold(lm2_capsule2_f32_to_c2(capsule), &poly, NULL, &m);
-  c2_manifold_to_lm2_f32(m, out_manifold);
+  lm2_polygon_normals_f32 normals;
+  lm2_manifold_capsule_to_convex_polygon_f32(capsule, lm2_polygon_f32_to_convex(polygon, &normals), out_manifold);
+  lm2_polygon_normals_f32_release(&normals);
 }
 
 LM2_API void lm2_manifold_polygon_to_polygon_f32(lm2_polygon_f32 a, lm2_polygon_f32 b, lm2_manifold_f32* out_manifold) {
-  LM2_ASSERT(out_manifold != NULL);
-  c2Manifold m;
-  c2Poly poly_a = lm2_polygon_f32_to_c2(a);
-  c2Poly poly_b = lm2_polygon_f32_to_c2(b);
-  c2PolytoPolyManifold(&poly_a, NULL, &poly_b, NULL, &m);
-  c2_manifold_to_lm2_f32(m, out_manifold);
+  lm2_polygon_normals_f32 normals_a;
+  lm2_polygon_normals_f32 normals_b;
+  lm2_convex_polygon_f32 convex_a = lm2_polygon_f32_to_convex(a, &normals_a);
+  lm2_convex_polygon_f32 convex_b = lm2_polygon_f32_to_convex(b, &normals_b);
+  lm2_manifold_convex_polygon_to_convex_polygon_f32(convex_a, convex_b, out_manifold);
+  lm2_polygon_normals_f32_release(&normals_b);
+  lm2_polygon_normals_f32_release(&normals_a);
 }
 
 // =============================================================================
@@ -301,65 +315,41 @@ LM2_API void lm2_manifold_polygon_to_polygon_f32(lm2_polygon_f32 a, lm2_polygon_
 // =============================================================================
 
 LM2_API int lm2_convex_hull_f64(lm2_v2_f64* points, int point_count, lm2_v2_f64* out_vertices, int max_vertices) {
+  return lm2_convex_hull_scratch_f64(points, point_count, out_vertices, max_vertices, lm2_arena_thread_default());
+}
+
+LM2_API int lm2_convex_hull_scratch_f64(
+    lm2_v2_f64* points,
+    int point_count,
+    lm2_v2_f64* out_vertices,
+    int max_vertices,
+    lm2_arena* arena) {
   LM2_ASSERT(points != NULL);
   LM2_ASSERT(out_vertices != NULL);
   LM2_ASSERT(point_count >= 0);
   LM2_ASSERT(max_vertices >= 0);
 
-  if (point_count == 0) {
-    return 0;
-  }
-
-  // Convert to c2v
-  c2v* temp = (c2v*)malloc(sizeof(c2v) * (size_t)point_count);
-  LM2_ASSERT(temp != NULL);
-
-  for (int i = 0; i < point_count; ++i) {
-    temp[i] = lm22_f64_to_c2v(points[i]);
-  }
-
-  // Compute hull
-  int hull_count = c2Hull(temp, point_count);
-
-  // Convert back (up to max_vertices)
-  int result_count = hull_count < max_vertices ? hull_count : max_vertices;
-  for (int i = 0; i < result_count; ++i) {
-    out_vertices[i] = c2v_to_lm22_f64(temp[i]);
-  }
-
-  free(temp);
-  return result_count;
+  size_t hull_count = lm2_convex_hull2_scratch_f64(points, (size_t)point_count, out_vertices, (size_t)max_vertices, arena);
+  return hull_count < (size_t)max_vertices ? (int)hull_count : max_vertices;
 }
 
 LM2_API int lm2_convex_hull_f32(lm2_v2_f32* points, int point_count, lm2_v2_f32* out_vertices, int max_vertices) {
+  return lm2_convex_hull_scratch_f32(points, point_count, out_vertices, max_vertices, lm2_arena_thread_default());
+}
+
+LM2_API int lm2_convex_hull_scratch_f32(
+    lm2_v2_f32* points,
+    int point_count,
+    lm2_v2_f32* out_vertices,
+    int max_vertices,
+    lm2_arena* arena) {
   LM2_ASSERT(points != NULL);
   LM2_ASSERT(out_vertices != NULL);
   LM2_ASSERT(point_count >= 0);
   LM2_ASSERT(max_vertices >= 0);
 
-  if (point_count == 0) {
-    return 0;
-  }
-
-  // Convert to c2v
-  c2v* temp = (c2v*)malloc(sizeof(c2v) * (size_t)point_count);
-  LM2_ASSERT(temp != NULL);
-
-  for (int i = 0; i < point_count; ++i) {
-    temp[i] = lm22_f32_to_c2v(points[i]);
-  }
-
-  // Compute hull
-  int hull_count = c2Hull(temp, point_count);
-
-  // Convert back (up to max_vertices)
-  int result_count = hull_count < max_vertices ? hull_count : max_vertices;
-  for (int i = 0; i < result_count; ++i) {
-    out_vertices[i] = c2v_to_lm22_f32(temp[i]);
-  }
-
-  free(temp);
-  return result_count;
+  size_t hull_count = lm2_convex_hull2_scratch_f32(points, (size_t)point_count, out_vertices, (size_t)max_vertices, arena);
+  return hull_count < (size_t)max_vertices ? (int)hull_count : max_vertices;
 }
 
 LM2_API void lm2_compute_normals_f64(lm2_v2_f64* vertices, lm2_v2_f64* out_normals, int vertex_count) {
@@ -367,29 +357,12 @@ LM2_API void lm2_compute_normals_f64(lm2_v2_f64* vertices, lm2_v2_f64* out_norma
   LM2_ASSERT(out_normals != NULL);
   LM2_ASSERT(vertex_count >= 0);
 
-  if (vertex_count == 0) {
-    return;
-  }
-
-  // Convert to c2v
-  c2v* temp_verts = (c2v*)malloc(sizeof(c2v) * (size_t)vertex_count);
-  c2v* temp_norms = (c2v*)malloc(sizeof(c2v) * (size_t)vertex_count);
-  LM2_ASSERT(temp_verts != NULL && temp_norms != NULL);
-
   for (int i = 0; i < vertex_count; ++i) {
-    temp_verts[i] = lm22_f64_to_c2v(vertices[i]);
-  }
+    lm2_v2_f64 edge = lm2_v2_sub_f64(vertices[i + 1 < vertex_count ? i + 1 : 0], vertices[i]);
 
-  // Compute normals
-  c2Norms(temp_verts, temp_norms, vertex_count);
-
-  // Convert back
-  for (int i = 0; i < vertex_count; ++i) {
-    out_normals[i] = c2v_to_lm22_f64(temp_norms[i]);
+    // Outward normal for CCW winding: edge rotated clockwise by 90 degrees
+    out_normals[i] = lm2_v2_norm_f64((lm2_v2_f64) {edge.y, -edge.x});
   }
-
-  free(temp_verts);
-  free(temp_norms);
 }
 
 LM2_API void lm2_compute_normals_f32(lm2_v2_f32* vertices, lm2_v2_f32* out_normals, int vertex_count) {
@@ -397,93 +370,50 @@ LM2_API void lm2_compute_normals_f32(lm2_v2_f32* vertices, lm2_v2_f32* out_norma
   LM2_ASSERT(out_normals != NULL);
   LM2_ASSERT(vertex_count >= 0);
 
-  if (vertex_count == 0) {
-    return;
-  }
-
-  // Convert to c2v
-  c2v* temp_verts = (c2v*)malloc(sizeof(c2v) * (size_t)vertex_count);
-  c2v* temp_norms = (c2v*)malloc(sizeof(c2v) * (size_t)vertex_count);
-  LM2_ASSERT(temp_verts != NULL && temp_norms != NULL);
-
   for (int i = 0; i < vertex_count; ++i) {
-    temp_verts[i] = lm22_f32_to_c2v(vertices[i]);
-  }
-
-  // Compute normals
-  c2Norms(temp_verts, temp_norms, vertex_count);
+    lm2_v2_f32 edge = lm2_v2_sub_f32(vertices[i + 1 < vertex_count ? i + 1 : 0], vertices[i]);
 
-  // Convert back
-  for (int i = 0; i < vertex_count; ++i) {
-    out_normals[i] = c2v_to_lm22_f32(temp_norms[i]);
+    // Outward normal for CCW winding: edge rotated clockwise by 90 degrees
+    out_normals[i] = lm2_v2_norm_f32((lm2_v2_f32) {edge.y, -edge.x});
   }
-
-  free(temp_verts);
-  free(temp_norms);
 }
 
 LM2_API void lm2_make_convex_polygon_f64(lm2_polygon_f64* polygon, lm2_v2_f64* out_normals) {
+  lm2_make_convex_polygon_scratch_f64(polygon, out_normals, lm2_arena_thread_default());
+}
+
+LM2_API void lm2_make_convex_polygon_scratch_f64(lm2_polygon_f64* polygon, lm2_v2_f64* out_normals, lm2_arena* arena) {
   LM2_ASSERT(polygon != NULL);
   LM2_ASSERT(polygon->vertices != NULL);
   LM2_ASSERT(out_normals != NULL);
+  LM2_ASSERT(polygon->vertex_count <= (size_t)INT32_MAX);
 
-  // Convert to c2v
-  c2v* temp_verts = (c2v*)malloc(sizeof(c2v) * polygon->vertex_count);
-  c2v* temp_norms = (c2v*)malloc(sizeof(c2v) * polygon->vertex_count);
-  LM2_ASSERT(temp_verts != NULL && temp_norms != NULL);
-
-  for (size_t i = 0; i < polygon->vertex_count; ++i) {
-    temp_verts[i] = lm22_f64_to_c2v(polygon->vertices[i]);
-  }
-
-  // Compute hull
-  int hull_count = c2Hull(temp_verts, (int)polygon->vertex_count);
-
-  // Compute normals
-  c2Norms(temp_verts, temp_norms, hull_count);
-
-  // Convert back
-  for (int i = 0; i < hull_count; ++i) {
-    polygon->vertices[i] = c2v_to_lm22_f64(temp_verts[i]);
-    out_normals[i] = c2v_to_lm22_f64(temp_norms[i]);
-  }
+  // The hull reads every point before writing, so it can overwrite the vertices in place
+  size_t hull_count = lm2_convex_hull2_scratch_f64(
+      polygon->vertices, polygon->vertex_count, polygon->vertices, polygon->vertex_count, arena);
 
-  polygon->vertex_count = (size_t)hull_count;
-
-  free(temp_verts);
-  free(temp_norms);
+  // Fewer than three hull vertices is no polygon
+  polygon->vertex_count = hull_count >= 3 ? hull_count : 0;
+  lm2_compute_normals_f64(polygon->vertices, out_normals, (int)polygon->vertex_count);
 }
 
 LM2_API void lm2_make_convex_polygon_f32(lm2_polygon_f32* polygon, lm2_v2_f32* out_normals) {
+  lm2_make_convex_polygon_scratch_f32(polygon, out_normals, lm2_arena_thread_default());
+}
+
+LM2_API void lm2_make_convex_polygon_scratch_f32(lm2_polygon_f32* polygon, lm2_v2_f32* out_normals, lm2_arena* arena) {
   LM2_ASSERT(polygon != NULL);
   LM2_ASSERT(polygon->vertices != NULL);
   LM2_ASSERT(out_normals != NULL);
+  LM2_ASSERT(polygon->vertex_count <= (size_t)INT32_MAX);
 
-  // Convert to c2v
-  c2v* temp_verts = (c2v*)malloc(sizeof(c2v) * polygon->vertex_count);
-  c2v* temp_norms = (c2v*)malloc(sizeof(c2v) * polygon->vertex_count);
-  LM2_ASSERT(temp_verts != NULL && temp_norms != NULL);
-
-  for (size_t i = 0; i < polygon->vertex_count; ++i) {
-    temp_verts[i] = lm22_f32_to_c2v(polygon->vertices[i]);
-  }
-
-  // Compute hull
-  int hull_count = c2Hull(temp_verts, (int)polygon->vertex_count);
-
-  // Compute normals
-  c2Norms(temp_verts, temp_norms, hull_count);
-
-  // Convert back
-  for (int i = 0; i < hull_count; ++i) {
-    polygon->vertices[i] = c2v_to_lm22_f32(temp_verts[i]);
-    out_normals[i] = c2v_to_lm22_f32(temp_norms[i]);
-  }
+  // The hull reads every point before writing, so it can overwrite the vertices in place
+  size_t hull_count = lm2_convex_hull2_scratch_f32(
+      polygon->vertices, polygon->vertex_count, polygon->vertices, polygon->vertex_count, arena);
 
-  polygon->vertex_count = (size_t)hull_count;
-
-  free(temp_verts);
-  free(temp_norms);
+  // Fewer than three hull vertices is no polygon
+  polygon->vertex_count = hull_count >= 3 ? hull_count : 0;
+  lm2_compute_normals_f32(polygon->vertices, out_normals, (int)polygon->vertex_count);
 }
 
 // =============================================================================
@@ -512,9 +442,10 @@ LM2_API bool lm2_collide_triangle_to_capsule_f64(const lm2_triangle2_f64 tri, lm
 }
 
 LM2_API bool lm2_collide_triangle_to_polygon_f64(const lm2_triangle2_f64 tri, lm2_polygon_f64 polygon) {
-  c2Poly poly_tri = lm2_triangle2_f64_to_c2(tri);
-  c2Poly poly = lm2_polygon_f64_to_c2(polygon);
-  return c2PolytoPoly(&poly_tri, NULL, &poly, NULL) != 0;
+  lm2_polygon_normals_f64 normals;
+  bool result = lm2_collide_triangle_to_convex_polygon_f64(tri, lm2_polygon_f64_to_convex(polygon, &normals));
+  lm2_polygon_normals_f64_release(&normals);
+  return result;
 }
 
 // =============================================================================
@@ -543,9 +474,10 @@ LM2_API bool lm2_collide_triangle_to_capsule_f32(const lm2_triangle2_f32 tri, lm
 }
 
 LM2_API bool lm2_collide_triangle_to_polygon_f32(const lm2_triangle2_f32 tri, lm2_polygon_f32 polygon) {
-  c2Poly poly_tri = lm2_triangle2_f32_to_c2(tri);
-  c2Poly poly = lm2_polygon_f32_to_c2(polygon);
-  return c2PolytoPoly(&poly_tri, NULL, &poly, NULL) != 0;
+  lm2_polygon_normals_f32 normals;
+  bool result = lm2_collide_triangle_to_convex_polygon_f32(tri, lm2_polygon_f32_to_convex(polygon, &normals));
+  lm2_polygon_normals_f32_release(&normals);
+  return result;
 }
 
 // =============================================================================
@@ -586,12 +518,9 @@ LM2_API void lm2_manifold_triangle_to_capsule_f64(const lm2_triangle2_f64 tri, l
 }
 
 LM2_API void lm2_manifold_triangle_to_polygon_f64(const lm2_triangle2_f64 tri, lm2_polygon_f64 polygon, lm2_manifold_f64* out_manifold) {
-  LM2_ASSERT(out_manifold != NULL);
-  c2Manifold m;
-  c2Poly poly_tri = lm2_triangle2_f64_to_c2(tri);
-  c2Poly poly = lm2_polygon_f64_to_c2(polygon);
-  c2PolytoPolyManifold(&poly_tri, NULL, &poly, NULL, &m);
-  c2_manifold_to_lm2_f64(m, out_manifold);
+  lm2_polygon_normals_f64 normals;
+  lm2_manifold_triangle_to_convex_polygon_f64(tri, lm2_polygon_f64_to_convex(polygon, &normals), out_manifold);
+  lm2_polygon_normals_f64_release(&normals);
 }
 
 // =============================================================================
@@ -632,14 +561,405 @@ LM2_API void lm2_manifold_triangle_to_capsule_f32(const lm2_triangle2_f32 tri, l
 }
 
 LM2_API void lm2_manifold_triangle_to_polygon_f32(const lm2_triangle2_f32 tri, lm2_polygon_f32 polygon, lm2_manifold_f32* out_manifold) {
+  lm2_polygon_normals_f32 normals;
+  lm2_manifold_triangle_to_convex_polygon_f32(tri, lm2_polygon_f32_to_convex(polygon, &normals), out_manifold);
+  lm2_polygon_normals_f32_release(&normals);
+}
+
+// =============================================================================
+// Convex Polygon Collision Detection - f64
+// =============================================================================
+
+static lm2_r2_f64 _lm2_circle_bounds_f64(lm2_circle_f64 circle) {
+  lm2_v2_f64 extent = {circle.radius, circle.radius};
+  lm2_r2_f64 bounds;
+  bounds.min = lm2_v2_sub_f64(circle.center, extent);
+  bounds.max = lm2_v2_add_f64(circle.center, extent);
+  return bounds;
+}
+
+static lm2_r2_f64 _lm2_capsule_bounds_f64(lm2_capsule2_f64 capsule) {
+  lm2_v2_f64 extent = {capsule.radius, capsule.radius};
+  lm2_r2_f64 bounds;
+  bounds.min = lm2_v2_sub_f64(lm2_v2_min_f64(capsule.start, capsule.end), extent);
+  bounds.max = lm2_v2_add_f64(lm2_v2_max_f64(capsule.start, capsule.end), extent);
+  return bounds;
+}
+
+static lm2_r2_f64 _lm2_triangle_bounds_f64(const lm2_triangle2_f64 tri) {
+  lm2_r2_f64 bounds;
+  bounds.min = lm2_v2_min_f64(tri[0], lm2_v2_min_f64(tri[1], tri[2]));
+  bounds.max = lm2_v2_max_f64(tri[0], lm2_v2_max_f64(tri[1], tri[2]));
+  return bounds;
+}
+
+// Convex loops for the native narrowphase, used once a polygon exceeds C2_MAX_POLYGON_VERTS
+static lm2_convex_polygon_f64 _lm2_aabb_to_convex_f64(lm2_r2_f64 aabb, lm2_v2_f64* vertices, lm2_v2_f64* normals) {
+  lm2_polygon_make_rect_f64(vertices, aabb.min, aabb.max);
+  return lm2_convex_polygon_make_f64(lm2_polygon_make_f64(vertices, 4), normals);
+}
+
+static lm2_convex_polygon_f64 _lm2_triangle_to_convex_f64(const lm2_triangle2_f64 tri, lm2_v2_f64* vertices, lm2_v2_f64* normals) {
+  lm2_polygon_from_triangle_f64(vertices, tri);
+  lm2_polygon_f64 polygon = lm2_polygon_make_f64(vertices, 3);
+  if (!lm2_polygon_is_ccw_f64(polygon)) {
+    lm2_polygon_reverse_winding_f64(polygon);
+  }
+  return lm2_convex_polygon_make_f64(polygon, normals);
+}
+
+LM2_API bool lm2_collide_circle_to_convex_polygon_f64(lm2_circle_f64 circle, lm2_convex_polygon_f64 convex) {
+  if (!lm2_r2_overlaps_f64(_lm2_circle_bounds_f64(circle), convex.bounds)) {
+    return false;
+  }
+  if (convex.vertex_count > C2_MAX_POLYGON_VERTS) {
+    lm2_manifold_f64 m;
+    lm2_sat2_manifold_circle_to_polygon_f64(circle, convex, &m);
+    return m.count > 0;
+  }
+  c2Poly poly = lm2_convex_polygon_f64_to_c2(convex);
+  return c2CircletoPoly(lm2_circle_f64_to_c2(circle), &poly, NULL) != 0;
+}
+
+LM2_API bool lm2_collide_aabb_to_convex_polygon_f64(lm2_r2_f64 aabb, lm2_convex_polygon_f64 convex) {
+  if (!lm2_r2_overlaps_f64(aabb, convex.bounds)) {
+    return false;
+  }
+  if (convex.vertex_count > C2_MAX_POLYGON_VERTS) {
+    lm2_v2_f64 vertices[4];
+    lm2_v2_f64 normals[4];
+    return lm2_sat2_collide_polygon_to_polygon_f64(_lm2_aabb_to_convex_f64(aabb, vertices, normals), convex);
+  }
+  c2Poly poly = lm2_convex_polygon_f64_to_c2(convex);
+  return c2AABBtoPoly(lm2_r2_f64_to_c2(aabb), &poly, NULL) != 0;
+}
+
+LM2_API bool lm2_collide_capsule_to_convex_polygon_f64(lm2_capsule2_f64 capsule, lm2_convex_polygon_f64 convex) {
+  if (!lm2_r2_overlaps_f64(_lm2_capsule_bounds_f64(capsule), convex.bounds)) {
+    return false;
+  }
+  if (convex.vertex_count > C2_MAX_POLYGON_VERTS) {
+    lm2_manifold_f64 m;
+    lm2_sat2_manifold_capsule_to_polygon_f64(capsule, convex, &m);
+    return m.count > 0;
+  }
+  c2Poly poly = lm2_convex_polygon_f64_to_c2(convex);
+  return c2CapsuletoPoly(lm2_capsule2_f64_to_c2(capsule), &poly, NULL) != 0;
+}
+
+LM2_API bool lm2_collide_triangle_to_convex_polygon_f64(const lm2_triangle2_f64 tri, lm2_convex_polygon_f64 convex) {
+  if (!lm2_r2_overlaps_f64(_lm2_triangle_bounds_f64(tri), convex.bounds)) {
+    return false;
+  }
+  if (convex.vertex_count > C2_MAX_POLYGON_VERTS) {
+    lm2_v2_f64 vertices[3];
+    lm2_v2_f64 normals[3];
+    return lm2_sat2_collide_polygon_to_polygon_f64(_lm2_triangle_to_convex_f64(tri, vertices, normals), convex);
+  }
+  c2Poly poly_tri = lm2_triangle2_f64_to_c2(tri);
+  c2Poly poly = lm2_convex_polygon_f64_to_c2(convex);
+  return c2PolytoPoly(&poly_tri, NULL, &poly, NULL) != 0;
+}
+
+LM2_API bool lm2_collide_convex_polygon_to_convex_polygon_f64(lm2_convex_polygon_f64 a, lm2_convex_polygon_f64 b) {
+  if (!lm2_r2_overlaps_f64(a.bounds, b.bounds)) {
+    return false;
+  }
+  if (a.vertex_count > C2_MAX_POLYGON_VERTS || b.vertex_count > C2_MAX_POLYGON_VERTS) {
+    return lm2_sat2_collide_polygon_to_polygon_f64(a, b);
+  }
+  c2Poly poly_a = lm2_convex_polygon_f64_to_c2(a);
+  c2Poly poly_b = lm2_convex_polygon_f64_to_c2(b);
+  return c2PolytoPoly(&poly_a, NULL, &poly_b, NULL) != 0;
+}
+
+// =============================================================================
+// Convex Polygon Collision Detection - f32
+// =============================================================================
+
+static lm2_r2_f32 _lm2_circle_bounds_f32(lm2_circle_f32 circle) {
+  lm2_v2_f32 extent = {circle.radius, circle.radius};
+  lm2_r2_f32 bounds;
+  bounds.min = lm2_v2_sub_f32(circle.center, extent);
+  bounds.max = lm2_v2_add_f32(circle.center, extent);
+  return bounds;
+}
+
+static lm2_r2_f32 _lm2_capsule_bounds_f32(lm2_capsule2_f32 capsule) {
+  lm2_v2_f32 extent = {capsule.radius, capsule.radius};
+  lm2_r2_f32 bounds;
+  bounds.min = lm2_v2_sub_f32(lm2_v2_min_f32(capsule.start, capsule.end), extent);
+  bounds.max = lm2_v2_add_f32(lm2_v2_max_f32(capsule.start, capsule.end), extent);
+  return bounds;
+}
+
+static lm2_r2_f32 _lm2_triangle_bounds_f32(const lm2_triangle2_f32 tri) {
+  lm2_r2_f32 bounds;
+  bounds.min = lm2_v2_min_f32(tri[0], lm2_v2_min_f32(tri[1], tri[2]));
+  bounds.max = lm2_v2_max_f32(tri[0], lm2_v2_max_f32(tri[1], tri[2]));
+  return bounds;
+}
+
+// Convex loops for the native narrowphase, used once a polygon exceeds C2_MAX_POLYGON_VERTS
+static lm2_convex_polygon_f32 _lm2_aabb_to_convex_f32(lm2_r2_f32 aabb, lm2_v2_f32* vertices, lm2_v2_f32* normals) {
+  lm2_polygon_make_rect_f32(vertices, aabb.min, aabb.max);
+  return lm2_convex_polygon_make_f32(lm2_polygon_make_f32(vertices, 4), normals);
+}
+
+static lm2_convex_polygon_f32 _lm2_triangle_to_convex_f32(const lm2_triangle2_f32 tri, lm2_v2_f32* vertices, lm2_v2_f32* normals) {
+  lm2_polygon_from_triangle_f32(vertices, tri);
+  lm2_polygon_f32 polygon = lm2_polygon_make_f32(vertices, 3);
+  if (!lm2_polygon_is_ccw_f32(polygon)) {
+    lm2_polygon_reverse_winding_f32(polygon);
+  }
+  return lm2_convex_polygon_make_f32(polygon, normals);
+}
+
+LM2_API bool lm2_collide_circle_to_convex_polygon_f32(lm2_circle_f32 circle, lm2_convex_polygon_f32 convex) {
+  if (!lm2_r2_overlaps_f32(_lm2_circle_bounds_f32(circle), convex.bounds)) {
+    return false;
+  }
+  if (convex.vertex_count > C2_MAX_POLYGON_VERTS) {
+    lm2_manifold_f32 m;
+    lm2_sat2_manifold_circle_to_polygon_f32(circle, convex, &m);
+    return m.count > 0;
+  }
+  c2Poly poly = lm2_convex_polygon_f32_to_c2(convex);
+  return c2CircletoPoly(lm2_circle_f32_to_c2(circle), &poly, NULL) != 0;
+}
+
+LM2_API bool lm2_collide_aabb_to_convex_polygon_f32(lm2_r2_f32 aabb, lm2_convex_polygon_f32 convex) {
+  if (!lm2_r2_overlaps_f32(aabb, convex.bounds)) {
+    return false;
+  }
+  if (convex.vertex_count > C2_MAX_POLYGON_VERTS) {
+    lm2_v2_f32 vertices[4];
+    lm2_v2_f32 normals[4];
+    return lm2_sat2_collide_polygon_to_polygon_f32(_lm2_aabb_to_convex_f32(aabb, vertices, normals), convex);
+  }
+  c2Poly poly = lm2_convex_polygon_f32_to_c2(convex);
+  return c2AABBtoPoly(lm2_r2_f32_to_c2(aabb), &poly, NULL) != 0;
+}
+
+LM2_API bool lm2_collide_capsule_to_convex_polygon_f32(lm2_capsule2_f32 capsule, lm2_convex_polygon_f32 convex) {
+  if (!lm2_r2_overlaps_f32(_lm2_capsule_bounds_f32(capsule), convex.bounds)) {
+    return false;
+  }
+  if (convex.vertex_count > C2_MAX_POLYGON_VERTS) {
+    lm2_manifold_f32 m;
+    lm2_sat2_manifold_capsule_to_polygon_f32(capsule, convex, &m);
+    return m.count > 0;
+  }
+  c2Poly poly = lm2_convex_polygon_f32_to_c2(convex);
+  return c2CapsuletoPoly(lm2_capsule2_f32_to_c2(capsule), &poly, NULL) != 0;
+}
+
+LM2_API bool lm2_collide_triangle_to_convex_polygon_f32(const lm2_triangle2_f32 tri, lm2_convex_polygon_f32 convex) {
+  if (!lm2_r2_overlaps_f32(_lm2_triangle_bounds_f32(tri), convex.bounds)) {
+    return false;
+  }
+  if (convex.vertex_count > C2_MAX_POLYGON_VERTS) {
+    lm2_v2_f32 vertices[3];
+    lm2_v2_f32 normals[3];
+    return lm2_sat2_collide_polygon_to_polygon_f32(_lm2_triangle_to_convex_f32(tri, vertices, normals), convex);
+  }
+  c2Poly poly_tri = lm2_triangle2_f32_to_c2(tri);
+  c2Poly poly = lm2_convex_polygon_f32_to_c2(convex);
+  return c2PolytoPoly(&poly_tri, NULL, &poly, NULL) != 0;
+}
+
+LM2_API bool lm2_collide_convex_polygon_to_convex_polygon_f32(lm2_convex_polygon_f32 a, lm2_convex_polygon_f32 b) {
+  if (!lm2_r2_overlaps_f32(a.bounds, b.bounds)) {
+    return false;
+  }
+  if (a.vertex_count > C2_MAX_POLYGON_VERTS || b.vertex_count > C2_MAX_POLYGON_VERTS) {
+    return lm2_sat2_collide_polygon_to_polygon_f32(a, b);
+  }
+  c2Poly poly_a = lm2_convex_polygon_f32_to_c2(a);
+  c2Poly poly_b = lm2_convex_polygon_f32_to_c2(b);
+  return c2PolytoPoly(&poly_a, NULL, &poly_b, NULL) != 0;
+}
+
+// =============================================================================
+// Convex Polygon Manifold Generation - f64
+// =============================================================================
+
+LM2_API void lm2_manifold_circle_to_convex_polygon_f64(lm2_circle_f64 circle, lm2_convex_polygon_f64 convex, lm2_manifold_f64* out_manifold) {
+  LM2_ASSERT(out_manifold != NULL);
+  if (!lm2_r2_overlaps_f64(_lm2_circle_bounds_f64(circle), convex.bounds)) {
+    out_manifold->count = 0;
+    return;
+  }
+  if (convex.vertex_count > C2_MAX_POLYGON_VERTS) {
+    lm2_sat2_manifold_circle_to_polygon_f64(circle, convex, out_manifold);
+    return;
+  }
+  c2Manifold m;
+  c2Poly poly = lm2_convex_polygon_f64_to_c2(convex);
+  c2CircletoPolyManifold(lm2_circle_f64_to_c2(circle), &poly, NULL, &m);
+  c2_manifold_to_lm2_f64(m, out_manifold);
+}
+
+LM2_API void lm2_manifold_aabb_to_convex_polygon_f64(lm2_r2_f64 aabb, lm2_convex_polygon_f64 convex, lm2_manifold_f64* out_manifold) {
+  LM2_ASSERT(out_manifold != NULL);
+  if (!lm2_r2_overlaps_f64(aabb, convex.bounds)) {
+    out_manifold->count = 0;
+    return;
+  }
+  if (convex.vertex_count > C2_MAX_POLYGON_VERTS) {
+    lm2_v2_f64 vertices[4];
+    lm2_v2_f64 normals[4];
+    lm2_sat2_manifold_polygon_to_polygon_f64(_lm2_aabb_to_convex_f64(aabb, vertices, normals), convex, out_manifold);
+    return;
+  }
+  c2Manifold m;
+  c2Poly poly = lm2_convex_polygon_f64_to_c2(convex);
+  c2AABBtoPolyManifold(lm2_r2_f64_to_c2(aabb), &poly, NULL, &m);
+  c2_manifold_to_lm2_f64(m, out_manifold);
+}
+
+LM2_API void lm2_manifold_capsule_to_convex_polygon_f64(lm2_capsule2_f64 capsule, lm2_convex_polygon_f64 convex, lm2_manifold_f64* out_manifold) {
+  LM2_ASSERT(out_manifold != NULL);
+  if (!lm2_r2_overlaps_f64(_lm2_capsule_bounds_f64(capsule), convex.bounds)) {
+    out_manifold->count = 0;
+    return;
+  }
+  if (convex.vertex_count > C2_MAX_POLYGON_VERTS) {
+    lm2_sat2_manifold_capsule_to_polygon_f64(capsule, convex, out_manifold);
+    return;
+  }
+  c2Manifold m;
+  c2Poly poly = lm2_convex_polygon_f64_to_c2(convex);
+  c2CapsuletoPolyManifold(lm2_capsule2_f64_to_c2(capsule), &poly, NULL, &m);
+  c2_manifold_to_lm2_f64(m, out_manifold);
+}
+
+LM2_API void lm2_manifold_triangle_to_convex_polygon_f64(const lm2_triangle2_f64 tri, lm2_convex_polygon_f64 convex, lm2_manifold_f64* out_manifold) {
+  LM2_ASSERT(out_manifold != NULL);
+  if (!lm2_r2_overlaps_f64(_lm2_triangle_bounds_f64(tri), convex.bounds)) {
+    out_manifold->count = 0;
+    return;
+  }
+  if (convex.vertex_count > C2_MAX_POLYGON_VERTS) {
+    lm2_v2_f64 vertices[3];
+    lm2_v2_f64 normals[3];
+    lm2_sat2_manifold_polygon_to_polygon_f64(_lm2_triangle_to_convex_f64(tri, vertices, normals), convex, out_manifold);
+    return;
+  }
+  c2Manifold m;
+  c2Poly poly_tri = lm2_triangle2_f64_to_c2(tri);
+  c2Poly poly = lm2_convex_polygon_f64_to_c2(convex);
+  c2PolytoPolyManifold(&poly_tri, NULL, &poly, NULL, &m);
+  c2_manifold_to_lm2_f64(m, out_manifold);
+}
+
+LM2_API void lm2_manifold_convex_polygon_to_convex_polygon_f64(lm2_convex_polygon_f64 a, lm2_convex_polygon_f64 b, lm2_manifold_f64* out_manifold) {
+  LM2_ASSERT(out_manifold != NULL);
+  if (!lm2_r2_overlaps_f64(a.bounds, b.bounds)) {
+    out_manifold->count = 0;
+    return;
+  }
+  if (a.vertex_count > C2_MAX_POLYGON_VERTS || b.vertex_count > C2_MAX_POLYGON_VERTS) {
+    lm2_sat2_manifold_polygon_to_polygon_f64(a, b, out_manifold);
+    return;
+  }
+  c2Manifold m;
+  c2Poly poly_a = lm2_convex_polygon_f64_to_c2(a);
+  c2Poly poly_b = lm2_convex_polygon_f64_to_c2(b);
+  c2PolytoPolyManifold(&poly_a, NULL, &poly_b, NULL, &m);
+  c2_manifold_to_lm2_f64(m, out_manifold);
+}
+
+// =============================================================================
+// Convex Polygon Manifold Generation - f32
+// =============================================================================
+
+LM2_API void lm2_manifold_circle_to_convex_polygon_f32(lm2_circle_f32 circle, lm2_convex_polygon_f32 convex, lm2_manifold_f32* out_manifold) {
+  LM2_ASSERT(out_manifold != NULL);
+  if (!lm2_r2_overlaps_f32(_lm2_circle_bounds_f32(circle), convex.bounds)) {
+    out_manifold->count = 0;
+    return;
+  }
+  if (convex.vertex_count > C2_MAX_POLYGON_VERTS) {
+    lm2_sat2_manifold_circle_to_polygon_f32(circle, convex, out_manifold);
+    return;
+  }
+  c2Manifold m;
+  c2Poly poly = lm2_convex_polygon_f32_to_c2(convex);
+  c2CircletoPolyManifold(lm2_circle_f32_to_c2(circle), &poly, NULL, &m);
+  c2_manifold_to_lm2_f32(m, out_manifold);
+}
+
+LM2_API void lm2_manifold_aabb_to_convex_polygon_f32(lm2_r2_f32 aabb, lm2_convex_polygon_f32 convex, lm2_manifold_f32* out_manifold) {
+  LM2_ASSERT(out_manifold != NULL);
+  if (!lm2_r2_overlaps_f32(aabb, convex.bounds)) {
+    out_manifold->count = 0;
+    return;
+  }
+  if (convex.vertex_count > C2_MAX_POLYGON_VERTS) {
+    lm2_v2_f32 vertices[4];
+    lm2_v2_f32 normals[4];
+    lm2_sat2_manifold_polygon_to_polygon_f32(_lm2_aabb_to_convex_f32(aabb, vertices, normals), convex, out_manifold);
+    return;
+  }
+  c2Manifold m;
+  c2Poly poly = lm2_convex_polygon_f32_to_c2(convex);
+  c2AABBtoPolyManifold(lm2_r2_f32_to_c2(aabb), &poly, NULL, &m);
+  c2_manifold_to_lm2_f32(m, out_manifold);
+}
+
+LM2_API void lm2_manifold_capsule_to_convex_polygon_f32(lm2_capsule2_f32 capsule, lm2_convex_polygon_f32 convex, lm2_manifold_f32* out_manifold) {
   LM2_ASSERT(out_manifold != NULL);
+  if (!lm2_r2_overlaps_f32(_lm2_capsule_bounds_f32(capsule), convex.bounds)) {
+    out_manifold->count = 0;
+    return;
+  }
+  if (convex.vertex_count > C2_MAX_POLYGON_VERTS) {
+    lm2_sat2_manifold_capsule_to_polygon_f32(capsule, convex, out_manifold);
+    return;
+  }
+  c2Manifold m;
+  c2Poly poly = lm2_convex_polygon_f32_to_c2(convex);
+  c2CapsuletoPolyManifold(lm2_capsule2_f32_to_c2(capsule), &poly, NULL, &m);
+  c2_manifold_to_lm2_f32(m, out_manifold);
+}
+
+LM2_API void lm2_manifold_triangle_to_convex_polygon_f32(const lm2_triangle2_f32 tri, lm2_convex_polygon_f32 convex, lm2_manifold_f32* out_manifold) {
+  LM2_ASSERT(out_manifold != NULL);
+  if (!lm2_r2_overlaps_f32(_lm2_triangle_bounds_f32(tri), convex.bounds)) {
+    out_manifold->count = 0;
+    return;
+  }
+  if (convex.vertex_count > C2_MAX_POLYGON_VERTS) {
+    lm2_v2_f32 vertices[3];
+    lm2_v2_f32 normals[3];
+    lm2_sat2_manifold_polygon_to_polygon_f32(_lm2_triangle_to_convex_f32(tri, vertices, normals), convex, out_manifold);
+    return;
+  }
   c2Manifold m;
   c2Poly poly_tri = lm2_triangle2_f32_to_c2(tri);
-  c2Poly poly = lm2_polygon_f32_to_c2(polygon);
+  c2Poly poly = lm2_convex_polygon_f32_to_c2(convex);
   c2PolytoPolyManifold(&poly_tri, NULL, &poly, NULL, &m);
   c2_manifold_to_lm2_f32(m, out_manifold);
 }
 
+LM2_API void lm2_manifold_convex_polygon_to_convex_polygon_f32(lm2_convex_polygon_f32 a, lm2_convex_polygon_f32 b, lm2_manifold_f32* out_manifold) {
+  LM2_ASSERT(out_manifold != NULL);
+  if (!lm2_r2_overlaps_f32(a.bounds, b.bounds)) {
+    out_manifold->count = 0;
+    return;
+  }
+  if (a.vertex_count > C2_MAX_POLYGON_VERTS || b.vertex_count > C2_MAX_POLYGON_VERTS) {
+    lm2_sat2_manifold_polygon_to_polygon_f32(a, b, out_manifold);
+    return;
+  }
+  c2Manifold m;
+  c2Poly poly_a = lm2_convex_polygon_f32_to_c2(a);
+  c2Poly poly_b = lm2_convex_polygon_f32_to_c2(b);
+  c2PolytoPolyManifold(&poly_a, NULL, &poly_b, NULL, &m);
+  c2_manifold_to_lm2_f32(m, out_manifold);
+}
+
 // =============================================================================
 // Plane Manifold Generation - f64
 // =============================================================================
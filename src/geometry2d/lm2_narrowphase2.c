@@ -0,0 +1,178 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <lm2/geometry2d/lm2_narrowphase2.h>
+#include <lm2/vectors/lm2_vector2.h>
+#include "../misc/lm2_parallel.h"
+
+// Below this many pairs per range a worker thread costs more than it saves
+#define _LM2_NARROWPHASE2_MIN_RANGE 512
+
+#define _LM2_NARROWPHASE2_TYPES (LM2_SHAPE2_EDGE + 1)
+#define _LM2_NARROWPHASE2_BUCKETS (_LM2_NARROWPHASE2_TYPES * _LM2_NARROWPHASE2_TYPES)
+
+// =============================================================================
+// Bucket Kernels
+// =============================================================================
+// One loop per shape type combination. The calls and normal flips mirror
+// lm2_manifold_shape_to_shape exactly.
+
+#define _LM2_NARROWPHASE2_KERNEL(S, name, TA, TB, call, flip)                                                      \
+  static void _lm2_narrowphase2_##name##_##S(const _lm2_narrowphase2_batch_##S* batch, size_t begin, size_t end) { \
+    for (size_t i = begin; i < end; i++) {                                                                         \
+      uint32_t p = batch->order[i];                                                                                \
+      TA* a = (TA*)batch->shapes[batch->pairs[p].a].data;                                                          \
+      TB* b = (TB*)batch->shapes[batch->pairs[p].b].data;                                                          \
+      lm2_manifold_##S* m = &batch->out[p];                                                                        \
+      m->count = 0;                                                                                                \
+      call;                                                                                                        \
+      if (flip && m->count > 0) {                                                                                  \
+        m->normal = lm2_v2_mul_s_##S(m->normal, -1);                                                               \
+      }                                                                                                            \
+    }                                                                                                              \
+  }
+
+#define _LM2_IMPL_NARROWPHASE2(S)                                                                                                           \
+  typedef struct _lm2_narrowphase2_batch_##S {                                                                                              \
+    const lm2_shape2_##S* shapes;                                                                                                           \
+    const lm2_narrowphase2_pair* pairs;                                                                                                     \
+    const uint32_t* order;                                                                                                                  \
+    lm2_manifold_##S* out;                                                                                                                  \
+    size_t offsets[_LM2_NARROWPHASE2_BUCKETS + 1];                                                                                          \
+  } _lm2_narrowphase2_batch_##S;                                                                                                            \
+                                                                                                                                            \
+  typedef void (*_lm2_narrowphase2_kernel_##S)(const _lm2_narrowphase2_batch_##S* batch, size_t begin, size_t end);                         \
+                                                                                                                                            \
+  /* Edges have no manifold functions */                                                                                                    \
+  static void _lm2_narrowphase2_none_##S(const _lm2_narrowphase2_batch_##S* batch, size_t begin, size_t end) {                              \
+    for (size_t i = begin; i < end; i++) {                                                                                                  \
+      batch->out[batch->order[i]].count = 0;                                                                                                \
+    }                                                                                                                                       \
+  }                                                                                                                                         \
+                                                                                                                                            \
+  _LM2_NARROWPHASE2_KERNEL(S, circle_circle, lm2_circle_##S, lm2_circle_##S, lm2_manifold_circle_to_circle_##S(*a, *b, m), 0)               \
+  _LM2_NARROWPHASE2_KERNEL(S, circle_capsule, lm2_circle_##S, lm2_capsule2_##S, lm2_manifold_circle_to_capsule_##S(*a, *b, m), 0)           \
+  _LM2_NARROWPHASE2_KERNEL(S, circle_aabb, lm2_circle_##S, lm2_aabb2_##S, lm2_manifold_circle_to_aabb_##S(*a, *b, m), 0)                    \
+  _LM2_NARROWPHASE2_KERNEL(S, circle_triangle, lm2_circle_##S, lm2_triangle2_##S, lm2_manifold_triangle_to_circle_##S(*b, *a, m), 1)        \
+  _LM2_NARROWPHASE2_KERNEL(S, circle_polygon, lm2_circle_##S, lm2_polygon_##S, lm2_manifold_circle_to_polygon_##S(*a, *b, m), 0)            \
+  _LM2_NARROWPHASE2_KERNEL(S, capsule_circle, lm2_capsule2_##S, lm2_circle_##S, lm2_manifold_circle_to_capsule_##S(*b, *a, m), 1)           \
+  _LM2_NARROWPHASE2_KERNEL(S, capsule_capsule, lm2_capsule2_##S, lm2_capsule2_##S, lm2_manifold_capsule_to_capsule_##S(*a, *b, m), 0)       \
+  _LM2_NARROWPHASE2_KERNEL(S, capsule_aabb, lm2_capsule2_##S, lm2_aabb2_##S, lm2_manifold_aabb_to_capsule_##S(*b, *a, m), 1)                \
+  _LM2_NARROWPHASE2_KERNEL(S, capsule_triangle, lm2_capsule2_##S, lm2_triangle2_##S, lm2_manifold_triangle_to_capsule_##S(*b, *a, m), 1)    \
+  _LM2_NARROWPHASE2_KERNEL(S, capsule_polygon, lm2_capsule2_##S, lm2_polygon_##S, lm2_manifold_capsule_to_polygon_##S(*a, *b, m), 0)        \
+  _LM2_NARROWPHASE2_KERNEL(S, aabb_circle, lm2_aabb2_##S, lm2_circle_##S, lm2_manifold_circle_to_aabb_##S(*b, *a, m), 1)                    \
+  _LM2_NARROWPHASE2_KERNEL(S, aabb_capsule, lm2_aabb2_##S, lm2_capsule2_##S, lm2_manifold_aabb_to_capsule_##S(*a, *b, m), 0)                \
+  _LM2_NARROWPHASE2_KERNEL(S, aabb_aabb, lm2_aabb2_##S, lm2_aabb2_##S, lm2_manifold_aabb_to_aabb_##S(*a, *b, m), 0)                         \
+  _LM2_NARROWPHASE2_KERNEL(S, aabb_triangle, lm2_aabb2_##S, lm2_triangle2_##S, lm2_manifold_triangle_to_aabb_##S(*b, *a, m), 1)             \
+  _LM2_NARROWPHASE2_KERNEL(S, aabb_polygon, lm2_aabb2_##S, lm2_polygon_##S, lm2_manifold_aabb_to_polygon_##S(*a, *b, m), 0)                 \
+  _LM2_NARROWPHASE2_KERNEL(S, triangle_circle, lm2_triangle2_##S, lm2_circle_##S, lm2_manifold_triangle_to_circle_##S(*a, *b, m), 0)        \
+  _LM2_NARROWPHASE2_KERNEL(S, triangle_capsule, lm2_triangle2_##S, lm2_capsule2_##S, lm2_manifold_triangle_to_capsule_##S(*a, *b, m), 0)    \
+  _LM2_NARROWPHASE2_KERNEL(S, triangle_aabb, lm2_triangle2_##S, lm2_aabb2_##S, lm2_manifold_triangle_to_aabb_##S(*a, *b, m), 0)             \
+  _LM2_NARROWPHASE2_KERNEL(S, triangle_triangle, lm2_triangle2_##S, lm2_triangle2_##S, lm2_manifold_triangle_to_triangle_##S(*a, *b, m), 0) \
+  _LM2_NARROWPHASE2_KERNEL(S, triangle_polygon, lm2_triangle2_##S, lm2_polygon_##S, lm2_manifold_triangle_to_polygon_##S(*a, *b, m), 0)     \
+  _LM2_NARROWPHASE2_KERNEL(S, polygon_circle, lm2_polygon_##S, lm2_circle_##S, lm2_manifold_circle_to_polygon_##S(*b, *a, m), 1)            \
+  _LM2_NARROWPHASE2_KERNEL(S, polygon_capsule, lm2_polygon_##S, lm2_capsule2_##S, lm2_manifold_capsule_to_polygon_##S(*b, *a, m), 1)        \
+  _LM2_NARROWPHASE2_KERNEL(S, polygon_aabb, lm2_polygon_##S, lm2_aabb2_##S, lm2_manifold_aabb_to_polygon_##S(*b, *a, m), 1)                 \
+  _LM2_NARROWPHASE2_KERNEL(S, polygon_triangle, lm2_polygon_##S, lm2_triangle2_##S, lm2_manifold_triangle_to_polygon_##S(*b, *a, m), 1)     \
+  _LM2_NARROWPHASE2_KERNEL(S, polygon_polygon, lm2_polygon_##S, lm2_polygon_##S, lm2_manifold_polygon_to_polygon_##S(*a, *b, m), 0)         \
+                                                                                                                                            \
+  /* Indexed by type_a * _LM2_NARROWPHASE2_TYPES + type_b, in lm2_shape2_type order */                                                      \
+  static const _lm2_narrowphase2_kernel_##S _lm2_narrowphase2_kernels_##S[_LM2_NARROWPHASE2_BUCKETS] = {                                    \
+      _lm2_narrowphase2_circle_circle_##S, _lm2_narrowphase2_circle_capsule_##S, _lm2_narrowphase2_circle_aabb_##S,                         \
+      _lm2_narrowphase2_circle_triangle_##S, _lm2_narrowphase2_circle_polygon_##S, _lm2_narrowphase2_none_##S,                              \
+      _lm2_narrowphase2_capsule_circle_##S, _lm2_narrowphase2_capsule_capsule_##S, _lm2_narrowphase2_capsule_aabb_##S,                      \
+      _lm2_narrowphase2_capsule_triangle_##S, _lm2_narrowphase2_capsule_polygon_##S, _lm2_narrowphase2_none_##S,                            \
+      _lm2_narrowphase2_aabb_circle_##S, _lm2_narrowphase2_aabb_capsule_##S, _lm2_narrowphase2_aabb_aabb_##S,                               \
+      _lm2_narrowphase2_aabb_triangle_##S, _lm2_narrowphase2_aabb_polygon_##S, _lm2_narrowphase2_none_##S,                                  \
+      _lm2_narrowphase2_triangle_circle_##S, _lm2_narrowphase2_triangle_capsule_##S, _lm2_narrowphase2_triangle_aabb_##S,                   \
+      _lm2_narrowphase2_triangle_triangle_##S, _lm2_narrowphase2_triangle_polygon_##S, _lm2_narrowphase2_none_##S,                          \
+      _lm2_narrowphase2_polygon_circle_##S, _lm2_narrowphase2_polygon_capsule_##S, _lm2_narrowphase2_polygon_aabb_##S,                      \
+      _lm2_narrowphase2_polygon_triangle_##S, _lm2_narrowphase2_polygon_polygon_##S, _lm2_narrowphase2_none_##S,                            \
+      _lm2_narrowphase2_none_##S, _lm2_narrowphase2_none_##S, _lm2_narrowphase2_none_##S,                                                   \
+      _lm2_narrowphase2_none_##S, _lm2_narrowphase2_none_##S, _lm2_narrowphase2_none_##S,                                                   \
+  };                                                                                                                                        \
+                                                                                                                                            \
+  static inline size_t _lm2_narrowphase2_bucket_##S(const lm2_shape2_##S* shapes, lm2_narrowphase2_pair pair) {                             \
+    return (size_t)shapes[pair.a].type * _LM2_NARROWPHASE2_TYPES + (size_t)shapes[pair.b].type;                                             \
+  }                                                                                                                                         \
+                                                                                                                                            \
+  /* Runs the slice [begin, end) of the sorted order, one kernel call per bucket it overlaps */                                             \
+  static void _lm2_narrowphase2_task_##S(void* context, size_t begin, size_t end) {                                                         \
+    const _lm2_narrowphase2_batch_##S* batch = (const _lm2_narrowphase2_batch_##S*)context;                                                 \
+    for (size_t k = 0; k < _LM2_NARROWPHASE2_BUCKETS && begin < end; k++) {                                                                 \
+      size_t bucket_end = batch->offsets[k + 1];                                                                                            \
+      if (bucket_end <= begin) {                                                                                                            \
+        continue;                                                                                                                           \
+      }                                                                                                                                     \
+      size_t stop = bucket_end < end ? bucket_end : end;                                                                                    \
+      _lm2_narrowphase2_kernels_##S[k](batch, begin, stop);                                                                                 \
+      begin = stop;                                                                                                                         \
+    }                                                                                                                                       \
+  }                                                                                                                                         \
+                                                                                                                                            \
+  LM2_API size_t lm2_narrowphase2_collide_##S(const lm2_shape2_##S* shapes, const lm2_narrowphase2_pair* pairs, size_t pair_count,          \
+                                              uint32_t* order_buffer, lm2_manifold_##S* out_manifolds, uint32_t* out_pair_indices,          \
+                                              uint32_t thread_count) {                                                                      \
+    LM2_ASSERT(pair_count == 0 || (shapes != NULL && pairs != NULL && order_buffer != NULL && out_manifolds != NULL));                      \
+    LM2_ASSERT(pair_count <= UINT32_MAX);                                                                                                   \
+    _lm2_narrowphase2_batch_##S batch;                                                                                                      \
+    batch.shapes = shapes;                                                                                                                  \
+    batch.pairs = pairs;                                                                                                                    \
+    batch.order = order_buffer;                                                                                                             \
+    batch.out = out_manifolds;                                                                                                              \
+                                                                                                                                            \
+    /* Counting sort of the pair indices by bucket */                                                                                       \
+    size_t counts[_LM2_NARROWPHASE2_BUCKETS] = {0};                                                                                         \
+    for (size_t i = 0; i < pair_count; i++) {                                                                                               \
+      counts[_lm2_narrowphase2_bucket_##S(shapes, pairs[i])]++;                                                                             \
+    }                                                                                                                                       \
+    batch.offsets[0] = 0;                                                                                                                   \
+    for (size_t k = 0; k < _LM2_NARROWPHASE2_BUCKETS; k++) {                                                                                \
+      batch.offsets[k + 1] = batch.offsets[k] + counts[k];                                                                                  \
+      counts[k] = batch.offsets[k];                                                                                                         \
+    }                                                                                                                                       \
+    for (size_t i = 0; i < pair_count; i++) {                                                                                               \
+      order_buffer[counts[_lm2_narrowphase2_bucket_##S(shapes, pairs[i])]++] = (uint32_t)i;                                                 \
+    }                                                                                                                                       \
+                                                                                                                                            \
+    /* Manifolds land at their pair index, then the touching ones are compacted in pair order */                                            \
+    lm2_parallel_for(pair_count, _LM2_NARROWPHASE2_MIN_RANGE, thread_count, _lm2_narrowphase2_task_##S, &batch);                            \
+    size_t touching = 0;                                                                                                                    \
+    for (size_t i = 0; i < pair_count; i++) {                                                                                               \
+      if (out_manifolds[i].count <= 0) {                                                                                                    \
+        continue;                                                                                                                           \
+      }                                                                                                                                     \
+      if (touching != i) {                                                                                                                  \
+        out_manifolds[touching] = out_manifolds[i];                                                                                         \
+      }                                                                                                                                     \
+      if (out_pair_indices != NULL) {                                                                                                       \
+        out_pair_indices[touching] = (uint32_t)i;                                                                                           \
+      }                                                                                                                                     \
+      touching++;                                                                                                                           \
+    }                                                                                                                                       \
+    return touching;                                                                                                                        \
+  }
+
+_LM2_IMPL_NARROWPHASE2(f64)
+_LM2_IMPL_NARROWPHASE2(f32)
@@ -34,6 +34,7 @@ SOFTWARE.
 #include <lm2/vectors/lm2_vector2.h>
 #include <lm2/vectors/lm2_vector_specifics.h>
 #include <stdlib.h>
+#include "../misc/lm2_scratch.h"
 
 // =============================================================================
 // Construction Helpers
@@ -466,62 +467,7 @@ LM2_API bool lm2_polygon_is_convex_f32(lm2_polygon_f32 polygon) {
   return true;
 }
 
-// Helper function to check if two line segments intersect
-// replaced by lm2_segments_intersect_f64 / lm2_segments_intersect_f32
-
-LM2_API bool lm2_polygon_is_simple_f64(lm2_polygon_f64 polygon) {
-  LM2_ASSERT(polygon.vertices != NULL);
-  LM2_ASSERT(polygon.vertex_count >= 3);
-
-  // Check if any non-adjacent edges intersect
-  for (size_t i = 0; i < polygon.vertex_count; i++) {
-    size_t j = (i + 1) % polygon.vertex_count;
-    lm2_v2_f64 a1 = polygon.vertices[i];
-    lm2_v2_f64 a2 = polygon.vertices[j];
-
-    for (size_t k = i + 2; k < polygon.vertex_count; k++) {
-      // Skip adjacent edges
-      if (k == j || (i == 0 && k == polygon.vertex_count - 1)) continue;
-
-      size_t l = (k + 1) % polygon.vertex_count;
-      lm2_v2_f64 b1 = polygon.vertices[k];
-      lm2_v2_f64 b2 = polygon.vertices[l];
-
-      if (lm2_segments_intersect_f64(a1, a2, b1, b2)) {
-        return false;
-      }
-    }
-  }
-
-  return true;
-}
-
-LM2_API bool lm2_polygon_is_simple_f32(lm2_polygon_f32 polygon) {
-  LM2_ASSERT(polygon.vertices != NULL);
-  LM2_ASSERT(polygon.vertex_count >= 3);
-
-  // Check if any non-adjacent edges intersect
-  for (size_t i = 0; i < polygon.vertex_count; i++) {
-    size_t j = (i + 1) % polygon.vertex_count;
-    lm2_v2_f32 a1 = polygon.vertices[i];
-    lm2_v2_f32 a2 = polygon.vertices[j];
-
-    for (size_t k = i + 2; k < polygon.vertex_count; k++) {
-      // Skip adjacent edges
-      if (k == j || (i == 0 && k == polygon.vertex_count - 1)) continue;
-
-      size_t l = (k + 1) % polygon.vertex_count;
-      lm2_v2_f32 b1 = polygon.vertices[k];
-      lm2_v2_f32 b2 = polygon.vertices[l];
-
-      if (lm2_segments_intersect_f32(a1, a2, b1, b2)) {
-        return false;
-      }
-    }
-  }
-
-  return true;
-}
+// lm2_polygon_is_simple lives in lm2_polygon_simple.c
 
 LM2_API bool lm2_polygon_is_triangle_f64(lm2_polygon_f64 polygon) {
   return polygon.vertex_count == 3;
@@ -712,160 +658,177 @@ LM2_API void lm2_polygon_place_at_center_f32(lm2_polygon_f32 polygon, lm2_v2_f32
 }
 
 // =============================================================================
-// Polygon Triangulation
+// Convex Polygon Preparation
 // =============================================================================
 
-LM2_API size_t lm2_polygon_max_triangle_count(size_t vertex_count) {
-  LM2_ASSERT(vertex_count >= 3);
-  return vertex_count - 2;
+LM2_API lm2_convex_polygon_f64 lm2_convex_polygon_make_f64(lm2_polygon_f64 polygon, lm2_v2_f64* out_normals) {
+  LM2_ASSERT(polygon.vertices != NULL);
+  LM2_ASSERT(out_normals != NULL);
+  lm2_convex_polygon_f64 convex;
+  convex.vertices = polygon.vertices;
+  convex.normals = out_normals;
+  convex.vertex_count = polygon.vertex_count;
+  lm2_convex_polygon_refresh_f64(&convex);
+  return convex;
+}
+
+LM2_API lm2_convex_polygon_f32 lm2_convex_polygon_make_f32(lm2_polygon_f32 polygon, lm2_v2_f32* out_normals) {
+  LM2_ASSERT(polygon.vertices != NULL);
+  LM2_ASSERT(out_normals != NULL);
+  lm2_convex_polygon_f32 convex;
+  convex.vertices = polygon.vertices;
+  convex.normals = out_normals;
+  convex.vertex_count = polygon.vertex_count;
+  lm2_convex_polygon_refresh_f32(&convex);
+  return convex;
 }
 
-// Helper function to check if a triangle at indices (i, j, k) is an ear
-static bool is_ear_f64(const lm2_v2_f64* vertices, const size_t* indices, size_t n, size_t i, size_t j, size_t k) {
-  lm2_v2_f64 a = vertices[indices[i]];
-  lm2_v2_f64 b = vertices[indices[j]];
-  lm2_v2_f64 c = vertices[indices[k]];
-  lm2_triangle2_f64 tri = {a, b, c};
+LM2_API void lm2_convex_polygon_refresh_f64(lm2_convex_polygon_f64* convex) {
+  LM2_ASSERT(convex != NULL);
+  LM2_ASSERT(convex->vertices != NULL && convex->normals != NULL);
 
-  // Check if triangle is convex
-  if (lm2_v2_cross3_f64(a, b, c) < 0.0) {
-    return false;
+  size_t n = convex->vertex_count;
+  if (n == 0) {
+    convex->bounds = lm2_r2_zero_f64();
+    return;
   }
 
-  // Check if any other vertex is inside this triangle
-  for (size_t m = 0; m < n; m++) {
-    if (m == i || m == j || m == k) continue;
-    if (lm2_triangle2_contains_point_f64(tri, vertices[indices[m]])) {
-      return false;
-    }
+  lm2_r2_f64 bounds;
+  bounds.min = convex->vertices[0];
+  bounds.max = convex->vertices[0];
+
+  for (size_t i = 0; i < n; i++) {
+    lm2_v2_f64 a = convex->vertices[i];
+    lm2_v2_f64 b = convex->vertices[(i + 1 < n) ? i + 1 : 0];
+    lm2_v2_f64 edge = lm2_v2_sub_f64(b, a);
+
+    // Outward normal for CCW winding: edge rotated clockwise by 90 degrees
+    convex->normals[i] = lm2_v2_norm_f64((lm2_v2_f64) {edge.y, -edge.x});
+
+    bounds.min.x = lm2_min_f64(bounds.min.x, a.x);
+    bounds.min.y = lm2_min_f64(bounds.min.y, a.y);
+    bounds.max.x = lm2_max_f64(bounds.max.x, a.x);
+    bounds.max.y = lm2_max_f64(bounds.max.y, a.y);
   }
 
-  return true;
+  convex->bounds = bounds;
 }
 
-static bool is_ear_f32(const lm2_v2_f32* vertices, const size_t* indices, size_t n, size_t i, size_t j, size_t k) {
-  lm2_v2_f32 a = vertices[indices[i]];
-  lm2_v2_f32 b = vertices[indices[j]];
-  lm2_v2_f32 c = vertices[indices[k]];
-  lm2_triangle2_f32 tri = {a, b, c};
+LM2_API void lm2_convex_polygon_refresh_f32(lm2_convex_polygon_f32* convex) {
+  LM2_ASSERT(convex != NULL);
+  LM2_ASSERT(convex->vertices != NULL && convex->normals != NULL);
 
-  // Check if triangle is convex
-  if (lm2_v2_cross3_f32(a, b, c) < 0.0f) {
-    return false;
+  size_t n = convex->vertex_count;
+  if (n == 0) {
+    convex->bounds = lm2_r2_zero_f32();
+    return;
   }
 
-  // Check if any other vertex is inside this triangle
-  for (size_t m = 0; m < n; m++) {
-    if (m == i || m == j || m == k) continue;
-    if (lm2_triangle2_contains_point_f32(tri, vertices[indices[m]])) {
-      return false;
-    }
-  }
+  lm2_r2_f32 bounds;
+  bounds.min = convex->vertices[0];
+  bounds.max = convex->vertices[0];
 
-  return true;
-}
+  for (size_t i = 0; i < n; i++) {
+    lm2_v2_f32 a = convex->vertices[i];
+    lm2_v2_f32 b = convex->vertices[(i + 1 < n) ? i + 1 : 0];
+    lm2_v2_f32 edge = lm2_v2_sub_f32(b, a);
 
-LM2_API size_t lm2_polygon_triangulate_ear_clipping_f64(lm2_polygon_f64 polygon, size_t* out_indices) {
-  LM2_ASSERT(polygon.vertices != NULL);
-  LM2_ASSERT(polygon.vertex_count >= 3);
-  LM2_ASSERT(out_indices != NULL);
+    // Outward normal for CCW winding: edge rotated clockwise by 90 degrees
+    convex->normals[i] = lm2_v2_norm_f32((lm2_v2_f32) {edge.y, -edge.x});
 
-  size_t n = polygon.vertex_count;
-  size_t triangle_count = 0;
+    bounds.min.x = lm2_min_f32(bounds.min.x, a.x);
+    bounds.min.y = lm2_min_f32(bounds.min.y, a.y);
+    bounds.max.x = lm2_max_f32(bounds.max.x, a.x);
+    bounds.max.y = lm2_max_f32(bounds.max.y, a.y);
+  }
 
-  // Create working array of vertex indices (heap allocation for MSVC compatibility)
-  size_t* indices = (size_t*)malloc(n * sizeof(size_t));
-  if (indices == NULL) {
-    return 0;
+  convex->bounds = bounds;
+}
+
+LM2_API void lm2_convex_polygon_translate_f64(lm2_convex_polygon_f64* convex, lm2_v2_f64 offset) {
+  LM2_ASSERT(convex != NULL);
+  LM2_ASSERT(convex->vertices != NULL);
+  for (size_t i = 0; i < convex->vertex_count; i++) {
+    convex->vertices[i] = lm2_v2_add_f64(convex->vertices[i], offset);
   }
-  for (size_t i = 0; i < n; i++) {
-    indices[i] = i;
-  }
-
-  // Triangulate
-  while (n > 2) {
-    bool ear_found = false;
-
-    for (size_t i = 0; i < n; i++) {
-      size_t prev = (i == 0) ? (n - 1) : (i - 1);
-      size_t next = (i + 1) % n;
-
-      if (is_ear_f64(polygon.vertices, indices, n, prev, i, next)) {
-        // Output triangle
-        out_indices[triangle_count * 3 + 0] = indices[prev];
-        out_indices[triangle_count * 3 + 1] = indices[i];
-        out_indices[triangle_count * 3 + 2] = indices[next];
-        triangle_count++;
-
-        // Remove vertex i from the list
-        for (size_t j = i; j < n - 1; j++) {
-          indices[j] = indices[j + 1];
-        }
-        n--;
-        ear_found = true;
-        break;
-      }
-    }
+  convex->bounds.min = lm2_v2_add_f64(convex->bounds.min, offset);
+  convex->bounds.max = lm2_v2_add_f64(convex->bounds.max, offset);
+}
 
-    // If no ear found, break to avoid infinite loop
-    if (!ear_found) {
-      break;
-    }
+LM2_API void lm2_convex_polygon_translate_f32(lm2_convex_polygon_f32* convex, lm2_v2_f32 offset) {
+  LM2_ASSERT(convex != NULL);
+  LM2_ASSERT(convex->vertices != NULL);
+  for (size_t i = 0; i < convex->vertex_count; i++) {
+    convex->vertices[i] = lm2_v2_add_f32(convex->vertices[i], offset);
   }
+  convex->bounds.min = lm2_v2_add_f32(convex->bounds.min, offset);
+  convex->bounds.max = lm2_v2_add_f32(convex->bounds.max, offset);
+}
 
-  return triangle_count;
+LM2_API lm2_polygon_f64 lm2_convex_polygon_as_polygon_f64(lm2_convex_polygon_f64 convex) {
+  lm2_polygon_f64 polygon;
+  polygon.vertices = convex.vertices;
+  polygon.vertex_count = convex.vertex_count;
+  return polygon;
 }
 
-LM2_API size_t lm2_polygon_triangulate_ear_clipping_f32(lm2_polygon_f32 polygon, size_t* out_indices) {
-  LM2_ASSERT(polygon.vertices != NULL);
-  LM2_ASSERT(polygon.vertex_count >= 3);
-  LM2_ASSERT(out_indices != NULL);
+LM2_API lm2_polygon_f32 lm2_convex_polygon_as_polygon_f32(lm2_convex_polygon_f32 convex) {
+  lm2_polygon_f32 polygon;
+  polygon.vertices = convex.vertices;
+  polygon.vertex_count = convex.vertex_count;
+  return polygon;
+}
 
-  size_t n = polygon.vertex_count;
-  size_t triangle_count = 0;
+// =============================================================================
+// Polygon Triangulation
+// =============================================================================
 
-  // Create working array of vertex indices (heap allocation for MSVC compatibility)
-  size_t* indices = (size_t*)malloc(n * sizeof(size_t));
-  if (indices == NULL) {
-    return 0;
-  }
-  for (size_t i = 0; i < n; i++) {
-    indices[i] = i;
-  }
-
-  // Triangulate
-  while (n > 2) {
-    bool ear_found = false;
-
-    for (size_t i = 0; i < n; i++) {
-      size_t prev = (i == 0) ? (n - 1) : (i - 1);
-      size_t next = (i + 1) % n;
-
-      if (is_ear_f32(polygon.vertices, indices, n, prev, i, next)) {
-        // Output triangle
-        out_indices[triangle_count * 3 + 0] = indices[prev];
-        out_indices[triangle_count * 3 + 1] = indices[i];
-        out_indices[triangle_count * 3 + 2] = indices[next];
-        triangle_count++;
-
-        // Remove vertex i from the list
-        for (size_t j = i; j < n - 1; j++) {
-          indices[j] = indices[j + 1];
-        }
-        n--;
-        ear_found = true;
-        break;
-      }
-    }
+LM2_API size_t lm2_polygon_max_triangle_count(size_t vertex_count) {
+  LM2_ASSERT(vertex_count >= 3);
+  return vertex_count - 2;
+}
 
-    // If no ear found, break to avoid infinite loop
-    if (!ear_found) {
-      break;
-    }
-  }
+// Ear clipping forwards to the earcut triangulator in lm2_polygon_triangulate.c
+LM2_API size_t lm2_polygon_triangulate_ear_clipping_f64(lm2_polygon_f64 polygon, size_t* out_indices) {
+  return lm2_polygon_triangulate_f64(polygon, NULL, 0, NULL, 0, out_indices);
+}
 
-  free(indices);
-  return triangle_count;
+LM2_API size_t lm2_polygon_triangulate_ear_clipping_f32(lm2_polygon_f32 polygon, size_t* out_indices) {
+  return lm2_polygon_triangulate_f32(polygon, NULL, 0, NULL, 0, out_indices);
+}
+
+LM2_API size_t lm2_polygon_triangulate_ear_clipping_scratch_f64(
+    lm2_polygon_f64 polygon,
+    size_t* out_indices,
+    lm2_arena* arena) {
+  LM2_ASSERT(polygon.vertex_count >= 3);
+  size_t mark = lm2_scratch_begin(arena);
+  size_t scratch_size = lm2_polygon_triangulate_scratch_size_f64(polygon.vertex_count, 0);
+  void* scratch = lm2_scratch_alloc(arena, scratch_size);
+  size_t count = 0;
+  if (scratch != NULL) {
+    count = lm2_polygon_triangulate_f64(polygon, NULL, 0, scratch, scratch_size, out_indices);
+  }
+  lm2_scratch_free(arena, scratch);
+  lm2_scratch_end(arena, mark);
+  return count;
+}
+
+LM2_API size_t lm2_polygon_triangulate_ear_clipping_scratch_f32(
+    lm2_polygon_f32 polygon,
+    size_t* out_indices,
+    lm2_arena* arena) {
+  LM2_ASSERT(polygon.vertex_count >= 3);
+  size_t mark = lm2_scratch_begin(arena);
+  size_t scratch_size = lm2_polygon_triangulate_scratch_size_f32(polygon.vertex_count, 0);
+  void* scratch = lm2_scratch_alloc(arena, scratch_size);
+  size_t count = 0;
+  if (scratch != NULL) {
+    count = lm2_polygon_triangulate_f32(polygon, NULL, 0, scratch, scratch_size, out_indices);
+  }
+  lm2_scratch_free(arena, scratch);
+  lm2_scratch_end(arena, mark);
+  return count;
 }
 
 // =============================================================================
@@ -0,0 +1,325 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <lm2/geometry2d/lm2_edge2.h>
+#include <lm2/geometry2d/lm2_polygon.h>
+#include <lm2/vectors/lm2_vector_specifics.h>
+#include <stdlib.h>  // For qsort
+#include "../misc/lm2_scratch.h"
+
+// =============================================================================
+// Polygon Simplicity (Shamos-Hoey sweep)
+// =============================================================================
+// A vertical line sweeps the edges from left to right. The edges it currently
+// crosses are kept ordered by height in a treap, and only edges that become
+// neighbours in that order are tested against each other. If two edges
+// intersect, some pair of them is tested before the sweep passes the leftmost
+// intersection, so the first hit ends the sweep: O(n log n) instead of testing
+// all n^2 / 2 pairs.
+//
+// Edges that share a vertex in the ring are never reported, like the pairwise
+// test this replaces, and the hit test is lm2_edge2_segments_intersect, so
+// touching and collinear overlaps count. Every event at one point inserts
+// before it removes, which puts edges that only touch there next to each
+// other at least once.
+//
+// Two shapes are rejected before the sweep, because they would put a third
+// edge between two edges that touch. One is a repeated vertex, whose
+// zero-length edge sits between the edges that meet there. The other is a
+// spike, where the ring doubles back along its last edge; the far end of the
+// shorter of the two edges then touches the edge two steps away.
+
+// Below this vertex count the pairwise test is faster than sorting events
+#define _LM2_POLYGON_SIMPLE_SWEEP_MIN 32
+
+#define _LM2_SWEEP_NONE (-1)
+
+// Treap over the edges crossing the sweep line, with the in-order neighbours
+// of every node linked directly. Node i is edge i.
+typedef struct _lm2_sweep_status {
+  int32_t* left;
+  int32_t* right;
+  int32_t* parent;
+  int32_t* prev;
+  int32_t* next;
+  int32_t root;
+} _lm2_sweep_status;
+
+static inline uint32_t _lm2_sweep_priority(int32_t node) {
+  uint32_t h = (uint32_t)node * 0x9E3779B1u;
+  h ^= h >> 16;
+  h *= 0x85EBCA6Bu;
+  h ^= h >> 13;
+  return h;
+}
+
+static void _lm2_sweep_rotate_up(_lm2_sweep_status* st, int32_t x) {
+  int32_t p = st->parent[x];
+  int32_t g = st->parent[p];
+  if (st->left[p] == x) {
+    st->left[p] = st->right[x];
+    if (st->right[x] != _LM2_SWEEP_NONE) {
+      st->parent[st->right[x]] = p;
+    }
+    st->right[x] = p;
+  } else {
+    st->right[p] = st->left[x];
+    if (st->left[x] != _LM2_SWEEP_NONE) {
+      st->parent[st->left[x]] = p;
+    }
+    st->left[x] = p;
+  }
+  st->parent[p] = x;
+  st->parent[x] = g;
+  if (g == _LM2_SWEEP_NONE) {
+    st->root = x;
+  } else if (st->left[g] == p) {
+    st->left[g] = x;
+  } else {
+    st->right[g] = x;
+  }
+}
+
+// Link node x as a child of parent (or as the root), between pred and succ
+static void _lm2_sweep_insert(_lm2_sweep_status* st, int32_t x, int32_t parent, bool as_left, int32_t pred, int32_t succ) {
+  st->left[x] = _LM2_SWEEP_NONE;
+  st->right[x] = _LM2_SWEEP_NONE;
+  st->parent[x] = parent;
+  if (parent == _LM2_SWEEP_NONE) {
+    st->root = x;
+  } else if (as_left) {
+    st->left[parent] = x;
+  } else {
+    st->right[parent] = x;
+  }
+  st->prev[x] = pred;
+  st->next[x] = succ;
+  if (pred != _LM2_SWEEP_NONE) {
+    st->next[pred] = x;
+  }
+  if (succ != _LM2_SWEEP_NONE) {
+    st->prev[succ] = x;
+  }
+  uint32_t priority = _lm2_sweep_priority(x);
+  while (st->parent[x] != _LM2_SWEEP_NONE && _lm2_sweep_priority(st->parent[x]) < priority) {
+    _lm2_sweep_rotate_up(st, x);
+  }
+}
+
+static void _lm2_sweep_remove(_lm2_sweep_status* st, int32_t x) {
+  while (st->left[x] != _LM2_SWEEP_NONE || st->right[x] != _LM2_SWEEP_NONE) {
+    int32_t l = st->left[x];
+    int32_t r = st->right[x];
+    int32_t c = r;
+    if (r == _LM2_SWEEP_NONE || (l != _LM2_SWEEP_NONE && _lm2_sweep_priority(l) > _lm2_sweep_priority(r))) {
+      c = l;
+    }
+    _lm2_sweep_rotate_up(st, c);
+  }
+  int32_t p = st->parent[x];
+  if (p == _LM2_SWEEP_NONE) {
+    st->root = _LM2_SWEEP_NONE;
+  } else if (st->left[p] == x) {
+    st->left[p] = _LM2_SWEEP_NONE;
+  } else {
+    st->right[p] = _LM2_SWEEP_NONE;
+  }
+  if (st->prev[x] != _LM2_SWEEP_NONE) {
+    st->next[st->prev[x]] = st->next[x];
+  }
+  if (st->next[x] != _LM2_SWEEP_NONE) {
+    st->prev[st->next[x]] = st->prev[x];
+  }
+}
+
+static inline bool _lm2_sweep_ring_adjacent(int32_t a, int32_t b, size_t n) {
+  size_t i = (size_t)a;
+  size_t j = (size_t)b;
+  return i == j || i + 1 == j || j + 1 == i || (i == 0 && j == n - 1) || (j == 0 && i == n - 1);
+}
+
+#define _LM2_IMPL_POLYGON_IS_SIMPLE(scalar_type, S)                                                                   \
+  /* Edge i runs from lo[i] to hi[i], its lexicographically smaller and larger endpoints */                           \
+  typedef struct _lm2_sweep_event_##S {                                                                               \
+    scalar_type x;                                                                                                    \
+    scalar_type y;                                                                                                    \
+    uint32_t id; /* edge * 2, +1 for the removal at hi */                                                             \
+  } _lm2_sweep_event_##S;                                                                                             \
+                                                                                                                      \
+  static int _lm2_sweep_event_compare_##S(const void* a, const void* b) {                                             \
+    const _lm2_sweep_event_##S* ea = (const _lm2_sweep_event_##S*)a;                                                  \
+    const _lm2_sweep_event_##S* eb = (const _lm2_sweep_event_##S*)b;                                                  \
+    if (ea->x != eb->x) {                                                                                             \
+      return ea->x < eb->x ? -1 : 1;                                                                                  \
+    }                                                                                                                 \
+    if (ea->y != eb->y) {                                                                                             \
+      return ea->y < eb->y ? -1 : 1;                                                                                  \
+    }                                                                                                                 \
+    if ((ea->id & 1u) != (eb->id & 1u)) {                                                                             \
+      return (ea->id & 1u) ? 1 : -1;                                                                                  \
+    }                                                                                                                 \
+    return ea->id < eb->id ? -1 : (ea->id > eb->id ? 1 : 0);                                                          \
+  }                                                                                                                   \
+                                                                                                                      \
+  static inline bool _lm2_sweep_lex_less_##S(lm2_v2_##S a, lm2_v2_##S b) {                                            \
+    return a.x < b.x || (a.x == b.x && a.y < b.y);                                                                    \
+  }                                                                                                                   \
+                                                                                                                      \
+  static bool _lm2_polygon_is_simple_pairwise_##S(lm2_polygon_##S polygon) {                                          \
+    size_t n = polygon.vertex_count;                                                                                  \
+    for (size_t i = 0; i < n; i++) {                                                                                  \
+      lm2_v2_##S a1 = polygon.vertices[i];                                                                            \
+      lm2_v2_##S a2 = polygon.vertices[(i + 1) % n];                                                                  \
+      for (size_t k = i + 2; k < n; k++) {                                                                            \
+        if (i == 0 && k == n - 1) {                                                                                   \
+          continue;                                                                                                   \
+        }                                                                                                             \
+        lm2_v2_##S b1 = polygon.vertices[k];                                                                          \
+        lm2_v2_##S b2 = polygon.vertices[(k + 1) % n];                                                                \
+        if (lm2_edge2_segments_intersect_##S(a1, a2, b1, b2)) {                                                       \
+          return false;                                                                                               \
+        }                                                                                                             \
+      }                                                                                                               \
+    }                                                                                                                 \
+    return true;                                                                                                      \
+  }                                                                                                                   \
+                                                                                                                      \
+  /* Non-adjacent edges a and b intersect */                                                                          \
+  static inline bool _lm2_sweep_hit_##S(const lm2_v2_##S* lo, const lm2_v2_##S* hi, int32_t a, int32_t b, size_t n) { \
+    return a != _LM2_SWEEP_NONE && b != _LM2_SWEEP_NONE && !_lm2_sweep_ring_adjacent(a, b, n) &&                      \
+           lm2_edge2_segments_intersect_##S(lo[a], hi[a], lo[b], hi[b]);                                              \
+  }                                                                                                                   \
+                                                                                                                      \
+  LM2_API bool lm2_polygon_is_simple_##S(lm2_polygon_##S polygon) {                                                   \
+    LM2_ASSERT(polygon.vertices != NULL);                                                                             \
+    LM2_ASSERT(polygon.vertex_count >= 3);                                                                            \
+                                                                                                                      \
+    size_t n = polygon.vertex_count;                                                                                  \
+    if (n < _LM2_POLYGON_SIMPLE_SWEEP_MIN || n > (size_t)INT32_MAX) {                                                 \
+      return _lm2_polygon_is_simple_pairwise_##S(polygon);                                                            \
+    }                                                                                                                 \
+                                                                                                                      \
+    size_t bytes = n * 2 * sizeof(lm2_v2_##S) + n * 2 * sizeof(_lm2_sweep_event_##S) + n * 5 * sizeof(int32_t);       \
+    lm2_arena* arena = lm2_arena_thread_default();                                                                    \
+    size_t mark = lm2_scratch_begin(arena);                                                                           \
+    unsigned char* memory = (unsigned char*)lm2_scratch_alloc(arena, bytes);                                          \
+    if (memory == NULL) {                                                                                             \
+      lm2_scratch_end(arena, mark);                                                                                   \
+      return _lm2_polygon_is_simple_pairwise_##S(polygon);                                                            \
+    }                                                                                                                 \
+    _lm2_sweep_event_##S* events = (_lm2_sweep_event_##S*)memory;                                                     \
+    lm2_v2_##S* lo = (lm2_v2_##S*)(events + n * 2);                                                                   \
+    lm2_v2_##S* hi = lo + n;                                                                                          \
+    _lm2_sweep_status st;                                                                                             \
+    st.left = (int32_t*)(hi + n);                                                                                     \
+    st.right = st.left + n;                                                                                           \
+    st.parent = st.right + n;                                                                                         \
+    st.prev = st.parent + n;                                                                                          \
+    st.next = st.prev + n;                                                                                            \
+    st.root = _LM2_SWEEP_NONE;                                                                                        \
+                                                                                                                      \
+    for (size_t i = 0; i < n; i++) {                                                                                  \
+      lm2_v2_##S a = polygon.vertices[i];                                                                             \
+      lm2_v2_##S b = polygon.vertices[i + 1 == n ? 0 : i + 1];                                                        \
+      /* The edges before and after a repeated vertex touch there, and so do the edges around a spike */              \
+      lm2_v2_##S c = polygon.vertices[i + 2 >= n ? i + 2 - n : i + 2];                                                \
+      if ((a.x == b.x && a.y == b.y) ||                                                                               \
+          (lm2_v2_cross3_##S(a, b, c) == 0 && (b.x - a.x) * (c.x - b.x) + (b.y - a.y) * (c.y - b.y) < 0)) {           \
+        lm2_scratch_free(arena, memory);                                                                              \
+        lm2_scratch_end(arena, mark);                                                                                 \
+        return false;                                                                                                 \
+      }                                                                                                               \
+      bool swap = _lm2_sweep_lex_less_##S(b, a);                                                                      \
+      lo[i] = swap ? b : a;                                                                                           \
+      hi[i] = swap ? a : b;                                                                                           \
+      events[i * 2] = (_lm2_sweep_event_##S){lo[i].x, lo[i].y, (uint32_t)(i * 2)};                                    \
+      events[i * 2 + 1] = (_lm2_sweep_event_##S){hi[i].x, hi[i].y, (uint32_t)(i * 2 + 1)};                            \
+    }                                                                                                                 \
+    qsort(events, n * 2, sizeof(*events), _lm2_sweep_event_compare_##S);                                              \
+                                                                                                                      \
+    bool simple = true;                                                                                               \
+    for (size_t e = 0; e < n * 2 && simple; e++) {                                                                    \
+      int32_t s = (int32_t)(events[e].id >> 1);                                                                       \
+      if (events[e].id & 1u) {                                                                                        \
+        int32_t pred = st.prev[s];                                                                                    \
+        int32_t succ = st.next[s];                                                                                    \
+        _lm2_sweep_remove(&st, s);                                                                                    \
+        if (_lm2_sweep_hit_##S(lo, hi, pred, succ, n)) {                                                              \
+          simple = false;                                                                                             \
+        }                                                                                                             \
+        continue;                                                                                                     \
+      }                                                                                                               \
+                                                                                                                      \
+      /* Descend by the height of lo[s] against each edge; a point on an edge is a hit unless the two are adjacent */ \
+      int32_t parent = _LM2_SWEEP_NONE;                                                                               \
+      int32_t pred = _LM2_SWEEP_NONE;                                                                                 \
+      int32_t succ = _LM2_SWEEP_NONE;                                                                                 \
+      bool as_left = false;                                                                                           \
+      for (int32_t t = st.root; t != _LM2_SWEEP_NONE;) {                                                              \
+        scalar_type side = lm2_v2_cross3_##S(lo[t], hi[t], lo[s]);                                                    \
+        if (side == 0) {                                                                                              \
+          if (!_lm2_sweep_ring_adjacent(s, t, n)) {                                                                   \
+            simple = false;                                                                                           \
+            break;                                                                                                    \
+          }                                                                                                           \
+          side = lm2_v2_cross3_##S(lo[t], hi[t], hi[s]);                                                              \
+          if (side == 0) {                                                                                            \
+            side = s > t ? 1 : -1;                                                                                    \
+          }                                                                                                           \
+        }                                                                                                             \
+        parent = t;                                                                                                   \
+        as_left = side < 0;                                                                                           \
+        if (as_left) {                                                                                                \
+          succ = t;                                                                                                   \
+          t = st.left[t];                                                                                             \
+        } else {                                                                                                      \
+          pred = t;                                                                                                   \
+          t = st.right[t];                                                                                            \
+        }                                                                                                             \
+      }                                                                                                               \
+      if (!simple) {                                                                                                  \
+        break;                                                                                                        \
+      }                                                                                                               \
+      _lm2_sweep_insert(&st, s, parent, as_left, pred, succ);                                                         \
+      if (_lm2_sweep_hit_##S(lo, hi, s, pred, n) || _lm2_sweep_hit_##S(lo, hi, s, succ, n)) {                         \
+        simple = false;                                                                                               \
+      }                                                                                                               \
+    }                                                                                                                 \
+                                                                                                                      \
+    lm2_scratch_free(arena, memory);                                                                                  \
+    lm2_scratch_end(arena, mark);                                                                                     \
+    return simple;                                                                                                    \
+  }
+
+// =============================================================================
+// f64 Implementation
+// =============================================================================
+
+_LM2_IMPL_POLYGON_IS_SIMPLE(double, f64)
+
+// =============================================================================
+// f32 Implementation
+// =============================================================================
+
+_LM2_IMPL_POLYGON_IS_SIMPLE(float, f32)
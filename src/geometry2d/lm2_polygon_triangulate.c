@@ -0,0 +1,709 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <lm2/geometry2d/lm2_polygon.h>
+#include <lm2/scalar/lm2_scalar.h>
+#include <math.h>
+#include <stdlib.h>  // For qsort
+#include "../misc/lm2_scratch.h"
+
+// =============================================================================
+// Polygon Triangulation (earcut)
+// =============================================================================
+// Ear clipping over a doubly linked vertex ring, after the earcut algorithm
+// of Mapbox. Clipping an ear only relinks its neighbours, and the walk goes
+// on from the next vertex instead of restarting. Outlines above 80 vertices
+// also link their vertices in z-order (Morton code of the position), so an
+// ear test only visits the vertices inside the ear's bounding box.
+//
+// Holes are merged into the outline from left to right, each through a
+// bridge of two coincident edges to a visible outline vertex. When no ear is
+// left, the remaining ring goes through three fallbacks: drop collinear and
+// duplicate points, cut away small self-intersections, and finally split the
+// ring along a valid diagonal and triangulate both halves.
+//
+// The outline ring is built counter-clockwise and the hole rings clockwise,
+// whatever the input winding, so every clipped ear (prev, ear, next) comes out
+// counter-clockwise like the rest of the module.
+
+// Rings larger than this use z-order hashing
+#define _LM2_EARCUT_HASH_THRESHOLD 80
+
+#define _LM2_IMPL_POLYGON_EARCUT(scalar_type, S)                                                                                       \
+  typedef struct _lm2_earcut_node_##S {                                                                                                \
+    scalar_type x;                                                                                                                     \
+    scalar_type y;                                                                                                                     \
+    size_t i;                                                                                                                          \
+    uint32_t z;                                                                                                                        \
+    bool steiner;                                                                                                                      \
+    struct _lm2_earcut_node_##S* prev;                                                                                                 \
+    struct _lm2_earcut_node_##S* next;                                                                                                 \
+    struct _lm2_earcut_node_##S* prev_z;                                                                                               \
+    struct _lm2_earcut_node_##S* next_z;                                                                                               \
+  } _lm2_earcut_node_##S;                                                                                                              \
+                                                                                                                                       \
+  typedef _lm2_earcut_node_##S _lm2_en_##S;                                                                                            \
+                                                                                                                                       \
+  typedef struct _lm2_earcut_##S {                                                                                                     \
+    _lm2_en_##S* nodes;                                                                                                                \
+    size_t node_count;                                                                                                                 \
+    size_t node_capacity;                                                                                                              \
+    size_t* out_indices;                                                                                                               \
+    size_t triangle_count;                                                                                                             \
+    size_t triangle_capacity;                                                                                                          \
+    scalar_type min_x;                                                                                                                 \
+    scalar_type min_y;                                                                                                                 \
+    scalar_type inv_size;                                                                                                              \
+  } _lm2_earcut_##S;                                                                                                                   \
+                                                                                                                                       \
+  static void _lm2_earcut_emit_##S(_lm2_earcut_##S* ec, const _lm2_en_##S* a, const _lm2_en_##S* b, const _lm2_en_##S* c) {            \
+    if (ec->triangle_count < ec->triangle_capacity) {                                                                                  \
+      size_t* out = &ec->out_indices[ec->triangle_count * 3];                                                                          \
+      out[0] = a->i;                                                                                                                   \
+      out[1] = b->i;                                                                                                                   \
+      out[2] = c->i;                                                                                                                   \
+      ec->triangle_count++;                                                                                                            \
+    }                                                                                                                                  \
+  }                                                                                                                                    \
+                                                                                                                                       \
+  static _lm2_en_##S* _lm2_earcut_create_node_##S(_lm2_earcut_##S* ec, size_t i, scalar_type x, scalar_type y) {                       \
+    LM2_ASSERT(ec->node_count < ec->node_capacity);                                                                                    \
+    _lm2_en_##S* p = &ec->nodes[ec->node_count++];                                                                                     \
+    p->x = x;                                                                                                                          \
+    p->y = y;                                                                                                                          \
+    p->i = i;                                                                                                                          \
+    p->z = 0;                                                                                                                          \
+    p->steiner = false;                                                                                                                \
+    p->prev = NULL;                                                                                                                    \
+    p->next = NULL;                                                                                                                    \
+    p->prev_z = NULL;                                                                                                                  \
+    p->next_z = NULL;                                                                                                                  \
+    return p;                                                                                                                          \
+  }                                                                                                                                    \
+                                                                                                                                       \
+  static _lm2_en_##S* _lm2_earcut_insert_node_##S(_lm2_earcut_##S* ec, size_t i, lm2_v2_##S v, _lm2_en_##S* last) {                    \
+    _lm2_en_##S* p = _lm2_earcut_create_node_##S(ec, i, v.x, v.y);                                                                     \
+    if (last == NULL) {                                                                                                                \
+      p->prev = p;                                                                                                                     \
+      p->next = p;                                                                                                                     \
+    } else {                                                                                                                           \
+      p->next = last->next;                                                                                                            \
+      p->prev = last;                                                                                                                  \
+      last->next->prev = p;                                                                                                            \
+      last->next = p;                                                                                                                  \
+    }                                                                                                                                  \
+    return p;                                                                                                                          \
+  }                                                                                                                                    \
+                                                                                                                                       \
+  static void _lm2_earcut_remove_node_##S(_lm2_en_##S* p) {                                                                            \
+    p->next->prev = p->prev;                                                                                                           \
+    p->prev->next = p->next;                                                                                                           \
+    if (p->prev_z != NULL) {                                                                                                           \
+      p->prev_z->next_z = p->next_z;                                                                                                   \
+    }                                                                                                                                  \
+    if (p->next_z != NULL) {                                                                                                           \
+      p->next_z->prev_z = p->prev_z;                                                                                                   \
+    }                                                                                                                                  \
+  }                                                                                                                                    \
+                                                                                                                                       \
+  /* Twice the signed area of pqr, negated: negative for a left turn at q */                                                           \
+  static inline scalar_type _lm2_earcut_area_##S(const _lm2_en_##S* p, const _lm2_en_##S* q, const _lm2_en_##S* r) {                   \
+    return (q->y - p->y) * (r->x - q->x) - (q->x - p->x) * (r->y - q->y);                                                              \
+  }                                                                                                                                    \
+                                                                                                                                       \
+  static inline bool _lm2_earcut_equals_##S(const _lm2_en_##S* a, const _lm2_en_##S* b) {                                              \
+    return a->x == b->x && a->y == b->y;                                                                                               \
+  }                                                                                                                                    \
+                                                                                                                                       \
+  static inline bool _lm2_earcut_point_in_triangle_##S(                                                                                \
+      scalar_type ax, scalar_type ay, scalar_type bx, scalar_type by,                                                                  \
+      scalar_type cx, scalar_type cy, scalar_type px, scalar_type py) {                                                                \
+    return (cx - px) * (ay - py) >= (ax - px) * (cy - py) &&                                                                           \
+           (ax - px) * (by - py) >= (bx - px) * (ay - py) &&                                                                           \
+           (bx - px) * (cy - py) >= (cx - px) * (by - py);                                                                             \
+  }                                                                                                                                    \
+                                                                                                                                       \
+  static inline int _lm2_earcut_sign_##S(scalar_type v) {                                                                              \
+    return v > 0 ? 1 : (v < 0 ? -1 : 0);                                                                                               \
+  }                                                                                                                                    \
+                                                                                                                                       \
+  /* q lies in the bounding box of pr, for collinear pqr */                                                                            \
+  static inline bool _lm2_earcut_on_segment_##S(const _lm2_en_##S* p, const _lm2_en_##S* q, const _lm2_en_##S* r) {                    \
+    return q->x <= lm2_max_##S(p->x, r->x) && q->x >= lm2_min_##S(p->x, r->x) &&                                                       \
+           q->y <= lm2_max_##S(p->y, r->y) && q->y >= lm2_min_##S(p->y, r->y);                                                         \
+  }                                                                                                                                    \
+                                                                                                                                       \
+  static bool _lm2_earcut_intersects_##S(const _lm2_en_##S* p1, const _lm2_en_##S* q1, const _lm2_en_##S* p2, const _lm2_en_##S* q2) { \
+    int o1 = _lm2_earcut_sign_##S(_lm2_earcut_area_##S(p1, q1, p2));                                                                   \
+    int o2 = _lm2_earcut_sign_##S(_lm2_earcut_area_##S(p1, q1, q2));                                                                   \
+    int o3 = _lm2_earcut_sign_##S(_lm2_earcut_area_##S(p2, q2, p1));                                                                   \
+    int o4 = _lm2_earcut_sign_##S(_lm2_earcut_area_##S(p2, q2, q1));                                                                   \
+    if (o1 != o2 && o3 != o4) {                                                                                                        \
+      return true;                                                                                                                     \
+    }                                                                                                                                  \
+    return (o1 == 0 && _lm2_earcut_on_segment_##S(p1, p2, q1)) ||                                                                      \
+           (o2 == 0 && _lm2_earcut_on_segment_##S(p1, q2, q1)) ||                                                                      \
+           (o3 == 0 && _lm2_earcut_on_segment_##S(p2, p1, q2)) ||                                                                      \
+           (o4 == 0 && _lm2_earcut_on_segment_##S(p2, q1, q2));                                                                        \
+  }                                                                                                                                    \
+                                                                                                                                       \
+  /* Diagonal ab crosses an edge of the ring other than those at a and b */                                                            \
+  static bool _lm2_earcut_intersects_polygon_##S(const _lm2_en_##S* a, const _lm2_en_##S* b) {                                         \
+    const _lm2_en_##S* p = a;                                                                                                          \
+    do {                                                                                                                               \
+      if (p->i != a->i && p->next->i != a->i && p->i != b->i && p->next->i != b->i &&                                                  \
+          _lm2_earcut_intersects_##S(p, p->next, a, b)) {                                                                              \
+        return true;                                                                                                                   \
+      }                                                                                                                                \
+      p = p->next;                                                                                                                     \
+    } while (p != a);                                                                                                                  \
+    return false;                                                                                                                      \
+  }                                                                                                                                    \
+                                                                                                                                       \
+  /* Diagonal ab leaves a towards the inside of the ring */                                                                            \
+  static bool _lm2_earcut_locally_inside_##S(const _lm2_en_##S* a, const _lm2_en_##S* b) {                                             \
+    if (_lm2_earcut_area_##S(a->prev, a, a->next) < 0) {                                                                               \
+      return _lm2_earcut_area_##S(a, b, a->next) >= 0 && _lm2_earcut_area_##S(a, a->prev, b) >= 0;                                     \
+    }                                                                                                                                  \
+    return _lm2_earcut_area_##S(a, b, a->prev) < 0 || _lm2_earcut_area_##S(a, a->next, b) < 0;                                         \
+  }                                                                                                                                    \
+                                                                                                                                       \
+  /* The midpoint of ab is inside the ring (crossing count) */                                                                         \
+  static bool _lm2_earcut_middle_inside_##S(const _lm2_en_##S* a, const _lm2_en_##S* b) {                                              \
+    const _lm2_en_##S* p = a;                                                                                                          \
+    bool inside = false;                                                                                                               \
+    scalar_type px = (a->x + b->x) / 2;                                                                                                \
+    scalar_type py = (a->y + b->y) / 2;                                                                                                \
+    do {                                                                                                                               \
+      if (((p->y > py) != (p->next->y > py)) && p->next->y != p->y &&                                                                  \
+          (px < (p->next->x - p->x) * (py - p->y) / (p->next->y - p->y) + p->x)) {                                                     \
+        inside = !inside;                                                                                                              \
+      }                                                                                                                                \
+      p = p->next;                                                                                                                     \
+    } while (p != a);                                                                                                                  \
+    return inside;                                                                                                                     \
+  }                                                                                                                                    \
+                                                                                                                                       \
+  static bool _lm2_earcut_is_valid_diagonal_##S(const _lm2_en_##S* a, const _lm2_en_##S* b) {                                          \
+    if (a->next->i == b->i || a->prev->i == b->i || _lm2_earcut_intersects_polygon_##S(a, b)) {                                        \
+      return false;                                                                                                                    \
+    }                                                                                                                                  \
+    if (_lm2_earcut_locally_inside_##S(a, b) && _lm2_earcut_locally_inside_##S(b, a) && _lm2_earcut_middle_inside_##S(a, b) &&         \
+        (_lm2_earcut_area_##S(a->prev, a, b->prev) != 0 || _lm2_earcut_area_##S(a, b->prev, b) != 0)) {                                \
+      return true;                                                                                                                     \
+    }                                                                                                                                  \
+    return _lm2_earcut_equals_##S(a, b) && _lm2_earcut_area_##S(a->prev, a, a->next) > 0 &&                                            \
+           _lm2_earcut_area_##S(b->prev, b, b->next) > 0;                                                                              \
+  }                                                                                                                                    \
+                                                                                                                                       \
+  /* Link a and b with a bridge of two coincident edges, splitting the ring in two; returns the copy of b */                           \
+  static _lm2_en_##S* _lm2_earcut_split_polygon_##S(_lm2_earcut_##S* ec, _lm2_en_##S* a, _lm2_en_##S* b) {                             \
+    _lm2_en_##S* a2 = _lm2_earcut_create_node_##S(ec, a->i, a->x, a->y);                                                               \
+    _lm2_en_##S* b2 = _lm2_earcut_create_node_##S(ec, b->i, b->x, b->y);                                                               \
+    _lm2_en_##S* an = a->next;                                                                                                         \
+    _lm2_en_##S* bp = b->prev;                                                                                                         \
+    a->next = b;                                                                                                                       \
+    b->prev = a;                                                                                                                       \
+    a2->next = an;                                                                                                                     \
+    an->prev = a2;                                                                                                                     \
+    a2->prev = b2;                                                                                                                     \
+    b2->next = a2;                                                                                                                     \
+    b2->prev = bp;                                                                                                                     \
+    bp->next = b2;                                                                                                                     \
+    return b2;                                                                                                                         \
+  }                                                                                                                                    \
+                                                                                                                                       \
+  /* Drop duplicate and collinear points between start and end */                                                                      \
+  static _lm2_en_##S* _lm2_earcut_filter_points_##S(_lm2_en_##S* start, _lm2_en_##S* end) {                                            \
+    if (start == NULL) {                                                                                                               \
+      return start;                                                                                                                    \
+    }                                                                                                                                  \
+    if (end == NULL) {                                                                                                                 \
+      end = start;                                                                                                                     \
+    }                                                                                                                                  \
+    _lm2_en_##S* p = start;                                                                                                            \
+    bool again;                                                                                                                        \
+    do {                                                                                                                               \
+      again = false;                                                                                                                   \
+      if (!p->steiner && (_lm2_earcut_equals_##S(p, p->next) || _lm2_earcut_area_##S(p->prev, p, p->next) == 0)) {                     \
+        _lm2_earcut_remove_node_##S(p);                                                                                                \
+        p = end = p->prev;                                                                                                             \
+        if (p == p->next) {                                                                                                            \
+          break;                                                                                                                       \
+        }                                                                                                                              \
+        again = true;                                                                                                                  \
+      } else {                                                                                                                         \
+        p = p->next;                                                                                                                   \
+      }                                                                                                                                \
+    } while (again || p != end);                                                                                                       \
+    return end;                                                                                                                        \
+  }                                                                                                                                    \
+                                                                                                                                       \
+  /* Ring over polygon vertices with indices starting at first, counter-clockwise or clockwise */                                      \
+  static _lm2_en_##S* _lm2_earcut_linked_list_##S(_lm2_earcut_##S* ec, lm2_polygon_##S polygon, size_t first, bool ccw) {              \
+    size_t n = polygon.vertex_count;                                                                                                   \
+    if (n == 0) {                                                                                                                      \
+      return NULL;                                                                                                                     \
+    }                                                                                                                                  \
+    scalar_type sum = 0;                                                                                                               \
+    for (size_t i = 0, j = n - 1; i < n; j = i++) {                                                                                    \
+      sum += (polygon.vertices[j].x - polygon.vertices[i].x) * (polygon.vertices[i].y + polygon.vertices[j].y);                        \
+    }                                                                                                                                  \
+    _lm2_en_##S* last = NULL;                                                                                                          \
+    if (ccw == (sum > 0)) {                                                                                                            \
+      for (size_t i = 0; i < n; i++) {                                                                                                 \
+        last = _lm2_earcut_insert_node_##S(ec, first + i, polygon.vertices[i], last);                                                  \
+      }                                                                                                                                \
+    } else {                                                                                                                           \
+      for (size_t i = n; i-- > 0;) {                                                                                                   \
+        last = _lm2_earcut_insert_node_##S(ec, first + i, polygon.vertices[i], last);                                                  \
+      }                                                                                                                                \
+    }                                                                                                                                  \
+    if (last != NULL && _lm2_earcut_equals_##S(last, last->next)) {                                                                    \
+      _lm2_earcut_remove_node_##S(last);                                                                                               \
+      last = last->next;                                                                                                               \
+    }                                                                                                                                  \
+    return last;                                                                                                                       \
+  }                                                                                                                                    \
+                                                                                                                                       \
+  /* Morton code of a point scaled to 15 bits per axis */                                                                              \
+  static inline uint32_t _lm2_earcut_z_order_##S(const _lm2_earcut_##S* ec, scalar_type px, scalar_type py) {                          \
+    uint32_t x = (uint32_t)(int32_t)((px - ec->min_x) * ec->inv_size);                                                                 \
+    uint32_t y = (uint32_t)(int32_t)((py - ec->min_y) * ec->inv_size);                                                                 \
+    x = (x | (x << 8)) & 0x00FF00FFu;                                                                                                  \
+    x = (x | (x << 4)) & 0x0F0F0F0Fu;                                                                                                  \
+    x = (x | (x << 2)) & 0x33333333u;                                                                                                  \
+    x = (x | (x << 1)) & 0x55555555u;                                                                                                  \
+    y = (y | (y << 8)) & 0x00FF00FFu;                                                                                                  \
+    y = (y | (y << 4)) & 0x0F0F0F0Fu;                                                                                                  \
+    y = (y | (y << 2)) & 0x33333333u;                                                                                                  \
+    y = (y | (y << 1)) & 0x55555555u;                                                                                                  \
+    return x | (y << 1);                                                                                                               \
+  }                                                                                                                                    \
+                                                                                                                                       \
+  /* Bottom-up merge sort of the z-order list */                                                                                       \
+  static void _lm2_earcut_sort_linked_##S(_lm2_en_##S* list) {                                                                         \
+    size_t in_size = 1;                                                                                                                \
+    size_t merges;                                                                                                                     \
+    do {                                                                                                                               \
+      _lm2_en_##S* p = list;                                                                                                           \
+      _lm2_en_##S* tail = NULL;                                                                                                        \
+      list = NULL;                                                                                                                     \
+      merges = 0;                                                                                                                      \
+      while (p != NULL) {                                                                                                              \
+        merges++;                                                                                                                      \
+        _lm2_en_##S* q = p;                                                                                                            \
+        size_t p_size = 0;                                                                                                             \
+        for (size_t i = 0; i < in_size; i++) {                                                                                         \
+          p_size++;                                                                                                                    \
+          q = q->next_z;                                                                                                               \
+          if (q == NULL) {                                                                                                             \
+            break;                                                                                                                     \
+          }                                                                                                                            \
+        }                                                                                                                              \
+        size_t q_size = in_size;                                                                                                       \
+        while (p_size > 0 || (q_size > 0 && q != NULL)) {                                                                              \
+          _lm2_en_##S* e;                                                                                                              \
+          if (p_size != 0 && (q_size == 0 || q == NULL || p->z <= q->z)) {                                                             \
+            e = p;                                                                                                                     \
+            p = p->next_z;                                                                                                             \
+            p_size--;                                                                                                                  \
+          } else {                                                                                                                     \
+            e = q;                                                                                                                     \
+            q = q->next_z;                                                                                                             \
+            q_size--;                                                                                                                  \
+          }                                                                                                                            \
+          if (tail != NULL) {                                                                                                          \
+            tail->next_z = e;                                                                                                          \
+          } else {                                                                                                                     \
+            list = e;                                                                                                                  \
+          }                                                                                                                            \
+          e->prev_z = tail;                                                                                                            \
+          tail = e;                                                                                                                    \
+        }                                                                                                                              \
+        p = q;                                                                                                                         \
+      }                                                                                                                                \
+      tail->next_z = NULL;                                                                                                             \
+      in_size *= 2;                                                                                                                    \
+    } while (merges > 1);                                                                                                              \
+  }                                                                                                                                    \
+                                                                                                                                       \
+  static void _lm2_earcut_index_curve_##S(_lm2_earcut_##S* ec, _lm2_en_##S* start) {                                                   \
+    _lm2_en_##S* p = start;                                                                                                            \
+    do {                                                                                                                               \
+      if (p->z == 0) {                                                                                                                 \
+        p->z = _lm2_earcut_z_order_##S(ec, p->x, p->y);                                                                                \
+      }                                                                                                                                \
+      p->prev_z = p->prev;                                                                                                             \
+      p->next_z = p->next;                                                                                                             \
+      p = p->next;                                                                                                                     \
+    } while (p != start);                                                                                                              \
+    p->prev_z->next_z = NULL;                                                                                                          \
+    p->prev_z = NULL;                                                                                                                  \
+    _lm2_earcut_sort_linked_##S(p);                                                                                                    \
+  }                                                                                                                                    \
+                                                                                                                                       \
+  /* A point of the ring inside triangle abc, other than a and c, at a reflex vertex */                                                \
+  static inline bool _lm2_earcut_blocks_ear_##S(                                                                                       \
+      const _lm2_en_##S* a, const _lm2_en_##S* b, const _lm2_en_##S* c, const _lm2_en_##S* p,                                          \
+      scalar_type x0, scalar_type y0, scalar_type x1, scalar_type y1) {                                                                \
+    return p->x >= x0 && p->x <= x1 && p->y >= y0 && p->y <= y1 && p != a && p != c &&                                                 \
+           _lm2_earcut_point_in_triangle_##S(a->x, a->y, b->x, b->y, c->x, c->y, p->x, p->y) &&                                        \
+           _lm2_earcut_area_##S(p->prev, p, p->next) >= 0;                                                                             \
+  }                                                                                                                                    \
+                                                                                                                                       \
+  static bool _lm2_earcut_is_ear_##S(const _lm2_en_##S* ear) {                                                                         \
+    const _lm2_en_##S* a = ear->prev;                                                                                                  \
+    const _lm2_en_##S* b = ear;                                                                                                        \
+    const _lm2_en_##S* c = ear->next;                                                                                                  \
+    if (_lm2_earcut_area_##S(a, b, c) >= 0) {                                                                                          \
+      return false;                                                                                                                    \
+    }                                                                                                                                  \
+    scalar_type x0 = lm2_min_##S(a->x, lm2_min_##S(b->x, c->x));                                                                       \
+    scalar_type y0 = lm2_min_##S(a->y, lm2_min_##S(b->y, c->y));                                                                       \
+    scalar_type x1 = lm2_max_##S(a->x, lm2_max_##S(b->x, c->x));                                                                       \
+    scalar_type y1 = lm2_max_##S(a->y, lm2_max_##S(b->y, c->y));                                                                       \
+    for (const _lm2_en_##S* p = c->next; p != a; p = p->next) {                                                                        \
+      if (_lm2_earcut_blocks_ear_##S(a, b, c, p, x0, y0, x1, y1)) {                                                                    \
+        return false;                                                                                                                  \
+      }                                                                                                                                \
+    }                                                                                                                                  \
+    return true;                                                                                                                       \
+  }                                                                                                                                    \
+                                                                                                                                       \
+  /* Same test, walking the z-order list both ways from the ear within its box */                                                      \
+  static bool _lm2_earcut_is_ear_hashed_##S(const _lm2_earcut_##S* ec, const _lm2_en_##S* ear) {                                       \
+    const _lm2_en_##S* a = ear->prev;                                                                                                  \
+    const _lm2_en_##S* b = ear;                                                                                                        \
+    const _lm2_en_##S* c = ear->next;                                                                                                  \
+    if (_lm2_earcut_area_##S(a, b, c) >= 0) {                                                                                          \
+      return false;                                                                                                                    \
+    }                                                                                                                                  \
+    scalar_type x0 = lm2_min_##S(a->x, lm2_min_##S(b->x, c->x));                                                                       \
+    scalar_type y0 = lm2_min_##S(a->y, lm2_min_##S(b->y, c->y));                                                                       \
+    scalar_type x1 = lm2_max_##S(a->x, lm2_max_##S(b->x, c->x));                                                                       \
+    scalar_type y1 = lm2_max_##S(a->y, lm2_max_##S(b->y, c->y));                                                                       \
+    uint32_t min_z = _lm2_earcut_z_order_##S(ec, x0, y0);                                                                              \
+    uint32_t max_z = _lm2_earcut_z_order_##S(ec, x1, y1);                                                                              \
+                                                                                                                                       \
+    const _lm2_en_##S* p = ear->prev_z;                                                                                                \
+    const _lm2_en_##S* n = ear->next_z;                                                                                                \
+    while (p != NULL && p->z >= min_z && n != NULL && n->z <= max_z) {                                                                 \
+      if (_lm2_earcut_blocks_ear_##S(a, b, c, p, x0, y0, x1, y1)) {                                                                    \
+        return false;                                                                                                                  \
+      }                                                                                                                                \
+      p = p->prev_z;                                                                                                                   \
+      if (_lm2_earcut_blocks_ear_##S(a, b, c, n, x0, y0, x1, y1)) {                                                                    \
+        return false;                                                                                                                  \
+      }                                                                                                                                \
+      n = n->next_z;                                                                                                                   \
+    }                                                                                                                                  \
+    for (; p != NULL && p->z >= min_z; p = p->prev_z) {                                                                                \
+      if (_lm2_earcut_blocks_ear_##S(a, b, c, p, x0, y0, x1, y1)) {                                                                    \
+        return false;                                                                                                                  \
+      }                                                                                                                                \
+    }                                                                                                                                  \
+    for (; n != NULL && n->z <= max_z; n = n->next_z) {                                                                                \
+      if (_lm2_earcut_blocks_ear_##S(a, b, c, n, x0, y0, x1, y1)) {                                                                    \
+        return false;                                                                                                                  \
+      }                                                                                                                                \
+    }                                                                                                                                  \
+    return true;                                                                                                                       \
+  }                                                                                                                                    \
+                                                                                                                                       \
+  /* Clip the triangles that close small self-intersections of the ring */                                                             \
+  static _lm2_en_##S* _lm2_earcut_cure_local_intersections_##S(_lm2_earcut_##S* ec, _lm2_en_##S* start) {                              \
+    _lm2_en_##S* p = start;                                                                                                            \
+    do {                                                                                                                               \
+      _lm2_en_##S* a = p->prev;                                                                                                        \
+      _lm2_en_##S* b = p->next->next;                                                                                                  \
+      if (!_lm2_earcut_equals_##S(a, b) && _lm2_earcut_intersects_##S(a, p, p->next, b) &&                                             \
+          _lm2_earcut_locally_inside_##S(a, b) && _lm2_earcut_locally_inside_##S(b, a)) {                                              \
+        _lm2_earcut_emit_##S(ec, a, p, b);                                                                                             \
+        _lm2_earcut_remove_node_##S(p);                                                                                                \
+        _lm2_earcut_remove_node_##S(p->next);                                                                                          \
+        p = start = b;                                                                                                                 \
+      }                                                                                                                                \
+      p = p->next;                                                                                                                     \
+    } while (p != start);                                                                                                              \
+    return _lm2_earcut_filter_points_##S(p, NULL);                                                                                     \
+  }                                                                                                                                    \
+                                                                                                                                       \
+  static void _lm2_earcut_linked_##S(_lm2_earcut_##S* ec, _lm2_en_##S* ear, int pass);                                                 \
+                                                                                                                                       \
+  /* Split the ring along a valid diagonal and triangulate both halves */                                                              \
+  static void _lm2_earcut_split_##S(_lm2_earcut_##S* ec, _lm2_en_##S* start) {                                                         \
+    _lm2_en_##S* a = start;                                                                                                            \
+    do {                                                                                                                               \
+      _lm2_en_##S* b = a->next->next;                                                                                                  \
+      while (b != a->prev) {                                                                                                           \
+        if (a->i != b->i && _lm2_earcut_is_valid_diagonal_##S(a, b)) {                                                                 \
+          _lm2_en_##S* c = _lm2_earcut_split_polygon_##S(ec, a, b);                                                                    \
+          a = _lm2_earcut_filter_points_##S(a, a->next);                                                                               \
+          c = _lm2_earcut_filter_points_##S(c, c->next);                                                                               \
+          _lm2_earcut_linked_##S(ec, a, 0);                                                                                            \
+          _lm2_earcut_linked_##S(ec, c, 0);                                                                                            \
+          return;                                                                                                                      \
+        }                                                                                                                              \
+        b = b->next;                                                                                                                   \
+      }                                                                                                                                \
+      a = a->next;                                                                                                                     \
+    } while (a != start);                                                                                                              \
+  }                                                                                                                                    \
+                                                                                                                                       \
+  static void _lm2_earcut_linked_##S(_lm2_earcut_##S* ec, _lm2_en_##S* ear, int pass) {                                                \
+    if (ear == NULL) {                                                                                                                 \
+      return;                                                                                                                          \
+    }                                                                                                                                  \
+    if (pass == 0 && ec->inv_size != 0) {                                                                                              \
+      _lm2_earcut_index_curve_##S(ec, ear);                                                                                            \
+    }                                                                                                                                  \
+                                                                                                                                       \
+    _lm2_en_##S* stop = ear;                                                                                                           \
+    while (ear->prev != ear->next) {                                                                                                   \
+      _lm2_en_##S* prev = ear->prev;                                                                                                   \
+      _lm2_en_##S* next = ear->next;                                                                                                   \
+      if (ec->inv_size != 0 ? _lm2_earcut_is_ear_hashed_##S(ec, ear) : _lm2_earcut_is_ear_##S(ear)) {                                  \
+        _lm2_earcut_emit_##S(ec, prev, ear, next);                                                                                     \
+        _lm2_earcut_remove_node_##S(ear);                                                                                              \
+        ear = next->next;                                                                                                              \
+        stop = next->next;                                                                                                             \
+        continue;                                                                                                                      \
+      }                                                                                                                                \
+      ear = next;                                                                                                                      \
+      if (ear == stop) {                                                                                                               \
+        if (pass == 0) {                                                                                                               \
+          _lm2_earcut_linked_##S(ec, _lm2_earcut_filter_points_##S(ear, NULL), 1);                                                     \
+        } else if (pass == 1) {                                                                                                        \
+          ear = _lm2_earcut_cure_local_intersections_##S(ec, _lm2_earcut_filter_points_##S(ear, NULL));                                \
+          _lm2_earcut_linked_##S(ec, ear, 2);                                                                                          \
+        } else {                                                                                                                       \
+          _lm2_earcut_split_##S(ec, ear);                                                                                              \
+        }                                                                                                                              \
+        break;                                                                                                                         \
+      }                                                                                                                                \
+    }                                                                                                                                  \
+  }                                                                                                                                    \
+                                                                                                                                       \
+  /* Outline vertex to bridge a hole to: the closest one a ray to the left of the hole's leftmost point can see */                     \
+  static _lm2_en_##S* _lm2_earcut_find_hole_bridge_##S(_lm2_en_##S* hole, _lm2_en_##S* outer) {                                        \
+    _lm2_en_##S* p = outer;                                                                                                            \
+    _lm2_en_##S* m = NULL;                                                                                                             \
+    scalar_type hx = hole->x;                                                                                                          \
+    scalar_type hy = hole->y;                                                                                                          \
+    scalar_type qx = -INFINITY;                                                                                                        \
+    do {                                                                                                                               \
+      if (hy <= p->y && hy >= p->next->y && p->next->y != p->y) {                                                                      \
+        scalar_type x = p->x + (hy - p->y) * (p->next->x - p->x) / (p->next->y - p->y);                                                \
+        if (x <= hx && x > qx) {                                                                                                       \
+          qx = x;                                                                                                                      \
+          m = p->x < p->next->x ? p : p->next;                                                                                         \
+          if (x == hx) {                                                                                                               \
+            return m;                                                                                                                  \
+          }                                                                                                                            \
+        }                                                                                                                              \
+      }                                                                                                                                \
+      p = p->next;                                                                                                                     \
+    } while (p != outer);                                                                                                              \
+    if (m == NULL) {                                                                                                                   \
+      return NULL;                                                                                                                     \
+    }                                                                                                                                  \
+                                                                                                                                       \
+    /* Reflex vertices inside the triangle of hole, ray hit and m may block the view; take the one at the smallest angle */            \
+    _lm2_en_##S* stop = m;                                                                                                             \
+    scalar_type mx = m->x;                                                                                                             \
+    scalar_type my = m->y;                                                                                                             \
+    scalar_type tan_min = INFINITY;                                                                                                    \
+    p = m;                                                                                                                             \
+    do {                                                                                                                               \
+      if (hx >= p->x && p->x >= mx && hx != p->x &&                                                                                    \
+          _lm2_earcut_point_in_triangle_##S(hy < my ? hx : qx, hy, mx, my, hy < my ? qx : hx, hy, p->x, p->y)) {                       \
+        scalar_type tan = lm2_abs_##S(hy - p->y) / (hx - p->x);                                                                        \
+        if (_lm2_earcut_locally_inside_##S(p, hole) &&                                                                                 \
+            (tan < tan_min ||                                                                                                          \
+             (tan == tan_min &&                                                                                                        \
+              (p->x > m->x || (p->x == m->x && _lm2_earcut_area_##S(m->prev, m, p->prev) < 0 &&                                        \
+                                                _lm2_earcut_area_##S(p->next, m, m->next) < 0))))) {                                   \
+          m = p;                                                                                                                       \
+          tan_min = tan;                                                                                                               \
+        }                                                                                                                              \
+      }                                                                                                                                \
+      p = p->next;                                                                                                                     \
+    } while (p != stop);                                                                                                               \
+    return m;                                                                                                                          \
+  }                                                                                                                                    \
+                                                                                                                                       \
+  static int _lm2_earcut_compare_x_##S(const void* a, const void* b) {                                                                 \
+    const _lm2_en_##S* na = *(const _lm2_en_##S* const*)a;                                                                             \
+    const _lm2_en_##S* nb = *(const _lm2_en_##S* const*)b;                                                                             \
+    return na->x < nb->x ? -1 : (na->x > nb->x ? 1 : 0);                                                                               \
+  }                                                                                                                                    \
+                                                                                                                                       \
+  static _lm2_en_##S* _lm2_earcut_eliminate_holes_##S(                                                                                 \
+      _lm2_earcut_##S* ec,                                                                                                             \
+      const lm2_polygon_##S* holes,                                                                                                    \
+      size_t hole_count,                                                                                                               \
+      size_t first,                                                                                                                    \
+      _lm2_en_##S* outer,                                                                                                              \
+      _lm2_en_##S** queue) {                                                                                                           \
+    size_t queue_count = 0;                                                                                                            \
+    for (size_t h = 0; h < hole_count; h++) {                                                                                          \
+      _lm2_en_##S* list = _lm2_earcut_linked_list_##S(ec, holes[h], first, false);                                                     \
+      first += holes[h].vertex_count;                                                                                                  \
+      if (list == NULL) {                                                                                                              \
+        continue;                                                                                                                      \
+      }                                                                                                                                \
+      if (list == list->next) {                                                                                                        \
+        list->steiner = true;                                                                                                          \
+      }                                                                                                                                \
+      /* Leftmost point of the hole */                                                                                                 \
+      _lm2_en_##S* leftmost = list;                                                                                                    \
+      _lm2_en_##S* p = list;                                                                                                           \
+      do {                                                                                                                             \
+        if (p->x < leftmost->x || (p->x == leftmost->x && p->y < leftmost->y)) {                                                       \
+          leftmost = p;                                                                                                                \
+        }                                                                                                                              \
+        p = p->next;                                                                                                                   \
+      } while (p != list);                                                                                                             \
+      queue[queue_count++] = leftmost;                                                                                                 \
+    }                                                                                                                                  \
+    qsort(queue, queue_count, sizeof(*queue), _lm2_earcut_compare_x_##S);                                                              \
+                                                                                                                                       \
+    for (size_t h = 0; h < queue_count; h++) {                                                                                         \
+      _lm2_en_##S* bridge = _lm2_earcut_find_hole_bridge_##S(queue[h], outer);                                                         \
+      if (bridge == NULL) {                                                                                                            \
+        continue;                                                                                                                      \
+      }                                                                                                                                \
+      _lm2_en_##S* bridge_reverse = _lm2_earcut_split_polygon_##S(ec, bridge, queue[h]);                                               \
+      _lm2_earcut_filter_points_##S(bridge_reverse, bridge_reverse->next);                                                             \
+      outer = _lm2_earcut_filter_points_##S(bridge, bridge->next);                                                                     \
+    }                                                                                                                                  \
+    return outer;                                                                                                                      \
+  }                                                                                                                                    \
+                                                                                                                                       \
+  static size_t _lm2_earcut_node_capacity_##S(size_t vertex_count, size_t hole_count) {                                                \
+    /* Every hole bridge and every diagonal split adds two nodes */                                                                    \
+    return 3 * (vertex_count + 2 * hole_count);                                                                                        \
+  }                                                                                                                                    \
+                                                                                                                                       \
+  LM2_API size_t lm2_polygon_triangulate_scratch_size_##S(size_t vertex_count, size_t hole_count) {                                    \
+    return sizeof(_lm2_en_##S) * _lm2_earcut_node_capacity_##S(vertex_count, hole_count) + sizeof(_lm2_en_##S*) * hole_count;          \
+  }                                                                                                                                    \
+                                                                                                                                       \
+  LM2_API size_t lm2_polygon_triangulate_##S(                                                                                          \
+      lm2_polygon_##S polygon,                                                                                                         \
+      const lm2_polygon_##S* holes,                                                                                                    \
+      size_t hole_count,                                                                                                               \
+      void* scratch,                                                                                                                   \
+      size_t scratch_size,                                                                                                             \
+      size_t* out_indices) {                                                                                                           \
+    LM2_ASSERT(polygon.vertices != NULL);                                                                                              \
+    LM2_ASSERT(polygon.vertex_count >= 3);                                                                                             \
+    LM2_ASSERT(hole_count == 0 || holes != NULL);                                                                                      \
+    LM2_ASSERT(out_indices != NULL);                                                                                                   \
+                                                                                                                                       \
+    size_t vertex_count = polygon.vertex_count;                                                                                        \
+    for (size_t h = 0; h < hole_count; h++) {                                                                                          \
+      LM2_ASSERT(holes[h].vertex_count == 0 || holes[h].vertices != NULL);                                                             \
+      vertex_count += holes[h].vertex_count;                                                                                           \
+    }                                                                                                                                  \
+                                                                                                                                       \
+    /* Without a caller buffer the scratch comes from the thread's default arena */                                                    \
+    size_t required = lm2_polygon_triangulate_scratch_size_##S(vertex_count, hole_count);                                              \
+    lm2_arena* arena = NULL;                                                                                                           \
+    size_t mark = 0;                                                                                                                   \
+    void* owned = NULL;                                                                                                                \
+    if (scratch == NULL) {                                                                                                             \
+      arena = lm2_arena_thread_default();                                                                                              \
+      mark = lm2_scratch_begin(arena);                                                                                                 \
+      owned = lm2_scratch_alloc(arena, required);                                                                                      \
+      if (owned == NULL) {                                                                                                             \
+        lm2_scratch_end(arena, mark);                                                                                                  \
+        return 0;                                                                                                                      \
+      }                                                                                                                                \
+      scratch = owned;                                                                                                                 \
+    } else {                                                                                                                           \
+      LM2_ASSERT(scratch_size >= required);                                                                                            \
+    }                                                                                                                                  \
+                                                                                                                                       \
+    _lm2_earcut_##S ec;                                                                                                                \
+    ec.nodes = (_lm2_en_##S*)scratch;                                                                                                  \
+    ec.node_count = 0;                                                                                                                 \
+    ec.node_capacity = _lm2_earcut_node_capacity_##S(vertex_count, hole_count);                                                        \
+    ec.out_indices = out_indices;                                                                                                      \
+    ec.triangle_count = 0;                                                                                                             \
+    ec.triangle_capacity = lm2_polygon_max_triangle_count_with_holes(vertex_count, hole_count);                                        \
+    ec.min_x = 0;                                                                                                                      \
+    ec.min_y = 0;                                                                                                                      \
+    ec.inv_size = 0;                                                                                                                   \
+                                                                                                                                       \
+    _lm2_en_##S* outer = _lm2_earcut_linked_list_##S(&ec, polygon, 0, true);                                                           \
+    if (outer != NULL && outer->next != outer->prev) {                                                                                 \
+      if (hole_count > 0) {                                                                                                            \
+        _lm2_en_##S** queue = (_lm2_en_##S**)(ec.nodes + ec.node_capacity);                                                            \
+        outer = _lm2_earcut_eliminate_holes_##S(&ec, holes, hole_count, polygon.vertex_count, outer, queue);                           \
+      }                                                                                                                                \
+                                                                                                                                       \
+      /* z-order hashing for large inputs, scaled to the outline's bounds */                                                           \
+      if (vertex_count > _LM2_EARCUT_HASH_THRESHOLD) {                                                                                 \
+        scalar_type min_x = polygon.vertices[0].x;                                                                                     \
+        scalar_type min_y = polygon.vertices[0].y;                                                                                     \
+        scalar_type max_x = min_x;                                                                                                     \
+        scalar_type max_y = min_y;                                                                                                     \
+        for (size_t i = 1; i < polygon.vertex_count; i++) {                                                                            \
+          min_x = lm2_min_##S(min_x, polygon.vertices[i].x);                                                                           \
+          min_y = lm2_min_##S(min_y, polygon.vertices[i].y);                                                                           \
+          max_x = lm2_max_##S(max_x, polygon.vertices[i].x);                                                                           \
+          max_y = lm2_max_##S(max_y, polygon.vertices[i].y);                                                                           \
+        }                                                                                                                              \
+        scalar_type size = lm2_max_##S(max_x - min_x, max_y - min_y);                                                                  \
+        ec.min_x = min_x;                                                                                                              \
+        ec.min_y = min_y;                                                                                                              \
+        ec.inv_size = size != 0 ? (scalar_type)32767 / size : 0;                                                                       \
+      }                                                                                                                                \
+                                                                                                                                       \
+      _lm2_earcut_linked_##S(&ec, outer, 0);                                                                                           \
+    }                                                                                                                                  \
+                                                                                                                                       \
+    lm2_scratch_free(arena, owned);                                                                                                    \
+    lm2_scratch_end(arena, mark);                                                                                                      \
+    return ec.triangle_count;                                                                                                          \
+  }
+
+LM2_API size_t lm2_polygon_max_triangle_count_with_holes(size_t vertex_count, size_t hole_count) {
+  LM2_ASSERT(vertex_count >= 3);
+  return vertex_count + 2 * hole_count - 2;
+}
+
+// =============================================================================
+// f64 Implementation
+// =============================================================================
+
+_LM2_IMPL_POLYGON_EARCUT(double, f64)
+
+// =============================================================================
+// f32 Implementation
+// =============================================================================
+
+_LM2_IMPL_POLYGON_EARCUT(float, f32)
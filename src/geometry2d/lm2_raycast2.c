@@ -25,6 +25,7 @@ SOFTWARE.
 #include "lm2_c2_utils.h"
 #include "lm2/geometry2d/lm2_edge2.h"
 #include "lm2/geometry2d/lm2_raycast2.h"
+#include "lm2/geometry2d/lm2_sat2.h"
 #include "lm2/geometry2d/lm2_shape2.h"
 #include "lm2/scalar/lm2_safe_ops.h"
 #include "lm2/scalar/lm2_scalar.h"
@@ -169,11 +170,15 @@ LM2_API lm2_rayhit2_f64 lm2_raycast_capsule2_f64(lm2_ray2_f64 ray, lm2_capsule2_
   return result;
 }
 
-LM2_API lm2_rayhit2_f64 lm2_raycast_polygon_f64(lm2_ray2_f64 ray, lm2_polygon_f64 polygon) {
+LM2_API lm2_rayhit2_f64 lm2_raycast_convex_polygon_f64(lm2_ray2_f64 ray, lm2_convex_polygon_f64 convex) {
+  if (convex.vertex_count > C2_MAX_POLYGON_VERTS) {
+    return lm2_sat2_raycast_polygon_f64(ray, convex);
+  }
+
   lm2_rayhit2_f64 result;
   c2Raycast hit;
   c2Ray c2_ray = lm2_ray2_f64_to_c2(ray);
-  c2Poly c2_poly = lm2_polygon_f64_to_c2(polygon);
+  c2Poly c2_poly = lm2_convex_polygon_f64_to_c2(convex);
 
   int did_hit = c2RaytoPoly(c2_ray, &c2_poly, NULL, &hit);
   result.hit = did_hit != 0;
@@ -191,6 +196,13 @@ LM2_API lm2_rayhit2_f64 lm2_raycast_polygon_f64(lm2_ray2_f64 ray, lm2_polygon_f6
   return result;
 }
 
+LM2_API lm2_rayhit2_f64 lm2_raycast_polygon_f64(lm2_ray2_f64 ray, lm2_polygon_f64 polygon) {
+  lm2_polygon_normals_f64 normals;
+  lm2_rayhit2_f64 result = lm2_raycast_convex_polygon_f64(ray, lm2_polygon_f64_to_convex(polygon, &normals));
+  lm2_polygon_normals_f64_release(&normals);
+  return result;
+}
+
 LM2_API lm2_rayhit2_f64 lm2_raycast_segment_f64(lm2_ray2_f64 ray, lm2_v2_f64 segment_start, lm2_v2_f64 segment_end) {
   // Backward-compat wrapper - canonical API is lm2_raycast_edge2_f64 in lm2_edge2.h
   lm2_capsule2_f64 capsule;
@@ -286,11 +298,15 @@ LM2_API lm2_rayhit2_f32 lm2_raycast_capsule2_f32(lm2_ray2_f32 ray, lm2_capsule2_
   return result;
 }
 
-LM2_API lm2_rayhit2_f32 lm2_raycast_polygon_f32(lm2_ray2_f32 ray, lm2_polygon_f32 polygon) {
+LM2_API lm2_rayhit2_f32 lm2_raycast_convex_polygon_f32(lm2_ray2_f32 ray, lm2_convex_polygon_f32 convex) {
+  if (convex.vertex_count > C2_MAX_POLYGON_VERTS) {
+    return lm2_sat2_raycast_polygon_f32(ray, convex);
+  }
+
   lm2_rayhit2_f32 result;
   c2Raycast hit;
   c2Ray c2_ray = lm2_ray2_f32_to_c2(ray);
-  c2Poly c2_poly = lm2_polygon_f32_to_c2(polygon);
+  c2Poly c2_poly = lm2_convex_polygon_f32_to_c2(convex);
 
   int did_hit = c2RaytoPoly(c2_ray, &c2_poly, NULL, &hit);
   result.hit = did_hit != 0;
@@ -308,6 +324,13 @@ LM2_API lm2_rayhit2_f32 lm2_raycast_polygon_f32(lm2_ray2_f32 ray, lm2_polygon_f3
   return result;
 }
 
+LM2_API lm2_rayhit2_f32 lm2_raycast_polygon_f32(lm2_ray2_f32 ray, lm2_polygon_f32 polygon) {
+  lm2_polygon_normals_f32 normals;
+  lm2_rayhit2_f32 result = lm2_raycast_convex_polygon_f32(ray, lm2_polygon_f32_to_convex(polygon, &normals));
+  lm2_polygon_normals_f32_release(&normals);
+  return result;
+}
+
 LM2_API lm2_rayhit2_f32 lm2_raycast_segment_f32(lm2_ray2_f32 ray, lm2_v2_f32 segment_start, lm2_v2_f32 segment_end) {
   // Backward-compat wrapper - canonical API is lm2_raycast_edge2_f32 in lm2_edge2.h
   lm2_capsule2_f32 capsule;
@@ -0,0 +1,403 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <lm2/geometry2d/lm2_sat2.h>
+#include <lm2/scalar/lm2_scalar.h>
+#include <lm2/vectors/lm2_vector2.h>
+#include <lm2/vectors/lm2_vector_specifics.h>
+#include <float.h>
+#include <math.h>
+#include <stdint.h>
+
+// =============================================================================
+// Separating Axis Core
+// =============================================================================
+// Shapes are convex vertex loops with a radius: polygons have radius 0 and a
+// capsule is its core segment as a two-vertex loop whose normals face both
+// ways. The core SAT runs on the loops and the radii widen the contact band.
+// Rounded cores that are apart but within reach can be closest at two
+// vertices. That case is resolved with a segment distance query between the
+// reference and incident edges, which face separation alone gets wrong.
+
+#define _LM2_IMPL_SAT2_CORE(scalar_type, S, huge, tolerance)                                                                 \
+  typedef struct _lm2_sat2_shape_##S {                                                                                       \
+    const lm2_v2_##S* vertices;                                                                                              \
+    const lm2_v2_##S* normals;                                                                                               \
+    size_t count;                                                                                                            \
+    scalar_type radius;                                                                                                      \
+  } _lm2_sat2_shape_##S;                                                                                                     \
+                                                                                                                             \
+  static inline size_t _lm2_sat2_next_##S(const _lm2_sat2_shape_##S* s, size_t i) {                                          \
+    return i + 1 == s->count ? 0 : i + 1;                                                                                    \
+  }                                                                                                                          \
+                                                                                                                             \
+  static inline size_t _lm2_sat2_prev_##S(const _lm2_sat2_shape_##S* s, size_t i) {                                          \
+    return i == 0 ? s->count - 1 : i - 1;                                                                                    \
+  }                                                                                                                          \
+                                                                                                                             \
+  /* Vertex minimizing dot(direction, v), hill climbing from start (bitonic on a convex loop) */                             \
+  static size_t _lm2_sat2_support_##S(const _lm2_sat2_shape_##S* s, lm2_v2_##S direction, size_t start) {                    \
+    size_t best = start;                                                                                                     \
+    scalar_type best_dot = lm2_v2_dot_##S(direction, s->vertices[start]);                                                    \
+    size_t steps = 0;                                                                                                        \
+    for (size_t i = _lm2_sat2_next_##S(s, best); steps < s->count; i = _lm2_sat2_next_##S(s, best), steps++) {               \
+      scalar_type d = lm2_v2_dot_##S(direction, s->vertices[i]);                                                             \
+      if (!(d < best_dot)) {                                                                                                 \
+        break;                                                                                                               \
+      }                                                                                                                      \
+      best = i;                                                                                                              \
+      best_dot = d;                                                                                                          \
+    }                                                                                                                        \
+    if (steps == 0) {                                                                                                        \
+      for (size_t i = _lm2_sat2_prev_##S(s, best); steps < s->count; i = _lm2_sat2_prev_##S(s, best), steps++) {             \
+        scalar_type d = lm2_v2_dot_##S(direction, s->vertices[i]);                                                           \
+        if (!(d < best_dot)) {                                                                                               \
+          break;                                                                                                             \
+        }                                                                                                                    \
+        best = i;                                                                                                            \
+        best_dot = d;                                                                                                        \
+      }                                                                                                                      \
+    }                                                                                                                        \
+    return best;                                                                                                             \
+  }                                                                                                                          \
+                                                                                                                             \
+  /* Largest separation of b along the edge normals of a. Stops early once it exceeds limit. */                              \
+  static scalar_type _lm2_sat2_max_separation_##S(const _lm2_sat2_shape_##S* a, const _lm2_sat2_shape_##S* b,                \
+                                                   scalar_type limit, size_t* out_edge, size_t* out_support) {               \
+    scalar_type best = -huge;                                                                                                \
+    size_t support = 0;                                                                                                      \
+    *out_edge = 0;                                                                                                           \
+    *out_support = 0;                                                                                                        \
+    for (size_t i = 0; i < a->count; i++) {                                                                                  \
+      lm2_v2_##S n = a->normals[i];                                                                                          \
+      support = _lm2_sat2_support_##S(b, n, support);                                                                        \
+      scalar_type separation = lm2_v2_dot_##S(n, lm2_v2_sub_##S(b->vertices[support], a->vertices[i]));                      \
+      if (separation > best) {                                                                                               \
+        best = separation;                                                                                                   \
+        *out_edge = i;                                                                                                       \
+        *out_support = support;                                                                                              \
+        if (best > limit) {                                                                                                  \
+          break;                                                                                                             \
+        }                                                                                                                    \
+      }                                                                                                                      \
+    }                                                                                                                        \
+    return best;                                                                                                             \
+  }                                                                                                                          \
+                                                                                                                             \
+  /* Keep the part of segment [p0, p1] with dot(normal, p) <= offset */                                                      \
+  static int _lm2_sat2_clip_##S(lm2_v2_##S out[2], lm2_v2_##S p0, lm2_v2_##S p1, lm2_v2_##S normal, scalar_type offset) {    \
+    int count = 0;                                                                                                           \
+    scalar_type d0 = lm2_v2_dot_##S(normal, p0) - offset;                                                                    \
+    scalar_type d1 = lm2_v2_dot_##S(normal, p1) - offset;                                                                    \
+    if (d0 <= 0) {                                                                                                           \
+      out[count++] = p0;                                                                                                     \
+    }                                                                                                                        \
+    if (d1 <= 0) {                                                                                                           \
+      out[count++] = p1;                                                                                                     \
+    }                                                                                                                        \
+    if (d0 * d1 < 0) {                                                                                                       \
+      scalar_type t = d0 / (d0 - d1);                                                                                        \
+      out[count++] = lm2_v2_add_##S(p0, lm2_v2_mul_s_##S(lm2_v2_sub_##S(p1, p0), t));                                        \
+    }                                                                                                                        \
+    return count;                                                                                                            \
+  }                                                                                                                          \
+                                                                                                                             \
+  /* Closest points of segments [p1, q1] and [p2, q2]; fractions are exactly 0 or 1 at clamped ends */                       \
+  static scalar_type _lm2_sat2_segment_distance_sq_##S(lm2_v2_##S p1, lm2_v2_##S q1, lm2_v2_##S p2, lm2_v2_##S q2,           \
+                                                        scalar_type* out_f1, scalar_type* out_f2,                            \
+                                                        lm2_v2_##S* out_c1, lm2_v2_##S* out_c2) {                            \
+    lm2_v2_##S d1 = lm2_v2_sub_##S(q1, p1);                                                                                  \
+    lm2_v2_##S d2 = lm2_v2_sub_##S(q2, p2);                                                                                  \
+    lm2_v2_##S r = lm2_v2_sub_##S(p1, p2);                                                                                   \
+    scalar_type dd1 = lm2_v2_dot_##S(d1, d1);                                                                                \
+    scalar_type dd2 = lm2_v2_dot_##S(d2, d2);                                                                                \
+    scalar_type rd1 = lm2_v2_dot_##S(r, d1);                                                                                 \
+    scalar_type rd2 = lm2_v2_dot_##S(r, d2);                                                                                 \
+    scalar_type f1 = 0;                                                                                                      \
+    scalar_type f2 = 0;                                                                                                      \
+    if (dd1 > 0 && dd2 > 0) {                                                                                                \
+      scalar_type d12 = lm2_v2_dot_##S(d1, d2);                                                                              \
+      scalar_type denom = dd1 * dd2 - d12 * d12;                                                                             \
+      if (denom != 0) {                                                                                                      \
+        f1 = lm2_clamp_##S(0, (d12 * rd2 - rd1 * dd2) / denom, 1);                                                           \
+      }                                                                                                                      \
+      f2 = (d12 * f1 + rd2) / dd2;                                                                                           \
+      if (f2 < 0) {                                                                                                          \
+        f2 = 0;                                                                                                              \
+        f1 = lm2_clamp_##S(0, -rd1 / dd1, 1);                                                                                \
+      } else if (f2 > 1) {                                                                                                   \
+        f2 = 1;                                                                                                              \
+        f1 = lm2_clamp_##S(0, (d12 - rd1) / dd1, 1);                                                                         \
+      }                                                                                                                      \
+    } else if (dd1 > 0) {                                                                                                    \
+      f1 = lm2_clamp_##S(0, -rd1 / dd1, 1);                                                                                  \
+    } else if (dd2 > 0) {                                                                                                    \
+      f2 = lm2_clamp_##S(0, rd2 / dd2, 1);                                                                                   \
+    }                                                                                                                        \
+    *out_f1 = f1;                                                                                                            \
+    *out_f2 = f2;                                                                                                            \
+    *out_c1 = lm2_v2_add_##S(p1, lm2_v2_mul_s_##S(d1, f1));                                                                  \
+    *out_c2 = lm2_v2_add_##S(p2, lm2_v2_mul_s_##S(d2, f2));                                                                  \
+    lm2_v2_##S delta = lm2_v2_sub_##S(*out_c2, *out_c1);                                                                     \
+    return lm2_v2_dot_##S(delta, delta);                                                                                     \
+  }                                                                                                                          \
+                                                                                                                             \
+  static void _lm2_sat2_manifold_##S(const _lm2_sat2_shape_##S* a, const _lm2_sat2_shape_##S* b, lm2_manifold_##S* out) {    \
+    out->count = 0;                                                                                                          \
+    scalar_type radius = a->radius + b->radius;                                                                              \
+                                                                                                                             \
+    size_t edge_a, support_b;                                                                                                \
+    scalar_type separation_a = _lm2_sat2_max_separation_##S(a, b, radius, &edge_a, &support_b);                              \
+    if (separation_a > radius) {                                                                                             \
+      return;                                                                                                                \
+    }                                                                                                                        \
+    size_t edge_b, support_a;                                                                                                \
+    scalar_type separation_b = _lm2_sat2_max_separation_##S(b, a, radius, &edge_b, &support_a);                              \
+    if (separation_b > radius) {                                                                                             \
+      return;                                                                                                                \
+    }                                                                                                                        \
+                                                                                                                             \
+    /* Prefer a as reference unless b is clearly better, so the choice does not flicker */                                   \
+    const _lm2_sat2_shape_##S* ref = a;                                                                                      \
+    const _lm2_sat2_shape_##S* inc = b;                                                                                      \
+    size_t edge = edge_a;                                                                                                    \
+    size_t support = support_b;                                                                                              \
+    scalar_type separation = separation_a;                                                                                   \
+    bool flip = false;                                                                                                       \
+    if (separation_b > separation_a + tolerance) {                                                                           \
+      ref = b;                                                                                                               \
+      inc = a;                                                                                                               \
+      edge = edge_b;                                                                                                         \
+      support = support_a;                                                                                                   \
+      separation = separation_b;                                                                                             \
+      flip = true;                                                                                                           \
+    }                                                                                                                        \
+                                                                                                                             \
+    /* Incident edge: the edge at the support vertex whose normal opposes the reference normal most */                       \
+    lm2_v2_##S n = ref->normals[edge];                                                                                       \
+    size_t before = _lm2_sat2_prev_##S(inc, support);                                                                        \
+    size_t inc_edge = lm2_v2_dot_##S(n, inc->normals[before]) < lm2_v2_dot_##S(n, inc->normals[support]) ? before : support; \
+                                                                                                                             \
+    lm2_v2_##S v1 = ref->vertices[edge];                                                                                     \
+    lm2_v2_##S v2 = ref->vertices[_lm2_sat2_next_##S(ref, edge)];                                                            \
+    lm2_v2_##S w1 = inc->vertices[inc_edge];                                                                                 \
+    lm2_v2_##S w2 = inc->vertices[_lm2_sat2_next_##S(inc, inc_edge)];                                                        \
+                                                                                                                             \
+    if (separation > tolerance) {                                                                                            \
+      scalar_type f1, f2;                                                                                                    \
+      lm2_v2_##S c1, c2;                                                                                                     \
+      scalar_type distance_sq = _lm2_sat2_segment_distance_sq_##S(v1, v2, w1, w2, &f1, &f2, &c1, &c2);                       \
+      if ((f1 == 0 || f1 == 1) && (f2 == 0 || f2 == 1)) {                                                                    \
+        if (distance_sq > radius * radius) {                                                                                 \
+          return;                                                                                                            \
+        }                                                                                                                    \
+        scalar_type distance = lm2_sqrt_##S(distance_sq);                                                                    \
+        lm2_v2_##S normal = lm2_v2_div_s_##S(lm2_v2_sub_##S(c2, c1), distance);                                              \
+        out->count = 1;                                                                                                      \
+        out->depths[0] = radius - distance;                                                                                  \
+        out->contact_points[0] = lm2_v2_sub_##S(c2, lm2_v2_mul_s_##S(normal, inc->radius));                                  \
+        out->normal = flip ? lm2_v2_neg_##S(normal) : normal;                                                                \
+        return;                                                                                                              \
+      }                                                                                                                      \
+    }                                                                                                                        \
+                                                                                                                             \
+    /* Clip the incident edge against the side planes of the reference face */                                               \
+    lm2_v2_##S tangent = lm2_v2_make_##S(-n.y, n.x);                                                                         \
+    lm2_v2_##S clip1[2];                                                                                                     \
+    lm2_v2_##S clip2[2];                                                                                                     \
+    if (_lm2_sat2_clip_##S(clip1, w1, w2, lm2_v2_neg_##S(tangent), -lm2_v2_dot_##S(tangent, v1)) < 2) {                      \
+      return;                                                                                                                \
+    }                                                                                                                        \
+    if (_lm2_sat2_clip_##S(clip2, clip1[0], clip1[1], tangent, lm2_v2_dot_##S(tangent, v2)) < 2) {                           \
+      return;                                                                                                                \
+    }                                                                                                                        \
+                                                                                                                             \
+    scalar_type offset = lm2_v2_dot_##S(n, v1);                                                                              \
+    int count = 0;                                                                                                           \
+    for (int i = 0; i < 2; i++) {                                                                                            \
+      scalar_type s = lm2_v2_dot_##S(n, clip2[i]) - offset;                                                                  \
+      if (s <= radius) {                                                                                                     \
+        out->depths[count] = radius - s;                                                                                     \
+        out->contact_points[count] = lm2_v2_sub_##S(clip2[i], lm2_v2_mul_s_##S(n, inc->radius));                             \
+        count++;                                                                                                             \
+      }                                                                                                                      \
+    }                                                                                                                        \
+    out->count = count;                                                                                                      \
+    out->normal = flip ? lm2_v2_neg_##S(n) : n;                                                                              \
+  }                                                                                                                          \
+                                                                                                                             \
+  static inline _lm2_sat2_shape_##S _lm2_sat2_shape_from_convex_##S(const lm2_convex_polygon_##S* convex) {                  \
+    LM2_ASSERT(convex->vertices != NULL && convex->normals != NULL);                                                         \
+    LM2_ASSERT(convex->vertex_count >= 3);                                                                                   \
+    _lm2_sat2_shape_##S shape;                                                                                               \
+    shape.vertices = convex->vertices;                                                                                       \
+    shape.normals = convex->normals;                                                                                         \
+    shape.count = convex->vertex_count;                                                                                      \
+    shape.radius = 0;                                                                                                        \
+    return shape;                                                                                                            \
+  }
+
+_LM2_IMPL_SAT2_CORE(double, f64, DBL_MAX, LM2_SAT2_TOLERANCE_F64)
+_LM2_IMPL_SAT2_CORE(float, f32, FLT_MAX, LM2_SAT2_TOLERANCE_F32)
+
+// =============================================================================
+// Public API
+// =============================================================================
+
+#define _LM2_IMPL_SAT2_API(scalar_type, S, huge, tolerance)                                                      \
+  LM2_API bool lm2_sat2_collide_polygon_to_polygon_##S(lm2_convex_polygon_##S a, lm2_convex_polygon_##S b) {     \
+    _lm2_sat2_shape_##S sa = _lm2_sat2_shape_from_convex_##S(&a);                                                \
+    _lm2_sat2_shape_##S sb = _lm2_sat2_shape_from_convex_##S(&b);                                                \
+    size_t edge, support;                                                                                        \
+    if (_lm2_sat2_max_separation_##S(&sa, &sb, 0, &edge, &support) > 0) {                                        \
+      return false;                                                                                              \
+    }                                                                                                            \
+    return _lm2_sat2_max_separation_##S(&sb, &sa, 0, &edge, &support) <= 0;                                      \
+  }                                                                                                              \
+                                                                                                                 \
+  LM2_API void lm2_sat2_manifold_polygon_to_polygon_##S(lm2_convex_polygon_##S a, lm2_convex_polygon_##S b,      \
+                                                        lm2_manifold_##S* out_manifold) {                        \
+    LM2_ASSERT(out_manifold != NULL);                                                                            \
+    _lm2_sat2_shape_##S sa = _lm2_sat2_shape_from_convex_##S(&a);                                                \
+    _lm2_sat2_shape_##S sb = _lm2_sat2_shape_from_convex_##S(&b);                                                \
+    _lm2_sat2_manifold_##S(&sa, &sb, out_manifold);                                                              \
+  }                                                                                                              \
+                                                                                                                 \
+  LM2_API void lm2_sat2_manifold_circle_to_polygon_##S(lm2_circle_##S circle, lm2_convex_polygon_##S convex,     \
+                                                       lm2_manifold_##S* out_manifold) {                         \
+    LM2_ASSERT(out_manifold != NULL);                                                                            \
+    _lm2_sat2_shape_##S poly = _lm2_sat2_shape_from_convex_##S(&convex);                                         \
+    out_manifold->count = 0;                                                                                     \
+                                                                                                                 \
+    /* Face of greatest separation from the center */                                                            \
+    lm2_v2_##S center = circle.center;                                                                           \
+    scalar_type separation = -huge;                                                                              \
+    size_t edge = 0;                                                                                             \
+    for (size_t i = 0; i < poly.count; i++) {                                                                    \
+      scalar_type s = lm2_v2_dot_##S(poly.normals[i], lm2_v2_sub_##S(center, poly.vertices[i]));                 \
+      if (s > separation) {                                                                                      \
+        separation = s;                                                                                          \
+        edge = i;                                                                                                \
+      }                                                                                                          \
+    }                                                                                                            \
+    if (separation > circle.radius) {                                                                            \
+      return;                                                                                                    \
+    }                                                                                                            \
+                                                                                                                 \
+    /* Vertex regions of that face, the normal points from the polygon to the circle */                          \
+    lm2_v2_##S v1 = poly.vertices[edge];                                                                         \
+    lm2_v2_##S v2 = poly.vertices[_lm2_sat2_next_##S(&poly, edge)];                                              \
+    lm2_v2_##S normal = poly.normals[edge];                                                                      \
+    if (separation > tolerance) {                                                                                \
+      lm2_v2_##S corner = v1;                                                                                    \
+      bool in_corner = false;                                                                                    \
+      if (lm2_v2_dot_##S(lm2_v2_sub_##S(center, v1), lm2_v2_sub_##S(v2, v1)) < 0) {                              \
+        in_corner = true;                                                                                        \
+      } else if (lm2_v2_dot_##S(lm2_v2_sub_##S(center, v2), lm2_v2_sub_##S(v1, v2)) < 0) {                       \
+        corner = v2;                                                                                             \
+        in_corner = true;                                                                                        \
+      }                                                                                                          \
+      if (in_corner) {                                                                                           \
+        lm2_v2_##S delta = lm2_v2_sub_##S(center, corner);                                                       \
+        scalar_type distance_sq = lm2_v2_dot_##S(delta, delta);                                                  \
+        if (distance_sq > circle.radius * circle.radius) {                                                       \
+          return;                                                                                                \
+        }                                                                                                        \
+        separation = lm2_sqrt_##S(distance_sq);                                                                  \
+        normal = lm2_v2_div_s_##S(delta, separation);                                                            \
+      }                                                                                                          \
+    }                                                                                                            \
+                                                                                                                 \
+    out_manifold->count = 1;                                                                                     \
+    out_manifold->depths[0] = circle.radius - separation;                                                        \
+    out_manifold->contact_points[0] = lm2_v2_sub_##S(center, lm2_v2_mul_s_##S(normal, circle.radius));           \
+    out_manifold->normal = lm2_v2_neg_##S(normal);                                                               \
+  }                                                                                                              \
+                                                                                                                 \
+  LM2_API void lm2_sat2_manifold_capsule_to_polygon_##S(lm2_capsule2_##S capsule, lm2_convex_polygon_##S convex, \
+                                                        lm2_manifold_##S* out_manifold) {                        \
+    LM2_ASSERT(out_manifold != NULL);                                                                            \
+    lm2_v2_##S axis = lm2_v2_sub_##S(capsule.end, capsule.start);                                                \
+    scalar_type length_sq = lm2_v2_dot_##S(axis, axis);                                                          \
+    if (length_sq <= tolerance * tolerance) {                                                                    \
+      lm2_circle_##S circle;                                                                                     \
+      circle.center = lm2_v2_mul_s_##S(lm2_v2_add_##S(capsule.start, capsule.end), (scalar_type)0.5);            \
+      circle.radius = capsule.radius;                                                                            \
+      lm2_sat2_manifold_circle_to_polygon_##S(circle, convex, out_manifold);                                     \
+      return;                                                                                                    \
+    }                                                                                                            \
+                                                                                                                 \
+    lm2_v2_##S n = lm2_v2_div_s_##S(lm2_v2_make_##S(axis.y, -axis.x), lm2_sqrt_##S(length_sq));                  \
+    lm2_v2_##S vertices[2] = {capsule.start, capsule.end};                                                       \
+    lm2_v2_##S normals[2] = {n, lm2_v2_neg_##S(n)};                                                              \
+    _lm2_sat2_shape_##S core;                                                                                    \
+    core.vertices = vertices;                                                                                    \
+    core.normals = normals;                                                                                      \
+    core.count = 2;                                                                                              \
+    core.radius = capsule.radius;                                                                                \
+    _lm2_sat2_shape_##S poly = _lm2_sat2_shape_from_convex_##S(&convex);                                         \
+    _lm2_sat2_manifold_##S(&core, &poly, out_manifold);                                                          \
+  }                                                                                                              \
+                                                                                                                 \
+  LM2_API lm2_rayhit2_##S lm2_sat2_raycast_polygon_##S(lm2_ray2_##S ray, lm2_convex_polygon_##S convex) {        \
+    _lm2_sat2_shape_##S poly = _lm2_sat2_shape_from_convex_##S(&convex);                                         \
+    lm2_rayhit2_##S result;                                                                                      \
+    result.hit = false;                                                                                          \
+    result.t = 0;                                                                                                \
+    result.point = lm2_v2_zero_##S();                                                                            \
+    result.normal = lm2_v2_zero_##S();                                                                           \
+                                                                                                                 \
+    scalar_type lower = 0;                                                                                       \
+    scalar_type upper = ray.t_max;                                                                               \
+    size_t entry = SIZE_MAX;                                                                                     \
+    for (size_t i = 0; i < poly.count; i++) {                                                                    \
+      lm2_v2_##S n = poly.normals[i];                                                                            \
+      scalar_type numerator = lm2_v2_dot_##S(n, lm2_v2_sub_##S(poly.vertices[i], ray.origin));                   \
+      scalar_type denominator = lm2_v2_dot_##S(n, ray.direction);                                                \
+      if (denominator == 0) {                                                                                    \
+        if (numerator < 0) {                                                                                     \
+          return result;                                                                                         \
+        }                                                                                                        \
+      } else if (denominator < 0 && numerator < lower * denominator) {                                           \
+        lower = numerator / denominator;                                                                         \
+        entry = i;                                                                                               \
+      } else if (denominator > 0 && numerator < upper * denominator) {                                           \
+        upper = numerator / denominator;                                                                         \
+      }                                                                                                          \
+      if (upper < lower) {                                                                                       \
+        return result;                                                                                           \
+      }                                                                                                          \
+    }                                                                                                            \
+                                                                                                                 \
+    if (entry != SIZE_MAX) {                                                                                     \
+      result.hit = true;                                                                                         \
+      result.t = lower;                                                                                          \
+      result.normal = poly.normals[entry];                                                                       \
+      result.point = lm2_v2_add_##S(ray.origin, lm2_v2_mul_s_##S(ray.direction, lower));                         \
+    }                                                                                                            \
+    return result;                                                                                               \
+  }
+
+_LM2_IMPL_SAT2_API(double, f64, DBL_MAX, LM2_SAT2_TOLERANCE_F64)
+_LM2_IMPL_SAT2_API(float, f32, FLT_MAX, LM2_SAT2_TOLERANCE_F32)
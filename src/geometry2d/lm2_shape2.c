@@ -23,6 +23,7 @@ SOFTWARE.
 */
 
 #include "lm2/geometry2d/lm2_shape2.h"
+#include "lm2/scalar/lm2_scalar.h"
 
 // =============================================================================
 // Construction Helpers - f64
@@ -259,3 +260,111 @@ LM2_API lm2_shape2_type lm2_shape2_get_type_f32(const lm2_shape2_f32* shape) {
   LM2_ASSERT(shape != NULL);
   return shape->type;
 }
+
+// =============================================================================
+// Bounds - f64
+// =============================================================================
+
+static lm2_r2_f64 _lm2_shape2_points_bounds_f64(const lm2_v2_f64* points, size_t count, double radius) {
+  lm2_r2_f64 bounds;
+  bounds.min = points[0];
+  bounds.max = points[0];
+  for (size_t i = 1; i < count; i++) {
+    bounds.min.x = lm2_min_f64(bounds.min.x, points[i].x);
+    bounds.min.y = lm2_min_f64(bounds.min.y, points[i].y);
+    bounds.max.x = lm2_max_f64(bounds.max.x, points[i].x);
+    bounds.max.y = lm2_max_f64(bounds.max.y, points[i].y);
+  }
+  bounds.min.x -= radius;
+  bounds.min.y -= radius;
+  bounds.max.x += radius;
+  bounds.max.y += radius;
+  return bounds;
+}
+
+LM2_API lm2_r2_f64 lm2_shape2_bounds_f64(lm2_shape2_f64 shape) {
+  LM2_ASSERT(shape.data != NULL);
+  switch (shape.type) {
+    case LM2_SHAPE2_CIRCLE: {
+      const lm2_circle_f64* circle = (const lm2_circle_f64*)shape.data;
+      return _lm2_shape2_points_bounds_f64(&circle->center, 1, circle->radius);
+    }
+    case LM2_SHAPE2_CAPSULE: {
+      const lm2_capsule2_f64* capsule = (const lm2_capsule2_f64*)shape.data;
+      lm2_v2_f64 points[2] = {capsule->start, capsule->end};
+      return _lm2_shape2_points_bounds_f64(points, 2, capsule->radius);
+    }
+    case LM2_SHAPE2_AABB2:
+      return *(const lm2_aabb2_f64*)shape.data;
+    case LM2_SHAPE2_TRIANGLE:
+      return _lm2_shape2_points_bounds_f64(*(const lm2_triangle2_f64*)shape.data, 3, 0);
+    case LM2_SHAPE2_POLYGON: {
+      const lm2_polygon_f64* polygon = (const lm2_polygon_f64*)shape.data;
+      LM2_ASSERT(polygon->vertices != NULL && polygon->vertex_count > 0);
+      return _lm2_shape2_points_bounds_f64(polygon->vertices, polygon->vertex_count, 0);
+    }
+    case LM2_SHAPE2_EDGE: {
+      const lm2_edge2_f64* edge = (const lm2_edge2_f64*)shape.data;
+      lm2_v2_f64 points[2] = {edge->start, edge->end};
+      return _lm2_shape2_points_bounds_f64(points, 2, 0);
+    }
+  }
+  LM2_ASSERT(false);
+  lm2_r2_f64 bounds;
+  bounds.min = bounds.max = lm2_v2_make_f64(0, 0);
+  return bounds;
+}
+
+// =============================================================================
+// Bounds - f32
+// =============================================================================
+
+static lm2_r2_f32 _lm2_shape2_points_bounds_f32(const lm2_v2_f32* points, size_t count, float radius) {
+  lm2_r2_f32 bounds;
+  bounds.min = points[0];
+  bounds.max = points[0];
+  for (size_t i = 1; i < count; i++) {
+    bounds.min.x = lm2_min_f32(bounds.min.x, points[i].x);
+    bounds.min.y = lm2_min_f32(bounds.min.y, points[i].y);
+    bounds.max.x = lm2_max_f32(bounds.max.x, points[i].x);
+    bounds.max.y = lm2_max_f32(bounds.max.y, points[i].y);
+  }
+  bounds.min.x -= radius;
+  bounds.min.y -= radius;
+  bounds.max.x += radius;
+  bounds.max.y += radius;
+  return bounds;
+}
+
+LM2_API lm2_r2_f32 lm2_shape2_bounds_f32(lm2_shape2_f32 shape) {
+  LM2_ASSERT(shape.data != NULL);
+  switch (shape.type) {
+    case LM2_SHAPE2_CIRCLE: {
+      const lm2_circle_f32* circle = (const lm2_circle_f32*)shape.data;
+      return _lm2_shape2_points_bounds_f32(&circle->center, 1, circle->radius);
+    }
+    case LM2_SHAPE2_CAPSULE: {
+      const lm2_capsule2_f32* capsule = (const lm2_capsule2_f32*)shape.data;
+      lm2_v2_f32 points[2] = {capsule->start, capsule->end};
+      return _lm2_shape2_points_bounds_f32(points, 2, capsule->radius);
+    }
+    case LM2_SHAPE2_AABB2:
+      return *(const lm2_aabb2_f32*)shape.data;
+    case LM2_SHAPE2_TRIANGLE:
+      return _lm2_shape2_points_bounds_f32(*(const lm2_triangle2_f32*)shape.data, 3, 0);
+    case LM2_SHAPE2_POLYGON: {
+      const lm2_polygon_f32* polygon = (const lm2_polygon_f32*)shape.data;
+      LM2_ASSERT(polygon->vertices != NULL && polygon->vertex_count > 0);
+      return _lm2_shape2_points_bounds_f32(polygon->vertices, polygon->vertex_count, 0);
+    }
+    case LM2_SHAPE2_EDGE: {
+      const lm2_edge2_f32* edge = (const lm2_edge2_f32*)shape.data;
+      lm2_v2_f32 points[2] = {edge->start, edge->end};
+      return _lm2_shape2_points_bounds_f32(points, 2, 0);
+    }
+  }
+  LM2_ASSERT(false);
+  lm2_r2_f32 bounds;
+  bounds.min = bounds.max = lm2_v2_make_f32(0, 0);
+  return bounds;
+}
@@ -0,0 +1,400 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <lm2/geometry2d/lm2_toi2.h>
+#include <lm2/scalar/lm2_scalar.h>
+#include <lm2/vectors/lm2_vector2.h>
+#include <lm2/vectors/lm2_vector_specifics.h>
+#include <math.h>
+#include "../misc/lm2_parallel.h"
+
+#define _LM2_TOI2_MAX_ITERATIONS 32
+#define _LM2_GJK2_MAX_ITERATIONS 32
+#define _LM2_TOI2_MIN_RANGE 256
+
+// =============================================================================
+// Shape Cores
+// =============================================================================
+// A shape is a convex point set plus a radius. Polygons point at their own
+// vertices, every other shape copies its few points into the proxy.
+
+#define _LM2_IMPL_TOI2_PROXY(scalar_type, S)                                                 \
+  typedef struct _lm2_toi2_proxy_##S {                                                       \
+    const lm2_v2_##S* vertices;                                                              \
+    size_t count;                                                                            \
+    scalar_type radius;                                                                      \
+    lm2_v2_##S storage[4];                                                                   \
+  } _lm2_toi2_proxy_##S;                                                                     \
+                                                                                             \
+  static void _lm2_toi2_proxy_from_shape_##S(lm2_shape2_##S shape, _lm2_toi2_proxy_##S* p) { \
+    p->vertices = p->storage;                                                                \
+    p->count = 0;                                                                            \
+    p->radius = 0;                                                                           \
+    switch (shape.type) {                                                                    \
+      case LM2_SHAPE2_CIRCLE: {                                                              \
+        const lm2_circle_##S* c = (const lm2_circle_##S*)shape.data;                         \
+        p->storage[0] = c->center;                                                           \
+        p->count = 1;                                                                        \
+        p->radius = c->radius;                                                               \
+        break;                                                                               \
+      }                                                                                      \
+      case LM2_SHAPE2_CAPSULE: {                                                             \
+        const lm2_capsule2_##S* c = (const lm2_capsule2_##S*)shape.data;                     \
+        p->storage[0] = c->start;                                                            \
+        p->storage[1] = c->end;                                                              \
+        p->count = 2;                                                                        \
+        p->radius = c->radius;                                                               \
+        break;                                                                               \
+      }                                                                                      \
+      case LM2_SHAPE2_AABB2: {                                                               \
+        const lm2_aabb2_##S* box = (const lm2_aabb2_##S*)shape.data;                         \
+        p->storage[0] = box->min;                                                            \
+        p->storage[1] = lm2_v2_make_##S(box->max.x, box->min.y);                             \
+        p->storage[2] = box->max;                                                            \
+        p->storage[3] = lm2_v2_make_##S(box->min.x, box->max.y);                             \
+        p->count = 4;                                                                        \
+        break;                                                                               \
+      }                                                                                      \
+      case LM2_SHAPE2_TRIANGLE: {                                                            \
+        const lm2_v2_##S* tri = (const lm2_v2_##S*)shape.data;                               \
+        p->storage[0] = tri[0];                                                              \
+        p->storage[1] = tri[1];                                                              \
+        p->storage[2] = tri[2];                                                              \
+        p->count = 3;                                                                        \
+        break;                                                                               \
+      }                                                                                      \
+      case LM2_SHAPE2_POLYGON: {                                                             \
+        const lm2_polygon_##S* poly = (const lm2_polygon_##S*)shape.data;                    \
+        p->vertices = poly->vertices;                                                        \
+        p->count = poly->vertex_count;                                                       \
+        break;                                                                               \
+      }                                                                                      \
+      case LM2_SHAPE2_EDGE: {                                                                \
+        const lm2_edge2_##S* e = (const lm2_edge2_##S*)shape.data;                           \
+        p->storage[0] = e->start;                                                            \
+        p->storage[1] = e->end;                                                              \
+        p->count = 2;                                                                        \
+        break;                                                                               \
+      }                                                                                      \
+    }                                                                                        \
+    LM2_ASSERT(p->count > 0);                                                                \
+  }
+
+// =============================================================================
+// GJK
+// =============================================================================
+// Distance between two translated cores. The Minkowski difference is
+// D = B - A, so the closest point of D to the origin is the vector from A to
+// B. The simplex solvers are the barycentric ones from Box2D's b2Distance.
+// Simplex vertices keep their proxy indices: the next advancement step starts
+// from them, and a repeated support pair ends the iteration.
+
+#define _LM2_IMPL_TOI2_GJK(scalar_type, S, eps)                                                                                               \
+  typedef struct _lm2_gjk2_vertex_##S {                                                                                                       \
+    lm2_v2_##S wa, wb, w;                                                                                                                     \
+    scalar_type bary;                                                                                                                         \
+    size_t ia, ib;                                                                                                                            \
+  } _lm2_gjk2_vertex_##S;                                                                                                                     \
+                                                                                                                                              \
+  typedef struct _lm2_gjk2_simplex_##S {                                                                                                      \
+    _lm2_gjk2_vertex_##S v[3];                                                                                                                \
+    int count;                                                                                                                                \
+  } _lm2_gjk2_simplex_##S;                                                                                                                    \
+                                                                                                                                              \
+  static size_t _lm2_gjk2_support_##S(const _lm2_toi2_proxy_##S* p, lm2_v2_##S d) {                                                           \
+    size_t best = 0;                                                                                                                          \
+    scalar_type best_dot = lm2_v2_dot_##S(p->vertices[0], d);                                                                                 \
+    for (size_t i = 1; i < p->count; i++) {                                                                                                   \
+      scalar_type dot = lm2_v2_dot_##S(p->vertices[i], d);                                                                                    \
+      if (dot > best_dot) {                                                                                                                   \
+        best = i;                                                                                                                             \
+        best_dot = dot;                                                                                                                       \
+      }                                                                                                                                       \
+    }                                                                                                                                         \
+    return best;                                                                                                                              \
+  }                                                                                                                                           \
+                                                                                                                                              \
+  static _lm2_gjk2_vertex_##S _lm2_gjk2_make_vertex_##S(const _lm2_toi2_proxy_##S* a, lm2_v2_##S offset_a, const _lm2_toi2_proxy_##S* b,      \
+                                                       lm2_v2_##S offset_b, size_t ia, size_t ib) {                                           \
+    _lm2_gjk2_vertex_##S v;                                                                                                                   \
+    v.ia = ia;                                                                                                                                \
+    v.ib = ib;                                                                                                                                \
+    v.wa = lm2_v2_add_##S(a->vertices[ia], offset_a);                                                                                         \
+    v.wb = lm2_v2_add_##S(b->vertices[ib], offset_b);                                                                                         \
+    v.w = lm2_v2_sub_##S(v.wb, v.wa);                                                                                                         \
+    v.bary = 1;                                                                                                                               \
+    return v;                                                                                                                                 \
+  }                                                                                                                                           \
+                                                                                                                                              \
+  static void _lm2_gjk2_solve2_##S(_lm2_gjk2_simplex_##S* s) {                                                                                \
+    lm2_v2_##S a = s->v[0].w;                                                                                                                 \
+    lm2_v2_##S e = lm2_v2_sub_##S(s->v[1].w, a);                                                                                              \
+    scalar_type ee = lm2_v2_dot_##S(e, e);                                                                                                    \
+    scalar_type t = ee > 0 ? -lm2_v2_dot_##S(a, e) / ee : 0;                                                                                  \
+    if (t <= 0) {                                                                                                                             \
+      s->v[0].bary = 1;                                                                                                                       \
+      s->count = 1;                                                                                                                           \
+    } else if (t >= 1) {                                                                                                                      \
+      s->v[0] = s->v[1];                                                                                                                      \
+      s->v[0].bary = 1;                                                                                                                       \
+      s->count = 1;                                                                                                                           \
+    } else {                                                                                                                                  \
+      s->v[0].bary = 1 - t;                                                                                                                   \
+      s->v[1].bary = t;                                                                                                                       \
+    }                                                                                                                                         \
+  }                                                                                                                                           \
+                                                                                                                                              \
+  /* Keeps the vertices i and j of a triangle with weights wi and wj */                                                                       \
+  static void _lm2_gjk2_keep_##S(_lm2_gjk2_simplex_##S* s, int i, scalar_type wi, int j, scalar_type wj) {                                    \
+    _lm2_gjk2_vertex_##S vi = s->v[i];                                                                                                        \
+    _lm2_gjk2_vertex_##S vj = s->v[j];                                                                                                        \
+    scalar_type inv = 1 / (wi + wj);                                                                                                          \
+    s->v[0] = vi;                                                                                                                             \
+    s->v[0].bary = wi * inv;                                                                                                                  \
+    s->v[1] = vj;                                                                                                                             \
+    s->v[1].bary = wj * inv;                                                                                                                  \
+    s->count = 2;                                                                                                                             \
+  }                                                                                                                                           \
+                                                                                                                                              \
+  static void _lm2_gjk2_keep_one_##S(_lm2_gjk2_simplex_##S* s, int i) {                                                                       \
+    s->v[0] = s->v[i];                                                                                                                        \
+    s->v[0].bary = 1;                                                                                                                         \
+    s->count = 1;                                                                                                                             \
+  }                                                                                                                                           \
+                                                                                                                                              \
+  /* Returns true when the origin is inside the triangle */                                                                                   \
+  static bool _lm2_gjk2_solve3_##S(_lm2_gjk2_simplex_##S* s) {                                                                                \
+    lm2_v2_##S w1 = s->v[0].w;                                                                                                                \
+    lm2_v2_##S w2 = s->v[1].w;                                                                                                                \
+    lm2_v2_##S w3 = s->v[2].w;                                                                                                                \
+    lm2_v2_##S e12 = lm2_v2_sub_##S(w2, w1);                                                                                                  \
+    lm2_v2_##S e13 = lm2_v2_sub_##S(w3, w1);                                                                                                  \
+    lm2_v2_##S e23 = lm2_v2_sub_##S(w3, w2);                                                                                                  \
+    scalar_type d12_1 = lm2_v2_dot_##S(w2, e12);                                                                                              \
+    scalar_type d12_2 = -lm2_v2_dot_##S(w1, e12);                                                                                             \
+    scalar_type d13_1 = lm2_v2_dot_##S(w3, e13);                                                                                              \
+    scalar_type d13_2 = -lm2_v2_dot_##S(w1, e13);                                                                                             \
+    scalar_type d23_1 = lm2_v2_dot_##S(w3, e23);                                                                                              \
+    scalar_type d23_2 = -lm2_v2_dot_##S(w2, e23);                                                                                             \
+    scalar_type n123 = lm2_v2_cross_##S(e12, e13);                                                                                            \
+    scalar_type d123_1 = n123 * lm2_v2_cross_##S(w2, w3);                                                                                     \
+    scalar_type d123_2 = n123 * lm2_v2_cross_##S(w3, w1);                                                                                     \
+    scalar_type d123_3 = n123 * lm2_v2_cross_##S(w1, w2);                                                                                     \
+    if (d12_2 <= 0 && d13_2 <= 0) {                                                                                                           \
+      _lm2_gjk2_keep_one_##S(s, 0);                                                                                                           \
+    } else if (d12_1 > 0 && d12_2 > 0 && d123_3 <= 0) {                                                                                       \
+      _lm2_gjk2_keep_##S(s, 0, d12_1, 1, d12_2);                                                                                              \
+    } else if (d13_1 > 0 && d13_2 > 0 && d123_2 <= 0) {                                                                                       \
+      _lm2_gjk2_keep_##S(s, 0, d13_1, 2, d13_2);                                                                                              \
+    } else if (d12_1 <= 0 && d23_2 <= 0) {                                                                                                    \
+      _lm2_gjk2_keep_one_##S(s, 1);                                                                                                           \
+    } else if (d13_1 <= 0 && d23_1 <= 0) {                                                                                                    \
+      _lm2_gjk2_keep_one_##S(s, 2);                                                                                                           \
+    } else if (d23_1 > 0 && d23_2 > 0 && d123_1 <= 0) {                                                                                       \
+      _lm2_gjk2_keep_##S(s, 1, d23_1, 2, d23_2);                                                                                              \
+    } else {                                                                                                                                  \
+      return true;                                                                                                                            \
+    }                                                                                                                                         \
+    return false;                                                                                                                             \
+  }                                                                                                                                           \
+                                                                                                                                              \
+  static void _lm2_gjk2_witness_##S(const _lm2_gjk2_simplex_##S* s, lm2_v2_##S* pa, lm2_v2_##S* pb) {                                         \
+    *pa = lm2_v2_zero_##S();                                                                                                                  \
+    *pb = lm2_v2_zero_##S();                                                                                                                  \
+    for (int i = 0; i < s->count; i++) {                                                                                                      \
+      *pa = lm2_v2_add_##S(*pa, lm2_v2_mul_s_##S(s->v[i].wa, s->v[i].bary));                                                                  \
+      *pb = lm2_v2_add_##S(*pb, lm2_v2_mul_s_##S(s->v[i].wb, s->v[i].bary));                                                                  \
+    }                                                                                                                                         \
+  }                                                                                                                                           \
+                                                                                                                                              \
+  /* Runs GJK on the translated cores, starting from the simplex in s. Returns                                                                \
+     true when they overlap; otherwise v is the vector from A to B. */                                                                        \
+  static bool _lm2_gjk2_run_##S(const _lm2_toi2_proxy_##S* a, lm2_v2_##S offset_a, const _lm2_toi2_proxy_##S* b, lm2_v2_##S offset_b,         \
+                                _lm2_gjk2_simplex_##S* s, lm2_v2_##S* out_v) {                                                                \
+    for (int i = 0; i < s->count; i++) {                                                                                                      \
+      s->v[i] = _lm2_gjk2_make_vertex_##S(a, offset_a, b, offset_b, s->v[i].ia, s->v[i].ib);                                                  \
+    }                                                                                                                                         \
+    if (s->count == 0) {                                                                                                                      \
+      s->v[0] = _lm2_gjk2_make_vertex_##S(a, offset_a, b, offset_b, 0, 0);                                                                    \
+      s->count = 1;                                                                                                                           \
+    }                                                                                                                                         \
+    bool overlap = false;                                                                                                                     \
+    lm2_v2_##S v = s->v[0].w;                                                                                                                 \
+    for (int iteration = 0; iteration < _LM2_GJK2_MAX_ITERATIONS; iteration++) {                                                              \
+      size_t saved_a[3], saved_b[3];                                                                                                          \
+      int saved_count = s->count;                                                                                                             \
+      for (int i = 0; i < s->count; i++) {                                                                                                    \
+        saved_a[i] = s->v[i].ia;                                                                                                              \
+        saved_b[i] = s->v[i].ib;                                                                                                              \
+      }                                                                                                                                       \
+      if (s->count == 1) {                                                                                                                    \
+        s->v[0].bary = 1;                                                                                                                     \
+      } else if (s->count == 2) {                                                                                                             \
+        _lm2_gjk2_solve2_##S(s);                                                                                                              \
+      } else if (_lm2_gjk2_solve3_##S(s)) {                                                                                                   \
+        overlap = true;                                                                                                                       \
+        break;                                                                                                                                \
+      }                                                                                                                                       \
+      v = lm2_v2_zero_##S();                                                                                                                  \
+      scalar_type scale = 0;                                                                                                                  \
+      for (int i = 0; i < s->count; i++) {                                                                                                    \
+        v = lm2_v2_add_##S(v, lm2_v2_mul_s_##S(s->v[i].w, s->v[i].bary));                                                                     \
+        scale = lm2_max_##S(scale, lm2_v2_length_sq_##S(s->v[i].w));                                                                          \
+      }                                                                                                                                       \
+      scalar_type vv = lm2_v2_dot_##S(v, v);                                                                                                  \
+      if (vv <= eps * eps * scale) {                                                                                                          \
+        overlap = true;                                                                                                                       \
+        break;                                                                                                                                \
+      }                                                                                                                                       \
+      lm2_v2_##S d = lm2_v2_neg_##S(v);                                                                                                       \
+      _lm2_gjk2_vertex_##S w = _lm2_gjk2_make_vertex_##S(a, offset_a, b, offset_b, _lm2_gjk2_support_##S(a, v), _lm2_gjk2_support_##S(b, d)); \
+      bool duplicate = false;                                                                                                                 \
+      for (int i = 0; i < saved_count; i++) {                                                                                                 \
+        if (saved_a[i] == w.ia && saved_b[i] == w.ib) {                                                                                       \
+          duplicate = true;                                                                                                                   \
+          break;                                                                                                                              \
+        }                                                                                                                                     \
+      }                                                                                                                                       \
+      if (duplicate || vv - lm2_v2_dot_##S(v, w.w) <= eps * vv) {                                                                             \
+        break;                                                                                                                                \
+      }                                                                                                                                       \
+      s->v[s->count++] = w;                                                                                                                   \
+    }                                                                                                                                         \
+    *out_v = v;                                                                                                                               \
+    return overlap;                                                                                                                           \
+  }
+
+// =============================================================================
+// Conservative Advancement
+// =============================================================================
+// Each step moves both shapes to t, measures the surface distance d along the
+// separating normal n and advances t by d / closing speed, aiming just short of
+// contact. The pair hits once d drops under the tolerance, and misses when the
+// shapes stop closing or t passes the end of the step.
+
+#define _LM2_IMPL_TOI2(scalar_type, S, eps)                                                                                                \
+  LM2_API lm2_toi2_result_##S lm2_toi2_shape_to_shape_##S(lm2_shape2_##S shape_a, lm2_v2_##S velocity_a, lm2_shape2_##S shape_b,           \
+                                                           lm2_v2_##S velocity_b) {                                                        \
+    _lm2_toi2_proxy_##S a, b;                                                                                                              \
+    _lm2_toi2_proxy_from_shape_##S(shape_a, &a);                                                                                           \
+    _lm2_toi2_proxy_from_shape_##S(shape_b, &b);                                                                                           \
+    lm2_toi2_result_##S result;                                                                                                            \
+    result.hit = false;                                                                                                                    \
+    result.toi = 1;                                                                                                                        \
+    result.normal = lm2_v2_zero_##S();                                                                                                     \
+    result.point = lm2_v2_zero_##S();                                                                                                      \
+    result.iterations = 0;                                                                                                                 \
+                                                                                                                                           \
+    /* The tolerance follows the coordinate magnitude of the query */                                                                      \
+    scalar_type radius = a.radius + b.radius;                                                                                              \
+    lm2_v2_##S extent = lm2_v2_add_##S(lm2_v2_abs_##S(a.vertices[0]), lm2_v2_abs_##S(b.vertices[0]));                                      \
+    scalar_type scale = lm2_max_##S(extent.x, extent.y) + radius + lm2_v2_length_##S(velocity_a) + lm2_v2_length_##S(velocity_b);          \
+    scalar_type tolerance = eps * lm2_max_##S(1, scale);                                                                                   \
+    lm2_v2_##S closing_velocity = lm2_v2_sub_##S(velocity_a, velocity_b);                                                                  \
+                                                                                                                                           \
+    _lm2_gjk2_simplex_##S s;                                                                                                               \
+    s.count = 0;                                                                                                                           \
+    scalar_type t = 0;                                                                                                                     \
+    while (result.iterations < _LM2_TOI2_MAX_ITERATIONS) {                                                                                 \
+      result.iterations++;                                                                                                                 \
+      lm2_v2_##S offset_a = lm2_v2_mul_s_##S(velocity_a, t);                                                                               \
+      lm2_v2_##S offset_b = lm2_v2_mul_s_##S(velocity_b, t);                                                                               \
+      lm2_v2_##S v;                                                                                                                        \
+      bool overlap = _lm2_gjk2_run_##S(&a, offset_a, &b, offset_b, &s, &v);                                                                \
+      lm2_v2_##S pa, pb;                                                                                                                   \
+      _lm2_gjk2_witness_##S(&s, &pa, &pb);                                                                                                 \
+      if (overlap) {                                                                                                                       \
+        result.hit = true;                                                                                                                 \
+        result.toi = t;                                                                                                                    \
+        result.point = lm2_v2_mul_s_##S(lm2_v2_add_##S(pa, pb), (scalar_type)0.5);                                                         \
+        return result;                                                                                                                     \
+      }                                                                                                                                    \
+      scalar_type dist = lm2_v2_length_##S(v);                                                                                             \
+      lm2_v2_##S n = lm2_v2_mul_s_##S(v, 1 / dist);                                                                                        \
+      scalar_type d = dist - radius;                                                                                                       \
+      if (d <= tolerance) {                                                                                                                \
+        lm2_v2_##S sa = lm2_v2_add_##S(pa, lm2_v2_mul_s_##S(n, a.radius));                                                                 \
+        lm2_v2_##S sb = lm2_v2_sub_##S(pb, lm2_v2_mul_s_##S(n, b.radius));                                                                 \
+        result.hit = true;                                                                                                                 \
+        result.toi = t;                                                                                                                    \
+        result.normal = n;                                                                                                                 \
+        result.point = lm2_v2_mul_s_##S(lm2_v2_add_##S(sa, sb), (scalar_type)0.5);                                                         \
+        return result;                                                                                                                     \
+      }                                                                                                                                    \
+      scalar_type closing = lm2_v2_dot_##S(closing_velocity, n);                                                                           \
+      if (!(closing > 0)) {                                                                                                                \
+        return result;                                                                                                                     \
+      }                                                                                                                                    \
+      t += (d - (scalar_type)0.5 * tolerance) / closing;                                                                                   \
+      if (t > 1) {                                                                                                                         \
+        return result;                                                                                                                     \
+      }                                                                                                                                    \
+    }                                                                                                                                      \
+    /* Out of steps: t is still a safe lower bound of the time of impact */                                                                \
+    result.hit = true;                                                                                                                     \
+    result.toi = t;                                                                                                                        \
+    return result;                                                                                                                         \
+  }                                                                                                                                        \
+                                                                                                                                           \
+  typedef struct _lm2_toi2_batch_##S {                                                                                                     \
+    const lm2_shape2_##S* shapes;                                                                                                          \
+    const lm2_v2_##S* velocities;                                                                                                          \
+    const lm2_narrowphase2_pair* pairs;                                                                                                    \
+    lm2_toi2_result_##S* out;                                                                                                              \
+  } _lm2_toi2_batch_##S;                                                                                                                   \
+                                                                                                                                           \
+  static void _lm2_toi2_task_##S(void* context, size_t begin, size_t end) {                                                                \
+    const _lm2_toi2_batch_##S* batch = (const _lm2_toi2_batch_##S*)context;                                                                \
+    for (size_t i = begin; i < end; i++) {                                                                                                 \
+      lm2_narrowphase2_pair p = batch->pairs[i];                                                                                           \
+      batch->out[i] = lm2_toi2_shape_to_shape_##S(batch->shapes[p.a], batch->velocities[p.a], batch->shapes[p.b], batch->velocities[p.b]); \
+    }                                                                                                                                      \
+  }                                                                                                                                        \
+                                                                                                                                           \
+  LM2_API size_t lm2_toi2_collide_##S(const lm2_shape2_##S* shapes, const lm2_v2_##S* velocities, const lm2_narrowphase2_pair* pairs,      \
+                                      size_t pair_count, lm2_toi2_result_##S* out_results, uint32_t thread_count) {                        \
+    LM2_ASSERT(pair_count == 0 || (shapes != NULL && velocities != NULL && pairs != NULL && out_results != NULL));                         \
+    _lm2_toi2_batch_##S batch;                                                                                                             \
+    batch.shapes = shapes;                                                                                                                 \
+    batch.velocities = velocities;                                                                                                         \
+    batch.pairs = pairs;                                                                                                                   \
+    batch.out = out_results;                                                                                                               \
+    lm2_parallel_for(pair_count, _LM2_TOI2_MIN_RANGE, thread_count, _lm2_toi2_task_##S, &batch);                                           \
+    size_t hits = 0;                                                                                                                       \
+    for (size_t i = 0; i < pair_count; i++) {                                                                                              \
+      hits += out_results[i].hit;                                                                                                          \
+    }                                                                                                                                      \
+    return hits;                                                                                                                           \
+  }
+
+// =============================================================================
+// Instantiations
+// =============================================================================
+
+_LM2_IMPL_TOI2_PROXY(double, f64)
+_LM2_IMPL_TOI2_PROXY(float, f32)
+_LM2_IMPL_TOI2_GJK(double, f64, 1e-10)
+_LM2_IMPL_TOI2_GJK(float, f32, 1e-5f)
+_LM2_IMPL_TOI2(double, f64, 1e-9)
+_LM2_IMPL_TOI2(float, f32, 1e-4f)
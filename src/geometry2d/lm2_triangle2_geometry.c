@@ -25,8 +25,9 @@ SOFTWARE.
 #include <lm2/geometry2d/lm2_triangle2_geometry.h>
 #include <lm2/scalar/lm2_safe_ops.h>
 #include <lm2/scalar/lm2_scalar.h>
-#include <stdlib.h>  // For malloc, free
 #include <string.h>  // For memcpy
+#include "../misc/lm2_scratch.h"
+#include "../misc/lm2_vertex_weld.h"
 
 // =============================================================================
 // Triangle List to Vertex Array Conversion
@@ -145,125 +146,200 @@ LM2_API void lm2_vertex_array_to_triangle_list_f32(
 }
 
 // =============================================================================
-// Helper Functions for Vertex Deduplication
+// Triangle List to Indexed Mesh Conversion
 // =============================================================================
+// Vertices weld through the cell hash of ../misc/lm2_vertex_weld.h, so the
+// conversion runs in expected linear time. Unique vertices keep the order of
+// their first occurrence, and the parallel variants give the same result.
 
-static bool _lm2_vertices_equal_f64(lm2_v2_f64 a, lm2_v2_f64 b, double epsilon) {
-  double dx = lm2_abs_f64(lm2_sub_f64(a.x, b.x));
-  double dy = lm2_abs_f64(lm2_sub_f64(a.y, b.y));
-  return dx <= epsilon && dy <= epsilon;
-}
+static lm2_indexed_mesh_size _lm2_triangle2_list_to_indexed_mesh_size_f64(
+    const lm2_triangle2_f64* triangles,
+    size_t triangle_count,
+    double epsilon,
+    uint32_t thread_count,
+    lm2_arena* arena) {
+  LM2_ASSERT(triangles != NULL);
 
-static bool _lm2_vertices_equal_f32(lm2_v2_f32 a, lm2_v2_f32 b, float epsilon) {
-  float dx = lm2_abs_f32(lm2_sub_f32(a.x, b.x));
-  float dy = lm2_abs_f32(lm2_sub_f32(a.y, b.y));
-  return dx <= epsilon && dy <= epsilon;
-}
+  lm2_indexed_mesh_size result = {0, 0};
+  result.index_count = lm2_mul_u64(triangle_count, 3);
 
-static uint32_t _lm2_find_or_add_vertex_f64(
-    lm2_v2_f64 vertex,
-    lm2_v2_f64* vertices,
-    uint32_t* vertex_count,
-    double epsilon) {
-  // Search for existing vertex
-  for (uint32_t i = 0; i < *vertex_count; i = lm2_add_u32(i, 1)) {
-    if (_lm2_vertices_equal_f64(vertices[i], vertex, epsilon)) {
-      return i;
-    }
+  // Temporary buffers for the weld; without them report the worst case
+  size_t mark = lm2_scratch_begin(arena);
+  size_t buffer_size = result.index_count > 0 ? result.index_count : 1;
+  uint32_t* remap = (uint32_t*)lm2_scratch_alloc(arena, buffer_size * sizeof(uint32_t));
+  uint32_t* unique = (uint32_t*)lm2_scratch_alloc(arena, buffer_size * sizeof(uint32_t));
+  if (remap == NULL || unique == NULL) {
+    lm2_scratch_free(arena, unique);
+    lm2_scratch_free(arena, remap);
+    lm2_scratch_end(arena, mark);
+    result.vertex_count = result.index_count;
+    return result;
   }
 
-  // Add new vertex
-  uint32_t index = *vertex_count;
-  vertices[index] = vertex;
-  *vertex_count = lm2_add_u32(*vertex_count, 1);
-  return index;
+  result.vertex_count = lm2_vertex_weld_f64(
+      (const double*)triangles,
+      result.index_count,
+      2,
+      epsilon,
+      thread_count,
+      remap,
+      unique,
+      arena);
+
+  lm2_scratch_free(arena, unique);
+  lm2_scratch_free(arena, remap);
+  lm2_scratch_end(arena, mark);
+  return result;
 }
 
-static uint32_t _lm2_find_or_add_vertex_f32(
-    lm2_v2_f32 vertex,
-    lm2_v2_f32* vertices,
-    uint32_t* vertex_count,
-    float epsilon) {
-  // Search for existing vertex
-  for (uint32_t i = 0; i < *vertex_count; i = lm2_add_u32(i, 1)) {
-    if (_lm2_vertices_equal_f32(vertices[i], vertex, epsilon)) {
-      return i;
-    }
+static void _lm2_triangle2_list_to_indexed_mesh_f64(
+    const lm2_triangle2_f64* triangles,
+    size_t triangle_count,
+    double epsilon,
+    lm2_v2_f64* vertices,
+    size_t vertex_buffer_size,
+    uint32_t* indices,
+    size_t index_buffer_size,
+    uint32_t thread_count,
+    lm2_arena* arena) {
+  LM2_ASSERT(triangles != NULL);
+  LM2_ASSERT(vertices != NULL);
+  LM2_ASSERT(indices != NULL);
+
+  size_t required_index_count = lm2_mul_u64(triangle_count, 3);
+  LM2_ASSERT(index_buffer_size >= required_index_count);
+
+  // The weld writes the indices directly and lists the input slot of every unique vertex
+  size_t mark = lm2_scratch_begin(arena);
+  size_t buffer_size = required_index_count > 0 ? required_index_count : 1;
+  uint32_t* unique = (uint32_t*)lm2_scratch_alloc(arena, buffer_size * sizeof(uint32_t));
+  LM2_ASSERT(unique != NULL);
+
+  uint32_t vertex_count = lm2_vertex_weld_f64(
+      (const double*)triangles,
+      required_index_count,
+      2,
+      epsilon,
+      thread_count,
+      indices,
+      unique,
+      arena);
+  LM2_ASSERT(vertex_count <= vertex_buffer_size);
+
+  const lm2_v2_f64* source = (const lm2_v2_f64*)triangles;
+  for (uint32_t i = 0; i < vertex_count; i = lm2_add_u32(i, 1)) {
+    vertices[i] = source[unique[i]];
   }
 
-  // Add new vertex
-  uint32_t index = *vertex_count;
-  vertices[index] = vertex;
-  *vertex_count = lm2_add_u32(*vertex_count, 1);
-  return index;
+  lm2_scratch_free(arena, unique);
+  lm2_scratch_end(arena, mark);
 }
 
-// =============================================================================
-// Triangle List to Indexed Mesh Conversion
-// =============================================================================
-
-LM2_API lm2_indexed_mesh_size lm2_triangle2_list_to_indexed_mesh_size_f64(
-    const lm2_triangle2_f64* triangles,
+static lm2_indexed_mesh_size _lm2_triangle2_list_to_indexed_mesh_size_f32(
+    const lm2_triangle2_f32* triangles,
     size_t triangle_count,
-    double epsilon) {
+    float epsilon,
+    uint32_t thread_count,
+    lm2_arena* arena) {
   LM2_ASSERT(triangles != NULL);
 
   lm2_indexed_mesh_size result = {0, 0};
-  size_t max_vertices = lm2_mul_u64(triangle_count, 3);
+  result.index_count = lm2_mul_u64(triangle_count, 3);
 
-  // Allocate temporary buffer to perform actual vertex deduplication
-  lm2_v2_f64* temp_vertices = (lm2_v2_f64*)malloc(max_vertices * sizeof(lm2_v2_f64));
-  if (temp_vertices == NULL) {
-    result.vertex_count = max_vertices;
-    result.index_count = max_vertices;
+  // Temporary buffers for the weld; without them report the worst case
+  size_t mark = lm2_scratch_begin(arena);
+  size_t buffer_size = result.index_count > 0 ? result.index_count : 1;
+  uint32_t* remap = (uint32_t*)lm2_scratch_alloc(arena, buffer_size * sizeof(uint32_t));
+  uint32_t* unique = (uint32_t*)lm2_scratch_alloc(arena, buffer_size * sizeof(uint32_t));
+  if (remap == NULL || unique == NULL) {
+    lm2_scratch_free(arena, unique);
+    lm2_scratch_free(arena, remap);
+    lm2_scratch_end(arena, mark);
+    result.vertex_count = result.index_count;
     return result;
   }
 
-  uint32_t vertex_count = 0;
-  for (size_t i = 0; i < triangle_count; i = lm2_add_u64(i, 1)) {
-    for (int j = 0; j < 3; j++) {
-      _lm2_find_or_add_vertex_f64(triangles[i][j], temp_vertices, &vertex_count, epsilon);
-    }
-  }
-
-  free(temp_vertices);
-
-  result.vertex_count = vertex_count;
-  result.index_count = lm2_mul_u64(triangle_count, 3);
-
+  result.vertex_count = lm2_vertex_weld_f32(
+      (const float*)triangles,
+      result.index_count,
+      2,
+      epsilon,
+      thread_count,
+      remap,
+      unique,
+      arena);
+
+  lm2_scratch_free(arena, unique);
+  lm2_scratch_free(arena, remap);
+  lm2_scratch_end(arena, mark);
   return result;
 }
 
-LM2_API lm2_indexed_mesh_size lm2_triangle2_list_to_indexed_mesh_size_f32(
+static void _lm2_triangle2_list_to_indexed_mesh_f32(
     const lm2_triangle2_f32* triangles,
     size_t triangle_count,
-    float epsilon) {
+    float epsilon,
+    lm2_v2_f32* vertices,
+    size_t vertex_buffer_size,
+    uint32_t* indices,
+    size_t index_buffer_size,
+    uint32_t thread_count,
+    lm2_arena* arena) {
   LM2_ASSERT(triangles != NULL);
+  LM2_ASSERT(vertices != NULL);
+  LM2_ASSERT(indices != NULL);
 
-  lm2_indexed_mesh_size result = {0, 0};
-  size_t max_vertices = lm2_mul_u64(triangle_count, 3);
+  size_t required_index_count = lm2_mul_u64(triangle_count, 3);
+  LM2_ASSERT(index_buffer_size >= required_index_count);
 
-  // Allocate temporary buffer to perform actual vertex deduplication
-  lm2_v2_f32* temp_vertices = (lm2_v2_f32*)malloc(max_vertices * sizeof(lm2_v2_f32));
-  if (temp_vertices == NULL) {
-    result.vertex_count = max_vertices;
-    result.index_count = max_vertices;
-    return result;
+  // The weld writes the indices directly and lists the input slot of every unique vertex
+  size_t mark = lm2_scratch_begin(arena);
+  size_t buffer_size = required_index_count > 0 ? required_index_count : 1;
+  uint32_t* unique = (uint32_t*)lm2_scratch_alloc(arena, buffer_size * sizeof(uint32_t));
+  LM2_ASSERT(unique != NULL);
+
+  uint32_t vertex_count = lm2_vertex_weld_f32(
+      (const float*)triangles,
+      required_index_count,
+      2,
+      epsilon,
+      thread_count,
+      indices,
+      unique,
+      arena);
+  LM2_ASSERT(vertex_count <= vertex_buffer_size);
+
+  const lm2_v2_f32* source = (const lm2_v2_f32*)triangles;
+  for (uint32_t i = 0; i < vertex_count; i = lm2_add_u32(i, 1)) {
+    vertices[i] = source[unique[i]];
   }
 
-  uint32_t vertex_count = 0;
-  for (size_t i = 0; i < triangle_count; i = lm2_add_u64(i, 1)) {
-    for (int j = 0; j < 3; j++) {
-      _lm2_find_or_add_vertex_f32(triangles[i][j], temp_vertices, &vertex_count, epsilon);
-    }
-  }
+  lm2_scratch_free(arena, unique);
+  lm2_scratch_end(arena, mark);
+}
 
-  free(temp_vertices);
+LM2_API lm2_indexed_mesh_size lm2_triangle2_list_to_indexed_mesh_size_f64(
+    const lm2_triangle2_f64* triangles,
+    size_t triangle_count,
+    double epsilon) {
+  return _lm2_triangle2_list_to_indexed_mesh_size_f64(triangles, triangle_count, epsilon, 1, lm2_arena_thread_default());
+}
 
-  result.vertex_count = vertex_count;
-  result.index_count = lm2_mul_u64(triangle_count, 3);
+LM2_API lm2_indexed_mesh_size lm2_triangle2_list_to_indexed_mesh_size_parallel_f64(
+    const lm2_triangle2_f64* triangles,
+    size_t triangle_count,
+    double epsilon,
+    uint32_t thread_count) {
+  return _lm2_triangle2_list_to_indexed_mesh_size_f64(
+      triangles, triangle_count, epsilon, thread_count, lm2_arena_thread_default());
+}
 
-  return result;
+LM2_API lm2_indexed_mesh_size lm2_triangle2_list_to_indexed_mesh_size_scratch_f64(
+    const lm2_triangle2_f64* triangles,
+    size_t triangle_count,
+    double epsilon,
+    lm2_arena* arena) {
+  return _lm2_triangle2_list_to_indexed_mesh_size_f64(triangles, triangle_count, epsilon, 1, arena);
 }
 
 LM2_API void lm2_triangle2_list_to_indexed_mesh_f64(
@@ -274,31 +350,74 @@ LM2_API void lm2_triangle2_list_to_indexed_mesh_f64(
     size_t vertex_buffer_size,
     uint32_t* indices,
     size_t index_buffer_size) {
-  LM2_ASSERT(triangles != NULL);
-  LM2_ASSERT(vertices != NULL);
-  LM2_ASSERT(indices != NULL);
+  _lm2_triangle2_list_to_indexed_mesh_f64(
+      triangles,
+      triangle_count,
+      epsilon,
+      vertices,
+      vertex_buffer_size,
+      indices,
+      index_buffer_size,
+      1,
+      lm2_arena_thread_default());
+}
 
-  size_t required_index_count = lm2_mul_u64(triangle_count, 3);
-  LM2_ASSERT(index_buffer_size >= required_index_count);
-  LM2_ASSERT(vertex_buffer_size >= triangle_count);  // At least this many
+LM2_API void lm2_triangle2_list_to_indexed_mesh_parallel_f64(
+    const lm2_triangle2_f64* triangles,
+    size_t triangle_count,
+    double epsilon,
+    lm2_v2_f64* vertices,
+    size_t vertex_buffer_size,
+    uint32_t* indices,
+    size_t index_buffer_size,
+    uint32_t thread_count) {
+  _lm2_triangle2_list_to_indexed_mesh_f64(
+      triangles,
+      triangle_count,
+      epsilon,
+      vertices,
+      vertex_buffer_size,
+      indices,
+      index_buffer_size,
+      thread_count,
+      lm2_arena_thread_default());
+}
 
-  uint32_t vertex_count = 0;
-  uint32_t index_count = 0;
+LM2_API void lm2_triangle2_list_to_indexed_mesh_scratch_f64(
+    const lm2_triangle2_f64* triangles,
+    size_t triangle_count,
+    double epsilon,
+    lm2_v2_f64* vertices,
+    size_t vertex_buffer_size,
+    uint32_t* indices,
+    size_t index_buffer_size,
+    lm2_arena* arena) {
+  _lm2_triangle2_list_to_indexed_mesh_f64(
+      triangles, triangle_count, epsilon, vertices, vertex_buffer_size, indices, index_buffer_size, 1, arena);
+}
 
-  for (size_t i = 0; i < triangle_count; i = lm2_add_u64(i, 1)) {
-    // Process each vertex of the triangle
-    for (int j = 0; j < 3; j++) {
-      uint32_t index = _lm2_find_or_add_vertex_f64(
-          triangles[i][j],
-          vertices,
-          &vertex_count,
-          epsilon);
-
-      LM2_ASSERT(vertex_count <= vertex_buffer_size);
-      indices[index_count] = index;
-      index_count = lm2_add_u32(index_count, 1);
-    }
-  }
+LM2_API lm2_indexed_mesh_size lm2_triangle2_list_to_indexed_mesh_size_f32(
+    const lm2_triangle2_f32* triangles,
+    size_t triangle_count,
+    float epsilon) {
+  return _lm2_triangle2_list_to_indexed_mesh_size_f32(triangles, triangle_count, epsilon, 1, lm2_arena_thread_default());
+}
+
+LM2_API lm2_indexed_mesh_size lm2_triangle2_list_to_indexed_mesh_size_parallel_f32(
+    const lm2_triangle2_f32* triangles,
+    size_t triangle_count,
+    float epsilon,
+    uint32_t thread_count) {
+  return _lm2_triangle2_list_to_indexed_mesh_size_f32(
+      triangles, triangle_count, epsilon, thread_count, lm2_arena_thread_default());
+}
+
+LM2_API lm2_indexed_mesh_size lm2_triangle2_list_to_indexed_mesh_size_scratch_f32(
+    const lm2_triangle2_f32* triangles,
+    size_t triangle_count,
+    float epsilon,
+    lm2_arena* arena) {
+  return _lm2_triangle2_list_to_indexed_mesh_size_f32(triangles, triangle_count, epsilon, 1, arena);
 }
 
 LM2_API void lm2_triangle2_list_to_indexed_mesh_f32(
@@ -309,31 +428,50 @@ LM2_API void lm2_triangle2_list_to_indexed_mesh_f32(
     size_t vertex_buffer_size,
     uint32_t* indices,
     size_t index_buffer_size) {
-  LM2_ASSERT(triangles != NULL);
-  LM2_ASSERT(vertices != NULL);
-  LM2_ASSERT(indices != NULL);
-
-  size_t required_index_count = lm2_mul_u64(triangle_count, 3);
-  LM2_ASSERT(index_buffer_size >= required_index_count);
-  LM2_ASSERT(vertex_buffer_size >= triangle_count);  // At least this many
+  _lm2_triangle2_list_to_indexed_mesh_f32(
+      triangles,
+      triangle_count,
+      epsilon,
+      vertices,
+      vertex_buffer_size,
+      indices,
+      index_buffer_size,
+      1,
+      lm2_arena_thread_default());
+}
 
-  uint32_t vertex_count = 0;
-  uint32_t index_count = 0;
+LM2_API void lm2_triangle2_list_to_indexed_mesh_parallel_f32(
+    const lm2_triangle2_f32* triangles,
+    size_t triangle_count,
+    float epsilon,
+    lm2_v2_f32* vertices,
+    size_t vertex_buffer_size,
+    uint32_t* indices,
+    size_t index_buffer_size,
+    uint32_t thread_count) {
+  _lm2_triangle2_list_to_indexed_mesh_f32(
+      triangles,
+      triangle_count,
+      epsilon,
+      vertices,
+      vertex_buffer_size,
+      indices,
+      index_buffer_size,
+      thread_count,
+      lm2_arena_thread_default());
+}
 
-  for (size_t i = 0; i < triangle_count; i = lm2_add_u64(i, 1)) {
-    // Process each vertex of the triangle
-    for (int j = 0; j < 3; j++) {
-      uint32_t index = _lm2_find_or_add_vertex_f32(
-          triangles[i][j],
-          vertices,
-          &vertex_count,
-          epsilon);
-
-      LM2_ASSERT(vertex_count <= vertex_buffer_size);
-      indices[index_count] = index;
-      index_count = lm2_add_u32(index_count, 1);
-    }
-  }
+LM2_API void lm2_triangle2_list_to_indexed_mesh_scratch_f32(
+    const lm2_triangle2_f32* triangles,
+    size_t triangle_count,
+    float epsilon,
+    lm2_v2_f32* vertices,
+    size_t vertex_buffer_size,
+    uint32_t* indices,
+    size_t index_buffer_size,
+    lm2_arena* arena) {
+  _lm2_triangle2_list_to_indexed_mesh_f32(
+      triangles, triangle_count, epsilon, vertices, vertex_buffer_size, indices, index_buffer_size, 1, arena);
 }
 
 // =============================================================================
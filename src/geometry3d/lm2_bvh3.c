@@ -0,0 +1,1030 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <lm2/geometry3d/lm2_bvh3.h>
+#include <math.h>
+#include "../misc/lm2_parallel.h"
+#include "../misc/lm2_scratch.h"
+
+// =============================================================================
+// BVH construction
+// =============================================================================
+// Top-down binned SAH build over per-triangle bounds and centroids. Every node
+// bins its triangle centroids into up to LM2_BVH3_BIN_COUNT slots per axis,
+// sweeps the bins for the cheapest split, and partitions the primitive index
+// range in place. Nodes are written depth-first with siblings adjacent; a node
+// of n triangles becomes a leaf when n <= LM2_BVH3_MAX_LEAF_SIZE and the SAH
+// cost of splitting is not lower.
+//
+// The traversal below stays within LM2_BVH3_MAX_DEPTH because nodes deeper than
+// half of it split at the centroid median, halving their triangle count.
+//
+// The parallel build makes the same split decisions. Nodes of more than
+// _LM2_BVH3_PARALLEL_MIN_RANGE primitives compute their bounds and bins in
+// per-thread chunks; once a node is small enough it becomes a subtree task,
+// built on a worker into scratch nodes and then copied behind the top nodes.
+// Either way children are stored after their parent, which the refit relies on.
+
+// Smallest primitive range handed to one thread
+#define _LM2_BVH3_PARALLEL_MIN_RANGE 16384
+
+// Subtree tasks per thread, more tasks even out unbalanced splits
+#define _LM2_BVH3_TASKS_PER_THREAD 4
+
+// Relative slack on the slab exit distance, so rounding cannot cull a box the
+// triangle test would still hit
+#define _LM2_BVH3_SLAB_SLACK_f64 (1.0 + 4.0 * 2.220446049250313e-16)
+#define _LM2_BVH3_SLAB_SLACK_f32 (1.0f + 4.0f * 1.1920929e-7f)
+
+// Inverse direction used for axis-parallel rays, keeps the slab test NaN-free
+#define _LM2_BVH3_HUGE_f64 1e300
+#define _LM2_BVH3_HUGE_f32 1e30f
+
+#define _LM2_BVH3_NONE UINT32_MAX
+
+// Subtree task of the parallel build
+typedef struct _lm2_bvh3_subtree {
+  uint32_t node;        // Top node the subtree root replaces
+  uint32_t begin;       // First primitive slot
+  uint32_t end;         // One past the last primitive slot
+  uint32_t depth;       // Depth of the subtree root
+  uint32_t node_count;  // Nodes built, including the root
+  uint32_t base;        // Final index of the subtree's second node
+} _lm2_bvh3_subtree;
+
+#define _LM2_IMPL_BVH3_HELPERS(scalar_type, S)                                                                                 \
+  static inline lm2_v3_##S _lm2_bvh3_sub_##S(lm2_v3_##S a, lm2_v3_##S b) {                                                     \
+    lm2_v3_##S r = {a.x - b.x, a.y - b.y, a.z - b.z};                                                                          \
+    return r;                                                                                                                  \
+  }                                                                                                                            \
+  static inline lm2_v3_##S _lm2_bvh3_cross_##S(lm2_v3_##S a, lm2_v3_##S b) {                                                   \
+    lm2_v3_##S r = {a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x};                                      \
+    return r;                                                                                                                  \
+  }                                                                                                                            \
+  static inline scalar_type _lm2_bvh3_dot_##S(lm2_v3_##S a, lm2_v3_##S b) {                                                    \
+    return a.x * b.x + a.y * b.y + a.z * b.z;                                                                                  \
+  }                                                                                                                            \
+  static inline lm2_r3_##S _lm2_bvh3_empty_bounds_##S(void) {                                                                  \
+    lm2_r3_##S r;                                                                                                              \
+    r.min = (lm2_v3_##S) {(scalar_type)INFINITY, (scalar_type)INFINITY, (scalar_type)INFINITY};                                \
+    r.max = (lm2_v3_##S) {(scalar_type)-INFINITY, (scalar_type)-INFINITY, (scalar_type)-INFINITY};                             \
+    return r;                                                                                                                  \
+  }                                                                                                                            \
+  static inline void _lm2_bvh3_grow_##S(lm2_r3_##S* r, const lm2_r3_##S* b) {                                                  \
+    r->min.x = b->min.x < r->min.x ? b->min.x : r->min.x;                                                                      \
+    r->min.y = b->min.y < r->min.y ? b->min.y : r->min.y;                                                                      \
+    r->min.z = b->min.z < r->min.z ? b->min.z : r->min.z;                                                                      \
+    r->max.x = b->max.x > r->max.x ? b->max.x : r->max.x;                                                                      \
+    r->max.y = b->max.y > r->max.y ? b->max.y : r->max.y;                                                                      \
+    r->max.z = b->max.z > r->max.z ? b->max.z : r->max.z;                                                                      \
+  }                                                                                                                            \
+  static inline void _lm2_bvh3_grow_point_##S(lm2_r3_##S* r, lm2_v3_##S p) {                                                   \
+    r->min.x = p.x < r->min.x ? p.x : r->min.x;                                                                                \
+    r->min.y = p.y < r->min.y ? p.y : r->min.y;                                                                                \
+    r->min.z = p.z < r->min.z ? p.z : r->min.z;                                                                                \
+    r->max.x = p.x > r->max.x ? p.x : r->max.x;                                                                                \
+    r->max.y = p.y > r->max.y ? p.y : r->max.y;                                                                                \
+    r->max.z = p.z > r->max.z ? p.z : r->max.z;                                                                                \
+  }                                                                                                                            \
+  /* Half the surface area, the SAH only compares ratios */                                                                    \
+  static inline scalar_type _lm2_bvh3_half_area_##S(const lm2_r3_##S* r) {                                                     \
+    scalar_type dx = r->max.x - r->min.x;                                                                                      \
+    scalar_type dy = r->max.y - r->min.y;                                                                                      \
+    scalar_type dz = r->max.z - r->min.z;                                                                                      \
+    return dx * dy + dy * dz + dz * dx;                                                                                        \
+  }                                                                                                                            \
+  /* NaN centroids land in bin 0 instead of overflowing the cast */                                                            \
+  static inline uint32_t _lm2_bvh3_bin_index_##S(scalar_type c, scalar_type min, scalar_type scale, uint32_t bin_count) {      \
+    scalar_type f = (c - min) * scale;                                                                                         \
+    if (!(f > 0)) {                                                                                                            \
+      return 0;                                                                                                                \
+    }                                                                                                                          \
+    return f < (scalar_type)(bin_count - 1) ? (uint32_t)f : bin_count - 1;                                                     \
+  }                                                                                                                            \
+  static inline void _lm2_bvh3_corners_##S(const lm2_bvh3_##S* bvh, uint32_t i, lm2_v3_##S* a, lm2_v3_##S* b, lm2_v3_##S* c) { \
+    if (bvh->triangles != NULL) {                                                                                              \
+      *a = bvh->triangles[i][0];                                                                                               \
+      *b = bvh->triangles[i][1];                                                                                               \
+      *c = bvh->triangles[i][2];                                                                                               \
+    } else {                                                                                                                   \
+      const uint32_t* tri = &bvh->indices[(size_t)i * 3];                                                                      \
+      *a = bvh->vertices[tri[0]];                                                                                              \
+      *b = bvh->vertices[tri[1]];                                                                                              \
+      *c = bvh->vertices[tri[2]];                                                                                              \
+    }                                                                                                                          \
+  }
+
+_LM2_IMPL_BVH3_HELPERS(double, f64)
+_LM2_IMPL_BVH3_HELPERS(float, f32)
+
+// Per-triangle build record. The records are partitioned together with the
+// triangle indices, so every pass over a node range reads memory sequentially.
+#define _LM2_IMPL_BVH3_PRIM(S)        \
+  typedef struct _lm2_bvh3_prim_##S { \
+    lm2_r3_##S bounds;                \
+    lm2_v3_##S centroid;              \
+    uint32_t index;                   \
+  } _lm2_bvh3_prim_##S;
+
+_LM2_IMPL_BVH3_PRIM(f64)
+_LM2_IMPL_BVH3_PRIM(f32)
+
+// Three-way quickselect: moves the triangle with the k-th smallest centroid on
+// axis to slot k, smaller ones before it and larger ones after it
+#define _LM2_IMPL_BVH3_SELECT(scalar_type, S)                                                                       \
+  static void _lm2_bvh3_select_##S(_lm2_bvh3_prim_##S* prims, uint32_t begin, uint32_t end, uint32_t k, int axis) { \
+    while (end - begin > 1) {                                                                                       \
+      scalar_type pivot = prims[begin + (end - begin) / 2].centroid.e[axis];                                        \
+      uint32_t lt = begin, i = begin, gt = end;                                                                     \
+      while (i < gt) {                                                                                              \
+        scalar_type c = prims[i].centroid.e[axis];                                                                  \
+        _lm2_bvh3_prim_##S tmp = prims[i];                                                                          \
+        if (c < pivot) {                                                                                            \
+          prims[i++] = prims[lt];                                                                                   \
+          prims[lt++] = tmp;                                                                                        \
+        } else if (c > pivot) {                                                                                     \
+          prims[i] = prims[--gt];                                                                                   \
+          prims[gt] = tmp;                                                                                          \
+        } else {                                                                                                    \
+          i++;                                                                                                      \
+        }                                                                                                           \
+      }                                                                                                             \
+      if (k < lt) {                                                                                                 \
+        end = lt;                                                                                                   \
+      } else if (k >= gt) {                                                                                         \
+        begin = gt;                                                                                                 \
+      } else {                                                                                                      \
+        return;                                                                                                     \
+      }                                                                                                             \
+    }                                                                                                               \
+  }
+
+_LM2_IMPL_BVH3_SELECT(double, f64)
+_LM2_IMPL_BVH3_SELECT(float, f32)
+
+// Node bounds and centroid bins over a primitive range. With a parallel build
+// context, large ranges are cut into one chunk per thread whose results are
+// merged afterwards; min/max and counts merge exactly, so the split decisions
+// do not depend on the thread count.
+#define _LM2_IMPL_BVH3_BINS(scalar_type, S)                                                                                                                       \
+  typedef struct _lm2_bvh3_bin_##S {                                                                                                                              \
+    lm2_r3_##S bounds;                                                                                                                                            \
+    uint32_t count;                                                                                                                                               \
+  } _lm2_bvh3_bin_##S;                                                                                                                                            \
+                                                                                                                                                                  \
+  typedef struct _lm2_bvh3_chunk_##S {                                                                                                                            \
+    lm2_r3_##S bounds;                                                                                                                                            \
+    lm2_r3_##S centroid_bounds;                                                                                                                                   \
+    _lm2_bvh3_bin_##S bins[3][LM2_BVH3_BIN_COUNT];                                                                                                                \
+  } _lm2_bvh3_chunk_##S;                                                                                                                                          \
+                                                                                                                                                                  \
+  typedef struct _lm2_bvh3_parallel_##S {                                                                                                                         \
+    _lm2_bvh3_prim_##S* prims;                                                                                                                                    \
+    lm2_bvh3_node_##S* nodes;                                                                                                                                     \
+    lm2_bvh3_node_##S* scratch;                                                                                                                                   \
+    uint32_t thread_count;                                                                                                                                        \
+    _lm2_bvh3_chunk_##S* chunks; /* One per thread */                                                                                                             \
+    _lm2_bvh3_subtree* subtrees;                                                                                                                                  \
+    uint32_t subtree_count;                                                                                                                                       \
+    uint32_t subtree_capacity;                                                                                                                                    \
+    uint32_t subtree_size; /* Nodes of at most this many primitives become subtree tasks */                                                                       \
+    /* Range and binning setup of the current chunked pass */                                                                                                     \
+    uint32_t begin;                                                                                                                                               \
+    uint32_t end;                                                                                                                                                 \
+    uint32_t chunk_count;                                                                                                                                         \
+    lm2_v3_##S centroid_min;                                                                                                                                      \
+    scalar_type scales[3];                                                                                                                                        \
+    uint32_t bin_count;                                                                                                                                           \
+  } _lm2_bvh3_parallel_##S;                                                                                                                                       \
+                                                                                                                                                                  \
+  static inline void _lm2_bvh3_bounds_prims_##S(const _lm2_bvh3_prim_##S* prims, uint32_t begin, uint32_t end, lm2_r3_##S* bounds, lm2_r3_##S* centroid_bounds) { \
+    *bounds = _lm2_bvh3_empty_bounds_##S();                                                                                                                       \
+    *centroid_bounds = _lm2_bvh3_empty_bounds_##S();                                                                                                              \
+    for (uint32_t i = begin; i < end; i++) {                                                                                                                      \
+      _lm2_bvh3_grow_##S(bounds, &prims[i].bounds);                                                                                                               \
+      _lm2_bvh3_grow_point_##S(centroid_bounds, prims[i].centroid);                                                                                               \
+    }                                                                                                                                                             \
+  }                                                                                                                                                               \
+                                                                                                                                                                  \
+  static inline void _lm2_bvh3_bin_prims_##S(                                                                                                                     \
+      const _lm2_bvh3_prim_##S* prims,                                                                                                                            \
+      uint32_t begin,                                                                                                                                             \
+      uint32_t end,                                                                                                                                               \
+      lm2_v3_##S centroid_min,                                                                                                                                    \
+      const scalar_type* scales,                                                                                                                                  \
+      uint32_t bin_count,                                                                                                                                         \
+      _lm2_bvh3_bin_##S bins[3][LM2_BVH3_BIN_COUNT]) {                                                                                                            \
+    for (int axis = 0; axis < 3; axis++) {                                                                                                                        \
+      for (uint32_t b = 0; b < bin_count; b++) {                                                                                                                  \
+        bins[axis][b].bounds = _lm2_bvh3_empty_bounds_##S();                                                                                                      \
+        bins[axis][b].count = 0;                                                                                                                                  \
+      }                                                                                                                                                           \
+    }                                                                                                                                                             \
+    for (uint32_t i = begin; i < end; i++) {                                                                                                                      \
+      const lm2_v3_##S c = prims[i].centroid;                                                                                                                     \
+      const lm2_r3_##S* r = &prims[i].bounds;                                                                                                                     \
+      for (int axis = 0; axis < 3; axis++) {                                                                                                                      \
+        _lm2_bvh3_bin_##S* bin = &bins[axis][_lm2_bvh3_bin_index_##S(c.e[axis], centroid_min.e[axis], scales[axis], bin_count)];                                  \
+        bin->count++;                                                                                                                                             \
+        _lm2_bvh3_grow_##S(&bin->bounds, r);                                                                                                                      \
+      }                                                                                                                                                           \
+    }                                                                                                                                                             \
+  }                                                                                                                                                               \
+                                                                                                                                                                  \
+  /* Split par's current range into chunk_count chunks, returns 1 when it should not be split */                                                                  \
+  static uint32_t _lm2_bvh3_chunk_setup_##S(_lm2_bvh3_parallel_##S* par, uint32_t begin, uint32_t end) {                                                          \
+    if (par == NULL) {                                                                                                                                            \
+      return 1;                                                                                                                                                   \
+    }                                                                                                                                                             \
+    uint32_t chunk_count = (end - begin) / _LM2_BVH3_PARALLEL_MIN_RANGE;                                                                                          \
+    chunk_count = chunk_count < par->thread_count ? chunk_count : par->thread_count;                                                                              \
+    par->begin = begin;                                                                                                                                           \
+    par->end = end;                                                                                                                                               \
+    par->chunk_count = chunk_count > 1 ? chunk_count : 1;                                                                                                         \
+    return par->chunk_count;                                                                                                                                      \
+  }                                                                                                                                                               \
+                                                                                                                                                                  \
+  static inline void _lm2_bvh3_chunk_range_##S(const _lm2_bvh3_parallel_##S* par, size_t chunk, uint32_t* begin, uint32_t* end) {                                 \
+    const uint64_t size = par->end - par->begin;                                                                                                                  \
+    *begin = par->begin + (uint32_t)(size * chunk / par->chunk_count);                                                                                            \
+    *end = par->begin + (uint32_t)(size * (chunk + 1) / par->chunk_count);                                                                                        \
+  }                                                                                                                                                               \
+                                                                                                                                                                  \
+  static void _lm2_bvh3_bounds_task_##S(void* context, size_t first, size_t last) {                                                                               \
+    _lm2_bvh3_parallel_##S* par = (_lm2_bvh3_parallel_##S*)context;                                                                                               \
+    for (size_t chunk = first; chunk < last; chunk++) {                                                                                                           \
+      uint32_t begin, end;                                                                                                                                        \
+      _lm2_bvh3_chunk_range_##S(par, chunk, &begin, &end);                                                                                                        \
+      _lm2_bvh3_bounds_prims_##S(par->prims, begin, end, &par->chunks[chunk].bounds, &par->chunks[chunk].centroid_bounds);                                        \
+    }                                                                                                                                                             \
+  }                                                                                                                                                               \
+                                                                                                                                                                  \
+  static void _lm2_bvh3_bins_task_##S(void* context, size_t first, size_t last) {                                                                                 \
+    _lm2_bvh3_parallel_##S* par = (_lm2_bvh3_parallel_##S*)context;                                                                                               \
+    for (size_t chunk = first; chunk < last; chunk++) {                                                                                                           \
+      uint32_t begin, end;                                                                                                                                        \
+      _lm2_bvh3_chunk_range_##S(par, chunk, &begin, &end);                                                                                                        \
+      _lm2_bvh3_bin_prims_##S(par->prims, begin, end, par->centroid_min, par->scales, par->bin_count, par->chunks[chunk].bins);                                   \
+    }                                                                                                                                                             \
+  }                                                                                                                                                               \
+                                                                                                                                                                  \
+  static void _lm2_bvh3_range_bounds_##S(                                                                                                                         \
+      _lm2_bvh3_prim_##S* prims,                                                                                                                                  \
+      uint32_t begin,                                                                                                                                             \
+      uint32_t end,                                                                                                                                               \
+      lm2_r3_##S* bounds,                                                                                                                                         \
+      lm2_r3_##S* centroid_bounds,                                                                                                                                \
+      _lm2_bvh3_parallel_##S* par) {                                                                                                                              \
+    const uint32_t chunk_count = _lm2_bvh3_chunk_setup_##S(par, begin, end);                                                                                      \
+    if (chunk_count <= 1) {                                                                                                                                       \
+      _lm2_bvh3_bounds_prims_##S(prims, begin, end, bounds, centroid_bounds);                                                                                     \
+      return;                                                                                                                                                     \
+    }                                                                                                                                                             \
+    lm2_parallel_for(chunk_count, 1, chunk_count, _lm2_bvh3_bounds_task_##S, par);                                                                                \
+    *bounds = par->chunks[0].bounds;                                                                                                                              \
+    *centroid_bounds = par->chunks[0].centroid_bounds;                                                                                                            \
+    for (uint32_t c = 1; c < chunk_count; c++) {                                                                                                                  \
+      _lm2_bvh3_grow_##S(bounds, &par->chunks[c].bounds);                                                                                                         \
+      _lm2_bvh3_grow_##S(centroid_bounds, &par->chunks[c].centroid_bounds);                                                                                       \
+    }                                                                                                                                                             \
+  }                                                                                                                                                               \
+                                                                                                                                                                  \
+  static void _lm2_bvh3_range_bins_##S(                                                                                                                           \
+      _lm2_bvh3_prim_##S* prims,                                                                                                                                  \
+      uint32_t begin,                                                                                                                                             \
+      uint32_t end,                                                                                                                                               \
+      lm2_v3_##S centroid_min,                                                                                                                                    \
+      const scalar_type* scales,                                                                                                                                  \
+      uint32_t bin_count,                                                                                                                                         \
+      _lm2_bvh3_bin_##S bins[3][LM2_BVH3_BIN_COUNT],                                                                                                              \
+      _lm2_bvh3_parallel_##S* par) {                                                                                                                              \
+    const uint32_t chunk_count = _lm2_bvh3_chunk_setup_##S(par, begin, end);                                                                                      \
+    if (chunk_count <= 1) {                                                                                                                                       \
+      _lm2_bvh3_bin_prims_##S(prims, begin, end, centroid_min, scales, bin_count, bins);                                                                          \
+      return;                                                                                                                                                     \
+    }                                                                                                                                                             \
+    par->centroid_min = centroid_min;                                                                                                                             \
+    par->scales[0] = scales[0];                                                                                                                                   \
+    par->scales[1] = scales[1];                                                                                                                                   \
+    par->scales[2] = scales[2];                                                                                                                                   \
+    par->bin_count = bin_count;                                                                                                                                   \
+    lm2_parallel_for(chunk_count, 1, chunk_count, _lm2_bvh3_bins_task_##S, par);                                                                                  \
+    for (int axis = 0; axis < 3; axis++) {                                                                                                                        \
+      for (uint32_t b = 0; b < bin_count; b++) {                                                                                                                  \
+        bins[axis][b] = par->chunks[0].bins[axis][b];                                                                                                             \
+        for (uint32_t c = 1; c < chunk_count; c++) {                                                                                                              \
+          _lm2_bvh3_grow_##S(&bins[axis][b].bounds, &par->chunks[c].bins[axis][b].bounds);                                                                        \
+          bins[axis][b].count += par->chunks[c].bins[axis][b].count;                                                                                              \
+        }                                                                                                                                                         \
+      }                                                                                                                                                           \
+    }                                                                                                                                                             \
+  }
+
+_LM2_IMPL_BVH3_BINS(double, f64)
+_LM2_IMPL_BVH3_BINS(float, f32)
+
+// Choose a split for prims[begin, end) and partition around it. Returns the first
+// slot of the right child, or begin if the node should stay a leaf.
+#define _LM2_IMPL_BVH3_SPLIT(scalar_type, S)                                                                                                         \
+  static uint32_t _lm2_bvh3_split_##S(                                                                                                               \
+      _lm2_bvh3_prim_##S* prims,                                                                                                                     \
+      uint32_t begin,                                                                                                                                \
+      uint32_t end,                                                                                                                                  \
+      const lm2_r3_##S* bounds,                                                                                                                      \
+      const lm2_r3_##S* centroid_bounds,                                                                                                             \
+      uint32_t depth,                                                                                                                                \
+      _lm2_bvh3_parallel_##S* par) {                                                                                                                 \
+    const uint32_t count = end - begin;                                                                                                              \
+    if (count == 1) {                                                                                                                                \
+      return begin;                                                                                                                                  \
+    }                                                                                                                                                \
+                                                                                                                                                     \
+    int widest = 0;                                                                                                                                  \
+    scalar_type extents[3];                                                                                                                          \
+    for (int k = 0; k < 3; k++) {                                                                                                                    \
+      extents[k] = centroid_bounds->max.e[k] - centroid_bounds->min.e[k];                                                                            \
+      widest = extents[k] > extents[widest] ? k : widest;                                                                                            \
+    }                                                                                                                                                \
+                                                                                                                                                     \
+    /* Coincident centroids cannot be separated, cut the range in half */                                                                            \
+    if (!(extents[widest] > 0)) {                                                                                                                    \
+      return count <= LM2_BVH3_MAX_LEAF_SIZE ? begin : begin + count / 2;                                                                            \
+    }                                                                                                                                                \
+                                                                                                                                                     \
+    if (depth >= LM2_BVH3_MAX_DEPTH / 2) {                                                                                                           \
+      uint32_t mid = begin + count / 2;                                                                                                              \
+      _lm2_bvh3_select_##S(prims, begin, end, mid, widest);                                                                                          \
+      return mid;                                                                                                                                    \
+    }                                                                                                                                                \
+                                                                                                                                                     \
+    /* Bin the centroids on all three axes in one pass, small nodes use one bin per triangle */                                                      \
+    const uint32_t bin_count = count < LM2_BVH3_BIN_COUNT ? count : LM2_BVH3_BIN_COUNT;                                                              \
+    _lm2_bvh3_bin_##S bins[3][LM2_BVH3_BIN_COUNT];                                                                                                   \
+    scalar_type scales[3];                                                                                                                           \
+    for (int axis = 0; axis < 3; axis++) {                                                                                                           \
+      scales[axis] = extents[axis] > 0 ? (scalar_type)bin_count / extents[axis] : 0;                                                                 \
+    }                                                                                                                                                \
+    _lm2_bvh3_range_bins_##S(prims, begin, end, centroid_bounds->min, scales, bin_count, bins, par);                                                 \
+                                                                                                                                                     \
+    scalar_type best_cost = (scalar_type)INFINITY;                                                                                                   \
+    int best_axis = -1;                                                                                                                              \
+    uint32_t best_bin = 0;                                                                                                                           \
+    for (int axis = 0; axis < 3; axis++) {                                                                                                           \
+      if (!(extents[axis] > 0)) {                                                                                                                    \
+        continue;                                                                                                                                    \
+      }                                                                                                                                              \
+                                                                                                                                                     \
+      /* Right-to-left sweep, then evaluate every split left-to-right */                                                                             \
+      scalar_type right_area[LM2_BVH3_BIN_COUNT];                                                                                                    \
+      uint32_t right_count[LM2_BVH3_BIN_COUNT];                                                                                                      \
+      lm2_r3_##S acc = _lm2_bvh3_empty_bounds_##S();                                                                                                 \
+      uint32_t n = 0;                                                                                                                                \
+      for (uint32_t b = bin_count - 1; b > 0; b--) {                                                                                                 \
+        _lm2_bvh3_grow_##S(&acc, &bins[axis][b].bounds);                                                                                             \
+        n += bins[axis][b].count;                                                                                                                    \
+        right_area[b] = n > 0 ? _lm2_bvh3_half_area_##S(&acc) : 0;                                                                                   \
+        right_count[b] = n;                                                                                                                          \
+      }                                                                                                                                              \
+      acc = _lm2_bvh3_empty_bounds_##S();                                                                                                            \
+      n = 0;                                                                                                                                         \
+      for (uint32_t b = 0; b + 1 < bin_count; b++) {                                                                                                 \
+        _lm2_bvh3_grow_##S(&acc, &bins[axis][b].bounds);                                                                                             \
+        n += bins[axis][b].count;                                                                                                                    \
+        if (n == 0 || right_count[b + 1] == 0) {                                                                                                     \
+          continue;                                                                                                                                  \
+        }                                                                                                                                            \
+        scalar_type cost = (scalar_type)n * _lm2_bvh3_half_area_##S(&acc) + (scalar_type)right_count[b + 1] * right_area[b + 1];                     \
+        if (cost < best_cost) {                                                                                                                      \
+          best_cost = cost;                                                                                                                          \
+          best_axis = axis;                                                                                                                          \
+          best_bin = b + 1;                                                                                                                          \
+        }                                                                                                                                            \
+      }                                                                                                                                              \
+    }                                                                                                                                                \
+                                                                                                                                                     \
+    /* Leaf cost: one test per triangle. Split cost: one box test plus the children */                                                               \
+    if (best_axis >= 0 && count <= LM2_BVH3_MAX_LEAF_SIZE) {                                                                                         \
+      scalar_type area = _lm2_bvh3_half_area_##S(bounds);                                                                                            \
+      if ((scalar_type)count * area <= area + best_cost) {                                                                                           \
+        return begin;                                                                                                                                \
+      }                                                                                                                                              \
+    }                                                                                                                                                \
+                                                                                                                                                     \
+    uint32_t mid = begin;                                                                                                                            \
+    if (best_axis >= 0) {                                                                                                                            \
+      uint32_t right = end;                                                                                                                          \
+      while (mid < right) {                                                                                                                          \
+        if (_lm2_bvh3_bin_index_##S(prims[mid].centroid.e[best_axis], centroid_bounds->min.e[best_axis], scales[best_axis], bin_count) < best_bin) { \
+          mid++;                                                                                                                                     \
+        } else {                                                                                                                                     \
+          _lm2_bvh3_prim_##S tmp = prims[mid];                                                                                                       \
+          prims[mid] = prims[--right];                                                                                                               \
+          prims[right] = tmp;                                                                                                                        \
+        }                                                                                                                                            \
+      }                                                                                                                                              \
+    }                                                                                                                                                \
+                                                                                                                                                     \
+    /* Non-finite centroids can defeat the binning, fall back to the median */                                                                       \
+    if (mid == begin || mid == end) {                                                                                                                \
+      mid = begin + count / 2;                                                                                                                       \
+      _lm2_bvh3_select_##S(prims, begin, end, mid, widest);                                                                                          \
+    }                                                                                                                                                \
+    return mid;                                                                                                                                      \
+  }
+
+_LM2_IMPL_BVH3_SPLIT(double, f64)
+_LM2_IMPL_BVH3_SPLIT(float, f32)
+
+// Build the nodes over prims[0, prim_count), reordering prims into leaf order.
+// depth is the depth of the root. With a parallel build context, nodes of at
+// most par->subtree_size primitives are queued as subtree tasks instead.
+#define _LM2_IMPL_BVH3_BUILD_NODES(S)                                                                                    \
+  static uint32_t _lm2_bvh3_build_nodes_##S(                                                                             \
+      lm2_bvh3_node_##S* nodes,                                                                                          \
+      _lm2_bvh3_prim_##S* prims,                                                                                         \
+      uint32_t prim_count,                                                                                               \
+      uint32_t root_depth,                                                                                               \
+      _lm2_bvh3_parallel_##S* par) {                                                                                     \
+    struct {                                                                                                             \
+      uint32_t node;                                                                                                     \
+      uint32_t begin;                                                                                                    \
+      uint32_t end;                                                                                                      \
+      uint32_t depth;                                                                                                    \
+    } stack[LM2_BVH3_MAX_DEPTH + 2];                                                                                     \
+    uint32_t top = 0;                                                                                                    \
+    uint32_t node_count = 1;                                                                                             \
+                                                                                                                         \
+    stack[top].node = 0;                                                                                                 \
+    stack[top].begin = 0;                                                                                                \
+    stack[top].end = prim_count;                                                                                         \
+    stack[top].depth = root_depth;                                                                                       \
+    top++;                                                                                                               \
+                                                                                                                         \
+    while (top > 0) {                                                                                                    \
+      top--;                                                                                                             \
+      const uint32_t node_index = stack[top].node;                                                                       \
+      const uint32_t begin = stack[top].begin;                                                                           \
+      const uint32_t end = stack[top].end;                                                                               \
+      const uint32_t depth = stack[top].depth;                                                                           \
+                                                                                                                         \
+      if (par != NULL && end - begin <= par->subtree_size) {                                                             \
+        if (par->subtree_count == par->subtree_capacity) {                                                               \
+          par->subtree_capacity = par->subtree_capacity * 2 + 16;                                                        \
+          size_t subtree_bytes = sizeof(_lm2_bvh3_subtree) * par->subtree_capacity;                                      \
+          par->subtrees = (_lm2_bvh3_subtree*)lm2_realloc(par->subtrees, subtree_bytes);                                 \
+          LM2_ASSERT(par->subtrees != NULL);                                                                             \
+        }                                                                                                                \
+        _lm2_bvh3_subtree* subtree = &par->subtrees[par->subtree_count++];                                               \
+        subtree->node = node_index;                                                                                      \
+        subtree->begin = begin;                                                                                          \
+        subtree->end = end;                                                                                              \
+        subtree->depth = depth;                                                                                          \
+        continue;                                                                                                        \
+      }                                                                                                                  \
+                                                                                                                         \
+      lm2_r3_##S bounds, centroid_bounds;                                                                                \
+      _lm2_bvh3_range_bounds_##S(prims, begin, end, &bounds, &centroid_bounds, par);                                     \
+      nodes[node_index].bounds = bounds;                                                                                 \
+                                                                                                                         \
+      uint32_t mid = _lm2_bvh3_split_##S(prims, begin, end, &bounds, &centroid_bounds, depth, par);                      \
+      if (mid == begin) {                                                                                                \
+        nodes[node_index].first = begin;                                                                                 \
+        nodes[node_index].count = end - begin;                                                                           \
+        continue;                                                                                                        \
+      }                                                                                                                  \
+                                                                                                                         \
+      LM2_ASSERT(depth + 1 < LM2_BVH3_MAX_DEPTH);                                                                        \
+      const uint32_t left = node_count;                                                                                  \
+      node_count += 2;                                                                                                   \
+      nodes[node_index].first = left;                                                                                    \
+      nodes[node_index].count = 0;                                                                                       \
+                                                                                                                         \
+      /* Left child on top, so it is built (and laid out) first */                                                       \
+      stack[top].node = left + 1;                                                                                        \
+      stack[top].begin = mid;                                                                                            \
+      stack[top].end = end;                                                                                              \
+      stack[top].depth = depth + 1;                                                                                      \
+      top++;                                                                                                             \
+      stack[top].node = left;                                                                                            \
+      stack[top].begin = begin;                                                                                          \
+      stack[top].end = mid;                                                                                              \
+      stack[top].depth = depth + 1;                                                                                      \
+      top++;                                                                                                             \
+    }                                                                                                                    \
+                                                                                                                         \
+    return node_count;                                                                                                   \
+  }
+
+_LM2_IMPL_BVH3_BUILD_NODES(f64)
+_LM2_IMPL_BVH3_BUILD_NODES(f32)
+
+// Parallel build: top nodes with chunked bounds and bins, then the subtree tasks
+// into scratch (a subtree of n primitives needs at most 2n - 1 nodes, so slot
+// 2 * begin is free of overlap), then a copy behind the top nodes. The subtree
+// root replaces its top node, every other node j moves to base + j - 1.
+#define _LM2_IMPL_BVH3_BUILD_PARALLEL(S)                                                                                                \
+  static void _lm2_bvh3_subtree_build_task_##S(void* context, size_t first, size_t last) {                                              \
+    _lm2_bvh3_parallel_##S* par = (_lm2_bvh3_parallel_##S*)context;                                                                     \
+    for (size_t t = first; t < last; t++) {                                                                                             \
+      _lm2_bvh3_subtree* subtree = &par->subtrees[t];                                                                                   \
+      subtree->node_count = _lm2_bvh3_build_nodes_##S(                                                                                  \
+          &par->scratch[(size_t)subtree->begin * 2], &par->prims[subtree->begin], subtree->end - subtree->begin, subtree->depth, NULL); \
+    }                                                                                                                                   \
+  }                                                                                                                                     \
+                                                                                                                                        \
+  static void _lm2_bvh3_subtree_copy_task_##S(void* context, size_t first, size_t last) {                                               \
+    _lm2_bvh3_parallel_##S* par = (_lm2_bvh3_parallel_##S*)context;                                                                     \
+    for (size_t t = first; t < last; t++) {                                                                                             \
+      const _lm2_bvh3_subtree* subtree = &par->subtrees[t];                                                                             \
+      const lm2_bvh3_node_##S* src = &par->scratch[(size_t)subtree->begin * 2];                                                         \
+      for (uint32_t j = 0; j < subtree->node_count; j++) {                                                                              \
+        lm2_bvh3_node_##S node = src[j];                                                                                                \
+        node.first = node.count > 0 ? node.first + subtree->begin : subtree->base + node.first - 1;                                     \
+        par->nodes[j == 0 ? subtree->node : subtree->base + j - 1] = node;                                                              \
+      }                                                                                                                                 \
+    }                                                                                                                                   \
+  }                                                                                                                                     \
+                                                                                                                                        \
+  static uint32_t _lm2_bvh3_build_nodes_parallel_##S(                                                                                   \
+      lm2_bvh3_node_##S* nodes,                                                                                                         \
+      _lm2_bvh3_prim_##S* prims,                                                                                                        \
+      uint32_t prim_count,                                                                                                              \
+      uint32_t thread_count) {                                                                                                          \
+    if (thread_count <= 1 || prim_count < 2 * _LM2_BVH3_PARALLEL_MIN_RANGE) {                                                           \
+      return _lm2_bvh3_build_nodes_##S(nodes, prims, prim_count, 0, NULL);                                                              \
+    }                                                                                                                                   \
+                                                                                                                                        \
+    _lm2_bvh3_parallel_##S par;                                                                                                         \
+    par.prims = prims;                                                                                                                  \
+    par.nodes = nodes;                                                                                                                  \
+    par.scratch = (lm2_bvh3_node_##S*)lm2_malloc(sizeof(lm2_bvh3_node_##S) * (2 * (size_t)prim_count - 1));                             \
+    par.thread_count = thread_count;                                                                                                    \
+    par.chunks = (_lm2_bvh3_chunk_##S*)lm2_malloc(sizeof(_lm2_bvh3_chunk_##S) * thread_count);                                          \
+    par.subtrees = NULL;                                                                                                                \
+    par.subtree_count = 0;                                                                                                              \
+    par.subtree_capacity = 0;                                                                                                           \
+    par.subtree_size = prim_count / (thread_count * _LM2_BVH3_TASKS_PER_THREAD);                                                        \
+    LM2_ASSERT(par.scratch != NULL && par.chunks != NULL);                                                                              \
+                                                                                                                                        \
+    uint32_t node_count = _lm2_bvh3_build_nodes_##S(nodes, prims, prim_count, 0, &par);                                                 \
+    lm2_parallel_for(par.subtree_count, 1, thread_count, _lm2_bvh3_subtree_build_task_##S, &par);                                       \
+    for (uint32_t t = 0; t < par.subtree_count; t++) {                                                                                  \
+      par.subtrees[t].base = node_count;                                                                                                \
+      node_count += par.subtrees[t].node_count - 1;                                                                                     \
+    }                                                                                                                                   \
+    lm2_parallel_for(par.subtree_count, 1, thread_count, _lm2_bvh3_subtree_copy_task_##S, &par);                                        \
+                                                                                                                                        \
+    lm2_free(par.subtrees);                                                                                                             \
+    lm2_free(par.chunks);                                                                                                               \
+    lm2_free(par.scratch);                                                                                                              \
+    return node_count;                                                                                                                  \
+  }
+
+_LM2_IMPL_BVH3_BUILD_PARALLEL(f64)
+_LM2_IMPL_BVH3_BUILD_PARALLEL(f32)
+
+// Gather triangle bounds and centroids into scratch records, then build
+#define _LM2_IMPL_BVH3_BUILD(scalar_type, S)                                                              \
+  static void _lm2_bvh3_build_##S(lm2_bvh3_##S* bvh, size_t node_buffer_size, size_t index_buffer_size) { \
+    LM2_ASSERT(bvh->triangle_count == 0 || bvh->nodes != NULL);                                           \
+    LM2_ASSERT(bvh->triangle_count == 0 || bvh->primitive_indices != NULL);                               \
+    LM2_ASSERT(node_buffer_size >= lm2_bvh3_node_buffer_size_##S(bvh->triangle_count));                   \
+    LM2_ASSERT(index_buffer_size >= lm2_bvh3_index_buffer_size_##S(bvh->triangle_count));                 \
+                                                                                                          \
+    const uint32_t count = bvh->triangle_count;                                                           \
+    if (count == 0) {                                                                                     \
+      bvh->node_count = 0;                                                                                \
+      return;                                                                                             \
+    }                                                                                                     \
+                                                                                                          \
+    size_t prim_bytes = sizeof(_lm2_bvh3_prim_##S) * (size_t)count;                                       \
+    _lm2_bvh3_prim_##S* prims = (_lm2_bvh3_prim_##S*)lm2_malloc(prim_bytes);                              \
+    LM2_ASSERT(prims != NULL);                                                                            \
+                                                                                                          \
+    for (uint32_t i = 0; i < count; i++) {                                                                \
+      lm2_v3_##S a, b, c;                                                                                 \
+      _lm2_bvh3_corners_##S(bvh, i, &a, &b, &c);                                                          \
+      lm2_r3_##S r = _lm2_bvh3_empty_bounds_##S();                                                        \
+      _lm2_bvh3_grow_point_##S(&r, a);                                                                    \
+      _lm2_bvh3_grow_point_##S(&r, b);                                                                    \
+      _lm2_bvh3_grow_point_##S(&r, c);                                                                    \
+      LM2_ASSERT_UNSAFE(isfinite(r.min.x) && isfinite(r.min.y) && isfinite(r.min.z));                     \
+      LM2_ASSERT_UNSAFE(isfinite(r.max.x) && isfinite(r.max.y) && isfinite(r.max.z));                     \
+      prims[i].bounds = r;                                                                                \
+      prims[i].centroid.x = (a.x + b.x + c.x) / 3;                                                        \
+      prims[i].centroid.y = (a.y + b.y + c.y) / 3;                                                        \
+      prims[i].centroid.z = (a.z + b.z + c.z) / 3;                                                        \
+      prims[i].index = i;                                                                                 \
+    }                                                                                                     \
+                                                                                                          \
+    bvh->node_count = _lm2_bvh3_build_nodes_##S(bvh->nodes, prims, count, 0, NULL);                       \
+    for (uint32_t i = 0; i < count; i++) {                                                                \
+      bvh->primitive_indices[i] = prims[i].index;                                                         \
+    }                                                                                                     \
+                                                                                                          \
+    lm2_free(prims);                                                                                      \
+  }
+
+_LM2_IMPL_BVH3_BUILD(double, f64)
+_LM2_IMPL_BVH3_BUILD(float, f32)
+
+// Box build: primitive records straight from the caller's bounds, gathered and
+// scattered back in parallel ranges
+#define _LM2_IMPL_BVH3_BUILD_BOUNDS(scalar_type, S)                                                               \
+  typedef struct _lm2_bvh3_gather_##S {                                                                           \
+    const lm2_r3_##S* bounds;                                                                                     \
+    _lm2_bvh3_prim_##S* prims;                                                                                    \
+    uint32_t* primitive_indices;                                                                                  \
+  } _lm2_bvh3_gather_##S;                                                                                         \
+                                                                                                                  \
+  static void _lm2_bvh3_gather_task_##S(void* context, size_t begin, size_t end) {                                \
+    const _lm2_bvh3_gather_##S* gather = (const _lm2_bvh3_gather_##S*)context;                                    \
+    for (size_t i = begin; i < end; i++) {                                                                        \
+      const lm2_r3_##S r = gather->bounds[i];                                                                     \
+      LM2_ASSERT_UNSAFE(isfinite(r.min.x) && isfinite(r.min.y) && isfinite(r.min.z));                             \
+      LM2_ASSERT_UNSAFE(isfinite(r.max.x) && isfinite(r.max.y) && isfinite(r.max.z));                             \
+      LM2_ASSERT_UNSAFE(r.min.x <= r.max.x && r.min.y <= r.max.y && r.min.z <= r.max.z);                          \
+      gather->prims[i].bounds = r;                                                                                \
+      gather->prims[i].centroid.x = (r.min.x + r.max.x) * (scalar_type)0.5;                                       \
+      gather->prims[i].centroid.y = (r.min.y + r.max.y) * (scalar_type)0.5;                                       \
+      gather->prims[i].centroid.z = (r.min.z + r.max.z) * (scalar_type)0.5;                                       \
+      gather->prims[i].index = (uint32_t)i;                                                                       \
+    }                                                                                                             \
+  }                                                                                                               \
+                                                                                                                  \
+  static void _lm2_bvh3_scatter_task_##S(void* context, size_t begin, size_t end) {                               \
+    const _lm2_bvh3_gather_##S* gather = (const _lm2_bvh3_gather_##S*)context;                                    \
+    for (size_t i = begin; i < end; i++) {                                                                        \
+      gather->primitive_indices[i] = gather->prims[i].index;                                                      \
+    }                                                                                                             \
+  }                                                                                                               \
+                                                                                                                  \
+  static uint32_t _lm2_bvh3_build_bounds_##S(                                                                     \
+      const lm2_r3_##S* bounds,                                                                                   \
+      size_t count,                                                                                               \
+      lm2_bvh3_node_##S* nodes,                                                                                   \
+      size_t node_buffer_size,                                                                                    \
+      uint32_t* primitive_indices,                                                                                \
+      size_t index_buffer_size,                                                                                   \
+      uint32_t thread_count) {                                                                                    \
+    LM2_ASSERT(count == 0 || (bounds != NULL && nodes != NULL && primitive_indices != NULL));                     \
+    LM2_ASSERT(count < UINT32_MAX / 2);                                                                           \
+    LM2_ASSERT(node_buffer_size >= lm2_bvh3_node_buffer_size_##S(count));                                         \
+    LM2_ASSERT(index_buffer_size >= lm2_bvh3_index_buffer_size_##S(count));                                       \
+    if (count == 0) {                                                                                             \
+      return 0;                                                                                                   \
+    }                                                                                                             \
+                                                                                                                  \
+    _lm2_bvh3_gather_##S gather;                                                                                  \
+    gather.bounds = bounds;                                                                                       \
+    gather.prims = (_lm2_bvh3_prim_##S*)lm2_malloc(sizeof(_lm2_bvh3_prim_##S) * count);                           \
+    gather.primitive_indices = primitive_indices;                                                                 \
+    LM2_ASSERT(gather.prims != NULL);                                                                             \
+                                                                                                                  \
+    lm2_parallel_for(count, _LM2_BVH3_PARALLEL_MIN_RANGE, thread_count, _lm2_bvh3_gather_task_##S, &gather);      \
+    uint32_t node_count = _lm2_bvh3_build_nodes_parallel_##S(nodes, gather.prims, (uint32_t)count, thread_count); \
+    lm2_parallel_for(count, _LM2_BVH3_PARALLEL_MIN_RANGE, thread_count, _lm2_bvh3_scatter_task_##S, &gather);     \
+                                                                                                                  \
+    lm2_free(gather.prims);                                                                                       \
+    return node_count;                                                                                            \
+  }
+
+_LM2_IMPL_BVH3_BUILD_BOUNDS(double, f64)
+_LM2_IMPL_BVH3_BUILD_BOUNDS(float, f32)
+
+// Refit: children are stored after their parent, so a reverse sweep updates
+// every node after both of its children. Leaves read either the caller's
+// bounds or, without them, the triangles of bvh.
+#define _LM2_IMPL_BVH3_REFIT(S)                                             \
+  static void _lm2_bvh3_refit_##S(                                          \
+      lm2_bvh3_node_##S* nodes,                                             \
+      uint32_t node_count,                                                  \
+      const uint32_t* primitive_indices,                                    \
+      const lm2_r3_##S* bounds,                                             \
+      const lm2_bvh3_##S* bvh) {                                            \
+    for (uint32_t i = node_count; i-- > 0;) {                               \
+      lm2_bvh3_node_##S* node = &nodes[i];                                  \
+      if (node->count == 0) {                                               \
+        LM2_ASSERT_UNSAFE(node->first > i && node->first + 1 < node_count); \
+        lm2_r3_##S r = nodes[node->first].bounds;                           \
+        _lm2_bvh3_grow_##S(&r, &nodes[node->first + 1].bounds);             \
+        node->bounds = r;                                                   \
+        continue;                                                           \
+      }                                                                     \
+      lm2_r3_##S r = _lm2_bvh3_empty_bounds_##S();                          \
+      for (uint32_t k = node->first; k < node->first + node->count; k++) {  \
+        if (bounds != NULL) {                                               \
+          _lm2_bvh3_grow_##S(&r, &bounds[primitive_indices[k]]);            \
+        } else {                                                            \
+          lm2_v3_##S a, b, c;                                               \
+          _lm2_bvh3_corners_##S(bvh, primitive_indices[k], &a, &b, &c);     \
+          _lm2_bvh3_grow_point_##S(&r, a);                                  \
+          _lm2_bvh3_grow_point_##S(&r, b);                                  \
+          _lm2_bvh3_grow_point_##S(&r, c);                                  \
+        }                                                                   \
+      }                                                                     \
+      node->bounds = r;                                                     \
+    }                                                                       \
+  }
+
+_LM2_IMPL_BVH3_REFIT(f64)
+_LM2_IMPL_BVH3_REFIT(f32)
+
+// =============================================================================
+// BVH traversal
+// =============================================================================
+// Ordered depth-first traversal: at each interior node both children are slab
+// tested, the nearer one is visited next and the farther one is pushed with its
+// entry distance, so it can be skipped once a closer hit has been found. The
+// triangle test is lm2_raycast_triangle without the hit point and normal, which
+// are only computed for the final hit, with plain arithmetic like the rest.
+
+#define _LM2_IMPL_BVH3_TRAVERSE(scalar_type, S, epsilon, sqrt_fn)                                                               \
+  /* Slab test, returns the entry distance or INFINITY on a miss */                                                             \
+  static inline scalar_type _lm2_bvh3_slab_##S(const lm2_r3_##S* b, lm2_v3_##S origin, lm2_v3_##S inv_dir, scalar_type t_max) { \
+    scalar_type x0 = (b->min.x - origin.x) * inv_dir.x;                                                                         \
+    scalar_type x1 = (b->max.x - origin.x) * inv_dir.x;                                                                         \
+    scalar_type y0 = (b->min.y - origin.y) * inv_dir.y;                                                                         \
+    scalar_type y1 = (b->max.y - origin.y) * inv_dir.y;                                                                         \
+    scalar_type z0 = (b->min.z - origin.z) * inv_dir.z;                                                                         \
+    scalar_type z1 = (b->max.z - origin.z) * inv_dir.z;                                                                         \
+    scalar_type t_near = x0 < x1 ? x0 : x1;                                                                                     \
+    scalar_type t_far = x0 < x1 ? x1 : x0;                                                                                      \
+    scalar_type y_near = y0 < y1 ? y0 : y1;                                                                                     \
+    scalar_type y_far = y0 < y1 ? y1 : y0;                                                                                      \
+    scalar_type z_near = z0 < z1 ? z0 : z1;                                                                                     \
+    scalar_type z_far = z0 < z1 ? z1 : z0;                                                                                      \
+    t_near = y_near > t_near ? y_near : t_near;                                                                                 \
+    t_near = z_near > t_near ? z_near : t_near;                                                                                 \
+    t_near = t_near > 0 ? t_near : 0;                                                                                           \
+    t_far = y_far < t_far ? y_far : t_far;                                                                                      \
+    t_far = z_far < t_far ? z_far : t_far;                                                                                      \
+    t_far = t_max < t_far ? t_max : t_far;                                                                                      \
+    return t_near <= t_far * _LM2_BVH3_SLAB_SLACK_##S ? t_near : (scalar_type)INFINITY;                                         \
+  }                                                                                                                             \
+                                                                                                                                \
+  /* Möller-Trumbore, returns t in (epsilon, t_max] or INFINITY on a miss */                                                    \
+  static inline scalar_type _lm2_bvh3_triangle_##S(                                                                             \
+      lm2_v3_##S v0, lm2_v3_##S v1, lm2_v3_##S v2, lm2_v3_##S origin, lm2_v3_##S dir, scalar_type t_max) {                      \
+    lm2_v3_##S edge1 = _lm2_bvh3_sub_##S(v1, v0);                                                                               \
+    lm2_v3_##S edge2 = _lm2_bvh3_sub_##S(v2, v0);                                                                               \
+    lm2_v3_##S h = _lm2_bvh3_cross_##S(dir, edge2);                                                                             \
+    scalar_type a = _lm2_bvh3_dot_##S(edge1, h);                                                                                \
+    if (fabs(a) < epsilon) {                                                                                                    \
+      return (scalar_type)INFINITY;                                                                                             \
+    }                                                                                                                           \
+    scalar_type f = 1 / a;                                                                                                      \
+    lm2_v3_##S s = _lm2_bvh3_sub_##S(origin, v0);                                                                               \
+    scalar_type u = f * _lm2_bvh3_dot_##S(s, h);                                                                                \
+    if (u < 0 || u > 1) {                                                                                                       \
+      return (scalar_type)INFINITY;                                                                                             \
+    }                                                                                                                           \
+    lm2_v3_##S q = _lm2_bvh3_cross_##S(s, edge1);                                                                               \
+    scalar_type v = f * _lm2_bvh3_dot_##S(dir, q);                                                                              \
+    if (v < 0 || u + v > 1) {                                                                                                   \
+      return (scalar_type)INFINITY;                                                                                             \
+    }                                                                                                                           \
+    scalar_type t = f * _lm2_bvh3_dot_##S(edge2, q);                                                                            \
+    return t > epsilon && t <= t_max ? t : (scalar_type)INFINITY;                                                               \
+  }                                                                                                                             \
+                                                                                                                                \
+  static lm2_bvh3_hit_##S _lm2_bvh3_traverse_##S(const lm2_bvh3_##S* bvh, lm2_ray3_##S ray, bool any_hit) {                     \
+    LM2_ASSERT(bvh != NULL);                                                                                                    \
+    LM2_ASSERT_UNSAFE(isfinite(ray.origin.x) && isfinite(ray.origin.y) && isfinite(ray.origin.z));                              \
+    LM2_ASSERT_UNSAFE(isfinite(ray.direction.x) && isfinite(ray.direction.y) && isfinite(ray.direction.z));                     \
+                                                                                                                                \
+    lm2_bvh3_hit_##S result;                                                                                                    \
+    result.rayhit.hit = false;                                                                                                  \
+    result.rayhit.t = 0;                                                                                                        \
+    result.rayhit.point = (lm2_v3_##S) {0, 0, 0};                                                                               \
+    result.rayhit.normal = (lm2_v3_##S) {0, 0, 0};                                                                              \
+    result.triangle_index = 0;                                                                                                  \
+    if (bvh->node_count == 0) {                                                                                                 \
+      return result;                                                                                                            \
+    }                                                                                                                           \
+                                                                                                                                \
+    lm2_v3_##S inv_dir;                                                                                                         \
+    for (int k = 0; k < 3; k++) {                                                                                               \
+      scalar_type d = ray.direction.e[k];                                                                                       \
+      inv_dir.e[k] = d != 0 ? 1 / d : _LM2_BVH3_HUGE_##S;                                                                       \
+    }                                                                                                                           \
+                                                                                                                                \
+    const lm2_bvh3_node_##S* nodes = bvh->nodes;                                                                                \
+    scalar_type best_t = ray.t_max;                                                                                             \
+    uint32_t best = _LM2_BVH3_NONE;                                                                                             \
+    uint32_t stack[LM2_BVH3_MAX_DEPTH];                                                                                         \
+    scalar_type stack_t[LM2_BVH3_MAX_DEPTH];                                                                                    \
+    uint32_t top = 0;                                                                                                           \
+                                                                                                                                \
+    uint32_t node_index = 0;                                                                                                    \
+    bool visit = _lm2_bvh3_slab_##S(&nodes[0].bounds, ray.origin, inv_dir, best_t) != (scalar_type)INFINITY;                    \
+    while (visit) {                                                                                                             \
+      const lm2_bvh3_node_##S* node = &nodes[node_index];                                                                       \
+      if (node->count > 0) {                                                                                                    \
+        for (uint32_t i = node->first; i < node->first + node->count; i++) {                                                    \
+          const uint32_t tri = bvh->primitive_indices[i];                                                                       \
+          lm2_v3_##S v0, v1, v2;                                                                                                \
+          _lm2_bvh3_corners_##S(bvh, tri, &v0, &v1, &v2);                                                                       \
+          scalar_type t = _lm2_bvh3_triangle_##S(v0, v1, v2, ray.origin, ray.direction, best_t);                                \
+          if (t != (scalar_type)INFINITY && (best == _LM2_BVH3_NONE || t < best_t)) {                                           \
+            best_t = t;                                                                                                         \
+            best = tri;                                                                                                         \
+          }                                                                                                                     \
+        }                                                                                                                       \
+        if (any_hit && best != _LM2_BVH3_NONE) {                                                                                \
+          break;                                                                                                                \
+        }                                                                                                                       \
+      } else {                                                                                                                  \
+        uint32_t near_index = node->first;                                                                                      \
+        uint32_t far_index = node->first + 1;                                                                                   \
+        scalar_type t_near = _lm2_bvh3_slab_##S(&nodes[near_index].bounds, ray.origin, inv_dir, best_t);                        \
+        scalar_type t_far = _lm2_bvh3_slab_##S(&nodes[far_index].bounds, ray.origin, inv_dir, best_t);                          \
+        if (t_far < t_near) {                                                                                                   \
+          uint32_t tmp_index = near_index;                                                                                      \
+          near_index = far_index;                                                                                               \
+          far_index = tmp_index;                                                                                                \
+          scalar_type tmp_t = t_near;                                                                                           \
+          t_near = t_far;                                                                                                       \
+          t_far = tmp_t;                                                                                                        \
+        }                                                                                                                       \
+        if (t_near != (scalar_type)INFINITY) {                                                                                  \
+          if (t_far != (scalar_type)INFINITY) {                                                                                 \
+            stack[top] = far_index;                                                                                             \
+            stack_t[top] = t_far;                                                                                               \
+            top++;                                                                                                              \
+          }                                                                                                                     \
+          node_index = near_index;                                                                                              \
+          continue;                                                                                                             \
+        }                                                                                                                       \
+      }                                                                                                                         \
+                                                                                                                                \
+      /* Pop the next subtree that can still beat the best hit */                                                               \
+      visit = false;                                                                                                            \
+      while (top > 0) {                                                                                                         \
+        top--;                                                                                                                  \
+        if (stack_t[top] <= best_t) {                                                                                           \
+          node_index = stack[top];                                                                                              \
+          visit = true;                                                                                                         \
+          break;                                                                                                                \
+        }                                                                                                                       \
+      }                                                                                                                         \
+    }                                                                                                                           \
+                                                                                                                                \
+    if (best != _LM2_BVH3_NONE) {                                                                                               \
+      lm2_v3_##S v0, v1, v2;                                                                                                    \
+      _lm2_bvh3_corners_##S(bvh, best, &v0, &v1, &v2);                                                                          \
+      result.rayhit.hit = true;                                                                                                 \
+      result.rayhit.t = best_t;                                                                                                 \
+      result.rayhit.point.x = ray.origin.x + ray.direction.x * best_t;                                                          \
+      result.rayhit.point.y = ray.origin.y + ray.direction.y * best_t;                                                          \
+      result.rayhit.point.z = ray.origin.z + ray.direction.z * best_t;                                                          \
+      lm2_v3_##S n = _lm2_bvh3_cross_##S(_lm2_bvh3_sub_##S(v1, v0), _lm2_bvh3_sub_##S(v2, v0));                                 \
+      scalar_type inv_length = 1 / sqrt_fn(_lm2_bvh3_dot_##S(n, n));                                                            \
+      result.rayhit.normal.x = n.x * inv_length;                                                                                \
+      result.rayhit.normal.y = n.y * inv_length;                                                                                \
+      result.rayhit.normal.z = n.z * inv_length;                                                                                \
+      result.triangle_index = best;                                                                                             \
+    }                                                                                                                           \
+    return result;                                                                                                              \
+  }
+
+_LM2_IMPL_BVH3_TRAVERSE(double, f64, LM2_RAYCAST3_EPSILON_F64, sqrt)
+_LM2_IMPL_BVH3_TRAVERSE(float, f32, LM2_RAYCAST3_EPSILON_F32, sqrtf)
+
+// =============================================================================
+// Public API
+// =============================================================================
+
+#define _LM2_IMPL_BVH3_API(S)                                                                                                   \
+  LM2_API size_t lm2_bvh3_node_buffer_size_##S(size_t triangle_count) {                                                         \
+    return triangle_count > 0 ? 2 * triangle_count - 1 : 0;                                                                     \
+  }                                                                                                                             \
+                                                                                                                                \
+  LM2_API size_t lm2_bvh3_index_buffer_size_##S(size_t triangle_count) {                                                        \
+    return triangle_count;                                                                                                      \
+  }                                                                                                                             \
+                                                                                                                                \
+  LM2_API lm2_bvh3_##S lm2_bvh3_build_##S(                                                                                      \
+      const lm2_triangle3_##S* triangles,                                                                                       \
+      size_t triangle_count,                                                                                                    \
+      lm2_bvh3_node_##S* nodes,                                                                                                 \
+      size_t node_buffer_size,                                                                                                  \
+      uint32_t* primitive_indices,                                                                                              \
+      size_t index_buffer_size) {                                                                                               \
+    LM2_ASSERT(triangle_count == 0 || triangles != NULL);                                                                       \
+    LM2_ASSERT(triangle_count < UINT32_MAX / 2);                                                                                \
+                                                                                                                                \
+    lm2_bvh3_##S bvh;                                                                                                           \
+    bvh.nodes = nodes;                                                                                                          \
+    bvh.node_count = 0;                                                                                                         \
+    bvh.primitive_indices = primitive_indices;                                                                                  \
+    bvh.triangle_count = (uint32_t)triangle_count;                                                                              \
+    bvh.triangles = triangles;                                                                                                  \
+    bvh.vertices = NULL;                                                                                                        \
+    bvh.indices = NULL;                                                                                                         \
+    _lm2_bvh3_build_##S(&bvh, node_buffer_size, index_buffer_size);                                                             \
+    return bvh;                                                                                                                 \
+  }                                                                                                                             \
+                                                                                                                                \
+  LM2_API lm2_bvh3_##S lm2_bvh3_build_indexed_##S(                                                                              \
+      const lm2_v3_##S* vertices,                                                                                               \
+      size_t vertex_count,                                                                                                      \
+      const uint32_t* indices,                                                                                                  \
+      size_t index_count,                                                                                                       \
+      lm2_bvh3_node_##S* nodes,                                                                                                 \
+      size_t node_buffer_size,                                                                                                  \
+      uint32_t* primitive_indices,                                                                                              \
+      size_t index_buffer_size) {                                                                                               \
+    LM2_ASSERT(index_count == 0 || (vertices != NULL && indices != NULL));                                                      \
+    LM2_ASSERT(index_count % 3 == 0);                                                                                           \
+    LM2_ASSERT(index_count / 3 < UINT32_MAX / 2);                                                                               \
+    for (size_t i = 0; i < index_count; i++) {                                                                                  \
+      LM2_ASSERT(indices[i] < vertex_count);                                                                                    \
+    }                                                                                                                           \
+    (void)vertex_count;                                                                                                         \
+                                                                                                                                \
+    lm2_bvh3_##S bvh;                                                                                                           \
+    bvh.nodes = nodes;                                                                                                          \
+    bvh.node_count = 0;                                                                                                         \
+    bvh.primitive_indices = primitive_indices;                                                                                  \
+    bvh.triangle_count = (uint32_t)(index_count / 3);                                                                           \
+    bvh.triangles = NULL;                                                                                                       \
+    bvh.vertices = vertices;                                                                                                    \
+    bvh.indices = indices;                                                                                                      \
+    _lm2_bvh3_build_##S(&bvh, node_buffer_size, index_buffer_size);                                                             \
+    return bvh;                                                                                                                 \
+  }                                                                                                                             \
+                                                                                                                                \
+  LM2_API uint32_t lm2_bvh3_build_bounds_##S(                                                                                   \
+      const lm2_r3_##S* bounds,                                                                                                 \
+      size_t count,                                                                                                             \
+      lm2_bvh3_node_##S* nodes,                                                                                                 \
+      size_t node_buffer_size,                                                                                                  \
+      uint32_t* primitive_indices,                                                                                              \
+      size_t index_buffer_size) {                                                                                               \
+    return _lm2_bvh3_build_bounds_##S(bounds, count, nodes, node_buffer_size, primitive_indices, index_buffer_size, 1);         \
+  }                                                                                                                             \
+                                                                                                                                \
+  LM2_API uint32_t lm2_bvh3_build_bounds_parallel_##S(                                                                          \
+      const lm2_r3_##S* bounds,                                                                                                 \
+      size_t count,                                                                                                             \
+      lm2_bvh3_node_##S* nodes,                                                                                                 \
+      size_t node_buffer_size,                                                                                                  \
+      uint32_t* primitive_indices,                                                                                              \
+      size_t index_buffer_size,                                                                                                 \
+      uint32_t thread_count) {                                                                                                  \
+    return _lm2_bvh3_build_bounds_##S(                                                                                          \
+        bounds, count, nodes, node_buffer_size, primitive_indices, index_buffer_size, lm2_parallel_thread_count(thread_count)); \
+  }                                                                                                                             \
+                                                                                                                                \
+  LM2_API void lm2_bvh3_refit_bounds_##S(                                                                                       \
+      lm2_bvh3_node_##S* nodes,                                                                                                 \
+      uint32_t node_count,                                                                                                      \
+      const uint32_t* primitive_indices,                                                                                        \
+      const lm2_r3_##S* bounds) {                                                                                               \
+    LM2_ASSERT(node_count == 0 || (nodes != NULL && primitive_indices != NULL && bounds != NULL));                              \
+    _lm2_bvh3_refit_##S(nodes, node_count, primitive_indices, bounds, NULL);                                                    \
+  }                                                                                                                             \
+                                                                                                                                \
+  LM2_API void lm2_bvh3_refit_##S(lm2_bvh3_##S* bvh) {                                                                          \
+    LM2_ASSERT(bvh != NULL);                                                                                                    \
+    _lm2_bvh3_refit_##S(bvh->nodes, bvh->node_count, bvh->primitive_indices, NULL, bvh);                                        \
+  }                                                                                                                             \
+                                                                                                                                \
+  LM2_API lm2_bvh3_hit_##S lm2_bvh3_raycast_##S(const lm2_bvh3_##S* bvh, lm2_ray3_##S ray) {                                    \
+    return _lm2_bvh3_traverse_##S(bvh, ray, false);                                                                             \
+  }                                                                                                                             \
+                                                                                                                                \
+  LM2_API lm2_bvh3_hit_##S lm2_bvh3_raycast_any_##S(const lm2_bvh3_##S* bvh, lm2_ray3_##S ray) {                                \
+    return _lm2_bvh3_traverse_##S(bvh, ray, true);                                                                              \
+  }                                                                                                                             \
+                                                                                                                                \
+  LM2_API void lm2_bvh3_get_triangle_##S(const lm2_bvh3_##S* bvh, uint32_t triangle_index, lm2_triangle3_##S tri) {             \
+    LM2_ASSERT(bvh != NULL);                                                                                                    \
+    LM2_ASSERT(triangle_index < bvh->triangle_count);                                                                           \
+    _lm2_bvh3_corners_##S(bvh, triangle_index, &tri[0], &tri[1], &tri[2]);                                                      \
+  }
+
+_LM2_IMPL_BVH3_API(f64)
+_LM2_IMPL_BVH3_API(f32)
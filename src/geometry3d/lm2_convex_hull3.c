@@ -0,0 +1,604 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <float.h>
+#include <lm2/geometry3d/lm2_convex_hull3.h>
+#include <lm2/scalar/lm2_scalar.h>
+#include <lm2/vectors/lm2_vector_specifics.h>
+#include <math.h>
+#include "../misc/lm2_parallel.h"
+#include "../misc/lm2_scratch.h"
+
+// =============================================================================
+// Convex Hull of a Point Set
+// =============================================================================
+// Faces are triangles with the neighbour across each edge, so the horizon of
+// an eye point is found by a depth-first walk from the face it was assigned
+// to. The walk visits the edges of each face counter-clockwise, which puts
+// the horizon edges in order around the eye; the new faces are linked to each
+// other through that order. Points outside the hull hang in a list on one
+// face they are outside of, the farthest one first. Removed faces stay in the
+// face array, and a forward pass over the array reaches every new face after
+// it is created.
+//
+// The chunks are fixed slices of the input, so the result is the same for
+// every thread count. A chunk whose points do not span a volume passes all of
+// its points on to the final hull.
+
+// Points per chunk; inputs up to this size run on the calling thread
+#define _LM2_CONVEX_HULL3_CHUNK_SIZE 32768
+
+// Marks the end of an outside point list and an unused vertex
+#define _LM2_CONVEX_HULL3_NONE UINT32_MAX
+
+// Grows *data to hold at least needed elements
+static bool _lm2_convex_hull3_reserve(void** data, size_t* capacity, size_t needed, size_t element_size) {
+  if (needed <= *capacity) {
+    return true;
+  }
+  size_t grown = *capacity < 16 ? 16 : *capacity * 2;
+  while (grown < needed) {
+    grown *= 2;
+  }
+  void* data_grown = lm2_realloc(*data, grown * element_size);
+  if (data_grown == NULL) {
+    return false;
+  }
+  *data = data_grown;
+  *capacity = grown;
+  return true;
+}
+
+// One step of the horizon walk: a visible face and the edges left to cross
+typedef struct _lm2_convex_hull3_frame {
+  uint32_t face;
+  uint32_t edge;
+  uint32_t edges_left;
+} _lm2_convex_hull3_frame;
+
+// A horizon edge: edge of a visible face whose neighbour is not visible
+typedef struct _lm2_convex_hull3_edge {
+  uint32_t face;
+  uint32_t edge;
+} _lm2_convex_hull3_edge;
+
+#define _LM2_IMPL_CONVEX_HULL3(scalar_type, S, machine_epsilon)                                                                                      \
+  typedef struct _lm2_convex_hull3_face_##S {                                                                                                        \
+    uint32_t vertices[3];                                                                                                                            \
+    uint32_t neighbours[3]; /* face across the edge vertices[i] -> vertices[i + 1] */                                                                \
+    lm2_v3_##S normal;                                                                                                                               \
+    scalar_type offset;                                                                                                                              \
+    uint32_t outside; /* head of the outside point list, the farthest point */                                                                       \
+    scalar_type outside_distance;                                                                                                                    \
+    uint32_t visit;                                                                                                                                  \
+    bool alive;                                                                                                                                      \
+  } _lm2_convex_hull3_face_##S;                                                                                                                      \
+                                                                                                                                                     \
+  typedef struct _lm2_convex_hull3_##S {                                                                                                             \
+    const lm2_v3_##S* points;                                                                                                                        \
+    size_t point_count;                                                                                                                              \
+    scalar_type epsilon;                                                                                                                             \
+    uint32_t* next; /* outside point list links */                                                                                                   \
+    _lm2_convex_hull3_face_##S* faces;                                                                                                               \
+    size_t face_count;                                                                                                                               \
+    size_t face_capacity;                                                                                                                            \
+    _lm2_convex_hull3_frame* frames;                                                                                                                 \
+    size_t frame_capacity;                                                                                                                           \
+    _lm2_convex_hull3_edge* horizon;                                                                                                                 \
+    size_t horizon_capacity;                                                                                                                         \
+    uint32_t* visible;                                                                                                                               \
+    size_t visible_capacity;                                                                                                                         \
+    bool failed;                                                                                                                                     \
+  } _lm2_convex_hull3_##S;                                                                                                                           \
+                                                                                                                                                     \
+  static inline lm2_v3_##S _lm2_convex_hull3_sub_##S(lm2_v3_##S a, lm2_v3_##S b) {                                                                   \
+    lm2_v3_##S r = {a.x - b.x, a.y - b.y, a.z - b.z};                                                                                                \
+    return r;                                                                                                                                        \
+  }                                                                                                                                                  \
+  static inline lm2_v3_##S _lm2_convex_hull3_cross_##S(lm2_v3_##S a, lm2_v3_##S b) {                                                                 \
+    lm2_v3_##S r = {a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x};                                                            \
+    return r;                                                                                                                                        \
+  }                                                                                                                                                  \
+  static inline scalar_type _lm2_convex_hull3_dot_##S(lm2_v3_##S a, lm2_v3_##S b) {                                                                  \
+    return a.x * b.x + a.y * b.y + a.z * b.z;                                                                                                        \
+  }                                                                                                                                                  \
+                                                                                                                                                     \
+  static inline bool _lm2_convex_hull3_finite_##S(lm2_v3_##S p) {                                                                                    \
+    return isfinite(p.x) && isfinite(p.y) && isfinite(p.z);                                                                                          \
+  }                                                                                                                                                  \
+                                                                                                                                                     \
+  static inline scalar_type _lm2_convex_hull3_distance_##S(const _lm2_convex_hull3_face_##S* face, lm2_v3_##S p) {                                   \
+    return _lm2_convex_hull3_dot_##S(face->normal, p) - face->offset;                                                                                \
+  }                                                                                                                                                  \
+                                                                                                                                                     \
+  static void _lm2_convex_hull3_add_outside_##S(                                                                                                     \
+      _lm2_convex_hull3_##S* hull, _lm2_convex_hull3_face_##S* face, uint32_t point, scalar_type distance) {                                         \
+    if (face->outside == _LM2_CONVEX_HULL3_NONE || distance > face->outside_distance) {                                                              \
+      hull->next[point] = face->outside;                                                                                                             \
+      face->outside = point;                                                                                                                         \
+      face->outside_distance = distance;                                                                                                             \
+    } else {                                                                                                                                         \
+      hull->next[point] = hull->next[face->outside];                                                                                                 \
+      hull->next[face->outside] = point;                                                                                                             \
+    }                                                                                                                                                \
+  }                                                                                                                                                  \
+                                                                                                                                                     \
+  /* Appends a face without neighbours; returns its index */                                                                                         \
+  static uint32_t _lm2_convex_hull3_add_face_##S(_lm2_convex_hull3_##S* hull, uint32_t a, uint32_t b, uint32_t c) {                                  \
+    if (!_lm2_convex_hull3_reserve(                                                                                                                  \
+            (void**)&hull->faces, &hull->face_capacity, hull->face_count + 1, sizeof(_lm2_convex_hull3_face_##S))) {                                 \
+      hull->failed = true;                                                                                                                           \
+      return _LM2_CONVEX_HULL3_NONE;                                                                                                                 \
+    }                                                                                                                                                \
+    _lm2_convex_hull3_face_##S* face = &hull->faces[hull->face_count];                                                                               \
+    lm2_v3_##S pa = hull->points[a];                                                                                                                 \
+    lm2_v3_##S normal = _lm2_convex_hull3_cross_##S(_lm2_convex_hull3_sub_##S(hull->points[b], pa), _lm2_convex_hull3_sub_##S(hull->points[c], pa)); \
+    scalar_type length = lm2_v3_length_##S(normal);                                                                                                  \
+    face->vertices[0] = a;                                                                                                                           \
+    face->vertices[1] = b;                                                                                                                           \
+    face->vertices[2] = c;                                                                                                                           \
+    face->normal = length > 0 ? lm2_v3_mul_s_##S(normal, 1 / length) : lm2_v3_zero_##S();                                                            \
+    face->offset = _lm2_convex_hull3_dot_##S(face->normal, pa);                                                                                      \
+    face->outside = _LM2_CONVEX_HULL3_NONE;                                                                                                          \
+    face->outside_distance = 0;                                                                                                                      \
+    face->visit = 0;                                                                                                                                 \
+    face->alive = true;                                                                                                                              \
+    return (uint32_t)hull->face_count++;                                                                                                             \
+  }                                                                                                                                                  \
+                                                                                                                                                     \
+  /* Builds the starting tetrahedron and assigns every point to it; false if the points span no volume */                                            \
+  static bool _lm2_convex_hull3_start_##S(_lm2_convex_hull3_##S* hull) {                                                                             \
+    const lm2_v3_##S* points = hull->points;                                                                                                         \
+    size_t count = hull->point_count;                                                                                                                \
+    uint32_t extremes[6];                                                                                                                            \
+    size_t first = 0;                                                                                                                                \
+    while (first < count && !_lm2_convex_hull3_finite_##S(points[first])) {                                                                          \
+      first++;                                                                                                                                       \
+    }                                                                                                                                                \
+    if (first == count) {                                                                                                                            \
+      return false;                                                                                                                                  \
+    }                                                                                                                                                \
+    for (int e = 0; e < 6; e++) {                                                                                                                    \
+      extremes[e] = (uint32_t)first;                                                                                                                 \
+    }                                                                                                                                                \
+    scalar_type magnitude[3] = {0, 0, 0};                                                                                                            \
+    for (size_t i = first; i < count; i++) {                                                                                                         \
+      lm2_v3_##S p = points[i];                                                                                                                      \
+      if (!_lm2_convex_hull3_finite_##S(p)) {                                                                                                        \
+        continue;                                                                                                                                    \
+      }                                                                                                                                              \
+      scalar_type coords[3] = {p.x, p.y, p.z};                                                                                                       \
+      for (int axis = 0; axis < 3; axis++) {                                                                                                         \
+        lm2_v3_##S low = points[extremes[2 * axis]];                                                                                                 \
+        lm2_v3_##S high = points[extremes[2 * axis + 1]];                                                                                            \
+        scalar_type low_coords[3] = {low.x, low.y, low.z};                                                                                           \
+        scalar_type high_coords[3] = {high.x, high.y, high.z};                                                                                       \
+        if (coords[axis] < low_coords[axis]) {                                                                                                       \
+          extremes[2 * axis] = (uint32_t)i;                                                                                                          \
+        }                                                                                                                                            \
+        if (coords[axis] > high_coords[axis]) {                                                                                                      \
+          extremes[2 * axis + 1] = (uint32_t)i;                                                                                                      \
+        }                                                                                                                                            \
+        magnitude[axis] = lm2_max_##S(magnitude[axis], lm2_abs_##S(coords[axis]));                                                                   \
+      }                                                                                                                                              \
+    }                                                                                                                                                \
+    hull->epsilon = 3 * (magnitude[0] + magnitude[1] + magnitude[2]) * machine_epsilon;                                                              \
+                                                                                                                                                     \
+    /* The two extremes farthest apart on one axis, the point farthest from their line,                                                              \
+       and the point farthest from the plane of those three */                                                                                       \
+    uint32_t a = extremes[0];                                                                                                                        \
+    uint32_t b = extremes[1];                                                                                                                        \
+    scalar_type best = lm2_v3_distance_sq_##S(points[a], points[b]);                                                                                 \
+    for (int axis = 1; axis < 3; axis++) {                                                                                                           \
+      scalar_type distance = lm2_v3_distance_sq_##S(points[extremes[2 * axis]], points[extremes[2 * axis + 1]]);                                     \
+      if (distance > best) {                                                                                                                         \
+        best = distance;                                                                                                                             \
+        a = extremes[2 * axis];                                                                                                                      \
+        b = extremes[2 * axis + 1];                                                                                                                  \
+      }                                                                                                                                              \
+    }                                                                                                                                                \
+    if (!(lm2_sqrt_##S(best) > hull->epsilon)) {                                                                                                     \
+      return false;                                                                                                                                  \
+    }                                                                                                                                                \
+    lm2_v3_##S ab = _lm2_convex_hull3_sub_##S(points[b], points[a]);                                                                                 \
+    uint32_t c = a;                                                                                                                                  \
+    best = 0;                                                                                                                                        \
+    for (size_t i = first; i < count; i++) {                                                                                                         \
+      if (!_lm2_convex_hull3_finite_##S(points[i])) {                                                                                                \
+        continue;                                                                                                                                    \
+      }                                                                                                                                              \
+      lm2_v3_##S cross = _lm2_convex_hull3_cross_##S(ab, _lm2_convex_hull3_sub_##S(points[i], points[a]));                                           \
+      scalar_type area = _lm2_convex_hull3_dot_##S(cross, cross);                                                                                    \
+      if (area > best) {                                                                                                                             \
+        best = area;                                                                                                                                 \
+        c = (uint32_t)i;                                                                                                                             \
+      }                                                                                                                                              \
+    }                                                                                                                                                \
+    if (!(lm2_sqrt_##S(best) / lm2_v3_length_##S(ab) > hull->epsilon)) {                                                                             \
+      return false;                                                                                                                                  \
+    }                                                                                                                                                \
+    lm2_v3_##S normal = lm2_v3_norm_##S(_lm2_convex_hull3_cross_##S(ab, _lm2_convex_hull3_sub_##S(points[c], points[a])));                           \
+    uint32_t d = a;                                                                                                                                  \
+    best = 0;                                                                                                                                        \
+    scalar_type side = 0;                                                                                                                            \
+    for (size_t i = first; i < count; i++) {                                                                                                         \
+      if (!_lm2_convex_hull3_finite_##S(points[i])) {                                                                                                \
+        continue;                                                                                                                                    \
+      }                                                                                                                                              \
+      scalar_type distance = _lm2_convex_hull3_dot_##S(normal, _lm2_convex_hull3_sub_##S(points[i], points[a]));                                     \
+      if (lm2_abs_##S(distance) > best) {                                                                                                            \
+        best = lm2_abs_##S(distance);                                                                                                                \
+        side = distance;                                                                                                                             \
+        d = (uint32_t)i;                                                                                                                             \
+      }                                                                                                                                              \
+    }                                                                                                                                                \
+    if (!(best > hull->epsilon)) {                                                                                                                   \
+      return false;                                                                                                                                  \
+    }                                                                                                                                                \
+                                                                                                                                                     \
+    /* Base (a, b, c) faces away from d, each side face shares one base edge */                                                                      \
+    if (side > 0) {                                                                                                                                  \
+      uint32_t swap = b;                                                                                                                             \
+      b = c;                                                                                                                                         \
+      c = swap;                                                                                                                                      \
+    }                                                                                                                                                \
+    uint32_t f0 = _lm2_convex_hull3_add_face_##S(hull, a, b, c);                                                                                     \
+    uint32_t f1 = _lm2_convex_hull3_add_face_##S(hull, b, a, d);                                                                                     \
+    uint32_t f2 = _lm2_convex_hull3_add_face_##S(hull, c, b, d);                                                                                     \
+    uint32_t f3 = _lm2_convex_hull3_add_face_##S(hull, a, c, d);                                                                                     \
+    if (hull->failed) {                                                                                                                              \
+      return false;                                                                                                                                  \
+    }                                                                                                                                                \
+    _lm2_convex_hull3_face_##S* faces = hull->faces;                                                                                                 \
+    uint32_t links[4][3] = {{f1, f2, f3}, {f0, f3, f2}, {f0, f1, f3}, {f0, f2, f1}};                                                                 \
+    for (int f = 0; f < 4; f++) {                                                                                                                    \
+      for (int e = 0; e < 3; e++) {                                                                                                                  \
+        faces[f].neighbours[e] = links[f][e];                                                                                                        \
+      }                                                                                                                                              \
+    }                                                                                                                                                \
+                                                                                                                                                     \
+    for (size_t i = first; i < count; i++) {                                                                                                         \
+      if (!_lm2_convex_hull3_finite_##S(points[i])) {                                                                                                \
+        continue;                                                                                                                                    \
+      }                                                                                                                                              \
+      for (int f = 0; f < 4; f++) {                                                                                                                  \
+        scalar_type distance = _lm2_convex_hull3_distance_##S(&faces[f], points[i]);                                                                 \
+        if (distance > hull->epsilon) {                                                                                                              \
+          _lm2_convex_hull3_add_outside_##S(hull, &faces[f], (uint32_t)i, distance);                                                                 \
+          break;                                                                                                                                     \
+        }                                                                                                                                            \
+      }                                                                                                                                              \
+    }                                                                                                                                                \
+    return true;                                                                                                                                     \
+  }                                                                                                                                                  \
+                                                                                                                                                     \
+  /* Collects the faces the eye sees and the horizon around them; false if they do not form a disc */                                                \
+  static bool _lm2_convex_hull3_horizon_##S(                                                                                                         \
+      _lm2_convex_hull3_##S* hull, uint32_t start, lm2_v3_##S eye, uint32_t visit, size_t* visible_count,                                            \
+      size_t* horizon_count) {                                                                                                                       \
+    size_t frame_count = 0;                                                                                                                          \
+    *visible_count = 0;                                                                                                                              \
+    *horizon_count = 0;                                                                                                                              \
+    if (!_lm2_convex_hull3_reserve((void**)&hull->frames, &hull->frame_capacity, 1, sizeof(_lm2_convex_hull3_frame)) ||                              \
+        !_lm2_convex_hull3_reserve((void**)&hull->visible, &hull->visible_capacity, 1, sizeof(uint32_t))) {                                          \
+      hull->failed = true;                                                                                                                           \
+      return false;                                                                                                                                  \
+    }                                                                                                                                                \
+    hull->faces[start].visit = visit;                                                                                                                \
+    hull->visible[(*visible_count)++] = start;                                                                                                       \
+    hull->frames[frame_count++] = (_lm2_convex_hull3_frame){start, 0, 3};                                                                            \
+    while (frame_count > 0) {                                                                                                                        \
+      _lm2_convex_hull3_frame* frame = &hull->frames[frame_count - 1];                                                                               \
+      if (frame->edges_left == 0) {                                                                                                                  \
+        frame_count--;                                                                                                                               \
+        continue;                                                                                                                                    \
+      }                                                                                                                                              \
+      uint32_t face = frame->face;                                                                                                                   \
+      uint32_t edge = frame->edge;                                                                                                                   \
+      frame->edge = (frame->edge + 1) % 3;                                                                                                           \
+      frame->edges_left--;                                                                                                                           \
+      uint32_t neighbour = hull->faces[face].neighbours[edge];                                                                                       \
+      if (hull->faces[neighbour].visit == visit) {                                                                                                   \
+        continue;                                                                                                                                    \
+      }                                                                                                                                              \
+      if (_lm2_convex_hull3_distance_##S(&hull->faces[neighbour], eye) > hull->epsilon) {                                                            \
+        uint32_t back = 0;                                                                                                                           \
+        while (back < 3 && hull->faces[neighbour].neighbours[back] != face) {                                                                        \
+          back++;                                                                                                                                    \
+        }                                                                                                                                            \
+        if (back == 3 ||                                                                                                                             \
+            !_lm2_convex_hull3_reserve(                                                                                                              \
+                (void**)&hull->frames, &hull->frame_capacity, frame_count + 1, sizeof(_lm2_convex_hull3_frame)) ||                                   \
+            !_lm2_convex_hull3_reserve(                                                                                                              \
+                (void**)&hull->visible, &hull->visible_capacity, *visible_count + 1, sizeof(uint32_t))) {                                            \
+          hull->failed = back < 3;                                                                                                                   \
+          return false;                                                                                                                              \
+        }                                                                                                                                            \
+        hull->faces[neighbour].visit = visit;                                                                                                        \
+        hull->visible[(*visible_count)++] = neighbour;                                                                                               \
+        hull->frames[frame_count++] = (_lm2_convex_hull3_frame){neighbour, (back + 1) % 3, 2};                                                       \
+      } else {                                                                                                                                       \
+        if (!_lm2_convex_hull3_reserve(                                                                                                              \
+                (void**)&hull->horizon, &hull->horizon_capacity, *horizon_count + 1, sizeof(_lm2_convex_hull3_edge))) {                              \
+          hull->failed = true;                                                                                                                       \
+          return false;                                                                                                                              \
+        }                                                                                                                                            \
+        hull->horizon[(*horizon_count)++] = (_lm2_convex_hull3_edge){face, edge};                                                                    \
+      }                                                                                                                                              \
+    }                                                                                                                                                \
+                                                                                                                                                     \
+    /* Each horizon edge must start where the previous one ends */                                                                                   \
+    for (size_t h = 0; h < *horizon_count; h++) {                                                                                                    \
+      _lm2_convex_hull3_edge current = hull->horizon[h];                                                                                             \
+      _lm2_convex_hull3_edge next = hull->horizon[(h + 1) % *horizon_count];                                                                         \
+      if (hull->faces[current.face].vertices[(current.edge + 1) % 3] != hull->faces[next.face].vertices[next.edge]) {                                \
+        return false;                                                                                                                                \
+      }                                                                                                                                              \
+    }                                                                                                                                                \
+    return *horizon_count >= 3;                                                                                                                      \
+  }                                                                                                                                                  \
+                                                                                                                                                     \
+  /* Adds one point to the hull: replaces the faces it sees by a fan around it */                                                                    \
+  static void _lm2_convex_hull3_add_point_##S(_lm2_convex_hull3_##S* hull, uint32_t start, uint32_t visit) {                                         \
+    uint32_t eye = hull->faces[start].outside;                                                                                                       \
+    lm2_v3_##S eye_point = hull->points[eye];                                                                                                        \
+    size_t visible_count;                                                                                                                            \
+    size_t horizon_count;                                                                                                                            \
+    if (!_lm2_convex_hull3_horizon_##S(hull, start, eye_point, visit, &visible_count, &horizon_count)) {                                             \
+      /* Numerically inconsistent visibility: leave the point out */                                                                                 \
+      _lm2_convex_hull3_face_##S* face = &hull->faces[start];                                                                                        \
+      face->outside = hull->next[eye];                                                                                                               \
+      face->outside_distance =                                                                                                                       \
+          face->outside == _LM2_CONVEX_HULL3_NONE                                                                                                    \
+              ? 0                                                                                                                                    \
+              : _lm2_convex_hull3_distance_##S(face, hull->points[face->outside]);                                                                   \
+      return;                                                                                                                                        \
+    }                                                                                                                                                \
+                                                                                                                                                     \
+    uint32_t first_new = (uint32_t)hull->face_count;                                                                                                 \
+    for (size_t h = 0; h < horizon_count; h++) {                                                                                                     \
+      _lm2_convex_hull3_edge edge = hull->horizon[h];                                                                                                \
+      uint32_t a = hull->faces[edge.face].vertices[edge.edge];                                                                                       \
+      uint32_t b = hull->faces[edge.face].vertices[(edge.edge + 1) % 3];                                                                             \
+      uint32_t outer = hull->faces[edge.face].neighbours[edge.edge];                                                                                 \
+      uint32_t added = _lm2_convex_hull3_add_face_##S(hull, a, b, eye);                                                                              \
+      if (hull->failed) {                                                                                                                            \
+        return;                                                                                                                                      \
+      }                                                                                                                                              \
+      _lm2_convex_hull3_face_##S* face = &hull->faces[added];                                                                                        \
+      face->neighbours[0] = outer;                                                                                                                   \
+      face->neighbours[1] = first_new + (uint32_t)((h + 1) % horizon_count);                                                                         \
+      face->neighbours[2] = first_new + (uint32_t)((h + horizon_count - 1) % horizon_count);                                                         \
+      for (int e = 0; e < 3; e++) {                                                                                                                  \
+        if (hull->faces[outer].neighbours[e] == edge.face) {                                                                                         \
+          hull->faces[outer].neighbours[e] = added;                                                                                                  \
+        }                                                                                                                                            \
+      }                                                                                                                                              \
+    }                                                                                                                                                \
+                                                                                                                                                     \
+    /* Hand the outside points of the removed faces to the new faces */                                                                              \
+    size_t new_count = hull->face_count;                                                                                                             \
+    for (size_t v = 0; v < visible_count; v++) {                                                                                                     \
+      _lm2_convex_hull3_face_##S* removed = &hull->faces[hull->visible[v]];                                                                          \
+      removed->alive = false;                                                                                                                        \
+      uint32_t point = removed->outside;                                                                                                             \
+      removed->outside = _LM2_CONVEX_HULL3_NONE;                                                                                                     \
+      while (point != _LM2_CONVEX_HULL3_NONE) {                                                                                                      \
+        uint32_t next = hull->next[point];                                                                                                           \
+        if (point != eye) {                                                                                                                          \
+          for (size_t f = first_new; f < new_count; f++) {                                                                                           \
+            scalar_type distance = _lm2_convex_hull3_distance_##S(&hull->faces[f], hull->points[point]);                                             \
+            if (distance > hull->epsilon) {                                                                                                          \
+              _lm2_convex_hull3_add_outside_##S(hull, &hull->faces[f], point, distance);                                                             \
+              break;                                                                                                                                 \
+            }                                                                                                                                        \
+          }                                                                                                                                          \
+        }                                                                                                                                            \
+        point = next;                                                                                                                                \
+      }                                                                                                                                              \
+    }                                                                                                                                                \
+  }                                                                                                                                                  \
+                                                                                                                                                     \
+  /* Runs quickhull over points; false if they span no volume or memory ran out */                                                                   \
+  static bool _lm2_convex_hull3_build_##S(_lm2_convex_hull3_##S* hull, const lm2_v3_##S* points, size_t count) {                                     \
+    hull->points = points;                                                                                                                           \
+    hull->point_count = count;                                                                                                                       \
+    hull->next = (uint32_t*)lm2_malloc(count * sizeof(uint32_t));                                                                                    \
+    if (hull->next == NULL) {                                                                                                                        \
+      hull->failed = true;                                                                                                                           \
+      return false;                                                                                                                                  \
+    }                                                                                                                                                \
+    if (!_lm2_convex_hull3_start_##S(hull)) {                                                                                                        \
+      return false;                                                                                                                                  \
+    }                                                                                                                                                \
+    uint32_t visit = 0;                                                                                                                              \
+    for (size_t f = 0; f < hull->face_count && !hull->failed; f++) {                                                                                 \
+      while (hull->faces[f].alive && hull->faces[f].outside != _LM2_CONVEX_HULL3_NONE && !hull->failed) {                                            \
+        _lm2_convex_hull3_add_point_##S(hull, (uint32_t)f, ++visit);                                                                                 \
+      }                                                                                                                                              \
+    }                                                                                                                                                \
+    return !hull->failed;                                                                                                                            \
+  }                                                                                                                                                  \
+                                                                                                                                                     \
+  static void _lm2_convex_hull3_free_##S(_lm2_convex_hull3_##S* hull) {                                                                              \
+    lm2_free(hull->next);                                                                                                                            \
+    lm2_free(hull->faces);                                                                                                                           \
+    lm2_free(hull->frames);                                                                                                                          \
+    lm2_free(hull->horizon);                                                                                                                         \
+    lm2_free(hull->visible);                                                                                                                         \
+  }                                                                                                                                                  \
+                                                                                                                                                     \
+  typedef struct _lm2_convex_hull3_chunk_##S {                                                                                                       \
+    lm2_v3_##S* vertices;                                                                                                                            \
+    size_t vertex_count;                                                                                                                             \
+    bool failed;                                                                                                                                     \
+  } _lm2_convex_hull3_chunk_##S;                                                                                                                     \
+                                                                                                                                                     \
+  typedef struct _lm2_convex_hull3_chunks_##S {                                                                                                      \
+    const lm2_v3_##S* points;                                                                                                                        \
+    size_t point_count;                                                                                                                              \
+    _lm2_convex_hull3_chunk_##S* chunks;                                                                                                             \
+  } _lm2_convex_hull3_chunks_##S;                                                                                                                    \
+                                                                                                                                                     \
+  static void _lm2_convex_hull3_chunk_task_##S(void* context, size_t begin, size_t end) {                                                            \
+    _lm2_convex_hull3_chunks_##S* work = (_lm2_convex_hull3_chunks_##S*)context;                                                                     \
+    for (size_t c = begin; c < end; c++) {                                                                                                           \
+      _lm2_convex_hull3_chunk_##S* chunk = &work->chunks[c];                                                                                         \
+      size_t first = c * _LM2_CONVEX_HULL3_CHUNK_SIZE;                                                                                               \
+      size_t count = work->point_count - first < _LM2_CONVEX_HULL3_CHUNK_SIZE ? work->point_count - first                                            \
+                                                                              : _LM2_CONVEX_HULL3_CHUNK_SIZE;                                        \
+      const lm2_v3_##S* points = work->points + first;                                                                                               \
+      _lm2_convex_hull3_##S hull = {0};                                                                                                              \
+      bool spans_volume = _lm2_convex_hull3_build_##S(&hull, points, count);                                                                         \
+      chunk->failed = hull.failed;                                                                                                                   \
+      if (!chunk->failed) {                                                                                                                          \
+        chunk->vertices = (lm2_v3_##S*)lm2_malloc(count * sizeof(lm2_v3_##S));                                                                       \
+        chunk->failed = chunk->vertices == NULL;                                                                                                     \
+      }                                                                                                                                              \
+      if (!chunk->failed) {                                                                                                                          \
+        /* Mark the hull vertices in the outside links, which are no longer needed */                                                                \
+        for (size_t i = 0; i < count; i++) {                                                                                                         \
+          hull.next[i] = spans_volume ? _LM2_CONVEX_HULL3_NONE : 0;                                                                                  \
+        }                                                                                                                                            \
+        for (size_t f = 0; f < hull.face_count; f++) {                                                                                               \
+          if (hull.faces[f].alive) {                                                                                                                 \
+            for (int v = 0; v < 3; v++) {                                                                                                            \
+              hull.next[hull.faces[f].vertices[v]] = 0;                                                                                              \
+            }                                                                                                                                        \
+          }                                                                                                                                          \
+        }                                                                                                                                            \
+        for (size_t i = 0; i < count; i++) {                                                                                                         \
+          if (hull.next[i] == 0 && _lm2_convex_hull3_finite_##S(points[i])) {                                                                        \
+            chunk->vertices[chunk->vertex_count++] = points[i];                                                                                      \
+          }                                                                                                                                          \
+        }                                                                                                                                            \
+      }                                                                                                                                              \
+      _lm2_convex_hull3_free_##S(&hull);                                                                                                             \
+    }                                                                                                                                                \
+  }                                                                                                                                                  \
+                                                                                                                                                     \
+  LM2_API lm2_indexed_mesh3_size lm2_convex_hull3_##S(                                                                                               \
+      const lm2_v3_##S* points,                                                                                                                      \
+      size_t point_count,                                                                                                                            \
+      lm2_v3_##S* out_vertices,                                                                                                                      \
+      size_t vertex_capacity,                                                                                                                        \
+      uint32_t* out_indices,                                                                                                                         \
+      size_t index_capacity,                                                                                                                         \
+      uint32_t thread_count) {                                                                                                                       \
+    LM2_ASSERT(points != NULL || point_count == 0);                                                                                                  \
+    LM2_ASSERT(out_vertices != NULL || vertex_capacity == 0);                                                                                        \
+    LM2_ASSERT(out_indices != NULL || index_capacity == 0);                                                                                          \
+    LM2_ASSERT(point_count < UINT32_MAX);                                                                                                            \
+    lm2_indexed_mesh3_size size = {0, 0};                                                                                                            \
+    if (point_count < 4) {                                                                                                                           \
+      return size;                                                                                                                                   \
+    }                                                                                                                                                \
+                                                                                                                                                     \
+    /* Hull of the chunk hull vertices; a single chunk is the input itself */                                                                        \
+    size_t chunk_count = (point_count + _LM2_CONVEX_HULL3_CHUNK_SIZE - 1) / _LM2_CONVEX_HULL3_CHUNK_SIZE;                                            \
+    const lm2_v3_##S* candidates = points;                                                                                                           \
+    size_t candidate_count = point_count;                                                                                                            \
+    lm2_v3_##S* merged = NULL;                                                                                                                       \
+    if (chunk_count > 1) {                                                                                                                           \
+      _lm2_convex_hull3_chunks_##S work;                                                                                                             \
+      work.points = points;                                                                                                                          \
+      work.point_count = point_count;                                                                                                                \
+      work.chunks = (_lm2_convex_hull3_chunk_##S*)lm2_calloc(chunk_count, sizeof(_lm2_convex_hull3_chunk_##S));                                      \
+      if (work.chunks == NULL) {                                                                                                                     \
+        return size;                                                                                                                                 \
+      }                                                                                                                                              \
+      lm2_parallel_for(chunk_count, 1, lm2_parallel_thread_count(thread_count), _lm2_convex_hull3_chunk_task_##S, &work);                            \
+      bool failed = false;                                                                                                                           \
+      candidate_count = 0;                                                                                                                           \
+      for (size_t c = 0; c < chunk_count; c++) {                                                                                                     \
+        failed |= work.chunks[c].failed;                                                                                                             \
+        candidate_count += work.chunks[c].vertex_count;                                                                                              \
+      }                                                                                                                                              \
+      merged = failed ? NULL : (lm2_v3_##S*)lm2_malloc(candidate_count * sizeof(lm2_v3_##S));                                                        \
+      if (merged != NULL) {                                                                                                                          \
+        size_t offset = 0;                                                                                                                           \
+        for (size_t c = 0; c < chunk_count; c++) {                                                                                                   \
+          for (size_t k = 0; k < work.chunks[c].vertex_count; k++) {                                                                                 \
+            merged[offset++] = work.chunks[c].vertices[k];                                                                                           \
+          }                                                                                                                                          \
+        }                                                                                                                                            \
+      }                                                                                                                                              \
+      for (size_t c = 0; c < chunk_count; c++) {                                                                                                     \
+        lm2_free(work.chunks[c].vertices);                                                                                                           \
+      }                                                                                                                                              \
+      lm2_free(work.chunks);                                                                                                                         \
+      if (merged == NULL) {                                                                                                                          \
+        return size;                                                                                                                                 \
+      }                                                                                                                                              \
+      candidates = merged;                                                                                                                           \
+    }                                                                                                                                                \
+                                                                                                                                                     \
+    _lm2_convex_hull3_##S hull = {0};                                                                                                                \
+    if (_lm2_convex_hull3_build_##S(&hull, candidates, candidate_count)) {                                                                           \
+      /* Number the vertices in order of first use; the outside links become the remap table */                                                      \
+      for (size_t i = 0; i < candidate_count; i++) {                                                                                                 \
+        hull.next[i] = _LM2_CONVEX_HULL3_NONE;                                                                                                       \
+      }                                                                                                                                              \
+      for (size_t f = 0; f < hull.face_count; f++) {                                                                                                 \
+        if (!hull.faces[f].alive) {                                                                                                                  \
+          continue;                                                                                                                                  \
+        }                                                                                                                                            \
+        for (int v = 0; v < 3; v++) {                                                                                                                \
+          uint32_t vertex = hull.faces[f].vertices[v];                                                                                               \
+          if (hull.next[vertex] == _LM2_CONVEX_HULL3_NONE) {                                                                                         \
+            hull.next[vertex] = (uint32_t)size.vertex_count++;                                                                                       \
+          }                                                                                                                                          \
+        }                                                                                                                                            \
+        size.index_count += 3;                                                                                                                       \
+      }                                                                                                                                              \
+      if (size.vertex_count <= vertex_capacity && size.index_count <= index_capacity) {                                                              \
+        size_t index = 0;                                                                                                                            \
+        for (size_t f = 0; f < hull.face_count; f++) {                                                                                               \
+          if (!hull.faces[f].alive) {                                                                                                                \
+            continue;                                                                                                                                \
+          }                                                                                                                                          \
+          for (int v = 0; v < 3; v++) {                                                                                                              \
+            uint32_t vertex = hull.faces[f].vertices[v];                                                                                             \
+            out_vertices[hull.next[vertex]] = candidates[vertex];                                                                                    \
+            out_indices[index++] = hull.next[vertex];                                                                                                \
+          }                                                                                                                                          \
+        }                                                                                                                                            \
+      }                                                                                                                                              \
+    }                                                                                                                                                \
+    _lm2_convex_hull3_free_##S(&hull);                                                                                                               \
+    lm2_free(merged);                                                                                                                                \
+    return size;                                                                                                                                     \
+  }
+
+// =============================================================================
+// f64 Implementation
+// =============================================================================
+
+_LM2_IMPL_CONVEX_HULL3(double, f64, DBL_EPSILON)
+
+// =============================================================================
+// f32 Implementation
+// =============================================================================
+
+_LM2_IMPL_CONVEX_HULL3(float, f32, FLT_EPSILON)
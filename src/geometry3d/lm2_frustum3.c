@@ -0,0 +1,231 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <lm2/geometry3d/lm2_frustum3.h>
+#include <math.h>
+#include "../vectors/lm2_simd.h"
+
+// =============================================================================
+// Plane lanes
+// =============================================================================
+// The batch kernels test one shape against all six planes at once, so the
+// planes are stored as SoA lanes padded to 8 entries: one AVX vector for f32,
+// two for f64 and SSE f32, and every width loads whole vectors. Padding lanes
+// and the planes left out of the plane mask get a zero normal and a distance
+// of -huge, which every shape is inside of.
+//
+// A box with center c and half extents e is outside a plane when
+// dot(n, c) + dot(|n|, e) < distance. dot(n, c) + dot(|n|, e) is dot(n, p) for
+// the p-vertex, the box corner furthest along n, and dot(n, c) - dot(|n|, e)
+// is dot(n, q) for the n-vertex, so the corner never has to be selected.
+
+#define _LM2_FRUSTUM3_LANES 8
+#define _LM2_FRUSTUM3_HUGE_f64 1e300
+#define _LM2_FRUSTUM3_HUGE_f32 1e30f
+
+#define _LM2_IMPL_FRUSTUM3(scalar_type, S, sqrt_fn, abs_fn)                                                                                                                               \
+  typedef struct _lm2_frustum3_lanes_##S {                                                                                                                                                \
+    scalar_type nx[_LM2_FRUSTUM3_LANES];                                                                                                                                                  \
+    scalar_type ny[_LM2_FRUSTUM3_LANES];                                                                                                                                                  \
+    scalar_type nz[_LM2_FRUSTUM3_LANES];                                                                                                                                                  \
+    scalar_type ax[_LM2_FRUSTUM3_LANES];                                                                                                                                                  \
+    scalar_type ay[_LM2_FRUSTUM3_LANES];                                                                                                                                                  \
+    scalar_type az[_LM2_FRUSTUM3_LANES];                                                                                                                                                  \
+    scalar_type d[_LM2_FRUSTUM3_LANES];                                                                                                                                                   \
+  } _lm2_frustum3_lanes_##S;                                                                                                                                                              \
+                                                                                                                                                                                          \
+  static void _lm2_frustum3_make_lanes_##S(const lm2_frustum3_##S* frustum, uint32_t plane_mask, _lm2_frustum3_lanes_##S* lanes) {                                                        \
+    for (int i = 0; i < _LM2_FRUSTUM3_LANES; i++) {                                                                                                                                       \
+      if (i < LM2_FRUSTUM3_PLANE_COUNT && (plane_mask & (1u << i))) {                                                                                                                     \
+        const lm2_plane3_##S* p = &frustum->planes[i];                                                                                                                                    \
+        lanes->nx[i] = p->normal.x, lanes->ny[i] = p->normal.y, lanes->nz[i] = p->normal.z;                                                                                               \
+        lanes->ax[i] = abs_fn(p->normal.x), lanes->ay[i] = abs_fn(p->normal.y), lanes->az[i] = abs_fn(p->normal.z);                                                                       \
+        lanes->d[i] = p->distance;                                                                                                                                                        \
+      } else {                                                                                                                                                                            \
+        lanes->nx[i] = 0, lanes->ny[i] = 0, lanes->nz[i] = 0;                                                                                                                             \
+        lanes->ax[i] = 0, lanes->ay[i] = 0, lanes->az[i] = 0;                                                                                                                             \
+        lanes->d[i] = -_LM2_FRUSTUM3_HUGE_##S;                                                                                                                                            \
+      }                                                                                                                                                                                   \
+    }                                                                                                                                                                                     \
+  }                                                                                                                                                                                       \
+                                                                                                                                                                                          \
+  /* Bit i set when the box is not outside plane i */                                                                                                                                     \
+  static inline int _lm2_frustum3_keep_box_##S(const _lm2_frustum3_lanes_##S* lanes, const lm2_r3_##S* box) {                                                                             \
+    const _lm2_simd_##S half = _lm2_simd_set1_##S((scalar_type)0.5);                                                                                                                      \
+    const _lm2_simd_##S cx = _lm2_simd_mul_##S(_lm2_simd_set1_##S(box->min.x + box->max.x), half);                                                                                        \
+    const _lm2_simd_##S cy = _lm2_simd_mul_##S(_lm2_simd_set1_##S(box->min.y + box->max.y), half);                                                                                        \
+    const _lm2_simd_##S cz = _lm2_simd_mul_##S(_lm2_simd_set1_##S(box->min.z + box->max.z), half);                                                                                        \
+    const _lm2_simd_##S ex = _lm2_simd_mul_##S(_lm2_simd_set1_##S(box->max.x - box->min.x), half);                                                                                        \
+    const _lm2_simd_##S ey = _lm2_simd_mul_##S(_lm2_simd_set1_##S(box->max.y - box->min.y), half);                                                                                        \
+    const _lm2_simd_##S ez = _lm2_simd_mul_##S(_lm2_simd_set1_##S(box->max.z - box->min.z), half);                                                                                        \
+    int keep = 0;                                                                                                                                                                         \
+    for (int v = 0; v < LM2_FRUSTUM3_PLANE_COUNT; v += _lm2_simd_width_##S) {                                                                                                             \
+      _lm2_simd_##S p = _lm2_simd_mul_##S(_lm2_simd_load_##S(lanes->nx + v), cx);                                                                                                         \
+      p = _lm2_simd_add_##S(p, _lm2_simd_mul_##S(_lm2_simd_load_##S(lanes->ny + v), cy));                                                                                                 \
+      p = _lm2_simd_add_##S(p, _lm2_simd_mul_##S(_lm2_simd_load_##S(lanes->nz + v), cz));                                                                                                 \
+      _lm2_simd_##S r = _lm2_simd_mul_##S(_lm2_simd_load_##S(lanes->ax + v), ex);                                                                                                         \
+      r = _lm2_simd_add_##S(r, _lm2_simd_mul_##S(_lm2_simd_load_##S(lanes->ay + v), ey));                                                                                                 \
+      r = _lm2_simd_add_##S(r, _lm2_simd_mul_##S(_lm2_simd_load_##S(lanes->az + v), ez));                                                                                                 \
+      keep |= _lm2_simd_le_mask_##S(_lm2_simd_load_##S(lanes->d + v), _lm2_simd_add_##S(p, r)) << v;                                                                                      \
+    }                                                                                                                                                                                     \
+    return keep & LM2_FRUSTUM3_ALL_PLANES;                                                                                                                                                \
+  }                                                                                                                                                                                       \
+                                                                                                                                                                                          \
+  /* Bit i set when the sphere is not outside plane i */                                                                                                                                  \
+  static inline int _lm2_frustum3_keep_sphere_##S(const _lm2_frustum3_lanes_##S* lanes, const lm2_sphere_##S* sphere) {                                                                   \
+    const _lm2_simd_##S cx = _lm2_simd_set1_##S(sphere->center.x);                                                                                                                        \
+    const _lm2_simd_##S cy = _lm2_simd_set1_##S(sphere->center.y);                                                                                                                        \
+    const _lm2_simd_##S cz = _lm2_simd_set1_##S(sphere->center.z);                                                                                                                        \
+    const _lm2_simd_##S r = _lm2_simd_set1_##S(sphere->radius);                                                                                                                           \
+    int keep = 0;                                                                                                                                                                         \
+    for (int v = 0; v < LM2_FRUSTUM3_PLANE_COUNT; v += _lm2_simd_width_##S) {                                                                                                             \
+      _lm2_simd_##S p = _lm2_simd_mul_##S(_lm2_simd_load_##S(lanes->nx + v), cx);                                                                                                         \
+      p = _lm2_simd_add_##S(p, _lm2_simd_mul_##S(_lm2_simd_load_##S(lanes->ny + v), cy));                                                                                                 \
+      p = _lm2_simd_add_##S(p, _lm2_simd_mul_##S(_lm2_simd_load_##S(lanes->nz + v), cz));                                                                                                 \
+      keep |= _lm2_simd_le_mask_##S(_lm2_simd_load_##S(lanes->d + v), _lm2_simd_add_##S(p, r)) << v;                                                                                      \
+    }                                                                                                                                                                                     \
+    return keep & LM2_FRUSTUM3_ALL_PLANES;                                                                                                                                                \
+  }                                                                                                                                                                                       \
+                                                                                                                                                                                          \
+  /* Extract a plane from a*x + b*y + c*z + d >= 0 */                                                                                                                                     \
+  static lm2_plane3_##S _lm2_frustum3_plane_##S(scalar_type a, scalar_type b, scalar_type c, scalar_type d) {                                                                             \
+    scalar_type len = sqrt_fn(a * a + b * b + c * c);                                                                                                                                     \
+    scalar_type inv = len > 0 ? 1 / len : 0;                                                                                                                                              \
+    lm2_plane3_##S plane = {{a * inv, b * inv, c * inv}, -d * inv};                                                                                                                       \
+    return plane;                                                                                                                                                                         \
+  }                                                                                                                                                                                       \
+                                                                                                                                                                                          \
+  LM2_API lm2_frustum3_##S lm2_frustum3_from_matrix_##S(lm2_m4x4_##S m) {                                                                                                                 \
+    lm2_frustum3_##S f;                                                                                                                                                                   \
+    f.planes[LM2_FRUSTUM3_LEFT] = _lm2_frustum3_plane_##S(m.m30 + m.m00, m.m31 + m.m01, m.m32 + m.m02, m.m33 + m.m03);                                                                    \
+    f.planes[LM2_FRUSTUM3_RIGHT] = _lm2_frustum3_plane_##S(m.m30 - m.m00, m.m31 - m.m01, m.m32 - m.m02, m.m33 - m.m03);                                                                   \
+    f.planes[LM2_FRUSTUM3_BOTTOM] = _lm2_frustum3_plane_##S(m.m30 + m.m10, m.m31 + m.m11, m.m32 + m.m12, m.m33 + m.m13);                                                                  \
+    f.planes[LM2_FRUSTUM3_TOP] = _lm2_frustum3_plane_##S(m.m30 - m.m10, m.m31 - m.m11, m.m32 - m.m12, m.m33 - m.m13);                                                                     \
+    f.planes[LM2_FRUSTUM3_NEAR] = _lm2_frustum3_plane_##S(m.m30 + m.m20, m.m31 + m.m21, m.m32 + m.m22, m.m33 + m.m23);                                                                    \
+    f.planes[LM2_FRUSTUM3_FAR] = _lm2_frustum3_plane_##S(m.m30 - m.m20, m.m31 - m.m21, m.m32 - m.m22, m.m33 - m.m23);                                                                     \
+    return f;                                                                                                                                                                             \
+  }                                                                                                                                                                                       \
+                                                                                                                                                                                          \
+  LM2_API lm2_frustum3_##S lm2_frustum3_from_camera_##S(lm2_camera3_##S camera) {                                                                                                         \
+    return lm2_frustum3_from_matrix_##S(lm2_camera3_get_view_projection_##S(camera));                                                                                                     \
+  }                                                                                                                                                                                       \
+                                                                                                                                                                                          \
+  LM2_API bool lm2_frustum3_contains_point_##S(const lm2_frustum3_##S* frustum, lm2_v3_##S point) {                                                                                       \
+    for (int i = 0; i < LM2_FRUSTUM3_PLANE_COUNT; i++) {                                                                                                                                  \
+      const lm2_plane3_##S* p = &frustum->planes[i];                                                                                                                                      \
+      if (p->normal.x * point.x + p->normal.y * point.y + p->normal.z * point.z < p->distance) {                                                                                          \
+        return false;                                                                                                                                                                     \
+      }                                                                                                                                                                                   \
+    }                                                                                                                                                                                     \
+    return true;                                                                                                                                                                          \
+  }                                                                                                                                                                                       \
+                                                                                                                                                                                          \
+  /* Scalar classification over the set bits of plane_mask, with the same                                                                                                                 \
+     arithmetic as the batch kernels */                                                                                                                                                   \
+  static lm2_frustum3_result _lm2_frustum3_classify_##S(const lm2_frustum3_##S* frustum, lm2_v3_##S c, lm2_v3_##S e, scalar_type radius, uint32_t plane_mask, uint32_t* out_plane_mask) { \
+    uint32_t crossing = 0;                                                                                                                                                                \
+    for (int i = 0; i < LM2_FRUSTUM3_PLANE_COUNT; i++) {                                                                                                                                  \
+      if (!(plane_mask & (1u << i))) {                                                                                                                                                    \
+        continue;                                                                                                                                                                         \
+      }                                                                                                                                                                                   \
+      const lm2_plane3_##S* p = &frustum->planes[i];                                                                                                                                      \
+      scalar_type dc = p->normal.x * c.x + p->normal.y * c.y + p->normal.z * c.z;                                                                                                         \
+      scalar_type r = abs_fn(p->normal.x) * e.x + abs_fn(p->normal.y) * e.y + abs_fn(p->normal.z) * e.z + radius;                                                                         \
+      if (!(p->distance <= dc + r)) {                                                                                                                                                     \
+        if (out_plane_mask != NULL) {                                                                                                                                                     \
+          *out_plane_mask = 0;                                                                                                                                                            \
+        }                                                                                                                                                                                 \
+        return LM2_FRUSTUM3_OUTSIDE;                                                                                                                                                      \
+      }                                                                                                                                                                                   \
+      if (dc - r < p->distance) {                                                                                                                                                         \
+        crossing |= 1u << i;                                                                                                                                                              \
+      }                                                                                                                                                                                   \
+    }                                                                                                                                                                                     \
+    if (out_plane_mask != NULL) {                                                                                                                                                         \
+      *out_plane_mask = crossing;                                                                                                                                                         \
+    }                                                                                                                                                                                     \
+    return crossing != 0 ? LM2_FRUSTUM3_INTERSECTING : LM2_FRUSTUM3_INSIDE;                                                                                                               \
+  }                                                                                                                                                                                       \
+                                                                                                                                                                                          \
+  LM2_API lm2_frustum3_result lm2_frustum3_classify_aabb_##S(const lm2_frustum3_##S* frustum, lm2_r3_##S box, uint32_t plane_mask, uint32_t* out_plane_mask) {                            \
+    lm2_v3_##S c = {(box.min.x + box.max.x) * (scalar_type)0.5, (box.min.y + box.max.y) * (scalar_type)0.5, (box.min.z + box.max.z) * (scalar_type)0.5};                                  \
+    lm2_v3_##S e = {(box.max.x - box.min.x) * (scalar_type)0.5, (box.max.y - box.min.y) * (scalar_type)0.5, (box.max.z - box.min.z) * (scalar_type)0.5};                                  \
+    return _lm2_frustum3_classify_##S(frustum, c, e, 0, plane_mask, out_plane_mask);                                                                                                      \
+  }                                                                                                                                                                                       \
+                                                                                                                                                                                          \
+  LM2_API lm2_frustum3_result lm2_frustum3_classify_sphere_##S(const lm2_frustum3_##S* frustum, lm2_sphere_##S sphere, uint32_t plane_mask, uint32_t* out_plane_mask) {                   \
+    lm2_v3_##S e = {0, 0, 0};                                                                                                                                                             \
+    return _lm2_frustum3_classify_##S(frustum, sphere.center, e, sphere.radius, plane_mask, out_plane_mask);                                                                              \
+  }
+
+// =============================================================================
+// Batch culling
+// =============================================================================
+// A shape is visible when it is not outside any of the lanes. The bitmask
+// loop builds one output word per 32 shapes; the index loop writes every
+// index and advances the output only past the visible ones, so neither
+// branches on the result.
+
+#define _LM2_IMPL_FRUSTUM3_CULL(S, shape, shape_type, kernel)                                                                                                                      \
+  LM2_API size_t lm2_frustum3_cull_##shape##_##S(const lm2_frustum3_##S* frustum, const shape_type* shapes, size_t count, uint32_t plane_mask, uint32_t* out_visible) {            \
+    LM2_ASSERT(count == 0 || (shapes != NULL && out_visible != NULL));                                                                                                             \
+    _lm2_frustum3_lanes_##S lanes;                                                                                                                                                 \
+    _lm2_frustum3_make_lanes_##S(frustum, plane_mask, &lanes);                                                                                                                     \
+    size_t visible = 0;                                                                                                                                                            \
+    for (size_t base = 0; base < count; base += 32) {                                                                                                                              \
+      const size_t end = count - base < 32 ? count - base : 32;                                                                                                                    \
+      uint32_t word = 0;                                                                                                                                                           \
+      for (size_t k = 0; k < end; k++) {                                                                                                                                           \
+        uint32_t bit = kernel(&lanes, &shapes[base + k]) == LM2_FRUSTUM3_ALL_PLANES;                                                                                               \
+        word |= bit << k;                                                                                                                                                          \
+        visible += bit;                                                                                                                                                            \
+      }                                                                                                                                                                            \
+      out_visible[base / 32] = word;                                                                                                                                               \
+    }                                                                                                                                                                              \
+    return visible;                                                                                                                                                                \
+  }                                                                                                                                                                                \
+                                                                                                                                                                                   \
+  LM2_API size_t lm2_frustum3_cull_##shape##_to_indices_##S(const lm2_frustum3_##S* frustum, const shape_type* shapes, size_t count, uint32_t plane_mask, uint32_t* out_indices) { \
+    LM2_ASSERT(count <= UINT32_MAX);                                                                                                                                               \
+    LM2_ASSERT(count == 0 || (shapes != NULL && out_indices != NULL));                                                                                                             \
+    _lm2_frustum3_lanes_##S lanes;                                                                                                                                                 \
+    _lm2_frustum3_make_lanes_##S(frustum, plane_mask, &lanes);                                                                                                                     \
+    size_t visible = 0;                                                                                                                                                            \
+    for (size_t i = 0; i < count; i++) {                                                                                                                                           \
+      out_indices[visible] = (uint32_t)i;                                                                                                                                          \
+      visible += kernel(&lanes, &shapes[i]) == LM2_FRUSTUM3_ALL_PLANES;                                                                                                            \
+    }                                                                                                                                                                              \
+    return visible;                                                                                                                                                                \
+  }
+
+// =============================================================================
+// Instantiations
+// =============================================================================
+
+_LM2_IMPL_FRUSTUM3(double, f64, sqrt, fabs)
+_LM2_IMPL_FRUSTUM3(float, f32, sqrtf, fabsf)
+_LM2_IMPL_FRUSTUM3_CULL(f64, aabbs, lm2_r3_f64, _lm2_frustum3_keep_box_f64)
+_LM2_IMPL_FRUSTUM3_CULL(f32, aabbs, lm2_r3_f32, _lm2_frustum3_keep_box_f32)
+_LM2_IMPL_FRUSTUM3_CULL(f64, spheres, lm2_sphere_f64, _lm2_frustum3_keep_sphere_f64)
+_LM2_IMPL_FRUSTUM3_CULL(f32, spheres, lm2_sphere_f32, _lm2_frustum3_keep_sphere_f32)
@@ -0,0 +1,1013 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <lm2/geometry3d/lm2_manifold3.h>
+#include <lm2/scalar/lm2_scalar.h>
+#include <lm2/vectors/lm2_vector3.h>
+#include <lm2/vectors/lm2_vector_specifics.h>
+#include <float.h>
+#include <math.h>
+
+// =============================================================================
+// Closest Point Helpers
+// =============================================================================
+// Closest points on triangles and between segments, from Ericson's Real-Time
+// Collision Detection. The triangle query also reports the barycentric
+// coordinates of the result, which GJK uses to shrink its simplex.
+
+#define _LM2_IMPL_MANIFOLD3_HELPERS(scalar_type, S)                                                                                                  \
+  static lm2_v3_##S _lm2_m3_closest_on_triangle_##S(lm2_v3_##S p, lm2_v3_##S a, lm2_v3_##S b, lm2_v3_##S c, scalar_type bary[3]) {                   \
+    lm2_v3_##S ab = lm2_v3_sub_##S(b, a);                                                                                                            \
+    lm2_v3_##S ac = lm2_v3_sub_##S(c, a);                                                                                                            \
+    lm2_v3_##S ap = lm2_v3_sub_##S(p, a);                                                                                                            \
+    scalar_type d1 = lm2_v3_dot_##S(ab, ap);                                                                                                         \
+    scalar_type d2 = lm2_v3_dot_##S(ac, ap);                                                                                                         \
+    if (d1 <= 0 && d2 <= 0) {                                                                                                                        \
+      bary[0] = 1, bary[1] = 0, bary[2] = 0;                                                                                                         \
+      return a;                                                                                                                                      \
+    }                                                                                                                                                \
+    lm2_v3_##S bp = lm2_v3_sub_##S(p, b);                                                                                                            \
+    scalar_type d3 = lm2_v3_dot_##S(ab, bp);                                                                                                         \
+    scalar_type d4 = lm2_v3_dot_##S(ac, bp);                                                                                                         \
+    if (d3 >= 0 && d4 <= d3) {                                                                                                                       \
+      bary[0] = 0, bary[1] = 1, bary[2] = 0;                                                                                                         \
+      return b;                                                                                                                                      \
+    }                                                                                                                                                \
+    scalar_type vc = d1 * d4 - d3 * d2;                                                                                                              \
+    if (vc <= 0 && d1 >= 0 && d3 <= 0) {                                                                                                             \
+      scalar_type v = d1 / (d1 - d3);                                                                                                                \
+      bary[0] = 1 - v, bary[1] = v, bary[2] = 0;                                                                                                     \
+      return lm2_v3_add_##S(a, lm2_v3_mul_s_##S(ab, v));                                                                                             \
+    }                                                                                                                                                \
+    lm2_v3_##S cp = lm2_v3_sub_##S(p, c);                                                                                                            \
+    scalar_type d5 = lm2_v3_dot_##S(ab, cp);                                                                                                         \
+    scalar_type d6 = lm2_v3_dot_##S(ac, cp);                                                                                                         \
+    if (d6 >= 0 && d5 <= d6) {                                                                                                                       \
+      bary[0] = 0, bary[1] = 0, bary[2] = 1;                                                                                                         \
+      return c;                                                                                                                                      \
+    }                                                                                                                                                \
+    scalar_type vb = d5 * d2 - d1 * d6;                                                                                                              \
+    if (vb <= 0 && d2 >= 0 && d6 <= 0) {                                                                                                             \
+      scalar_type w = d2 / (d2 - d6);                                                                                                                \
+      bary[0] = 1 - w, bary[1] = 0, bary[2] = w;                                                                                                     \
+      return lm2_v3_add_##S(a, lm2_v3_mul_s_##S(ac, w));                                                                                             \
+    }                                                                                                                                                \
+    scalar_type va = d3 * d6 - d5 * d4;                                                                                                              \
+    if (va <= 0 && (d4 - d3) >= 0 && (d5 - d6) >= 0) {                                                                                               \
+      scalar_type w = (d4 - d3) / ((d4 - d3) + (d5 - d6));                                                                                           \
+      bary[0] = 0, bary[1] = 1 - w, bary[2] = w;                                                                                                     \
+      return lm2_v3_add_##S(b, lm2_v3_mul_s_##S(lm2_v3_sub_##S(c, b), w));                                                                           \
+    }                                                                                                                                                \
+    scalar_type sum = va + vb + vc;                                                                                                                  \
+    if (!(sum > 0)) {                                                                                                                                \
+      /* Degenerate triangle: every region test failed, fall back to vertex a */                                                                     \
+      bary[0] = 1, bary[1] = 0, bary[2] = 0;                                                                                                         \
+      return a;                                                                                                                                      \
+    }                                                                                                                                                \
+    scalar_type v = vb / sum;                                                                                                                        \
+    scalar_type w = vc / sum;                                                                                                                        \
+    bary[0] = 1 - v - w, bary[1] = v, bary[2] = w;                                                                                                   \
+    return lm2_v3_add_##S(a, lm2_v3_add_##S(lm2_v3_mul_s_##S(ab, v), lm2_v3_mul_s_##S(ac, w)));                                                      \
+  }                                                                                                                                                  \
+                                                                                                                                                     \
+  static inline lm2_v3_##S _lm2_m3_lerp_##S(lm2_v3_##S a, lm2_v3_##S b, scalar_type t) {                                                             \
+    return lm2_v3_add_##S(a, lm2_v3_mul_s_##S(lm2_v3_sub_##S(b, a), t));                                                                             \
+  }                                                                                                                                                  \
+                                                                                                                                                     \
+  static scalar_type _lm2_m3_project_segment_##S(lm2_v3_##S p, lm2_v3_##S a, lm2_v3_##S b) {                                                         \
+    lm2_v3_##S d = lm2_v3_sub_##S(b, a);                                                                                                             \
+    scalar_type dd = lm2_v3_dot_##S(d, d);                                                                                                           \
+    if (!(dd > 0)) {                                                                                                                                 \
+      return 0;                                                                                                                                      \
+    }                                                                                                                                                \
+    return lm2_clamp_##S(0, lm2_v3_dot_##S(lm2_v3_sub_##S(p, a), d) / dd, 1);                                                                        \
+  }                                                                                                                                                  \
+                                                                                                                                                     \
+  /* Closest points between segments p1q1 and p2q2, returns the squared distance */                                                                  \
+  static scalar_type _lm2_m3_segment_closest_##S(lm2_v3_##S p1, lm2_v3_##S q1, lm2_v3_##S p2, lm2_v3_##S q2, lm2_v3_##S* c1, lm2_v3_##S* c2) {       \
+    lm2_v3_##S d1 = lm2_v3_sub_##S(q1, p1);                                                                                                          \
+    lm2_v3_##S d2 = lm2_v3_sub_##S(q2, p2);                                                                                                          \
+    lm2_v3_##S r = lm2_v3_sub_##S(p1, p2);                                                                                                           \
+    scalar_type a = lm2_v3_dot_##S(d1, d1);                                                                                                          \
+    scalar_type e = lm2_v3_dot_##S(d2, d2);                                                                                                          \
+    scalar_type f = lm2_v3_dot_##S(d2, r);                                                                                                           \
+    scalar_type s = 0;                                                                                                                               \
+    scalar_type t = 0;                                                                                                                               \
+    if (!(a > 0) && !(e > 0)) {                                                                                                                      \
+      s = 0, t = 0;                                                                                                                                  \
+    } else if (!(a > 0)) {                                                                                                                           \
+      t = lm2_clamp_##S(0, f / e, 1);                                                                                                                \
+    } else {                                                                                                                                         \
+      scalar_type c = lm2_v3_dot_##S(d1, r);                                                                                                         \
+      if (!(e > 0)) {                                                                                                                                \
+        s = lm2_clamp_##S(0, -c / a, 1);                                                                                                             \
+      } else {                                                                                                                                       \
+        scalar_type b = lm2_v3_dot_##S(d1, d2);                                                                                                      \
+        scalar_type denom = a * e - b * b;                                                                                                           \
+        s = denom > 0 ? lm2_clamp_##S(0, (b * f - c * e) / denom, 1) : 0;                                                                            \
+        t = (b * s + f) / e;                                                                                                                         \
+        if (t < 0) {                                                                                                                                 \
+          t = 0;                                                                                                                                     \
+          s = lm2_clamp_##S(0, -c / a, 1);                                                                                                           \
+        } else if (t > 1) {                                                                                                                          \
+          t = 1;                                                                                                                                     \
+          s = lm2_clamp_##S(0, (b - c) / a, 1);                                                                                                      \
+        }                                                                                                                                            \
+      }                                                                                                                                              \
+    }                                                                                                                                                \
+    *c1 = lm2_v3_add_##S(p1, lm2_v3_mul_s_##S(d1, s));                                                                                               \
+    *c2 = lm2_v3_add_##S(p2, lm2_v3_mul_s_##S(d2, t));                                                                                               \
+    return lm2_v3_distance_sq_##S(*c1, *c2);                                                                                                         \
+  }                                                                                                                                                  \
+                                                                                                                                                     \
+  /* Unit vector perpendicular to d */                                                                                                               \
+  static lm2_v3_##S _lm2_m3_perpendicular_##S(lm2_v3_##S d) {                                                                                        \
+    scalar_type ax = d.x < 0 ? -d.x : d.x;                                                                                                           \
+    scalar_type ay = d.y < 0 ? -d.y : d.y;                                                                                                           \
+    scalar_type az = d.z < 0 ? -d.z : d.z;                                                                                                           \
+    lm2_v3_##S axis = lm2_v3_make_##S(0, 0, 1);                                                                                                      \
+    if (ax <= ay && ax <= az) {                                                                                                                      \
+      axis = lm2_v3_make_##S(1, 0, 0);                                                                                                               \
+    } else if (ay <= az) {                                                                                                                           \
+      axis = lm2_v3_make_##S(0, 1, 0);                                                                                                               \
+    }                                                                                                                                                \
+    lm2_v3_##S p = lm2_v3_cross_##S(d, axis);                                                                                                        \
+    scalar_type len_sq = lm2_v3_dot_##S(p, p);                                                                                                       \
+    return len_sq > 0 ? lm2_v3_mul_s_##S(p, 1 / (scalar_type)sqrt(len_sq)) : lm2_v3_make_##S(0, 1, 0);                                               \
+  }                                                                                                                                                  \
+                                                                                                                                                     \
+  /* One contact between a point on A's core and a point on B's core, both cores rounded */                                                          \
+  static void _lm2_m3_point_contact_##S(lm2_v3_##S pa, scalar_type ra, lm2_v3_##S pb, scalar_type rb, lm2_v3_##S fallback, lm2_manifold3_##S* out) { \
+    lm2_v3_##S d = lm2_v3_sub_##S(pb, pa);                                                                                                           \
+    scalar_type dist_sq = lm2_v3_dot_##S(d, d);                                                                                                      \
+    scalar_type r = ra + rb;                                                                                                                         \
+    out->count = 0;                                                                                                                                  \
+    if (dist_sq > r * r) {                                                                                                                           \
+      return;                                                                                                                                        \
+    }                                                                                                                                                \
+    scalar_type dist = (scalar_type)sqrt(dist_sq);                                                                                                   \
+    lm2_v3_##S n = dist > 0 ? lm2_v3_mul_s_##S(d, 1 / dist) : fallback;                                                                              \
+    out->count = 1;                                                                                                                                  \
+    out->normal = n;                                                                                                                                 \
+    out->depths[0] = r - dist;                                                                                                                       \
+    out->contact_points[0] = lm2_v3_sub_##S(pb, lm2_v3_mul_s_##S(n, rb));                                                                            \
+  }                                                                                                                                                  \
+                                                                                                                                                     \
+  /* Swap the roles of A and B in a manifold computed for (B, A) */                                                                                  \
+  static void _lm2_m3_flip_##S(lm2_manifold3_##S* m) {                                                                                               \
+    for (int i = 0; i < m->count; i++) {                                                                                                             \
+      m->contact_points[i] = lm2_v3_add_##S(m->contact_points[i], lm2_v3_mul_s_##S(m->normal, m->depths[i]));                                        \
+    }                                                                                                                                                \
+    m->normal = lm2_v3_neg_##S(m->normal);                                                                                                           \
+  }
+
+// =============================================================================
+// GJK / EPA
+// =============================================================================
+// The Minkowski difference is D = B - A, so the closest point of D to the
+// origin is the vector from A to B. Simplex vertices keep the proxy indices
+// they came from: those indices are the warm-start cache, and a repeated
+// support pair ends the iteration.
+//
+// EPA starts from the GJK tetrahedron. When the difference is flat (a point
+// inside a triangle, two crossing segments) no tetrahedron exists. The core
+// depth is then 0 along the flat normal and the radii supply the depth.
+
+#define _LM2_EPA3_MAX_VERTICES 64
+#define _LM2_EPA3_MAX_FACES 128
+#define _LM2_EPA3_MAX_EDGES 192
+#define _LM2_GJK3_MAX_ITERATIONS 32
+
+#define _LM2_IMPL_MANIFOLD3_GJK(scalar_type, S, huge, eps)                                                                             \
+  typedef struct _lm2_gjk3_vertex_##S {                                                                                                \
+    lm2_v3_##S wa, wb, w;                                                                                                              \
+    scalar_type bary;                                                                                                                  \
+    int ia, ib;                                                                                                                        \
+  } _lm2_gjk3_vertex_##S;                                                                                                              \
+                                                                                                                                       \
+  typedef struct _lm2_gjk3_simplex_##S {                                                                                               \
+    _lm2_gjk3_vertex_##S v[4];                                                                                                         \
+    int count;                                                                                                                         \
+  } _lm2_gjk3_simplex_##S;                                                                                                             \
+                                                                                                                                       \
+  static int _lm2_gjk3_support_##S(const lm2_gjk3_proxy_##S* p, lm2_v3_##S d) {                                                        \
+    int best = 0;                                                                                                                      \
+    scalar_type best_dot = lm2_v3_dot_##S(p->vertices[0], d);                                                                          \
+    for (int i = 1; i < p->count; i++) {                                                                                               \
+      scalar_type dot = lm2_v3_dot_##S(p->vertices[i], d);                                                                             \
+      if (dot > best_dot) {                                                                                                            \
+        best = i;                                                                                                                      \
+        best_dot = dot;                                                                                                                \
+      }                                                                                                                                \
+    }                                                                                                                                  \
+    return best;                                                                                                                       \
+  }                                                                                                                                    \
+                                                                                                                                       \
+  static _lm2_gjk3_vertex_##S _lm2_gjk3_make_vertex_##S(const lm2_gjk3_proxy_##S* a, const lm2_gjk3_proxy_##S* b, int ia, int ib) {    \
+    _lm2_gjk3_vertex_##S v;                                                                                                            \
+    v.ia = ia;                                                                                                                         \
+    v.ib = ib;                                                                                                                         \
+    v.wa = a->vertices[ia];                                                                                                            \
+    v.wb = b->vertices[ib];                                                                                                            \
+    v.w = lm2_v3_sub_##S(v.wb, v.wa);                                                                                                  \
+    v.bary = 1;                                                                                                                        \
+    return v;                                                                                                                          \
+  }                                                                                                                                    \
+                                                                                                                                       \
+  /* Support of D along d */                                                                                                           \
+  static _lm2_gjk3_vertex_##S _lm2_gjk3_support_vertex_##S(const lm2_gjk3_proxy_##S* a, const lm2_gjk3_proxy_##S* b, lm2_v3_##S d) {   \
+    return _lm2_gjk3_make_vertex_##S(a, b, _lm2_gjk3_support_##S(a, lm2_v3_neg_##S(d)), _lm2_gjk3_support_##S(b, d));                  \
+  }                                                                                                                                    \
+                                                                                                                                       \
+  static void _lm2_gjk3_solve2_##S(_lm2_gjk3_simplex_##S* s) {                                                                         \
+    lm2_v3_##S a = s->v[0].w;                                                                                                          \
+    lm2_v3_##S e = lm2_v3_sub_##S(s->v[1].w, a);                                                                                       \
+    scalar_type ee = lm2_v3_dot_##S(e, e);                                                                                             \
+    scalar_type t = ee > 0 ? -lm2_v3_dot_##S(a, e) / ee : 0;                                                                           \
+    if (t <= 0) {                                                                                                                      \
+      s->v[0].bary = 1;                                                                                                                \
+      s->count = 1;                                                                                                                    \
+    } else if (t >= 1) {                                                                                                               \
+      s->v[0] = s->v[1];                                                                                                               \
+      s->v[0].bary = 1;                                                                                                                \
+      s->count = 1;                                                                                                                    \
+    } else {                                                                                                                           \
+      s->v[0].bary = 1 - t;                                                                                                            \
+      s->v[1].bary = t;                                                                                                                \
+    }                                                                                                                                  \
+  }                                                                                                                                    \
+                                                                                                                                       \
+  /* Keep the vertices of a triangle with a non-zero barycentric coordinate */                                                         \
+  static void _lm2_gjk3_compact_##S(_lm2_gjk3_simplex_##S* s, const scalar_type* bary) {                                               \
+    int count = 0;                                                                                                                     \
+    for (int i = 0; i < s->count; i++) {                                                                                               \
+      if (bary[i] > 0) {                                                                                                               \
+        s->v[count] = s->v[i];                                                                                                         \
+        s->v[count].bary = bary[i];                                                                                                    \
+        count++;                                                                                                                       \
+      }                                                                                                                                \
+    }                                                                                                                                  \
+    s->count = count;                                                                                                                  \
+  }                                                                                                                                    \
+                                                                                                                                       \
+  static void _lm2_gjk3_solve3_##S(_lm2_gjk3_simplex_##S* s) {                                                                         \
+    scalar_type bary[3];                                                                                                               \
+    _lm2_m3_closest_on_triangle_##S(lm2_v3_zero_##S(), s->v[0].w, s->v[1].w, s->v[2].w, bary);                                         \
+    _lm2_gjk3_compact_##S(s, bary);                                                                                                    \
+  }                                                                                                                                    \
+                                                                                                                                       \
+  /* Returns true when the origin is inside the tetrahedron */                                                                         \
+  static bool _lm2_gjk3_solve4_##S(_lm2_gjk3_simplex_##S* s) {                                                                         \
+    static const int faces[4][4] = {{0, 1, 2, 3}, {0, 3, 1, 2}, {0, 2, 3, 1}, {1, 3, 2, 0}};                                           \
+    lm2_v3_##S v0 = s->v[0].w;                                                                                                         \
+    scalar_type volume = lm2_v3_dot_##S(lm2_v3_sub_##S(s->v[3].w, v0),                                                                 \
+                                        lm2_v3_cross_##S(lm2_v3_sub_##S(s->v[1].w, v0), lm2_v3_sub_##S(s->v[2].w, v0)));               \
+    scalar_type scale = 0;                                                                                                             \
+    for (int i = 1; i < 4; i++) {                                                                                                      \
+      scale = lm2_max_##S(scale, lm2_v3_length_sq_##S(lm2_v3_sub_##S(s->v[i].w, v0)));                                                 \
+    }                                                                                                                                  \
+    bool flat = !((volume < 0 ? -volume : volume) > eps * scale * (scalar_type)sqrt(scale));                                           \
+    _lm2_gjk3_simplex_##S best;                                                                                                        \
+    best.count = 0;                                                                                                                    \
+    scalar_type best_dist_sq = huge;                                                                                                   \
+    bool outside_any = false;                                                                                                          \
+    for (int f = 0; f < 4; f++) {                                                                                                      \
+      const _lm2_gjk3_vertex_##S* a = &s->v[faces[f][0]];                                                                              \
+      const _lm2_gjk3_vertex_##S* b = &s->v[faces[f][1]];                                                                              \
+      const _lm2_gjk3_vertex_##S* c = &s->v[faces[f][2]];                                                                              \
+      const _lm2_gjk3_vertex_##S* d = &s->v[faces[f][3]];                                                                              \
+      lm2_v3_##S n = lm2_v3_cross_##S(lm2_v3_sub_##S(b->w, a->w), lm2_v3_sub_##S(c->w, a->w));                                         \
+      scalar_type side_origin = -lm2_v3_dot_##S(n, a->w);                                                                              \
+      scalar_type side_d = lm2_v3_dot_##S(n, lm2_v3_sub_##S(d->w, a->w));                                                              \
+      if (!flat && side_origin * side_d >= 0) {                                                                                        \
+        continue;                                                                                                                      \
+      }                                                                                                                                \
+      outside_any = true;                                                                                                              \
+      _lm2_gjk3_simplex_##S face;                                                                                                      \
+      face.v[0] = *a, face.v[1] = *b, face.v[2] = *c;                                                                                  \
+      face.count = 3;                                                                                                                  \
+      _lm2_gjk3_solve3_##S(&face);                                                                                                     \
+      lm2_v3_##S p = lm2_v3_zero_##S();                                                                                                \
+      for (int i = 0; i < face.count; i++) {                                                                                           \
+        p = lm2_v3_add_##S(p, lm2_v3_mul_s_##S(face.v[i].w, face.v[i].bary));                                                          \
+      }                                                                                                                                \
+      scalar_type dist_sq = lm2_v3_dot_##S(p, p);                                                                                      \
+      if (dist_sq < best_dist_sq) {                                                                                                    \
+        best_dist_sq = dist_sq;                                                                                                        \
+        best = face;                                                                                                                   \
+      }                                                                                                                                \
+    }                                                                                                                                  \
+    if (!outside_any) {                                                                                                                \
+      return true;                                                                                                                     \
+    }                                                                                                                                  \
+    *s = best;                                                                                                                         \
+    return false;                                                                                                                      \
+  }                                                                                                                                    \
+                                                                                                                                       \
+  static void _lm2_gjk3_witness_##S(const _lm2_gjk3_simplex_##S* s, lm2_v3_##S* pa, lm2_v3_##S* pb) {                                  \
+    *pa = lm2_v3_zero_##S();                                                                                                           \
+    *pb = lm2_v3_zero_##S();                                                                                                           \
+    for (int i = 0; i < s->count; i++) {                                                                                               \
+      *pa = lm2_v3_add_##S(*pa, lm2_v3_mul_s_##S(s->v[i].wa, s->v[i].bary));                                                           \
+      *pb = lm2_v3_add_##S(*pb, lm2_v3_mul_s_##S(s->v[i].wb, s->v[i].bary));                                                           \
+    }                                                                                                                                  \
+  }                                                                                                                                    \
+                                                                                                                                       \
+  /* Runs GJK on the cores. Returns true when they overlap; otherwise v is the vector from A to B */                                   \
+  static bool _lm2_gjk3_run_##S(const lm2_gjk3_proxy_##S* a, const lm2_gjk3_proxy_##S* b, lm2_gjk3_cache* cache,                       \
+                                _lm2_gjk3_simplex_##S* s, lm2_v3_##S* out_v, int* out_iterations) {                                    \
+    s->count = 0;                                                                                                                      \
+    if (cache != NULL && cache->count > 0 && cache->count <= 4) {                                                                      \
+      for (int i = 0; i < cache->count; i++) {                                                                                         \
+        if (cache->index_a[i] >= a->count || cache->index_b[i] >= b->count) {                                                          \
+          s->count = 0;                                                                                                                \
+          break;                                                                                                                       \
+        }                                                                                                                              \
+        s->v[s->count++] = _lm2_gjk3_make_vertex_##S(a, b, cache->index_a[i], cache->index_b[i]);                                      \
+      }                                                                                                                                \
+    }                                                                                                                                  \
+    if (s->count == 0) {                                                                                                               \
+      s->v[0] = _lm2_gjk3_make_vertex_##S(a, b, 0, 0);                                                                                 \
+      s->count = 1;                                                                                                                    \
+    }                                                                                                                                  \
+    bool overlap = false;                                                                                                              \
+    int iterations = 0;                                                                                                                \
+    lm2_v3_##S v = s->v[0].w;                                                                                                          \
+    while (iterations < _LM2_GJK3_MAX_ITERATIONS) {                                                                                    \
+      int saved_a[4], saved_b[4];                                                                                                      \
+      int saved_count = s->count;                                                                                                      \
+      for (int i = 0; i < s->count; i++) {                                                                                             \
+        saved_a[i] = s->v[i].ia;                                                                                                       \
+        saved_b[i] = s->v[i].ib;                                                                                                       \
+      }                                                                                                                                \
+      switch (s->count) {                                                                                                              \
+        case 1:                                                                                                                        \
+          s->v[0].bary = 1;                                                                                                            \
+          break;                                                                                                                       \
+        case 2:                                                                                                                        \
+          _lm2_gjk3_solve2_##S(s);                                                                                                     \
+          break;                                                                                                                       \
+        case 3:                                                                                                                        \
+          _lm2_gjk3_solve3_##S(s);                                                                                                     \
+          break;                                                                                                                       \
+        default:                                                                                                                       \
+          overlap = _lm2_gjk3_solve4_##S(s);                                                                                           \
+          break;                                                                                                                       \
+      }                                                                                                                                \
+      if (overlap) {                                                                                                                   \
+        break;                                                                                                                         \
+      }                                                                                                                                \
+      v = lm2_v3_zero_##S();                                                                                                           \
+      scalar_type scale = 0;                                                                                                           \
+      for (int i = 0; i < s->count; i++) {                                                                                             \
+        v = lm2_v3_add_##S(v, lm2_v3_mul_s_##S(s->v[i].w, s->v[i].bary));                                                              \
+        scale = lm2_max_##S(scale, lm2_v3_length_sq_##S(s->v[i].w));                                                                   \
+      }                                                                                                                                \
+      scalar_type vv = lm2_v3_dot_##S(v, v);                                                                                           \
+      if (vv <= eps * eps * scale) {                                                                                                   \
+        overlap = true;                                                                                                                \
+        break;                                                                                                                         \
+      }                                                                                                                                \
+      _lm2_gjk3_vertex_##S w = _lm2_gjk3_support_vertex_##S(a, b, lm2_v3_neg_##S(v));                                                  \
+      iterations++;                                                                                                                    \
+      bool duplicate = false;                                                                                                          \
+      for (int i = 0; i < saved_count; i++) {                                                                                          \
+        if (saved_a[i] == w.ia && saved_b[i] == w.ib) {                                                                                \
+          duplicate = true;                                                                                                            \
+          break;                                                                                                                       \
+        }                                                                                                                              \
+      }                                                                                                                                \
+      if (duplicate || vv - lm2_v3_dot_##S(v, w.w) <= eps * vv) {                                                                      \
+        break;                                                                                                                         \
+      }                                                                                                                                \
+      s->v[s->count++] = w;                                                                                                            \
+    }                                                                                                                                  \
+    if (cache != NULL) {                                                                                                               \
+      cache->count = (uint8_t)s->count;                                                                                                \
+      for (int i = 0; i < s->count; i++) {                                                                                             \
+        cache->index_a[i] = (uint8_t)s->v[i].ia;                                                                                       \
+        cache->index_b[i] = (uint8_t)s->v[i].ib;                                                                                       \
+      }                                                                                                                                \
+    }                                                                                                                                  \
+    *out_v = v;                                                                                                                        \
+    *out_iterations = iterations;                                                                                                      \
+    return overlap;                                                                                                                    \
+  }                                                                                                                                    \
+                                                                                                                                       \
+  static lm2_v3_##S _lm2_gjk3_centroid_##S(const lm2_gjk3_proxy_##S* p) {                                                              \
+    lm2_v3_##S c = lm2_v3_zero_##S();                                                                                                  \
+    for (int i = 0; i < p->count; i++) {                                                                                               \
+      c = lm2_v3_add_##S(c, p->vertices[i]);                                                                                           \
+    }                                                                                                                                  \
+    return lm2_v3_mul_s_##S(c, 1 / (scalar_type)p->count);                                                                             \
+  }                                                                                                                                    \
+                                                                                                                                       \
+  typedef struct _lm2_epa3_face_##S {                                                                                                  \
+    int v[3];                                                                                                                          \
+    lm2_v3_##S n;                                                                                                                      \
+    scalar_type dist;                                                                                                                  \
+  } _lm2_epa3_face_##S;                                                                                                                \
+                                                                                                                                       \
+  static bool _lm2_epa3_make_face_##S(const _lm2_gjk3_vertex_##S* verts, int i0, int i1, int i2, _lm2_epa3_face_##S* f) {              \
+    f->v[0] = i0, f->v[1] = i1, f->v[2] = i2;                                                                                          \
+    lm2_v3_##S n = lm2_v3_cross_##S(lm2_v3_sub_##S(verts[i1].w, verts[i0].w), lm2_v3_sub_##S(verts[i2].w, verts[i0].w));               \
+    scalar_type len_sq = lm2_v3_dot_##S(n, n);                                                                                         \
+    if (!(len_sq > 0)) {                                                                                                               \
+      f->n = lm2_v3_zero_##S();                                                                                                        \
+      f->dist = huge;                                                                                                                  \
+      return false;                                                                                                                    \
+    }                                                                                                                                  \
+    f->n = lm2_v3_mul_s_##S(n, 1 / (scalar_type)sqrt(len_sq));                                                                         \
+    f->dist = lm2_v3_dot_##S(f->n, verts[i0].w);                                                                                       \
+    return true;                                                                                                                       \
+  }                                                                                                                                    \
+                                                                                                                                       \
+  /* Grow the GJK simplex to a tetrahedron. Returns false with *flat_normal set when D is flat. */                                     \
+  static bool _lm2_epa3_blow_up_##S(const lm2_gjk3_proxy_##S* a, const lm2_gjk3_proxy_##S* b, _lm2_gjk3_simplex_##S* s,                \
+                                    scalar_type tol, lm2_v3_##S* flat_normal) {                                                        \
+    static const scalar_type axes[6][3] = {{1, 0, 0}, {-1, 0, 0}, {0, 1, 0}, {0, -1, 0}, {0, 0, 1}, {0, 0, -1}};                       \
+    *flat_normal = lm2_v3_zero_##S();                                                                                                  \
+    if (s->count == 1) {                                                                                                               \
+      for (int i = 0; i < 6 && s->count == 1; i++) {                                                                                   \
+        lm2_v3_##S d = lm2_v3_make_##S(axes[i][0], axes[i][1], axes[i][2]);                                                            \
+        _lm2_gjk3_vertex_##S w = _lm2_gjk3_support_vertex_##S(a, b, d);                                                                \
+        if (lm2_v3_distance_sq_##S(w.w, s->v[0].w) > tol * tol) {                                                                      \
+          s->v[s->count++] = w;                                                                                                        \
+        }                                                                                                                              \
+      }                                                                                                                                \
+      if (s->count == 1) {                                                                                                             \
+        return false;                                                                                                                  \
+      }                                                                                                                                \
+    }                                                                                                                                  \
+    if (s->count == 2) {                                                                                                               \
+      lm2_v3_##S d = lm2_v3_sub_##S(s->v[1].w, s->v[0].w);                                                                             \
+      lm2_v3_##S p1 = _lm2_m3_perpendicular_##S(d);                                                                                    \
+      lm2_v3_##S p2 = lm2_v3_norm_##S(lm2_v3_cross_##S(d, p1));                                                                        \
+      lm2_v3_##S dirs[4] = {p1, lm2_v3_neg_##S(p1), p2, lm2_v3_neg_##S(p2)};                                                           \
+      *flat_normal = p1;                                                                                                               \
+      for (int i = 0; i < 4 && s->count == 2; i++) {                                                                                   \
+        _lm2_gjk3_vertex_##S w = _lm2_gjk3_support_vertex_##S(a, b, dirs[i]);                                                          \
+        lm2_v3_##S c = lm2_v3_cross_##S(d, lm2_v3_sub_##S(w.w, s->v[0].w));                                                            \
+        if (lm2_v3_length_sq_##S(c) > tol * tol * lm2_v3_length_sq_##S(d)) {                                                           \
+          s->v[s->count++] = w;                                                                                                        \
+        }                                                                                                                              \
+      }                                                                                                                                \
+      if (s->count == 2) {                                                                                                             \
+        return false;                                                                                                                  \
+      }                                                                                                                                \
+    }                                                                                                                                  \
+    if (s->count == 3) {                                                                                                               \
+      lm2_v3_##S n = lm2_v3_cross_##S(lm2_v3_sub_##S(s->v[1].w, s->v[0].w), lm2_v3_sub_##S(s->v[2].w, s->v[0].w));                     \
+      scalar_type n_len = lm2_v3_length_##S(n);                                                                                        \
+      if (!(n_len > 0)) {                                                                                                              \
+        return false;                                                                                                                  \
+      }                                                                                                                                \
+      n = lm2_v3_mul_s_##S(n, 1 / n_len);                                                                                              \
+      *flat_normal = n;                                                                                                                \
+      for (int i = 0; i < 2 && s->count == 3; i++) {                                                                                   \
+        lm2_v3_##S d = i == 0 ? n : lm2_v3_neg_##S(n);                                                                                 \
+        _lm2_gjk3_vertex_##S w = _lm2_gjk3_support_vertex_##S(a, b, d);                                                                \
+        scalar_type h = lm2_v3_dot_##S(n, lm2_v3_sub_##S(w.w, s->v[0].w));                                                             \
+        if ((h < 0 ? -h : h) > tol) {                                                                                                  \
+          s->v[s->count++] = w;                                                                                                        \
+        }                                                                                                                              \
+      }                                                                                                                                \
+      if (s->count == 3) {                                                                                                             \
+        return false;                                                                                                                  \
+      }                                                                                                                                \
+    }                                                                                                                                  \
+    return true;                                                                                                                       \
+  }                                                                                                                                    \
+                                                                                                                                       \
+  /* Penetration of the overlapping cores: normal from A to B, core depth and the witness point on B's core */                         \
+  static void _lm2_epa3_run_##S(const lm2_gjk3_proxy_##S* a, const lm2_gjk3_proxy_##S* b, _lm2_gjk3_simplex_##S* s,                    \
+                                lm2_v3_##S* out_normal, scalar_type* out_depth, lm2_v3_##S* out_pb) {                                  \
+    scalar_type scale = 0;                                                                                                             \
+    for (int i = 0; i < a->count; i++) {                                                                                               \
+      scale = lm2_max_##S(scale, lm2_v3_length_sq_##S(a->vertices[i]));                                                                \
+    }                                                                                                                                  \
+    for (int i = 0; i < b->count; i++) {                                                                                               \
+      scale = lm2_max_##S(scale, lm2_v3_length_sq_##S(b->vertices[i]));                                                                \
+    }                                                                                                                                  \
+    scalar_type tol = eps * (1 + (scalar_type)sqrt(scale));                                                                            \
+    lm2_v3_##S flat_normal;                                                                                                            \
+    if (!_lm2_epa3_blow_up_##S(a, b, s, tol, &flat_normal)) {                                                                          \
+      lm2_v3_##S toward_b = lm2_v3_sub_##S(_lm2_gjk3_centroid_##S(b), _lm2_gjk3_centroid_##S(a));                                      \
+      if (lm2_v3_length_sq_##S(flat_normal) == 0) {                                                                                    \
+        flat_normal = _lm2_m3_perpendicular_##S(toward_b);                                                                             \
+      }                                                                                                                                \
+      if (lm2_v3_dot_##S(flat_normal, toward_b) < 0) {                                                                                 \
+        flat_normal = lm2_v3_neg_##S(flat_normal);                                                                                     \
+      }                                                                                                                                \
+      lm2_v3_##S pa;                                                                                                                   \
+      _lm2_gjk3_witness_##S(s, &pa, out_pb);                                                                                           \
+      *out_normal = flat_normal;                                                                                                       \
+      *out_depth = 0;                                                                                                                  \
+      return;                                                                                                                          \
+    }                                                                                                                                  \
+                                                                                                                                       \
+    _lm2_gjk3_vertex_##S verts[_LM2_EPA3_MAX_VERTICES];                                                                                \
+    _lm2_epa3_face_##S faces[_LM2_EPA3_MAX_FACES];                                                                                     \
+    int edges[_LM2_EPA3_MAX_EDGES][2];                                                                                                 \
+    int vertex_count = 4;                                                                                                              \
+    int face_count = 0;                                                                                                                \
+    for (int i = 0; i < 4; i++) {                                                                                                      \
+      verts[i] = s->v[i];                                                                                                              \
+    }                                                                                                                                  \
+    lm2_v3_##S center = lm2_v3_mul_s_##S(                                                                                              \
+        lm2_v3_add_##S(lm2_v3_add_##S(verts[0].w, verts[1].w), lm2_v3_add_##S(verts[2].w, verts[3].w)), (scalar_type)0.25);            \
+    static const int tetra[4][3] = {{0, 1, 2}, {0, 3, 1}, {0, 2, 3}, {1, 3, 2}};                                                       \
+    for (int i = 0; i < 4; i++) {                                                                                                      \
+      _lm2_epa3_face_##S* f = &faces[face_count++];                                                                                    \
+      _lm2_epa3_make_face_##S(verts, tetra[i][0], tetra[i][1], tetra[i][2], f);                                                        \
+      if (lm2_v3_dot_##S(f->n, lm2_v3_sub_##S(verts[f->v[0]].w, center)) < 0) {                                                        \
+        _lm2_epa3_make_face_##S(verts, tetra[i][0], tetra[i][2], tetra[i][1], f);                                                      \
+      }                                                                                                                                \
+    }                                                                                                                                  \
+                                                                                                                                       \
+    int best = 0;                                                                                                                      \
+    for (int iteration = 0; iteration < _LM2_EPA3_MAX_VERTICES; iteration++) {                                                         \
+      best = 0;                                                                                                                        \
+      for (int i = 1; i < face_count; i++) {                                                                                           \
+        if (faces[i].dist < faces[best].dist) {                                                                                        \
+          best = i;                                                                                                                    \
+        }                                                                                                                              \
+      }                                                                                                                                \
+      _lm2_epa3_face_##S closest = faces[best];                                                                                        \
+      _lm2_gjk3_vertex_##S w = _lm2_gjk3_support_vertex_##S(a, b, closest.n);                                                          \
+      if (lm2_v3_dot_##S(closest.n, w.w) - closest.dist <= tol || vertex_count == _LM2_EPA3_MAX_VERTICES) {                            \
+        break;                                                                                                                         \
+      }                                                                                                                                \
+      int wi = vertex_count++;                                                                                                         \
+      verts[wi] = w;                                                                                                                   \
+                                                                                                                                       \
+      /* Remove the faces that see w and keep the horizon edges */                                                                     \
+      int edge_count = 0;                                                                                                              \
+      bool overflow = false;                                                                                                           \
+      for (int i = 0; i < face_count;) {                                                                                               \
+        _lm2_epa3_face_##S* f = &faces[i];                                                                                             \
+        if (lm2_v3_dot_##S(f->n, lm2_v3_sub_##S(w.w, verts[f->v[0]].w)) <= 0) {                                                        \
+          i++;                                                                                                                         \
+          continue;                                                                                                                    \
+        }                                                                                                                              \
+        for (int e = 0; e < 3; e++) {                                                                                                  \
+          int e0 = f->v[e];                                                                                                            \
+          int e1 = f->v[(e + 1) % 3];                                                                                                  \
+          bool shared = false;                                                                                                         \
+          for (int k = 0; k < edge_count; k++) {                                                                                       \
+            if (edges[k][0] == e1 && edges[k][1] == e0) {                                                                              \
+              edges[k][0] = edges[edge_count - 1][0];                                                                                  \
+              edges[k][1] = edges[edge_count - 1][1];                                                                                  \
+              edge_count--;                                                                                                            \
+              shared = true;                                                                                                           \
+              break;                                                                                                                   \
+            }                                                                                                                          \
+          }                                                                                                                            \
+          if (!shared) {                                                                                                               \
+            if (edge_count == _LM2_EPA3_MAX_EDGES) {                                                                                   \
+              overflow = true;                                                                                                         \
+              break;                                                                                                                   \
+            }                                                                                                                          \
+            edges[edge_count][0] = e0;                                                                                                 \
+            edges[edge_count][1] = e1;                                                                                                 \
+            edge_count++;                                                                                                              \
+          }                                                                                                                            \
+        }                                                                                                                              \
+        faces[i] = faces[--face_count];                                                                                                \
+      }                                                                                                                                \
+      if (overflow || face_count + edge_count > _LM2_EPA3_MAX_FACES || edge_count == 0) {                                              \
+        /* Out of room: the polytope is no longer closed, keep the last closest face */                                                \
+        faces[0] = closest;                                                                                                            \
+        face_count = 1;                                                                                                                \
+        best = 0;                                                                                                                      \
+        break;                                                                                                                         \
+      }                                                                                                                                \
+      for (int k = 0; k < edge_count; k++) {                                                                                           \
+        _lm2_epa3_make_face_##S(verts, edges[k][0], edges[k][1], wi, &faces[face_count++]);                                            \
+      }                                                                                                                                \
+    }                                                                                                                                  \
+                                                                                                                                       \
+    _lm2_epa3_face_##S* f = &faces[best];                                                                                              \
+    lm2_v3_##S p = lm2_v3_mul_s_##S(f->n, f->dist);                                                                                    \
+    scalar_type bary[3];                                                                                                               \
+    _lm2_m3_closest_on_triangle_##S(p, verts[f->v[0]].w, verts[f->v[1]].w, verts[f->v[2]].w, bary);                                    \
+    *out_pb = lm2_v3_zero_##S();                                                                                                       \
+    for (int i = 0; i < 3; i++) {                                                                                                      \
+      *out_pb = lm2_v3_add_##S(*out_pb, lm2_v3_mul_s_##S(verts[f->v[i]].wb, bary[i]));                                                 \
+    }                                                                                                                                  \
+    *out_normal = lm2_v3_neg_##S(f->n);                                                                                                \
+    *out_depth = lm2_max_##S(f->dist, 0);                                                                                              \
+  }                                                                                                                                    \
+                                                                                                                                       \
+  LM2_API lm2_gjk3_proxy_##S lm2_gjk3_proxy_from_shape_##S(lm2_shape3_##S shape) {                                                     \
+    LM2_ASSERT(shape.data != NULL);                                                                                                    \
+    lm2_gjk3_proxy_##S p;                                                                                                              \
+    p.count = 0;                                                                                                                       \
+    p.radius = 0;                                                                                                                      \
+    switch (shape.type) {                                                                                                              \
+      case LM2_SHAPE3_SPHERE: {                                                                                                        \
+        const lm2_sphere_##S* sphere = (const lm2_sphere_##S*)shape.data;                                                              \
+        p.vertices[p.count++] = sphere->center;                                                                                        \
+        p.radius = sphere->radius;                                                                                                     \
+        break;                                                                                                                         \
+      }                                                                                                                                \
+      case LM2_SHAPE3_CAPSULE: {                                                                                                       \
+        const lm2_capsule3_##S* capsule = (const lm2_capsule3_##S*)shape.data;                                                         \
+        p.vertices[p.count++] = capsule->start;                                                                                        \
+        p.vertices[p.count++] = capsule->end;                                                                                          \
+        p.radius = capsule->radius;                                                                                                    \
+        break;                                                                                                                         \
+      }                                                                                                                                \
+      case LM2_SHAPE3_AABB3: {                                                                                                         \
+        const lm2_aabb3_##S* box = (const lm2_aabb3_##S*)shape.data;                                                                   \
+        for (int i = 0; i < 8; i++) {                                                                                                  \
+          p.vertices[p.count++] = lm2_v3_make_##S((i & 4) ? box->max.x : box->min.x,                                                   \
+                                                  (i & 2) ? box->max.y : box->min.y,                                                   \
+                                                  (i & 1) ? box->max.z : box->min.z);                                                  \
+        }                                                                                                                              \
+        break;                                                                                                                         \
+      }                                                                                                                                \
+      case LM2_SHAPE3_TRIANGLE: {                                                                                                      \
+        const lm2_v3_##S* tri = (const lm2_v3_##S*)shape.data;                                                                         \
+        for (int i = 0; i < 3; i++) {                                                                                                  \
+          p.vertices[p.count++] = tri[i];                                                                                              \
+        }                                                                                                                              \
+        break;                                                                                                                         \
+      }                                                                                                                                \
+      case LM2_SHAPE3_EDGE: {                                                                                                          \
+        const lm2_edge3_##S* edge = (const lm2_edge3_##S*)shape.data;                                                                  \
+        p.vertices[p.count++] = edge->start;                                                                                           \
+        p.vertices[p.count++] = edge->end;                                                                                             \
+        break;                                                                                                                         \
+      }                                                                                                                                \
+    }                                                                                                                                  \
+    LM2_ASSERT(p.count > 0);                                                                                                           \
+    return p;                                                                                                                          \
+  }                                                                                                                                    \
+                                                                                                                                       \
+  LM2_API lm2_gjk3_result_##S lm2_gjk3_distance_##S(const lm2_gjk3_proxy_##S* a, const lm2_gjk3_proxy_##S* b, lm2_gjk3_cache* cache) { \
+    LM2_ASSERT(a != NULL && b != NULL);                                                                                                \
+    _lm2_gjk3_simplex_##S s;                                                                                                           \
+    lm2_v3_##S v;                                                                                                                      \
+    lm2_gjk3_result_##S r;                                                                                                             \
+    bool overlap = _lm2_gjk3_run_##S(a, b, cache, &s, &v, &r.iterations);                                                              \
+    _lm2_gjk3_witness_##S(&s, &r.point_a, &r.point_b);                                                                                 \
+    if (overlap) {                                                                                                                     \
+      r.normal = lm2_v3_zero_##S();                                                                                                    \
+      r.distance = -(a->radius + b->radius);                                                                                           \
+      return r;                                                                                                                        \
+    }                                                                                                                                  \
+    scalar_type dist = lm2_v3_length_##S(v);                                                                                           \
+    r.normal = lm2_v3_mul_s_##S(v, 1 / dist);                                                                                          \
+    r.distance = dist - a->radius - b->radius;                                                                                         \
+    r.point_a = lm2_v3_add_##S(r.point_a, lm2_v3_mul_s_##S(r.normal, a->radius));                                                      \
+    r.point_b = lm2_v3_sub_##S(r.point_b, lm2_v3_mul_s_##S(r.normal, b->radius));                                                      \
+    return r;                                                                                                                          \
+  }                                                                                                                                    \
+                                                                                                                                       \
+  LM2_API void lm2_manifold3_proxy_to_proxy_##S(const lm2_gjk3_proxy_##S* a, const lm2_gjk3_proxy_##S* b, lm2_gjk3_cache* cache,       \
+                                                lm2_manifold3_##S* out_manifold) {                                                     \
+    LM2_ASSERT(a != NULL && b != NULL && out_manifold != NULL);                                                                        \
+    out_manifold->count = 0;                                                                                                           \
+    _lm2_gjk3_simplex_##S s;                                                                                                           \
+    lm2_v3_##S v;                                                                                                                      \
+    int iterations;                                                                                                                    \
+    bool overlap = _lm2_gjk3_run_##S(a, b, cache, &s, &v, &iterations);                                                                \
+    scalar_type r = a->radius + b->radius;                                                                                             \
+    lm2_v3_##S pb, n;                                                                                                                  \
+    scalar_type depth;                                                                                                                 \
+    if (!overlap) {                                                                                                                    \
+      scalar_type dist = lm2_v3_length_##S(v);                                                                                         \
+      if (dist > r) {                                                                                                                  \
+        return;                                                                                                                        \
+      }                                                                                                                                \
+      lm2_v3_##S pa;                                                                                                                   \
+      _lm2_gjk3_witness_##S(&s, &pa, &pb);                                                                                             \
+      n = lm2_v3_mul_s_##S(v, 1 / dist);                                                                                               \
+      depth = r - dist;                                                                                                                \
+    } else {                                                                                                                           \
+      scalar_type core_depth;                                                                                                          \
+      _lm2_epa3_run_##S(a, b, &s, &n, &core_depth, &pb);                                                                               \
+      depth = core_depth + r;                                                                                                          \
+    }                                                                                                                                  \
+    out_manifold->count = 1;                                                                                                           \
+    out_manifold->normal = n;                                                                                                          \
+    out_manifold->depths[0] = depth;                                                                                                   \
+    out_manifold->contact_points[0] = lm2_v3_sub_##S(pb, lm2_v3_mul_s_##S(n, b->radius));                                              \
+  }
+
+// =============================================================================
+// Fast Paths and Shape Dispatch
+// =============================================================================
+
+#define _LM2_IMPL_MANIFOLD3_PAIRS(scalar_type, S, eps, parallel_tol)                                                                                \
+  LM2_API void lm2_manifold3_sphere_to_sphere_##S(lm2_sphere_##S a, lm2_sphere_##S b, lm2_manifold3_##S* out_manifold) {                            \
+    LM2_ASSERT(out_manifold != NULL);                                                                                                               \
+    _lm2_m3_point_contact_##S(a.center, a.radius, b.center, b.radius, lm2_v3_make_##S(0, 1, 0), out_manifold);                                      \
+  }                                                                                                                                                 \
+                                                                                                                                                    \
+  LM2_API void lm2_manifold3_sphere_to_capsule_##S(lm2_sphere_##S sphere, lm2_capsule3_##S capsule, lm2_manifold3_##S* out_manifold) {              \
+    LM2_ASSERT(out_manifold != NULL);                                                                                                               \
+    scalar_type t = _lm2_m3_project_segment_##S(sphere.center, capsule.start, capsule.end);                                                         \
+    lm2_v3_##S q = _lm2_m3_lerp_##S(capsule.start, capsule.end, t);                                                                                 \
+    lm2_v3_##S fallback = _lm2_m3_perpendicular_##S(lm2_v3_sub_##S(capsule.end, capsule.start));                                                    \
+    _lm2_m3_point_contact_##S(sphere.center, sphere.radius, q, capsule.radius, fallback, out_manifold);                                             \
+  }                                                                                                                                                 \
+                                                                                                                                                    \
+  LM2_API void lm2_manifold3_sphere_to_aabb_##S(lm2_sphere_##S sphere, lm2_aabb3_##S aabb, lm2_manifold3_##S* out_manifold) {                       \
+    LM2_ASSERT(out_manifold != NULL);                                                                                                               \
+    lm2_v3_##S c = sphere.center;                                                                                                                   \
+    lm2_v3_##S p = lm2_v3_min_##S(lm2_v3_max_##S(c, aabb.min), aabb.max);                                                                           \
+    out_manifold->count = 0;                                                                                                                        \
+    if (lm2_v3_distance_sq_##S(c, p) > 0) {                                                                                                         \
+      _lm2_m3_point_contact_##S(c, sphere.radius, p, 0, lm2_v3_make_##S(0, 1, 0), out_manifold);                                                    \
+      return;                                                                                                                                       \
+    }                                                                                                                                               \
+    /* Center inside: leave through the nearest face */                                                                                             \
+    scalar_type gaps[6] = {c.x - aabb.min.x, aabb.max.x - c.x, c.y - aabb.min.y, aabb.max.y - c.y, c.z - aabb.min.z, aabb.max.z - c.z};             \
+    int face = 0;                                                                                                                                   \
+    for (int i = 1; i < 6; i++) {                                                                                                                   \
+      if (gaps[i] < gaps[face]) {                                                                                                                   \
+        face = i;                                                                                                                                   \
+      }                                                                                                                                             \
+    }                                                                                                                                               \
+    scalar_type sign = (face & 1) ? 1 : -1;                                                                                                         \
+    lm2_v3_##S outward = lm2_v3_make_##S(face / 2 == 0 ? sign : 0, face / 2 == 1 ? sign : 0, face / 2 == 2 ? sign : 0);                             \
+    out_manifold->count = 1;                                                                                                                        \
+    out_manifold->normal = lm2_v3_neg_##S(outward);                                                                                                 \
+    out_manifold->depths[0] = gaps[face] + sphere.radius;                                                                                           \
+    out_manifold->contact_points[0] = lm2_v3_add_##S(c, lm2_v3_mul_s_##S(outward, gaps[face]));                                                     \
+  }                                                                                                                                                 \
+                                                                                                                                                    \
+  LM2_API void lm2_manifold3_sphere_to_triangle_##S(lm2_sphere_##S sphere, const lm2_triangle3_##S triangle, lm2_manifold3_##S* out_manifold) {     \
+    LM2_ASSERT(out_manifold != NULL);                                                                                                               \
+    scalar_type bary[3];                                                                                                                            \
+    lm2_v3_##S q = _lm2_m3_closest_on_triangle_##S(sphere.center, triangle[0], triangle[1], triangle[2], bary);                                     \
+    lm2_v3_##S n = lm2_v3_cross_##S(lm2_v3_sub_##S(triangle[1], triangle[0]), lm2_v3_sub_##S(triangle[2], triangle[0]));                            \
+    n = lm2_v3_length_sq_##S(n) > 0 ? lm2_v3_norm_##S(n) : lm2_v3_make_##S(0, 1, 0);                                                                \
+    _lm2_m3_point_contact_##S(sphere.center, sphere.radius, q, 0, lm2_v3_neg_##S(n), out_manifold);                                                 \
+  }                                                                                                                                                 \
+                                                                                                                                                    \
+  LM2_API void lm2_manifold3_capsule_to_capsule_##S(lm2_capsule3_##S a, lm2_capsule3_##S b, lm2_manifold3_##S* out_manifold) {                      \
+    LM2_ASSERT(out_manifold != NULL);                                                                                                               \
+    lm2_v3_##S ca, cb;                                                                                                                              \
+    _lm2_m3_segment_closest_##S(a.start, a.end, b.start, b.end, &ca, &cb);                                                                          \
+    lm2_v3_##S da = lm2_v3_sub_##S(a.end, a.start);                                                                                                 \
+    lm2_v3_##S db = lm2_v3_sub_##S(b.end, b.start);                                                                                                 \
+    lm2_v3_##S fallback = lm2_v3_cross_##S(da, db);                                                                                                 \
+    lm2_v3_##S toward_b = lm2_v3_sub_##S(_lm2_m3_lerp_##S(b.start, b.end, (scalar_type)0.5), _lm2_m3_lerp_##S(a.start, a.end, (scalar_type)0.5));   \
+    fallback = lm2_v3_length_sq_##S(fallback) > 0 ? lm2_v3_norm_##S(fallback) : _lm2_m3_perpendicular_##S(lm2_v3_add_##S(da, db));                  \
+    if (lm2_v3_dot_##S(fallback, toward_b) < 0) {                                                                                                   \
+      fallback = lm2_v3_neg_##S(fallback);                                                                                                          \
+    }                                                                                                                                               \
+    _lm2_m3_point_contact_##S(ca, a.radius, cb, b.radius, fallback, out_manifold);                                                                  \
+    if (out_manifold->count == 0) {                                                                                                                 \
+      return;                                                                                                                                       \
+    }                                                                                                                                               \
+                                                                                                                                                    \
+    /* Side by side: clip B to the span of A and keep both ends */                                                                                  \
+    scalar_type aa = lm2_v3_dot_##S(da, da);                                                                                                        \
+    scalar_type bb = lm2_v3_dot_##S(db, db);                                                                                                        \
+    lm2_v3_##S cross = lm2_v3_cross_##S(da, db);                                                                                                    \
+    if (!(aa > 0) || !(bb > 0) || lm2_v3_dot_##S(cross, cross) > parallel_tol * parallel_tol * aa * bb) {                                           \
+      return;                                                                                                                                       \
+    }                                                                                                                                               \
+    scalar_type t0 = lm2_v3_dot_##S(lm2_v3_sub_##S(b.start, a.start), da) / aa;                                                                     \
+    scalar_type t1 = lm2_v3_dot_##S(lm2_v3_sub_##S(b.end, a.start), da) / aa;                                                                       \
+    scalar_type lo = lm2_max_##S(0, lm2_min_##S(t0, t1));                                                                                           \
+    scalar_type hi = lm2_min_##S(1, lm2_max_##S(t0, t1));                                                                                           \
+    if ((hi - lo) * (scalar_type)sqrt(aa) <= eps * (1 + (scalar_type)sqrt(aa))) {                                                                   \
+      return;                                                                                                                                       \
+    }                                                                                                                                               \
+    lm2_v3_##S n = out_manifold->normal;                                                                                                            \
+    scalar_type r = a.radius + b.radius;                                                                                                            \
+    scalar_type ts[2] = {lo, hi};                                                                                                                   \
+    int count = 0;                                                                                                                                  \
+    for (int i = 0; i < 2; i++) {                                                                                                                   \
+      lm2_v3_##S pa = lm2_v3_add_##S(a.start, lm2_v3_mul_s_##S(da, ts[i]));                                                                         \
+      lm2_v3_##S pb = _lm2_m3_lerp_##S(b.start, b.end, _lm2_m3_project_segment_##S(pa, b.start, b.end));                                            \
+      scalar_type depth = r - lm2_v3_dot_##S(lm2_v3_sub_##S(pb, pa), n);                                                                            \
+      if (depth >= 0) {                                                                                                                             \
+        out_manifold->depths[count] = depth;                                                                                                        \
+        out_manifold->contact_points[count] = lm2_v3_sub_##S(pb, lm2_v3_mul_s_##S(n, b.radius));                                                    \
+        count++;                                                                                                                                    \
+      }                                                                                                                                             \
+    }                                                                                                                                               \
+    if (count > 0) {                                                                                                                                \
+      out_manifold->count = count;                                                                                                                  \
+    }                                                                                                                                               \
+  }                                                                                                                                                 \
+                                                                                                                                                    \
+  LM2_API void lm2_manifold3_capsule_to_triangle_##S(lm2_capsule3_##S capsule, const lm2_triangle3_##S triangle, lm2_manifold3_##S* out_manifold) { \
+    LM2_ASSERT(out_manifold != NULL);                                                                                                               \
+    out_manifold->count = 0;                                                                                                                        \
+    lm2_v3_##S p = capsule.start;                                                                                                                   \
+    lm2_v3_##S q = capsule.end;                                                                                                                     \
+    lm2_v3_##S d = lm2_v3_sub_##S(q, p);                                                                                                            \
+    lm2_v3_##S n = lm2_v3_cross_##S(lm2_v3_sub_##S(triangle[1], triangle[0]), lm2_v3_sub_##S(triangle[2], triangle[0]));                            \
+    scalar_type n_len = lm2_v3_length_##S(n);                                                                                                       \
+    scalar_type size = lm2_max_##S(lm2_v3_length_##S(d), lm2_v3_distance_##S(triangle[0], triangle[1]));                                            \
+    scalar_type tol = eps * (1 + size);                                                                                                             \
+    bool cores_apart = n_len > 0;                                                                                                                   \
+    lm2_v3_##S best_s = p, best_t = triangle[0];                                                                                                    \
+    scalar_type best_sq = -1;                                                                                                                       \
+    if (cores_apart) {                                                                                                                              \
+      n = lm2_v3_mul_s_##S(n, 1 / n_len);                                                                                                           \
+      scalar_type s0 = lm2_v3_dot_##S(lm2_v3_sub_##S(p, triangle[0]), n);                                                                           \
+      scalar_type s1 = lm2_v3_dot_##S(lm2_v3_sub_##S(q, triangle[0]), n);                                                                           \
+      if ((s0 <= 0 && s1 >= 0) || (s0 >= 0 && s1 <= 0)) {                                                                                           \
+        lm2_v3_##S x = s0 == s1 ? p : lm2_v3_add_##S(p, lm2_v3_mul_s_##S(d, s0 / (s0 - s1)));                                                       \
+        scalar_type bary[3];                                                                                                                        \
+        lm2_v3_##S y = _lm2_m3_closest_on_triangle_##S(x, triangle[0], triangle[1], triangle[2], bary);                                             \
+        cores_apart = lm2_v3_distance_sq_##S(x, y) > tol * tol;                                                                                     \
+      }                                                                                                                                             \
+    }                                                                                                                                               \
+    if (cores_apart) {                                                                                                                              \
+      lm2_v3_##S ends[2] = {p, q};                                                                                                                  \
+      for (int i = 0; i < 2; i++) {                                                                                                                 \
+        scalar_type bary[3];                                                                                                                        \
+        lm2_v3_##S y = _lm2_m3_closest_on_triangle_##S(ends[i], triangle[0], triangle[1], triangle[2], bary);                                       \
+        scalar_type dist_sq = lm2_v3_distance_sq_##S(ends[i], y);                                                                                   \
+        if (best_sq < 0 || dist_sq < best_sq) {                                                                                                     \
+          best_sq = dist_sq, best_s = ends[i], best_t = y;                                                                                          \
+        }                                                                                                                                           \
+      }                                                                                                                                             \
+      for (int i = 0; i < 3; i++) {                                                                                                                 \
+        lm2_v3_##S cs, ct;                                                                                                                          \
+        scalar_type dist_sq = _lm2_m3_segment_closest_##S(p, q, triangle[i], triangle[(i + 1) % 3], &cs, &ct);                                      \
+        if (best_sq < 0 || dist_sq < best_sq) {                                                                                                     \
+          best_sq = dist_sq, best_s = cs, best_t = ct;                                                                                              \
+        }                                                                                                                                           \
+      }                                                                                                                                             \
+      cores_apart = best_sq > tol * tol;                                                                                                            \
+    }                                                                                                                                               \
+    scalar_type r = capsule.radius;                                                                                                                 \
+    if (!cores_apart) {                                                                                                                             \
+      /* The segment pierces the triangle (or the triangle is degenerate): use EPA */                                                               \
+      lm2_gjk3_proxy_##S pa, pb;                                                                                                                    \
+      pa.vertices[0] = p, pa.vertices[1] = q, pa.count = 2, pa.radius = r;                                                                          \
+      pb.vertices[0] = triangle[0], pb.vertices[1] = triangle[1], pb.vertices[2] = triangle[2];                                                     \
+      pb.count = 3, pb.radius = 0;                                                                                                                  \
+      lm2_manifold3_proxy_to_proxy_##S(&pa, &pb, NULL, out_manifold);                                                                               \
+      return;                                                                                                                                       \
+    }                                                                                                                                               \
+    if (best_sq > r * r) {                                                                                                                          \
+      return;                                                                                                                                       \
+    }                                                                                                                                               \
+    scalar_type dist = (scalar_type)sqrt(best_sq);                                                                                                  \
+    lm2_v3_##S normal = lm2_v3_mul_s_##S(lm2_v3_sub_##S(best_t, best_s), 1 / dist);                                                                 \
+    out_manifold->count = 1;                                                                                                                        \
+    out_manifold->normal = normal;                                                                                                                  \
+    out_manifold->depths[0] = r - dist;                                                                                                             \
+    out_manifold->contact_points[0] = best_t;                                                                                                       \
+                                                                                                                                                    \
+    /* Lying on the face: clip the segment to the triangle prism and keep both ends */                                                              \
+    scalar_type align = lm2_v3_dot_##S(normal, n);                                                                                                  \
+    scalar_type dd = lm2_v3_dot_##S(d, d);                                                                                                          \
+    scalar_type dn = lm2_v3_dot_##S(d, n);                                                                                                          \
+    if ((align < 0 ? -align : align) < 1 - parallel_tol || !(dd > 0) || dn * dn > parallel_tol * parallel_tol * dd) {                               \
+      return;                                                                                                                                       \
+    }                                                                                                                                               \
+    lm2_v3_##S up = align < 0 ? n : lm2_v3_neg_##S(n);                                                                                              \
+    lm2_v3_##S centroid = lm2_triangle3_centroid_##S(triangle);                                                                                     \
+    scalar_type lo = 0, hi = 1;                                                                                                                     \
+    for (int i = 0; i < 3 && lo < hi; i++) {                                                                                                        \
+      lm2_v3_##S e0 = triangle[i];                                                                                                                  \
+      lm2_v3_##S m = lm2_v3_cross_##S(lm2_v3_sub_##S(triangle[(i + 1) % 3], e0), n);                                                                \
+      if (lm2_v3_dot_##S(m, lm2_v3_sub_##S(centroid, e0)) < 0) {                                                                                    \
+        m = lm2_v3_neg_##S(m);                                                                                                                      \
+      }                                                                                                                                             \
+      scalar_type f0 = lm2_v3_dot_##S(m, lm2_v3_sub_##S(p, e0));                                                                                    \
+      scalar_type fd = lm2_v3_dot_##S(m, d);                                                                                                        \
+      if (fd == 0) {                                                                                                                                \
+        if (f0 < 0) {                                                                                                                               \
+          hi = lo;                                                                                                                                  \
+        }                                                                                                                                           \
+      } else if (fd > 0) {                                                                                                                          \
+        lo = lm2_max_##S(lo, -f0 / fd);                                                                                                             \
+      } else {                                                                                                                                      \
+        hi = lm2_min_##S(hi, -f0 / fd);                                                                                                             \
+      }                                                                                                                                             \
+    }                                                                                                                                               \
+    if ((hi - lo) * (scalar_type)sqrt(dd) <= tol) {                                                                                                 \
+      return;                                                                                                                                       \
+    }                                                                                                                                               \
+    scalar_type ts[2] = {lo, hi};                                                                                                                   \
+    int count = 0;                                                                                                                                  \
+    for (int i = 0; i < 2; i++) {                                                                                                                   \
+      lm2_v3_##S x = lm2_v3_add_##S(p, lm2_v3_mul_s_##S(d, ts[i]));                                                                                 \
+      scalar_type height = lm2_v3_dot_##S(lm2_v3_sub_##S(x, triangle[0]), up);                                                                      \
+      if (r - height >= 0) {                                                                                                                        \
+        out_manifold->depths[count] = r - height;                                                                                                   \
+        out_manifold->contact_points[count] = lm2_v3_sub_##S(x, lm2_v3_mul_s_##S(up, height));                                                      \
+        count++;                                                                                                                                    \
+      }                                                                                                                                             \
+    }                                                                                                                                               \
+    if (count > 0) {                                                                                                                                \
+      out_manifold->count = count;                                                                                                                  \
+      out_manifold->normal = lm2_v3_neg_##S(up);                                                                                                    \
+    }                                                                                                                                               \
+  }                                                                                                                                                 \
+                                                                                                                                                    \
+  LM2_API bool lm2_collide3_shape_to_shape_##S(lm2_shape3_##S shape_a, lm2_shape3_##S shape_b) {                                                    \
+    LM2_ASSERT(shape_a.data != NULL && shape_b.data != NULL);                                                                                       \
+    if (shape_a.type == LM2_SHAPE3_SPHERE && shape_b.type == LM2_SHAPE3_SPHERE) {                                                                   \
+      return lm2_spheres_overlap_##S(*(lm2_sphere_##S*)shape_a.data, *(lm2_sphere_##S*)shape_b.data);                                               \
+    }                                                                                                                                               \
+    if (shape_a.type == LM2_SHAPE3_CAPSULE && shape_b.type == LM2_SHAPE3_CAPSULE) {                                                                 \
+      return lm2_capsules3_overlap_##S(*(lm2_capsule3_##S*)shape_a.data, *(lm2_capsule3_##S*)shape_b.data);                                         \
+    }                                                                                                                                               \
+    if (shape_a.type == LM2_SHAPE3_AABB3 && shape_b.type == LM2_SHAPE3_AABB3) {                                                                     \
+      return lm2_aabb3_overlaps_##S(*(lm2_aabb3_##S*)shape_a.data, *(lm2_aabb3_##S*)shape_b.data);                                                  \
+    }                                                                                                                                               \
+    lm2_gjk3_proxy_##S pa = lm2_gjk3_proxy_from_shape_##S(shape_a);                                                                                 \
+    lm2_gjk3_proxy_##S pb = lm2_gjk3_proxy_from_shape_##S(shape_b);                                                                                 \
+    return lm2_gjk3_distance_##S(&pa, &pb, NULL).distance <= 0;                                                                                     \
+  }                                                                                                                                                 \
+                                                                                                                                                    \
+  /* Fast path for (a, b) if there is one. Returns false when the pair needs GJK/EPA. */                                                            \
+  static bool _lm2_manifold3_fast_path_##S(lm2_shape3_##S a, lm2_shape3_##S b, lm2_manifold3_##S* out) {                                            \
+    switch (a.type) {                                                                                                                               \
+      case LM2_SHAPE3_SPHERE: {                                                                                                                     \
+        lm2_sphere_##S sphere = *(lm2_sphere_##S*)a.data;                                                                                           \
+        switch (b.type) {                                                                                                                           \
+          case LM2_SHAPE3_SPHERE:                                                                                                                   \
+            lm2_manifold3_sphere_to_sphere_##S(sphere, *(lm2_sphere_##S*)b.data, out);                                                              \
+            return true;                                                                                                                            \
+          case LM2_SHAPE3_CAPSULE:                                                                                                                  \
+            lm2_manifold3_sphere_to_capsule_##S(sphere, *(lm2_capsule3_##S*)b.data, out);                                                           \
+            return true;                                                                                                                            \
+          case LM2_SHAPE3_AABB3:                                                                                                                    \
+            lm2_manifold3_sphere_to_aabb_##S(sphere, *(lm2_aabb3_##S*)b.data, out);                                                                 \
+            return true;                                                                                                                            \
+          case LM2_SHAPE3_TRIANGLE:                                                                                                                 \
+            lm2_manifold3_sphere_to_triangle_##S(sphere, (const lm2_v3_##S*)b.data, out);                                                           \
+            return true;                                                                                                                            \
+          default:                                                                                                                                  \
+            return false;                                                                                                                           \
+        }                                                                                                                                           \
+      }                                                                                                                                             \
+      case LM2_SHAPE3_CAPSULE: {                                                                                                                    \
+        lm2_capsule3_##S capsule = *(lm2_capsule3_##S*)a.data;                                                                                      \
+        switch (b.type) {                                                                                                                           \
+          case LM2_SHAPE3_CAPSULE:                                                                                                                  \
+            lm2_manifold3_capsule_to_capsule_##S(capsule, *(lm2_capsule3_##S*)b.data, out);                                                         \
+            return true;                                                                                                                            \
+          case LM2_SHAPE3_TRIANGLE:                                                                                                                 \
+            lm2_manifold3_capsule_to_triangle_##S(capsule, (const lm2_v3_##S*)b.data, out);                                                         \
+            return true;                                                                                                                            \
+          default:                                                                                                                                  \
+            return false;                                                                                                                           \
+        }                                                                                                                                           \
+      }                                                                                                                                             \
+      default:                                                                                                                                      \
+        return false;                                                                                                                               \
+    }                                                                                                                                               \
+  }                                                                                                                                                 \
+                                                                                                                                                    \
+  LM2_API void lm2_manifold3_shape_to_shape_##S(lm2_shape3_##S shape_a, lm2_shape3_##S shape_b, lm2_gjk3_cache* cache,                              \
+                                                lm2_manifold3_##S* out_manifold) {                                                                  \
+    LM2_ASSERT(shape_a.data != NULL && shape_b.data != NULL && out_manifold != NULL);                                                               \
+    if (_lm2_manifold3_fast_path_##S(shape_a, shape_b, out_manifold)) {                                                                             \
+      return;                                                                                                                                       \
+    }                                                                                                                                               \
+    if (_lm2_manifold3_fast_path_##S(shape_b, shape_a, out_manifold)) {                                                                             \
+      _lm2_m3_flip_##S(out_manifold);                                                                                                               \
+      return;                                                                                                                                       \
+    }                                                                                                                                               \
+    lm2_gjk3_proxy_##S pa = lm2_gjk3_proxy_from_shape_##S(shape_a);                                                                                 \
+    lm2_gjk3_proxy_##S pb = lm2_gjk3_proxy_from_shape_##S(shape_b);                                                                                 \
+    lm2_manifold3_proxy_to_proxy_##S(&pa, &pb, cache, out_manifold);                                                                                \
+  }
+
+// =============================================================================
+// Instantiations
+// =============================================================================
+
+_LM2_IMPL_MANIFOLD3_HELPERS(double, f64)
+_LM2_IMPL_MANIFOLD3_HELPERS(float, f32)
+_LM2_IMPL_MANIFOLD3_GJK(double, f64, DBL_MAX, 1e-10)
+_LM2_IMPL_MANIFOLD3_GJK(float, f32, FLT_MAX, 1e-5f)
+_LM2_IMPL_MANIFOLD3_PAIRS(double, f64, 1e-10, 1e-3)
+_LM2_IMPL_MANIFOLD3_PAIRS(float, f32, 1e-5f, 1e-3f)
@@ -0,0 +1,415 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <lm2/geometry3d/lm2_mesh_optimize.h>
+#include <math.h>
+#include <string.h>  // For memcpy
+#include "../misc/lm2_scratch.h"
+
+// =============================================================================
+// Vertex Cache Optimization
+// =============================================================================
+// Every vertex scores by its position in a modelled LRU cache and by the
+// number of triangles still waiting for it; every triangle scores the sum of
+// its vertices. After emitting a triangle only the vertices in the cache get
+// rescored, and the next triangle is the best one touching them. When none
+// is left the next unemitted triangle in input order restarts the strip.
+
+#define _LM2_FORSYTH_CACHE_SIZE 32
+#define _LM2_FORSYTH_VALENCE_TABLE_SIZE 64
+
+typedef struct _lm2_forsyth_scores {
+  float cache[_LM2_FORSYTH_CACHE_SIZE];
+  float valence[_LM2_FORSYTH_VALENCE_TABLE_SIZE];
+} _lm2_forsyth_scores;
+
+static void _lm2_forsyth_scores_init(_lm2_forsyth_scores* scores) {
+  // The last triangle's vertices score the same, whatever order they came in
+  for (int i = 0; i < _LM2_FORSYTH_CACHE_SIZE; i++) {
+    scores->cache[i] = i < 3 ? 0.75f : powf(1.0f - (float)(i - 3) / (float)(_LM2_FORSYTH_CACHE_SIZE - 3), 1.5f);
+  }
+  // Vertices with few triangles left are finished off first
+  scores->valence[0] = 0.0f;
+  for (int i = 1; i < _LM2_FORSYTH_VALENCE_TABLE_SIZE; i++) {
+    scores->valence[i] = 2.0f / sqrtf((float)i);
+  }
+}
+
+static inline float _lm2_forsyth_vertex_score(const _lm2_forsyth_scores* scores, int32_t cache_position, uint32_t live) {
+  if (live == 0) {
+    return -1.0f;
+  }
+  float score = cache_position >= 0 ? scores->cache[cache_position] : 0.0f;
+  return score + scores->valence[live < _LM2_FORSYTH_VALENCE_TABLE_SIZE ? live : _LM2_FORSYTH_VALENCE_TABLE_SIZE - 1];
+}
+
+LM2_API void lm2_mesh_optimize_vertex_cache(
+    uint32_t* destination,
+    const uint32_t* indices,
+    size_t index_count,
+    size_t vertex_count) {
+  LM2_ASSERT(index_count == 0 || (destination != NULL && indices != NULL));
+  LM2_ASSERT(index_count % 3 == 0);
+  LM2_ASSERT(vertex_count <= UINT32_MAX);
+
+  const size_t triangle_count = index_count / 3;
+  if (triangle_count == 0) {
+    return;
+  }
+
+  // Indices are read after destination is written, so work on a copy when they alias
+  uint32_t* source_copy = NULL;
+  if (destination == indices) {
+    source_copy = (uint32_t*)lm2_malloc(sizeof(uint32_t) * index_count);
+    LM2_ASSERT(source_copy != NULL);
+    memcpy(source_copy, indices, sizeof(uint32_t) * index_count);
+    indices = source_copy;
+  }
+
+  uint32_t* live = (uint32_t*)lm2_calloc(vertex_count, sizeof(uint32_t));
+  size_t* offsets = (size_t*)lm2_malloc(sizeof(size_t) * (vertex_count + 1));
+  uint32_t* adjacency = (uint32_t*)lm2_malloc(sizeof(uint32_t) * index_count);
+  int32_t* cache_positions = (int32_t*)lm2_malloc(sizeof(int32_t) * vertex_count);
+  float* vertex_scores = (float*)lm2_malloc(sizeof(float) * vertex_count);
+  float* triangle_scores = (float*)lm2_malloc(sizeof(float) * triangle_count);
+  bool* emitted = (bool*)lm2_calloc(triangle_count, sizeof(bool));
+  LM2_ASSERT(live != NULL && offsets != NULL && adjacency != NULL && cache_positions != NULL);
+  LM2_ASSERT(vertex_scores != NULL && triangle_scores != NULL && emitted != NULL);
+
+  // Triangle lists per vertex, compacted as triangles get emitted
+  for (size_t i = 0; i < index_count; i++) {
+    LM2_ASSERT(indices[i] < vertex_count);
+    live[indices[i]]++;
+  }
+  offsets[0] = 0;
+  for (size_t v = 0; v < vertex_count; v++) {
+    offsets[v + 1] = offsets[v] + live[v];
+    live[v] = 0;
+  }
+  for (size_t t = 0; t < triangle_count; t++) {
+    for (int k = 0; k < 3; k++) {
+      uint32_t v = indices[t * 3 + k];
+      adjacency[offsets[v] + live[v]++] = (uint32_t)t;
+    }
+  }
+
+  _lm2_forsyth_scores scores;
+  _lm2_forsyth_scores_init(&scores);
+  for (size_t v = 0; v < vertex_count; v++) {
+    cache_positions[v] = -1;
+    vertex_scores[v] = _lm2_forsyth_vertex_score(&scores, -1, live[v]);
+  }
+
+  size_t best = 0;
+  for (size_t t = 0; t < triangle_count; t++) {
+    const uint32_t* tri = &indices[t * 3];
+    triangle_scores[t] = vertex_scores[tri[0]] + vertex_scores[tri[1]] + vertex_scores[tri[2]];
+    if (triangle_scores[t] > triangle_scores[best]) {
+      best = t;
+    }
+  }
+
+  uint32_t cache[_LM2_FORSYTH_CACHE_SIZE + 3];
+  uint32_t next_cache[_LM2_FORSYTH_CACHE_SIZE + 3];
+  size_t cache_count = 0;
+  size_t cursor = 0;
+
+  for (size_t out = 0; out < triangle_count; out++) {
+    if (best == SIZE_MAX) {
+      while (emitted[cursor]) {
+        cursor++;
+      }
+      best = cursor;
+    }
+
+    const uint32_t* tri = &indices[best * 3];
+    memcpy(&destination[out * 3], tri, sizeof(uint32_t) * 3);
+    emitted[best] = true;
+
+    // Drop the triangle from its vertices' lists
+    size_t next_count = 0;
+    for (int k = 0; k < 3; k++) {
+      uint32_t v = tri[k];
+      uint32_t* list = &adjacency[offsets[v]];
+      for (uint32_t j = 0; j < live[v]; j++) {
+        if (list[j] == best) {
+          list[j] = list[live[v] - 1];
+          live[v]--;
+          break;
+        }
+      }
+      if (cache_positions[v] != -2) {
+        cache_positions[v] = -2;
+        next_cache[next_count++] = v;
+      }
+    }
+
+    // The triangle's vertices move to the front; entries pushed past the end leave the cache
+    for (size_t i = 0; i < cache_count; i++) {
+      uint32_t v = cache[i];
+      if (cache_positions[v] != -2) {
+        next_cache[next_count++] = v;
+      }
+    }
+    for (size_t i = 0; i < next_count; i++) {
+      uint32_t v = next_cache[i];
+      int32_t position = i < _LM2_FORSYTH_CACHE_SIZE ? (int32_t)i : -1;
+      cache_positions[v] = position;
+      float score = _lm2_forsyth_vertex_score(&scores, position, live[v]);
+      float delta = score - vertex_scores[v];
+      vertex_scores[v] = score;
+      const uint32_t* list = &adjacency[offsets[v]];
+      for (uint32_t j = 0; j < live[v]; j++) {
+        triangle_scores[list[j]] += delta;
+      }
+    }
+    cache_count = next_count < _LM2_FORSYTH_CACHE_SIZE ? next_count : _LM2_FORSYTH_CACHE_SIZE;
+    memcpy(cache, next_cache, sizeof(uint32_t) * cache_count);
+
+    best = SIZE_MAX;
+    float best_score = -1.0f;
+    for (size_t i = 0; i < cache_count; i++) {
+      uint32_t v = cache[i];
+      const uint32_t* list = &adjacency[offsets[v]];
+      for (uint32_t j = 0; j < live[v]; j++) {
+        if (triangle_scores[list[j]] > best_score) {
+          best_score = triangle_scores[list[j]];
+          best = list[j];
+        }
+      }
+    }
+  }
+
+  lm2_free(emitted);
+  lm2_free(triangle_scores);
+  lm2_free(vertex_scores);
+  lm2_free(cache_positions);
+  lm2_free(adjacency);
+  lm2_free(offsets);
+  lm2_free(live);
+  lm2_free(source_copy);
+}
+
+// =============================================================================
+// Vertex Fetch Optimization
+// =============================================================================
+
+LM2_API size_t lm2_mesh_vertex_fetch_remap(
+    uint32_t* remap,
+    const uint32_t* indices,
+    size_t index_count,
+    size_t vertex_count) {
+  LM2_ASSERT(vertex_count == 0 || remap != NULL);
+  LM2_ASSERT(index_count == 0 || indices != NULL);
+
+  for (size_t v = 0; v < vertex_count; v++) {
+    remap[v] = LM2_MESH_UNUSED_VERTEX;
+  }
+  uint32_t next = 0;
+  for (size_t i = 0; i < index_count; i++) {
+    uint32_t v = indices[i];
+    LM2_ASSERT(v < vertex_count);
+    if (remap[v] == LM2_MESH_UNUSED_VERTEX) {
+      remap[v] = next++;
+    }
+  }
+  return next;
+}
+
+LM2_API void lm2_mesh_remap_indices(
+    uint32_t* destination,
+    const uint32_t* indices,
+    size_t index_count,
+    const uint32_t* remap) {
+  LM2_ASSERT(index_count == 0 || (destination != NULL && indices != NULL && remap != NULL));
+
+  for (size_t i = 0; i < index_count; i++) {
+    LM2_ASSERT(remap[indices[i]] != LM2_MESH_UNUSED_VERTEX);
+    destination[i] = remap[indices[i]];
+  }
+}
+
+LM2_API void lm2_mesh_remap_vertices(
+    void* destination,
+    const void* vertices,
+    size_t vertex_count,
+    size_t vertex_size,
+    const uint32_t* remap) {
+  LM2_ASSERT(vertex_count == 0 || (destination != NULL && vertices != NULL && remap != NULL));
+  LM2_ASSERT(destination != vertices || vertex_count == 0);
+
+  for (size_t v = 0; v < vertex_count; v++) {
+    if (remap[v] != LM2_MESH_UNUSED_VERTEX) {
+      memcpy((char*)destination + (size_t)remap[v] * vertex_size, (const char*)vertices + v * vertex_size, vertex_size);
+    }
+  }
+}
+
+static size_t _lm2_mesh_optimize_vertex_fetch(
+    void* destination,
+    uint32_t* indices,
+    size_t index_count,
+    const void* vertices,
+    size_t vertex_count,
+    size_t vertex_size) {
+  LM2_ASSERT(vertex_count <= UINT32_MAX);
+  uint32_t* remap = (uint32_t*)lm2_malloc(sizeof(uint32_t) * (vertex_count > 0 ? vertex_count : 1));
+  LM2_ASSERT(remap != NULL);
+
+  size_t used = lm2_mesh_vertex_fetch_remap(remap, indices, index_count, vertex_count);
+  lm2_mesh_remap_indices(indices, indices, index_count, remap);
+  lm2_mesh_remap_vertices(destination, vertices, vertex_count, vertex_size, remap);
+
+  lm2_free(remap);
+  return used;
+}
+
+LM2_API size_t lm2_mesh_optimize_vertex_fetch3_f64(
+    lm2_v3_f64* destination,
+    uint32_t* indices,
+    size_t index_count,
+    const lm2_v3_f64* vertices,
+    size_t vertex_count) {
+  return _lm2_mesh_optimize_vertex_fetch(destination, indices, index_count, vertices, vertex_count, sizeof(lm2_v3_f64));
+}
+
+LM2_API size_t lm2_mesh_optimize_vertex_fetch3_f32(
+    lm2_v3_f32* destination,
+    uint32_t* indices,
+    size_t index_count,
+    const lm2_v3_f32* vertices,
+    size_t vertex_count) {
+  return _lm2_mesh_optimize_vertex_fetch(destination, indices, index_count, vertices, vertex_count, sizeof(lm2_v3_f32));
+}
+
+LM2_API size_t lm2_mesh_optimize_vertex_fetch2_f64(
+    lm2_v2_f64* destination,
+    uint32_t* indices,
+    size_t index_count,
+    const lm2_v2_f64* vertices,
+    size_t vertex_count) {
+  return _lm2_mesh_optimize_vertex_fetch(destination, indices, index_count, vertices, vertex_count, sizeof(lm2_v2_f64));
+}
+
+LM2_API size_t lm2_mesh_optimize_vertex_fetch2_f32(
+    lm2_v2_f32* destination,
+    uint32_t* indices,
+    size_t index_count,
+    const lm2_v2_f32* vertices,
+    size_t vertex_count) {
+  return _lm2_mesh_optimize_vertex_fetch(destination, indices, index_count, vertices, vertex_count, sizeof(lm2_v2_f32));
+}
+
+// =============================================================================
+// Analysis
+// =============================================================================
+
+#define _LM2_FETCH_LINE_SIZE 64
+#define _LM2_FETCH_LINE_COUNT 256
+
+LM2_API lm2_mesh_vertex_cache_stats lm2_mesh_analyze_vertex_cache(
+    const uint32_t* indices,
+    size_t index_count,
+    size_t vertex_count,
+    uint32_t cache_size) {
+  LM2_ASSERT(index_count == 0 || indices != NULL);
+  LM2_ASSERT(index_count % 3 == 0);
+  LM2_ASSERT(cache_size > 0);
+
+  lm2_mesh_vertex_cache_stats stats = {0, 0.0, 0.0};
+  if (index_count == 0) {
+    return stats;
+  }
+
+  // A vertex stays cached until cache_size newer vertices have been transformed
+  size_t* inserted = (size_t*)lm2_malloc(sizeof(size_t) * (vertex_count > 0 ? vertex_count : 1));
+  LM2_ASSERT(inserted != NULL);
+  for (size_t v = 0; v < vertex_count; v++) {
+    inserted[v] = SIZE_MAX;
+  }
+
+  size_t misses = 0;
+  size_t referenced = 0;
+  for (size_t i = 0; i < index_count; i++) {
+    uint32_t v = indices[i];
+    LM2_ASSERT(v < vertex_count);
+    if (inserted[v] == SIZE_MAX) {
+      referenced++;
+    }
+    if (inserted[v] == SIZE_MAX || misses - inserted[v] > cache_size) {
+      inserted[v] = misses;
+      misses++;
+    }
+  }
+  lm2_free(inserted);
+
+  stats.vertices_transformed = misses;
+  stats.acmr = (double)misses / (double)(index_count / 3);
+  stats.atvr = (double)misses / (double)referenced;
+  return stats;
+}
+
+LM2_API lm2_mesh_vertex_fetch_stats lm2_mesh_analyze_vertex_fetch(
+    const uint32_t* indices,
+    size_t index_count,
+    size_t vertex_count,
+    size_t vertex_size) {
+  LM2_ASSERT(index_count == 0 || indices != NULL);
+  LM2_ASSERT(vertex_size > 0);
+
+  lm2_mesh_vertex_fetch_stats stats = {0, 0.0};
+  if (index_count == 0) {
+    return stats;
+  }
+
+  bool* referenced = (bool*)lm2_calloc(vertex_count > 0 ? vertex_count : 1, sizeof(bool));
+  LM2_ASSERT(referenced != NULL);
+  size_t lines[_LM2_FETCH_LINE_COUNT];
+  for (size_t i = 0; i < _LM2_FETCH_LINE_COUNT; i++) {
+    lines[i] = SIZE_MAX;
+  }
+
+  size_t referenced_count = 0;
+  for (size_t i = 0; i < index_count; i++) {
+    uint32_t v = indices[i];
+    LM2_ASSERT(v < vertex_count);
+    if (!referenced[v]) {
+      referenced[v] = true;
+      referenced_count++;
+    }
+    size_t first = (size_t)v * vertex_size / _LM2_FETCH_LINE_SIZE;
+    size_t last = ((size_t)v * vertex_size + vertex_size - 1) / _LM2_FETCH_LINE_SIZE;
+    for (size_t line = first; line <= last; line++) {
+      size_t* slot = &lines[line % _LM2_FETCH_LINE_COUNT];
+      if (*slot != line) {
+        *slot = line;
+        stats.bytes_fetched += _LM2_FETCH_LINE_SIZE;
+      }
+    }
+  }
+  lm2_free(referenced);
+
+  stats.overfetch = (double)stats.bytes_fetched / (double)(referenced_count * vertex_size);
+  return stats;
+}
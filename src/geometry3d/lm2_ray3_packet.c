@@ -0,0 +1,250 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <lm2/geometry3d/lm2_ray3_packet.h>
+#include <lm2/vectors/lm2_vector_specifics.h>
+#include <string.h>
+#include "../vectors/lm2_simd.h"
+
+// =============================================================================
+// Ray Packet Functions
+// =============================================================================
+
+#define _LM2_IMPL_RAY3_PACKET(N, S)                                                                              \
+  LM2_API lm2_ray3_##S lm2_ray3_packet##N##_get_##S(const lm2_ray3_packet##N##_##S* packet, uint32_t lane) {     \
+    LM2_ASSERT(packet != NULL);                                                                                  \
+    LM2_ASSERT(lane < N);                                                                                        \
+    lm2_ray3_##S ray;                                                                                            \
+    ray.origin.x = packet->origin_x[lane];                                                                       \
+    ray.origin.y = packet->origin_y[lane];                                                                       \
+    ray.origin.z = packet->origin_z[lane];                                                                       \
+    ray.direction.x = packet->direction_x[lane];                                                                 \
+    ray.direction.y = packet->direction_y[lane];                                                                 \
+    ray.direction.z = packet->direction_z[lane];                                                                 \
+    ray.t_max = packet->t_max[lane];                                                                             \
+    return ray;                                                                                                  \
+  }                                                                                                              \
+                                                                                                                 \
+  LM2_API void lm2_ray3_packet##N##_set_##S(lm2_ray3_packet##N##_##S* packet, uint32_t lane, lm2_ray3_##S ray) { \
+    LM2_ASSERT(packet != NULL);                                                                                  \
+    LM2_ASSERT(lane < N);                                                                                        \
+    packet->origin_x[lane] = ray.origin.x;                                                                       \
+    packet->origin_y[lane] = ray.origin.y;                                                                       \
+    packet->origin_z[lane] = ray.origin.z;                                                                       \
+    packet->direction_x[lane] = ray.direction.x;                                                                 \
+    packet->direction_y[lane] = ray.direction.y;                                                                 \
+    packet->direction_z[lane] = ray.direction.z;                                                                 \
+    packet->t_max[lane] = ray.t_max;                                                                             \
+  }                                                                                                              \
+                                                                                                                 \
+  LM2_API uint32_t lm2_ray3_packet##N##_active_mask_##S(const lm2_ray3_packet##N##_##S* packet) {                \
+    LM2_ASSERT(packet != NULL);                                                                                  \
+    uint32_t mask = 0;                                                                                           \
+    for (uint32_t k = 0; k < N; k++) {                                                                           \
+      mask |= (uint32_t)(packet->t_max[k] > 0) << k;                                                             \
+    }                                                                                                            \
+    return mask;                                                                                                 \
+  }
+
+_LM2_IMPL_RAY3_PACKET(4, f64)
+_LM2_IMPL_RAY3_PACKET(8, f64)
+_LM2_IMPL_RAY3_PACKET(4, f32)
+_LM2_IMPL_RAY3_PACKET(8, f32)
+
+// =============================================================================
+// Packet Raycast Kernels
+// =============================================================================
+// The bodies below test the lanes starting at lane i, one vector at a time,
+// and OR the lanes that hit into mask. packet4 runs them once on a fixed
+// 4-wide row, so it stays vectorized when the native f32 width is 8; packet8
+// runs them over native vectors, whose width always divides 8.
+//
+// Slab test: a direction component below epsilon gets an inverse of +huge,
+// so its slab excludes every t when the origin lies outside of it and no t
+// when the origin lies inside, without the single-ray branch.
+
+#define _LM2_RAY3_PACKET_HUGE_f64 1e300
+#define _LM2_RAY3_PACKET_HUGE_f32 1e30f
+
+#define _LM2_RAY3_PACKET_LANES_4(S, BODY) \
+  {                                       \
+    const size_t i = 0;                   \
+    BODY(_lm2_row4, S, i)                 \
+  }
+
+#define _LM2_RAY3_PACKET_LANES_8(S, BODY)               \
+  for (size_t i = 0; i < 8; i += _lm2_simd_width_##S) { \
+    BODY(_lm2_simd, S, i)                               \
+  }
+
+// Entry and exit distance of the slab along axis c
+#define _LM2_RAY3_PACKET_SLAB(P, S, i, c)                                                          \
+  P##_##S dir_##c = P##_load_##S(packet->direction_##c + i);                                       \
+  P##_##S inv_##c = P##_select_gt_##S(P##_abs_##S(dir_##c), eps, P##_div_##S(one, dir_##c), huge); \
+  P##_##S org_##c = P##_load_##S(packet->origin_##c + i);                                          \
+  P##_##S t0_##c = P##_mul_##S(P##_sub_##S(P##_set1_##S(aabb.min.c), org_##c), inv_##c);           \
+  P##_##S t1_##c = P##_mul_##S(P##_sub_##S(P##_set1_##S(aabb.max.c), org_##c), inv_##c);           \
+  P##_##S near_##c = P##_min_##S(t0_##c, t1_##c);                                                  \
+  P##_##S far_##c = P##_max_##S(t0_##c, t1_##c);
+
+#define _LM2_RAY3_PACKET_AABB_BODY(P, S, i)                                                                       \
+  {                                                                                                               \
+    const P##_##S zero = P##_set1_##S(0), one = P##_set1_##S(1), neg = P##_set1_##S(-1);                          \
+    const P##_##S eps = P##_set1_##S(epsilon), huge = P##_set1_##S(_LM2_RAY3_PACKET_HUGE_##S);                    \
+    _LM2_RAY3_PACKET_SLAB(P, S, i, x)                                                                             \
+    _LM2_RAY3_PACKET_SLAB(P, S, i, y)                                                                             \
+    _LM2_RAY3_PACKET_SLAB(P, S, i, z)                                                                             \
+    P##_##S enter = P##_max_##S(P##_max_##S(near_x, near_y), near_z);                                             \
+    P##_##S t_near = P##_max_##S(enter, zero);                                                                    \
+    P##_##S t_far = P##_min_##S(P##_min_##S(P##_min_##S(far_x, far_y), far_z), P##_load_##S(cap + i));            \
+    mask |= (uint32_t)P##_le_mask_##S(t_near, t_far) << i;                                                        \
+    /* Normal of the entry face: x before y before z on ties, zero from inside */                                 \
+    P##_##S on_x = P##_select_gt_##S(P##_max_##S(near_y, near_z), near_x, zero, one);                             \
+    P##_##S on_y = P##_mul_##S(P##_select_gt_##S(near_z, near_y, zero, one), P##_sub_##S(one, on_x));             \
+    P##_##S on_z = P##_sub_##S(P##_sub_##S(one, on_x), on_y);                                                     \
+    P##_##S outside = P##_select_gt_##S(enter, zero, one, zero);                                                  \
+    P##_store_##S(hit_t + i, t_near);                                                                             \
+    P##_store_##S(hit_nx + i, P##_mul_##S(P##_mul_##S(on_x, outside), P##_select_gt_##S(dir_x, zero, neg, one))); \
+    P##_store_##S(hit_ny + i, P##_mul_##S(P##_mul_##S(on_y, outside), P##_select_gt_##S(dir_y, zero, neg, one))); \
+    P##_store_##S(hit_nz + i, P##_mul_##S(P##_mul_##S(on_z, outside), P##_select_gt_##S(dir_z, zero, neg, one))); \
+  }
+
+// Möller-Trumbore with edges e1 = v1 - v0 and e2 = v2 - v0
+#define _LM2_RAY3_PACKET_TRIANGLE_BODY(P, S, i)                                                                             \
+  {                                                                                                                         \
+    const P##_##S zero = P##_set1_##S(0), one = P##_set1_##S(1), eps = P##_set1_##S(epsilon);                               \
+    const P##_##S e1x = P##_set1_##S(e1.x), e1y = P##_set1_##S(e1.y), e1z = P##_set1_##S(e1.z);                             \
+    const P##_##S e2x = P##_set1_##S(e2.x), e2y = P##_set1_##S(e2.y), e2z = P##_set1_##S(e2.z);                             \
+    P##_##S dx = P##_load_##S(packet->direction_x + i);                                                                     \
+    P##_##S dy = P##_load_##S(packet->direction_y + i);                                                                     \
+    P##_##S dz = P##_load_##S(packet->direction_z + i);                                                                     \
+    P##_##S sx = P##_sub_##S(P##_load_##S(packet->origin_x + i), P##_set1_##S(v0.x));                                       \
+    P##_##S sy = P##_sub_##S(P##_load_##S(packet->origin_y + i), P##_set1_##S(v0.y));                                       \
+    P##_##S sz = P##_sub_##S(P##_load_##S(packet->origin_z + i), P##_set1_##S(v0.z));                                       \
+    P##_##S hx = P##_sub_##S(P##_mul_##S(dy, e2z), P##_mul_##S(dz, e2y));                                                   \
+    P##_##S hy = P##_sub_##S(P##_mul_##S(dz, e2x), P##_mul_##S(dx, e2z));                                                   \
+    P##_##S hz = P##_sub_##S(P##_mul_##S(dx, e2y), P##_mul_##S(dy, e2x));                                                   \
+    P##_##S a = P##_add_##S(P##_add_##S(P##_mul_##S(e1x, hx), P##_mul_##S(e1y, hy)), P##_mul_##S(e1z, hz));                 \
+    P##_##S f = P##_div_##S(one, a);                                                                                        \
+    P##_##S u = P##_mul_##S(f, P##_add_##S(P##_add_##S(P##_mul_##S(sx, hx), P##_mul_##S(sy, hy)), P##_mul_##S(sz, hz)));    \
+    P##_##S qx = P##_sub_##S(P##_mul_##S(sy, e1z), P##_mul_##S(sz, e1y));                                                   \
+    P##_##S qy = P##_sub_##S(P##_mul_##S(sz, e1x), P##_mul_##S(sx, e1z));                                                   \
+    P##_##S qz = P##_sub_##S(P##_mul_##S(sx, e1y), P##_mul_##S(sy, e1x));                                                   \
+    P##_##S v = P##_mul_##S(f, P##_add_##S(P##_add_##S(P##_mul_##S(dx, qx), P##_mul_##S(dy, qy)), P##_mul_##S(dz, qz)));    \
+    P##_##S t = P##_mul_##S(f, P##_add_##S(P##_add_##S(P##_mul_##S(e2x, qx), P##_mul_##S(e2y, qy)), P##_mul_##S(e2z, qz))); \
+    int m = P##_le_mask_##S(eps, P##_abs_##S(a)) & P##_le_mask_##S(zero, u) & P##_le_mask_##S(zero, v);                     \
+    m &= P##_le_mask_##S(P##_add_##S(u, v), one) & P##_le_mask_##S(eps, t) & P##_le_mask_##S(t, P##_load_##S(cap + i));     \
+    mask |= (uint32_t)m << i;                                                                                               \
+    P##_store_##S(hit_t + i, t);                                                                                            \
+  }
+
+#define _LM2_IMPL_RAY3_PACKET_CAST(N, S, scalar_type, epsilon_value)                                                                                                                                    \
+  /* Lanes to test, and the distance each one may hit within */                                                                                                                                         \
+  static uint32_t _lm2_ray3_packet##N##_prepare_##S(const lm2_ray3_packet##N##_##S* packet, uint32_t active_mask, const lm2_rayhit3_packet##N##_##S* hits, scalar_type* cap) {                          \
+    uint32_t active = 0;                                                                                                                                                                                \
+    for (uint32_t k = 0; k < N; k++) {                                                                                                                                                                  \
+      cap[k] = packet->t_max[k];                                                                                                                                                                        \
+      active |= (uint32_t)(cap[k] > 0) << k;                                                                                                                                                            \
+      if (hits != NULL && (hits->hit_mask & (1u << k)) && hits->t[k] < cap[k]) {                                                                                                                        \
+        cap[k] = hits->t[k];                                                                                                                                                                            \
+      }                                                                                                                                                                                                 \
+    }                                                                                                                                                                                                   \
+    return active & active_mask;                                                                                                                                                                        \
+  }                                                                                                                                                                                                     \
+                                                                                                                                                                                                        \
+  LM2_API lm2_rayhit3_##S lm2_rayhit3_packet##N##_get_##S(const lm2_rayhit3_packet##N##_##S* hits, const lm2_ray3_packet##N##_##S* packet, uint32_t lane) {                                             \
+    LM2_ASSERT(hits != NULL && packet != NULL);                                                                                                                                                         \
+    LM2_ASSERT(lane < N);                                                                                                                                                                               \
+    lm2_rayhit3_##S result;                                                                                                                                                                             \
+    memset(&result, 0, sizeof(result));                                                                                                                                                                 \
+    if (hits->hit_mask & (1u << lane)) {                                                                                                                                                                \
+      result.hit = true;                                                                                                                                                                                \
+      result.t = hits->t[lane];                                                                                                                                                                         \
+      result.point.x = packet->origin_x[lane] + packet->direction_x[lane] * result.t;                                                                                                                   \
+      result.point.y = packet->origin_y[lane] + packet->direction_y[lane] * result.t;                                                                                                                   \
+      result.point.z = packet->origin_z[lane] + packet->direction_z[lane] * result.t;                                                                                                                   \
+      result.normal.x = hits->normal_x[lane];                                                                                                                                                           \
+      result.normal.y = hits->normal_y[lane];                                                                                                                                                           \
+      result.normal.z = hits->normal_z[lane];                                                                                                                                                           \
+    }                                                                                                                                                                                                   \
+    return result;                                                                                                                                                                                      \
+  }                                                                                                                                                                                                     \
+                                                                                                                                                                                                        \
+  LM2_API uint32_t lm2_raycast_packet##N##_aabb3_##S(const lm2_ray3_packet##N##_##S* packet, uint32_t active_mask, lm2_r3_##S aabb, lm2_rayhit3_packet##N##_##S* hits) {                                \
+    LM2_ASSERT(packet != NULL);                                                                                                                                                                         \
+    scalar_type cap[N], hit_t[N], hit_nx[N], hit_ny[N], hit_nz[N];                                                                                                                                      \
+    const uint32_t active = _lm2_ray3_packet##N##_prepare_##S(packet, active_mask, hits, cap);                                                                                                          \
+    if (active == 0) {                                                                                                                                                                                  \
+      return 0;                                                                                                                                                                                         \
+    }                                                                                                                                                                                                   \
+    const scalar_type epsilon = epsilon_value;                                                                                                                                                          \
+    uint32_t mask = 0;                                                                                                                                                                                  \
+    _LM2_RAY3_PACKET_LANES_##N(S, _LM2_RAY3_PACKET_AABB_BODY)                                                                                                                                           \
+    mask &= active;                                                                                                                                                                                     \
+    if (hits != NULL) {                                                                                                                                                                                 \
+      for (uint32_t k = 0; k < N; k++) {                                                                                                                                                                \
+        if (mask & (1u << k)) {                                                                                                                                                                         \
+          hits->t[k] = hit_t[k];                                                                                                                                                                        \
+          hits->normal_x[k] = hit_nx[k];                                                                                                                                                                \
+          hits->normal_y[k] = hit_ny[k];                                                                                                                                                                \
+          hits->normal_z[k] = hit_nz[k];                                                                                                                                                                \
+        }                                                                                                                                                                                               \
+      }                                                                                                                                                                                                 \
+      hits->hit_mask |= mask;                                                                                                                                                                           \
+    }                                                                                                                                                                                                   \
+    return mask;                                                                                                                                                                                        \
+  }                                                                                                                                                                                                     \
+                                                                                                                                                                                                        \
+  LM2_API uint32_t lm2_raycast_packet##N##_triangle_##S(const lm2_ray3_packet##N##_##S* packet, uint32_t active_mask, lm2_v3_##S v0, lm2_v3_##S v1, lm2_v3_##S v2, lm2_rayhit3_packet##N##_##S* hits) { \
+    LM2_ASSERT(packet != NULL);                                                                                                                                                                         \
+    scalar_type cap[N], hit_t[N];                                                                                                                                                                       \
+    const uint32_t active = _lm2_ray3_packet##N##_prepare_##S(packet, active_mask, hits, cap);                                                                                                          \
+    if (active == 0) {                                                                                                                                                                                  \
+      return 0;                                                                                                                                                                                         \
+    }                                                                                                                                                                                                   \
+    const scalar_type epsilon = epsilon_value;                                                                                                                                                          \
+    const lm2_v3_##S e1 = lm2_v3_sub_##S(v1, v0);                                                                                                                                                       \
+    const lm2_v3_##S e2 = lm2_v3_sub_##S(v2, v0);                                                                                                                                                       \
+    uint32_t mask = 0;                                                                                                                                                                                  \
+    _LM2_RAY3_PACKET_LANES_##N(S, _LM2_RAY3_PACKET_TRIANGLE_BODY)                                                                                                                                       \
+    mask &= active;                                                                                                                                                                                     \
+    if (hits != NULL && mask != 0) {                                                                                                                                                                    \
+      const lm2_v3_##S normal = lm2_v3_norm_##S(lm2_v3_cross_##S(e1, e2));                                                                                                                              \
+      for (uint32_t k = 0; k < N; k++) {                                                                                                                                                                \
+        if (mask & (1u << k)) {                                                                                                                                                                         \
+          hits->t[k] = hit_t[k];                                                                                                                                                                        \
+          hits->normal_x[k] = normal.x;                                                                                                                                                                 \
+          hits->normal_y[k] = normal.y;                                                                                                                                                                 \
+          hits->normal_z[k] = normal.z;                                                                                                                                                                 \
+        }                                                                                                                                                                                               \
+      }                                                                                                                                                                                                 \
+      hits->hit_mask |= mask;                                                                                                                                                                           \
+    }                                                                                                                                                                                                   \
+    return mask;                                                                                                                                                                                        \
+  }
+
+_LM2_IMPL_RAY3_PACKET_CAST(4, f64, double, LM2_RAYCAST3_EPSILON_F64)
+_LM2_IMPL_RAY3_PACKET_CAST(8, f64, double, LM2_RAYCAST3_EPSILON_F64)
+_LM2_IMPL_RAY3_PACKET_CAST(4, f32, float, LM2_RAYCAST3_EPSILON_F32)
+_LM2_IMPL_RAY3_PACKET_CAST(8, f32, float, LM2_RAYCAST3_EPSILON_F32)
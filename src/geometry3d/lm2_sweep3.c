@@ -0,0 +1,632 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <lm2/geometry3d/lm2_manifold3.h>
+#include <lm2/geometry3d/lm2_sweep3.h>
+#include <math.h>
+
+// Inverse direction used for axis-parallel sweeps, keeps the slab test NaN-free
+#define _LM2_SWEEP3_HUGE_f64 1e300
+#define _LM2_SWEEP3_HUGE_f32 1e30f
+
+// Relative slack on the slab exit distance, so rounding cannot cull a box the
+// triangle test would still hit
+#define _LM2_SWEEP3_SLAB_SLACK_f64 (1.0 + 4.0 * 2.220446049250313e-16)
+#define _LM2_SWEEP3_SLAB_SLACK_f32 (1.0f + 4.0f * 1.1920929e-7f)
+
+// =============================================================================
+// Helpers
+// =============================================================================
+// The sweeps are the hottest queries of a character controller, so like the
+// BVH traversal they use plain arithmetic instead of the vector functions.
+
+#define _LM2_IMPL_SWEEP3_HELPERS(scalar_type, S, sqrt_fn)                                                                                     \
+  static inline lm2_v3_##S _lm2_sweep3_sub_##S(lm2_v3_##S a, lm2_v3_##S b) {                                                                  \
+    lm2_v3_##S r = {a.x - b.x, a.y - b.y, a.z - b.z};                                                                                         \
+    return r;                                                                                                                                 \
+  }                                                                                                                                           \
+  /* a + b * s */                                                                                                                             \
+  static inline lm2_v3_##S _lm2_sweep3_madd_##S(lm2_v3_##S a, lm2_v3_##S b, scalar_type s) {                                                  \
+    lm2_v3_##S r = {a.x + b.x * s, a.y + b.y * s, a.z + b.z * s};                                                                             \
+    return r;                                                                                                                                 \
+  }                                                                                                                                           \
+  static inline lm2_v3_##S _lm2_sweep3_cross_##S(lm2_v3_##S a, lm2_v3_##S b) {                                                                \
+    lm2_v3_##S r = {a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x};                                                     \
+    return r;                                                                                                                                 \
+  }                                                                                                                                           \
+  static inline scalar_type _lm2_sweep3_dot_##S(lm2_v3_##S a, lm2_v3_##S b) {                                                                 \
+    return a.x * b.x + a.y * b.y + a.z * b.z;                                                                                                 \
+  }                                                                                                                                           \
+  /* Unit vector along v, or fallback when v is zero */                                                                                       \
+  static inline lm2_v3_##S _lm2_sweep3_normalize_##S(lm2_v3_##S v, lm2_v3_##S fallback) {                                                     \
+    scalar_type len_sq = _lm2_sweep3_dot_##S(v, v);                                                                                           \
+    if (!(len_sq > 0)) {                                                                                                                      \
+      return fallback;                                                                                                                        \
+    }                                                                                                                                         \
+    scalar_type inv = 1 / sqrt_fn(len_sq);                                                                                                    \
+    lm2_v3_##S r = {v.x * inv, v.y * inv, v.z * inv};                                                                                         \
+    return r;                                                                                                                                 \
+  }                                                                                                                                           \
+                                                                                                                                              \
+  /* Point o moving by d against a sphere. Returns the entry t in [0, 1], or                                                                  \
+     INFINITY on a miss or when o starts inside */                                                                                            \
+  static inline scalar_type _lm2_sweep3_ray_sphere_##S(lm2_v3_##S o, lm2_v3_##S d, lm2_v3_##S center, scalar_type r) {                        \
+    lm2_v3_##S m = _lm2_sweep3_sub_##S(o, center);                                                                                            \
+    scalar_type b = _lm2_sweep3_dot_##S(m, d);                                                                                                \
+    scalar_type c = _lm2_sweep3_dot_##S(m, m) - r * r;                                                                                        \
+    if (c <= 0 || b >= 0) {                                                                                                                   \
+      return (scalar_type)INFINITY;                                                                                                           \
+    }                                                                                                                                         \
+    scalar_type a = _lm2_sweep3_dot_##S(d, d);                                                                                                \
+    scalar_type disc = b * b - a * c;                                                                                                         \
+    if (disc < 0) {                                                                                                                           \
+      return (scalar_type)INFINITY;                                                                                                           \
+    }                                                                                                                                         \
+    scalar_type t = (-b - sqrt_fn(disc)) / a;                                                                                                 \
+    return t <= 1 ? t : (scalar_type)INFINITY;                                                                                                \
+  }                                                                                                                                           \
+                                                                                                                                              \
+  /* Point o moving by d against the side of the cylinder of radius r around                                                                  \
+     segment ab (Ericson 5.3.7). The end caps are the spheres of the caller.                                                                  \
+     Returns the entry t in [0, 1] and the axis parameter s of the contact */                                                                 \
+  static inline scalar_type _lm2_sweep3_ray_cylinder_##S(lm2_v3_##S o, lm2_v3_##S d, lm2_v3_##S a, lm2_v3_##S b, scalar_type r,               \
+                                                        scalar_type* out_s) {                                                                 \
+    lm2_v3_##S e = _lm2_sweep3_sub_##S(b, a);                                                                                                 \
+    lm2_v3_##S m = _lm2_sweep3_sub_##S(o, a);                                                                                                 \
+    scalar_type ee = _lm2_sweep3_dot_##S(e, e);                                                                                               \
+    scalar_type md = _lm2_sweep3_dot_##S(m, e);                                                                                               \
+    scalar_type dd = _lm2_sweep3_dot_##S(d, e);                                                                                               \
+    scalar_type qa = ee * _lm2_sweep3_dot_##S(d, d) - dd * dd;                                                                                \
+    scalar_type qb = ee * _lm2_sweep3_dot_##S(m, d) - md * dd;                                                                                \
+    scalar_type qc = ee * (_lm2_sweep3_dot_##S(m, m) - r * r) - md * md;                                                                      \
+    if (!(ee > 0) || qc <= 0 || qb >= 0 || !(qa > 0)) {                                                                                       \
+      return (scalar_type)INFINITY;                                                                                                           \
+    }                                                                                                                                         \
+    scalar_type disc = qb * qb - qa * qc;                                                                                                     \
+    if (disc < 0) {                                                                                                                           \
+      return (scalar_type)INFINITY;                                                                                                           \
+    }                                                                                                                                         \
+    scalar_type t = (-qb - sqrt_fn(disc)) / qa;                                                                                               \
+    if (t > 1) {                                                                                                                              \
+      return (scalar_type)INFINITY;                                                                                                           \
+    }                                                                                                                                         \
+    scalar_type s = (md + t * dd) / ee;                                                                                                       \
+    if (s < 0 || s > 1) {                                                                                                                     \
+      return (scalar_type)INFINITY;                                                                                                           \
+    }                                                                                                                                         \
+    *out_s = s;                                                                                                                               \
+    return t;                                                                                                                                 \
+  }                                                                                                                                           \
+                                                                                                                                              \
+  /* Segment p0 p1 moving by d against the fixed segment q0 q1, contact in the                                                                \
+     interior of both. The distance between the two lines changes linearly                                                                    \
+     along their common normal, so the contact time is one division */                                                                        \
+  static inline scalar_type _lm2_sweep3_segments_##S(lm2_v3_##S p0, lm2_v3_##S p1, lm2_v3_##S d, lm2_v3_##S q0, lm2_v3_##S q1, scalar_type r, \
+                                                    scalar_type eps, lm2_v3_##S* out_normal, scalar_type* out_u) {                            \
+    lm2_v3_##S dp = _lm2_sweep3_sub_##S(p1, p0);                                                                                              \
+    lm2_v3_##S dq = _lm2_sweep3_sub_##S(q1, q0);                                                                                              \
+    lm2_v3_##S nn = _lm2_sweep3_cross_##S(dp, dq);                                                                                            \
+    scalar_type a = _lm2_sweep3_dot_##S(dp, dp);                                                                                              \
+    scalar_type b = _lm2_sweep3_dot_##S(dp, dq);                                                                                              \
+    scalar_type c = _lm2_sweep3_dot_##S(dq, dq);                                                                                              \
+    scalar_type denom = _lm2_sweep3_dot_##S(nn, nn);                                                                                          \
+    if (!(denom > eps * a * c)) {                                                                                                             \
+      return (scalar_type)INFINITY;                                                                                                           \
+    }                                                                                                                                         \
+    scalar_type inv_len = 1 / sqrt_fn(denom);                                                                                                 \
+    lm2_v3_##S n = {nn.x * inv_len, nn.y * inv_len, nn.z * inv_len};                                                                          \
+    scalar_type dist0 = _lm2_sweep3_dot_##S(_lm2_sweep3_sub_##S(p0, q0), n);                                                                  \
+    if (dist0 < 0) {                                                                                                                          \
+      n.x = -n.x, n.y = -n.y, n.z = -n.z;                                                                                                     \
+      dist0 = -dist0;                                                                                                                         \
+    }                                                                                                                                         \
+    scalar_type rate = _lm2_sweep3_dot_##S(d, n);                                                                                             \
+    if (!(rate < 0) || dist0 < r) {                                                                                                           \
+      return (scalar_type)INFINITY;                                                                                                           \
+    }                                                                                                                                         \
+    scalar_type t = (dist0 - r) / -rate;                                                                                                      \
+    if (t > 1) {                                                                                                                              \
+      return (scalar_type)INFINITY;                                                                                                           \
+    }                                                                                                                                         \
+    lm2_v3_##S w = _lm2_sweep3_sub_##S(_lm2_sweep3_madd_##S(p0, d, t), q0);                                                                   \
+    scalar_type e1 = _lm2_sweep3_dot_##S(dp, w);                                                                                              \
+    scalar_type e2 = _lm2_sweep3_dot_##S(dq, w);                                                                                              \
+    scalar_type s = (b * e2 - c * e1) / denom;                                                                                                \
+    scalar_type u = (a * e2 - b * e1) / denom;                                                                                                \
+    if (s < 0 || s > 1 || u < 0 || u > 1) {                                                                                                   \
+      return (scalar_type)INFINITY;                                                                                                           \
+    }                                                                                                                                         \
+    *out_normal = n;                                                                                                                          \
+    *out_u = u;                                                                                                                               \
+    return t;                                                                                                                                 \
+  }                                                                                                                                           \
+                                                                                                                                              \
+  static inline void _lm2_sweep3_record_##S(lm2_sweep3_hit_##S* hit, scalar_type t, lm2_v3_##S point, lm2_v3_##S normal,                      \
+                                            lm2_sweep3_feature feature, uint32_t feature_index) {                                             \
+    hit->hit = true;                                                                                                                          \
+    hit->t = t;                                                                                                                               \
+    hit->point = point;                                                                                                                       \
+    hit->normal = normal;                                                                                                                     \
+    hit->feature = feature;                                                                                                                   \
+    hit->feature_index = feature_index;                                                                                                       \
+  }                                                                                                                                           \
+                                                                                                                                              \
+  /* Feature of the triangle closest to point p on it, from its barycentric coordinates */                                                    \
+  static void _lm2_sweep3_classify_##S(lm2_v3_##S p, const lm2_v3_##S* v, lm2_v3_##S nn, scalar_type eps, lm2_sweep3_hit_##S* hit) {          \
+    scalar_type nn_sq = _lm2_sweep3_dot_##S(nn, nn);                                                                                          \
+    hit->feature = LM2_SWEEP3_FEATURE_FACE;                                                                                                   \
+    hit->feature_index = 0;                                                                                                                   \
+    if (!(nn_sq > 0)) {                                                                                                                       \
+      return;                                                                                                                                 \
+    }                                                                                                                                         \
+    scalar_type w[3];                                                                                                                         \
+    for (int k = 0; k < 3; k++) {                                                                                                             \
+      lm2_v3_##S a = v[(k + 1) % 3];                                                                                                          \
+      lm2_v3_##S b = v[(k + 2) % 3];                                                                                                          \
+      w[k] = _lm2_sweep3_dot_##S(_lm2_sweep3_cross_##S(_lm2_sweep3_sub_##S(b, a), _lm2_sweep3_sub_##S(p, a)), nn) / nn_sq;                    \
+    }                                                                                                                                         \
+    int small = 0;                                                                                                                            \
+    int last_small = 0;                                                                                                                       \
+    int last_large = 0;                                                                                                                       \
+    for (int k = 0; k < 3; k++) {                                                                                                             \
+      if (w[k] < eps) {                                                                                                                       \
+        small++;                                                                                                                              \
+        last_small = k;                                                                                                                       \
+      } else {                                                                                                                                \
+        last_large = k;                                                                                                                       \
+      }                                                                                                                                       \
+    }                                                                                                                                         \
+    if (small >= 2) {                                                                                                                         \
+      hit->feature = LM2_SWEEP3_FEATURE_VERTEX;                                                                                               \
+      hit->feature_index = (uint32_t)last_large;                                                                                              \
+    } else if (small == 1) {                                                                                                                  \
+      /* The edge opposite vertex k is v[k + 1] v[k + 2] */                                                                                   \
+      hit->feature = LM2_SWEEP3_FEATURE_EDGE;                                                                                                 \
+      hit->feature_index = (uint32_t)((last_small + 1) % 3);                                                                                  \
+    }                                                                                                                                         \
+  }
+
+// =============================================================================
+// Triangle Sweeps
+// =============================================================================
+// The moving shape is a segment p0 p1 grown by radius r (p0 == p1 for a
+// sphere). Its first contact with a triangle is the earliest of:
+//   - each end sphere against the face plane, the edge cylinders and the
+//     vertex spheres of the triangle
+//   - the axis against each triangle edge
+//   - each triangle vertex, moving by -delta, against the axis cylinder
+// Every test only reports contacts earlier than the best hit so far, so a
+// mesh query keeps narrowing its window.
+
+#define _LM2_IMPL_SWEEP3_TRIANGLE(scalar_type, S, eps)                                                                                 \
+  /* Sphere of radius r at c against the face, edges and vertices */                                                                   \
+  static void _lm2_sweep3_sphere_features_##S(lm2_v3_##S c, scalar_type r, lm2_v3_##S d, const lm2_v3_##S* v, lm2_v3_##S n, bool flat, \
+                                              lm2_sweep3_hit_##S* hit) {                                                               \
+    if (!flat) {                                                                                                                       \
+      lm2_v3_##S side = n;                                                                                                             \
+      scalar_type dist0 = _lm2_sweep3_dot_##S(_lm2_sweep3_sub_##S(c, v[0]), n);                                                        \
+      if (dist0 < 0) {                                                                                                                 \
+        side.x = -n.x, side.y = -n.y, side.z = -n.z;                                                                                   \
+        dist0 = -dist0;                                                                                                                \
+      }                                                                                                                                \
+      scalar_type rate = _lm2_sweep3_dot_##S(d, side);                                                                                 \
+      if (rate < 0 && dist0 >= r) {                                                                                                    \
+        scalar_type t = (dist0 - r) / -rate;                                                                                           \
+        if (t < hit->t && t <= 1) {                                                                                                    \
+          lm2_v3_##S p = _lm2_sweep3_madd_##S(_lm2_sweep3_madd_##S(c, d, t), side, -r);                                                \
+          bool inside = true;                                                                                                          \
+          for (int k = 0; k < 3 && inside; k++) {                                                                                      \
+            lm2_v3_##S e = _lm2_sweep3_sub_##S(v[(k + 1) % 3], v[k]);                                                                  \
+            inside = _lm2_sweep3_dot_##S(_lm2_sweep3_cross_##S(e, _lm2_sweep3_sub_##S(p, v[k])), n) >= 0;                              \
+          }                                                                                                                            \
+          if (inside) {                                                                                                                \
+            _lm2_sweep3_record_##S(hit, t, p, side, LM2_SWEEP3_FEATURE_FACE, 0);                                                       \
+          }                                                                                                                            \
+        }                                                                                                                              \
+      }                                                                                                                                \
+    }                                                                                                                                  \
+    for (int k = 0; k < 3; k++) {                                                                                                      \
+      scalar_type s = 0;                                                                                                               \
+      scalar_type t = _lm2_sweep3_ray_cylinder_##S(c, d, v[k], v[(k + 1) % 3], r, &s);                                                 \
+      if (t < hit->t) {                                                                                                                \
+        lm2_v3_##S q = _lm2_sweep3_madd_##S(v[k], _lm2_sweep3_sub_##S(v[(k + 1) % 3], v[k]), s);                                       \
+        lm2_v3_##S normal = _lm2_sweep3_normalize_##S(_lm2_sweep3_sub_##S(_lm2_sweep3_madd_##S(c, d, t), q), n);                       \
+        _lm2_sweep3_record_##S(hit, t, q, normal, LM2_SWEEP3_FEATURE_EDGE, (uint32_t)k);                                               \
+      }                                                                                                                                \
+    }                                                                                                                                  \
+    for (int k = 0; k < 3; k++) {                                                                                                      \
+      scalar_type t = _lm2_sweep3_ray_sphere_##S(c, d, v[k], r);                                                                       \
+      if (t < hit->t) {                                                                                                                \
+        lm2_v3_##S normal = _lm2_sweep3_normalize_##S(_lm2_sweep3_sub_##S(_lm2_sweep3_madd_##S(c, d, t), v[k]), n);                    \
+        _lm2_sweep3_record_##S(hit, t, v[k], normal, LM2_SWEEP3_FEATURE_VERTEX, (uint32_t)k);                                          \
+      }                                                                                                                                \
+    }                                                                                                                                  \
+  }                                                                                                                                    \
+                                                                                                                                       \
+  /* Returns true when the shape starts overlapping the triangle. It then                                                              \
+     either hits at t = 0 (moving in) or never hits it (moving out) */                                                                 \
+  static bool _lm2_sweep3_initial_##S(lm2_v3_##S p0, lm2_v3_##S p1, scalar_type r, lm2_v3_##S d, const lm2_v3_##S* v, lm2_v3_##S nn,   \
+                                      lm2_v3_##S n, bool flat, lm2_sweep3_hit_##S* hit) {                                              \
+    if (!flat) {                                                                                                                       \
+      scalar_type d0 = _lm2_sweep3_dot_##S(_lm2_sweep3_sub_##S(p0, v[0]), n);                                                          \
+      scalar_type d1 = _lm2_sweep3_dot_##S(_lm2_sweep3_sub_##S(p1, v[0]), n);                                                          \
+      if ((d0 > r && d1 > r) || (d0 < -r && d1 < -r)) {                                                                                \
+        return false;                                                                                                                  \
+      }                                                                                                                                \
+    }                                                                                                                                  \
+    lm2_v3_##S tri[3] = {v[0], v[1], v[2]};                                                                                            \
+    lm2_manifold3_##S m;                                                                                                               \
+    if (p0.x == p1.x && p0.y == p1.y && p0.z == p1.z) {                                                                                \
+      lm2_sphere_##S sphere = {p0, r};                                                                                                 \
+      lm2_manifold3_sphere_to_triangle_##S(sphere, tri, &m);                                                                           \
+    } else {                                                                                                                           \
+      lm2_capsule3_##S capsule = {p0, p1, r};                                                                                          \
+      lm2_manifold3_capsule_to_triangle_##S(capsule, tri, &m);                                                                         \
+    }                                                                                                                                  \
+    if (m.count <= 0) {                                                                                                                \
+      return false;                                                                                                                    \
+    }                                                                                                                                  \
+    lm2_v3_##S normal = {-m.normal.x, -m.normal.y, -m.normal.z};                                                                       \
+    scalar_type into = _lm2_sweep3_dot_##S(d, normal);                                                                                 \
+    if (into < -eps * sqrt(_lm2_sweep3_dot_##S(d, d))) {                                                                               \
+      _lm2_sweep3_record_##S(hit, 0, m.contact_points[0], normal, LM2_SWEEP3_FEATURE_FACE, 0);                                         \
+      _lm2_sweep3_classify_##S(m.contact_points[0], v, nn, (scalar_type)1e-4, hit);                                                    \
+    }                                                                                                                                  \
+    return true;                                                                                                                       \
+  }                                                                                                                                    \
+                                                                                                                                       \
+  /* Sweeps the shape against one triangle, keeping hit when it is earlier */                                                          \
+  static void _lm2_sweep3_triangle_##S(lm2_v3_##S p0, lm2_v3_##S p1, scalar_type r, lm2_v3_##S d, lm2_v3_##S v0, lm2_v3_##S v1,        \
+                                       lm2_v3_##S v2, lm2_sweep3_hit_##S* hit) {                                                       \
+    const lm2_v3_##S v[3] = {v0, v1, v2};                                                                                              \
+    lm2_v3_##S nn = _lm2_sweep3_cross_##S(_lm2_sweep3_sub_##S(v1, v0), _lm2_sweep3_sub_##S(v2, v0));                                   \
+    lm2_v3_##S zero = {0, 0, 0};                                                                                                       \
+    lm2_v3_##S n = _lm2_sweep3_normalize_##S(nn, zero);                                                                                \
+    bool flat = n.x == 0 && n.y == 0 && n.z == 0;                                                                                      \
+    if (hit->t > 0 && _lm2_sweep3_initial_##S(p0, p1, r, d, v, nn, n, flat, hit)) {                                                    \
+      return;                                                                                                                          \
+    }                                                                                                                                  \
+    _lm2_sweep3_sphere_features_##S(p0, r, d, v, n, flat, hit);                                                                        \
+    if (p0.x == p1.x && p0.y == p1.y && p0.z == p1.z) {                                                                                \
+      return;                                                                                                                          \
+    }                                                                                                                                  \
+    _lm2_sweep3_sphere_features_##S(p1, r, d, v, n, flat, hit);                                                                        \
+    for (int k = 0; k < 3; k++) {                                                                                                      \
+      lm2_v3_##S normal = {0, 0, 0};                                                                                                   \
+      scalar_type u = 0;                                                                                                               \
+      scalar_type t = _lm2_sweep3_segments_##S(p0, p1, d, v[k], v[(k + 1) % 3], r, eps, &normal, &u);                                  \
+      if (t < hit->t) {                                                                                                                \
+        lm2_v3_##S q = _lm2_sweep3_madd_##S(v[k], _lm2_sweep3_sub_##S(v[(k + 1) % 3], v[k]), u);                                       \
+        _lm2_sweep3_record_##S(hit, t, q, normal, LM2_SWEEP3_FEATURE_EDGE, (uint32_t)k);                                               \
+      }                                                                                                                                \
+    }                                                                                                                                  \
+    lm2_v3_##S back = {-d.x, -d.y, -d.z};                                                                                              \
+    for (int k = 0; k < 3; k++) {                                                                                                      \
+      scalar_type s = 0;                                                                                                               \
+      scalar_type t = _lm2_sweep3_ray_cylinder_##S(v[k], back, p0, p1, r, &s);                                                         \
+      if (t < hit->t) {                                                                                                                \
+        lm2_v3_##S axis = _lm2_sweep3_madd_##S(_lm2_sweep3_madd_##S(p0, d, t), _lm2_sweep3_sub_##S(p1, p0), s);                        \
+        lm2_v3_##S normal = _lm2_sweep3_normalize_##S(_lm2_sweep3_sub_##S(axis, v[k]), n);                                             \
+        _lm2_sweep3_record_##S(hit, t, v[k], normal, LM2_SWEEP3_FEATURE_VERTEX, (uint32_t)k);                                          \
+      }                                                                                                                                \
+    }                                                                                                                                  \
+  }                                                                                                                                    \
+                                                                                                                                       \
+  /* Empty result with a search window past the end of the sweep */                                                                    \
+  static inline lm2_sweep3_hit_##S _lm2_sweep3_begin_##S(void) {                                                                       \
+    lm2_sweep3_hit_##S hit;                                                                                                            \
+    hit.hit = false;                                                                                                                   \
+    hit.t = 2;                                                                                                                         \
+    hit.point = (lm2_v3_##S) {0, 0, 0};                                                                                                \
+    hit.normal = (lm2_v3_##S) {0, 0, 0};                                                                                               \
+    hit.triangle_index = 0;                                                                                                            \
+    hit.feature = LM2_SWEEP3_FEATURE_FACE;                                                                                             \
+    hit.feature_index = 0;                                                                                                             \
+    return hit;                                                                                                                        \
+  }                                                                                                                                    \
+                                                                                                                                       \
+  static inline lm2_sweep3_hit_##S _lm2_sweep3_end_##S(lm2_sweep3_hit_##S hit) {                                                       \
+    if (!hit.hit) {                                                                                                                    \
+      hit.t = 1;                                                                                                                       \
+    }                                                                                                                                  \
+    return hit;                                                                                                                        \
+  }
+
+// =============================================================================
+// Mesh Sweeps
+// =============================================================================
+// The lists test the triangles whose bounds touch the swept bounds. The BVH
+// traversal is the ordered one of the ray queries, run from the center of the
+// shape bounds with every node grown by their half extents.
+
+#define _LM2_IMPL_SWEEP3_MESH(scalar_type, S)                                                                                           \
+  typedef struct _lm2_sweep3_shape_##S {                                                                                                \
+    lm2_v3_##S p0, p1;                                                                                                                  \
+    scalar_type r;                                                                                                                      \
+    lm2_r3_##S swept;  /* Bounds of the shape over the whole sweep */                                                                   \
+  } _lm2_sweep3_shape_##S;                                                                                                              \
+                                                                                                                                        \
+  static _lm2_sweep3_shape_##S _lm2_sweep3_make_shape_##S(lm2_v3_##S p0, lm2_v3_##S p1, scalar_type r, lm2_v3_##S d) {                  \
+    _lm2_sweep3_shape_##S shape;                                                                                                        \
+    shape.p0 = p0;                                                                                                                      \
+    shape.p1 = p1;                                                                                                                      \
+    shape.r = r;                                                                                                                        \
+    for (int k = 0; k < 3; k++) {                                                                                                       \
+      scalar_type lo = p0.e[k] < p1.e[k] ? p0.e[k] : p1.e[k];                                                                           \
+      scalar_type hi = p0.e[k] < p1.e[k] ? p1.e[k] : p0.e[k];                                                                           \
+      shape.swept.min.e[k] = (d.e[k] < 0 ? lo + d.e[k] : lo) - r;                                                                       \
+      shape.swept.max.e[k] = (d.e[k] > 0 ? hi + d.e[k] : hi) + r;                                                                       \
+    }                                                                                                                                   \
+    return shape;                                                                                                                       \
+  }                                                                                                                                     \
+                                                                                                                                        \
+  static inline bool _lm2_sweep3_touches_##S(const lm2_r3_##S* b, lm2_v3_##S v0, lm2_v3_##S v1, lm2_v3_##S v2) {                        \
+    for (int k = 0; k < 3; k++) {                                                                                                       \
+      scalar_type lo = v0.e[k] < v1.e[k] ? v0.e[k] : v1.e[k];                                                                           \
+      scalar_type hi = v0.e[k] < v1.e[k] ? v1.e[k] : v0.e[k];                                                                           \
+      lo = v2.e[k] < lo ? v2.e[k] : lo;                                                                                                 \
+      hi = v2.e[k] > hi ? v2.e[k] : hi;                                                                                                 \
+      if (hi < b->min.e[k] || lo > b->max.e[k]) {                                                                                       \
+        return false;                                                                                                                   \
+      }                                                                                                                                 \
+    }                                                                                                                                   \
+    return true;                                                                                                                        \
+  }                                                                                                                                     \
+                                                                                                                                        \
+  static void _lm2_sweep3_candidate_##S(const _lm2_sweep3_shape_##S* shape, lm2_v3_##S d, lm2_v3_##S v0, lm2_v3_##S v1, lm2_v3_##S v2,  \
+                                        uint32_t index, lm2_sweep3_hit_##S* hit) {                                                      \
+    if (!_lm2_sweep3_touches_##S(&shape->swept, v0, v1, v2)) {                                                                          \
+      return;                                                                                                                           \
+    }                                                                                                                                   \
+    scalar_type before = hit->t;                                                                                                        \
+    _lm2_sweep3_triangle_##S(shape->p0, shape->p1, shape->r, d, v0, v1, v2, hit);                                                       \
+    if (hit->t < before) {                                                                                                              \
+      hit->triangle_index = index;                                                                                                      \
+    }                                                                                                                                   \
+  }                                                                                                                                     \
+                                                                                                                                        \
+  static lm2_sweep3_hit_##S _lm2_sweep3_triangles_##S(_lm2_sweep3_shape_##S shape, lm2_v3_##S d, const lm2_triangle3_##S* triangles,    \
+                                                      size_t triangle_count) {                                                          \
+    LM2_ASSERT(triangle_count == 0 || triangles != NULL);                                                                               \
+    lm2_sweep3_hit_##S hit = _lm2_sweep3_begin_##S();                                                                                   \
+    for (size_t i = 0; i < triangle_count && hit.t > 0; i++) {                                                                          \
+      _lm2_sweep3_candidate_##S(&shape, d, triangles[i][0], triangles[i][1], triangles[i][2], (uint32_t)i, &hit);                       \
+    }                                                                                                                                   \
+    return _lm2_sweep3_end_##S(hit);                                                                                                    \
+  }                                                                                                                                     \
+                                                                                                                                        \
+  static lm2_sweep3_hit_##S _lm2_sweep3_indexed_##S(_lm2_sweep3_shape_##S shape, lm2_v3_##S d, const lm2_v3_##S* vertices,              \
+                                                    const uint32_t* indices, size_t index_count) {                                      \
+    LM2_ASSERT(index_count == 0 || (vertices != NULL && indices != NULL));                                                              \
+    LM2_ASSERT(index_count % 3 == 0);                                                                                                   \
+    lm2_sweep3_hit_##S hit = _lm2_sweep3_begin_##S();                                                                                   \
+    for (size_t i = 0; i + 2 < index_count && hit.t > 0; i += 3) {                                                                      \
+      _lm2_sweep3_candidate_##S(&shape, d, vertices[indices[i]], vertices[indices[i + 1]], vertices[indices[i + 2]], (uint32_t)(i / 3), \
+                                &hit);                                                                                                  \
+    }                                                                                                                                   \
+    return _lm2_sweep3_end_##S(hit);                                                                                                    \
+  }                                                                                                                                     \
+                                                                                                                                        \
+  /* Slab test of the center ray against a node grown by the half extents h.                                                            \
+     Returns the entry t, or INFINITY on a miss */                                                                                      \
+  static inline scalar_type _lm2_sweep3_slab_##S(const lm2_r3_##S* b, lm2_v3_##S h, lm2_v3_##S origin, lm2_v3_##S inv_dir,              \
+                                                 scalar_type t_max) {                                                                   \
+    scalar_type t_near = 0;                                                                                                             \
+    scalar_type t_far = t_max;                                                                                                          \
+    for (int k = 0; k < 3; k++) {                                                                                                       \
+      scalar_type t0 = (b->min.e[k] - h.e[k] - origin.e[k]) * inv_dir.e[k];                                                             \
+      scalar_type t1 = (b->max.e[k] + h.e[k] - origin.e[k]) * inv_dir.e[k];                                                             \
+      t_near = (t0 < t1 ? t0 : t1) > t_near ? (t0 < t1 ? t0 : t1) : t_near;                                                             \
+      t_far = (t0 < t1 ? t1 : t0) < t_far ? (t0 < t1 ? t1 : t0) : t_far;                                                                \
+    }                                                                                                                                   \
+    return t_near <= t_far * _LM2_SWEEP3_SLAB_SLACK_##S ? t_near : (scalar_type)INFINITY;                                               \
+  }                                                                                                                                     \
+                                                                                                                                        \
+  static lm2_sweep3_hit_##S _lm2_sweep3_bvh_##S(const lm2_bvh3_##S* bvh, _lm2_sweep3_shape_##S shape, lm2_v3_##S d) {                   \
+    LM2_ASSERT(bvh != NULL);                                                                                                            \
+    lm2_sweep3_hit_##S hit = _lm2_sweep3_begin_##S();                                                                                   \
+    if (bvh->node_count == 0) {                                                                                                         \
+      return _lm2_sweep3_end_##S(hit);                                                                                                  \
+    }                                                                                                                                   \
+    lm2_v3_##S origin, h, inv_dir;                                                                                                      \
+    for (int k = 0; k < 3; k++) {                                                                                                       \
+      scalar_type lo = shape.p0.e[k] < shape.p1.e[k] ? shape.p0.e[k] : shape.p1.e[k];                                                   \
+      scalar_type hi = shape.p0.e[k] < shape.p1.e[k] ? shape.p1.e[k] : shape.p0.e[k];                                                   \
+      origin.e[k] = (lo + hi) / 2;                                                                                                      \
+      h.e[k] = (hi - lo) / 2 + shape.r;                                                                                                 \
+      inv_dir.e[k] = d.e[k] != 0 ? 1 / d.e[k] : _LM2_SWEEP3_HUGE_##S;                                                                   \
+    }                                                                                                                                   \
+                                                                                                                                        \
+    const lm2_bvh3_node_##S* nodes = bvh->nodes;                                                                                        \
+    uint32_t stack[LM2_BVH3_MAX_DEPTH];                                                                                                 \
+    scalar_type stack_t[LM2_BVH3_MAX_DEPTH];                                                                                            \
+    uint32_t top = 0;                                                                                                                   \
+    uint32_t node_index = 0;                                                                                                            \
+    bool visit = _lm2_sweep3_slab_##S(&nodes[0].bounds, h, origin, inv_dir, 1) != (scalar_type)INFINITY;                                \
+    while (visit) {                                                                                                                     \
+      const lm2_bvh3_node_##S* node = &nodes[node_index];                                                                               \
+      if (node->count > 0) {                                                                                                            \
+        for (uint32_t i = node->first; i < node->first + node->count; i++) {                                                            \
+          uint32_t tri = bvh->primitive_indices[i];                                                                                     \
+          if (bvh->triangles != NULL) {                                                                                                 \
+            _lm2_sweep3_candidate_##S(&shape, d, bvh->triangles[tri][0], bvh->triangles[tri][1], bvh->triangles[tri][2], tri, &hit);    \
+          } else {                                                                                                                      \
+            const uint32_t* idx = &bvh->indices[3 * (size_t)tri];                                                                       \
+            _lm2_sweep3_candidate_##S(&shape, d, bvh->vertices[idx[0]], bvh->vertices[idx[1]], bvh->vertices[idx[2]], tri, &hit);       \
+          }                                                                                                                             \
+        }                                                                                                                               \
+        if (hit.t == 0) {                                                                                                               \
+          break;                                                                                                                        \
+        }                                                                                                                               \
+      } else {                                                                                                                          \
+        scalar_type t_max = hit.t < 1 ? hit.t : 1;                                                                                      \
+        uint32_t near_index = node->first;                                                                                              \
+        uint32_t far_index = node->first + 1;                                                                                           \
+        scalar_type t_near = _lm2_sweep3_slab_##S(&nodes[near_index].bounds, h, origin, inv_dir, t_max);                                \
+        scalar_type t_far = _lm2_sweep3_slab_##S(&nodes[far_index].bounds, h, origin, inv_dir, t_max);                                  \
+        if (t_far < t_near) {                                                                                                           \
+          uint32_t tmp_index = near_index;                                                                                              \
+          near_index = far_index;                                                                                                       \
+          far_index = tmp_index;                                                                                                        \
+          scalar_type tmp_t = t_near;                                                                                                   \
+          t_near = t_far;                                                                                                               \
+          t_far = tmp_t;                                                                                                                \
+        }                                                                                                                               \
+        if (t_near != (scalar_type)INFINITY) {                                                                                          \
+          if (t_far != (scalar_type)INFINITY) {                                                                                         \
+            stack[top] = far_index;                                                                                                     \
+            stack_t[top] = t_far;                                                                                                       \
+            top++;                                                                                                                      \
+          }                                                                                                                             \
+          node_index = near_index;                                                                                                      \
+          continue;                                                                                                                     \
+        }                                                                                                                               \
+      }                                                                                                                                 \
+                                                                                                                                        \
+      /* Pop the next subtree that can still beat the best hit */                                                                       \
+      visit = false;                                                                                                                    \
+      while (top > 0) {                                                                                                                 \
+        top--;                                                                                                                          \
+        if (stack_t[top] <= hit.t) {                                                                                                    \
+          node_index = stack[top];                                                                                                      \
+          visit = true;                                                                                                                 \
+          break;                                                                                                                        \
+        }                                                                                                                               \
+      }                                                                                                                                 \
+    }                                                                                                                                   \
+    return _lm2_sweep3_end_##S(hit);                                                                                                    \
+  }
+
+// =============================================================================
+// Public API
+// =============================================================================
+
+#define _LM2_IMPL_SWEEP3_API(scalar_type, S, sqrt_fn)                                                                                         \
+  LM2_API lm2_sweep3_hit_##S lm2_sweep3_sphere_triangle_##S(lm2_sphere_##S sphere, lm2_v3_##S delta, lm2_v3_##S v0, lm2_v3_##S v1,            \
+                                                            lm2_v3_##S v2) {                                                                  \
+    lm2_sweep3_hit_##S hit = _lm2_sweep3_begin_##S();                                                                                         \
+    _lm2_sweep3_triangle_##S(sphere.center, sphere.center, sphere.radius, delta, v0, v1, v2, &hit);                                           \
+    return _lm2_sweep3_end_##S(hit);                                                                                                          \
+  }                                                                                                                                           \
+                                                                                                                                              \
+  LM2_API lm2_sweep3_hit_##S lm2_sweep3_capsule_triangle_##S(lm2_capsule3_##S capsule, lm2_v3_##S delta, lm2_v3_##S v0, lm2_v3_##S v1,        \
+                                                             lm2_v3_##S v2) {                                                                 \
+    lm2_sweep3_hit_##S hit = _lm2_sweep3_begin_##S();                                                                                         \
+    _lm2_sweep3_triangle_##S(capsule.start, capsule.end, capsule.radius, delta, v0, v1, v2, &hit);                                            \
+    return _lm2_sweep3_end_##S(hit);                                                                                                          \
+  }                                                                                                                                           \
+                                                                                                                                              \
+  LM2_API lm2_sweep3_hit_##S lm2_sweep3_sphere_triangles_##S(lm2_sphere_##S sphere, lm2_v3_##S delta, const lm2_triangle3_##S* triangles,     \
+                                                             size_t triangle_count) {                                                         \
+    _lm2_sweep3_shape_##S shape = _lm2_sweep3_make_shape_##S(sphere.center, sphere.center, sphere.radius, delta);                             \
+    return _lm2_sweep3_triangles_##S(shape, delta, triangles, triangle_count);                                                                \
+  }                                                                                                                                           \
+                                                                                                                                              \
+  LM2_API lm2_sweep3_hit_##S lm2_sweep3_capsule_triangles_##S(lm2_capsule3_##S capsule, lm2_v3_##S delta, const lm2_triangle3_##S* triangles, \
+                                                              size_t triangle_count) {                                                        \
+    _lm2_sweep3_shape_##S shape = _lm2_sweep3_make_shape_##S(capsule.start, capsule.end, capsule.radius, delta);                              \
+    return _lm2_sweep3_triangles_##S(shape, delta, triangles, triangle_count);                                                                \
+  }                                                                                                                                           \
+                                                                                                                                              \
+  LM2_API lm2_sweep3_hit_##S lm2_sweep3_sphere_indexed_##S(lm2_sphere_##S sphere, lm2_v3_##S delta, const lm2_v3_##S* vertices,               \
+                                                           const uint32_t* indices, size_t index_count) {                                     \
+    _lm2_sweep3_shape_##S shape = _lm2_sweep3_make_shape_##S(sphere.center, sphere.center, sphere.radius, delta);                             \
+    return _lm2_sweep3_indexed_##S(shape, delta, vertices, indices, index_count);                                                             \
+  }                                                                                                                                           \
+                                                                                                                                              \
+  LM2_API lm2_sweep3_hit_##S lm2_sweep3_capsule_indexed_##S(lm2_capsule3_##S capsule, lm2_v3_##S delta, const lm2_v3_##S* vertices,           \
+                                                            const uint32_t* indices, size_t index_count) {                                    \
+    _lm2_sweep3_shape_##S shape = _lm2_sweep3_make_shape_##S(capsule.start, capsule.end, capsule.radius, delta);                              \
+    return _lm2_sweep3_indexed_##S(shape, delta, vertices, indices, index_count);                                                             \
+  }                                                                                                                                           \
+                                                                                                                                              \
+  LM2_API lm2_sweep3_hit_##S lm2_sweep3_sphere_bvh_##S(const lm2_bvh3_##S* bvh, lm2_sphere_##S sphere, lm2_v3_##S delta) {                    \
+    return _lm2_sweep3_bvh_##S(bvh, _lm2_sweep3_make_shape_##S(sphere.center, sphere.center, sphere.radius, delta), delta);                   \
+  }                                                                                                                                           \
+                                                                                                                                              \
+  LM2_API lm2_sweep3_hit_##S lm2_sweep3_capsule_bvh_##S(const lm2_bvh3_##S* bvh, lm2_capsule3_##S capsule, lm2_v3_##S delta) {                \
+    return _lm2_sweep3_bvh_##S(bvh, _lm2_sweep3_make_shape_##S(capsule.start, capsule.end, capsule.radius, delta), delta);                    \
+  }                                                                                                                                           \
+                                                                                                                                              \
+  LM2_API lm2_v3_##S lm2_sweep3_slide_capsule_##S(const lm2_bvh3_##S* bvh, lm2_capsule3_##S capsule, lm2_v3_##S delta, scalar_type skin,      \
+                                                  int max_iterations, lm2_sweep3_hit_##S* out_hits, int* out_hit_count) {                     \
+    LM2_ASSERT(bvh != NULL);                                                                                                                  \
+    LM2_ASSERT(skin >= 0);                                                                                                                    \
+    lm2_v3_##S offset = {0, 0, 0};                                                                                                            \
+    lm2_v3_##S remaining = delta;                                                                                                             \
+    lm2_v3_##S previous_normal = {0, 0, 0};                                                                                                   \
+    int hit_count = 0;                                                                                                                        \
+    for (int iteration = 0; iteration < max_iterations; iteration++) {                                                                        \
+      scalar_type length = sqrt_fn(_lm2_sweep3_dot_##S(remaining, remaining));                                                                \
+      if (!(length > 0)) {                                                                                                                    \
+        break;                                                                                                                                \
+      }                                                                                                                                       \
+      lm2_v3_##S p0 = _lm2_sweep3_madd_##S(capsule.start, offset, 1);                                                                         \
+      lm2_v3_##S p1 = _lm2_sweep3_madd_##S(capsule.end, offset, 1);                                                                           \
+      lm2_sweep3_hit_##S hit = _lm2_sweep3_bvh_##S(bvh, _lm2_sweep3_make_shape_##S(p0, p1, capsule.radius, remaining), remaining);            \
+      if (!hit.hit) {                                                                                                                         \
+        offset = _lm2_sweep3_madd_##S(offset, remaining, 1);                                                                                  \
+        break;                                                                                                                                \
+      }                                                                                                                                       \
+      if (out_hits != NULL) {                                                                                                                 \
+        out_hits[hit_count] = hit;                                                                                                            \
+      }                                                                                                                                       \
+      hit_count++;                                                                                                                            \
+                                                                                                                                              \
+      /* Stop skin short of the contact, measured along the motion */                                                                         \
+      scalar_type travel = length * hit.t - skin;                                                                                             \
+      if (travel > 0) {                                                                                                                       \
+        offset = _lm2_sweep3_madd_##S(offset, remaining, travel / length);                                                                    \
+      }                                                                                                                                       \
+                                                                                                                                              \
+      /* Slide the rest along the contact plane, or along the crease with the previous one */                                                 \
+      lm2_v3_##S n = hit.normal;                                                                                                              \
+      remaining = _lm2_sweep3_madd_##S(remaining, remaining, -hit.t);                                                                         \
+      remaining = _lm2_sweep3_madd_##S(remaining, n, -_lm2_sweep3_dot_##S(remaining, n));                                                     \
+      if (hit_count > 1 && _lm2_sweep3_dot_##S(remaining, previous_normal) < 0) {                                                             \
+        lm2_v3_##S crease = _lm2_sweep3_cross_##S(previous_normal, n);                                                                        \
+        scalar_type crease_sq = _lm2_sweep3_dot_##S(crease, crease);                                                                          \
+        scalar_type along = crease_sq > 0 ? _lm2_sweep3_dot_##S(remaining, crease) / crease_sq : 0;                                           \
+        remaining.x = crease.x * along, remaining.y = crease.y * along, remaining.z = crease.z * along;                                       \
+      }                                                                                                                                       \
+      previous_normal = n;                                                                                                                    \
+    }                                                                                                                                         \
+    if (out_hit_count != NULL) {                                                                                                              \
+      *out_hit_count = hit_count;                                                                                                             \
+    }                                                                                                                                         \
+    return offset;                                                                                                                            \
+  }
+
+// =============================================================================
+// Instantiations
+// =============================================================================
+
+_LM2_IMPL_SWEEP3_HELPERS(double, f64, sqrt)
+_LM2_IMPL_SWEEP3_HELPERS(float, f32, sqrtf)
+_LM2_IMPL_SWEEP3_TRIANGLE(double, f64, 1e-10)
+_LM2_IMPL_SWEEP3_TRIANGLE(float, f32, 1e-5f)
+_LM2_IMPL_SWEEP3_MESH(double, f64)
+_LM2_IMPL_SWEEP3_MESH(float, f32)
+_LM2_IMPL_SWEEP3_API(double, f64, sqrt)
+_LM2_IMPL_SWEEP3_API(float, f32, sqrtf)
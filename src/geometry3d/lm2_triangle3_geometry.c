@@ -26,6 +26,8 @@ SOFTWARE.
 #include <lm2/scalar/lm2_safe_ops.h>
 #include <lm2/scalar/lm2_scalar.h>
 #include <string.h>  // For memcpy
+#include "../misc/lm2_scratch.h"
+#include "../misc/lm2_vertex_weld.h"
 
 // =============================================================================
 // Triangle List to Vertex Array Conversion
@@ -144,167 +146,200 @@ LM2_API void lm2_vertex_array_to_triangle3_list_f32(
 }
 
 // =============================================================================
-// Helper Functions for Vertex Deduplication
+// Triangle List to Indexed Mesh Conversion
 // =============================================================================
+// Vertices weld through the cell hash of ../misc/lm2_vertex_weld.h, so the
+// conversion runs in expected linear time. Unique vertices keep the order of
+// their first occurrence, and the parallel variants give the same result.
 
-static bool _lm2_vertices3_equal_f64(lm2_v3_f64 a, lm2_v3_f64 b, double epsilon) {
-  double dx = lm2_abs_f64(lm2_sub_f64(a.x, b.x));
-  double dy = lm2_abs_f64(lm2_sub_f64(a.y, b.y));
-  double dz = lm2_abs_f64(lm2_sub_f64(a.z, b.z));
-  return dx <= epsilon && dy <= epsilon && dz <= epsilon;
-}
+static lm2_indexed_mesh3_size _lm2_triangle3_list_to_indexed_mesh_size_f64(
+    const lm2_triangle3_f64* triangles,
+    size_t triangle_count,
+    double epsilon,
+    uint32_t thread_count,
+    lm2_arena* arena) {
+  LM2_ASSERT(triangles != NULL);
 
-static bool _lm2_vertices3_equal_f32(lm2_v3_f32 a, lm2_v3_f32 b, float epsilon) {
-  float dx = lm2_abs_f32(lm2_sub_f32(a.x, b.x));
-  float dy = lm2_abs_f32(lm2_sub_f32(a.y, b.y));
-  float dz = lm2_abs_f32(lm2_sub_f32(a.z, b.z));
-  return dx <= epsilon && dy <= epsilon && dz <= epsilon;
-}
+  lm2_indexed_mesh3_size result = {0, 0};
+  result.index_count = lm2_mul_u64(triangle_count, 3);
 
-static uint32_t _lm2_find_or_add_vertex3_f64(
-    lm2_v3_f64 vertex,
-    lm2_v3_f64* vertices,
-    uint32_t* vertex_count,
-    double epsilon) {
-  // Search for existing vertex
-  for (uint32_t i = 0; i < *vertex_count; i = lm2_add_u32(i, 1)) {
-    if (_lm2_vertices3_equal_f64(vertices[i], vertex, epsilon)) {
-      return i;
-    }
+  // Temporary buffers for the weld; without them report the worst case
+  size_t mark = lm2_scratch_begin(arena);
+  size_t buffer_size = result.index_count > 0 ? result.index_count : 1;
+  uint32_t* remap = (uint32_t*)lm2_scratch_alloc(arena, buffer_size * sizeof(uint32_t));
+  uint32_t* unique = (uint32_t*)lm2_scratch_alloc(arena, buffer_size * sizeof(uint32_t));
+  if (remap == NULL || unique == NULL) {
+    lm2_scratch_free(arena, unique);
+    lm2_scratch_free(arena, remap);
+    lm2_scratch_end(arena, mark);
+    result.vertex_count = result.index_count;
+    return result;
   }
 
-  // Add new vertex
-  uint32_t index = *vertex_count;
-  vertices[index] = vertex;
-  *vertex_count = lm2_add_u32(*vertex_count, 1);
-  return index;
+  result.vertex_count = lm2_vertex_weld_f64(
+      (const double*)triangles,
+      result.index_count,
+      3,
+      epsilon,
+      thread_count,
+      remap,
+      unique,
+      arena);
+
+  lm2_scratch_free(arena, unique);
+  lm2_scratch_free(arena, remap);
+  lm2_scratch_end(arena, mark);
+  return result;
 }
 
-static uint32_t _lm2_find_or_add_vertex3_f32(
-    lm2_v3_f32 vertex,
-    lm2_v3_f32* vertices,
-    uint32_t* vertex_count,
-    float epsilon) {
-  // Search for existing vertex
-  for (uint32_t i = 0; i < *vertex_count; i = lm2_add_u32(i, 1)) {
-    if (_lm2_vertices3_equal_f32(vertices[i], vertex, epsilon)) {
-      return i;
-    }
+static void _lm2_triangle3_list_to_indexed_mesh_f64(
+    const lm2_triangle3_f64* triangles,
+    size_t triangle_count,
+    double epsilon,
+    lm2_v3_f64* vertices,
+    size_t vertex_buffer_size,
+    uint32_t* indices,
+    size_t index_buffer_size,
+    uint32_t thread_count,
+    lm2_arena* arena) {
+  LM2_ASSERT(triangles != NULL);
+  LM2_ASSERT(vertices != NULL);
+  LM2_ASSERT(indices != NULL);
+
+  size_t required_index_count = lm2_mul_u64(triangle_count, 3);
+  LM2_ASSERT(index_buffer_size >= required_index_count);
+
+  // The weld writes the indices directly and lists the input slot of every unique vertex
+  size_t mark = lm2_scratch_begin(arena);
+  size_t buffer_size = required_index_count > 0 ? required_index_count : 1;
+  uint32_t* unique = (uint32_t*)lm2_scratch_alloc(arena, buffer_size * sizeof(uint32_t));
+  LM2_ASSERT(unique != NULL);
+
+  uint32_t vertex_count = lm2_vertex_weld_f64(
+      (const double*)triangles,
+      required_index_count,
+      3,
+      epsilon,
+      thread_count,
+      indices,
+      unique,
+      arena);
+  LM2_ASSERT(vertex_count <= vertex_buffer_size);
+
+  const lm2_v3_f64* source = (const lm2_v3_f64*)triangles;
+  for (uint32_t i = 0; i < vertex_count; i = lm2_add_u32(i, 1)) {
+    vertices[i] = source[unique[i]];
   }
 
-  // Add new vertex
-  uint32_t index = *vertex_count;
-  vertices[index] = vertex;
-  *vertex_count = lm2_add_u32(*vertex_count, 1);
-  return index;
+  lm2_scratch_free(arena, unique);
+  lm2_scratch_end(arena, mark);
 }
 
-// =============================================================================
-// Triangle List to Indexed Mesh Conversion
-// =============================================================================
-
-LM2_API lm2_indexed_mesh3_size lm2_triangle3_list_to_indexed_mesh_size_f64(
-    const lm2_triangle3_f64* triangles,
+static lm2_indexed_mesh3_size _lm2_triangle3_list_to_indexed_mesh_size_f32(
+    const lm2_triangle3_f32* triangles,
     size_t triangle_count,
-    double epsilon) {
+    float epsilon,
+    uint32_t thread_count,
+    lm2_arena* arena) {
   LM2_ASSERT(triangles != NULL);
 
   lm2_indexed_mesh3_size result = {0, 0};
+  result.index_count = lm2_mul_u64(triangle_count, 3);
 
-// Use stack buffer for reasonable triangle counts, else use worst case
-#define MAX_STACK_VERTICES 1024
-  lm2_v3_f64 stack_vertices[MAX_STACK_VERTICES];
-  lm2_v3_f64* vertices = stack_vertices;
-  size_t max_vertices = lm2_mul_u64(triangle_count, 3);
-  bool use_stack = max_vertices <= MAX_STACK_VERTICES;
-
-  if (!use_stack) {
-    // Too many vertices for stack - return worst case as documented
-    result.vertex_count = max_vertices;
-    result.index_count = lm2_mul_u64(triangle_count, 3);
+  // Temporary buffers for the weld; without them report the worst case
+  size_t mark = lm2_scratch_begin(arena);
+  size_t buffer_size = result.index_count > 0 ? result.index_count : 1;
+  uint32_t* remap = (uint32_t*)lm2_scratch_alloc(arena, buffer_size * sizeof(uint32_t));
+  uint32_t* unique = (uint32_t*)lm2_scratch_alloc(arena, buffer_size * sizeof(uint32_t));
+  if (remap == NULL || unique == NULL) {
+    lm2_scratch_free(arena, unique);
+    lm2_scratch_free(arena, remap);
+    lm2_scratch_end(arena, mark);
+    result.vertex_count = result.index_count;
     return result;
   }
 
-  // Perform actual deduplication count
-  uint32_t vertex_count = 0;
-
-  for (size_t i = 0; i < triangle_count; i = lm2_add_u64(i, 1)) {
-    for (int j = 0; j < 3; j++) {
-      lm2_v3_f64 vertex = triangles[i][j];
-
-      // Search for existing vertex
-      bool found = false;
-      for (uint32_t k = 0; k < vertex_count; k++) {
-        if (_lm2_vertices3_equal_f64(vertices[k], vertex, epsilon)) {
-          found = true;
-          break;
-        }
-      }
-
-      if (!found) {
-        vertices[vertex_count] = vertex;
-        vertex_count = lm2_add_u32(vertex_count, 1);
-      }
-    }
-  }
-
-  result.vertex_count = vertex_count;
-  result.index_count = lm2_mul_u64(triangle_count, 3);
-
+  result.vertex_count = lm2_vertex_weld_f32(
+      (const float*)triangles,
+      result.index_count,
+      3,
+      epsilon,
+      thread_count,
+      remap,
+      unique,
+      arena);
+
+  lm2_scratch_free(arena, unique);
+  lm2_scratch_free(arena, remap);
+  lm2_scratch_end(arena, mark);
   return result;
-#undef MAX_STACK_VERTICES
 }
 
-LM2_API lm2_indexed_mesh3_size lm2_triangle3_list_to_indexed_mesh_size_f32(
+static void _lm2_triangle3_list_to_indexed_mesh_f32(
     const lm2_triangle3_f32* triangles,
     size_t triangle_count,
-    float epsilon) {
+    float epsilon,
+    lm2_v3_f32* vertices,
+    size_t vertex_buffer_size,
+    uint32_t* indices,
+    size_t index_buffer_size,
+    uint32_t thread_count,
+    lm2_arena* arena) {
   LM2_ASSERT(triangles != NULL);
+  LM2_ASSERT(vertices != NULL);
+  LM2_ASSERT(indices != NULL);
 
-  lm2_indexed_mesh3_size result = {0, 0};
+  size_t required_index_count = lm2_mul_u64(triangle_count, 3);
+  LM2_ASSERT(index_buffer_size >= required_index_count);
 
-// Use stack buffer for reasonable triangle counts, else use worst case
-#define MAX_STACK_VERTICES 1024
-  lm2_v3_f32 stack_vertices[MAX_STACK_VERTICES];
-  lm2_v3_f32* vertices = stack_vertices;
-  size_t max_vertices = lm2_mul_u64(triangle_count, 3);
-  bool use_stack = max_vertices <= MAX_STACK_VERTICES;
-
-  if (!use_stack) {
-    // Too many vertices for stack - return worst case as documented
-    result.vertex_count = max_vertices;
-    result.index_count = lm2_mul_u64(triangle_count, 3);
-    return result;
+  // The weld writes the indices directly and lists the input slot of every unique vertex
+  size_t mark = lm2_scratch_begin(arena);
+  size_t buffer_size = required_index_count > 0 ? required_index_count : 1;
+  uint32_t* unique = (uint32_t*)lm2_scratch_alloc(arena, buffer_size * sizeof(uint32_t));
+  LM2_ASSERT(unique != NULL);
+
+  uint32_t vertex_count = lm2_vertex_weld_f32(
+      (const float*)triangles,
+      required_index_count,
+      3,
+      epsilon,
+      thread_count,
+      indices,
+      unique,
+      arena);
+  LM2_ASSERT(vertex_count <= vertex_buffer_size);
+
+  const lm2_v3_f32* source = (const lm2_v3_f32*)triangles;
+  for (uint32_t i = 0; i < vertex_count; i = lm2_add_u32(i, 1)) {
+    vertices[i] = source[unique[i]];
   }
 
-  // Perform actual deduplication count
-  uint32_t vertex_count = 0;
+  lm2_scratch_free(arena, unique);
+  lm2_scratch_end(arena, mark);
+}
 
-  for (size_t i = 0; i < triangle_count; i = lm2_add_u64(i, 1)) {
-    for (int j = 0; j < 3; j++) {
-      lm2_v3_f32 vertex = triangles[i][j];
-
-      // Search for existing vertex
-      bool found = false;
-      for (uint32_t k = 0; k < vertex_count; k++) {
-        if (_lm2_vertices3_equal_f32(vertices[k], vertex, epsilon)) {
-          found = true;
-          break;
-        }
-      }
-
-      if (!found) {
-        vertices[vertex_count] = vertex;
-        vertex_count = lm2_add_u32(vertex_count, 1);
-      }
-    }
-  }
+LM2_API lm2_indexed_mesh3_size lm2_triangle3_list_to_indexed_mesh_size_f64(
+    const lm2_triangle3_f64* triangles,
+    size_t triangle_count,
+    double epsilon) {
+  return _lm2_triangle3_list_to_indexed_mesh_size_f64(triangles, triangle_count, epsilon, 1, lm2_arena_thread_default());
+}
 
-  result.vertex_count = vertex_count;
-  result.index_count = lm2_mul_u64(triangle_count, 3);
+LM2_API lm2_indexed_mesh3_size lm2_triangle3_list_to_indexed_mesh_size_parallel_f64(
+    const lm2_triangle3_f64* triangles,
+    size_t triangle_count,
+    double epsilon,
+    uint32_t thread_count) {
+  return _lm2_triangle3_list_to_indexed_mesh_size_f64(
+      triangles, triangle_count, epsilon, thread_count, lm2_arena_thread_default());
+}
 
-  return result;
-#undef MAX_STACK_VERTICES
+LM2_API lm2_indexed_mesh3_size lm2_triangle3_list_to_indexed_mesh_size_scratch_f64(
+    const lm2_triangle3_f64* triangles,
+    size_t triangle_count,
+    double epsilon,
+    lm2_arena* arena) {
+  return _lm2_triangle3_list_to_indexed_mesh_size_f64(triangles, triangle_count, epsilon, 1, arena);
 }
 
 LM2_API void lm2_triangle3_list_to_indexed_mesh_f64(
@@ -315,31 +350,74 @@ LM2_API void lm2_triangle3_list_to_indexed_mesh_f64(
     size_t vertex_buffer_size,
     uint32_t* indices,
     size_t index_buffer_size) {
-  LM2_ASSERT(triangles != NULL);
-  LM2_ASSERT(vertices != NULL);
-  LM2_ASSERT(indices != NULL);
+  _lm2_triangle3_list_to_indexed_mesh_f64(
+      triangles,
+      triangle_count,
+      epsilon,
+      vertices,
+      vertex_buffer_size,
+      indices,
+      index_buffer_size,
+      1,
+      lm2_arena_thread_default());
+}
 
-  size_t required_index_count = lm2_mul_u64(triangle_count, 3);
-  LM2_ASSERT(index_buffer_size >= required_index_count);
-  LM2_ASSERT(vertex_buffer_size >= triangle_count);  // At least this many
+LM2_API void lm2_triangle3_list_to_indexed_mesh_parallel_f64(
+    const lm2_triangle3_f64* triangles,
+    size_t triangle_count,
+    double epsilon,
+    lm2_v3_f64* vertices,
+    size_t vertex_buffer_size,
+    uint32_t* indices,
+    size_t index_buffer_size,
+    uint32_t thread_count) {
+  _lm2_triangle3_list_to_indexed_mesh_f64(
+      triangles,
+      triangle_count,
+      epsilon,
+      vertices,
+      vertex_buffer_size,
+      indices,
+      index_buffer_size,
+      thread_count,
+      lm2_arena_thread_default());
+}
 
-  uint32_t vertex_count = 0;
-  uint32_t index_count = 0;
+LM2_API void lm2_triangle3_list_to_indexed_mesh_scratch_f64(
+    const lm2_triangle3_f64* triangles,
+    size_t triangle_count,
+    double epsilon,
+    lm2_v3_f64* vertices,
+    size_t vertex_buffer_size,
+    uint32_t* indices,
+    size_t index_buffer_size,
+    lm2_arena* arena) {
+  _lm2_triangle3_list_to_indexed_mesh_f64(
+      triangles, triangle_count, epsilon, vertices, vertex_buffer_size, indices, index_buffer_size, 1, arena);
+}
 
-  for (size_t i = 0; i < triangle_count; i = lm2_add_u64(i, 1)) {
-    // Process each vertex of the triangle
-    for (int j = 0; j < 3; j++) {
-      uint32_t index = _lm2_find_or_add_vertex3_f64(
-          triangles[i][j],
-          vertices,
-          &vertex_count,
-          epsilon);
-
-      LM2_ASSERT(vertex_count <= vertex_buffer_size);
-      indices[index_count] = index;
-      index_count = lm2_add_u32(index_count, 1);
-    }
-  }
+LM2_API lm2_indexed_mesh3_size lm2_triangle3_list_to_indexed_mesh_size_f32(
+    const lm2_triangle3_f32* triangles,
+    size_t triangle_count,
+    float epsilon) {
+  return _lm2_triangle3_list_to_indexed_mesh_size_f32(triangles, triangle_count, epsilon, 1, lm2_arena_thread_default());
+}
+
+LM2_API lm2_indexed_mesh3_size lm2_triangle3_list_to_indexed_mesh_size_parallel_f32(
+    const lm2_triangle3_f32* triangles,
+    size_t triangle_count,
+    float epsilon,
+    uint32_t thread_count) {
+  return _lm2_triangle3_list_to_indexed_mesh_size_f32(
+      triangles, triangle_count, epsilon, thread_count, lm2_arena_thread_default());
+}
+
+LM2_API lm2_indexed_mesh3_size lm2_triangle3_list_to_indexed_mesh_size_scratch_f32(
+    const lm2_triangle3_f32* triangles,
+    size_t triangle_count,
+    float epsilon,
+    lm2_arena* arena) {
+  return _lm2_triangle3_list_to_indexed_mesh_size_f32(triangles, triangle_count, epsilon, 1, arena);
 }
 
 LM2_API void lm2_triangle3_list_to_indexed_mesh_f32(
@@ -350,31 +428,50 @@ LM2_API void lm2_triangle3_list_to_indexed_mesh_f32(
     size_t vertex_buffer_size,
     uint32_t* indices,
     size_t index_buffer_size) {
-  LM2_ASSERT(triangles != NULL);
-  LM2_ASSERT(vertices != NULL);
-  LM2_ASSERT(indices != NULL);
-
-  size_t required_index_count = lm2_mul_u64(triangle_count, 3);
-  LM2_ASSERT(index_buffer_size >= required_index_count);
-  LM2_ASSERT(vertex_buffer_size >= triangle_count);  // At least this many
+  _lm2_triangle3_list_to_indexed_mesh_f32(
+      triangles,
+      triangle_count,
+      epsilon,
+      vertices,
+      vertex_buffer_size,
+      indices,
+      index_buffer_size,
+      1,
+      lm2_arena_thread_default());
+}
 
-  uint32_t vertex_count = 0;
-  uint32_t index_count = 0;
+LM2_API void lm2_triangle3_list_to_indexed_mesh_parallel_f32(
+    const lm2_triangle3_f32* triangles,
+    size_t triangle_count,
+    float epsilon,
+    lm2_v3_f32* vertices,
+    size_t vertex_buffer_size,
+    uint32_t* indices,
+    size_t index_buffer_size,
+    uint32_t thread_count) {
+  _lm2_triangle3_list_to_indexed_mesh_f32(
+      triangles,
+      triangle_count,
+      epsilon,
+      vertices,
+      vertex_buffer_size,
+      indices,
+      index_buffer_size,
+      thread_count,
+      lm2_arena_thread_default());
+}
 
-  for (size_t i = 0; i < triangle_count; i = lm2_add_u64(i, 1)) {
-    // Process each vertex of the triangle
-    for (int j = 0; j < 3; j++) {
-      uint32_t index = _lm2_find_or_add_vertex3_f32(
-          triangles[i][j],
-          vertices,
-          &vertex_count,
-          epsilon);
-
-      LM2_ASSERT(vertex_count <= vertex_buffer_size);
-      indices[index_count] = index;
-      index_count = lm2_add_u32(index_count, 1);
-    }
-  }
+LM2_API void lm2_triangle3_list_to_indexed_mesh_scratch_f32(
+    const lm2_triangle3_f32* triangles,
+    size_t triangle_count,
+    float epsilon,
+    lm2_v3_f32* vertices,
+    size_t vertex_buffer_size,
+    uint32_t* indices,
+    size_t index_buffer_size,
+    lm2_arena* arena) {
+  _lm2_triangle3_list_to_indexed_mesh_f32(
+      triangles, triangle_count, epsilon, vertices, vertex_buffer_size, indices, index_buffer_size, 1, arena);
 }
 
 // =============================================================================
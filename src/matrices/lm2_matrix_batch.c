@@ -0,0 +1,337 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <lm2/matrices/lm2_matrix3x2.h>
+#include <lm2/matrices/lm2_matrix3x3.h>
+#include <lm2/matrices/lm2_matrix4x4.h>
+#include "../misc/lm2_parallel.h"
+#include "../vectors/lm2_simd.h"
+
+// =============================================================================
+// Batch point transforms
+// =============================================================================
+// Each kernel broadcasts the matrix into SIMD registers once, then splits one
+// vector width of AoS points at a time into x/y(/z) lanes, evaluates every row
+// in the same order as the per-point transform_point functions and interleaves
+// the results back. The remainder goes through transform_point itself.
+//
+// The safe-op checks of transform_point are folded into one accumulator: each
+// result lane adds r * 0, which turns NaN at the first non-finite result and is
+// asserted once per call. Subnormal results are not checked on the SIMD path.
+
+// Points per parallel range; below this the thread start-up cost dominates
+#define _LM2_BATCH_MIN_RANGE 32768
+
+#if defined(LM2_UNSAFE)
+#  define _LM2_BATCH_TRACK2(S, acc, a, b)    (void)0
+#  define _LM2_BATCH_TRACK3(S, acc, a, b, c) (void)0
+#else
+// One dependent add into acc per iteration, the products are independent
+#  define _LM2_BATCH_ZERO(S, r)              _lm2_simd_mul_##S(r, _lm2_simd_set1_##S(0))
+#  define _LM2_BATCH_TRACK2(S, acc, a, b)    acc = _lm2_simd_add_##S(acc, _lm2_simd_add_##S(_LM2_BATCH_ZERO(S, a), _LM2_BATCH_ZERO(S, b)))
+#  define _LM2_BATCH_TRACK3(S, acc, a, b, c) acc = _lm2_simd_add_##S(acc, _lm2_simd_add_##S(_lm2_simd_add_##S(_LM2_BATCH_ZERO(S, a), _LM2_BATCH_ZERO(S, b)), _LM2_BATCH_ZERO(S, c)))
+#endif
+
+#define _LM2_IMPL_BATCH_ASSERT_FINITE(scalar_type, scalar_suffix)                       \
+  static void _lm2_batch_assert_finite_##scalar_suffix(_lm2_simd_##scalar_suffix acc) { \
+    scalar_type lanes[_lm2_simd_width_##scalar_suffix];                                 \
+    _lm2_simd_store_##scalar_suffix(lanes, acc);                                        \
+    for (size_t k = 0; k < _lm2_simd_width_##scalar_suffix; k++) {                      \
+      LM2_ASSERT_UNSAFE(lanes[k] == 0);                                                 \
+    }                                                                                   \
+    (void)lanes;                                                                        \
+  }
+
+_LM2_IMPL_BATCH_ASSERT_FINITE(double, f64)
+_LM2_IMPL_BATCH_ASSERT_FINITE(float, f32)
+
+// Row of a homogeneous point transform: m_r0 * x + m_r1 * y (+ m_r2 * z) + m_rT
+#define _LM2_BATCH_ROW2(S, r, t)                                                                                \
+  _lm2_simd_add_##S(_lm2_simd_add_##S(_lm2_simd_mul_##S(m##r##0, vx), _lm2_simd_mul_##S(m##r##1, vy)), m##r##t)
+#define _LM2_BATCH_ROW3(S, r, t)                                                                                                                                   \
+  _lm2_simd_add_##S(_lm2_simd_add_##S(_lm2_simd_add_##S(_lm2_simd_mul_##S(m##r##0, vx), _lm2_simd_mul_##S(m##r##1, vy)), _lm2_simd_mul_##S(m##r##2, vz)), m##r##t)
+
+// Perspective divide in the lanes where |w - 1| > eps, as in transform_point
+#define _LM2_BATCH_DIVIDE(S, r, w, eps)                                                                      \
+  r = _lm2_simd_select_gt_##S(_lm2_simd_abs_##S(_lm2_simd_sub_##S(w, one)), eps, _lm2_simd_div_##S(r, w), r)
+
+#define _LM2_BATCH_SET1(S, e) _lm2_simd_##S e = _lm2_simd_set1_##S(m->e);
+
+// =============================================================================
+// Matrix 3x2 - v2 points
+// =============================================================================
+
+#define _LM2_IMPL_M3X2_TRANSFORM_RANGE(S)                                                                                              \
+  static void _lm2_m3x2_transform_range_##S(const lm2_m3x2_##S* m, const lm2_v2_##S* src, lm2_v2_##S* dst, size_t begin, size_t end) { \
+    enum { W = _lm2_simd_width_##S };                                                                                                  \
+    _LM2_BATCH_SET1(S, m00)                                                                                                            \
+    _LM2_BATCH_SET1(S, m01)                                                                                                            \
+    _LM2_BATCH_SET1(S, m02)                                                                                                            \
+    _LM2_BATCH_SET1(S, m10)                                                                                                            \
+    _LM2_BATCH_SET1(S, m11)                                                                                                            \
+    _LM2_BATCH_SET1(S, m12)                                                                                                            \
+    _lm2_simd_##S acc = _lm2_simd_set1_##S(0);                                                                                         \
+    size_t i = begin;                                                                                                                  \
+    for (; i + W <= end; i += W) {                                                                                                     \
+      _lm2_simd_##S vx, vy;                                                                                                            \
+      _lm2_simd_load2_##S(&src[i].x, &vx, &vy);                                                                                        \
+      _lm2_simd_##S rx = _LM2_BATCH_ROW2(S, 0, 2);                                                                                     \
+      _lm2_simd_##S ry = _LM2_BATCH_ROW2(S, 1, 2);                                                                                     \
+      _LM2_BATCH_TRACK2(S, acc, rx, ry);                                                                                               \
+      _lm2_simd_store2_##S(&dst[i].x, rx, ry);                                                                                         \
+    }                                                                                                                                  \
+    for (; i < end; i++) {                                                                                                             \
+      dst[i] = lm2_m3x2_transform_point_##S(*m, src[i]);                                                                               \
+    }                                                                                                                                  \
+    _lm2_batch_assert_finite_##S(acc);                                                                                                 \
+  }
+
+// =============================================================================
+// Matrix 3x3 - v2 points with perspective divide
+// =============================================================================
+
+#define _LM2_IMPL_M3X3_TRANSFORM_RANGE(S, epsilon)                                                                                     \
+  static void _lm2_m3x3_transform_range_##S(const lm2_m3x3_##S* m, const lm2_v2_##S* src, lm2_v2_##S* dst, size_t begin, size_t end) { \
+    enum { W = _lm2_simd_width_##S };                                                                                                  \
+    const bool affine = m->m20 == 0 && m->m21 == 0 && m->m22 == 1;                                                                     \
+    _LM2_BATCH_SET1(S, m00)                                                                                                            \
+    _LM2_BATCH_SET1(S, m01)                                                                                                            \
+    _LM2_BATCH_SET1(S, m02)                                                                                                            \
+    _LM2_BATCH_SET1(S, m10)                                                                                                            \
+    _LM2_BATCH_SET1(S, m11)                                                                                                            \
+    _LM2_BATCH_SET1(S, m12)                                                                                                            \
+    _LM2_BATCH_SET1(S, m20)                                                                                                            \
+    _LM2_BATCH_SET1(S, m21)                                                                                                            \
+    _LM2_BATCH_SET1(S, m22)                                                                                                            \
+    _lm2_simd_##S one = _lm2_simd_set1_##S(1);                                                                                         \
+    _lm2_simd_##S eps = _lm2_simd_set1_##S(epsilon);                                                                                   \
+    _lm2_simd_##S acc = _lm2_simd_set1_##S(0);                                                                                         \
+    size_t i = begin;                                                                                                                  \
+    for (; i + W <= end; i += W) {                                                                                                     \
+      _lm2_simd_##S vx, vy;                                                                                                            \
+      _lm2_simd_load2_##S(&src[i].x, &vx, &vy);                                                                                        \
+      _lm2_simd_##S rx = _LM2_BATCH_ROW2(S, 0, 2);                                                                                     \
+      _lm2_simd_##S ry = _LM2_BATCH_ROW2(S, 1, 2);                                                                                     \
+      if (!affine) {                                                                                                                   \
+        _lm2_simd_##S w = _LM2_BATCH_ROW2(S, 2, 2);                                                                                    \
+        _LM2_BATCH_DIVIDE(S, rx, w, eps);                                                                                              \
+        _LM2_BATCH_DIVIDE(S, ry, w, eps);                                                                                              \
+      }                                                                                                                                \
+      _LM2_BATCH_TRACK2(S, acc, rx, ry);                                                                                               \
+      _lm2_simd_store2_##S(&dst[i].x, rx, ry);                                                                                         \
+    }                                                                                                                                  \
+    for (; i < end; i++) {                                                                                                             \
+      dst[i] = lm2_m3x3_transform_point_##S(*m, src[i]);                                                                               \
+    }                                                                                                                                  \
+    _lm2_batch_assert_finite_##S(acc);                                                                                                 \
+  }
+
+// =============================================================================
+// Matrix 4x4 - v3 points with perspective divide
+// =============================================================================
+
+#define _LM2_IMPL_M4X4_TRANSFORM_RANGE(S, epsilon)                                                                                     \
+  static void _lm2_m4x4_transform_range_##S(const lm2_m4x4_##S* m, const lm2_v3_##S* src, lm2_v3_##S* dst, size_t begin, size_t end) { \
+    enum { W = _lm2_simd_width_##S };                                                                                                  \
+    const bool affine = m->m30 == 0 && m->m31 == 0 && m->m32 == 0 && m->m33 == 1;                                                      \
+    _LM2_BATCH_SET1(S, m00)                                                                                                            \
+    _LM2_BATCH_SET1(S, m01)                                                                                                            \
+    _LM2_BATCH_SET1(S, m02)                                                                                                            \
+    _LM2_BATCH_SET1(S, m03)                                                                                                            \
+    _LM2_BATCH_SET1(S, m10)                                                                                                            \
+    _LM2_BATCH_SET1(S, m11)                                                                                                            \
+    _LM2_BATCH_SET1(S, m12)                                                                                                            \
+    _LM2_BATCH_SET1(S, m13)                                                                                                            \
+    _LM2_BATCH_SET1(S, m20)                                                                                                            \
+    _LM2_BATCH_SET1(S, m21)                                                                                                            \
+    _LM2_BATCH_SET1(S, m22)                                                                                                            \
+    _LM2_BATCH_SET1(S, m23)                                                                                                            \
+    _LM2_BATCH_SET1(S, m30)                                                                                                            \
+    _LM2_BATCH_SET1(S, m31)                                                                                                            \
+    _LM2_BATCH_SET1(S, m32)                                                                                                            \
+    _LM2_BATCH_SET1(S, m33)                                                                                                            \
+    _lm2_simd_##S one = _lm2_simd_set1_##S(1);                                                                                         \
+    _lm2_simd_##S eps = _lm2_simd_set1_##S(epsilon);                                                                                   \
+    _lm2_simd_##S acc = _lm2_simd_set1_##S(0);                                                                                         \
+    size_t i = begin;                                                                                                                  \
+    for (; i + W <= end; i += W) {                                                                                                     \
+      _lm2_simd_##S vx, vy, vz;                                                                                                        \
+      _lm2_simd_load3_##S(&src[i].x, &vx, &vy, &vz);                                                                                   \
+      _lm2_simd_##S rx = _LM2_BATCH_ROW3(S, 0, 3);                                                                                     \
+      _lm2_simd_##S ry = _LM2_BATCH_ROW3(S, 1, 3);                                                                                     \
+      _lm2_simd_##S rz = _LM2_BATCH_ROW3(S, 2, 3);                                                                                     \
+      if (!affine) {                                                                                                                   \
+        _lm2_simd_##S w = _LM2_BATCH_ROW3(S, 3, 3);                                                                                    \
+        _LM2_BATCH_DIVIDE(S, rx, w, eps);                                                                                              \
+        _LM2_BATCH_DIVIDE(S, ry, w, eps);                                                                                              \
+        _LM2_BATCH_DIVIDE(S, rz, w, eps);                                                                                              \
+      }                                                                                                                                \
+      _LM2_BATCH_TRACK3(S, acc, rx, ry, rz);                                                                                           \
+      _lm2_simd_store3_##S(&dst[i].x, rx, ry, rz);                                                                                     \
+    }                                                                                                                                  \
+    for (; i < end; i++) {                                                                                                             \
+      dst[i] = lm2_m4x4_transform_point_##S(*m, src[i]);                                                                               \
+    }                                                                                                                                  \
+    _lm2_batch_assert_finite_##S(acc);                                                                                                 \
+  }
+
+_LM2_IMPL_M3X2_TRANSFORM_RANGE(f64)
+_LM2_IMPL_M3X2_TRANSFORM_RANGE(f32)
+_LM2_IMPL_M3X3_TRANSFORM_RANGE(f64, 1e-10)
+_LM2_IMPL_M3X3_TRANSFORM_RANGE(f32, 1e-6f)
+_LM2_IMPL_M4X4_TRANSFORM_RANGE(f64, 1e-10)
+_LM2_IMPL_M4X4_TRANSFORM_RANGE(f32, 1e-6f)
+
+// =============================================================================
+// Public entry points
+// =============================================================================
+
+#define _LM2_IMPL_TRANSFORM_POINTS(mat, vec, S)                                                                                                                        \
+  typedef struct _lm2_##mat##_batch_##S {                                                                                                                              \
+    const lm2_##mat##_##S* m;                                                                                                                                          \
+    const lm2_##vec##_##S* src;                                                                                                                                        \
+    lm2_##vec##_##S* dst;                                                                                                                                              \
+  } _lm2_##mat##_batch_##S;                                                                                                                                            \
+                                                                                                                                                                       \
+  static void _lm2_##mat##_transform_task_##S(void* context, size_t begin, size_t end) {                                                                               \
+    _lm2_##mat##_batch_##S* batch = (_lm2_##mat##_batch_##S*)context;                                                                                                  \
+    _lm2_##mat##_transform_range_##S(batch->m, batch->src, batch->dst, begin, end);                                                                                    \
+  }                                                                                                                                                                    \
+                                                                                                                                                                       \
+  LM2_API void lm2_##mat##_transform_points_##S(lm2_##mat##_##S m, lm2_##vec##_##S* points, uint32_t count) {                                                          \
+    LM2_ASSERT(points != NULL);                                                                                                                                        \
+    _lm2_##mat##_transform_range_##S(&m, points, points, 0, count);                                                                                                    \
+  }                                                                                                                                                                    \
+                                                                                                                                                                       \
+  LM2_API void lm2_##mat##_transform_points_src_dst_##S(lm2_##mat##_##S m, const lm2_##vec##_##S* src, lm2_##vec##_##S* dst, uint32_t count) {                         \
+    LM2_ASSERT(src != NULL && dst != NULL);                                                                                                                            \
+    _lm2_##mat##_transform_range_##S(&m, src, dst, 0, count);                                                                                                          \
+  }                                                                                                                                                                    \
+                                                                                                                                                                       \
+  LM2_API void lm2_##mat##_transform_points_parallel_##S(lm2_##mat##_##S m, const lm2_##vec##_##S* src, lm2_##vec##_##S* dst, uint32_t count, uint32_t thread_count) { \
+    LM2_ASSERT(src != NULL && dst != NULL);                                                                                                                            \
+    _lm2_##mat##_batch_##S batch = {&m, src, dst};                                                                                                                     \
+    lm2_parallel_for(count, _LM2_BATCH_MIN_RANGE, thread_count, _lm2_##mat##_transform_task_##S, &batch);                                                              \
+  }
+
+_LM2_IMPL_TRANSFORM_POINTS(m3x2, v2, f64)
+_LM2_IMPL_TRANSFORM_POINTS(m3x2, v2, f32)
+_LM2_IMPL_TRANSFORM_POINTS(m3x3, v2, f64)
+_LM2_IMPL_TRANSFORM_POINTS(m3x3, v2, f32)
+_LM2_IMPL_TRANSFORM_POINTS(m4x4, v3, f64)
+_LM2_IMPL_TRANSFORM_POINTS(m4x4, v3, f32)
+
+// =============================================================================
+// Batch 4x4 products
+// =============================================================================
+// Row broadcasting: row r of a * b is a_r0 * b_0 + a_r1 * b_1 + a_r2 * b_2 +
+// a_r3 * b_3 over the rows b_k of b, summed in the same order as lm2_m4x4_mul.
+// All of b is loaded before the first store and row r of a is read before row r
+// of dst is written, so dst may alias a or b. premul copies m first, so m may
+// point into dst as well. propagate_hierarchy requires parents[i] < i (negative
+// for roots), so every parent is final before its children read it. The
+// finiteness checks follow the point transforms above.
+
+#define _LM2_MUL_ROW(S, a, r)                                                  \
+  _lm2_row4_add_##S(                                                           \
+      _lm2_row4_add_##S(                                                       \
+          _lm2_row4_add_##S(                                                   \
+              _lm2_row4_mul_##S(_lm2_row4_set1_##S((a)->e[(r) * 4 + 0]), b0),  \
+              _lm2_row4_mul_##S(_lm2_row4_set1_##S((a)->e[(r) * 4 + 1]), b1)), \
+          _lm2_row4_mul_##S(_lm2_row4_set1_##S((a)->e[(r) * 4 + 2]), b2)),     \
+      _lm2_row4_mul_##S(_lm2_row4_set1_##S((a)->e[(r) * 4 + 3]), b3))
+
+#if defined(LM2_UNSAFE)
+#  define _LM2_ROW4_TRACK(S, acc, r0, r1, r2, r3) (void)0
+#else
+#  define _LM2_ROW4_ZERO(S, r)                    _lm2_row4_mul_##S(r, _lm2_row4_set1_##S(0))
+#  define _LM2_ROW4_TRACK(S, acc, r0, r1, r2, r3)                                                                                                                                     \
+    acc = _lm2_row4_add_##S(acc, _lm2_row4_add_##S(_lm2_row4_add_##S(_LM2_ROW4_ZERO(S, r0), _LM2_ROW4_ZERO(S, r1)), _lm2_row4_add_##S(_LM2_ROW4_ZERO(S, r2), _LM2_ROW4_ZERO(S, r3))))
+#endif
+
+#define _LM2_IMPL_M4X4_MUL_KERNEL(scalar_type, S)                                                                                    \
+  static inline void _lm2_m4x4_mul_kernel_##S(const lm2_m4x4_##S* a, const lm2_m4x4_##S* b, lm2_m4x4_##S* dst, _lm2_row4_##S* acc) { \
+    _lm2_row4_##S b0 = _lm2_row4_load_##S(b->e);                                                                                     \
+    _lm2_row4_##S b1 = _lm2_row4_load_##S(b->e + 4);                                                                                 \
+    _lm2_row4_##S b2 = _lm2_row4_load_##S(b->e + 8);                                                                                 \
+    _lm2_row4_##S b3 = _lm2_row4_load_##S(b->e + 12);                                                                                \
+    _lm2_row4_##S r0 = _LM2_MUL_ROW(S, a, 0);                                                                                        \
+    _lm2_row4_store_##S(dst->e, r0);                                                                                                 \
+    _lm2_row4_##S r1 = _LM2_MUL_ROW(S, a, 1);                                                                                        \
+    _lm2_row4_store_##S(dst->e + 4, r1);                                                                                             \
+    _lm2_row4_##S r2 = _LM2_MUL_ROW(S, a, 2);                                                                                        \
+    _lm2_row4_store_##S(dst->e + 8, r2);                                                                                             \
+    _lm2_row4_##S r3 = _LM2_MUL_ROW(S, a, 3);                                                                                        \
+    _lm2_row4_store_##S(dst->e + 12, r3);                                                                                            \
+    _LM2_ROW4_TRACK(S, *acc, r0, r1, r2, r3);                                                                                        \
+    (void)acc;                                                                                                                       \
+  }                                                                                                                                  \
+                                                                                                                                     \
+  static void _lm2_row4_assert_finite_##S(_lm2_row4_##S acc) {                                                                       \
+    scalar_type lanes[4];                                                                                                            \
+    _lm2_row4_store_##S(lanes, acc);                                                                                                 \
+    LM2_ASSERT_UNSAFE(lanes[0] == 0 && lanes[1] == 0 && lanes[2] == 0 && lanes[3] == 0);                                             \
+    (void)lanes;                                                                                                                     \
+  }
+
+_LM2_IMPL_M4X4_MUL_KERNEL(double, f64)
+_LM2_IMPL_M4X4_MUL_KERNEL(float, f32)
+
+#define _LM2_IMPL_M4X4_MUL_BATCH(S)                                                                                         \
+  LM2_API void lm2_m4x4_mul_array_##S(const lm2_m4x4_##S* a, const lm2_m4x4_##S* b, lm2_m4x4_##S* dst, uint32_t count) {    \
+    LM2_ASSERT((a != NULL && b != NULL && dst != NULL) || count == 0);                                                      \
+    _lm2_row4_##S acc = _lm2_row4_set1_##S(0);                                                                              \
+    for (uint32_t i = 0; i < count; i++) {                                                                                  \
+      _lm2_m4x4_mul_kernel_##S(&a[i], &b[i], &dst[i], &acc);                                                                \
+    }                                                                                                                       \
+    _lm2_row4_assert_finite_##S(acc);                                                                                       \
+  }                                                                                                                         \
+                                                                                                                            \
+  LM2_API void lm2_m4x4_premul_array_##S(const lm2_m4x4_##S* m, const lm2_m4x4_##S* b, lm2_m4x4_##S* dst, uint32_t count) { \
+    LM2_ASSERT(m != NULL);                                                                                                  \
+    LM2_ASSERT((b != NULL && dst != NULL) || count == 0);                                                                   \
+    const lm2_m4x4_##S left = *m;                                                                                           \
+    _lm2_row4_##S acc = _lm2_row4_set1_##S(0);                                                                              \
+    for (uint32_t i = 0; i < count; i++) {                                                                                  \
+      _lm2_m4x4_mul_kernel_##S(&left, &b[i], &dst[i], &acc);                                                                \
+    }                                                                                                                       \
+    _lm2_row4_assert_finite_##S(acc);                                                                                       \
+  }                                                                                                                         \
+                                                                                                                            \
+  LM2_API void lm2_m4x4_propagate_hierarchy_##S(lm2_m4x4_##S* matrices, const int32_t* parents, uint32_t count) {           \
+    LM2_ASSERT((matrices != NULL && parents != NULL) || count == 0);                                                        \
+    _lm2_row4_##S acc = _lm2_row4_set1_##S(0);                                                                              \
+    for (uint32_t i = 0; i < count; i++) {                                                                                  \
+      int32_t parent = parents[i];                                                                                          \
+      if (parent < 0) {                                                                                                     \
+        continue;                                                                                                           \
+      }                                                                                                                     \
+      LM2_ASSERT((uint32_t)parent < i);                                                                                     \
+      _lm2_m4x4_mul_kernel_##S(&matrices[parent], &matrices[i], &matrices[i], &acc);                                        \
+    }                                                                                                                       \
+    _lm2_row4_assert_finite_##S(acc);                                                                                       \
+  }
+
+_LM2_IMPL_M4X4_MUL_BATCH(f64)
+_LM2_IMPL_M4X4_MUL_BATCH(f32)
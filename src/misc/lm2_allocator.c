@@ -0,0 +1,320 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <stdlib.h>  // For malloc, realloc, free
+#include <string.h>  // For memset
+#include "lm2_scratch.h"
+
+#if !defined(LM2_NO_THREADS)
+#  if defined(_WIN32)
+#    define WIN32_LEAN_AND_MEAN
+#    include <windows.h>
+#  else
+#    include <pthread.h>
+#  endif
+#endif
+
+// Alignment of arena allocations
+#define _LM2_ARENA_ALIGNMENT 16
+
+// Owned arena blocks grow in steps of this many bytes
+#define _LM2_ARENA_GRANULARITY 4096
+
+// =============================================================================
+// Allocator Hook
+// =============================================================================
+
+static void* _lm2_default_allocate(void* user_data, size_t size) {
+  (void)user_data;
+  return malloc(size);
+}
+
+static void* _lm2_default_reallocate(void* user_data, void* ptr, size_t size) {
+  (void)user_data;
+  return realloc(ptr, size);
+}
+
+static void _lm2_default_deallocate(void* user_data, void* ptr) {
+  (void)user_data;
+  free(ptr);
+}
+
+static lm2_allocator _lm2_allocator = {
+    _lm2_default_allocate,
+    _lm2_default_reallocate,
+    _lm2_default_deallocate,
+    NULL,
+};
+
+LM2_API void lm2_set_allocator(const lm2_allocator* allocator) {
+  if (allocator == NULL) {
+    _lm2_allocator.allocate = _lm2_default_allocate;
+    _lm2_allocator.reallocate = _lm2_default_reallocate;
+    _lm2_allocator.deallocate = _lm2_default_deallocate;
+    _lm2_allocator.user_data = NULL;
+    return;
+  }
+  LM2_ASSERT(allocator->allocate != NULL);
+  LM2_ASSERT(allocator->reallocate != NULL);
+  LM2_ASSERT(allocator->deallocate != NULL);
+  _lm2_allocator = *allocator;
+}
+
+LM2_API lm2_allocator lm2_get_allocator(void) {
+  return _lm2_allocator;
+}
+
+void* lm2_malloc(size_t size) {
+  return _lm2_allocator.allocate(_lm2_allocator.user_data, size > 0 ? size : 1);
+}
+
+void* lm2_calloc(size_t count, size_t size) {
+  if (size > 0 && count > SIZE_MAX / size) {
+    return NULL;
+  }
+  void* ptr = lm2_malloc(count * size);
+  if (ptr != NULL) {
+    memset(ptr, 0, count * size);
+  }
+  return ptr;
+}
+
+void* lm2_realloc(void* ptr, size_t size) {
+  return _lm2_allocator.reallocate(_lm2_allocator.user_data, ptr, size > 0 ? size : 1);
+}
+
+void lm2_free(void* ptr) {
+  if (ptr != NULL) {
+    _lm2_allocator.deallocate(_lm2_allocator.user_data, ptr);
+  }
+}
+
+// =============================================================================
+// Bump Arena
+// =============================================================================
+// offset counts from the start of the block. Every allocation starts at the
+// next aligned address, so a caller block does not need to be aligned. A
+// request that does not fit is added to overflow with its worst-case padding.
+
+LM2_API lm2_arena lm2_arena_make(void* memory, size_t capacity) {
+  lm2_arena arena;
+  arena.memory = (unsigned char*)memory;
+  arena.capacity = capacity;
+  arena.offset = 0;
+  arena.peak = 0;
+  arena.overflow = 0;
+  arena.owns_memory = memory == NULL;
+  if (memory == NULL) {
+    arena.memory = capacity > 0 ? (unsigned char*)lm2_malloc(capacity) : NULL;
+    arena.capacity = arena.memory != NULL ? capacity : 0;
+  }
+  return arena;
+}
+
+LM2_API void lm2_arena_destroy(lm2_arena* arena) {
+  LM2_ASSERT(arena != NULL);
+  if (arena->owns_memory) {
+    lm2_free(arena->memory);
+  }
+  *arena = lm2_arena_make(NULL, 0);
+}
+
+LM2_API void* lm2_arena_alloc(lm2_arena* arena, size_t size) {
+  LM2_ASSERT(arena != NULL);
+  // A zero-size block still takes a byte, so the pointer never sits one past the end
+  if (size == 0) {
+    size = 1;
+  }
+  size_t padding = (size_t)((uintptr_t)(arena->memory + arena->offset) % _LM2_ARENA_ALIGNMENT);
+  size_t start = arena->offset + (padding > 0 ? _LM2_ARENA_ALIGNMENT - padding : 0);
+
+  void* ptr = NULL;
+  if (start <= arena->capacity && size <= arena->capacity - start) {
+    ptr = arena->memory + start;
+    arena->offset = start + size;
+  } else if (size <= SIZE_MAX - _LM2_ARENA_ALIGNMENT - arena->overflow) {
+    arena->overflow += size + _LM2_ARENA_ALIGNMENT;
+  }
+  size_t needed = arena->offset + arena->overflow;
+  if (needed > arena->peak) {
+    arena->peak = needed;
+  }
+  return ptr;
+}
+
+LM2_API size_t lm2_arena_mark(const lm2_arena* arena) {
+  LM2_ASSERT(arena != NULL);
+  return arena->offset;
+}
+
+LM2_API void lm2_arena_reset(lm2_arena* arena, size_t mark) {
+  LM2_ASSERT(arena != NULL);
+  LM2_ASSERT(mark <= arena->offset);
+  arena->offset = mark;
+  if (mark > 0) {
+    return;
+  }
+  arena->overflow = 0;
+
+  // Empty owning arena: grow the block so the largest need seen so far fits
+  if (arena->owns_memory && arena->peak > arena->capacity) {
+    size_t capacity = arena->peak;
+    if (capacity <= SIZE_MAX - _LM2_ARENA_GRANULARITY) {
+      capacity = (capacity + _LM2_ARENA_GRANULARITY - 1) & ~(size_t)(_LM2_ARENA_GRANULARITY - 1);
+    }
+    lm2_free(arena->memory);
+    arena->memory = (unsigned char*)lm2_malloc(capacity);
+    arena->capacity = arena->memory != NULL ? capacity : 0;
+  }
+}
+
+// =============================================================================
+// Per-Thread Default Arena
+// =============================================================================
+// The arena lives on the heap and its address sits in thread-local storage
+// whose destructor frees it when the thread exits. Worker threads of the
+// parallel functions are started per call, so the destructor matters there.
+
+#if defined(LM2_NO_THREADS)
+
+// Without the threads library there is no thread-exit hook to free the
+// arena, and the program may still run lm2 on several threads, so one
+// shared arena is not safe. The functions use the heap instead.
+LM2_API lm2_arena* lm2_arena_thread_default(void) {
+  return NULL;
+}
+
+#else
+
+static lm2_arena* _lm2_thread_arena_create(void) {
+  lm2_arena* arena = (lm2_arena*)lm2_malloc(sizeof(lm2_arena));
+  if (arena != NULL) {
+    *arena = lm2_arena_make(NULL, 0);
+  }
+  return arena;
+}
+
+static void _lm2_thread_arena_release(void* data) {
+  lm2_arena* arena = (lm2_arena*)data;
+  if (arena != NULL) {
+    lm2_arena_destroy(arena);
+    lm2_free(arena);
+  }
+}
+
+#  if defined(_WIN32)
+
+static INIT_ONCE _lm2_thread_arena_once = INIT_ONCE_STATIC_INIT;
+static DWORD _lm2_thread_arena_index = FLS_OUT_OF_INDEXES;
+
+static VOID WINAPI _lm2_thread_arena_callback(PVOID data) {
+  _lm2_thread_arena_release(data);
+}
+
+static BOOL CALLBACK _lm2_thread_arena_init(PINIT_ONCE once, PVOID parameter, PVOID* context) {
+  (void)once;
+  (void)parameter;
+  (void)context;
+  _lm2_thread_arena_index = FlsAlloc(_lm2_thread_arena_callback);
+  return TRUE;
+}
+
+LM2_API lm2_arena* lm2_arena_thread_default(void) {
+  InitOnceExecuteOnce(&_lm2_thread_arena_once, _lm2_thread_arena_init, NULL, NULL);
+  if (_lm2_thread_arena_index == FLS_OUT_OF_INDEXES) {
+    return NULL;
+  }
+  lm2_arena* arena = (lm2_arena*)FlsGetValue(_lm2_thread_arena_index);
+  if (arena == NULL) {
+    arena = _lm2_thread_arena_create();
+    if (arena != NULL && !FlsSetValue(_lm2_thread_arena_index, arena)) {
+      _lm2_thread_arena_release(arena);
+      arena = NULL;
+    }
+  }
+  return arena;
+}
+
+#  else
+
+static pthread_once_t _lm2_thread_arena_once = PTHREAD_ONCE_INIT;
+static pthread_key_t _lm2_thread_arena_key;
+static bool _lm2_thread_arena_ready = false;
+
+static void _lm2_thread_arena_init(void) {
+  _lm2_thread_arena_ready = pthread_key_create(&_lm2_thread_arena_key, _lm2_thread_arena_release) == 0;
+}
+
+LM2_API lm2_arena* lm2_arena_thread_default(void) {
+  pthread_once(&_lm2_thread_arena_once, _lm2_thread_arena_init);
+  if (!_lm2_thread_arena_ready) {
+    return NULL;
+  }
+  lm2_arena* arena = (lm2_arena*)pthread_getspecific(_lm2_thread_arena_key);
+  if (arena == NULL) {
+    arena = _lm2_thread_arena_create();
+    if (arena != NULL && pthread_setspecific(_lm2_thread_arena_key, arena) != 0) {
+      _lm2_thread_arena_release(arena);
+      arena = NULL;
+    }
+  }
+  return arena;
+}
+
+#  endif
+
+#endif
+
+// =============================================================================
+// Scratch Buffers
+// =============================================================================
+
+size_t lm2_scratch_begin(const lm2_arena* arena) {
+  return arena != NULL ? arena->offset : 0;
+}
+
+void lm2_scratch_end(lm2_arena* arena, size_t mark) {
+  if (arena != NULL) {
+    lm2_arena_reset(arena, mark);
+  }
+}
+
+void* lm2_scratch_alloc(lm2_arena* arena, size_t size) {
+  void* ptr = arena != NULL ? lm2_arena_alloc(arena, size) : NULL;
+  return ptr != NULL ? ptr : lm2_malloc(size);
+}
+
+void lm2_scratch_free(lm2_arena* arena, void* ptr) {
+  if (ptr == NULL) {
+    return;
+  }
+  if (arena != NULL && arena->memory != NULL) {
+    uintptr_t address = (uintptr_t)ptr;
+    uintptr_t begin = (uintptr_t)arena->memory;
+    if (address >= begin && address < begin + arena->capacity) {
+      return;
+    }
+  }
+  lm2_free(ptr);
+}
@@ -0,0 +1,148 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "lm2_parallel.h"
+
+#if !defined(LM2_NO_THREADS)
+#  if defined(_WIN32)
+#    define WIN32_LEAN_AND_MEAN
+#    include <windows.h>
+#  else
+#    include <pthread.h>
+#    include <unistd.h>
+#  endif
+#endif
+
+// Upper bound on the ranges of a single call
+#define _LM2_PARALLEL_MAX_THREADS 64
+
+typedef struct _lm2_parallel_range {
+  lm2_parallel_fn fn;
+  void* context;
+  size_t begin;
+  size_t end;
+} _lm2_parallel_range;
+
+uint32_t lm2_parallel_thread_count(uint32_t requested) {
+  uint32_t count = requested;
+  if (count == 0) {
+#if defined(LM2_NO_THREADS)
+    count = 1;
+#elif defined(_WIN32)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    count = (uint32_t)info.dwNumberOfProcessors;
+#else
+    long online = sysconf(_SC_NPROCESSORS_ONLN);
+    count = online > 0 ? (uint32_t)online : 1;
+#endif
+  }
+  return count > _LM2_PARALLEL_MAX_THREADS ? _LM2_PARALLEL_MAX_THREADS : count;
+}
+
+#if !defined(LM2_NO_THREADS)
+#  if defined(_WIN32)
+static DWORD WINAPI _lm2_parallel_entry(LPVOID arg) {
+  _lm2_parallel_range* range = (_lm2_parallel_range*)arg;
+  range->fn(range->context, range->begin, range->end);
+  return 0;
+}
+#  else
+static void* _lm2_parallel_entry(void* arg) {
+  _lm2_parallel_range* range = (_lm2_parallel_range*)arg;
+  range->fn(range->context, range->begin, range->end);
+  return NULL;
+}
+#  endif
+#endif
+
+void lm2_parallel_for(size_t count, size_t min_range, uint32_t thread_count, lm2_parallel_fn fn, void* context) {
+  LM2_ASSERT(fn != NULL);
+  if (count == 0) {
+    return;
+  }
+
+  size_t range_count = lm2_parallel_thread_count(thread_count);
+  if (min_range > 0 && count / min_range < range_count) {
+    range_count = count / min_range;
+  }
+
+#if defined(LM2_NO_THREADS)
+  range_count = 1;
+#endif
+
+  if (range_count <= 1) {
+    fn(context, 0, count);
+    return;
+  }
+
+#if !defined(LM2_NO_THREADS)
+  _lm2_parallel_range ranges[_LM2_PARALLEL_MAX_THREADS];
+#  if defined(_WIN32)
+  HANDLE threads[_LM2_PARALLEL_MAX_THREADS];
+#  else
+  pthread_t threads[_LM2_PARALLEL_MAX_THREADS];
+#  endif
+  bool started[_LM2_PARALLEL_MAX_THREADS];
+
+  // Even split, the first (count % range_count) ranges take one extra element
+  size_t base = count / range_count;
+  size_t extra = count % range_count;
+  size_t begin = 0;
+  for (size_t r = 0; r < range_count; r++) {
+    size_t size = base + (r < extra ? 1 : 0);
+    ranges[r].fn = fn;
+    ranges[r].context = context;
+    ranges[r].begin = begin;
+    ranges[r].end = begin + size;
+    begin += size;
+  }
+
+  // Range 0 runs on the calling thread; a range whose thread fails to start
+  // runs there as well
+  for (size_t r = 1; r < range_count; r++) {
+#  if defined(_WIN32)
+    threads[r] = CreateThread(NULL, 0, _lm2_parallel_entry, &ranges[r], 0, NULL);
+    started[r] = threads[r] != NULL;
+#  else
+    started[r] = pthread_create(&threads[r], NULL, _lm2_parallel_entry, &ranges[r]) == 0;
+#  endif
+  }
+
+  fn(context, ranges[0].begin, ranges[0].end);
+
+  for (size_t r = 1; r < range_count; r++) {
+    if (!started[r]) {
+      fn(context, ranges[r].begin, ranges[r].end);
+      continue;
+    }
+#  if defined(_WIN32)
+    WaitForSingleObject(threads[r], INFINITE);
+    CloseHandle(threads[r]);
+#  else
+    pthread_join(threads[r], NULL);
+#  endif
+  }
+#endif
+}
@@ -0,0 +1,41 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+// Internal fork-join helper for the parallel batch functions.
+// lm2_parallel_for splits [0, count) into contiguous ranges and runs fn on each
+// range, the calling thread taking the first one. Worker threads are created
+// per call, so callers only go parallel for counts well above min_range.
+// Built with LM2_NO_THREADS, every range runs on the calling thread.
+
+#include "lm2/lm2_base.h"
+
+typedef void (*lm2_parallel_fn)(void* context, size_t begin, size_t end);
+
+// Resolves a requested thread count, 0 meaning one per hardware thread
+uint32_t lm2_parallel_thread_count(uint32_t requested);
+
+// Runs fn over [0, count) using at most thread_count ranges of at least min_range elements
+void lm2_parallel_for(size_t count, size_t min_range, uint32_t thread_count, lm2_parallel_fn fn, void* context);
@@ -0,0 +1,51 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+// Internal memory helpers behind lm2_allocator.h. Every heap allocation in the
+// library goes through lm2_malloc and friends, which call the allocator hook.
+// lm2_scratch_alloc takes a buffer from an arena and falls back to the heap
+// when the arena is full or NULL; lm2_scratch_free releases only such heap
+// fallbacks. The arena part is released by lm2_scratch_end with the mark that
+// lm2_scratch_begin returned before the first allocation.
+
+#include "lm2/misc/lm2_allocator.h"
+
+void* lm2_malloc(size_t size);
+void* lm2_calloc(size_t count, size_t size);
+void* lm2_realloc(void* ptr, size_t size);
+void lm2_free(void* ptr);
+
+// Mark of arena (may be NULL) for lm2_scratch_end
+size_t lm2_scratch_begin(const lm2_arena* arena);
+
+// Releases the arena allocations made since mark
+void lm2_scratch_end(lm2_arena* arena, size_t mark);
+
+// Buffer of size bytes from arena (may be NULL), or from the heap if it does not fit
+void* lm2_scratch_alloc(lm2_arena* arena, size_t size);
+
+// Frees ptr if it came from the heap; NULL and arena memory are ignored
+void lm2_scratch_free(lm2_arena* arena, void* ptr);
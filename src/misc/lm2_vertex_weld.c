@@ -0,0 +1,364 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <lm2/scalar/lm2_safe_ops.h>
+#include <lm2/scalar/lm2_scalar.h>
+#include <math.h>
+#include <string.h>  // For memcpy, memset
+#include "lm2_parallel.h"
+#include "lm2_scratch.h"
+#include "lm2_vertex_weld.h"
+
+// Ranges of fewer points than this weld on the calling thread
+#define _LM2_WELD_PARALLEL_MIN_RANGE 16384
+
+#define _LM2_WELD_NONE UINT32_MAX
+
+// Grid coordinates saturate at +-2^62, so clamped cells still form one range
+#define _LM2_WELD_CELL_LIMIT 4611686018427387904.0
+
+// =============================================================================
+// Cell Hash
+// =============================================================================
+// Chained hash from grid cells to unique points: heads holds the newest unique
+// point of every bucket, next links each unique point to the previous one in
+// its bucket. Cells sharing a bucket only cost extra comparisons.
+
+typedef struct _lm2_weld_table {
+  uint32_t* heads;
+  uint32_t* next;
+  uint64_t mask;
+  lm2_arena* arena;
+} _lm2_weld_table;
+
+static void _lm2_weld_table_init(_lm2_weld_table* table, size_t capacity, lm2_arena* arena) {
+  size_t bucket_count = 64;
+  while (bucket_count < 2 * capacity) {
+    bucket_count *= 2;
+  }
+  table->heads = (uint32_t*)lm2_scratch_alloc(arena, sizeof(uint32_t) * bucket_count);
+  table->next = (uint32_t*)lm2_scratch_alloc(arena, sizeof(uint32_t) * (capacity > 0 ? capacity : 1));
+  table->arena = arena;
+  table->mask = (uint64_t)bucket_count - 1;
+  LM2_ASSERT(table->heads != NULL && table->next != NULL);
+  memset(table->heads, 0xFF, sizeof(uint32_t) * bucket_count);
+}
+
+static void _lm2_weld_table_free(_lm2_weld_table* table) {
+  lm2_scratch_free(table->arena, table->next);
+  lm2_scratch_free(table->arena, table->heads);
+}
+
+static inline uint64_t _lm2_weld_bucket(const _lm2_weld_table* table, const int64_t* keys, uint32_t dimension) {
+  // Exact keys are float bit patterns, so both halves of every key have to reach the low bits
+  uint64_t h = 0x9E3779B97F4A7C15ull;
+  for (uint32_t a = 0; a < dimension; a++) {
+    h = (h ^ (uint64_t)keys[a]) * 0xFF51AFD7ED558CCDull;
+    h ^= h >> 33;
+  }
+  h *= 0xC4CEB9FE1A85EC53ull;
+  h ^= h >> 33;
+  return h & table->mask;
+}
+
+static inline void _lm2_weld_table_insert(_lm2_weld_table* table, const int64_t* keys, uint32_t dimension, uint32_t id) {
+  uint64_t bucket = _lm2_weld_bucket(table, keys, dimension);
+  table->next[id] = table->heads[bucket];
+  table->heads[bucket] = id;
+}
+
+// Grid coordinate of a value already scaled to cell units
+static inline int64_t _lm2_weld_cell(double scaled) {
+  double c = floor(scaled);
+  if (c != c) {
+    return 0;
+  }
+  if (c < -_LM2_WELD_CELL_LIMIT) {
+    return -(int64_t)_LM2_WELD_CELL_LIMIT;
+  }
+  return c > _LM2_WELD_CELL_LIMIT ? (int64_t)_LM2_WELD_CELL_LIMIT : (int64_t)c;
+}
+
+// Key of an exact coordinate, with -0 folded onto +0
+static inline int64_t _lm2_weld_bits(double value) {
+  value += 0.0;
+  int64_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+
+// =============================================================================
+// Welding
+// =============================================================================
+// The probe range of a coordinate is padded by a few ulps beyond epsilon,
+// because the epsilon test runs on rounded differences. Those ulps grow with
+// the coordinate, so cells are sized from the widest range any point of the
+// weld can need: far from the origin they are larger than 2 * epsilon, and a
+// range never spans more than two cells per axis. The extra quarter absorbs
+// the rounding of the scaled range bounds.
+
+#define _LM2_IMPL_VERTEX_WELD_STATE(scalar_type, S, rel)                         \
+  typedef struct _lm2_weld_##S {                                                 \
+    const scalar_type* points;                                                   \
+    scalar_type epsilon;                                                         \
+    bool exact;                                                                  \
+    double scale;                                                                \
+    double pad;                                                                  \
+    _lm2_weld_table table;                                                       \
+    uint32_t* unique;                                                            \
+    uint32_t count;                                                              \
+  } _lm2_weld_##S;                                                               \
+                                                                                 \
+  typedef uint32_t (*_lm2_weld_point_fn_##S)(_lm2_weld_##S* weld, size_t index); \
+                                                                                 \
+  static void _lm2_weld_init_##S(                                                \
+      _lm2_weld_##S* weld,                                                       \
+      const scalar_type* points,                                                 \
+      scalar_type epsilon,                                                       \
+      size_t capacity,                                                           \
+      uint32_t* unique,                                                          \
+      double max_abs,                                                            \
+      lm2_arena* arena) {                                                        \
+    weld->points = points;                                                       \
+    weld->epsilon = epsilon;                                                     \
+    weld->exact = epsilon == 0;                                                  \
+    weld->pad = (double)epsilon * (1.0 + rel);                                   \
+    weld->scale = 0.4 / (weld->pad + max_abs * rel);                             \
+    if (!(weld->scale < 1.0e300)) {                                              \
+      weld->scale = 1.0e300;                                                     \
+    }                                                                            \
+    _lm2_weld_table_init(&weld->table, capacity, arena);                         \
+    weld->unique = unique;                                                       \
+    weld->count = 0;                                                             \
+  }
+
+#define _LM2_IMPL_VERTEX_WELD_POINT(scalar_type, S, D, rel)                                                \
+  static uint32_t _lm2_weld_point##D##_##S(_lm2_weld_##S* weld, size_t index) {                            \
+    const scalar_type* p = weld->points + index * D;                                                       \
+    int64_t lo[D];                                                                                         \
+    int64_t hi[D];                                                                                         \
+    int64_t keys[D];                                                                                       \
+    bool finite = true;                                                                                    \
+    for (uint32_t a = 0; a < D; a++) {                                                                     \
+      finite = finite && isfinite(p[a]);                                                                   \
+    }                                                                                                      \
+                                                                                                           \
+    if (finite) {                                                                                          \
+      for (uint32_t a = 0; a < D; a++) {                                                                   \
+        double v = (double)p[a];                                                                           \
+        if (weld->exact) {                                                                                 \
+          lo[a] = hi[a] = _lm2_weld_bits(v);                                                               \
+        } else {                                                                                           \
+          double pad = weld->pad + fabs(v) * rel;                                                          \
+          lo[a] = _lm2_weld_cell((v - pad) * weld->scale);                                                 \
+          hi[a] = _lm2_weld_cell((v + pad) * weld->scale);                                                 \
+        }                                                                                                  \
+        keys[a] = lo[a];                                                                                   \
+      }                                                                                                    \
+                                                                                                           \
+      uint32_t best = _LM2_WELD_NONE;                                                                      \
+      for (;;) {                                                                                           \
+        uint64_t bucket = _lm2_weld_bucket(&weld->table, keys, D);                                         \
+        for (uint32_t id = weld->table.heads[bucket]; id != _LM2_WELD_NONE; id = weld->table.next[id]) {   \
+          if (id >= best) {                                                                                \
+            continue;                                                                                      \
+          }                                                                                                \
+          const scalar_type* q = weld->points + (size_t)weld->unique[id] * D;                              \
+          bool equal = true;                                                                               \
+          for (uint32_t a = 0; a < D; a++) {                                                               \
+            equal = equal && lm2_abs_##S(lm2_sub_##S(q[a], p[a])) <= weld->epsilon;                        \
+          }                                                                                                \
+          if (equal) {                                                                                     \
+            best = id;                                                                                     \
+          }                                                                                                \
+        }                                                                                                  \
+                                                                                                           \
+        uint32_t a = 0;                                                                                    \
+        while (a < D && keys[a] == hi[a]) {                                                                \
+          keys[a] = lo[a];                                                                                 \
+          a++;                                                                                             \
+        }                                                                                                  \
+        if (a == D) {                                                                                      \
+          break;                                                                                           \
+        }                                                                                                  \
+        keys[a]++;                                                                                         \
+      }                                                                                                    \
+      if (best != _LM2_WELD_NONE) {                                                                        \
+        return best;                                                                                       \
+      }                                                                                                    \
+    }                                                                                                      \
+                                                                                                           \
+    uint32_t id = weld->count;                                                                             \
+    weld->unique[id] = (uint32_t)index;                                                                    \
+    weld->count = id + 1;                                                                                  \
+    if (finite) {                                                                                          \
+      for (uint32_t a = 0; a < D; a++) {                                                                   \
+        keys[a] = weld->exact ? _lm2_weld_bits((double)p[a]) : _lm2_weld_cell((double)p[a] * weld->scale); \
+      }                                                                                                    \
+      _lm2_weld_table_insert(&weld->table, keys, D, id);                                                   \
+    }                                                                                                      \
+    return id;                                                                                             \
+  }
+
+// =============================================================================
+// Parallel Welding
+// =============================================================================
+// Range r covers points [begin, end) and finds local_count exact first
+// occurrences, listed in unique[begin, begin + local_count). remap holds local
+// indices until the merge turns them into global ones through globals.
+
+#define _LM2_IMPL_VERTEX_WELD(scalar_type, S, rel)                                                      \
+  _LM2_IMPL_VERTEX_WELD_STATE(scalar_type, S, rel)                                                      \
+  _LM2_IMPL_VERTEX_WELD_POINT(scalar_type, S, 2, rel)                                                   \
+  _LM2_IMPL_VERTEX_WELD_POINT(scalar_type, S, 3, rel)                                                   \
+                                                                                                        \
+  typedef struct _lm2_weld_range_##S {                                                                  \
+    size_t begin;                                                                                       \
+    size_t end;                                                                                         \
+    uint32_t local_count;                                                                               \
+  } _lm2_weld_range_##S;                                                                                \
+                                                                                                        \
+  typedef struct _lm2_weld_parallel_##S {                                                               \
+    const scalar_type* points;                                                                          \
+    _lm2_weld_point_fn_##S weld_point;                                                                  \
+    _lm2_weld_range_##S* ranges;                                                                        \
+    uint32_t* remap;                                                                                    \
+    uint32_t* unique;                                                                                   \
+    uint32_t* globals;                                                                                  \
+  } _lm2_weld_parallel_##S;                                                                             \
+                                                                                                        \
+  static void _lm2_weld_local_task_##S(void* context, size_t begin, size_t end) {                       \
+    _lm2_weld_parallel_##S* par = (_lm2_weld_parallel_##S*)context;                                     \
+    for (size_t r = begin; r < end; r++) {                                                              \
+      _lm2_weld_range_##S* range = &par->ranges[r];                                                     \
+      _lm2_weld_##S weld;                                                                               \
+      size_t count = range->end - range->begin;                                                         \
+      _lm2_weld_init_##S(&weld, par->points, 0, count, par->unique + range->begin, 0, NULL);            \
+      for (size_t i = range->begin; i < range->end; i++) {                                              \
+        par->remap[i] = par->weld_point(&weld, i);                                                      \
+      }                                                                                                 \
+      range->local_count = weld.count;                                                                  \
+      _lm2_weld_table_free(&weld.table);                                                                \
+    }                                                                                                   \
+  }                                                                                                     \
+                                                                                                        \
+  static void _lm2_weld_remap_task_##S(void* context, size_t begin, size_t end) {                       \
+    _lm2_weld_parallel_##S* par = (_lm2_weld_parallel_##S*)context;                                     \
+    for (size_t r = begin; r < end; r++) {                                                              \
+      const _lm2_weld_range_##S* range = &par->ranges[r];                                               \
+      const uint32_t* globals = par->globals + range->begin;                                            \
+      for (size_t i = range->begin; i < range->end; i++) {                                              \
+        par->remap[i] = globals[par->remap[i]];                                                         \
+      }                                                                                                 \
+    }                                                                                                   \
+  }                                                                                                     \
+                                                                                                        \
+  uint32_t lm2_vertex_weld_##S(                                                                         \
+      const scalar_type* points,                                                                        \
+      size_t count,                                                                                     \
+      uint32_t dimension,                                                                               \
+      scalar_type epsilon,                                                                              \
+      uint32_t thread_count,                                                                            \
+      uint32_t* remap,                                                                                  \
+      uint32_t* unique,                                                                                 \
+      lm2_arena* arena) {                                                                               \
+    LM2_ASSERT(count == 0 || points != NULL);                                                           \
+    LM2_ASSERT(count == 0 || (remap != NULL && unique != NULL));                                        \
+    LM2_ASSERT(dimension == 2 || dimension == 3);                                                       \
+    LM2_ASSERT(epsilon >= 0);                                                                           \
+    LM2_ASSERT(count < _LM2_WELD_NONE);                                                                 \
+                                                                                                        \
+    _lm2_weld_point_fn_##S weld_point = dimension == 2 ? _lm2_weld_point2_##S : _lm2_weld_point3_##S;   \
+    size_t range_count = lm2_parallel_thread_count(thread_count);                                       \
+    if (count / _LM2_WELD_PARALLEL_MIN_RANGE < range_count) {                                           \
+      range_count = count / _LM2_WELD_PARALLEL_MIN_RANGE;                                               \
+    }                                                                                                   \
+                                                                                                        \
+    double max_abs = 0;                                                                                 \
+    for (size_t i = 0; i < count * dimension; i++) {                                                    \
+      double v = fabs((double)points[i]);                                                               \
+      if (v > max_abs && isfinite(v)) {                                                                 \
+        max_abs = v;                                                                                    \
+      }                                                                                                 \
+    }                                                                                                   \
+                                                                                                        \
+    size_t mark = lm2_scratch_begin(arena);                                                             \
+    _lm2_weld_##S weld;                                                                                 \
+    if (range_count <= 1) {                                                                             \
+      _lm2_weld_init_##S(&weld, points, epsilon, count, unique, max_abs, arena);                        \
+      for (size_t i = 0; i < count; i++) {                                                              \
+        remap[i] = weld_point(&weld, i);                                                                \
+      }                                                                                                 \
+      _lm2_weld_table_free(&weld.table);                                                                \
+      lm2_scratch_end(arena, mark);                                                                     \
+      return weld.count;                                                                                \
+    }                                                                                                   \
+                                                                                                        \
+    _lm2_weld_parallel_##S par;                                                                         \
+    par.points = points;                                                                                \
+    par.weld_point = weld_point;                                                                        \
+    size_t range_bytes = sizeof(_lm2_weld_range_##S) * range_count;                                     \
+    par.ranges = (_lm2_weld_range_##S*)lm2_scratch_alloc(arena, range_bytes);                           \
+    par.remap = remap;                                                                                  \
+    par.unique = (uint32_t*)lm2_scratch_alloc(arena, sizeof(uint32_t) * count);                         \
+    par.globals = (uint32_t*)lm2_scratch_alloc(arena, sizeof(uint32_t) * count);                        \
+    LM2_ASSERT(par.ranges != NULL && par.unique != NULL && par.globals != NULL);                        \
+    for (size_t r = 0; r < range_count; r++) {                                                          \
+      par.ranges[r].begin = count * r / range_count;                                                    \
+      par.ranges[r].end = count * (r + 1) / range_count;                                                \
+    }                                                                                                   \
+    lm2_parallel_for(range_count, 1, (uint32_t)range_count, _lm2_weld_local_task_##S, &par);            \
+                                                                                                        \
+    size_t local_total = 0;                                                                             \
+    for (size_t r = 0; r < range_count; r++) {                                                          \
+      local_total += par.ranges[r].local_count;                                                         \
+    }                                                                                                   \
+    _lm2_weld_init_##S(&weld, points, epsilon, local_total, unique, max_abs, arena);                    \
+    for (size_t r = 0; r < range_count; r++) {                                                          \
+      const _lm2_weld_range_##S* range = &par.ranges[r];                                                \
+      for (size_t k = range->begin; k < range->begin + range->local_count; k++) {                       \
+        par.globals[k] = weld_point(&weld, par.unique[k]);                                              \
+      }                                                                                                 \
+    }                                                                                                   \
+    _lm2_weld_table_free(&weld.table);                                                                  \
+    lm2_parallel_for(range_count, 1, (uint32_t)range_count, _lm2_weld_remap_task_##S, &par);            \
+                                                                                                        \
+    lm2_scratch_free(arena, par.globals);                                                               \
+    lm2_scratch_free(arena, par.unique);                                                                \
+    lm2_scratch_free(arena, par.ranges);                                                                \
+    lm2_scratch_end(arena, mark);                                                                       \
+    return weld.count;                                                                                  \
+  }
+
+// =============================================================================
+// f64 Implementation
+// =============================================================================
+
+_LM2_IMPL_VERTEX_WELD(double, f64, 0x1p-50)
+
+// =============================================================================
+// f32 Implementation
+// =============================================================================
+
+_LM2_IMPL_VERTEX_WELD(float, f32, 0x1p-20)
@@ -0,0 +1,68 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+// Internal vertex welding shared by the triangle list to indexed mesh
+// conversions. Points are count runs of dimension (2 or 3) scalars. A point
+// welds to the lowest-numbered unique point whose coordinates all lie within
+// epsilon of its own, and becomes a new unique point otherwise; non-finite
+// points never weld. Candidates come from a hash of a grid with cells of at
+// least 2 * epsilon, widened when the largest coordinate makes rounding slack
+// exceed epsilon, so a lookup probes at most 2^dimension cells instead of
+// every earlier unique point. epsilon = 0 hashes the exact coordinates.
+//
+// With more than one thread, every thread first welds exact duplicates in its
+// own contiguous range; the first occurrences are then welded within epsilon
+// on the calling thread in input order and the ranges remapped in parallel.
+// An exact duplicate always welds to the same unique point as its first
+// occurrence, so the result matches the single-threaded weld.
+
+#include "lm2/lm2_base.h"
+#include "lm2/misc/lm2_allocator.h"
+
+// Welds points, writing the unique index of every point to remap[0, count) and
+// the input index of every unique point to unique[0, returned count)
+// The hash tables of the calling thread come from arena (may be NULL); worker
+// threads take theirs from the heap
+// Returns: number of unique points
+uint32_t lm2_vertex_weld_f64(
+    const double* points,
+    size_t count,
+    uint32_t dimension,
+    double epsilon,
+    uint32_t thread_count,
+    uint32_t* remap,
+    uint32_t* unique,
+    lm2_arena* arena);
+
+uint32_t lm2_vertex_weld_f32(
+    const float* points,
+    size_t count,
+    uint32_t dimension,
+    float epsilon,
+    uint32_t thread_count,
+    uint32_t* remap,
+    uint32_t* unique,
+    lm2_arena* arena);
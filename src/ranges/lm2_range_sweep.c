@@ -0,0 +1,341 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <lm2/ranges/lm2_range_sweep.h>
+#include <math.h>
+#include <string.h>
+#include "../vectors/lm2_simd.h"
+
+// =============================================================================
+// Work buffer
+// =============================================================================
+// For n boxes of D dimensions the buffer holds, in order:
+//   keys, temp_keys: 2n radix keys (same size as the scalar type)
+//   lanes: 2D arrays of n + _LM2_SWEEP_PAD scalars, the sorted boxes as SoA.
+//          Lanes 0 and 1 hold min and max on the sweep axis, lanes 2 and 3 the
+//          next axis, and so on.
+//   order: n box indices, sorted by min on the sweep axis (kept between updates)
+//   temp_order: n box indices
+// The padding past the last sorted box lets the SIMD sweep read a full vector
+// anywhere; the padded sweep-axis mins are NaN, which fail every comparison.
+
+#define _LM2_SWEEP_PAD 8
+
+// Incremental updates give up on the insertion sort after this many shifts
+// per box and radix sort instead
+#define _LM2_SWEEP_MAX_SHIFTS_PER_BOX 8
+
+static inline void _lm2_sweep_emit(lm2_sweep_pair* out, size_t max, size_t* count, uint32_t a, uint32_t b) {
+  if (*count < max) {
+    out[*count].a = a < b ? a : b;
+    out[*count].b = a < b ? b : a;
+  }
+  (*count)++;
+}
+
+// =============================================================================
+// Sorting
+// =============================================================================
+// Radix keys map a float's bits to an unsigned integer with the same order:
+// negative values have every bit flipped, positive values only the sign bit.
+
+#define _LM2_IMPL_SWEEP_SORT(scalar_type, key_type, signed_key_type, S)                                                             \
+  typedef struct _lm2_sweep_layout_##S {                                                                                            \
+    key_type* keys;                                                                                                                 \
+    key_type* temp_keys;                                                                                                            \
+    scalar_type* lanes;                                                                                                             \
+    uint32_t* order;                                                                                                                \
+    uint32_t* temp_order;                                                                                                           \
+    size_t stride;                                                                                                                  \
+  } _lm2_sweep_layout_##S;                                                                                                          \
+                                                                                                                                    \
+  static size_t _lm2_sweep_buffer_size_##S(size_t count, size_t dims) {                                                             \
+    return 2 * count * sizeof(key_type) + 2 * dims * (count + _LM2_SWEEP_PAD) * sizeof(scalar_type) + 2 * count * sizeof(uint32_t); \
+  }                                                                                                                                 \
+                                                                                                                                    \
+  static _lm2_sweep_layout_##S _lm2_sweep_make_layout_##S(void* buffer, size_t count, size_t dims) {                                \
+    _lm2_sweep_layout_##S layout;                                                                                                   \
+    layout.keys = (key_type*)buffer;                                                                                                \
+    layout.temp_keys = layout.keys + count;                                                                                         \
+    layout.lanes = (scalar_type*)(layout.temp_keys + count);                                                                        \
+    layout.stride = count + _LM2_SWEEP_PAD;                                                                                         \
+    layout.order = (uint32_t*)(layout.lanes + 2 * dims * layout.stride);                                                            \
+    layout.temp_order = layout.order + count;                                                                                       \
+    return layout;                                                                                                                  \
+  }                                                                                                                                 \
+                                                                                                                                    \
+  static inline key_type _lm2_sweep_key_##S(scalar_type value) {                                                                    \
+    key_type bits;                                                                                                                  \
+    memcpy(&bits, &value, sizeof(bits));                                                                                            \
+    const key_type sign = bits >> (8 * sizeof(key_type) - 1);                                                                       \
+    return bits ^ ((key_type)(-(signed_key_type)sign) | ((key_type)1 << (8 * sizeof(key_type) - 1)));                               \
+  }                                                                                                                                 \
+                                                                                                                                    \
+  /* LSD radix sort of layout->keys with layout->order as payload, one byte */                                                      \
+  /* per pass. Passes where every key shares the digit are skipped. */                                                              \
+  static void _lm2_sweep_radix_sort_##S(_lm2_sweep_layout_##S* layout, uint32_t n) {                                                \
+    uint32_t histogram[sizeof(key_type)][256];                                                                                      \
+    memset(histogram, 0, sizeof(histogram));                                                                                        \
+    for (uint32_t i = 0; i < n; i++) {                                                                                              \
+      const key_type key = layout->keys[i];                                                                                         \
+      for (size_t pass = 0; pass < sizeof(key_type); pass++) {                                                                      \
+        histogram[pass][(key >> (8 * pass)) & 0xFF]++;                                                                              \
+      }                                                                                                                             \
+    }                                                                                                                               \
+                                                                                                                                    \
+    key_type* src_keys = layout->keys;                                                                                              \
+    key_type* dst_keys = layout->temp_keys;                                                                                         \
+    uint32_t* src_order = layout->order;                                                                                            \
+    uint32_t* dst_order = layout->temp_order;                                                                                       \
+    for (size_t pass = 0; pass < sizeof(key_type); pass++) {                                                                        \
+      uint32_t* offsets = histogram[pass];                                                                                          \
+      const size_t shift = 8 * pass;                                                                                                \
+      if (offsets[(src_keys[0] >> shift) & 0xFF] == n) {                                                                            \
+        continue;                                                                                                                   \
+      }                                                                                                                             \
+      uint32_t sum = 0;                                                                                                             \
+      for (int digit = 0; digit < 256; digit++) {                                                                                   \
+        const uint32_t digit_count = offsets[digit];                                                                                \
+        offsets[digit] = sum;                                                                                                       \
+        sum += digit_count;                                                                                                         \
+      }                                                                                                                             \
+      for (uint32_t i = 0; i < n; i++) {                                                                                            \
+        const uint32_t slot = offsets[(src_keys[i] >> shift) & 0xFF]++;                                                             \
+        dst_keys[slot] = src_keys[i];                                                                                               \
+        dst_order[slot] = src_order[i];                                                                                             \
+      }                                                                                                                             \
+      key_type* swap_keys = src_keys;                                                                                               \
+      src_keys = dst_keys;                                                                                                          \
+      dst_keys = swap_keys;                                                                                                         \
+      uint32_t* swap_order = src_order;                                                                                             \
+      src_order = dst_order;                                                                                                        \
+      dst_order = swap_order;                                                                                                       \
+    }                                                                                                                               \
+    if (src_order != layout->order) {                                                                                               \
+      memcpy(layout->order, src_order, n * sizeof(uint32_t));                                                                       \
+    }                                                                                                                               \
+  }                                                                                                                                 \
+                                                                                                                                    \
+  /* Insertion sort of mins with order as payload. Gives up once more than */                                                       \
+  /* max_shifts elements have moved, leaving a valid but unsorted permutation. */                                                   \
+  /* Returns: true if sorted */                                                                                                     \
+  static bool _lm2_sweep_insertion_sort_##S(scalar_type* mins, uint32_t* order, uint32_t n, size_t max_shifts) {                    \
+    size_t shifts = 0;                                                                                                              \
+    for (uint32_t i = 1; i < n; i++) {                                                                                              \
+      const scalar_type key = mins[i];                                                                                              \
+      if (!(key < mins[i - 1])) {                                                                                                   \
+        continue;                                                                                                                   \
+      }                                                                                                                             \
+      const uint32_t index = order[i];                                                                                              \
+      uint32_t j = i;                                                                                                               \
+      while (j > 0 && key < mins[j - 1]) {                                                                                          \
+        mins[j] = mins[j - 1];                                                                                                      \
+        order[j] = order[j - 1];                                                                                                    \
+        j--;                                                                                                                        \
+      }                                                                                                                             \
+      mins[j] = key;                                                                                                                \
+      order[j] = index;                                                                                                             \
+      shifts += i - j;                                                                                                              \
+      if (shifts > max_shifts) {                                                                                                    \
+        return false;                                                                                                               \
+      }                                                                                                                             \
+    }                                                                                                                               \
+    return true;                                                                                                                    \
+  }
+
+_LM2_IMPL_SWEEP_SORT(double, uint64_t, int64_t, f64)
+_LM2_IMPL_SWEEP_SORT(float, uint32_t, int32_t, f32)
+
+// =============================================================================
+// Sweep
+// =============================================================================
+// Per box dimension: sweep axis choice, sorting, SoA gather and the SIMD sweep.
+// For box i the sweep loads its successors one vector at a time. The sweep-axis
+// test min[j] <= max[i] holds for a prefix of the successors, so the first
+// vector where it fails in any lane is the last one.
+
+#define _LM2_IMPL_SWEEP(R, D, scalar_type, S)                                                                                               \
+  /* The axis along which the box centers have the largest variance */                                                                      \
+  static uint32_t _lm2_##R##_sweep_axis_##S(const lm2_##R##_##S* boxes, uint32_t n) {                                                       \
+    double sum[D] = {0};                                                                                                                    \
+    double sum_sq[D] = {0};                                                                                                                 \
+    for (uint32_t i = 0; i < n; i++) {                                                                                                      \
+      for (uint32_t a = 0; a < D; a++) {                                                                                                    \
+        const double center = 0.5 * ((double)boxes[i].min.e[a] + (double)boxes[i].max.e[a]);                                                \
+        sum[a] += center;                                                                                                                   \
+        sum_sq[a] += center * center;                                                                                                       \
+      }                                                                                                                                     \
+    }                                                                                                                                       \
+    uint32_t axis = 0;                                                                                                                      \
+    double best = -1;                                                                                                                       \
+    for (uint32_t a = 0; a < D; a++) {                                                                                                      \
+      const double mean = sum[a] / n;                                                                                                       \
+      const double variance = sum_sq[a] / n - mean * mean;                                                                                  \
+      if (variance > best) {                                                                                                                \
+        best = variance;                                                                                                                    \
+        axis = a;                                                                                                                           \
+      }                                                                                                                                     \
+    }                                                                                                                                       \
+    return axis;                                                                                                                            \
+  }                                                                                                                                         \
+                                                                                                                                            \
+  /* Radix sort the current order by min on axis */                                                                                         \
+  static void _lm2_##R##_sweep_sort_##S(_lm2_sweep_layout_##S* layout, const lm2_##R##_##S* boxes, uint32_t n, uint32_t axis) {             \
+    for (uint32_t i = 0; i < n; i++) {                                                                                                      \
+      layout->keys[i] = _lm2_sweep_key_##S(boxes[layout->order[i]].min.e[axis]);                                                            \
+    }                                                                                                                                       \
+    _lm2_sweep_radix_sort_##S(layout, n);                                                                                                   \
+  }                                                                                                                                         \
+                                                                                                                                            \
+  static void _lm2_##R##_sweep_gather_##S(_lm2_sweep_layout_##S* layout, const lm2_##R##_##S* boxes, uint32_t n, uint32_t axis) {           \
+    scalar_type* lanes = layout->lanes;                                                                                                     \
+    const size_t stride = layout->stride;                                                                                                   \
+    uint32_t axes[D];                                                                                                                       \
+    for (uint32_t a = 0; a < D; a++) {                                                                                                      \
+      axes[a] = (axis + a) % D;                                                                                                             \
+    }                                                                                                                                       \
+    for (uint32_t i = 0; i < n; i++) {                                                                                                      \
+      const lm2_##R##_##S* box = &boxes[layout->order[i]];                                                                                  \
+      for (uint32_t a = 0; a < D; a++) {                                                                                                    \
+        lanes[(2 * a) * stride + i] = box->min.e[axes[a]];                                                                                  \
+        lanes[(2 * a + 1) * stride + i] = box->max.e[axes[a]];                                                                              \
+      }                                                                                                                                     \
+    }                                                                                                                                       \
+    for (uint32_t i = n; i < stride; i++) {                                                                                                 \
+      lanes[i] = (scalar_type)NAN;                                                                                                          \
+      for (uint32_t l = 1; l < 2 * D; l++) {                                                                                                \
+        lanes[l * stride + i] = 0;                                                                                                          \
+      }                                                                                                                                     \
+    }                                                                                                                                       \
+  }                                                                                                                                         \
+                                                                                                                                            \
+  static size_t _lm2_##R##_sweep_##S(const _lm2_sweep_layout_##S* layout, uint32_t n, lm2_sweep_pair* out, size_t max) {                    \
+    const scalar_type* lanes = layout->lanes;                                                                                               \
+    const size_t stride = layout->stride;                                                                                                   \
+    const int full = (1 << _lm2_simd_width_##S) - 1;                                                                                        \
+    size_t count = 0;                                                                                                                       \
+    for (uint32_t i = 0; i + 1 < n; i++) {                                                                                                  \
+      const _lm2_simd_##S sweep_max = _lm2_simd_set1_##S(lanes[stride + i]);                                                                \
+      _lm2_simd_##S other_min[D - 1];                                                                                                       \
+      _lm2_simd_##S other_max[D - 1];                                                                                                       \
+      for (uint32_t a = 1; a < D; a++) {                                                                                                    \
+        other_min[a - 1] = _lm2_simd_set1_##S(lanes[(2 * a) * stride + i]);                                                                 \
+        other_max[a - 1] = _lm2_simd_set1_##S(lanes[(2 * a + 1) * stride + i]);                                                             \
+      }                                                                                                                                     \
+      for (uint32_t j = i + 1;; j += _lm2_simd_width_##S) {                                                                                 \
+        const int in_range = _lm2_simd_le_mask_##S(_lm2_simd_load_##S(lanes + j), sweep_max);                                               \
+        int hits = in_range;                                                                                                                \
+        for (uint32_t a = 1; a < D; a++) {                                                                                                  \
+          hits &= _lm2_simd_le_mask_##S(_lm2_simd_load_##S(lanes + (2 * a) * stride + j), other_max[a - 1]);                                \
+          hits &= _lm2_simd_le_mask_##S(other_min[a - 1], _lm2_simd_load_##S(lanes + (2 * a + 1) * stride + j));                            \
+        }                                                                                                                                   \
+        for (uint32_t k = 0; hits != 0; k++, hits >>= 1) {                                                                                  \
+          if (hits & 1) {                                                                                                                   \
+            _lm2_sweep_emit(out, max, &count, layout->order[i], layout->order[j + k]);                                                      \
+          }                                                                                                                                 \
+        }                                                                                                                                   \
+        if (in_range != full) {                                                                                                             \
+          break;                                                                                                                            \
+        }                                                                                                                                   \
+      }                                                                                                                                     \
+    }                                                                                                                                       \
+    return count;                                                                                                                           \
+  }                                                                                                                                         \
+                                                                                                                                            \
+  static size_t _lm2_##R##_sweep_run_##S(lm2_sweep_##S* sweep, const lm2_##R##_##S* boxes, size_t count, lm2_sweep_pair* out, size_t max) { \
+    LM2_ASSERT(count < UINT32_MAX);                                                                                                         \
+    LM2_ASSERT(count == 0 || boxes != NULL);                                                                                                \
+    LM2_ASSERT(sweep->buffer_size >= _lm2_sweep_buffer_size_##S(count, D));                                                                 \
+    LM2_ASSERT(((uintptr_t)sweep->buffer % sizeof(uint64_t)) == 0);                                                                         \
+    const uint32_t n = (uint32_t)count;                                                                                                     \
+    if (n < 2) {                                                                                                                            \
+      sweep->count = n;                                                                                                                     \
+      return 0;                                                                                                                             \
+    }                                                                                                                                       \
+    _lm2_sweep_layout_##S layout = _lm2_sweep_make_layout_##S(sweep->buffer, n, D);                                                         \
+    bool sorted = false;                                                                                                                    \
+    if (sweep->count == n && sweep->axis < D) {                                                                                             \
+      /* Repair the kept order, sorting the sweep-axis min lane with it */                                                                  \
+      scalar_type* mins = layout.lanes;                                                                                                     \
+      for (uint32_t i = 0; i < n; i++) {                                                                                                    \
+        mins[i] = boxes[layout.order[i]].min.e[sweep->axis];                                                                                \
+      }                                                                                                                                     \
+      sorted = _lm2_sweep_insertion_sort_##S(mins, layout.order, n, (size_t)n * _LM2_SWEEP_MAX_SHIFTS_PER_BOX);                             \
+    } else {                                                                                                                                \
+      for (uint32_t i = 0; i < n; i++) {                                                                                                    \
+        layout.order[i] = i;                                                                                                                \
+      }                                                                                                                                     \
+    }                                                                                                                                       \
+    if (!sorted) {                                                                                                                          \
+      sweep->axis = _lm2_##R##_sweep_axis_##S(boxes, n);                                                                                    \
+      _lm2_##R##_sweep_sort_##S(&layout, boxes, n, sweep->axis);                                                                            \
+    }                                                                                                                                       \
+    sweep->count = n;                                                                                                                       \
+    _lm2_##R##_sweep_gather_##S(&layout, boxes, n, sweep->axis);                                                                            \
+    return _lm2_##R##_sweep_##S(&layout, n, out, max);                                                                                      \
+  }                                                                                                                                         \
+                                                                                                                                            \
+  LM2_API size_t lm2_##R##_sweep_buffer_size_##S(size_t count) {                                                                            \
+    return _lm2_sweep_buffer_size_##S(count, D);                                                                                            \
+  }                                                                                                                                         \
+                                                                                                                                            \
+  LM2_API size_t lm2_##R##_sweep_pairs_##S(                                                                                                 \
+      const lm2_##R##_##S* boxes,                                                                                                           \
+      size_t count,                                                                                                                         \
+      void* buffer,                                                                                                                         \
+      size_t buffer_size,                                                                                                                   \
+      lm2_sweep_pair* out_pairs,                                                                                                            \
+      size_t max_pairs) {                                                                                                                   \
+    lm2_sweep_##S sweep = lm2_sweep_make_##S(buffer, buffer_size);                                                                          \
+    return _lm2_##R##_sweep_run_##S(&sweep, boxes, count, out_pairs, max_pairs);                                                            \
+  }                                                                                                                                         \
+                                                                                                                                            \
+  LM2_API size_t lm2_##R##_sweep_update_##S(                                                                                                \
+      lm2_sweep_##S* sweep,                                                                                                                 \
+      const lm2_##R##_##S* boxes,                                                                                                           \
+      size_t count,                                                                                                                         \
+      lm2_sweep_pair* out_pairs,                                                                                                            \
+      size_t max_pairs) {                                                                                                                   \
+    LM2_ASSERT(sweep != NULL);                                                                                                              \
+    return _lm2_##R##_sweep_run_##S(sweep, boxes, count, out_pairs, max_pairs);                                                             \
+  }
+
+#define _LM2_IMPL_SWEEP_MAKE(S)                                                \
+  LM2_API lm2_sweep_##S lm2_sweep_make_##S(void* buffer, size_t buffer_size) { \
+    LM2_ASSERT(buffer_size == 0 || buffer != NULL);                            \
+    lm2_sweep_##S sweep;                                                       \
+    sweep.buffer = buffer;                                                     \
+    sweep.buffer_size = buffer_size;                                           \
+    sweep.count = 0;                                                           \
+    sweep.axis = 0;                                                            \
+    return sweep;                                                              \
+  }
+
+_LM2_IMPL_SWEEP_MAKE(f64)
+_LM2_IMPL_SWEEP_MAKE(f32)
+
+_LM2_IMPL_SWEEP(r2, 2, double, f64)
+_LM2_IMPL_SWEEP(r2, 2, float, f32)
+_LM2_IMPL_SWEEP(r3, 3, double, f64)
+_LM2_IMPL_SWEEP(r3, 3, float, f32)
@@ -0,0 +1,1374 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+// Internal SIMD wrappers shared by the batch kernels (SoA streams, batch matrix
+// transforms and products, sweep-and-prune overlap tests). Each backend exposes
+// a native-width lane type per precision:
+//   _lm2_simd_f32 / _LM2_SIMD_WIDTH_F32 and _lm2_simd_f64 / _LM2_SIMD_WIDTH_F64
+// AVX uses 8/4 lanes, SSE2 and NEON (AArch64) 4/2, and the scalar fallback 1/1.
+// Define LM2_NO_SIMD to force the scalar fallback.
+//
+// Loads and stores are unaligned. The kernels process full vectors first and
+// finish the remaining elements with plain C, so any count is valid.
+// select_gt(a, b, t, f) picks t in the lanes where a > b and f elsewhere.
+
+#include "lm2/lm2_base.h"
+
+#if !defined(LM2_NO_SIMD) && defined(__AVX__)
+#  define LM2_SIMD_AVX
+#  define LM2_SIMD_SSE2
+#  include <immintrin.h>
+#elif !defined(LM2_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#  define LM2_SIMD_SSE2
+#  include <emmintrin.h>
+#elif !defined(LM2_NO_SIMD) && defined(__ARM_NEON) && defined(__aarch64__)
+#  define LM2_SIMD_NEON
+#  include <arm_neon.h>
+#endif
+
+// #############################################################################
+// f32 lanes
+// #############################################################################
+
+#if defined(LM2_SIMD_AVX)
+
+#  define _LM2_SIMD_WIDTH_F32 8
+typedef __m256 _lm2_simd_f32;
+
+static inline _lm2_simd_f32 _lm2_simd_load_f32(const float* p) {
+  return _mm256_loadu_ps(p);
+}
+
+static inline void _lm2_simd_store_f32(float* p, _lm2_simd_f32 v) {
+  _mm256_storeu_ps(p, v);
+}
+
+static inline _lm2_simd_f32 _lm2_simd_set1_f32(float s) {
+  return _mm256_set1_ps(s);
+}
+
+static inline _lm2_simd_f32 _lm2_simd_add_f32(_lm2_simd_f32 a, _lm2_simd_f32 b) {
+  return _mm256_add_ps(a, b);
+}
+
+static inline _lm2_simd_f32 _lm2_simd_sub_f32(_lm2_simd_f32 a, _lm2_simd_f32 b) {
+  return _mm256_sub_ps(a, b);
+}
+
+static inline _lm2_simd_f32 _lm2_simd_mul_f32(_lm2_simd_f32 a, _lm2_simd_f32 b) {
+  return _mm256_mul_ps(a, b);
+}
+
+static inline _lm2_simd_f32 _lm2_simd_div_f32(_lm2_simd_f32 a, _lm2_simd_f32 b) {
+  return _mm256_div_ps(a, b);
+}
+
+static inline _lm2_simd_f32 _lm2_simd_min_f32(_lm2_simd_f32 a, _lm2_simd_f32 b) {
+  return _mm256_min_ps(a, b);
+}
+
+static inline _lm2_simd_f32 _lm2_simd_max_f32(_lm2_simd_f32 a, _lm2_simd_f32 b) {
+  return _mm256_max_ps(a, b);
+}
+
+static inline _lm2_simd_f32 _lm2_simd_sqrt_f32(_lm2_simd_f32 a) {
+  return _mm256_sqrt_ps(a);
+}
+
+static inline _lm2_simd_f32 _lm2_simd_rcp_nz_f32(_lm2_simd_f32 a) {
+  __m256 mask = _mm256_cmp_ps(a, _mm256_setzero_ps(), _CMP_NEQ_UQ);
+  return _mm256_and_ps(_mm256_div_ps(_mm256_set1_ps(1.0f), a), mask);
+}
+
+static inline _lm2_simd_f32 _lm2_simd_abs_f32(_lm2_simd_f32 a) {
+  return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a);
+}
+
+static inline _lm2_simd_f32 _lm2_simd_select_gt_f32(_lm2_simd_f32 a, _lm2_simd_f32 b, _lm2_simd_f32 t, _lm2_simd_f32 f) {
+  return _mm256_blendv_ps(f, t, _mm256_cmp_ps(a, b, _CMP_GT_OQ));
+}
+
+#elif defined(LM2_SIMD_SSE2)
+
+#  define _LM2_SIMD_WIDTH_F32 4
+typedef __m128 _lm2_simd_f32;
+
+static inline _lm2_simd_f32 _lm2_simd_load_f32(const float* p) {
+  return _mm_loadu_ps(p);
+}
+
+static inline void _lm2_simd_store_f32(float* p, _lm2_simd_f32 v) {
+  _mm_storeu_ps(p, v);
+}
+
+static inline _lm2_simd_f32 _lm2_simd_set1_f32(float s) {
+  return _mm_set1_ps(s);
+}
+
+static inline _lm2_simd_f32 _lm2_simd_add_f32(_lm2_simd_f32 a, _lm2_simd_f32 b) {
+  return _mm_add_ps(a, b);
+}
+
+static inline _lm2_simd_f32 _lm2_simd_sub_f32(_lm2_simd_f32 a, _lm2_simd_f32 b) {
+  return _mm_sub_ps(a, b);
+}
+
+static inline _lm2_simd_f32 _lm2_simd_mul_f32(_lm2_simd_f32 a, _lm2_simd_f32 b) {
+  return _mm_mul_ps(a, b);
+}
+
+static inline _lm2_simd_f32 _lm2_simd_div_f32(_lm2_simd_f32 a, _lm2_simd_f32 b) {
+  return _mm_div_ps(a, b);
+}
+
+static inline _lm2_simd_f32 _lm2_simd_min_f32(_lm2_simd_f32 a, _lm2_simd_f32 b) {
+  return _mm_min_ps(a, b);
+}
+
+static inline _lm2_simd_f32 _lm2_simd_max_f32(_lm2_simd_f32 a, _lm2_simd_f32 b) {
+  return _mm_max_ps(a, b);
+}
+
+static inline _lm2_simd_f32 _lm2_simd_sqrt_f32(_lm2_simd_f32 a) {
+  return _mm_sqrt_ps(a);
+}
+
+static inline _lm2_simd_f32 _lm2_simd_rcp_nz_f32(_lm2_simd_f32 a) {
+  __m128 mask = _mm_cmpneq_ps(a, _mm_setzero_ps());
+  return _mm_and_ps(_mm_div_ps(_mm_set1_ps(1.0f), a), mask);
+}
+
+static inline _lm2_simd_f32 _lm2_simd_abs_f32(_lm2_simd_f32 a) {
+  return _mm_andnot_ps(_mm_set1_ps(-0.0f), a);
+}
+
+static inline _lm2_simd_f32 _lm2_simd_select_gt_f32(_lm2_simd_f32 a, _lm2_simd_f32 b, _lm2_simd_f32 t, _lm2_simd_f32 f) {
+  __m128 mask = _mm_cmpgt_ps(a, b);
+  return _mm_or_ps(_mm_and_ps(mask, t), _mm_andnot_ps(mask, f));
+}
+
+#elif defined(LM2_SIMD_NEON)
+
+#  define _LM2_SIMD_WIDTH_F32 4
+typedef float32x4_t _lm2_simd_f32;
+
+static inline _lm2_simd_f32 _lm2_simd_load_f32(const float* p) {
+  return vld1q_f32(p);
+}
+
+static inline void _lm2_simd_store_f32(float* p, _lm2_simd_f32 v) {
+  vst1q_f32(p, v);
+}
+
+static inline _lm2_simd_f32 _lm2_simd_set1_f32(float s) {
+  return vdupq_n_f32(s);
+}
+
+static inline _lm2_simd_f32 _lm2_simd_add_f32(_lm2_simd_f32 a, _lm2_simd_f32 b) {
+  return vaddq_f32(a, b);
+}
+
+static inline _lm2_simd_f32 _lm2_simd_sub_f32(_lm2_simd_f32 a, _lm2_simd_f32 b) {
+  return vsubq_f32(a, b);
+}
+
+static inline _lm2_simd_f32 _lm2_simd_mul_f32(_lm2_simd_f32 a, _lm2_simd_f32 b) {
+  return vmulq_f32(a, b);
+}
+
+static inline _lm2_simd_f32 _lm2_simd_div_f32(_lm2_simd_f32 a, _lm2_simd_f32 b) {
+  return vdivq_f32(a, b);
+}
+
+static inline _lm2_simd_f32 _lm2_simd_min_f32(_lm2_simd_f32 a, _lm2_simd_f32 b) {
+  return vbslq_f32(vcltq_f32(a, b), a, b);
+}
+
+static inline _lm2_simd_f32 _lm2_simd_max_f32(_lm2_simd_f32 a, _lm2_simd_f32 b) {
+  return vbslq_f32(vcgtq_f32(a, b), a, b);
+}
+
+static inline _lm2_simd_f32 _lm2_simd_sqrt_f32(_lm2_simd_f32 a) {
+  return vsqrtq_f32(a);
+}
+
+static inline _lm2_simd_f32 _lm2_simd_rcp_nz_f32(_lm2_simd_f32 a) {
+  uint32x4_t zero = vceqq_f32(a, vdupq_n_f32(0.0f));
+  return vbslq_f32(zero, vdupq_n_f32(0.0f), vdivq_f32(vdupq_n_f32(1.0f), a));
+}
+
+static inline _lm2_simd_f32 _lm2_simd_abs_f32(_lm2_simd_f32 a) {
+  return vabsq_f32(a);
+}
+
+static inline _lm2_simd_f32 _lm2_simd_select_gt_f32(_lm2_simd_f32 a, _lm2_simd_f32 b, _lm2_simd_f32 t, _lm2_simd_f32 f) {
+  return vbslq_f32(vcgtq_f32(a, b), t, f);
+}
+
+#else
+
+#  define _LM2_SIMD_WIDTH_F32 1
+typedef float _lm2_simd_f32;
+
+static inline _lm2_simd_f32 _lm2_simd_load_f32(const float* p) {
+  return *p;
+}
+
+static inline void _lm2_simd_store_f32(float* p, _lm2_simd_f32 v) {
+  *p = v;
+}
+
+static inline _lm2_simd_f32 _lm2_simd_set1_f32(float s) {
+  return s;
+}
+
+static inline _lm2_simd_f32 _lm2_simd_add_f32(_lm2_simd_f32 a, _lm2_simd_f32 b) {
+  return a + b;
+}
+
+static inline _lm2_simd_f32 _lm2_simd_sub_f32(_lm2_simd_f32 a, _lm2_simd_f32 b) {
+  return a - b;
+}
+
+static inline _lm2_simd_f32 _lm2_simd_mul_f32(_lm2_simd_f32 a, _lm2_simd_f32 b) {
+  return a * b;
+}
+
+static inline _lm2_simd_f32 _lm2_simd_div_f32(_lm2_simd_f32 a, _lm2_simd_f32 b) {
+  return a / b;
+}
+
+static inline _lm2_simd_f32 _lm2_simd_min_f32(_lm2_simd_f32 a, _lm2_simd_f32 b) {
+  return (a < b) ? a : b;
+}
+
+static inline _lm2_simd_f32 _lm2_simd_max_f32(_lm2_simd_f32 a, _lm2_simd_f32 b) {
+  return (a > b) ? a : b;
+}
+
+static inline _lm2_simd_f32 _lm2_simd_sqrt_f32(_lm2_simd_f32 a) {
+  return sqrtf(a);
+}
+
+static inline _lm2_simd_f32 _lm2_simd_rcp_nz_f32(_lm2_simd_f32 a) {
+  return (a != 0.0f) ? 1.0f / a : 0.0f;
+}
+
+static inline _lm2_simd_f32 _lm2_simd_abs_f32(_lm2_simd_f32 a) {
+  return fabsf(a);
+}
+
+static inline _lm2_simd_f32 _lm2_simd_select_gt_f32(_lm2_simd_f32 a, _lm2_simd_f32 b, _lm2_simd_f32 t, _lm2_simd_f32 f) {
+  return (a > b) ? t : f;
+}
+
+#endif
+
+// #############################################################################
+// f64 lanes
+// #############################################################################
+
+#if defined(LM2_SIMD_AVX)
+
+#  define _LM2_SIMD_WIDTH_F64 4
+typedef __m256d _lm2_simd_f64;
+
+static inline _lm2_simd_f64 _lm2_simd_load_f64(const double* p) {
+  return _mm256_loadu_pd(p);
+}
+
+static inline void _lm2_simd_store_f64(double* p, _lm2_simd_f64 v) {
+  _mm256_storeu_pd(p, v);
+}
+
+static inline _lm2_simd_f64 _lm2_simd_set1_f64(double s) {
+  return _mm256_set1_pd(s);
+}
+
+static inline _lm2_simd_f64 _lm2_simd_add_f64(_lm2_simd_f64 a, _lm2_simd_f64 b) {
+  return _mm256_add_pd(a, b);
+}
+
+static inline _lm2_simd_f64 _lm2_simd_sub_f64(_lm2_simd_f64 a, _lm2_simd_f64 b) {
+  return _mm256_sub_pd(a, b);
+}
+
+static inline _lm2_simd_f64 _lm2_simd_mul_f64(_lm2_simd_f64 a, _lm2_simd_f64 b) {
+  return _mm256_mul_pd(a, b);
+}
+
+static inline _lm2_simd_f64 _lm2_simd_div_f64(_lm2_simd_f64 a, _lm2_simd_f64 b) {
+  return _mm256_div_pd(a, b);
+}
+
+static inline _lm2_simd_f64 _lm2_simd_min_f64(_lm2_simd_f64 a, _lm2_simd_f64 b) {
+  return _mm256_min_pd(a, b);
+}
+
+static inline _lm2_simd_f64 _lm2_simd_max_f64(_lm2_simd_f64 a, _lm2_simd_f64 b) {
+  return _mm256_max_pd(a, b);
+}
+
+static inline _lm2_simd_f64 _lm2_simd_sqrt_f64(_lm2_simd_f64 a) {
+  return _mm256_sqrt_pd(a);
+}
+
+static inline _lm2_simd_f64 _lm2_simd_rcp_nz_f64(_lm2_simd_f64 a) {
+  __m256d mask = _mm256_cmp_pd(a, _mm256_setzero_pd(), _CMP_NEQ_UQ);
+  return _mm256_and_pd(_mm256_div_pd(_mm256_set1_pd(1.0), a), mask);
+}
+
+static inline _lm2_simd_f64 _lm2_simd_abs_f64(_lm2_simd_f64 a) {
+  return _mm256_andnot_pd(_mm256_set1_pd(-0.0), a);
+}
+
+static inline _lm2_simd_f64 _lm2_simd_select_gt_f64(_lm2_simd_f64 a, _lm2_simd_f64 b, _lm2_simd_f64 t, _lm2_simd_f64 f) {
+  return _mm256_blendv_pd(f, t, _mm256_cmp_pd(a, b, _CMP_GT_OQ));
+}
+
+#elif defined(LM2_SIMD_SSE2)
+
+#  define _LM2_SIMD_WIDTH_F64 2
+typedef __m128d _lm2_simd_f64;
+
+static inline _lm2_simd_f64 _lm2_simd_load_f64(const double* p) {
+  return _mm_loadu_pd(p);
+}
+
+static inline void _lm2_simd_store_f64(double* p, _lm2_simd_f64 v) {
+  _mm_storeu_pd(p, v);
+}
+
+static inline _lm2_simd_f64 _lm2_simd_set1_f64(double s) {
+  return _mm_set1_pd(s);
+}
+
+static inline _lm2_simd_f64 _lm2_simd_add_f64(_lm2_simd_f64 a, _lm2_simd_f64 b) {
+  return _mm_add_pd(a, b);
+}
+
+static inline _lm2_simd_f64 _lm2_simd_sub_f64(_lm2_simd_f64 a, _lm2_simd_f64 b) {
+  return _mm_sub_pd(a, b);
+}
+
+static inline _lm2_simd_f64 _lm2_simd_mul_f64(_lm2_simd_f64 a, _lm2_simd_f64 b) {
+  return _mm_mul_pd(a, b);
+}
+
+static inline _lm2_simd_f64 _lm2_simd_div_f64(_lm2_simd_f64 a, _lm2_simd_f64 b) {
+  return _mm_div_pd(a, b);
+}
+
+static inline _lm2_simd_f64 _lm2_simd_min_f64(_lm2_simd_f64 a, _lm2_simd_f64 b) {
+  return _mm_min_pd(a, b);
+}
+
+static inline _lm2_simd_f64 _lm2_simd_max_f64(_lm2_simd_f64 a, _lm2_simd_f64 b) {
+  return _mm_max_pd(a, b);
+}
+
+static inline _lm2_simd_f64 _lm2_simd_sqrt_f64(_lm2_simd_f64 a) {
+  return _mm_sqrt_pd(a);
+}
+
+static inline _lm2_simd_f64 _lm2_simd_rcp_nz_f64(_lm2_simd_f64 a) {
+  __m128d mask = _mm_cmpneq_pd(a, _mm_setzero_pd());
+  return _mm_and_pd(_mm_div_pd(_mm_set1_pd(1.0), a), mask);
+}
+
+static inline _lm2_simd_f64 _lm2_simd_abs_f64(_lm2_simd_f64 a) {
+  return _mm_andnot_pd(_mm_set1_pd(-0.0), a);
+}
+
+static inline _lm2_simd_f64 _lm2_simd_select_gt_f64(_lm2_simd_f64 a, _lm2_simd_f64 b, _lm2_simd_f64 t, _lm2_simd_f64 f) {
+  __m128d mask = _mm_cmpgt_pd(a, b);
+  return _mm_or_pd(_mm_and_pd(mask, t), _mm_andnot_pd(mask, f));
+}
+
+#elif defined(LM2_SIMD_NEON)
+
+#  define _LM2_SIMD_WIDTH_F64 2
+typedef float64x2_t _lm2_simd_f64;
+
+static inline _lm2_simd_f64 _lm2_simd_load_f64(const double* p) {
+  return vld1q_f64(p);
+}
+
+static inline void _lm2_simd_store_f64(double* p, _lm2_simd_f64 v) {
+  vst1q_f64(p, v);
+}
+
+static inline _lm2_simd_f64 _lm2_simd_set1_f64(double s) {
+  return vdupq_n_f64(s);
+}
+
+static inline _lm2_simd_f64 _lm2_simd_add_f64(_lm2_simd_f64 a, _lm2_simd_f64 b) {
+  return vaddq_f64(a, b);
+}
+
+static inline _lm2_simd_f64 _lm2_simd_sub_f64(_lm2_simd_f64 a, _lm2_simd_f64 b) {
+  return vsubq_f64(a, b);
+}
+
+static inline _lm2_simd_f64 _lm2_simd_mul_f64(_lm2_simd_f64 a, _lm2_simd_f64 b) {
+  return vmulq_f64(a, b);
+}
+
+static inline _lm2_simd_f64 _lm2_simd_div_f64(_lm2_simd_f64 a, _lm2_simd_f64 b) {
+  return vdivq_f64(a, b);
+}
+
+static inline _lm2_simd_f64 _lm2_simd_min_f64(_lm2_simd_f64 a, _lm2_simd_f64 b) {
+  return vbslq_f64(vcltq_f64(a, b), a, b);
+}
+
+static inline _lm2_simd_f64 _lm2_simd_max_f64(_lm2_simd_f64 a, _lm2_simd_f64 b) {
+  return vbslq_f64(vcgtq_f64(a, b), a, b);
+}
+
+static inline _lm2_simd_f64 _lm2_simd_sqrt_f64(_lm2_simd_f64 a) {
+  return vsqrtq_f64(a);
+}
+
+static inline _lm2_simd_f64 _lm2_simd_rcp_nz_f64(_lm2_simd_f64 a) {
+  uint64x2_t zero = vceqq_f64(a, vdupq_n_f64(0.0));
+  return vbslq_f64(zero, vdupq_n_f64(0.0), vdivq_f64(vdupq_n_f64(1.0), a));
+}
+
+static inline _lm2_simd_f64 _lm2_simd_abs_f64(_lm2_simd_f64 a) {
+  return vabsq_f64(a);
+}
+
+static inline _lm2_simd_f64 _lm2_simd_select_gt_f64(_lm2_simd_f64 a, _lm2_simd_f64 b, _lm2_simd_f64 t, _lm2_simd_f64 f) {
+  return vbslq_f64(vcgtq_f64(a, b), t, f);
+}
+
+#else
+
+#  define _LM2_SIMD_WIDTH_F64 1
+typedef double _lm2_simd_f64;
+
+static inline _lm2_simd_f64 _lm2_simd_load_f64(const double* p) {
+  return *p;
+}
+
+static inline void _lm2_simd_store_f64(double* p, _lm2_simd_f64 v) {
+  *p = v;
+}
+
+static inline _lm2_simd_f64 _lm2_simd_set1_f64(double s) {
+  return s;
+}
+
+static inline _lm2_simd_f64 _lm2_simd_add_f64(_lm2_simd_f64 a, _lm2_simd_f64 b) {
+  return a + b;
+}
+
+static inline _lm2_simd_f64 _lm2_simd_sub_f64(_lm2_simd_f64 a, _lm2_simd_f64 b) {
+  return a - b;
+}
+
+static inline _lm2_simd_f64 _lm2_simd_mul_f64(_lm2_simd_f64 a, _lm2_simd_f64 b) {
+  return a * b;
+}
+
+static inline _lm2_simd_f64 _lm2_simd_div_f64(_lm2_simd_f64 a, _lm2_simd_f64 b) {
+  return a / b;
+}
+
+static inline _lm2_simd_f64 _lm2_simd_min_f64(_lm2_simd_f64 a, _lm2_simd_f64 b) {
+  return (a < b) ? a : b;
+}
+
+static inline _lm2_simd_f64 _lm2_simd_max_f64(_lm2_simd_f64 a, _lm2_simd_f64 b) {
+  return (a > b) ? a : b;
+}
+
+static inline _lm2_simd_f64 _lm2_simd_sqrt_f64(_lm2_simd_f64 a) {
+  return sqrt(a);
+}
+
+static inline _lm2_simd_f64 _lm2_simd_rcp_nz_f64(_lm2_simd_f64 a) {
+  return (a != 0.0) ? 1.0 / a : 0.0;
+}
+
+static inline _lm2_simd_f64 _lm2_simd_abs_f64(_lm2_simd_f64 a) {
+  return fabs(a);
+}
+
+static inline _lm2_simd_f64 _lm2_simd_select_gt_f64(_lm2_simd_f64 a, _lm2_simd_f64 b, _lm2_simd_f64 t, _lm2_simd_f64 f) {
+  return (a > b) ? t : f;
+}
+
+#endif
+
+// #############################################################################
+// AoS interleave
+// #############################################################################
+// load2/load3 split one vector width of interleaved {x, y} or {x, y, z} values
+// starting at p into per-component lanes; store2/store3 write them back.
+
+#if defined(LM2_SIMD_SSE2)
+// _mm_shuffle_ps lanes listed in result order
+#  define _LM2_SIMD_SHUF(a, b, i0, i1, i2, i3) _mm_shuffle_ps(a, b, _MM_SHUFFLE(i3, i2, i1, i0))
+
+static inline void _lm2_sse_load2_f32(const float* p, __m128* x, __m128* y) {
+  __m128 a = _mm_loadu_ps(p);
+  __m128 b = _mm_loadu_ps(p + 4);
+  *x = _LM2_SIMD_SHUF(a, b, 0, 2, 0, 2);
+  *y = _LM2_SIMD_SHUF(a, b, 1, 3, 1, 3);
+}
+
+static inline void _lm2_sse_store2_f32(float* p, __m128 x, __m128 y) {
+  _mm_storeu_ps(p, _mm_unpacklo_ps(x, y));
+  _mm_storeu_ps(p + 4, _mm_unpackhi_ps(x, y));
+}
+
+static inline void _lm2_sse_load3_f32(const float* p, __m128* x, __m128* y, __m128* z) {
+  // a = x0 y0 z0 x1, b = y1 z1 x2 y2, c = z2 x3 y3 z3
+  __m128 a = _mm_loadu_ps(p);
+  __m128 b = _mm_loadu_ps(p + 4);
+  __m128 c = _mm_loadu_ps(p + 8);
+  *x = _LM2_SIMD_SHUF(_LM2_SIMD_SHUF(a, a, 0, 3, 0, 3), _LM2_SIMD_SHUF(b, c, 2, 2, 1, 1), 0, 1, 0, 2);
+  *y = _LM2_SIMD_SHUF(_LM2_SIMD_SHUF(a, b, 1, 1, 0, 0), _LM2_SIMD_SHUF(b, c, 3, 3, 2, 2), 0, 2, 0, 2);
+  *z = _LM2_SIMD_SHUF(_LM2_SIMD_SHUF(a, b, 2, 2, 1, 1), _LM2_SIMD_SHUF(c, c, 0, 3, 0, 3), 0, 2, 0, 1);
+}
+
+static inline void _lm2_sse_store3_f32(float* p, __m128 x, __m128 y, __m128 z) {
+  _mm_storeu_ps(p, _LM2_SIMD_SHUF(_LM2_SIMD_SHUF(x, y, 0, 0, 0, 0), _LM2_SIMD_SHUF(z, x, 0, 0, 1, 1), 0, 2, 0, 2));
+  _mm_storeu_ps(p + 4, _LM2_SIMD_SHUF(_LM2_SIMD_SHUF(y, z, 1, 1, 1, 1), _LM2_SIMD_SHUF(x, y, 2, 2, 2, 2), 0, 2, 0, 2));
+  _mm_storeu_ps(p + 8, _LM2_SIMD_SHUF(_LM2_SIMD_SHUF(z, x, 2, 2, 3, 3), _LM2_SIMD_SHUF(y, z, 3, 3, 3, 3), 0, 2, 0, 2));
+}
+
+static inline void _lm2_sse_load2_f64(const double* p, __m128d* x, __m128d* y) {
+  __m128d a = _mm_loadu_pd(p);
+  __m128d b = _mm_loadu_pd(p + 2);
+  *x = _mm_unpacklo_pd(a, b);
+  *y = _mm_unpackhi_pd(a, b);
+}
+
+static inline void _lm2_sse_store2_f64(double* p, __m128d x, __m128d y) {
+  _mm_storeu_pd(p, _mm_unpacklo_pd(x, y));
+  _mm_storeu_pd(p + 2, _mm_unpackhi_pd(x, y));
+}
+
+static inline void _lm2_sse_load3_f64(const double* p, __m128d* x, __m128d* y, __m128d* z) {
+  // a = x0 y0, b = z0 x1, c = y1 z1
+  __m128d a = _mm_loadu_pd(p);
+  __m128d b = _mm_loadu_pd(p + 2);
+  __m128d c = _mm_loadu_pd(p + 4);
+  *x = _mm_shuffle_pd(a, b, 2);
+  *y = _mm_shuffle_pd(a, c, 1);
+  *z = _mm_shuffle_pd(b, c, 2);
+}
+
+static inline void _lm2_sse_store3_f64(double* p, __m128d x, __m128d y, __m128d z) {
+  _mm_storeu_pd(p, _mm_unpacklo_pd(x, y));
+  _mm_storeu_pd(p + 2, _mm_shuffle_pd(z, x, 2));
+  _mm_storeu_pd(p + 4, _mm_unpackhi_pd(y, z));
+}
+#endif
+
+#if defined(LM2_SIMD_AVX)
+// Two 128-bit halves per 256-bit lane
+#  define _LM2_SIMD_JOIN_F32(lo, hi) _mm256_insertf128_ps(_mm256_castps128_ps256(lo), hi, 1)
+#  define _LM2_SIMD_JOIN_F64(lo, hi) _mm256_insertf128_pd(_mm256_castpd128_pd256(lo), hi, 1)
+
+static inline void _lm2_simd_load2_f32(const float* p, _lm2_simd_f32* x, _lm2_simd_f32* y) {
+  __m128 x0, y0, x1, y1;
+  _lm2_sse_load2_f32(p, &x0, &y0);
+  _lm2_sse_load2_f32(p + 8, &x1, &y1);
+  *x = _LM2_SIMD_JOIN_F32(x0, x1);
+  *y = _LM2_SIMD_JOIN_F32(y0, y1);
+}
+
+static inline void _lm2_simd_store2_f32(float* p, _lm2_simd_f32 x, _lm2_simd_f32 y) {
+  _lm2_sse_store2_f32(p, _mm256_castps256_ps128(x), _mm256_castps256_ps128(y));
+  _lm2_sse_store2_f32(p + 8, _mm256_extractf128_ps(x, 1), _mm256_extractf128_ps(y, 1));
+}
+
+static inline void _lm2_simd_load3_f32(const float* p, _lm2_simd_f32* x, _lm2_simd_f32* y, _lm2_simd_f32* z) {
+  __m128 x0, y0, z0, x1, y1, z1;
+  _lm2_sse_load3_f32(p, &x0, &y0, &z0);
+  _lm2_sse_load3_f32(p + 12, &x1, &y1, &z1);
+  *x = _LM2_SIMD_JOIN_F32(x0, x1);
+  *y = _LM2_SIMD_JOIN_F32(y0, y1);
+  *z = _LM2_SIMD_JOIN_F32(z0, z1);
+}
+
+static inline void _lm2_simd_store3_f32(float* p, _lm2_simd_f32 x, _lm2_simd_f32 y, _lm2_simd_f32 z) {
+  _lm2_sse_store3_f32(p, _mm256_castps256_ps128(x), _mm256_castps256_ps128(y), _mm256_castps256_ps128(z));
+  _lm2_sse_store3_f32(p + 12, _mm256_extractf128_ps(x, 1), _mm256_extractf128_ps(y, 1), _mm256_extractf128_ps(z, 1));
+}
+
+static inline void _lm2_simd_load2_f64(const double* p, _lm2_simd_f64* x, _lm2_simd_f64* y) {
+  __m128d x0, y0, x1, y1;
+  _lm2_sse_load2_f64(p, &x0, &y0);
+  _lm2_sse_load2_f64(p + 4, &x1, &y1);
+  *x = _LM2_SIMD_JOIN_F64(x0, x1);
+  *y = _LM2_SIMD_JOIN_F64(y0, y1);
+}
+
+static inline void _lm2_simd_store2_f64(double* p, _lm2_simd_f64 x, _lm2_simd_f64 y) {
+  _lm2_sse_store2_f64(p, _mm256_castpd256_pd128(x), _mm256_castpd256_pd128(y));
+  _lm2_sse_store2_f64(p + 4, _mm256_extractf128_pd(x, 1), _mm256_extractf128_pd(y, 1));
+}
+
+static inline void _lm2_simd_load3_f64(const double* p, _lm2_simd_f64* x, _lm2_simd_f64* y, _lm2_simd_f64* z) {
+  __m128d x0, y0, z0, x1, y1, z1;
+  _lm2_sse_load3_f64(p, &x0, &y0, &z0);
+  _lm2_sse_load3_f64(p + 6, &x1, &y1, &z1);
+  *x = _LM2_SIMD_JOIN_F64(x0, x1);
+  *y = _LM2_SIMD_JOIN_F64(y0, y1);
+  *z = _LM2_SIMD_JOIN_F64(z0, z1);
+}
+
+static inline void _lm2_simd_store3_f64(double* p, _lm2_simd_f64 x, _lm2_simd_f64 y, _lm2_simd_f64 z) {
+  _lm2_sse_store3_f64(p, _mm256_castpd256_pd128(x), _mm256_castpd256_pd128(y), _mm256_castpd256_pd128(z));
+  _lm2_sse_store3_f64(p + 6, _mm256_extractf128_pd(x, 1), _mm256_extractf128_pd(y, 1), _mm256_extractf128_pd(z, 1));
+}
+
+#elif defined(LM2_SIMD_SSE2)
+
+static inline void _lm2_simd_load2_f32(const float* p, _lm2_simd_f32* x, _lm2_simd_f32* y) {
+  _lm2_sse_load2_f32(p, x, y);
+}
+
+static inline void _lm2_simd_store2_f32(float* p, _lm2_simd_f32 x, _lm2_simd_f32 y) {
+  _lm2_sse_store2_f32(p, x, y);
+}
+
+static inline void _lm2_simd_load3_f32(const float* p, _lm2_simd_f32* x, _lm2_simd_f32* y, _lm2_simd_f32* z) {
+  _lm2_sse_load3_f32(p, x, y, z);
+}
+
+static inline void _lm2_simd_store3_f32(float* p, _lm2_simd_f32 x, _lm2_simd_f32 y, _lm2_simd_f32 z) {
+  _lm2_sse_store3_f32(p, x, y, z);
+}
+
+static inline void _lm2_simd_load2_f64(const double* p, _lm2_simd_f64* x, _lm2_simd_f64* y) {
+  _lm2_sse_load2_f64(p, x, y);
+}
+
+static inline void _lm2_simd_store2_f64(double* p, _lm2_simd_f64 x, _lm2_simd_f64 y) {
+  _lm2_sse_store2_f64(p, x, y);
+}
+
+static inline void _lm2_simd_load3_f64(const double* p, _lm2_simd_f64* x, _lm2_simd_f64* y, _lm2_simd_f64* z) {
+  _lm2_sse_load3_f64(p, x, y, z);
+}
+
+static inline void _lm2_simd_store3_f64(double* p, _lm2_simd_f64 x, _lm2_simd_f64 y, _lm2_simd_f64 z) {
+  _lm2_sse_store3_f64(p, x, y, z);
+}
+
+#elif defined(LM2_SIMD_NEON)
+
+static inline void _lm2_simd_load2_f32(const float* p, _lm2_simd_f32* x, _lm2_simd_f32* y) {
+  float32x4x2_t v = vld2q_f32(p);
+  *x = v.val[0];
+  *y = v.val[1];
+}
+
+static inline void _lm2_simd_store2_f32(float* p, _lm2_simd_f32 x, _lm2_simd_f32 y) {
+  float32x4x2_t v = {{x, y}};
+  vst2q_f32(p, v);
+}
+
+static inline void _lm2_simd_load3_f32(const float* p, _lm2_simd_f32* x, _lm2_simd_f32* y, _lm2_simd_f32* z) {
+  float32x4x3_t v = vld3q_f32(p);
+  *x = v.val[0];
+  *y = v.val[1];
+  *z = v.val[2];
+}
+
+static inline void _lm2_simd_store3_f32(float* p, _lm2_simd_f32 x, _lm2_simd_f32 y, _lm2_simd_f32 z) {
+  float32x4x3_t v = {{x, y, z}};
+  vst3q_f32(p, v);
+}
+
+static inline void _lm2_simd_load2_f64(const double* p, _lm2_simd_f64* x, _lm2_simd_f64* y) {
+  float64x2x2_t v = vld2q_f64(p);
+  *x = v.val[0];
+  *y = v.val[1];
+}
+
+static inline void _lm2_simd_store2_f64(double* p, _lm2_simd_f64 x, _lm2_simd_f64 y) {
+  float64x2x2_t v = {{x, y}};
+  vst2q_f64(p, v);
+}
+
+static inline void _lm2_simd_load3_f64(const double* p, _lm2_simd_f64* x, _lm2_simd_f64* y, _lm2_simd_f64* z) {
+  float64x2x3_t v = vld3q_f64(p);
+  *x = v.val[0];
+  *y = v.val[1];
+  *z = v.val[2];
+}
+
+static inline void _lm2_simd_store3_f64(double* p, _lm2_simd_f64 x, _lm2_simd_f64 y, _lm2_simd_f64 z) {
+  float64x2x3_t v = {{x, y, z}};
+  vst3q_f64(p, v);
+}
+
+#else
+
+static inline void _lm2_simd_load2_f32(const float* p, _lm2_simd_f32* x, _lm2_simd_f32* y) {
+  *x = p[0];
+  *y = p[1];
+}
+
+static inline void _lm2_simd_store2_f32(float* p, _lm2_simd_f32 x, _lm2_simd_f32 y) {
+  p[0] = x;
+  p[1] = y;
+}
+
+static inline void _lm2_simd_load3_f32(const float* p, _lm2_simd_f32* x, _lm2_simd_f32* y, _lm2_simd_f32* z) {
+  *x = p[0];
+  *y = p[1];
+  *z = p[2];
+}
+
+static inline void _lm2_simd_store3_f32(float* p, _lm2_simd_f32 x, _lm2_simd_f32 y, _lm2_simd_f32 z) {
+  p[0] = x;
+  p[1] = y;
+  p[2] = z;
+}
+
+static inline void _lm2_simd_load2_f64(const double* p, _lm2_simd_f64* x, _lm2_simd_f64* y) {
+  *x = p[0];
+  *y = p[1];
+}
+
+static inline void _lm2_simd_store2_f64(double* p, _lm2_simd_f64 x, _lm2_simd_f64 y) {
+  p[0] = x;
+  p[1] = y;
+}
+
+static inline void _lm2_simd_load3_f64(const double* p, _lm2_simd_f64* x, _lm2_simd_f64* y, _lm2_simd_f64* z) {
+  *x = p[0];
+  *y = p[1];
+  *z = p[2];
+}
+
+static inline void _lm2_simd_store3_f64(double* p, _lm2_simd_f64 x, _lm2_simd_f64 y, _lm2_simd_f64 z) {
+  p[0] = x;
+  p[1] = y;
+  p[2] = z;
+}
+
+#endif
+
+// #############################################################################
+// 4-wide rows
+// #############################################################################
+// Fixed four-element lanes for row-broadcast 4x4 matrix kernels and 4-wide ray
+// packets, independent of the native width: one SSE/NEON register for f32, one
+// AVX register (or two SSE2/NEON registers) for f64.
+
+#if defined(LM2_SIMD_SSE2)
+
+typedef __m128 _lm2_row4_f32;
+
+static inline _lm2_row4_f32 _lm2_row4_load_f32(const float* p) {
+  return _mm_loadu_ps(p);
+}
+
+static inline void _lm2_row4_store_f32(float* p, _lm2_row4_f32 v) {
+  _mm_storeu_ps(p, v);
+}
+
+static inline _lm2_row4_f32 _lm2_row4_set1_f32(float s) {
+  return _mm_set1_ps(s);
+}
+
+static inline _lm2_row4_f32 _lm2_row4_add_f32(_lm2_row4_f32 a, _lm2_row4_f32 b) {
+  return _mm_add_ps(a, b);
+}
+
+static inline _lm2_row4_f32 _lm2_row4_mul_f32(_lm2_row4_f32 a, _lm2_row4_f32 b) {
+  return _mm_mul_ps(a, b);
+}
+
+static inline _lm2_row4_f32 _lm2_row4_sub_f32(_lm2_row4_f32 a, _lm2_row4_f32 b) {
+  return _mm_sub_ps(a, b);
+}
+
+static inline _lm2_row4_f32 _lm2_row4_div_f32(_lm2_row4_f32 a, _lm2_row4_f32 b) {
+  return _mm_div_ps(a, b);
+}
+
+static inline _lm2_row4_f32 _lm2_row4_min_f32(_lm2_row4_f32 a, _lm2_row4_f32 b) {
+  return _mm_min_ps(a, b);
+}
+
+static inline _lm2_row4_f32 _lm2_row4_max_f32(_lm2_row4_f32 a, _lm2_row4_f32 b) {
+  return _mm_max_ps(a, b);
+}
+
+static inline _lm2_row4_f32 _lm2_row4_abs_f32(_lm2_row4_f32 a) {
+  return _mm_andnot_ps(_mm_set1_ps(-0.0f), a);
+}
+
+static inline _lm2_row4_f32 _lm2_row4_select_gt_f32(_lm2_row4_f32 a, _lm2_row4_f32 b, _lm2_row4_f32 t, _lm2_row4_f32 f) {
+  __m128 mask = _mm_cmpgt_ps(a, b);
+  return _mm_or_ps(_mm_and_ps(mask, t), _mm_andnot_ps(mask, f));
+}
+
+#elif defined(LM2_SIMD_NEON)
+
+typedef float32x4_t _lm2_row4_f32;
+
+static inline _lm2_row4_f32 _lm2_row4_load_f32(const float* p) {
+  return vld1q_f32(p);
+}
+
+static inline void _lm2_row4_store_f32(float* p, _lm2_row4_f32 v) {
+  vst1q_f32(p, v);
+}
+
+static inline _lm2_row4_f32 _lm2_row4_set1_f32(float s) {
+  return vdupq_n_f32(s);
+}
+
+static inline _lm2_row4_f32 _lm2_row4_add_f32(_lm2_row4_f32 a, _lm2_row4_f32 b) {
+  return vaddq_f32(a, b);
+}
+
+static inline _lm2_row4_f32 _lm2_row4_mul_f32(_lm2_row4_f32 a, _lm2_row4_f32 b) {
+  return vmulq_f32(a, b);
+}
+
+static inline _lm2_row4_f32 _lm2_row4_sub_f32(_lm2_row4_f32 a, _lm2_row4_f32 b) {
+  return vsubq_f32(a, b);
+}
+
+static inline _lm2_row4_f32 _lm2_row4_div_f32(_lm2_row4_f32 a, _lm2_row4_f32 b) {
+  return vdivq_f32(a, b);
+}
+
+static inline _lm2_row4_f32 _lm2_row4_min_f32(_lm2_row4_f32 a, _lm2_row4_f32 b) {
+  return vminq_f32(a, b);
+}
+
+static inline _lm2_row4_f32 _lm2_row4_max_f32(_lm2_row4_f32 a, _lm2_row4_f32 b) {
+  return vmaxq_f32(a, b);
+}
+
+static inline _lm2_row4_f32 _lm2_row4_abs_f32(_lm2_row4_f32 a) {
+  return vabsq_f32(a);
+}
+
+static inline _lm2_row4_f32 _lm2_row4_select_gt_f32(_lm2_row4_f32 a, _lm2_row4_f32 b, _lm2_row4_f32 t, _lm2_row4_f32 f) {
+  return vbslq_f32(vcgtq_f32(a, b), t, f);
+}
+
+#else
+
+typedef struct _lm2_row4_f32 {
+  float v[4];
+} _lm2_row4_f32;
+
+static inline _lm2_row4_f32 _lm2_row4_load_f32(const float* p) {
+  _lm2_row4_f32 r = {{p[0], p[1], p[2], p[3]}};
+  return r;
+}
+
+static inline void _lm2_row4_store_f32(float* p, _lm2_row4_f32 v) {
+  p[0] = v.v[0];
+  p[1] = v.v[1];
+  p[2] = v.v[2];
+  p[3] = v.v[3];
+}
+
+static inline _lm2_row4_f32 _lm2_row4_set1_f32(float s) {
+  _lm2_row4_f32 r = {{s, s, s, s}};
+  return r;
+}
+
+static inline _lm2_row4_f32 _lm2_row4_add_f32(_lm2_row4_f32 a, _lm2_row4_f32 b) {
+  _lm2_row4_f32 r = {{a.v[0] + b.v[0], a.v[1] + b.v[1], a.v[2] + b.v[2], a.v[3] + b.v[3]}};
+  return r;
+}
+
+static inline _lm2_row4_f32 _lm2_row4_mul_f32(_lm2_row4_f32 a, _lm2_row4_f32 b) {
+  _lm2_row4_f32 r = {{a.v[0] * b.v[0], a.v[1] * b.v[1], a.v[2] * b.v[2], a.v[3] * b.v[3]}};
+  return r;
+}
+
+static inline _lm2_row4_f32 _lm2_row4_sub_f32(_lm2_row4_f32 a, _lm2_row4_f32 b) {
+  _lm2_row4_f32 r = {{a.v[0] - b.v[0], a.v[1] - b.v[1], a.v[2] - b.v[2], a.v[3] - b.v[3]}};
+  return r;
+}
+
+static inline _lm2_row4_f32 _lm2_row4_div_f32(_lm2_row4_f32 a, _lm2_row4_f32 b) {
+  _lm2_row4_f32 r = {{a.v[0] / b.v[0], a.v[1] / b.v[1], a.v[2] / b.v[2], a.v[3] / b.v[3]}};
+  return r;
+}
+
+static inline _lm2_row4_f32 _lm2_row4_min_f32(_lm2_row4_f32 a, _lm2_row4_f32 b) {
+  _lm2_row4_f32 r;
+  for (int i = 0; i < 4; i++) {
+    r.v[i] = a.v[i] < b.v[i] ? a.v[i] : b.v[i];
+  }
+  return r;
+}
+
+static inline _lm2_row4_f32 _lm2_row4_max_f32(_lm2_row4_f32 a, _lm2_row4_f32 b) {
+  _lm2_row4_f32 r;
+  for (int i = 0; i < 4; i++) {
+    r.v[i] = a.v[i] > b.v[i] ? a.v[i] : b.v[i];
+  }
+  return r;
+}
+
+static inline _lm2_row4_f32 _lm2_row4_abs_f32(_lm2_row4_f32 a) {
+  _lm2_row4_f32 r;
+  for (int i = 0; i < 4; i++) {
+    r.v[i] = a.v[i] < 0 ? -a.v[i] : a.v[i];
+  }
+  return r;
+}
+
+static inline _lm2_row4_f32 _lm2_row4_select_gt_f32(_lm2_row4_f32 a, _lm2_row4_f32 b, _lm2_row4_f32 t, _lm2_row4_f32 f) {
+  _lm2_row4_f32 r;
+  for (int i = 0; i < 4; i++) {
+    r.v[i] = a.v[i] > b.v[i] ? t.v[i] : f.v[i];
+  }
+  return r;
+}
+
+#endif
+
+#if defined(LM2_SIMD_AVX)
+
+typedef __m256d _lm2_row4_f64;
+
+static inline _lm2_row4_f64 _lm2_row4_load_f64(const double* p) {
+  return _mm256_loadu_pd(p);
+}
+
+static inline void _lm2_row4_store_f64(double* p, _lm2_row4_f64 v) {
+  _mm256_storeu_pd(p, v);
+}
+
+static inline _lm2_row4_f64 _lm2_row4_set1_f64(double s) {
+  return _mm256_set1_pd(s);
+}
+
+static inline _lm2_row4_f64 _lm2_row4_add_f64(_lm2_row4_f64 a, _lm2_row4_f64 b) {
+  return _mm256_add_pd(a, b);
+}
+
+static inline _lm2_row4_f64 _lm2_row4_mul_f64(_lm2_row4_f64 a, _lm2_row4_f64 b) {
+  return _mm256_mul_pd(a, b);
+}
+
+static inline _lm2_row4_f64 _lm2_row4_sub_f64(_lm2_row4_f64 a, _lm2_row4_f64 b) {
+  return _mm256_sub_pd(a, b);
+}
+
+static inline _lm2_row4_f64 _lm2_row4_div_f64(_lm2_row4_f64 a, _lm2_row4_f64 b) {
+  return _mm256_div_pd(a, b);
+}
+
+static inline _lm2_row4_f64 _lm2_row4_min_f64(_lm2_row4_f64 a, _lm2_row4_f64 b) {
+  return _mm256_min_pd(a, b);
+}
+
+static inline _lm2_row4_f64 _lm2_row4_max_f64(_lm2_row4_f64 a, _lm2_row4_f64 b) {
+  return _mm256_max_pd(a, b);
+}
+
+static inline _lm2_row4_f64 _lm2_row4_abs_f64(_lm2_row4_f64 a) {
+  return _mm256_andnot_pd(_mm256_set1_pd(-0.0), a);
+}
+
+static inline _lm2_row4_f64 _lm2_row4_select_gt_f64(_lm2_row4_f64 a, _lm2_row4_f64 b, _lm2_row4_f64 t, _lm2_row4_f64 f) {
+  return _mm256_blendv_pd(f, t, _mm256_cmp_pd(a, b, _CMP_GT_OQ));
+}
+
+#elif defined(LM2_SIMD_SSE2) || defined(LM2_SIMD_NEON)
+
+typedef struct _lm2_row4_f64 {
+  _lm2_simd_f64 lo;
+  _lm2_simd_f64 hi;
+} _lm2_row4_f64;
+
+static inline _lm2_row4_f64 _lm2_row4_load_f64(const double* p) {
+  _lm2_row4_f64 r = {_lm2_simd_load_f64(p), _lm2_simd_load_f64(p + 2)};
+  return r;
+}
+
+static inline void _lm2_row4_store_f64(double* p, _lm2_row4_f64 v) {
+  _lm2_simd_store_f64(p, v.lo);
+  _lm2_simd_store_f64(p + 2, v.hi);
+}
+
+static inline _lm2_row4_f64 _lm2_row4_set1_f64(double s) {
+  _lm2_row4_f64 r = {_lm2_simd_set1_f64(s), _lm2_simd_set1_f64(s)};
+  return r;
+}
+
+static inline _lm2_row4_f64 _lm2_row4_add_f64(_lm2_row4_f64 a, _lm2_row4_f64 b) {
+  _lm2_row4_f64 r = {_lm2_simd_add_f64(a.lo, b.lo), _lm2_simd_add_f64(a.hi, b.hi)};
+  return r;
+}
+
+static inline _lm2_row4_f64 _lm2_row4_mul_f64(_lm2_row4_f64 a, _lm2_row4_f64 b) {
+  _lm2_row4_f64 r = {_lm2_simd_mul_f64(a.lo, b.lo), _lm2_simd_mul_f64(a.hi, b.hi)};
+  return r;
+}
+
+static inline _lm2_row4_f64 _lm2_row4_sub_f64(_lm2_row4_f64 a, _lm2_row4_f64 b) {
+  _lm2_row4_f64 r = {_lm2_simd_sub_f64(a.lo, b.lo), _lm2_simd_sub_f64(a.hi, b.hi)};
+  return r;
+}
+
+static inline _lm2_row4_f64 _lm2_row4_div_f64(_lm2_row4_f64 a, _lm2_row4_f64 b) {
+  _lm2_row4_f64 r = {_lm2_simd_div_f64(a.lo, b.lo), _lm2_simd_div_f64(a.hi, b.hi)};
+  return r;
+}
+
+static inline _lm2_row4_f64 _lm2_row4_min_f64(_lm2_row4_f64 a, _lm2_row4_f64 b) {
+  _lm2_row4_f64 r = {_lm2_simd_min_f64(a.lo, b.lo), _lm2_simd_min_f64(a.hi, b.hi)};
+  return r;
+}
+
+static inline _lm2_row4_f64 _lm2_row4_max_f64(_lm2_row4_f64 a, _lm2_row4_f64 b) {
+  _lm2_row4_f64 r = {_lm2_simd_max_f64(a.lo, b.lo), _lm2_simd_max_f64(a.hi, b.hi)};
+  return r;
+}
+
+static inline _lm2_row4_f64 _lm2_row4_abs_f64(_lm2_row4_f64 a) {
+  _lm2_row4_f64 r = {_lm2_simd_abs_f64(a.lo), _lm2_simd_abs_f64(a.hi)};
+  return r;
+}
+
+static inline _lm2_row4_f64 _lm2_row4_select_gt_f64(_lm2_row4_f64 a, _lm2_row4_f64 b, _lm2_row4_f64 t, _lm2_row4_f64 f) {
+  _lm2_row4_f64 r = {_lm2_simd_select_gt_f64(a.lo, b.lo, t.lo, f.lo), _lm2_simd_select_gt_f64(a.hi, b.hi, t.hi, f.hi)};
+  return r;
+}
+
+#else
+
+typedef struct _lm2_row4_f64 {
+  double v[4];
+} _lm2_row4_f64;
+
+static inline _lm2_row4_f64 _lm2_row4_load_f64(const double* p) {
+  _lm2_row4_f64 r = {{p[0], p[1], p[2], p[3]}};
+  return r;
+}
+
+static inline void _lm2_row4_store_f64(double* p, _lm2_row4_f64 v) {
+  p[0] = v.v[0];
+  p[1] = v.v[1];
+  p[2] = v.v[2];
+  p[3] = v.v[3];
+}
+
+static inline _lm2_row4_f64 _lm2_row4_set1_f64(double s) {
+  _lm2_row4_f64 r = {{s, s, s, s}};
+  return r;
+}
+
+static inline _lm2_row4_f64 _lm2_row4_add_f64(_lm2_row4_f64 a, _lm2_row4_f64 b) {
+  _lm2_row4_f64 r = {{a.v[0] + b.v[0], a.v[1] + b.v[1], a.v[2] + b.v[2], a.v[3] + b.v[3]}};
+  return r;
+}
+
+static inline _lm2_row4_f64 _lm2_row4_mul_f64(_lm2_row4_f64 a, _lm2_row4_f64 b) {
+  _lm2_row4_f64 r = {{a.v[0] * b.v[0], a.v[1] * b.v[1], a.v[2] * b.v[2], a.v[3] * b.v[3]}};
+  return r;
+}
+
+static inline _lm2_row4_f64 _lm2_row4_sub_f64(_lm2_row4_f64 a, _lm2_row4_f64 b) {
+  _lm2_row4_f64 r = {{a.v[0] - b.v[0], a.v[1] - b.v[1], a.v[2] - b.v[2], a.v[3] - b.v[3]}};
+  return r;
+}
+
+static inline _lm2_row4_f64 _lm2_row4_div_f64(_lm2_row4_f64 a, _lm2_row4_f64 b) {
+  _lm2_row4_f64 r = {{a.v[0] / b.v[0], a.v[1] / b.v[1], a.v[2] / b.v[2], a.v[3] / b.v[3]}};
+  return r;
+}
+
+static inline _lm2_row4_f64 _lm2_row4_min_f64(_lm2_row4_f64 a, _lm2_row4_f64 b) {
+  _lm2_row4_f64 r;
+  for (int i = 0; i < 4; i++) {
+    r.v[i] = a.v[i] < b.v[i] ? a.v[i] : b.v[i];
+  }
+  return r;
+}
+
+static inline _lm2_row4_f64 _lm2_row4_max_f64(_lm2_row4_f64 a, _lm2_row4_f64 b) {
+  _lm2_row4_f64 r;
+  for (int i = 0; i < 4; i++) {
+    r.v[i] = a.v[i] > b.v[i] ? a.v[i] : b.v[i];
+  }
+  return r;
+}
+
+static inline _lm2_row4_f64 _lm2_row4_abs_f64(_lm2_row4_f64 a) {
+  _lm2_row4_f64 r;
+  for (int i = 0; i < 4; i++) {
+    r.v[i] = a.v[i] < 0 ? -a.v[i] : a.v[i];
+  }
+  return r;
+}
+
+static inline _lm2_row4_f64 _lm2_row4_select_gt_f64(_lm2_row4_f64 a, _lm2_row4_f64 b, _lm2_row4_f64 t, _lm2_row4_f64 f) {
+  _lm2_row4_f64 r;
+  for (int i = 0; i < 4; i++) {
+    r.v[i] = a.v[i] > b.v[i] ? t.v[i] : f.v[i];
+  }
+  return r;
+}
+
+#endif
+
+// #############################################################################
+// Lane comparisons
+// #############################################################################
+// le_mask(a, b) returns a bitmask with bit i set where lane i of a <= lane i of
+// b. Comparisons are ordered: lanes holding a NaN never set their bit.
+
+#if defined(LM2_SIMD_AVX)
+
+static inline int _lm2_simd_le_mask_f32(_lm2_simd_f32 a, _lm2_simd_f32 b) {
+  return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_LE_OQ));
+}
+
+static inline int _lm2_simd_le_mask_f64(_lm2_simd_f64 a, _lm2_simd_f64 b) {
+  return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_LE_OQ));
+}
+
+#elif defined(LM2_SIMD_SSE2)
+
+static inline int _lm2_simd_le_mask_f32(_lm2_simd_f32 a, _lm2_simd_f32 b) {
+  return _mm_movemask_ps(_mm_cmple_ps(a, b));
+}
+
+static inline int _lm2_simd_le_mask_f64(_lm2_simd_f64 a, _lm2_simd_f64 b) {
+  return _mm_movemask_pd(_mm_cmple_pd(a, b));
+}
+
+#elif defined(LM2_SIMD_NEON)
+
+static inline int _lm2_simd_le_mask_f32(_lm2_simd_f32 a, _lm2_simd_f32 b) {
+  static const uint32_t bits[4] = {1, 2, 4, 8};
+  return (int)vaddvq_u32(vandq_u32(vcleq_f32(a, b), vld1q_u32(bits)));
+}
+
+static inline int _lm2_simd_le_mask_f64(_lm2_simd_f64 a, _lm2_simd_f64 b) {
+  static const uint64_t bits[2] = {1, 2};
+  return (int)vaddvq_u64(vandq_u64(vcleq_f64(a, b), vld1q_u64(bits)));
+}
+
+#else
+
+static inline int _lm2_simd_le_mask_f32(_lm2_simd_f32 a, _lm2_simd_f32 b) {
+  return a <= b;
+}
+
+static inline int _lm2_simd_le_mask_f64(_lm2_simd_f64 a, _lm2_simd_f64 b) {
+  return a <= b;
+}
+
+#endif
+
+// Same for the 4-wide rows, bit i for element i
+#if defined(LM2_SIMD_SSE2)
+
+static inline int _lm2_row4_le_mask_f32(_lm2_row4_f32 a, _lm2_row4_f32 b) {
+  return _mm_movemask_ps(_mm_cmple_ps(a, b));
+}
+
+#elif defined(LM2_SIMD_NEON)
+
+static inline int _lm2_row4_le_mask_f32(_lm2_row4_f32 a, _lm2_row4_f32 b) {
+  static const uint32_t bits[4] = {1, 2, 4, 8};
+  return (int)vaddvq_u32(vandq_u32(vcleq_f32(a, b), vld1q_u32(bits)));
+}
+
+#else
+
+static inline int _lm2_row4_le_mask_f32(_lm2_row4_f32 a, _lm2_row4_f32 b) {
+  return (a.v[0] <= b.v[0]) | (a.v[1] <= b.v[1]) << 1 | (a.v[2] <= b.v[2]) << 2 | (a.v[3] <= b.v[3]) << 3;
+}
+
+#endif
+
+#if defined(LM2_SIMD_AVX)
+
+static inline int _lm2_row4_le_mask_f64(_lm2_row4_f64 a, _lm2_row4_f64 b) {
+  return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_LE_OQ));
+}
+
+#elif defined(LM2_SIMD_SSE2) || defined(LM2_SIMD_NEON)
+
+static inline int _lm2_row4_le_mask_f64(_lm2_row4_f64 a, _lm2_row4_f64 b) {
+  return _lm2_simd_le_mask_f64(a.lo, b.lo) | _lm2_simd_le_mask_f64(a.hi, b.hi) << 2;
+}
+
+#else
+
+static inline int _lm2_row4_le_mask_f64(_lm2_row4_f64 a, _lm2_row4_f64 b) {
+  return (a.v[0] <= b.v[0]) | (a.v[1] <= b.v[1]) << 1 | (a.v[2] <= b.v[2]) << 2 | (a.v[3] <= b.v[3]) << 3;
+}
+
+#endif
+
+// #############################################################################
+// Scalar lanes for the remainder loops
+// #############################################################################
+// Same names and semantics as the lane ops above with a width of one, so a
+// kernel body written against a prefix (_lm2_simd or _lm2_scalar) can be
+// expanded for both the vector loop and the remainder loop.
+
+typedef float _lm2_scalar_f32;
+typedef double _lm2_scalar_f64;
+
+static inline float _lm2_scalar_load_f32(const float* p) {
+  return *p;
+}
+
+static inline void _lm2_scalar_store_f32(float* p, float v) {
+  *p = v;
+}
+
+static inline float _lm2_scalar_set1_f32(float s) {
+  return s;
+}
+
+static inline float _lm2_scalar_add_f32(float a, float b) {
+  return a + b;
+}
+
+static inline float _lm2_scalar_sub_f32(float a, float b) {
+  return a - b;
+}
+
+static inline float _lm2_scalar_mul_f32(float a, float b) {
+  return a * b;
+}
+
+static inline float _lm2_scalar_div_f32(float a, float b) {
+  return a / b;
+}
+
+static inline float _lm2_scalar_min_f32(float a, float b) {
+  return (a < b) ? a : b;
+}
+
+static inline float _lm2_scalar_max_f32(float a, float b) {
+  return (a > b) ? a : b;
+}
+
+static inline float _lm2_scalar_sqrt_f32(float a) {
+  return sqrtf(a);
+}
+
+static inline float _lm2_scalar_rcp_nz_f32(float a) {
+  return (a != 0.0f) ? 1.0f / a : 0.0f;
+}
+
+static inline float _lm2_scalar_abs_f32(float a) {
+  return fabsf(a);
+}
+
+static inline float _lm2_scalar_select_gt_f32(float a, float b, float t, float f) {
+  return (a > b) ? t : f;
+}
+
+static inline double _lm2_scalar_load_f64(const double* p) {
+  return *p;
+}
+
+static inline void _lm2_scalar_store_f64(double* p, double v) {
+  *p = v;
+}
+
+static inline double _lm2_scalar_set1_f64(double s) {
+  return s;
+}
+
+static inline double _lm2_scalar_add_f64(double a, double b) {
+  return a + b;
+}
+
+static inline double _lm2_scalar_sub_f64(double a, double b) {
+  return a - b;
+}
+
+static inline double _lm2_scalar_mul_f64(double a, double b) {
+  return a * b;
+}
+
+static inline double _lm2_scalar_div_f64(double a, double b) {
+  return a / b;
+}
+
+static inline double _lm2_scalar_min_f64(double a, double b) {
+  return (a < b) ? a : b;
+}
+
+static inline double _lm2_scalar_max_f64(double a, double b) {
+  return (a > b) ? a : b;
+}
+
+static inline double _lm2_scalar_sqrt_f64(double a) {
+  return sqrt(a);
+}
+
+static inline double _lm2_scalar_rcp_nz_f64(double a) {
+  return (a != 0.0) ? 1.0 / a : 0.0;
+}
+
+static inline double _lm2_scalar_abs_f64(double a) {
+  return fabs(a);
+}
+
+static inline double _lm2_scalar_select_gt_f64(double a, double b, double t, double f) {
+  return (a > b) ? t : f;
+}
+
+// Lower-case width aliases so kernel macros can paste the type suffix
+#define _lm2_simd_width_f32 _LM2_SIMD_WIDTH_F32
+#define _lm2_simd_width_f64 _LM2_SIMD_WIDTH_F64
+
+// Runs BODY(_lm2_simd, S, i, X) over full vectors, then BODY(_lm2_scalar, S, i, X)
+// over the remaining elements
+#define _LM2_SIMD_LOOP(S, count, BODY, X)                                          \
+  do {                                                                             \
+    size_t _lm2_n = (count);                                                       \
+    size_t i = 0;                                                                  \
+    for (; i + _lm2_simd_width_##S <= _lm2_n; i += _lm2_simd_width_##S) {          \
+      BODY(_lm2_simd, S, i, X)                                                     \
+    }                                                                              \
+    for (; i < _lm2_n; i++) {                                                      \
+      BODY(_lm2_scalar, S, i, X)                                                   \
+    }                                                                              \
+  } while (0)
@@ -0,0 +1,459 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <lm2/vectors/lm2_vector_soa.h>
+#include "lm2_simd.h"
+
+// =============================================================================
+// Kernel bodies
+// =============================================================================
+// Each body is expanded by _LM2_SIMD_LOOP with P = _lm2_simd for the vector
+// loop and P = _lm2_scalar for the remainder, so both share one definition.
+
+#define _LM2_LD(P, S, ptr, i) P##_load_##S((ptr) + (i))
+
+#define _LM2_SOA_BINARY_BODY(P, S, i, op)                                           \
+  P##_store_##S(out + i, P##_##op##_##S(_LM2_LD(P, S, a, i), _LM2_LD(P, S, b, i)));
+
+#define _LM2_SOA_SCALAR_BODY(P, S, i, op)                                       \
+  P##_store_##S(out + i, P##_##op##_##S(_LM2_LD(P, S, a, i), P##_set1_##S(s)));
+
+#define _LM2_SOA_CLAMP_BODY(P, S, i, _)                                                                      \
+  P##_store_##S(out + i, P##_min_##S(P##_max_##S(_LM2_LD(P, S, a, i), P##_set1_##S(lo)), P##_set1_##S(hi)));
+
+#define _LM2_SOA_LERP_BODY(P, S, i, _)                                         \
+  {                                                                            \
+    P##_##S va = _LM2_LD(P, S, a, i);                                          \
+    P##_##S vd = P##_sub_##S(_LM2_LD(P, S, b, i), va);                         \
+    P##_store_##S(out + i, P##_add_##S(va, P##_mul_##S(P##_set1_##S(t), vd))); \
+  }
+
+// Dot products of two streams at element i
+#define _LM2_SOA_DOT2(P, S, a, b, i)                                     \
+  P##_add_##S(P##_mul_##S(_LM2_LD(P, S, a.x, i), _LM2_LD(P, S, b.x, i)), \
+              P##_mul_##S(_LM2_LD(P, S, a.y, i), _LM2_LD(P, S, b.y, i)))
+
+#define _LM2_SOA_DOT3(P, S, a, b, i)                                                                   \
+  P##_add_##S(_LM2_SOA_DOT2(P, S, a, b, i), P##_mul_##S(_LM2_LD(P, S, a.z, i), _LM2_LD(P, S, b.z, i)))
+
+#define _LM2_SOA_DOT4(P, S, a, b, i)                                                                   \
+  P##_add_##S(_LM2_SOA_DOT3(P, S, a, b, i), P##_mul_##S(_LM2_LD(P, S, a.w, i), _LM2_LD(P, S, b.w, i)))
+
+#define _LM2_SOA_DOT_BODY(P, S, i, dim)                     \
+  P##_store_##S(out + i, _LM2_SOA_DOT##dim(P, S, a, b, i));
+
+#define _LM2_SOA_LENGTH_BODY(P, S, i, dim)                                \
+  P##_store_##S(out + i, P##_sqrt_##S(_LM2_SOA_DOT##dim(P, S, a, a, i)));
+
+#define _LM2_SOA_DISTANCE_BODY(P, S, i, dim)   \
+  {                                            \
+    P##_##S sum = P##_set1_##S(0);             \
+    _LM2_SOA_DISTANCE_TERMS##dim(P, S, i)      \
+    P##_store_##S(out + i, P##_sqrt_##S(sum)); \
+  }
+
+#define _LM2_SOA_DISTANCE_TERM(P, S, i, c)                                 \
+  {                                                                        \
+    P##_##S d = P##_sub_##S(_LM2_LD(P, S, b.c, i), _LM2_LD(P, S, a.c, i)); \
+    sum = P##_add_##S(sum, P##_mul_##S(d, d));                             \
+  }
+
+#define _LM2_SOA_DISTANCE_TERMS2(P, S, i) _LM2_SOA_DISTANCE_TERM(P, S, i, x) _LM2_SOA_DISTANCE_TERM(P, S, i, y)
+#define _LM2_SOA_DISTANCE_TERMS3(P, S, i) _LM2_SOA_DISTANCE_TERMS2(P, S, i) _LM2_SOA_DISTANCE_TERM(P, S, i, z)
+#define _LM2_SOA_DISTANCE_TERMS4(P, S, i) _LM2_SOA_DISTANCE_TERMS3(P, S, i) _LM2_SOA_DISTANCE_TERM(P, S, i, w)
+
+#define _LM2_SOA_NORM_TERM(P, S, i, c)                               \
+  P##_store_##S(out.c + i, P##_mul_##S(_LM2_LD(P, S, a.c, i), inv));
+
+#define _LM2_SOA_NORM_BODY(P, S, i, dim)                                          \
+  {                                                                               \
+    P##_##S inv = P##_rcp_nz_##S(P##_sqrt_##S(_LM2_SOA_DOT##dim(P, S, a, a, i))); \
+    _LM2_SOA_NORM_TERMS##dim(P, S, i)                                             \
+  }
+
+#define _LM2_SOA_NORM_TERMS2(P, S, i) _LM2_SOA_NORM_TERM(P, S, i, x) _LM2_SOA_NORM_TERM(P, S, i, y)
+#define _LM2_SOA_NORM_TERMS3(P, S, i) _LM2_SOA_NORM_TERMS2(P, S, i) _LM2_SOA_NORM_TERM(P, S, i, z)
+#define _LM2_SOA_NORM_TERMS4(P, S, i) _LM2_SOA_NORM_TERMS3(P, S, i) _LM2_SOA_NORM_TERM(P, S, i, w)
+
+#define _LM2_SOA_CROSS_BODY(P, S, i, _)                                              \
+  {                                                                                  \
+    P##_##S ax = _LM2_LD(P, S, a.x, i), ay = _LM2_LD(P, S, a.y, i);                  \
+    P##_##S az = _LM2_LD(P, S, a.z, i), bx = _LM2_LD(P, S, b.x, i);                  \
+    P##_##S by = _LM2_LD(P, S, b.y, i), bz = _LM2_LD(P, S, b.z, i);                  \
+    P##_store_##S(out.x + i, P##_sub_##S(P##_mul_##S(ay, bz), P##_mul_##S(az, by))); \
+    P##_store_##S(out.y + i, P##_sub_##S(P##_mul_##S(az, bx), P##_mul_##S(ax, bz))); \
+    P##_store_##S(out.z + i, P##_sub_##S(P##_mul_##S(ax, by), P##_mul_##S(ay, bx))); \
+  }
+
+#define _LM2_SOA_REFLECT_TERM(P, S, i, c)                                                                   \
+  P##_store_##S(out.c + i, P##_sub_##S(_LM2_LD(P, S, v.c, i), P##_mul_##S(f, _LM2_LD(P, S, normal.c, i))));
+
+#define _LM2_SOA_REFLECT_BODY(P, S, i, dim)                                          \
+  {                                                                                  \
+    P##_##S f = P##_mul_##S(P##_set1_##S(2), _LM2_SOA_DOT##dim(P, S, v, normal, i)); \
+    _LM2_SOA_REFLECT_TERMS##dim(P, S, i)                                             \
+  }
+
+#define _LM2_SOA_REFLECT_TERMS2(P, S, i) _LM2_SOA_REFLECT_TERM(P, S, i, x) _LM2_SOA_REFLECT_TERM(P, S, i, y)
+#define _LM2_SOA_REFLECT_TERMS3(P, S, i) _LM2_SOA_REFLECT_TERMS2(P, S, i) _LM2_SOA_REFLECT_TERM(P, S, i, z)
+
+// =============================================================================
+// Single-array kernels
+// =============================================================================
+// Component-wise operations run once per component array.
+
+#define _LM2_IMPL_SOA_ARRAY_BINARY(scalar_type, scalar_suffix, op_name)                                                          \
+  static void _lm2_soa_##op_name##_##scalar_suffix(const scalar_type* a, const scalar_type* b, scalar_type* out, size_t count) { \
+    _LM2_SIMD_LOOP(scalar_suffix, count, _LM2_SOA_BINARY_BODY, op_name);                                                         \
+  }
+
+#define _LM2_IMPL_SOA_ARRAY_SCALAR(scalar_type, scalar_suffix, op_name)                                                     \
+  static void _lm2_soa_##op_name##_s_##scalar_suffix(const scalar_type* a, scalar_type s, scalar_type* out, size_t count) { \
+    _LM2_SIMD_LOOP(scalar_suffix, count, _LM2_SOA_SCALAR_BODY, op_name);                                                    \
+  }
+
+#define _LM2_IMPL_SOA_ARRAY_KERNELS(scalar_type, scalar_suffix)                                                                          \
+  _LM2_IMPL_SOA_ARRAY_BINARY(scalar_type, scalar_suffix, add)                                                                            \
+  _LM2_IMPL_SOA_ARRAY_BINARY(scalar_type, scalar_suffix, sub)                                                                            \
+  _LM2_IMPL_SOA_ARRAY_BINARY(scalar_type, scalar_suffix, mul)                                                                            \
+  _LM2_IMPL_SOA_ARRAY_BINARY(scalar_type, scalar_suffix, div)                                                                            \
+  _LM2_IMPL_SOA_ARRAY_BINARY(scalar_type, scalar_suffix, min)                                                                            \
+  _LM2_IMPL_SOA_ARRAY_BINARY(scalar_type, scalar_suffix, max)                                                                            \
+  _LM2_IMPL_SOA_ARRAY_SCALAR(scalar_type, scalar_suffix, add)                                                                            \
+  _LM2_IMPL_SOA_ARRAY_SCALAR(scalar_type, scalar_suffix, sub)                                                                            \
+  _LM2_IMPL_SOA_ARRAY_SCALAR(scalar_type, scalar_suffix, mul)                                                                            \
+  _LM2_IMPL_SOA_ARRAY_SCALAR(scalar_type, scalar_suffix, div)                                                                            \
+  static void _lm2_soa_clamp_##scalar_suffix(const scalar_type* a, scalar_type lo, scalar_type hi, scalar_type* out, size_t count) {     \
+    LM2_ASSERT(lo <= hi);                                                                                                                \
+    _LM2_SIMD_LOOP(scalar_suffix, count, _LM2_SOA_CLAMP_BODY, _);                                                                        \
+  }                                                                                                                                      \
+  static void _lm2_soa_lerp_##scalar_suffix(const scalar_type* a, scalar_type t, const scalar_type* b, scalar_type* out, size_t count) { \
+    _LM2_SIMD_LOOP(scalar_suffix, count, _LM2_SOA_LERP_BODY, _);                                                                         \
+  }
+
+_LM2_IMPL_SOA_ARRAY_KERNELS(double, f64)
+_LM2_IMPL_SOA_ARRAY_KERNELS(float, f32)
+
+// =============================================================================
+// Construction and component-wise operations
+// =============================================================================
+
+#define _LM2_SOA_ASSERT_COUNT2(a, b) LM2_ASSERT((a).count == (b).count)
+#define _LM2_SOA_ASSERT_COUNT3(a, b, c) LM2_ASSERT((a).count == (b).count && (a).count == (c).count)
+
+#define _LM2_SOA_EACH2(fn, ...) fn(x, __VA_ARGS__) fn(y, __VA_ARGS__)
+#define _LM2_SOA_EACH3(fn, ...) _LM2_SOA_EACH2(fn, __VA_ARGS__) fn(z, __VA_ARGS__)
+#define _LM2_SOA_EACH4(fn, ...) _LM2_SOA_EACH3(fn, __VA_ARGS__) fn(w, __VA_ARGS__)
+
+#define _LM2_SOA_CALL_BINARY(c, op_name, scalar_suffix) _lm2_soa_##op_name##_##scalar_suffix(a.c, b.c, out.c, a.count);
+#define _LM2_SOA_CALL_SCALAR(c, op_name, scalar_suffix) _lm2_soa_##op_name##_s_##scalar_suffix(a.c, s, out.c, a.count);
+#define _LM2_SOA_CALL_CLAMP(c, scalar_suffix, _)        _lm2_soa_clamp_##scalar_suffix(a.c, min.c, max.c, out.c, a.count);
+#define _LM2_SOA_CALL_LERP(c, scalar_suffix, _)         _lm2_soa_lerp_##scalar_suffix(a.c, t, b.c, out.c, a.count);
+
+#define _LM2_IMPL_SOA_BINARY_OP(dim, scalar_suffix, op_name)                                                                                                                \
+  LM2_API void lm2_v##dim##_soa_##op_name##_##scalar_suffix(lm2_v##dim##_soa_##scalar_suffix a, lm2_v##dim##_soa_##scalar_suffix b, lm2_v##dim##_soa_##scalar_suffix out) { \
+    _LM2_SOA_ASSERT_COUNT3(a, b, out);                                                                                                                                      \
+    _LM2_SOA_EACH##dim(_LM2_SOA_CALL_BINARY, op_name, scalar_suffix)                                                                                                        \
+  }
+
+#define _LM2_IMPL_SOA_SCALAR_OP(dim, scalar_type, scalar_suffix, op_name)                                                                                \
+  LM2_API void lm2_v##dim##_soa_##op_name##_s_##scalar_suffix(lm2_v##dim##_soa_##scalar_suffix a, scalar_type s, lm2_v##dim##_soa_##scalar_suffix out) { \
+    _LM2_SOA_ASSERT_COUNT2(a, out);                                                                                                                      \
+    _LM2_SOA_EACH##dim(_LM2_SOA_CALL_SCALAR, op_name, scalar_suffix)                                                                                     \
+  }
+
+#define _LM2_IMPL_SOA_COMPONENT_OPS(dim, scalar_type, scalar_suffix)                                                                                                                                  \
+  _LM2_IMPL_SOA_BINARY_OP(dim, scalar_suffix, add)                                                                                                                                                    \
+  _LM2_IMPL_SOA_BINARY_OP(dim, scalar_suffix, sub)                                                                                                                                                    \
+  _LM2_IMPL_SOA_BINARY_OP(dim, scalar_suffix, mul)                                                                                                                                                    \
+  _LM2_IMPL_SOA_BINARY_OP(dim, scalar_suffix, div)                                                                                                                                                    \
+  _LM2_IMPL_SOA_BINARY_OP(dim, scalar_suffix, min)                                                                                                                                                    \
+  _LM2_IMPL_SOA_BINARY_OP(dim, scalar_suffix, max)                                                                                                                                                    \
+  _LM2_IMPL_SOA_SCALAR_OP(dim, scalar_type, scalar_suffix, add)                                                                                                                                       \
+  _LM2_IMPL_SOA_SCALAR_OP(dim, scalar_type, scalar_suffix, sub)                                                                                                                                       \
+  _LM2_IMPL_SOA_SCALAR_OP(dim, scalar_type, scalar_suffix, mul)                                                                                                                                       \
+  _LM2_IMPL_SOA_SCALAR_OP(dim, scalar_type, scalar_suffix, div)                                                                                                                                       \
+  LM2_API void lm2_v##dim##_soa_clamp_##scalar_suffix(lm2_v##dim##_soa_##scalar_suffix a, lm2_v##dim##_##scalar_suffix min, lm2_v##dim##_##scalar_suffix max, lm2_v##dim##_soa_##scalar_suffix out) { \
+    _LM2_SOA_ASSERT_COUNT2(a, out);                                                                                                                                                                   \
+    _LM2_SOA_EACH##dim(_LM2_SOA_CALL_CLAMP, scalar_suffix, _)                                                                                                                                         \
+  }                                                                                                                                                                                                   \
+  LM2_API void lm2_v##dim##_soa_lerp_##scalar_suffix(lm2_v##dim##_soa_##scalar_suffix a, scalar_type t, lm2_v##dim##_soa_##scalar_suffix b, lm2_v##dim##_soa_##scalar_suffix out) {                   \
+    _LM2_SOA_ASSERT_COUNT3(a, b, out);                                                                                                                                                                \
+    _LM2_SOA_EACH##dim(_LM2_SOA_CALL_LERP, scalar_suffix, _)                                                                                                                                          \
+  }
+
+LM2_API lm2_v2_soa_f64 lm2_v2_soa_make_f64(double* x, double* y, size_t count) {
+  lm2_v2_soa_f64 result;
+  result.x = x;
+  result.y = y;
+  result.count = count;
+  return result;
+}
+
+LM2_API lm2_v2_soa_f32 lm2_v2_soa_make_f32(float* x, float* y, size_t count) {
+  lm2_v2_soa_f32 result;
+  result.x = x;
+  result.y = y;
+  result.count = count;
+  return result;
+}
+
+LM2_API lm2_v3_soa_f64 lm2_v3_soa_make_f64(double* x, double* y, double* z, size_t count) {
+  lm2_v3_soa_f64 result;
+  result.x = x;
+  result.y = y;
+  result.z = z;
+  result.count = count;
+  return result;
+}
+
+LM2_API lm2_v3_soa_f32 lm2_v3_soa_make_f32(float* x, float* y, float* z, size_t count) {
+  lm2_v3_soa_f32 result;
+  result.x = x;
+  result.y = y;
+  result.z = z;
+  result.count = count;
+  return result;
+}
+
+LM2_API lm2_v4_soa_f64 lm2_v4_soa_make_f64(double* x, double* y, double* z, double* w, size_t count) {
+  lm2_v4_soa_f64 result;
+  result.x = x;
+  result.y = y;
+  result.z = z;
+  result.w = w;
+  result.count = count;
+  return result;
+}
+
+LM2_API lm2_v4_soa_f32 lm2_v4_soa_make_f32(float* x, float* y, float* z, float* w, size_t count) {
+  lm2_v4_soa_f32 result;
+  result.x = x;
+  result.y = y;
+  result.z = z;
+  result.w = w;
+  result.count = count;
+  return result;
+}
+
+_LM2_IMPL_SOA_COMPONENT_OPS(2, double, f64)
+_LM2_IMPL_SOA_COMPONENT_OPS(2, float, f32)
+_LM2_IMPL_SOA_COMPONENT_OPS(3, double, f64)
+_LM2_IMPL_SOA_COMPONENT_OPS(3, float, f32)
+_LM2_IMPL_SOA_COMPONENT_OPS(4, double, f64)
+_LM2_IMPL_SOA_COMPONENT_OPS(4, float, f32)
+
+// =============================================================================
+// Vector specifics
+// =============================================================================
+
+#define _LM2_IMPL_SOA_SPECIFICS(dim, scalar_type, scalar_suffix)                                                                                     \
+  LM2_API void lm2_v##dim##_soa_dot_##scalar_suffix(lm2_v##dim##_soa_##scalar_suffix a, lm2_v##dim##_soa_##scalar_suffix b, scalar_type* out) {      \
+    _LM2_SOA_ASSERT_COUNT2(a, b);                                                                                                                    \
+    _LM2_SIMD_LOOP(scalar_suffix, a.count, _LM2_SOA_DOT_BODY, dim);                                                                                  \
+  }                                                                                                                                                  \
+  LM2_API void lm2_v##dim##_soa_length_##scalar_suffix(lm2_v##dim##_soa_##scalar_suffix a, scalar_type* out) {                                       \
+    _LM2_SIMD_LOOP(scalar_suffix, a.count, _LM2_SOA_LENGTH_BODY, dim);                                                                               \
+  }                                                                                                                                                  \
+  LM2_API void lm2_v##dim##_soa_length_sq_##scalar_suffix(lm2_v##dim##_soa_##scalar_suffix a, scalar_type* out) {                                    \
+    lm2_v##dim##_soa_dot_##scalar_suffix(a, a, out);                                                                                                 \
+  }                                                                                                                                                  \
+  LM2_API void lm2_v##dim##_soa_distance_##scalar_suffix(lm2_v##dim##_soa_##scalar_suffix a, lm2_v##dim##_soa_##scalar_suffix b, scalar_type* out) { \
+    _LM2_SOA_ASSERT_COUNT2(a, b);                                                                                                                    \
+    _LM2_SIMD_LOOP(scalar_suffix, a.count, _LM2_SOA_DISTANCE_BODY, dim);                                                                             \
+  }                                                                                                                                                  \
+  LM2_API void lm2_v##dim##_soa_norm_##scalar_suffix(lm2_v##dim##_soa_##scalar_suffix a, lm2_v##dim##_soa_##scalar_suffix out) {                     \
+    _LM2_SOA_ASSERT_COUNT2(a, out);                                                                                                                  \
+    _LM2_SIMD_LOOP(scalar_suffix, a.count, _LM2_SOA_NORM_BODY, dim);                                                                                 \
+  }
+
+#define _LM2_IMPL_SOA_REFLECT(dim, scalar_suffix)                                                                                                                            \
+  LM2_API void lm2_v##dim##_soa_reflect_##scalar_suffix(lm2_v##dim##_soa_##scalar_suffix v, lm2_v##dim##_soa_##scalar_suffix normal, lm2_v##dim##_soa_##scalar_suffix out) { \
+    _LM2_SOA_ASSERT_COUNT3(v, normal, out);                                                                                                                                  \
+    _LM2_SIMD_LOOP(scalar_suffix, v.count, _LM2_SOA_REFLECT_BODY, dim);                                                                                                      \
+  }
+
+#define _LM2_IMPL_SOA_CROSS(scalar_suffix)                                                                                                    \
+  LM2_API void lm2_v3_soa_cross_##scalar_suffix(lm2_v3_soa_##scalar_suffix a, lm2_v3_soa_##scalar_suffix b, lm2_v3_soa_##scalar_suffix out) { \
+    _LM2_SOA_ASSERT_COUNT3(a, b, out);                                                                                                        \
+    _LM2_SIMD_LOOP(scalar_suffix, a.count, _LM2_SOA_CROSS_BODY, _);                                                                           \
+  }
+
+_LM2_IMPL_SOA_SPECIFICS(2, double, f64)
+_LM2_IMPL_SOA_SPECIFICS(2, float, f32)
+_LM2_IMPL_SOA_SPECIFICS(3, double, f64)
+_LM2_IMPL_SOA_SPECIFICS(3, float, f32)
+_LM2_IMPL_SOA_SPECIFICS(4, double, f64)
+_LM2_IMPL_SOA_SPECIFICS(4, float, f32)
+_LM2_IMPL_SOA_REFLECT(2, f64)
+_LM2_IMPL_SOA_REFLECT(2, f32)
+_LM2_IMPL_SOA_REFLECT(3, f64)
+_LM2_IMPL_SOA_REFLECT(3, f32)
+_LM2_IMPL_SOA_CROSS(f64)
+_LM2_IMPL_SOA_CROSS(f32)
+
+// =============================================================================
+// AoS <-> SoA transposes
+// =============================================================================
+// v2 and v3 go through the interleave helpers of lm2_simd.h, one vector width
+// per iteration. v4 f32 uses a 4x4 transpose (SSE) or NEON structure loads and
+// v4 f64 is a plain loop.
+
+#define _LM2_IMPL_SOA_TRANSPOSE_SCALAR(dim, scalar_suffix)                                                                                               \
+  static void _lm2_v##dim##_soa_from_aos_tail_##scalar_suffix(const lm2_v##dim##_##scalar_suffix* src, lm2_v##dim##_soa_##scalar_suffix out, size_t i) { \
+    for (; i < out.count; i++) {                                                                                                                         \
+      _LM2_SOA_EACH##dim(_LM2_SOA_FROM_AOS_ELEMENT, _, _)                                                                                                \
+    }                                                                                                                                                    \
+  }                                                                                                                                                      \
+  static void _lm2_v##dim##_soa_to_aos_tail_##scalar_suffix(lm2_v##dim##_soa_##scalar_suffix a, lm2_v##dim##_##scalar_suffix* dst, size_t i) {           \
+    for (; i < a.count; i++) {                                                                                                                           \
+      _LM2_SOA_EACH##dim(_LM2_SOA_TO_AOS_ELEMENT, _, _)                                                                                                  \
+    }                                                                                                                                                    \
+  }
+
+#define _LM2_SOA_FROM_AOS_ELEMENT(c, _a, _b) out.c[i] = src[i].c;
+#define _LM2_SOA_TO_AOS_ELEMENT(c, _a, _b)   dst[i].c = a.c[i];
+
+_LM2_IMPL_SOA_TRANSPOSE_SCALAR(2, f64)
+_LM2_IMPL_SOA_TRANSPOSE_SCALAR(2, f32)
+_LM2_IMPL_SOA_TRANSPOSE_SCALAR(3, f64)
+_LM2_IMPL_SOA_TRANSPOSE_SCALAR(3, f32)
+_LM2_IMPL_SOA_TRANSPOSE_SCALAR(4, f64)
+_LM2_IMPL_SOA_TRANSPOSE_SCALAR(4, f32)
+
+#define _LM2_IMPL_SOA_TRANSPOSE2(scalar_suffix)                                                                                      \
+  LM2_API void lm2_v2_soa_from_aos_##scalar_suffix(const lm2_v2_##scalar_suffix* src, lm2_v2_soa_##scalar_suffix out) {              \
+    LM2_ASSERT(src != NULL || out.count == 0);                                                                                       \
+    size_t i = 0;                                                                                                                    \
+    for (; i + _lm2_simd_width_##scalar_suffix <= out.count; i += _lm2_simd_width_##scalar_suffix) {                                 \
+      _lm2_simd_##scalar_suffix x, y;                                                                                                \
+      _lm2_simd_load2_##scalar_suffix(&src[i].x, &x, &y);                                                                            \
+      _lm2_simd_store_##scalar_suffix(out.x + i, x);                                                                                 \
+      _lm2_simd_store_##scalar_suffix(out.y + i, y);                                                                                 \
+    }                                                                                                                                \
+    _lm2_v2_soa_from_aos_tail_##scalar_suffix(src, out, i);                                                                          \
+  }                                                                                                                                  \
+  LM2_API void lm2_v2_soa_to_aos_##scalar_suffix(lm2_v2_soa_##scalar_suffix a, lm2_v2_##scalar_suffix* dst) {                        \
+    LM2_ASSERT(dst != NULL || a.count == 0);                                                                                         \
+    size_t i = 0;                                                                                                                    \
+    for (; i + _lm2_simd_width_##scalar_suffix <= a.count; i += _lm2_simd_width_##scalar_suffix) {                                   \
+      _lm2_simd_store2_##scalar_suffix(&dst[i].x, _lm2_simd_load_##scalar_suffix(a.x + i), _lm2_simd_load_##scalar_suffix(a.y + i)); \
+    }                                                                                                                                \
+    _lm2_v2_soa_to_aos_tail_##scalar_suffix(a, dst, i);                                                                              \
+  }
+
+#define _LM2_IMPL_SOA_TRANSPOSE3(scalar_suffix)                                                                         \
+  LM2_API void lm2_v3_soa_from_aos_##scalar_suffix(const lm2_v3_##scalar_suffix* src, lm2_v3_soa_##scalar_suffix out) { \
+    LM2_ASSERT(src != NULL || out.count == 0);                                                                          \
+    size_t i = 0;                                                                                                       \
+    for (; i + _lm2_simd_width_##scalar_suffix <= out.count; i += _lm2_simd_width_##scalar_suffix) {                    \
+      _lm2_simd_##scalar_suffix x, y, z;                                                                                \
+      _lm2_simd_load3_##scalar_suffix(&src[i].x, &x, &y, &z);                                                           \
+      _lm2_simd_store_##scalar_suffix(out.x + i, x);                                                                    \
+      _lm2_simd_store_##scalar_suffix(out.y + i, y);                                                                    \
+      _lm2_simd_store_##scalar_suffix(out.z + i, z);                                                                    \
+    }                                                                                                                   \
+    _lm2_v3_soa_from_aos_tail_##scalar_suffix(src, out, i);                                                             \
+  }                                                                                                                     \
+  LM2_API void lm2_v3_soa_to_aos_##scalar_suffix(lm2_v3_soa_##scalar_suffix a, lm2_v3_##scalar_suffix* dst) {           \
+    LM2_ASSERT(dst != NULL || a.count == 0);                                                                            \
+    size_t i = 0;                                                                                                       \
+    for (; i + _lm2_simd_width_##scalar_suffix <= a.count; i += _lm2_simd_width_##scalar_suffix) {                      \
+      _lm2_simd_##scalar_suffix x = _lm2_simd_load_##scalar_suffix(a.x + i);                                            \
+      _lm2_simd_##scalar_suffix y = _lm2_simd_load_##scalar_suffix(a.y + i);                                            \
+      _lm2_simd_##scalar_suffix z = _lm2_simd_load_##scalar_suffix(a.z + i);                                            \
+      _lm2_simd_store3_##scalar_suffix(&dst[i].x, x, y, z);                                                             \
+    }                                                                                                                   \
+    _lm2_v3_soa_to_aos_tail_##scalar_suffix(a, dst, i);                                                                 \
+  }
+
+_LM2_IMPL_SOA_TRANSPOSE2(f64)
+_LM2_IMPL_SOA_TRANSPOSE2(f32)
+_LM2_IMPL_SOA_TRANSPOSE3(f64)
+_LM2_IMPL_SOA_TRANSPOSE3(f32)
+
+LM2_API void lm2_v4_soa_from_aos_f64(const lm2_v4_f64* src, lm2_v4_soa_f64 out) {
+  LM2_ASSERT(src != NULL || out.count == 0);
+  _lm2_v4_soa_from_aos_tail_f64(src, out, 0);
+}
+
+LM2_API void lm2_v4_soa_to_aos_f64(lm2_v4_soa_f64 a, lm2_v4_f64* dst) {
+  LM2_ASSERT(dst != NULL || a.count == 0);
+  _lm2_v4_soa_to_aos_tail_f64(a, dst, 0);
+}
+
+LM2_API void lm2_v4_soa_from_aos_f32(const lm2_v4_f32* src, lm2_v4_soa_f32 out) {
+  LM2_ASSERT(src != NULL || out.count == 0);
+  size_t i = 0;
+#if defined(LM2_SIMD_SSE2)
+  for (; i + 4 <= out.count; i += 4) {
+    __m128 r0 = _mm_loadu_ps(&src[i].x);
+    __m128 r1 = _mm_loadu_ps(&src[i + 1].x);
+    __m128 r2 = _mm_loadu_ps(&src[i + 2].x);
+    __m128 r3 = _mm_loadu_ps(&src[i + 3].x);
+    _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+    _mm_storeu_ps(out.x + i, r0);
+    _mm_storeu_ps(out.y + i, r1);
+    _mm_storeu_ps(out.z + i, r2);
+    _mm_storeu_ps(out.w + i, r3);
+  }
+#elif defined(LM2_SIMD_NEON)
+  for (; i + 4 <= out.count; i += 4) {
+    float32x4x4_t v = vld4q_f32(&src[i].x);
+    vst1q_f32(out.x + i, v.val[0]);
+    vst1q_f32(out.y + i, v.val[1]);
+    vst1q_f32(out.z + i, v.val[2]);
+    vst1q_f32(out.w + i, v.val[3]);
+  }
+#endif
+  _lm2_v4_soa_from_aos_tail_f32(src, out, i);
+}
+
+LM2_API void lm2_v4_soa_to_aos_f32(lm2_v4_soa_f32 a, lm2_v4_f32* dst) {
+  LM2_ASSERT(dst != NULL || a.count == 0);
+  size_t i = 0;
+#if defined(LM2_SIMD_SSE2)
+  for (; i + 4 <= a.count; i += 4) {
+    __m128 r0 = _mm_loadu_ps(a.x + i);
+    __m128 r1 = _mm_loadu_ps(a.y + i);
+    __m128 r2 = _mm_loadu_ps(a.z + i);
+    __m128 r3 = _mm_loadu_ps(a.w + i);
+    _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+    _mm_storeu_ps(&dst[i].x, r0);
+    _mm_storeu_ps(&dst[i + 1].x, r1);
+    _mm_storeu_ps(&dst[i + 2].x, r2);
+    _mm_storeu_ps(&dst[i + 3].x, r3);
+  }
+#elif defined(LM2_SIMD_NEON)
+  for (; i + 4 <= a.count; i += 4) {
+    float32x4x4_t v;
+    v.val[0] = vld1q_f32(a.x + i);
+    v.val[1] = vld1q_f32(a.y + i);
+    v.val[2] = vld1q_f32(a.z + i);
+    v.val[3] = vld1q_f32(a.w + i);
+    vst4q_f32(&dst[i].x, v);
+  }
+#endif
+  _lm2_v4_soa_to_aos_tail_f32(a, dst, i);
+}
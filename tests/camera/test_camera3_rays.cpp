@@ -0,0 +1,255 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+#include "lm2/camera/lm2_camera3.h"
+#include "lm2/camera/lm2_camera3_rays.h"
+#include "lm2/geometry3d/lm2_ray3_packet.h"
+#include "lm2/geometry3d/lm2_raycast3.h"
+#include "lm2/lm2_constants.h"
+#include "lm2/vectors/lm2_vector_specifics.h"
+
+class Camera3RaysTest : public ::testing::Test {
+ protected:
+  static constexpr float EPSILON_F32 = 1e-4f;
+  static constexpr double EPSILON_F64 = 1e-8;
+
+  lm2_camera3_f64 make_perspective_f64() {
+    lm2_v3_f64 pos = {3.0, 2.0, 5.0};
+    lm2_v3_f64 target = {0.0, 0.5, -1.0};
+    lm2_v3_f64 up = {0.0, 1.0, 0.0};
+    return lm2_camera3_perspective_f64(pos, target, up, LM2_PI_F64 / 3.0, 16.0 / 9.0, 0.1, 100.0);
+  }
+
+  lm2_camera3_f32 make_perspective_f32() {
+    lm2_v3_f32 pos = {3.0f, 2.0f, 5.0f};
+    lm2_v3_f32 target = {0.0f, 0.5f, -1.0f};
+    lm2_v3_f32 up = {0.0f, 1.0f, 0.0f};
+    return lm2_camera3_perspective_f32(pos, target, up, LM2_PI_F32 / 3.0f, 16.0f / 9.0f, 0.1f, 100.0f);
+  }
+
+  static void expect_v3_near_f64(lm2_v3_f64 a, lm2_v3_f64 b, double eps) {
+    EXPECT_NEAR(a.x, b.x, eps);
+    EXPECT_NEAR(a.y, b.y, eps);
+    EXPECT_NEAR(a.z, b.z, eps);
+  }
+
+  static void expect_ray_near_f32(lm2_ray3_f32 a, lm2_ray3_f32 b, float eps) {
+    EXPECT_NEAR(a.origin.x, b.origin.x, eps);
+    EXPECT_NEAR(a.origin.y, b.origin.y, eps);
+    EXPECT_NEAR(a.origin.z, b.origin.z, eps);
+    EXPECT_NEAR(a.direction.x, b.direction.x, eps);
+    EXPECT_NEAR(a.direction.y, b.direction.y, eps);
+    EXPECT_NEAR(a.direction.z, b.direction.z, eps);
+    EXPECT_NEAR(a.t_max, b.t_max, eps * b.t_max);
+  }
+
+  // The ray of pixel (px, py) must pass through the near and far plane points
+  // lm2_camera3_ndc_to_world gives for its center
+  static void expect_matches_ndc_f64(lm2_camera3_f64 camera, lm2_camera3_raygen_f64 raygen, uint32_t px, uint32_t py) {
+    lm2_ray3_f64 ray = lm2_camera3_raygen_ray_f64(&raygen, px + 0.5, py + 0.5);
+    double nx = (px + 0.5) / raygen.width * 2.0 - 1.0;
+    double ny = 1.0 - (py + 0.5) / raygen.height * 2.0;
+    lm2_v3_f64 near_point = lm2_camera3_ndc_to_world_f64(camera, (lm2_v3_f64) {nx, ny, -1.0});
+    lm2_v3_f64 far_point = lm2_camera3_ndc_to_world_f64(camera, (lm2_v3_f64) {nx, ny, 1.0});
+    lm2_v3_f64 expected = lm2_v3_norm_f64(lm2_v3_sub_f64(far_point, near_point));
+    expect_v3_near_f64(ray.direction, expected, 1e-6);
+    EXPECT_NEAR(lm2_v3_length_f64(ray.direction), 1.0, EPSILON_F64);
+    expect_v3_near_f64(lm2_ray3_point_at_f64(ray, ray.t_max), far_point, 1e-4);
+    double t_near = lm2_v3_dot_f64(lm2_v3_sub_f64(near_point, ray.origin), ray.direction);
+    expect_v3_near_f64(lm2_ray3_point_at_f64(ray, t_near), near_point, 1e-6);
+  }
+};
+
+// =============================================================================
+// Single Rays
+// =============================================================================
+
+TEST_F(Camera3RaysTest, PerspectiveRaysMatchNdcToWorld_f64) {
+  lm2_camera3_f64 camera = make_perspective_f64();
+  lm2_camera3_raygen_f64 raygen = lm2_camera3_raygen_make_f64(camera, 64, 36);
+  expect_v3_near_f64(lm2_camera3_raygen_ray_f64(&raygen, 13.0, 7.0).origin, camera.position, EPSILON_F64);
+  expect_matches_ndc_f64(camera, raygen, 0, 0);
+  expect_matches_ndc_f64(camera, raygen, 63, 0);
+  expect_matches_ndc_f64(camera, raygen, 0, 35);
+  expect_matches_ndc_f64(camera, raygen, 63, 35);
+  expect_matches_ndc_f64(camera, raygen, 31, 17);
+  expect_matches_ndc_f64(camera, raygen, 40, 5);
+
+  // The viewport center looks straight ahead
+  lm2_ray3_f64 center = lm2_camera3_raygen_ray_f64(&raygen, 32.0, 18.0);
+  expect_v3_near_f64(center.direction, lm2_camera3_get_forward_f64(camera), EPSILON_F64);
+  EXPECT_NEAR(center.t_max, camera.far_plane, EPSILON_F64);
+}
+
+TEST_F(Camera3RaysTest, OrthographicRaysMatchNdcToWorld_f64) {
+  lm2_v3_f64 pos = {-2.0, 4.0, 1.0};
+  lm2_v3_f64 target = {1.0, 0.0, -3.0};
+  lm2_v3_f64 up = {0.0, 1.0, 0.0};
+  lm2_camera3_f64 camera = lm2_camera3_orthographic_f64(pos, target, up, 5.0, 4.0 / 3.0, 0.5, 50.0);
+  lm2_camera3_raygen_f64 raygen = lm2_camera3_raygen_make_f64(camera, 40, 30);
+  expect_matches_ndc_f64(camera, raygen, 0, 0);
+  expect_matches_ndc_f64(camera, raygen, 39, 29);
+  expect_matches_ndc_f64(camera, raygen, 12, 21);
+
+  // Parallel rays of the same length
+  lm2_ray3_f64 a = lm2_camera3_raygen_ray_f64(&raygen, 0.5, 0.5);
+  lm2_ray3_f64 b = lm2_camera3_raygen_ray_f64(&raygen, 30.5, 20.5);
+  expect_v3_near_f64(a.direction, b.direction, EPSILON_F64);
+  EXPECT_NEAR(a.t_max, 50.0, EPSILON_F64);
+  EXPECT_NEAR(b.t_max, 50.0, EPSILON_F64);
+}
+
+// =============================================================================
+// Tiles and Packets
+// =============================================================================
+
+TEST_F(Camera3RaysTest, TileMatchesSingleRays_f32) {
+  lm2_camera3_raygen_f32 raygen = lm2_camera3_raygen_make_f32(make_perspective_f32(), 160, 90);
+  // Width spans more than one batch and ends off every SIMD width
+  const uint32_t x = 5, y = 3, w = 77, h = 9;
+  std::vector<float> ox(w * h), oy(w * h), oz(w * h), dx(w * h), dy(w * h), dz(w * h), t(w * h);
+  lm2_v3_soa_f32 origins = {ox.data(), oy.data(), oz.data(), ox.size()};
+  lm2_v3_soa_f32 directions = {dx.data(), dy.data(), dz.data(), dx.size()};
+  lm2_camera3_raygen_tile_f32(&raygen, x, y, w, h, origins, directions, t.data());
+
+  for (uint32_t j = 0; j < h; j++) {
+    for (uint32_t i = 0; i < w; i++) {
+      size_t k = j * w + i;
+      lm2_ray3_f32 expected = lm2_camera3_raygen_ray_f32(&raygen, x + i + 0.5f, y + j + 0.5f);
+      lm2_ray3_f32 got = {{ox[k], oy[k], oz[k]}, {dx[k], dy[k], dz[k]}, t[k]};
+      expect_ray_near_f32(got, expected, EPSILON_F32);
+    }
+  }
+
+  // t_max is optional
+  std::vector<float> dx2(w * h), dy2(w * h), dz2(w * h);
+  lm2_v3_soa_f32 directions2 = {dx2.data(), dy2.data(), dz2.data(), dx2.size()};
+  lm2_camera3_raygen_tile_f32(&raygen, x, y, w, h, origins, directions2, NULL);
+  EXPECT_EQ(dx, dx2);
+  EXPECT_EQ(dz, dz2);
+}
+
+TEST_F(Camera3RaysTest, PacketsCoverTileBlocks_f32) {
+  lm2_camera3_raygen_f32 raygen = lm2_camera3_raygen_make_f32(make_perspective_f32(), 64, 64);
+  const uint32_t x = 10, y = 20, w = 7, h = 5;
+
+  std::vector<lm2_ray3_packet4_f32> packets4((w + 1) / 2 * ((h + 1) / 2));
+  ASSERT_EQ(lm2_camera3_raygen_packets4_f32(&raygen, x, y, w, h, packets4.data()), packets4.size());
+  std::vector<lm2_ray3_packet8_f32> packets8((w + 3) / 4 * ((h + 1) / 2));
+  ASSERT_EQ(lm2_camera3_raygen_packets8_f32(&raygen, x, y, w, h, packets8.data()), packets8.size());
+
+  int active4 = 0, active8 = 0;
+  for (size_t p = 0; p < packets4.size(); p++) {
+    uint32_t bx = (uint32_t)(p % 4) * 2, by = (uint32_t)(p / 4) * 2;
+    uint32_t mask = lm2_ray3_packet4_active_mask_f32(&packets4[p]);
+    for (uint32_t k = 0; k < 4; k++) {
+      uint32_t i = bx + k % 2, j = by + k / 2;
+      bool inside = i < w && j < h;
+      EXPECT_EQ((mask >> k) & 1u, inside ? 1u : 0u) << "packet " << p << " lane " << k;
+      if (inside) {
+        expect_ray_near_f32(lm2_ray3_packet4_get_f32(&packets4[p], k), lm2_camera3_raygen_ray_f32(&raygen, x + i + 0.5f, y + j + 0.5f), EPSILON_F32);
+        active4++;
+      }
+    }
+  }
+  for (size_t p = 0; p < packets8.size(); p++) {
+    uint32_t bx = (uint32_t)(p % 2) * 4, by = (uint32_t)(p / 2) * 2;
+    uint32_t mask = lm2_ray3_packet8_active_mask_f32(&packets8[p]);
+    for (uint32_t k = 0; k < 8; k++) {
+      uint32_t i = bx + k % 4, j = by + k / 4;
+      bool inside = i < w && j < h;
+      EXPECT_EQ((mask >> k) & 1u, inside ? 1u : 0u) << "packet " << p << " lane " << k;
+      if (inside) {
+        expect_ray_near_f32(lm2_ray3_packet8_get_f32(&packets8[p], k), lm2_camera3_raygen_ray_f32(&raygen, x + i + 0.5f, y + j + 0.5f), EPSILON_F32);
+        active8++;
+      }
+    }
+  }
+  EXPECT_EQ(active4, (int)(w * h));
+  EXPECT_EQ(active8, (int)(w * h));
+}
+
+TEST_F(Camera3RaysTest, PacketLaneAccess_f64) {
+  lm2_ray3_packet4_f64 packet = {};
+  EXPECT_EQ(lm2_ray3_packet4_active_mask_f64(&packet), 0u);
+  lm2_ray3_f64 ray = lm2_ray3_make_f64((lm2_v3_f64) {1.0, 2.0, 3.0}, (lm2_v3_f64) {0.0, 0.0, -1.0}, 10.0);
+  lm2_ray3_packet4_set_f64(&packet, 2, ray);
+  EXPECT_EQ(lm2_ray3_packet4_active_mask_f64(&packet), 4u);
+  EXPECT_EQ(packet.origin_y[2], 2.0);
+  EXPECT_EQ(packet.direction_z[2], -1.0);
+  lm2_ray3_f64 back = lm2_ray3_packet4_get_f64(&packet, 2);
+  expect_v3_near_f64(back.origin, ray.origin, 0.0);
+  expect_v3_near_f64(back.direction, ray.direction, 0.0);
+  EXPECT_EQ(back.t_max, 10.0);
+}
+
+// =============================================================================
+// Jitter
+// =============================================================================
+
+TEST_F(Camera3RaysTest, JitteredSamplesStayInsideTheirPixel_f64) {
+  lm2_camera3_f64 camera = make_perspective_f64();
+  lm2_camera3_raygen_f64 raygen = lm2_camera3_raygen_make_f64(camera, 32, 32);
+  raygen.jitter = true;
+  raygen.seed = 7;
+  const uint32_t n = 32 * 32;
+  std::vector<double> ox(n), oy(n), oz(n), dx(n), dy(n), dz(n);
+  lm2_v3_soa_f64 origins = {ox.data(), oy.data(), oz.data(), n};
+  lm2_v3_soa_f64 directions = {dx.data(), dy.data(), dz.data(), n};
+  lm2_camera3_raygen_tile_f64(&raygen, 0, 0, 32, 32, origins, directions, NULL);
+
+  // Recover the sample position from the direction: scaled to a forward
+  // component of 1 it is direction + fx * direction_dx + fy * direction_dy
+  lm2_v3_f64 forward = lm2_camera3_get_forward_f64(camera);
+  double sum_x = 0.0, sum_y = 0.0;
+  for (uint32_t j = 0; j < 32; j++) {
+    for (uint32_t i = 0; i < 32; i++) {
+      size_t k = j * 32 + i;
+      lm2_v3_f64 d = {dx[k], dy[k], dz[k]};
+      d = lm2_v3_sub_f64(lm2_v3_mul_s_f64(d, 1.0 / lm2_v3_dot_f64(d, forward)), raygen.direction);
+      double fx = lm2_v3_dot_f64(d, raygen.direction_dx) / lm2_v3_length_sq_f64(raygen.direction_dx);
+      double fy = lm2_v3_dot_f64(d, raygen.direction_dy) / lm2_v3_length_sq_f64(raygen.direction_dy);
+      EXPECT_GE(fx, i - 1e-9);
+      EXPECT_LT(fx, i + 1.0);
+      EXPECT_GE(fy, j - 1e-9);
+      EXPECT_LT(fy, j + 1.0);
+      sum_x += fx - i;
+      sum_y += fy - j;
+    }
+  }
+  EXPECT_NEAR(sum_x / n, 0.5, 0.05);
+  EXPECT_NEAR(sum_y / n, 0.5, 0.05);
+
+  // Same seed, same rays; another seed moves them
+  std::vector<double> dx2(n), dy2(n), dz2(n);
+  lm2_v3_soa_f64 directions2 = {dx2.data(), dy2.data(), dz2.data(), n};
+  lm2_camera3_raygen_tile_f64(&raygen, 0, 0, 32, 32, origins, directions2, NULL);
+  EXPECT_EQ(dx, dx2);
+  raygen.seed = 8;
+  lm2_camera3_raygen_tile_f64(&raygen, 0, 0, 32, 32, origins, directions2, NULL);
+  EXPECT_NE(dx, dx2);
+}
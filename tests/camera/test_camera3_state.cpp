@@ -0,0 +1,183 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+#include <vector>
+#include "lm2/camera/lm2_camera3.h"
+#include "lm2/camera/lm2_camera3_state.h"
+#include "lm2/lm2_constants.h"
+#include "lm2/matrices/lm2_matrix4x4.h"
+#include "lm2/misc/lm2_quaternion.h"
+
+class Camera3StateTest : public ::testing::Test {
+ protected:
+  static constexpr float EPSILON_F32 = 1e-4f;
+  static constexpr double EPSILON_F64 = 1e-8;
+
+  lm2_camera3_f64 make_default_f64() {
+    lm2_v3_f64 pos = {3.0, 2.0, 5.0};
+    lm2_v3_f64 target = {0.0, 0.5, -1.0};
+    lm2_v3_f64 up = {0.0, 1.0, 0.0};
+    return lm2_camera3_perspective_f64(pos, target, up, LM2_PI_F64 / 3.0, 16.0 / 9.0, 0.1, 1000.0);
+  }
+
+  lm2_camera3_f32 make_default_f32() {
+    lm2_v3_f32 pos = {3.0f, 2.0f, 5.0f};
+    lm2_v3_f32 target = {0.0f, 0.5f, -1.0f};
+    lm2_v3_f32 up = {0.0f, 1.0f, 0.0f};
+    return lm2_camera3_perspective_f32(pos, target, up, LM2_PI_F32 / 3.0f, 16.0f / 9.0f, 0.1f, 1000.0f);
+  }
+
+  static void expect_matrix_near_f64(lm2_m4x4_f64 a, lm2_m4x4_f64 b, double eps) {
+    for (int i = 0; i < 16; i++) {
+      EXPECT_NEAR(a.e[i], b.e[i], eps) << "element " << i;
+    }
+  }
+
+  static void expect_matrix_near_f32(lm2_m4x4_f32 a, lm2_m4x4_f32 b, float eps) {
+    for (int i = 0; i < 16; i++) {
+      EXPECT_NEAR(a.e[i], b.e[i], eps) << "element " << i;
+    }
+  }
+};
+
+// =============================================================================
+// Cached values - f64
+// =============================================================================
+
+TEST_F(Camera3StateTest, CachedValuesMatchCamera_F64) {
+  lm2_camera3_f64 cam = make_default_f64();
+  lm2_camera3_state_f64 state = lm2_camera3_state_make_f64(cam);
+
+  expect_matrix_near_f64(lm2_camera3_state_get_view_f64(&state), lm2_camera3_get_view_f64(cam), EPSILON_F64);
+  expect_matrix_near_f64(lm2_camera3_state_get_projection_f64(&state), lm2_camera3_get_projection_f64(cam), EPSILON_F64);
+  expect_matrix_near_f64(lm2_camera3_state_get_view_projection_f64(&state), lm2_camera3_get_view_projection_f64(cam), EPSILON_F64);
+  expect_matrix_near_f64(lm2_camera3_state_get_inv_view_f64(&state), lm2_camera3_get_inv_view_f64(cam), EPSILON_F64);
+
+  lm2_m4x4_f64 round_trip = lm2_m4x4_mul_f64(lm2_camera3_state_get_inv_view_projection_f64(&state), lm2_camera3_state_get_view_projection_f64(&state));
+  expect_matrix_near_f64(round_trip, lm2_m4x4_identity_f64(), EPSILON_F64);
+
+  lm2_frustum3_f64 expected = lm2_frustum3_from_camera_f64(cam);
+  lm2_frustum3_f64 frustum = lm2_camera3_state_get_frustum_f64(&state);
+  for (int i = 0; i < LM2_FRUSTUM3_PLANE_COUNT; i++) {
+    EXPECT_NEAR(frustum.planes[i].normal.x, expected.planes[i].normal.x, EPSILON_F64);
+    EXPECT_NEAR(frustum.planes[i].normal.y, expected.planes[i].normal.y, EPSILON_F64);
+    EXPECT_NEAR(frustum.planes[i].normal.z, expected.planes[i].normal.z, EPSILON_F64);
+    EXPECT_NEAR(frustum.planes[i].distance, expected.planes[i].distance, EPSILON_F64);
+  }
+  EXPECT_EQ(state.dirty, 0u);
+}
+
+TEST_F(Camera3StateTest, ChangesInvalidateDerivedValues_F64) {
+  lm2_camera3_f64 cam = make_default_f64();
+  lm2_camera3_state_f64 state = lm2_camera3_state_make_f64(cam);
+  lm2_camera3_state_get_frustum_f64(&state);
+  lm2_camera3_state_get_inv_view_f64(&state);
+  lm2_camera3_state_get_inv_view_projection_f64(&state);
+  ASSERT_EQ(state.dirty, 0u);
+
+  // Moving keeps the projection, the view follows the camera
+  lm2_m4x4_f64 projection = state.projection;
+  lm2_camera3_state_move_f64(&state, lm2_v3_make_f64(1.0, -2.0, 0.5));
+  EXPECT_NE(state.dirty, 0u);
+  cam = lm2_camera3_move_f64(cam, lm2_v3_make_f64(1.0, -2.0, 0.5));
+  expect_matrix_near_f64(lm2_camera3_state_get_view_projection_f64(&state), lm2_camera3_get_view_projection_f64(cam), EPSILON_F64);
+  expect_matrix_near_f64(lm2_camera3_state_get_inv_view_f64(&state), lm2_camera3_get_inv_view_f64(cam), EPSILON_F64);
+  expect_matrix_near_f64(state.projection, projection, 0.0);
+
+  // Orbiting and turning
+  lm2_camera3_state_orbit_f64(&state, 0.3, -0.2);
+  cam = lm2_camera3_orbit_f64(cam, 0.3, -0.2);
+  expect_matrix_near_f64(lm2_camera3_state_get_view_f64(&state), lm2_camera3_get_view_f64(cam), EPSILON_F64);
+  lm2_quat_f64 turn = lm2_quat_from_axis_angle_f64(lm2_v3_make_f64(0.0, 1.0, 0.0), 0.4);
+  lm2_camera3_state_rotate_local_f64(&state, turn);
+  cam = lm2_camera3_rotate_local_f64(cam, turn);
+  expect_matrix_near_f64(lm2_camera3_state_get_view_projection_f64(&state), lm2_camera3_get_view_projection_f64(cam), EPSILON_F64);
+
+  // A new FOV changes the projection and everything built from it
+  lm2_camera3_state_set_fov_y_f64(&state, LM2_PI_F64 / 4.0);
+  cam = lm2_camera3_set_fov_y_f64(cam, LM2_PI_F64 / 4.0);
+  lm2_v3_f64 ndc = {0.25, -0.5, 0.3};
+  lm2_v3_f64 expected = lm2_camera3_ndc_to_world_f64(cam, ndc);
+  lm2_v3_f64 world = lm2_camera3_state_ndc_to_world_f64(&state, ndc);
+  EXPECT_NEAR(world.x, expected.x, 1e-6);
+  EXPECT_NEAR(world.y, expected.y, 1e-6);
+  EXPECT_NEAR(world.z, expected.z, 1e-6);
+  EXPECT_NEAR(lm2_camera3_state_get_frustum_f64(&state).planes[LM2_FRUSTUM3_TOP].normal.y,
+              lm2_frustum3_from_camera_f64(cam).planes[LM2_FRUSTUM3_TOP].normal.y, EPSILON_F64);
+
+  lm2_camera3_state_set_aspect_f64(&state, 1.0);
+  cam = lm2_camera3_set_aspect_f64(cam, 1.0);
+  expect_matrix_near_f64(lm2_camera3_state_get_projection_f64(&state), lm2_camera3_get_projection_f64(cam), EPSILON_F64);
+}
+
+// =============================================================================
+// Space transforms - f32
+// =============================================================================
+
+TEST_F(Camera3StateTest, ArrayTransformsMatchCamera_F32) {
+  lm2_camera3_f32 cam = make_default_f32();
+  lm2_camera3_state_f32 state = lm2_camera3_state_make_f32(cam);
+
+  std::mt19937 rng(5);
+  std::uniform_real_distribution<float> u(-0.9f, 0.9f);
+  // 37 points: full SIMD vectors plus a remainder
+  std::vector<lm2_v3_f32> ndc(37);
+  for (lm2_v3_f32& p : ndc) {
+    p = lm2_v3_make_f32(u(rng), u(rng), u(rng));
+  }
+  std::vector<lm2_v3_f32> world(ndc.size());
+  std::vector<lm2_v3_f32> back(ndc.size());
+  lm2_camera3_state_ndc_to_world_array_f32(&state, ndc.data(), world.data(), (uint32_t)ndc.size());
+  lm2_camera3_state_world_to_ndc_array_f32(&state, world.data(), back.data(), (uint32_t)world.size());
+
+  for (size_t i = 0; i < ndc.size(); i++) {
+    lm2_v3_f32 expected_world = lm2_camera3_ndc_to_world_f32(cam, ndc[i]);
+    float scale = std::fmax(1.0f, std::fabs(expected_world.z - cam.position.z));
+    EXPECT_NEAR(world[i].x, expected_world.x, 1e-3f * scale);
+    EXPECT_NEAR(world[i].y, expected_world.y, 1e-3f * scale);
+    EXPECT_NEAR(world[i].z, expected_world.z, 1e-3f * scale);
+
+    lm2_v3_f32 single = lm2_camera3_state_world_to_ndc_f32(&state, world[i]);
+    EXPECT_NEAR(back[i].x, ndc[i].x, 1e-3f);
+    EXPECT_NEAR(back[i].y, ndc[i].y, 1e-3f);
+    EXPECT_NEAR(single.x, back[i].x, EPSILON_F32);
+    EXPECT_NEAR(single.y, back[i].y, EPSILON_F32);
+    EXPECT_NEAR(single.z, back[i].z, EPSILON_F32);
+  }
+
+  // In place, after a change of camera
+  lm2_camera3_state_look_at_f32(&state, lm2_v3_make_f32(1.0f, 0.0f, 0.0f));
+  cam = lm2_camera3_look_at_f32(cam, lm2_v3_make_f32(1.0f, 0.0f, 0.0f));
+  std::vector<lm2_v3_f32> points = world;
+  lm2_camera3_state_world_to_ndc_array_f32(&state, points.data(), points.data(), (uint32_t)points.size());
+  for (size_t i = 0; i < points.size(); i++) {
+    lm2_v3_f32 expected = lm2_camera3_world_to_ndc_f32(cam, world[i]);
+    EXPECT_NEAR(points[i].x, expected.x, EPSILON_F32);
+    EXPECT_NEAR(points[i].y, expected.y, EPSILON_F32);
+  }
+  expect_matrix_near_f32(lm2_camera3_state_get_view_f32(&state), lm2_camera3_get_view_f32(cam), EPSILON_F32);
+}
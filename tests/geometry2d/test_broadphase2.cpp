@@ -0,0 +1,373 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+#include "lm2/geometry2d/lm2_broadphase2.h"
+#include "lm2/geometry2d/lm2_raycast2.h"
+
+// Test fixture for Broadphase2 tests
+class Broadphase2Test : public ::testing::Test {
+ protected:
+  static constexpr float EPSILON_F32 = 1e-5f;
+  static constexpr double EPSILON_F64 = 1e-10;
+};
+
+// Random circles in [0, 1000]^2 with radii in [1, 5]
+static std::vector<lm2_circle_f32> random_circles_f32(size_t count, uint32_t seed) {
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<float> pos(0.0f, 1000.0f);
+  std::uniform_real_distribution<float> radius(1.0f, 5.0f);
+  std::vector<lm2_circle_f32> circles(count);
+  for (auto& circle : circles) {
+    circle = lm2_circle_make_coords_f32(pos(rng), pos(rng), radius(rng));
+  }
+  return circles;
+}
+
+static bool overlap_f32(lm2_r2_f32 a, lm2_r2_f32 b) {
+  return a.min.x <= b.max.x && b.min.x <= a.max.x && a.min.y <= b.max.y && b.min.y <= a.max.y;
+}
+
+// Check parent links, bounds and heights from the root down
+// Returns: number of leaves
+static uint32_t check_tree_f32(const lm2_broadphase2_f32* bp) {
+  if (bp->root == LM2_BROADPHASE2_NULL_PROXY) {
+    return 0;
+  }
+  EXPECT_EQ(bp->nodes[bp->root].parent, LM2_BROADPHASE2_NULL_PROXY);
+  uint32_t leaves = 0;
+  std::vector<uint32_t> stack = {bp->root};
+  while (!stack.empty()) {
+    uint32_t index = stack.back();
+    stack.pop_back();
+    const lm2_broadphase2_node_f32& node = bp->nodes[index];
+    if (node.height == 0) {
+      EXPECT_EQ(node.children[0], LM2_BROADPHASE2_NULL_PROXY);
+      leaves++;
+      continue;
+    }
+    const lm2_broadphase2_node_f32& a = bp->nodes[node.children[0]];
+    const lm2_broadphase2_node_f32& b = bp->nodes[node.children[1]];
+    EXPECT_EQ(a.parent, index);
+    EXPECT_EQ(b.parent, index);
+    EXPECT_EQ(node.height, 1 + std::max(a.height, b.height));
+    EXPECT_FLOAT_EQ(node.bounds.min.x, std::min(a.bounds.min.x, b.bounds.min.x));
+    EXPECT_FLOAT_EQ(node.bounds.max.y, std::max(a.bounds.max.y, b.bounds.max.y));
+    EXPECT_FLOAT_EQ(node.bounds.min.y, std::min(a.bounds.min.y, b.bounds.min.y));
+    EXPECT_FLOAT_EQ(node.bounds.max.x, std::max(a.bounds.max.x, b.bounds.max.x));
+    stack.push_back(node.children[0]);
+    stack.push_back(node.children[1]);
+  }
+  EXPECT_EQ(leaves, bp->proxy_count);
+  return leaves;
+}
+
+// Brute-force pairs over the fat AABBs of the given proxies
+static std::vector<std::pair<uint32_t, uint32_t>> brute_force_pairs_f32(const lm2_broadphase2_f32* bp,
+                                                                        const std::vector<lm2_broadphase2_proxy>& proxies) {
+  std::vector<std::pair<uint32_t, uint32_t>> pairs;
+  for (size_t i = 0; i < proxies.size(); i++) {
+    for (size_t j = i + 1; j < proxies.size(); j++) {
+      if (overlap_f32(lm2_broadphase2_get_fat_bounds_f32(bp, proxies[i]), lm2_broadphase2_get_fat_bounds_f32(bp, proxies[j]))) {
+        pairs.push_back({std::min(proxies[i], proxies[j]), std::max(proxies[i], proxies[j])});
+      }
+    }
+  }
+  std::sort(pairs.begin(), pairs.end());
+  return pairs;
+}
+
+static std::vector<std::pair<uint32_t, uint32_t>> tree_pairs_f32(const lm2_broadphase2_f32* bp) {
+  size_t count = lm2_broadphase2_find_pairs_f32(bp, NULL, 0);
+  std::vector<lm2_broadphase2_pair> out(count);
+  EXPECT_EQ(lm2_broadphase2_find_pairs_f32(bp, out.data(), out.size()), count);
+  std::vector<std::pair<uint32_t, uint32_t>> pairs;
+  for (const auto& pair : out) {
+    EXPECT_LT(pair.a, pair.b);
+    pairs.push_back({pair.a, pair.b});
+  }
+  std::sort(pairs.begin(), pairs.end());
+  return pairs;
+}
+
+// =============================================================================
+// Construction Tests
+// =============================================================================
+
+TEST_F(Broadphase2Test, NodeBufferSize) {
+  EXPECT_EQ(lm2_broadphase2_node_buffer_size_f32(0), 0u);
+  EXPECT_EQ(lm2_broadphase2_node_buffer_size_f32(1), 1u);
+  EXPECT_EQ(lm2_broadphase2_node_buffer_size_f32(1000), 1999u);
+  EXPECT_EQ(lm2_broadphase2_node_buffer_size_f64(1000), 1999u);
+}
+
+TEST_F(Broadphase2Test, EmptyTree_F32) {
+  lm2_broadphase2_f32 bp = lm2_broadphase2_make_f32(NULL, 0, 0.1f);
+  EXPECT_EQ(bp.proxy_count, 0u);
+  EXPECT_EQ(lm2_broadphase2_height_f32(&bp), 0u);
+  EXPECT_EQ(lm2_broadphase2_find_pairs_f32(&bp, NULL, 0), 0u);
+  EXPECT_EQ(lm2_broadphase2_query_aabb_f32(&bp, lm2_r2_from_scalars_f32(0, 0, 10, 10), NULL, 0), 0u);
+  lm2_ray2_f32 ray = lm2_ray2_make_f32(lm2_v2_make_f32(0, 0), lm2_v2_make_f32(1, 0), 100);
+  EXPECT_EQ(lm2_broadphase2_query_ray_f32(&bp, ray, NULL, 0), 0u);
+  lm2_broadphase2_hit_f32 hit = lm2_broadphase2_raycast_f32(&bp, ray);
+  EXPECT_FALSE(hit.rayhit.hit);
+  EXPECT_EQ(hit.proxy, LM2_BROADPHASE2_NULL_PROXY);
+}
+
+TEST_F(Broadphase2Test, InsertFattensBounds_F32) {
+  std::vector<lm2_broadphase2_node_f32> nodes(lm2_broadphase2_node_buffer_size_f32(4));
+  lm2_broadphase2_f32 bp = lm2_broadphase2_make_f32(nodes.data(), nodes.size(), 0.5f);
+
+  lm2_circle_f32 circle = lm2_circle_make_coords_f32(10.0f, 20.0f, 2.0f);
+  lm2_broadphase2_proxy proxy = lm2_broadphase2_insert_shape_f32(&bp, lm2_shape2_from_circle_f32(&circle));
+  lm2_r2_f32 fat = lm2_broadphase2_get_fat_bounds_f32(&bp, proxy);
+  EXPECT_NEAR(fat.min.x, 7.5f, EPSILON_F32);
+  EXPECT_NEAR(fat.min.y, 17.5f, EPSILON_F32);
+  EXPECT_NEAR(fat.max.x, 12.5f, EPSILON_F32);
+  EXPECT_NEAR(fat.max.y, 22.5f, EPSILON_F32);
+  EXPECT_EQ(lm2_broadphase2_get_shape_f32(&bp, proxy).data, &circle);
+  EXPECT_EQ(bp.proxy_count, 1u);
+}
+
+TEST_F(Broadphase2Test, InsertBeyondCapacityAsserts_F32) {
+  std::vector<lm2_broadphase2_node_f32> nodes(lm2_broadphase2_node_buffer_size_f32(2));
+  lm2_broadphase2_f32 bp = lm2_broadphase2_make_f32(nodes.data(), nodes.size(), 0.0f);
+  lm2_r2_f32 box = lm2_r2_from_scalars_f32(0, 0, 1, 1);
+  lm2_shape2_f32 shape = lm2_shape2_from_aabb2_f32(&box);
+  lm2_broadphase2_insert_f32(&bp, box, shape);
+  lm2_broadphase2_insert_f32(&bp, box, shape);
+  EXPECT_DEATH(lm2_broadphase2_insert_f32(&bp, box, shape), "");
+}
+
+// =============================================================================
+// Update Tests
+// =============================================================================
+
+TEST_F(Broadphase2Test, MoveInsideFatBoundsKeepsTree_F32) {
+  std::vector<lm2_broadphase2_node_f32> nodes(lm2_broadphase2_node_buffer_size_f32(4));
+  lm2_broadphase2_f32 bp = lm2_broadphase2_make_f32(nodes.data(), nodes.size(), 1.0f);
+  lm2_r2_f32 box = lm2_r2_from_scalars_f32(0, 0, 2, 2);
+  lm2_broadphase2_proxy proxy = lm2_broadphase2_insert_f32(&bp, box, lm2_shape2_from_aabb2_f32(&box));
+
+  EXPECT_FALSE(lm2_broadphase2_move_f32(&bp, proxy, lm2_r2_from_scalars_f32(0.5f, 0.5f, 2.5f, 2.5f), lm2_v2_make_f32(0, 0)));
+  EXPECT_TRUE(lm2_broadphase2_move_f32(&bp, proxy, lm2_r2_from_scalars_f32(5, 0, 7, 2), lm2_v2_make_f32(1, 0)));
+
+  // Margin on every side, plus 4x the displacement in its direction
+  lm2_r2_f32 fat = lm2_broadphase2_get_fat_bounds_f32(&bp, proxy);
+  EXPECT_NEAR(fat.min.x, 4.0f, EPSILON_F32);
+  EXPECT_NEAR(fat.max.x, 12.0f, EPSILON_F32);
+  EXPECT_NEAR(fat.min.y, -1.0f, EPSILON_F32);
+  EXPECT_NEAR(fat.max.y, 3.0f, EPSILON_F32);
+}
+
+TEST_F(Broadphase2Test, RandomUpdatesKeepInvariantsAndHandles_F32) {
+  const size_t max_proxies = 2000;
+  std::vector<lm2_circle_f32> circles = random_circles_f32(max_proxies, 1);
+  std::vector<lm2_broadphase2_node_f32> nodes(lm2_broadphase2_node_buffer_size_f32(max_proxies));
+  lm2_broadphase2_f32 bp = lm2_broadphase2_make_f32(nodes.data(), nodes.size(), 0.5f);
+
+  std::vector<lm2_broadphase2_proxy> proxies(max_proxies, LM2_BROADPHASE2_NULL_PROXY);
+  std::mt19937 rng(2);
+  std::uniform_int_distribution<size_t> pick(0, max_proxies - 1);
+  std::uniform_real_distribution<float> step(-3.0f, 3.0f);
+  for (int round = 0; round < 20000; round++) {
+    size_t i = pick(rng);
+    if (proxies[i] == LM2_BROADPHASE2_NULL_PROXY) {
+      proxies[i] = lm2_broadphase2_insert_shape_f32(&bp, lm2_shape2_from_circle_f32(&circles[i]));
+    } else if (round % 7 == 0) {
+      lm2_broadphase2_remove_f32(&bp, proxies[i]);
+      proxies[i] = LM2_BROADPHASE2_NULL_PROXY;
+    } else {
+      lm2_v2_f32 d = lm2_v2_make_f32(step(rng), step(rng));
+      circles[i].center = lm2_v2_add_f32(circles[i].center, d);
+      lm2_broadphase2_move_f32(&bp, proxies[i], lm2_shape2_bounds_f32(lm2_shape2_from_circle_f32(&circles[i])), d);
+    }
+  }
+
+  std::vector<lm2_broadphase2_proxy> live;
+  for (size_t i = 0; i < max_proxies; i++) {
+    if (proxies[i] == LM2_BROADPHASE2_NULL_PROXY) {
+      continue;
+    }
+    live.push_back(proxies[i]);
+    EXPECT_EQ(lm2_broadphase2_get_shape_f32(&bp, proxies[i]).data, &circles[i]);
+    lm2_r2_f32 bounds = lm2_shape2_bounds_f32(lm2_shape2_from_circle_f32(&circles[i]));
+    lm2_r2_f32 fat = lm2_broadphase2_get_fat_bounds_f32(&bp, proxies[i]);
+    EXPECT_TRUE(fat.min.x <= bounds.min.x && fat.min.y <= bounds.min.y && bounds.max.x <= fat.max.x && bounds.max.y <= fat.max.y);
+  }
+  EXPECT_EQ(check_tree_f32(&bp), live.size());
+  EXPECT_LE(lm2_broadphase2_height_f32(&bp), 2 * (uint32_t)std::log2((double)live.size()) + 2);
+}
+
+TEST_F(Broadphase2Test, SortedInsertKeepsTreeShallow_F32) {
+  // Boxes inserted in grid order, the worst case for a tree without rotations
+  const uint32_t side = 64;
+  std::vector<lm2_broadphase2_node_f32> nodes(lm2_broadphase2_node_buffer_size_f32(side * side));
+  lm2_broadphase2_f32 bp = lm2_broadphase2_make_f32(nodes.data(), nodes.size(), 0.1f);
+  lm2_shape2_f32 shape = {};
+  for (uint32_t i = 0; i < side * side; i++) {
+    float x = (float)(i % side);
+    float y = (float)(i / side);
+    lm2_broadphase2_insert_f32(&bp, lm2_r2_from_scalars_f32(x, y, x + 0.5f, y + 0.5f), shape);
+  }
+  EXPECT_EQ(check_tree_f32(&bp), side * side);
+  EXPECT_LE(lm2_broadphase2_height_f32(&bp), 2 * 12u);
+  EXPECT_EQ(tree_pairs_f32(&bp).size(), 0u);
+}
+
+// =============================================================================
+// Query Tests
+// =============================================================================
+
+TEST_F(Broadphase2Test, FindPairsMatchesBruteForce_F32) {
+  const size_t count = 1500;
+  std::vector<lm2_circle_f32> circles = random_circles_f32(count, 3);
+  std::vector<lm2_broadphase2_node_f32> nodes(lm2_broadphase2_node_buffer_size_f32(count));
+  lm2_broadphase2_f32 bp = lm2_broadphase2_make_f32(nodes.data(), nodes.size(), 0.25f);
+  std::vector<lm2_broadphase2_proxy> proxies;
+  for (auto& circle : circles) {
+    proxies.push_back(lm2_broadphase2_insert_shape_f32(&bp, lm2_shape2_from_circle_f32(&circle)));
+  }
+
+  auto expected = brute_force_pairs_f32(&bp, proxies);
+  EXPECT_GT(expected.size(), 20u);
+  EXPECT_EQ(tree_pairs_f32(&bp), expected);
+
+  // Truncated output still reports the total
+  std::vector<lm2_broadphase2_pair> few(5);
+  EXPECT_EQ(lm2_broadphase2_find_pairs_f32(&bp, few.data(), few.size()), expected.size());
+}
+
+TEST_F(Broadphase2Test, QueryAabbMatchesBruteForce_F32) {
+  const size_t count = 1500;
+  std::vector<lm2_circle_f32> circles = random_circles_f32(count, 4);
+  std::vector<lm2_broadphase2_node_f32> nodes(lm2_broadphase2_node_buffer_size_f32(count));
+  lm2_broadphase2_f32 bp = lm2_broadphase2_make_f32(nodes.data(), nodes.size(), 0.25f);
+  std::vector<lm2_broadphase2_proxy> proxies;
+  for (auto& circle : circles) {
+    proxies.push_back(lm2_broadphase2_insert_shape_f32(&bp, lm2_shape2_from_circle_f32(&circle)));
+  }
+
+  std::mt19937 rng(5);
+  std::uniform_real_distribution<float> pos(0.0f, 1000.0f);
+  for (int q = 0; q < 100; q++) {
+    float x = pos(rng), y = pos(rng);
+    lm2_r2_f32 query = lm2_r2_from_scalars_f32(x, y, x + 60.0f, y + 30.0f);
+    std::vector<lm2_broadphase2_proxy> expected;
+    for (lm2_broadphase2_proxy p : proxies) {
+      if (overlap_f32(lm2_broadphase2_get_fat_bounds_f32(&bp, p), query)) {
+        expected.push_back(p);
+      }
+    }
+    std::vector<lm2_broadphase2_proxy> found(count);
+    found.resize(lm2_broadphase2_query_aabb_f32(&bp, query, found.data(), found.size()));
+    std::sort(expected.begin(), expected.end());
+    std::sort(found.begin(), found.end());
+    EXPECT_EQ(found, expected);
+  }
+}
+
+TEST_F(Broadphase2Test, QueryRayFindsCrossedProxies_F32) {
+  std::vector<lm2_broadphase2_node_f32> nodes(lm2_broadphase2_node_buffer_size_f32(8));
+  lm2_broadphase2_f32 bp = lm2_broadphase2_make_f32(nodes.data(), nodes.size(), 0.0f);
+  lm2_r2_f32 boxes[4] = {lm2_r2_from_scalars_f32(2, -1, 3, 1), lm2_r2_from_scalars_f32(5, -1, 6, 1), lm2_r2_from_scalars_f32(5, 2, 6, 3),
+                         lm2_r2_from_scalars_f32(20, -1, 21, 1)};
+  lm2_broadphase2_proxy proxies[4];
+  for (int i = 0; i < 4; i++) {
+    proxies[i] = lm2_broadphase2_insert_f32(&bp, boxes[i], lm2_shape2_from_aabb2_f32(&boxes[i]));
+  }
+
+  // Along +x up to t = 10: crosses the first two boxes, misses the raised one and stops short of the far one
+  lm2_ray2_f32 ray = lm2_ray2_make_f32(lm2_v2_make_f32(0, 0), lm2_v2_make_f32(1, 0), 10);
+  std::vector<lm2_broadphase2_proxy> found(4);
+  found.resize(lm2_broadphase2_query_ray_f32(&bp, ray, found.data(), found.size()));
+  ASSERT_EQ(found.size(), 2u);
+  std::sort(found.begin(), found.end());
+  std::vector<lm2_broadphase2_proxy> expected = {proxies[0], proxies[1]};
+  std::sort(expected.begin(), expected.end());
+  EXPECT_EQ(found, expected);
+}
+
+TEST_F(Broadphase2Test, RaycastMatchesBruteForce_F32) {
+  const size_t count = 1000;
+  std::vector<lm2_circle_f32> circles = random_circles_f32(count, 6);
+  std::vector<lm2_broadphase2_node_f32> nodes(lm2_broadphase2_node_buffer_size_f32(count));
+  lm2_broadphase2_f32 bp = lm2_broadphase2_make_f32(nodes.data(), nodes.size(), 0.5f);
+  std::vector<lm2_broadphase2_proxy> proxies;
+  for (auto& circle : circles) {
+    proxies.push_back(lm2_broadphase2_insert_shape_f32(&bp, lm2_shape2_from_circle_f32(&circle)));
+  }
+
+  std::mt19937 rng(7);
+  std::uniform_real_distribution<float> pos(0.0f, 1000.0f);
+  int hits = 0;
+  for (int r = 0; r < 200; r++) {
+    lm2_ray2_f32 ray = lm2_ray2_from_points_f32(lm2_v2_make_f32(pos(rng), pos(rng)), lm2_v2_make_f32(pos(rng), pos(rng)));
+    lm2_rayhit2_f32 expected = {};
+    for (size_t i = 0; i < count; i++) {
+      lm2_rayhit2_f32 hit = lm2_raycast_shape2_f32(ray, lm2_shape2_from_circle_f32(&circles[i]));
+      if (hit.hit && (!expected.hit || hit.t < expected.t)) {
+        expected = hit;
+      }
+    }
+    lm2_broadphase2_hit_f32 hit = lm2_broadphase2_raycast_f32(&bp, ray);
+    ASSERT_EQ(hit.rayhit.hit, expected.hit);
+    if (expected.hit) {
+      hits++;
+      EXPECT_NEAR(hit.rayhit.t, expected.t, EPSILON_F32 * 100.0f);
+      lm2_rayhit2_f32 own = lm2_raycast_shape2_f32(ray, lm2_broadphase2_get_shape_f32(&bp, hit.proxy));
+      EXPECT_TRUE(own.hit);
+      EXPECT_NEAR(own.t, hit.rayhit.t, EPSILON_F32 * 100.0f);
+    }
+  }
+  EXPECT_GT(hits, 50);
+}
+
+TEST_F(Broadphase2Test, FindPairs_F64) {
+  std::vector<lm2_broadphase2_node_f64> nodes(lm2_broadphase2_node_buffer_size_f64(3));
+  lm2_broadphase2_f64 bp = lm2_broadphase2_make_f64(nodes.data(), nodes.size(), 0.0);
+  lm2_circle_f64 circles[3] = {lm2_circle_make_coords_f64(0, 0, 1), lm2_circle_make_coords_f64(1.5, 0, 1),
+                               lm2_circle_make_coords_f64(10, 0, 1)};
+  lm2_broadphase2_proxy proxies[3];
+  for (int i = 0; i < 3; i++) {
+    proxies[i] = lm2_broadphase2_insert_shape_f64(&bp, lm2_shape2_from_circle_f64(&circles[i]));
+  }
+
+  lm2_broadphase2_pair pairs[4];
+  ASSERT_EQ(lm2_broadphase2_find_pairs_f64(&bp, pairs, 4), 1u);
+  EXPECT_EQ(pairs[0].a, std::min(proxies[0], proxies[1]));
+  EXPECT_EQ(pairs[0].b, std::max(proxies[0], proxies[1]));
+
+  lm2_broadphase2_remove_f64(&bp, proxies[1]);
+  EXPECT_EQ(lm2_broadphase2_find_pairs_f64(&bp, pairs, 4), 0u);
+  EXPECT_EQ(bp.proxy_count, 2u);
+
+  lm2_r2_f64 fat = lm2_broadphase2_get_fat_bounds_f64(&bp, proxies[2]);
+  EXPECT_NEAR(fat.min.x, 9.0, EPSILON_F64);
+  EXPECT_NEAR(fat.max.x, 11.0, EPSILON_F64);
+}
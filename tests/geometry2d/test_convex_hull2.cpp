@@ -0,0 +1,165 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+#include "lm2/geometry2d/lm2_convex_hull2.h"
+#include "lm2/geometry2d/lm2_manifold2.h"
+
+// Test fixture for ConvexHull2 tests
+class ConvexHull2Test : public ::testing::Test {
+ protected:
+  static constexpr float EPSILON_F32 = 1e-5f;
+  static constexpr double EPSILON_F64 = 1e-10;
+
+  template <typename V>
+  static double cross3(V a, V b, V c) {
+    return ((double)b.x - a.x) * ((double)c.y - a.y) - ((double)b.y - a.y) * ((double)c.x - a.x);
+  }
+
+  // Every hull corner turns left and no point (of every step-th) lies outside an edge
+  template <typename V>
+  static void expect_hull(const std::vector<V>& points, const std::vector<V>& hull, size_t step = 1) {
+    ASSERT_GE(hull.size(), 3u);
+    for (size_t i = 0; i < hull.size(); i++) {
+      EXPECT_GT(cross3(hull[i], hull[(i + 1) % hull.size()], hull[(i + 2) % hull.size()]), 0.0);
+    }
+    for (size_t k = 0; k < points.size(); k += step) {
+      const V& p = points[k];
+      for (size_t i = 0; i < hull.size(); i++) {
+        EXPECT_GE(cross3(hull[i], hull[(i + 1) % hull.size()], p), 0.0);
+      }
+    }
+  }
+};
+
+// =============================================================================
+// Small Inputs
+// =============================================================================
+
+TEST_F(ConvexHull2Test, SquareWithInteriorAndEdgePoints_F64) {
+  lm2_v2_f64 points[7] = {{1, 1}, {0, 0}, {0.5, 0.5}, {1, 0}, {0, 1}, {0.5, 0}, {0, 0.25}};
+  lm2_v2_f64 hull[7];
+
+  ASSERT_EQ(lm2_convex_hull2_f64(points, 7, hull, 7, 1), 4u);
+
+  // Counter-clockwise from the lowest x, then lowest y; collinear points dropped
+  EXPECT_NEAR(hull[0].x, 0.0, EPSILON_F64);
+  EXPECT_NEAR(hull[0].y, 0.0, EPSILON_F64);
+  EXPECT_NEAR(hull[1].x, 1.0, EPSILON_F64);
+  EXPECT_NEAR(hull[1].y, 0.0, EPSILON_F64);
+  EXPECT_NEAR(hull[2].x, 1.0, EPSILON_F64);
+  EXPECT_NEAR(hull[2].y, 1.0, EPSILON_F64);
+  EXPECT_NEAR(hull[3].x, 0.0, EPSILON_F64);
+  EXPECT_NEAR(hull[3].y, 1.0, EPSILON_F64);
+}
+
+TEST_F(ConvexHull2Test, DegenerateInputs_F32) {
+  lm2_v2_f32 hull[4];
+
+  EXPECT_EQ(lm2_convex_hull2_f32(NULL, 0, hull, 4, 1), 0u);
+
+  lm2_v2_f32 same[3] = {{2, 3}, {2, 3}, {2, 3}};
+  ASSERT_EQ(lm2_convex_hull2_f32(same, 3, hull, 4, 1), 1u);
+  EXPECT_NEAR(hull[0].x, 2.0f, EPSILON_F32);
+
+  lm2_v2_f32 line[4] = {{3, 3}, {1, 1}, {2, 2}, {0, 0}};
+  ASSERT_EQ(lm2_convex_hull2_f32(line, 4, hull, 4, 1), 2u);
+  EXPECT_NEAR(hull[0].x, 0.0f, EPSILON_F32);
+  EXPECT_NEAR(hull[1].x, 3.0f, EPSILON_F32);
+
+  lm2_v2_f32 with_nan[4] = {{0, 0}, {NAN, 5}, {1, 0}, {0, INFINITY}};
+  EXPECT_EQ(lm2_convex_hull2_f32(with_nan, 4, hull, 4, 1), 2u);
+}
+
+TEST_F(ConvexHull2Test, CapacityOnlyLimitsOutput_F64) {
+  std::vector<lm2_v2_f64> points;
+  for (int i = 0; i < 12; i++) {
+    double angle = 6.283185307179586 * i / 12;
+    points.push_back(lm2_v2_make_f64(std::cos(angle), std::sin(angle)));
+  }
+  lm2_v2_f64 hull[5];
+
+  EXPECT_EQ(lm2_convex_hull2_f64(points.data(), points.size(), NULL, 0, 1), 12u);
+  EXPECT_EQ(lm2_convex_hull2_f64(points.data(), points.size(), hull, 5, 1), 12u);
+  EXPECT_NEAR(hull[0].x, -1.0, EPSILON_F64);
+}
+
+TEST_F(ConvexHull2Test, ConvexHullWrapperHasNoVertexCap_F32) {
+  std::vector<lm2_v2_f32> points;
+  for (int i = 0; i < 20; i++) {
+    float angle = 6.2831853f * (float)i / 20.0f;
+    points.push_back(lm2_v2_make_f32(std::cos(angle), std::sin(angle)));
+  }
+  points.push_back(lm2_v2_make_f32(0.0f, 0.0f));
+  std::vector<lm2_v2_f32> hull(points.size());
+
+  EXPECT_EQ(lm2_convex_hull_f32(points.data(), (int)points.size(), hull.data(), (int)hull.size()), 20);
+  EXPECT_EQ(lm2_convex_hull_f32(points.data(), (int)points.size(), hull.data(), 6), 6);
+}
+
+// =============================================================================
+// Large Inputs
+// =============================================================================
+
+TEST_F(ConvexHull2Test, LargeCloudSameForAnyThreadCount_F64) {
+  std::mt19937 rng(11);
+  std::normal_distribution<double> normal;
+  std::vector<lm2_v2_f64> points(100000);
+  for (auto& p : points) {
+    p = lm2_v2_make_f64(normal(rng), normal(rng));
+  }
+
+  size_t count = lm2_convex_hull2_f64(points.data(), points.size(), NULL, 0, 1);
+  std::vector<lm2_v2_f64> hull(count);
+  std::vector<lm2_v2_f64> threaded(count);
+  ASSERT_EQ(lm2_convex_hull2_f64(points.data(), points.size(), hull.data(), count, 1), count);
+  ASSERT_EQ(lm2_convex_hull2_f64(points.data(), points.size(), threaded.data(), count, 4), count);
+
+  expect_hull(points, hull);
+  for (size_t i = 0; i < count; i++) {
+    EXPECT_EQ(hull[i].x, threaded[i].x);
+    EXPECT_EQ(hull[i].y, threaded[i].y);
+  }
+}
+
+TEST_F(ConvexHull2Test, LargeCircleKeepsEveryPoint_F32) {
+  // Points on a circle survive the extreme point filter, and most are on the hull
+  std::vector<lm2_v2_f32> points;
+  for (int i = 0; i < 40000; i++) {
+    double angle = 6.283185307179586 * i / 40000;
+    points.push_back(lm2_v2_make_f32((float)(1000.0 * std::cos(angle)), (float)(1000.0 * std::sin(angle))));
+  }
+  std::shuffle(points.begin(), points.end(), std::mt19937(3));
+  std::vector<lm2_v2_f32> hull(points.size());
+
+  size_t count = lm2_convex_hull2_f32(points.data(), points.size(), hull.data(), hull.size(), 0);
+  hull.resize(count);
+
+  EXPECT_GT(count, 20000u);
+  expect_hull(points, hull, 101);
+}
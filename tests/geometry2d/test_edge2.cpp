@@ -23,7 +23,9 @@ SOFTWARE.
 */
 
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <cmath>
+#include <vector>
 #include "lm2/geometry2d/lm2_edge2.h"
 
 // Test fixture for Edge2 tests
@@ -342,3 +344,109 @@ TEST_F(Edge2Test, CurrentAPIs_F32) {
   EXPECT_FLOAT_EQ(lm2_point_to_edge2_distance_sq_f32(lm2_v2_make_f32(2.0f, 3.0f), horizontal), 9.0f);
   EXPECT_FLOAT_EQ(lm2_edge2_to_edge2_distance_sq_f32(horizontal, crossing), 0.0f);
 }
+
+// =============================================================================
+// Edge Set Intersection Tests
+// =============================================================================
+
+TEST_F(Edge2Test, FindIntersectionsGrid_F64) {
+  // 10 horizontal and 10 vertical edges crossing in a grid
+  std::vector<lm2_edge2_f64> edges;
+  for (int i = 0; i < 10; ++i) {
+    edges.push_back(lm2_edge2_make_coords_f64(-1.0, (double)i, 10.0, (double)i));
+  }
+  for (int i = 0; i < 10; ++i) {
+    edges.push_back(lm2_edge2_make_coords_f64((double)i + 0.5, -1.0, (double)i + 0.5, 10.0));
+  }
+  std::vector<lm2_edge2_intersection_f64> hits(100);
+  size_t count = lm2_edge2_find_intersections_f64(edges.data(), edges.size(), false, hits.data(), hits.size(), 1);
+  ASSERT_EQ(count, 100u);
+  for (size_t k = 0; k < count; ++k) {
+    uint32_t h = hits[k].edge_a;
+    uint32_t v = hits[k].edge_b;
+    ASSERT_LT(h, 10u);
+    ASSERT_GE(v, 10u);
+    EXPECT_NEAR(hits[k].point.x, (double)(v - 10) + 0.5, EPSILON_F64);
+    EXPECT_NEAR(hits[k].point.y, (double)h, EPSILON_F64);
+    if (k > 0) {
+      EXPECT_TRUE(hits[k - 1].edge_a < h || (hits[k - 1].edge_a == h && hits[k - 1].edge_b < v));
+    }
+  }
+}
+
+TEST_F(Edge2Test, FindIntersectionsCapacityAndSharedEndpoints_F64) {
+  // Closed square outline plus one diagonal across it
+  std::vector<lm2_edge2_f64> edges = {
+      lm2_edge2_make_coords_f64(0.0, 0.0, 4.0, 0.0),
+      lm2_edge2_make_coords_f64(4.0, 0.0, 4.0, 4.0),
+      lm2_edge2_make_coords_f64(4.0, 4.0, 0.0, 4.0),
+      lm2_edge2_make_coords_f64(0.0, 4.0, 0.0, 0.0),
+      lm2_edge2_make_coords_f64(-1.0, 2.0, 5.0, 2.0),
+  };
+  // Every corner touches, plus the diagonal crossing the two side edges
+  EXPECT_EQ(lm2_edge2_find_intersections_f64(edges.data(), edges.size(), false, NULL, 0, 1), 6u);
+
+  lm2_edge2_intersection_f64 hits[2];
+  size_t count = lm2_edge2_find_intersections_f64(edges.data(), edges.size(), true, hits, 2, 1);
+  ASSERT_EQ(count, 2u);
+  EXPECT_EQ(hits[0].edge_a, 1u);
+  EXPECT_EQ(hits[0].edge_b, 4u);
+  EXPECT_DOUBLE_EQ(hits[0].point.x, 4.0);
+  EXPECT_DOUBLE_EQ(hits[0].point.y, 2.0);
+  EXPECT_EQ(hits[1].edge_a, 3u);
+  EXPECT_EQ(hits[1].edge_b, 4u);
+
+  // Overlapping collinear edges with a shared endpoint are still reported
+  std::vector<lm2_edge2_f64> folded = {
+      lm2_edge2_make_coords_f64(0.0, 0.0, 4.0, 0.0),
+      lm2_edge2_make_coords_f64(4.0, 0.0, 1.0, 0.0),
+  };
+  count = lm2_edge2_find_intersections_f64(folded.data(), folded.size(), true, hits, 2, 1);
+  ASSERT_EQ(count, 1u);
+  EXPECT_DOUBLE_EQ(hits[0].point.x, 4.0);
+}
+
+TEST_F(Edge2Test, FindIntersectionsMatchesPairwiseAndThreads_F32) {
+  uint32_t state = 777u;
+  auto next = [&state]() {
+    state = state * 1664525u + 1013904223u;
+    return (float)(state >> 8) / 16777216.0f;
+  };
+  // Short random edges, enough to take the threaded path
+  std::vector<lm2_edge2_f32> edges(4500);
+  for (auto& edge : edges) {
+    float x = next() * 100.0f;
+    float y = next() * 100.0f;
+    edge = lm2_edge2_make_coords_f32(x, y, x + (next() - 0.5f) * 4.0f, y + (next() - 0.5f) * 4.0f);
+  }
+
+  std::vector<std::pair<uint32_t, uint32_t>> expected;
+  for (uint32_t i = 0; i < (uint32_t)edges.size(); ++i) {
+    for (uint32_t j = i + 1; j < (uint32_t)edges.size(); ++j) {
+      if (lm2_edges2_intersect_f32(edges[i], edges[j])) {
+        expected.push_back({i, j});
+      }
+    }
+  }
+  ASSERT_GT(expected.size(), 100u);
+
+  size_t total = lm2_edge2_find_intersections_f32(edges.data(), edges.size(), false, NULL, 0, 1);
+  ASSERT_EQ(total, expected.size());
+  std::vector<lm2_edge2_intersection_f32> serial(total);
+  std::vector<lm2_edge2_intersection_f32> threaded(total);
+  lm2_edge2_find_intersections_f32(edges.data(), edges.size(), false, serial.data(), total, 1);
+  lm2_edge2_find_intersections_f32(edges.data(), edges.size(), false, threaded.data(), total, 4);
+  for (size_t k = 0; k < total; ++k) {
+    EXPECT_EQ(serial[k].edge_a, expected[k].first);
+    EXPECT_EQ(serial[k].edge_b, expected[k].second);
+    EXPECT_EQ(threaded[k].edge_a, serial[k].edge_a);
+    EXPECT_EQ(threaded[k].edge_b, serial[k].edge_b);
+    EXPECT_EQ(threaded[k].point.x, serial[k].point.x);
+    EXPECT_EQ(threaded[k].point.y, serial[k].point.y);
+    // The point lies on both edges
+    lm2_edge2_f32 a = edges[serial[k].edge_a];
+    lm2_edge2_f32 b = edges[serial[k].edge_b];
+    EXPECT_LT(lm2_point_to_edge2_distance_sq_f32(serial[k].point, a), 1e-6f);
+    EXPECT_LT(lm2_point_to_edge2_distance_sq_f32(serial[k].point, b), 1e-6f);
+  }
+}
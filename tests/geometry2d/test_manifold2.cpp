@@ -426,3 +426,74 @@ TEST_F(Manifold2Test, GenericCircleAABBDispatchMatchesDirectAndReversesNormal_F6
   EXPECT_DOUBLE_EQ(reversed.normal.y, -generic.normal.y);
   EXPECT_DOUBLE_EQ(std::hypot(reversed.normal.x, reversed.normal.y), 1.0);
 }
+
+// =============================================================================
+// Convex Polygon Overloads
+// =============================================================================
+
+TEST_F(Manifold2Test, ConvexPolygonOverloadsMatchPolygonPath_F32) {
+  lm2_v2_f32 vertices_a[] = {
+      {0.0f, 0.0f},
+      {4.0f, 0.0f},
+      {4.0f, 4.0f},
+      {0.0f, 4.0f}
+  };
+  lm2_v2_f32 vertices_b[] = {
+      {3.0f, 1.0f},
+      {7.0f, 1.0f},
+      {5.0f, 5.0f}
+  };
+  lm2_polygon_f32 polygon_a = lm2_polygon_make_f32(vertices_a, 4);
+  lm2_polygon_f32 polygon_b = lm2_polygon_make_f32(vertices_b, 3);
+  lm2_v2_f32 normals_a[4];
+  lm2_v2_f32 normals_b[3];
+  lm2_convex_polygon_f32 convex_a = lm2_convex_polygon_make_f32(polygon_a, normals_a);
+  lm2_convex_polygon_f32 convex_b = lm2_convex_polygon_make_f32(polygon_b, normals_b);
+
+  lm2_circle_f32 circle = lm2_circle_make_coords_f32(5.0f, 2.0f, 1.5f);
+  EXPECT_EQ(lm2_collide_circle_to_convex_polygon_f32(circle, convex_a), lm2_collide_circle_to_polygon_f32(circle, polygon_a));
+  EXPECT_TRUE(lm2_collide_convex_polygon_to_convex_polygon_f32(convex_a, convex_b));
+
+  lm2_manifold_f32 direct = {};
+  lm2_manifold_f32 prepared = {};
+  lm2_manifold_polygon_to_polygon_f32(polygon_a, polygon_b, &direct);
+  lm2_manifold_convex_polygon_to_convex_polygon_f32(convex_a, convex_b, &prepared);
+  ASSERT_GT(direct.count, 0);
+  ASSERT_EQ(prepared.count, direct.count);
+  EXPECT_FLOAT_EQ(prepared.normal.x, direct.normal.x);
+  EXPECT_FLOAT_EQ(prepared.normal.y, direct.normal.y);
+  for (int i = 0; i < direct.count; ++i) {
+    EXPECT_FLOAT_EQ(prepared.depths[i], direct.depths[i]);
+    EXPECT_FLOAT_EQ(prepared.contact_points[i].x, direct.contact_points[i].x);
+    EXPECT_FLOAT_EQ(prepared.contact_points[i].y, direct.contact_points[i].y);
+  }
+}
+
+TEST_F(Manifold2Test, ConvexPolygonBoundsRejectSeparatedShapes_F64) {
+  lm2_v2_f64 vertices[] = {
+      {0.0, 0.0},
+      {2.0, 0.0},
+      {2.0, 2.0},
+      {0.0, 2.0}
+  };
+  lm2_v2_f64 normals[4];
+  lm2_convex_polygon_f64 convex = lm2_convex_polygon_make_f64(lm2_polygon_make_f64(vertices, 4), normals);
+
+  lm2_circle_f64 circle = lm2_circle_make_coords_f64(10.0, 10.0, 1.0);
+  lm2_capsule2_f64 capsule = lm2_capsule2_make_coords_f64(-5.0, 5.0, 5.0, 5.0, 0.5);
+  lm2_r2_f64 aabb = lm2_r2_from_min_max_f64(lm2_v2_make_f64(3.0, 0.0), lm2_v2_make_f64(4.0, 1.0));
+  EXPECT_FALSE(lm2_collide_circle_to_convex_polygon_f64(circle, convex));
+  EXPECT_FALSE(lm2_collide_capsule_to_convex_polygon_f64(capsule, convex));
+  EXPECT_FALSE(lm2_collide_aabb_to_convex_polygon_f64(aabb, convex));
+
+  lm2_manifold_f64 manifold;
+  manifold.count = -1;
+  lm2_manifold_circle_to_convex_polygon_f64(circle, convex, &manifold);
+  EXPECT_EQ(manifold.count, 0);
+
+  lm2_circle_f64 touching = lm2_circle_make_coords_f64(1.0, 2.5, 1.0);
+  EXPECT_TRUE(lm2_collide_circle_to_convex_polygon_f64(touching, convex));
+  lm2_manifold_circle_to_convex_polygon_f64(touching, convex, &manifold);
+  ASSERT_EQ(manifold.count, 1);
+  EXPECT_NEAR(manifold.depths[0], 0.5, 1e-6);
+}
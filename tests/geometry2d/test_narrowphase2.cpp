@@ -0,0 +1,182 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <gtest/gtest.h>
+#include <cstring>
+#include <random>
+#include <vector>
+#include "lm2/geometry2d/lm2_narrowphase2.h"
+
+// Test fixture for Narrowphase2 tests
+class Narrowphase2Test : public ::testing::Test {
+ protected:
+  static constexpr float EPSILON_F32 = 1e-5f;
+  static constexpr double EPSILON_F64 = 1e-10;
+};
+
+// Owns one shape of every type per slot, clustered so many pairs touch
+struct MixedScene_F32 {
+  std::vector<lm2_circle_f32> circles;
+  std::vector<lm2_capsule2_f32> capsules;
+  std::vector<lm2_aabb2_f32> aabbs;
+  std::vector<lm2_v2_f32> triangles;
+  std::vector<lm2_v2_f32> polygon_vertices;
+  std::vector<lm2_polygon_f32> polygons;
+  std::vector<lm2_edge2_f32> edges;
+  std::vector<lm2_shape2_f32> shapes;
+  std::vector<lm2_narrowphase2_pair> pairs;
+
+  MixedScene_F32(size_t shape_count, size_t pair_count, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> pos(-10.0f, 10.0f);
+    std::uniform_real_distribution<float> off(-1.0f, 1.0f);
+    circles.reserve(shape_count);
+    capsules.reserve(shape_count);
+    aabbs.reserve(shape_count);
+    triangles.reserve(3 * shape_count);
+    polygon_vertices.reserve(6 * shape_count);
+    polygons.reserve(shape_count);
+    edges.reserve(shape_count);
+    for (size_t i = 0; i < shape_count; ++i) {
+      lm2_v2_f32 c = {pos(rng), pos(rng)};
+      lm2_v2_f32 d = {off(rng), off(rng)};
+      switch (i % 6) {
+        case 0:
+          circles.push_back(lm2_circle_make_f32(c, 1.0f));
+          shapes.push_back(lm2_shape2_from_circle_f32(&circles.back()));
+          break;
+        case 1:
+          capsules.push_back(lm2_capsule2_make_f32(lm2_v2_sub_f32(c, d), lm2_v2_add_f32(c, d), 0.5f));
+          shapes.push_back(lm2_shape2_from_capsule_f32(&capsules.back()));
+          break;
+        case 2:
+          aabbs.push_back(lm2_r2_from_min_max_f32({c.x - 1.0f, c.y - 0.5f}, {c.x + 1.0f, c.y + 0.5f}));
+          shapes.push_back(lm2_shape2_from_aabb2_f32(&aabbs.back()));
+          break;
+        case 3: {
+          size_t at = triangles.size();
+          triangles.push_back({c.x - 1.0f, c.y - 1.0f});
+          triangles.push_back({c.x + 1.0f, c.y - 1.0f});
+          triangles.push_back({c.x, c.y + 1.0f});
+          shapes.push_back(lm2_shape2_from_triangle_f32((lm2_triangle2_f32*)&triangles[at]));
+          break;
+        }
+        case 4: {
+          size_t at = polygon_vertices.size();
+          polygon_vertices.resize(at + 6);
+          lm2_polygon_make_regular_f32(&polygon_vertices[at], 6, c, 1.0f);
+          polygons.push_back(lm2_polygon_make_f32(&polygon_vertices[at], 6));
+          shapes.push_back(lm2_shape2_from_polygon_f32(&polygons.back()));
+          break;
+        }
+        default:
+          edges.push_back(lm2_edge2_make_f32(lm2_v2_sub_f32(c, d), lm2_v2_add_f32(c, d)));
+          shapes.push_back(lm2_shape2_from_edge_f32(&edges.back()));
+          break;
+      }
+    }
+    std::uniform_int_distribution<uint32_t> pick(0, (uint32_t)shape_count - 1);
+    for (size_t i = 0; i < pair_count; ++i) {
+      pairs.push_back({pick(rng), pick(rng)});
+    }
+  }
+};
+
+static void expect_same_manifold_f32(const lm2_manifold_f32& a, const lm2_manifold_f32& b) {
+  ASSERT_EQ(a.count, b.count);
+  EXPECT_EQ(a.normal.x, b.normal.x);
+  EXPECT_EQ(a.normal.y, b.normal.y);
+  for (int i = 0; i < a.count; ++i) {
+    EXPECT_EQ(a.depths[i], b.depths[i]);
+    EXPECT_EQ(a.contact_points[i].x, b.contact_points[i].x);
+    EXPECT_EQ(a.contact_points[i].y, b.contact_points[i].y);
+  }
+}
+
+TEST_F(Narrowphase2Test, MatchesPerPairDispatch_F32) {
+  MixedScene_F32 scene(600, 5000, 3);
+  size_t n = scene.pairs.size();
+
+  std::vector<lm2_manifold_f32> expected;
+  std::vector<uint32_t> expected_pairs;
+  for (size_t i = 0; i < n; ++i) {
+    lm2_manifold_f32 m = {};
+    lm2_manifold_shape_to_shape_f32(scene.shapes[scene.pairs[i].a], scene.shapes[scene.pairs[i].b], &m);
+    if (m.count > 0) {
+      expected.push_back(m);
+      expected_pairs.push_back((uint32_t)i);
+    }
+  }
+  ASSERT_GT(expected.size(), 0u);
+
+  for (uint32_t threads : {1u, 4u, 0u}) {
+    std::vector<uint32_t> order(n);
+    std::vector<lm2_manifold_f32> out(n);
+    std::vector<uint32_t> out_pairs(n);
+    size_t count = lm2_narrowphase2_collide_f32(scene.shapes.data(), scene.pairs.data(), n, order.data(), out.data(), out_pairs.data(), threads);
+    ASSERT_EQ(count, expected.size()) << "threads " << threads;
+    for (size_t i = 0; i < count; ++i) {
+      ASSERT_EQ(out_pairs[i], expected_pairs[i]);
+      expect_same_manifold_f32(out[i], expected[i]);
+    }
+  }
+}
+
+TEST_F(Narrowphase2Test, EdgePairsNeverTouch_F32) {
+  lm2_edge2_f32 edge = lm2_edge2_make_f32({-1.0f, 0.0f}, {1.0f, 0.0f});
+  lm2_circle_f32 circle = lm2_circle_make_f32({0.0f, 0.0f}, 1.0f);
+  lm2_shape2_f32 shapes[2] = {lm2_shape2_from_edge_f32(&edge), lm2_shape2_from_circle_f32(&circle)};
+  lm2_narrowphase2_pair pairs[3] = {{0, 1}, {1, 0}, {0, 0}};
+  uint32_t order[3];
+  lm2_manifold_f32 out[3];
+  EXPECT_EQ(lm2_narrowphase2_collide_f32(shapes, pairs, 3, order, out, NULL, 1), 0u);
+}
+
+TEST_F(Narrowphase2Test, CirclesAndBoxes_F64) {
+  lm2_circle_f64 circles[2] = {lm2_circle_make_f64({0.0, 0.0}, 1.0), lm2_circle_make_f64({1.5, 0.0}, 1.0)};
+  lm2_aabb2_f64 box = lm2_r2_from_min_max_f64({5.0, 5.0}, {6.0, 6.0});
+  lm2_shape2_f64 shapes[3] = {lm2_shape2_from_circle_f64(&circles[0]), lm2_shape2_from_circle_f64(&circles[1]),
+                              lm2_shape2_from_aabb2_f64(&box)};
+  lm2_narrowphase2_pair pairs[3] = {{0, 2}, {1, 0}, {2, 1}};
+  uint32_t order[3];
+  lm2_manifold_f64 out[3];
+  uint32_t out_pairs[3];
+  size_t count = lm2_narrowphase2_collide_f64(shapes, pairs, 3, order, out, out_pairs, 0);
+  for (size_t i = 0, k = 0; i < 3; ++i) {
+    lm2_manifold_f64 m = {};
+    lm2_manifold_shape_to_shape_f64(shapes[pairs[i].a], shapes[pairs[i].b], &m);
+    if (m.count == 0) {
+      continue;
+    }
+    ASSERT_LT(k, count);
+    EXPECT_EQ(out_pairs[k], i);
+    EXPECT_NEAR(out[k].normal.x, m.normal.x, EPSILON_F64);
+    EXPECT_NEAR(out[k].depths[0], m.depths[0], EPSILON_F64);
+    ++k;
+  }
+}
+
+TEST_F(Narrowphase2Test, EmptyPairList_F32) {
+  EXPECT_EQ(lm2_narrowphase2_collide_f32(NULL, NULL, 0, NULL, NULL, NULL, 0), 0u);
+}
@@ -25,6 +25,7 @@ SOFTWARE.
 #include <gtest/gtest.h>
 #include <cmath>
 #include <vector>
+#include "lm2/geometry2d/lm2_edge2.h"
 #include "lm2/geometry2d/lm2_polygon.h"
 #include "lm2/lm2_constants.h"
 #include "lm2/vectors/lm2_vector_specifics.h"
@@ -449,6 +450,76 @@ TEST_F(PolygonTest, ConvexAndSimpleClassification_F64) {
   EXPECT_FALSE(lm2_polygon_is_simple_f64(lm2_polygon_make_f64(bow_tie, 4)));
 }
 
+// Above the pairwise cutoff, so these go through the sweep
+static std::vector<lm2_v2_f64> star_vertices(size_t n) {
+  std::vector<lm2_v2_f64> vertices(n);
+  for (size_t i = 0; i < n; ++i) {
+    double angle = 2.0 * LM2_PI_F64 * (double)i / (double)n;
+    double radius = (i % 2 == 0) ? 10.0 : 4.0;
+    vertices[i] = lm2_v2_make_f64(radius * cos(angle), radius * sin(angle));
+  }
+  return vertices;
+}
+
+TEST_F(PolygonTest, IsSimpleLargeStar_F64) {
+  std::vector<lm2_v2_f64> vertices = star_vertices(1000);
+  EXPECT_TRUE(lm2_polygon_is_simple_f64(lm2_polygon_make_f64(vertices.data(), vertices.size())));
+
+  // Pull an outer tip across the opposite side
+  vertices[250] = lm2_v2_make_f64(0.0, -12.0);
+  EXPECT_FALSE(lm2_polygon_is_simple_f64(lm2_polygon_make_f64(vertices.data(), vertices.size())));
+}
+
+TEST_F(PolygonTest, IsSimpleDetectsTouchingVertex_F64) {
+  std::vector<lm2_v2_f64> vertices = star_vertices(64);
+  // Move an inner vertex onto a vertex further along the ring
+  vertices[33] = vertices[41];
+  EXPECT_FALSE(lm2_polygon_is_simple_f64(lm2_polygon_make_f64(vertices.data(), vertices.size())));
+}
+
+TEST_F(PolygonTest, IsSimpleRejectsRepeatedVertexAndSpike_F64) {
+  std::vector<lm2_v2_f64> repeated = star_vertices(64);
+  repeated[11] = repeated[10];
+  EXPECT_FALSE(lm2_polygon_is_simple_f64(lm2_polygon_make_f64(repeated.data(), repeated.size())));
+
+  // The ring doubles back from vertex 10 to vertex 9
+  std::vector<lm2_v2_f64> spike = star_vertices(64);
+  spike[11] = spike[9];
+  EXPECT_FALSE(lm2_polygon_is_simple_f64(lm2_polygon_make_f64(spike.data(), spike.size())));
+}
+
+TEST_F(PolygonTest, IsSimpleMatchesPairwiseTest_F32) {
+  // Integer grid coordinates produce many collinear and touching edges
+  uint32_t state = 12345u;
+  auto next = [&state]() {
+    state = state * 1664525u + 1013904223u;
+    return state >> 8;
+  };
+  std::vector<lm2_v2_f32> vertices;
+  for (int trial = 0; trial < 2000; ++trial) {
+    size_t n = 32 + next() % 64;
+    vertices.resize(n);
+    for (size_t i = 0; i < n; ++i) {
+      double angle = 2.0 * LM2_PI_F64 * (double)i / (double)n;
+      double radius = 4.0 + (double)(next() % 5);
+      vertices[i] = lm2_v2_make_f32((float)std::floor(radius * cos(angle)), (float)std::floor(radius * sin(angle)));
+    }
+    lm2_polygon_f32 polygon = lm2_polygon_make_f32(vertices.data(), n);
+
+    bool expected = true;
+    for (size_t i = 0; i < n && expected; ++i) {
+      for (size_t k = i + 2; k < n; ++k) {
+        if (i == 0 && k == n - 1) continue;
+        if (lm2_edge2_segments_intersect_f32(vertices[i], vertices[(i + 1) % n], vertices[k], vertices[(k + 1) % n])) {
+          expected = false;
+          break;
+        }
+      }
+    }
+    ASSERT_EQ(lm2_polygon_is_simple_f32(polygon), expected) << "trial " << trial;
+  }
+}
+
 TEST_F(PolygonTest, TransformationsPreserveExpectedGeometry_F64) {
   lm2_v2_f64 vertices[] = {
       {0.0, 0.0},
@@ -514,6 +585,117 @@ TEST_F(PolygonTest, EarClippingTriangulatesConcavePolygonWithEqualArea_F64) {
   EXPECT_NEAR(triangle_area, lm2_polygon_area_f64(polygon), EPSILON_F64);
 }
 
+// Sum of the signed areas of the output triangles; every triangle must be counter-clockwise
+template <typename V>
+static double triangulated_area(const std::vector<V>& vertices, const size_t* indices, size_t triangle_count) {
+  double area = 0.0;
+  for (size_t i = 0; i < triangle_count; ++i) {
+    EXPECT_LT(indices[i * 3 + 0], vertices.size());
+    EXPECT_LT(indices[i * 3 + 1], vertices.size());
+    EXPECT_LT(indices[i * 3 + 2], vertices.size());
+    V a = vertices[indices[i * 3 + 0]];
+    V b = vertices[indices[i * 3 + 1]];
+    V c = vertices[indices[i * 3 + 2]];
+    double cross = ((double)b.x - a.x) * ((double)c.y - a.y) - ((double)b.y - a.y) * ((double)c.x - a.x);
+    EXPECT_GE(cross, 0.0);
+    area += cross * 0.5;
+  }
+  return area;
+}
+
+TEST_F(PolygonTest, TriangulateClockwiseOutline_F64) {
+  std::vector<lm2_v2_f64> vertices = {
+      {0.0, 4.0},
+      {2.0, 2.0},
+      {4.0, 4.0},
+      {4.0, 0.0},
+      {0.0, 0.0}
+  };
+  lm2_polygon_f64 polygon = lm2_polygon_make_f64(vertices.data(), vertices.size());
+  size_t indices[9] = {};
+
+  size_t count = lm2_polygon_triangulate_f64(polygon, NULL, 0, NULL, 0, indices);
+  ASSERT_EQ(count, 3u);
+  EXPECT_NEAR(triangulated_area(vertices, indices, count), 12.0, EPSILON_F64);
+}
+
+TEST_F(PolygonTest, TriangulateSquareWithHole_F64) {
+  // Outline and hole in one array, the way the output indices number them
+  std::vector<lm2_v2_f64> vertices = {
+      {0.0, 0.0},
+      {10.0, 0.0},
+      {10.0, 10.0},
+      {0.0, 10.0},
+      {3.0, 3.0},
+      {3.0, 7.0},
+      {7.0, 7.0},
+      {7.0, 3.0}
+  };
+  lm2_polygon_f64 polygon = lm2_polygon_make_f64(vertices.data(), 4);
+  lm2_polygon_f64 hole = lm2_polygon_make_f64(vertices.data() + 4, 4);
+
+  size_t max_triangles = lm2_polygon_max_triangle_count_with_holes(8, 1);
+  EXPECT_EQ(max_triangles, 8u);
+  std::vector<size_t> indices(max_triangles * 3);
+  size_t count = lm2_polygon_triangulate_f64(polygon, &hole, 1, NULL, 0, indices.data());
+  ASSERT_EQ(count, 8u);
+  EXPECT_NEAR(triangulated_area(vertices, indices.data(), count), 100.0 - 16.0, EPSILON_F64);
+}
+
+TEST_F(PolygonTest, TriangulateMultipleHolesWithScratchBuffer_F32) {
+  std::vector<lm2_v2_f32> vertices = {
+      {0.0f, 0.0f},
+      {12.0f, 0.0f},
+      {12.0f, 6.0f},
+      {0.0f, 6.0f},
+      // Hole 1 (counter-clockwise)
+      {1.0f, 1.0f},
+      {3.0f, 1.0f},
+      {3.0f, 5.0f},
+      {1.0f, 5.0f},
+      // Hole 2 (clockwise triangle)
+      {5.0f, 1.0f},
+      {6.0f, 4.0f},
+      {7.0f, 1.0f},
+      // Hole 3
+      {9.0f, 2.0f},
+      {11.0f, 2.0f},
+      {11.0f, 4.0f},
+      {9.0f, 4.0f}
+  };
+  lm2_polygon_f32 polygon = lm2_polygon_make_f32(vertices.data(), 4);
+  lm2_polygon_f32 holes[3] = {
+      lm2_polygon_make_f32(vertices.data() + 4, 4),
+      lm2_polygon_make_f32(vertices.data() + 8, 3),
+      lm2_polygon_make_f32(vertices.data() + 11, 4),
+  };
+
+  size_t scratch_size = lm2_polygon_triangulate_scratch_size_f32(vertices.size(), 3);
+  std::vector<unsigned char> scratch(scratch_size);
+  size_t max_triangles = lm2_polygon_max_triangle_count_with_holes(vertices.size(), 3);
+  std::vector<size_t> indices(max_triangles * 3);
+  size_t count = lm2_polygon_triangulate_f32(polygon, holes, 3, scratch.data(), scratch.size(), indices.data());
+  EXPECT_LE(count, max_triangles);  // Collinear bridge points are dropped
+  EXPECT_NEAR(triangulated_area(vertices, indices.data(), count), 72.0 - 8.0 - 3.0 - 4.0, EPSILON_F32 * 100);
+}
+
+TEST_F(PolygonTest, TriangulateLargeStarMatchesArea_F64) {
+  // Above the z-order hashing threshold
+  const size_t n = 2000;
+  std::vector<lm2_v2_f64> vertices(n);
+  for (size_t i = 0; i < n; ++i) {
+    double angle = 2.0 * LM2_PI_F64 * (double)i / (double)n;
+    double radius = (i % 2 == 0) ? 10.0 : 4.0 + 0.001 * (double)(i % 7);
+    vertices[i] = lm2_v2_make_f64(radius * cos(angle), radius * sin(angle));
+  }
+  lm2_polygon_f64 polygon = lm2_polygon_make_f64(vertices.data(), n);
+  std::vector<size_t> indices(lm2_polygon_max_triangle_count(n) * 3);
+
+  size_t count = lm2_polygon_triangulate_f64(polygon, NULL, 0, NULL, 0, indices.data());
+  ASSERT_EQ(count, n - 2);
+  EXPECT_NEAR(triangulated_area(vertices, indices.data(), count), lm2_polygon_area_f64(polygon), 1e-8);
+}
+
 TEST_F(PolygonTest, SplitConvexPolygonPreservesAreaAndVertexLimit_F64) {
   lm2_v2_f64 vertices[] = {
       { 0.0, 0.0},
@@ -536,3 +718,98 @@ TEST_F(PolygonTest, SplitConvexPolygonPreservesAreaAndVertexLimit_F64) {
   }
   EXPECT_NEAR(area, lm2_polygon_area_f64(polygon), EPSILON_F64);
 }
+
+// =============================================================================
+// Convex Polygon Preparation Tests
+// =============================================================================
+
+TEST_F(PolygonTest, ConvexPolygonMakeCachesNormalsAndBounds_F64) {
+  lm2_v2_f64 vertices[] = {
+      {0.0, 0.0},
+      {4.0, 0.0},
+      {4.0, 2.0},
+      {0.0, 2.0}
+  };
+  lm2_v2_f64 normals[4] = {};
+  lm2_convex_polygon_f64 convex = lm2_convex_polygon_make_f64(lm2_polygon_make_f64(vertices, 4), normals);
+
+  EXPECT_EQ(convex.vertices, vertices);
+  EXPECT_EQ(convex.normals, normals);
+  EXPECT_EQ(convex.vertex_count, 4u);
+  EXPECT_NEAR(normals[0].x, 0.0, EPSILON_F64);
+  EXPECT_NEAR(normals[0].y, -1.0, EPSILON_F64);
+  EXPECT_NEAR(normals[1].x, 1.0, EPSILON_F64);
+  EXPECT_NEAR(normals[1].y, 0.0, EPSILON_F64);
+  EXPECT_NEAR(normals[2].x, 0.0, EPSILON_F64);
+  EXPECT_NEAR(normals[2].y, 1.0, EPSILON_F64);
+  EXPECT_NEAR(normals[3].x, -1.0, EPSILON_F64);
+  EXPECT_NEAR(normals[3].y, 0.0, EPSILON_F64);
+  EXPECT_DOUBLE_EQ(convex.bounds.min.x, 0.0);
+  EXPECT_DOUBLE_EQ(convex.bounds.min.y, 0.0);
+  EXPECT_DOUBLE_EQ(convex.bounds.max.x, 4.0);
+  EXPECT_DOUBLE_EQ(convex.bounds.max.y, 2.0);
+}
+
+TEST_F(PolygonTest, ConvexPolygonNormalsAreUnitAndOutward_F32) {
+  lm2_v2_f32 vertices[6];
+  lm2_polygon_make_regular_f32(vertices, 6, lm2_v2_make_f32(3.0f, -2.0f), 5.0f);
+  lm2_polygon_f32 polygon = lm2_polygon_make_f32(vertices, 6);
+  lm2_v2_f32 normals[6];
+  lm2_convex_polygon_f32 convex = lm2_convex_polygon_make_f32(polygon, normals);
+
+  lm2_r2_f32 expected = lm2_polygon_bounds_f32(polygon);
+  EXPECT_FLOAT_EQ(convex.bounds.min.x, expected.min.x);
+  EXPECT_FLOAT_EQ(convex.bounds.min.y, expected.min.y);
+  EXPECT_FLOAT_EQ(convex.bounds.max.x, expected.max.x);
+  EXPECT_FLOAT_EQ(convex.bounds.max.y, expected.max.y);
+
+  lm2_v2_f32 center = lm2_polygon_centroid_f32(polygon);
+  for (size_t i = 0; i < 6; ++i) {
+    EXPECT_NEAR(lm2_v2_length_f32(normals[i]), 1.0f, EPSILON_F32);
+    lm2_v2_f32 to_edge = lm2_v2_sub_f32(vertices[i], center);
+    EXPECT_GT(lm2_v2_dot_f32(to_edge, normals[i]), 0.0f);
+  }
+}
+
+TEST_F(PolygonTest, ConvexPolygonTranslateKeepsNormalsAndMovesBounds_F32) {
+  lm2_v2_f32 vertices[3] = {
+      {0.0f, 0.0f},
+      {2.0f, 0.0f},
+      {0.0f, 2.0f}
+  };
+  lm2_v2_f32 normals[3];
+  lm2_convex_polygon_f32 convex = lm2_convex_polygon_make_f32(lm2_polygon_make_f32(vertices, 3), normals);
+  lm2_v2_f32 normals_before[3] = {normals[0], normals[1], normals[2]};
+
+  lm2_convex_polygon_translate_f32(&convex, lm2_v2_make_f32(10.0f, -5.0f));
+
+  EXPECT_FLOAT_EQ(vertices[1].x, 12.0f);
+  EXPECT_FLOAT_EQ(vertices[1].y, -5.0f);
+  EXPECT_FLOAT_EQ(convex.bounds.min.x, 10.0f);
+  EXPECT_FLOAT_EQ(convex.bounds.min.y, -5.0f);
+  EXPECT_FLOAT_EQ(convex.bounds.max.x, 12.0f);
+  EXPECT_FLOAT_EQ(convex.bounds.max.y, -3.0f);
+  for (size_t i = 0; i < 3; ++i) {
+    EXPECT_FLOAT_EQ(normals[i].x, normals_before[i].x);
+    EXPECT_FLOAT_EQ(normals[i].y, normals_before[i].y);
+  }
+}
+
+TEST_F(PolygonTest, ConvexPolygonRefreshAfterInPlaceEdit_F64) {
+  lm2_v2_f64 vertices[4];
+  lm2_polygon_make_rect_f64(vertices, lm2_v2_make_f64(0.0, 0.0), lm2_v2_make_f64(1.0, 1.0));
+  lm2_v2_f64 normals[4];
+  lm2_convex_polygon_f64 convex = lm2_convex_polygon_make_f64(lm2_polygon_make_f64(vertices, 4), normals);
+
+  lm2_polygon_f64 view = lm2_convex_polygon_as_polygon_f64(convex);
+  EXPECT_EQ(view.vertices, vertices);
+  EXPECT_EQ(view.vertex_count, 4u);
+
+  lm2_polygon_scale_f64(view, lm2_v2_make_f64(0.0, 0.0), 3.0);
+  lm2_convex_polygon_refresh_f64(&convex);
+  EXPECT_DOUBLE_EQ(convex.bounds.max.x, 3.0);
+  EXPECT_DOUBLE_EQ(convex.bounds.max.y, 3.0);
+  for (size_t i = 0; i < 4; ++i) {
+    EXPECT_NEAR(lm2_v2_length_f64(normals[i]), 1.0, EPSILON_F64);
+  }
+}
@@ -410,3 +410,25 @@ TEST_F(Raycast2Test, GenericCircleDispatchMatchesPrimitive_F64) {
   EXPECT_DOUBLE_EQ(generic.normal.x, direct.normal.x);
   EXPECT_DOUBLE_EQ(generic.normal.y, direct.normal.y);
 }
+
+TEST_F(Raycast2Test, ConvexPolygonMatchesPolygonPath_F32) {
+  lm2_v2_f32 vertices[] = {
+      {2.0f, -1.0f},
+      {4.0f, -1.0f},
+      {4.0f,  1.0f},
+      {2.0f,  1.0f}
+  };
+  lm2_polygon_f32 polygon = lm2_polygon_make_f32(vertices, 4);
+  lm2_v2_f32 normals[4];
+  lm2_convex_polygon_f32 convex = lm2_convex_polygon_make_f32(polygon, normals);
+  lm2_ray2_f32 ray = lm2_ray2_make_f32(lm2_v2_make_f32(0.0f, 0.0f), lm2_v2_make_f32(1.0f, 0.0f), 10.0f);
+
+  lm2_rayhit2_f32 direct = lm2_raycast_polygon_f32(ray, polygon);
+  lm2_rayhit2_f32 prepared = lm2_raycast_convex_polygon_f32(ray, convex);
+  ASSERT_TRUE(prepared.hit);
+  EXPECT_EQ(prepared.hit, direct.hit);
+  EXPECT_NEAR(prepared.t, 2.0f, EPSILON_F32);
+  EXPECT_FLOAT_EQ(prepared.t, direct.t);
+  EXPECT_FLOAT_EQ(prepared.normal.x, -1.0f);
+  EXPECT_FLOAT_EQ(prepared.normal.y, 0.0f);
+}
@@ -0,0 +1,307 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+#include "lm2/geometry2d/lm2_manifold2.h"
+#include "lm2/geometry2d/lm2_raycast2.h"
+#include "lm2/geometry2d/lm2_sat2.h"
+#include "lm2/vectors/lm2_vector_specifics.h"
+
+// Test fixture for Sat2 tests
+class Sat2Test : public ::testing::Test {
+ protected:
+  static constexpr float EPSILON_F32 = 1e-5f;
+  static constexpr double EPSILON_F64 = 1e-10;
+};
+
+// Owns the vertex and normal storage of a prepared convex polygon
+template <typename V, typename C>
+struct ConvexStorage {
+  std::vector<V> vertices;
+  std::vector<V> normals;
+  C convex;
+};
+
+static ConvexStorage<lm2_v2_f64, lm2_convex_polygon_f64> regular_f64(size_t sides, lm2_v2_f64 center, double radius) {
+  ConvexStorage<lm2_v2_f64, lm2_convex_polygon_f64> s;
+  s.vertices.resize(sides);
+  s.normals.resize(sides);
+  lm2_polygon_make_regular_f64(s.vertices.data(), sides, center, radius);
+  s.convex = lm2_convex_polygon_make_f64(lm2_polygon_make_f64(s.vertices.data(), sides), s.normals.data());
+  return s;
+}
+
+static ConvexStorage<lm2_v2_f32, lm2_convex_polygon_f32> rect_f32(lm2_v2_f32 min, lm2_v2_f32 max) {
+  ConvexStorage<lm2_v2_f32, lm2_convex_polygon_f32> s;
+  s.vertices.resize(4);
+  s.normals.resize(4);
+  lm2_polygon_make_rect_f32(s.vertices.data(), min, max);
+  s.convex = lm2_convex_polygon_make_f32(lm2_polygon_make_f32(s.vertices.data(), 4), s.normals.data());
+  return s;
+}
+
+static lm2_ray2_f64 make_ray_f64(lm2_v2_f64 origin, lm2_v2_f64 direction, double t_max) {
+  lm2_ray2_f64 ray;
+  ray.origin = origin;
+  ray.direction = direction;
+  ray.t_max = t_max;
+  return ray;
+}
+
+// Largest separation over every edge normal of both polygons, O(n * m)
+static double brute_force_separation_f64(const lm2_convex_polygon_f64& a, const lm2_convex_polygon_f64& b) {
+  double best = -1e300;
+  for (int pass = 0; pass < 2; ++pass) {
+    const lm2_convex_polygon_f64& p = pass == 0 ? a : b;
+    const lm2_convex_polygon_f64& q = pass == 0 ? b : a;
+    for (size_t i = 0; i < p.vertex_count; ++i) {
+      double min_proj = 1e300;
+      for (size_t j = 0; j < q.vertex_count; ++j) {
+        min_proj = std::min(min_proj, lm2_v2_dot_f64(p.normals[i], lm2_v2_sub_f64(q.vertices[j], p.vertices[i])));
+      }
+      best = std::max(best, min_proj);
+    }
+  }
+  return best;
+}
+
+// =============================================================================
+// Polygon to Polygon
+// =============================================================================
+
+TEST_F(Sat2Test, BoxFaceContactHasTwoClippedPoints_F32) {
+  auto a = rect_f32(lm2_v2_make_f32(0.0f, 0.0f), lm2_v2_make_f32(2.0f, 2.0f));
+  auto b = rect_f32(lm2_v2_make_f32(1.5f, 0.5f), lm2_v2_make_f32(3.0f, 1.5f));
+
+  EXPECT_TRUE(lm2_sat2_collide_polygon_to_polygon_f32(a.convex, b.convex));
+  lm2_manifold_f32 m;
+  lm2_sat2_manifold_polygon_to_polygon_f32(a.convex, b.convex, &m);
+  ASSERT_EQ(m.count, 2);
+  EXPECT_NEAR(m.normal.x, 1.0f, EPSILON_F32);
+  EXPECT_NEAR(m.normal.y, 0.0f, EPSILON_F32);
+  for (int i = 0; i < 2; ++i) {
+    EXPECT_NEAR(m.depths[i], 0.5f, EPSILON_F32);
+    EXPECT_NEAR(m.contact_points[i].x, 1.5f, EPSILON_F32);
+  }
+  EXPECT_NEAR(std::min(m.contact_points[0].y, m.contact_points[1].y), 0.5f, EPSILON_F32);
+  EXPECT_NEAR(std::max(m.contact_points[0].y, m.contact_points[1].y), 1.5f, EPSILON_F32);
+
+  // Swapping the shapes flips the normal
+  lm2_manifold_f32 r;
+  lm2_sat2_manifold_polygon_to_polygon_f32(b.convex, a.convex, &r);
+  ASSERT_EQ(r.count, 2);
+  EXPECT_NEAR(r.normal.x, -1.0f, EPSILON_F32);
+}
+
+TEST_F(Sat2Test, WideBoxClipsIncidentFaceToReference_F32) {
+  auto a = rect_f32(lm2_v2_make_f32(0.0f, 0.0f), lm2_v2_make_f32(1.0f, 1.0f));
+  auto b = rect_f32(lm2_v2_make_f32(-2.0f, 0.9f), lm2_v2_make_f32(3.0f, 2.0f));
+
+  lm2_manifold_f32 m;
+  lm2_sat2_manifold_polygon_to_polygon_f32(a.convex, b.convex, &m);
+  ASSERT_EQ(m.count, 2);
+  EXPECT_NEAR(m.normal.x, 0.0f, EPSILON_F32);
+  EXPECT_NEAR(m.normal.y, 1.0f, EPSILON_F32);
+  EXPECT_NEAR(std::min(m.contact_points[0].x, m.contact_points[1].x), 0.0f, EPSILON_F32);
+  EXPECT_NEAR(std::max(m.contact_points[0].x, m.contact_points[1].x), 1.0f, EPSILON_F32);
+  EXPECT_NEAR(m.depths[0], 0.1f, EPSILON_F32);
+  EXPECT_NEAR(m.depths[1], 0.1f, EPSILON_F32);
+}
+
+TEST_F(Sat2Test, LargePolygonsMatchBruteForceSeparation_F64) {
+  std::mt19937 rng(7);
+  std::uniform_real_distribution<double> offset(-5.0, 5.0);
+  std::uniform_int_distribution<int> sides(9, 64);
+  for (int trial = 0; trial < 200; ++trial) {
+    auto a = regular_f64((size_t)sides(rng), lm2_v2_make_f64(0.0, 0.0), 2.0);
+    auto b = regular_f64((size_t)sides(rng), lm2_v2_make_f64(offset(rng), offset(rng)), 1.5);
+    double separation = brute_force_separation_f64(a.convex, b.convex);
+
+    EXPECT_EQ(lm2_sat2_collide_polygon_to_polygon_f64(a.convex, b.convex), separation <= 0.0);
+
+    lm2_manifold_f64 m;
+    lm2_sat2_manifold_polygon_to_polygon_f64(a.convex, b.convex, &m);
+    if (separation > 0.0) {
+      EXPECT_EQ(m.count, 0);
+      continue;
+    }
+    ASSERT_GT(m.count, 0);
+    EXPECT_NEAR(std::hypot(m.normal.x, m.normal.y), 1.0, 1e-9);
+    double deepest = *std::max_element(m.depths, m.depths + m.count);
+    EXPECT_NEAR(deepest, -separation, LM2_SAT2_TOLERANCE_F64 + 1e-9);
+    lm2_v2_f64 center_b = lm2_polygon_centroid_f64(lm2_convex_polygon_as_polygon_f64(b.convex));
+    EXPECT_GT(lm2_v2_dot_f64(m.normal, center_b), 0.0);
+  }
+}
+
+TEST_F(Sat2Test, SeparatedPolygonsReportNothing_F64) {
+  auto a = regular_f64(40, lm2_v2_make_f64(0.0, 0.0), 1.0);
+  auto b = regular_f64(40, lm2_v2_make_f64(2.5, 0.0), 1.0);
+  EXPECT_FALSE(lm2_sat2_collide_polygon_to_polygon_f64(a.convex, b.convex));
+  lm2_manifold_f64 m;
+  m.count = -1;
+  lm2_sat2_manifold_polygon_to_polygon_f64(a.convex, b.convex, &m);
+  EXPECT_EQ(m.count, 0);
+}
+
+// =============================================================================
+// Circle and Capsule
+// =============================================================================
+
+TEST_F(Sat2Test, CircleFaceAndVertexRegions_F32) {
+  auto box = rect_f32(lm2_v2_make_f32(0.0f, 0.0f), lm2_v2_make_f32(2.0f, 2.0f));
+  lm2_manifold_f32 m;
+
+  // Face region: the circle sits on top of the box
+  lm2_sat2_manifold_circle_to_polygon_f32(lm2_circle_make_coords_f32(1.0f, 2.5f, 1.0f), box.convex, &m);
+  ASSERT_EQ(m.count, 1);
+  EXPECT_NEAR(m.depths[0], 0.5f, EPSILON_F32);
+  EXPECT_NEAR(m.normal.x, 0.0f, EPSILON_F32);
+  EXPECT_NEAR(m.normal.y, -1.0f, EPSILON_F32);
+  EXPECT_NEAR(m.contact_points[0].y, 1.5f, EPSILON_F32);
+
+  // Vertex region: within face reach but outside the corner radius
+  lm2_sat2_manifold_circle_to_polygon_f32(lm2_circle_make_coords_f32(2.8f, 2.8f, 1.0f), box.convex, &m);
+  EXPECT_EQ(m.count, 0);
+
+  lm2_sat2_manifold_circle_to_polygon_f32(lm2_circle_make_coords_f32(2.6f, 2.6f, 1.0f), box.convex, &m);
+  ASSERT_EQ(m.count, 1);
+  EXPECT_NEAR(m.depths[0], 1.0f - std::sqrt(0.72f), EPSILON_F32);
+  EXPECT_NEAR(m.normal.x, -std::sqrt(0.5f), EPSILON_F32);
+  EXPECT_NEAR(m.normal.y, -std::sqrt(0.5f), EPSILON_F32);
+
+  // Center inside the polygon
+  lm2_sat2_manifold_circle_to_polygon_f32(lm2_circle_make_coords_f32(1.8f, 1.0f, 0.5f), box.convex, &m);
+  ASSERT_EQ(m.count, 1);
+  EXPECT_NEAR(m.depths[0], 0.7f, EPSILON_F32);
+  EXPECT_NEAR(m.normal.x, -1.0f, EPSILON_F32);
+}
+
+TEST_F(Sat2Test, CircleAgainstManySidedPolygon_F64) {
+  auto poly = regular_f64(100, lm2_v2_make_f64(0.0, 0.0), 10.0);
+  lm2_manifold_f64 m;
+  lm2_sat2_manifold_circle_to_polygon_f64(lm2_circle_make_coords_f64(0.0, 10.5, 1.0), poly.convex, &m);
+  ASSERT_EQ(m.count, 1);
+  EXPECT_NEAR(m.depths[0], 0.5, 0.01);
+  EXPECT_NEAR(m.normal.y, -1.0, 0.01);
+  lm2_sat2_manifold_circle_to_polygon_f64(lm2_circle_make_coords_f64(0.0, 11.5, 1.0), poly.convex, &m);
+  EXPECT_EQ(m.count, 0);
+}
+
+TEST_F(Sat2Test, CapsuleLyingOnFaceHasTwoContacts_F32) {
+  auto box = rect_f32(lm2_v2_make_f32(0.0f, 0.0f), lm2_v2_make_f32(4.0f, 1.0f));
+  lm2_capsule2_f32 capsule = lm2_capsule2_make_coords_f32(1.0f, 1.25f, 3.0f, 1.25f, 0.5f);
+  lm2_manifold_f32 m;
+  lm2_sat2_manifold_capsule_to_polygon_f32(capsule, box.convex, &m);
+  ASSERT_EQ(m.count, 2);
+  EXPECT_NEAR(m.normal.x, 0.0f, EPSILON_F32);
+  EXPECT_NEAR(m.normal.y, -1.0f, EPSILON_F32);
+  for (int i = 0; i < 2; ++i) {
+    EXPECT_NEAR(m.depths[i], 0.25f, EPSILON_F32);
+    // On the incident surface: the box top or the capsule bottom
+    EXPECT_GE(m.contact_points[i].y, 0.75f - EPSILON_F32);
+    EXPECT_LE(m.contact_points[i].y, 1.0f + EPSILON_F32);
+  }
+}
+
+TEST_F(Sat2Test, CapsuleNearCornerUsesRoundedDistance_F32) {
+  auto box = rect_f32(lm2_v2_make_f32(0.0f, 0.0f), lm2_v2_make_f32(1.0f, 1.0f));
+  lm2_manifold_f32 m;
+
+  // Face separations are below the radius but the corner is out of reach
+  lm2_capsule2_f32 apart = lm2_capsule2_make_coords_f32(1.5f, 1.5f, 3.0f, 3.0f, 0.6f);
+  lm2_sat2_manifold_capsule_to_polygon_f32(apart, box.convex, &m);
+  EXPECT_EQ(m.count, 0);
+
+  lm2_capsule2_f32 touching = lm2_capsule2_make_coords_f32(1.5f, 1.5f, 3.0f, 3.0f, 0.8f);
+  lm2_sat2_manifold_capsule_to_polygon_f32(touching, box.convex, &m);
+  ASSERT_EQ(m.count, 1);
+  EXPECT_NEAR(m.depths[0], 0.8f - std::sqrt(0.5f), EPSILON_F32);
+  EXPECT_NEAR(m.normal.x, -std::sqrt(0.5f), EPSILON_F32);
+  EXPECT_NEAR(m.normal.y, -std::sqrt(0.5f), EPSILON_F32);
+  EXPECT_NEAR(m.contact_points[0].x, m.contact_points[0].y, EPSILON_F32);
+  EXPECT_GE(m.contact_points[0].x, 1.5f - 0.8f * std::sqrt(0.5f) - EPSILON_F32);
+  EXPECT_LE(m.contact_points[0].x, 1.0f + EPSILON_F32);
+}
+
+// =============================================================================
+// Raycasting
+// =============================================================================
+
+TEST_F(Sat2Test, RaycastManySidedPolygon_F64) {
+  auto poly = regular_f64(64, lm2_v2_make_f64(5.0, 0.0), 1.0);
+  lm2_ray2_f64 ray = make_ray_f64(lm2_v2_make_f64(0.0, 0.0), lm2_v2_make_f64(1.0, 0.0), 100.0);
+  lm2_rayhit2_f64 hit = lm2_sat2_raycast_polygon_f64(ray, poly.convex);
+  ASSERT_TRUE(hit.hit);
+  EXPECT_NEAR(hit.t, 4.0, 0.01);
+  EXPECT_NEAR(hit.point.x, hit.t, EPSILON_F64);
+  EXPECT_NEAR(hit.normal.x, -1.0, 0.01);
+
+  lm2_ray2_f64 short_ray = make_ray_f64(lm2_v2_make_f64(0.0, 0.0), lm2_v2_make_f64(1.0, 0.0), 3.0);
+  EXPECT_FALSE(lm2_sat2_raycast_polygon_f64(short_ray, poly.convex).hit);
+
+  lm2_ray2_f64 miss = make_ray_f64(lm2_v2_make_f64(0.0, 2.0), lm2_v2_make_f64(1.0, 0.0), 100.0);
+  EXPECT_FALSE(lm2_sat2_raycast_polygon_f64(miss, poly.convex).hit);
+
+  lm2_ray2_f64 inside = make_ray_f64(lm2_v2_make_f64(5.0, 0.0), lm2_v2_make_f64(1.0, 0.0), 100.0);
+  EXPECT_FALSE(lm2_sat2_raycast_polygon_f64(inside, poly.convex).hit);
+}
+
+// =============================================================================
+// Plain Polygon Wrappers
+// =============================================================================
+
+TEST_F(Sat2Test, PlainPolygonWrappersAcceptManySidedPolygons_F64) {
+  // The plain lm2_polygon overloads take any vertex count and match the prepared path
+  auto a = regular_f64(16, lm2_v2_make_f64(0.0, 0.0), 2.0);
+  auto b = regular_f64(24, lm2_v2_make_f64(3.5, 0.0), 2.0);
+  lm2_polygon_f64 plain_a = lm2_polygon_make_f64(a.vertices.data(), a.vertices.size());
+  lm2_polygon_f64 plain_b = lm2_polygon_make_f64(b.vertices.data(), b.vertices.size());
+
+  lm2_manifold_f64 expected;
+  lm2_manifold_f64 m;
+  lm2_manifold_convex_polygon_to_convex_polygon_f64(a.convex, b.convex, &expected);
+  lm2_manifold_polygon_to_polygon_f64(plain_a, plain_b, &m);
+  ASSERT_EQ(m.count, expected.count);
+  ASSERT_GT(m.count, 0);
+  EXPECT_NEAR(m.depths[0], expected.depths[0], EPSILON_F64);
+  EXPECT_NEAR(m.normal.x, expected.normal.x, EPSILON_F64);
+  EXPECT_TRUE(lm2_collide_polygon_to_polygon_f64(plain_a, plain_b));
+
+  lm2_circle_f64 circle = lm2_circle_make_coords_f64(0.0, 2.5, 1.0);
+  EXPECT_TRUE(lm2_collide_circle_to_polygon_f64(circle, plain_a));
+  lm2_manifold_circle_to_polygon_f64(circle, plain_a, &m);
+  lm2_manifold_circle_to_convex_polygon_f64(circle, a.convex, &expected);
+  ASSERT_EQ(m.count, 1);
+  EXPECT_NEAR(m.depths[0], expected.depths[0], EPSILON_F64);
+
+  lm2_ray2_f64 ray = make_ray_f64(lm2_v2_make_f64(-10.0, 0.0), lm2_v2_make_f64(1.0, 0.0), 100.0);
+  lm2_rayhit2_f64 hit = lm2_raycast_polygon_f64(ray, plain_a);
+  ASSERT_TRUE(hit.hit);
+  EXPECT_NEAR(hit.t, lm2_raycast_convex_polygon_f64(ray, a.convex).t, EPSILON_F64);
+}
@@ -344,3 +344,58 @@ TEST_F(Shape2Test, GetType_AllTypes_F32) {
   lm2_shape2_f32 shape_capsule = lm2_shape2_from_capsule_f32(&capsule);
   EXPECT_EQ(lm2_shape2_get_type_f32(&shape_capsule), LM2_SHAPE2_CAPSULE);
 }
+
+// =============================================================================
+// Bounds Tests
+// =============================================================================
+
+TEST_F(Shape2Test, Bounds_AllTypes_F32) {
+  lm2_circle_f32 circle = lm2_circle_make_coords_f32(5.0f, 5.0f, 3.0f);
+  lm2_r2_f32 b = lm2_shape2_bounds_f32(lm2_shape2_from_circle_f32(&circle));
+  EXPECT_NEAR(b.min.x, 2.0f, EPSILON_F32);
+  EXPECT_NEAR(b.min.y, 2.0f, EPSILON_F32);
+  EXPECT_NEAR(b.max.x, 8.0f, EPSILON_F32);
+  EXPECT_NEAR(b.max.y, 8.0f, EPSILON_F32);
+
+  lm2_capsule2_f32 capsule = lm2_capsule2_make_coords_f32(0.0f, 0.0f, 10.0f, -4.0f, 2.0f);
+  b = lm2_shape2_bounds_f32(lm2_shape2_from_capsule_f32(&capsule));
+  EXPECT_NEAR(b.min.x, -2.0f, EPSILON_F32);
+  EXPECT_NEAR(b.min.y, -6.0f, EPSILON_F32);
+  EXPECT_NEAR(b.max.x, 12.0f, EPSILON_F32);
+  EXPECT_NEAR(b.max.y, 2.0f, EPSILON_F32);
+
+  lm2_aabb2_f32 aabb = lm2_r2_from_scalars_f32(1.0f, 2.0f, 3.0f, 4.0f);
+  b = lm2_shape2_bounds_f32(lm2_shape2_from_aabb2_f32(&aabb));
+  EXPECT_EQ(b.min.x, 1.0f);
+  EXPECT_EQ(b.max.y, 4.0f);
+
+  lm2_triangle2_f32 tri = {{0.0f, 0.0f}, {4.0f, 1.0f}, {-1.0f, 3.0f}};
+  b = lm2_shape2_bounds_f32(lm2_shape2_from_triangle_f32(&tri));
+  EXPECT_EQ(b.min.x, -1.0f);
+  EXPECT_EQ(b.min.y, 0.0f);
+  EXPECT_EQ(b.max.x, 4.0f);
+  EXPECT_EQ(b.max.y, 3.0f);
+
+  lm2_v2_f32 vertices[4] = {{0.0f, 0.0f}, {2.0f, -1.0f}, {3.0f, 2.0f}, {1.0f, 5.0f}};
+  lm2_polygon_f32 polygon = {vertices, 4};
+  b = lm2_shape2_bounds_f32(lm2_shape2_from_polygon_f32(&polygon));
+  EXPECT_EQ(b.min.y, -1.0f);
+  EXPECT_EQ(b.max.x, 3.0f);
+  EXPECT_EQ(b.max.y, 5.0f);
+
+  lm2_edge2_f32 edge = lm2_edge2_make_coords_f32(10.0f, 0.0f, 0.0f, 10.0f);
+  b = lm2_shape2_bounds_f32(lm2_shape2_from_edge_f32(&edge));
+  EXPECT_EQ(b.min.x, 0.0f);
+  EXPECT_EQ(b.min.y, 0.0f);
+  EXPECT_EQ(b.max.x, 10.0f);
+  EXPECT_EQ(b.max.y, 10.0f);
+}
+
+TEST_F(Shape2Test, Bounds_Circle_F64) {
+  lm2_circle_f64 circle = lm2_circle_make_coords_f64(-1.0, 2.0, 0.5);
+  lm2_r2_f64 b = lm2_shape2_bounds_f64(lm2_shape2_from_circle_f64(&circle));
+  EXPECT_NEAR(b.min.x, -1.5, EPSILON_F64);
+  EXPECT_NEAR(b.min.y, 1.5, EPSILON_F64);
+  EXPECT_NEAR(b.max.x, -0.5, EPSILON_F64);
+  EXPECT_NEAR(b.max.y, 2.5, EPSILON_F64);
+}
@@ -0,0 +1,204 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+#include <vector>
+#include "lm2/geometry2d/lm2_toi2.h"
+
+// Test fixture for Toi2 tests
+class Toi2Test : public ::testing::Test {
+ protected:
+  static constexpr float EPSILON_F32 = 1e-5f;
+  static constexpr double EPSILON_F64 = 1e-10;
+};
+
+// =============================================================================
+// Single Queries
+// =============================================================================
+
+TEST_F(Toi2Test, CircleHitsEdgeWall_F32) {
+  lm2_circle_f32 circle = lm2_circle_make_f32({0.0f, 0.0f}, 0.5f);
+  lm2_edge2_f32 wall = {{5.0f, -1.0f}, {5.0f, 1.0f}};
+  lm2_toi2_result_f32 r = lm2_toi2_shape_to_shape_f32(lm2_shape2_from_circle_f32(&circle), {10.0f, 0.0f},
+                                                      lm2_shape2_from_edge_f32(&wall), {0.0f, 0.0f});
+  ASSERT_TRUE(r.hit);
+  EXPECT_NEAR(r.toi, 0.45f, 1e-3f);
+  EXPECT_LE(r.toi, 0.45f);
+  EXPECT_NEAR(r.normal.x, 1.0f, EPSILON_F32);
+  EXPECT_NEAR(r.normal.y, 0.0f, EPSILON_F32);
+  EXPECT_NEAR(r.point.x, 5.0f, 1e-2f);
+  EXPECT_NEAR(r.point.y, 0.0f, 1e-3f);
+}
+
+TEST_F(Toi2Test, FastCircleDoesNotTunnelThinBox_F64) {
+  // Discrete tests at the start and end of the step both miss the box
+  lm2_circle_f64 bullet = lm2_circle_make_f64({0.0, 0.0}, 0.1);
+  lm2_aabb2_f64 wall = lm2_r2_from_min_max_f64({5.0, -1.0}, {5.01, 1.0});
+  lm2_toi2_result_f64 r = lm2_toi2_shape_to_shape_f64(lm2_shape2_from_circle_f64(&bullet), {100.0, 0.0},
+                                                      lm2_shape2_from_aabb2_f64(&wall), {0.0, 0.0});
+  ASSERT_TRUE(r.hit);
+  EXPECT_NEAR(r.toi, 0.049, 1e-8);
+  EXPECT_NEAR(r.normal.x, 1.0, EPSILON_F64);
+  EXPECT_LE(r.iterations, 3);
+}
+
+TEST_F(Toi2Test, RoundedShapesMatchClosedForm_F64) {
+  // |(5 - 4t, 1)| = 2 at t = (5 - sqrt(3)) / 4
+  lm2_circle_f64 a = lm2_circle_make_f64({0.0, 0.0}, 1.0);
+  lm2_circle_f64 b = lm2_circle_make_f64({5.0, 1.0}, 1.0);
+  lm2_toi2_result_f64 r = lm2_toi2_shape_to_shape_f64(lm2_shape2_from_circle_f64(&a), {4.0, 0.0},
+                                                      lm2_shape2_from_circle_f64(&b), {0.0, 0.0});
+  ASSERT_TRUE(r.hit);
+  EXPECT_NEAR(r.toi, (5.0 - std::sqrt(3.0)) / 4.0, 1e-8);
+  EXPECT_NEAR(r.normal.x, std::sqrt(3.0) / 2.0, 1e-6);
+  EXPECT_NEAR(r.normal.y, 0.5, 1e-6);
+  double tx = 4.0 * r.toi;
+  EXPECT_NEAR(r.point.x, tx + r.normal.x, 1e-6);
+  EXPECT_NEAR(r.point.y, r.normal.y, 1e-6);
+}
+
+TEST_F(Toi2Test, BothShapesMoving_F32) {
+  // Capsule moves right and the box moves left: the gap of 4 closes at 8 per step
+  lm2_capsule2_f32 capsule = lm2_capsule2_make_f32({0.0f, -1.0f}, {0.0f, 1.0f}, 0.5f);
+  lm2_aabb2_f32 box = lm2_r2_from_min_max_f32({4.5f, -0.5f}, {5.5f, 0.5f});
+  lm2_toi2_result_f32 r = lm2_toi2_shape_to_shape_f32(lm2_shape2_from_capsule_f32(&capsule), {3.0f, 0.0f},
+                                                      lm2_shape2_from_aabb2_f32(&box), {-5.0f, 0.0f});
+  ASSERT_TRUE(r.hit);
+  EXPECT_NEAR(r.toi, 0.5f, 1e-3f);
+  EXPECT_NEAR(r.normal.x, 1.0f, EPSILON_F32);
+  EXPECT_NEAR(r.point.x, 2.0f, 1e-2f);
+}
+
+TEST_F(Toi2Test, LargePolygonAgainstTriangle_F64) {
+  std::vector<lm2_v2_f64> verts(32);
+  for (size_t i = 0; i < verts.size(); ++i) {
+    double angle = 2.0 * M_PI * (double)i / (double)verts.size();
+    verts[i] = {2.0 * std::cos(angle), 2.0 * std::sin(angle)};
+  }
+  lm2_polygon_f64 disc = {verts.data(), verts.size()};
+  lm2_triangle2_f64 tri;
+  lm2_triangle2_make_coords_f64(tri, 6.0, -1.0, 8.0, -1.0, 6.0, 1.0);
+  lm2_toi2_result_f64 r = lm2_toi2_shape_to_shape_f64(lm2_shape2_from_polygon_f64(&disc), {0.0, 0.0},
+                                                      lm2_shape2_from_triangle_f64(&tri), {-8.0, 0.0});
+  ASSERT_TRUE(r.hit);
+  // The vertex at angle 0 reaches x = 2, so the triangle edge x = 6 travels 4 of 8
+  EXPECT_NEAR(r.toi, 0.5, 1e-8);
+  EXPECT_NEAR(r.normal.x, 1.0, 1e-6);
+}
+
+TEST_F(Toi2Test, MissesWhenPassingByOrSeparating_F32) {
+  lm2_circle_f32 a = lm2_circle_make_f32({0.0f, 0.0f}, 0.5f);
+  lm2_circle_f32 b = lm2_circle_make_f32({5.0f, 2.0f}, 0.5f);
+  lm2_shape2_f32 sa = lm2_shape2_from_circle_f32(&a);
+  lm2_shape2_f32 sb = lm2_shape2_from_circle_f32(&b);
+
+  lm2_toi2_result_f32 pass = lm2_toi2_shape_to_shape_f32(sa, {10.0f, 0.0f}, sb, {0.0f, 0.0f});
+  EXPECT_FALSE(pass.hit);
+  EXPECT_EQ(pass.toi, 1.0f);
+
+  lm2_toi2_result_f32 apart = lm2_toi2_shape_to_shape_f32(sa, {-1.0f, 0.0f}, sb, {1.0f, 0.0f});
+  EXPECT_FALSE(apart.hit);
+  EXPECT_EQ(apart.iterations, 1);
+
+  lm2_toi2_result_f32 short_step = lm2_toi2_shape_to_shape_f32(sa, {2.0f, 1.0f}, sb, {0.0f, 0.0f});
+  EXPECT_FALSE(short_step.hit);
+}
+
+TEST_F(Toi2Test, InitialOverlapHitsAtZero_F32) {
+  lm2_aabb2_f32 a = lm2_r2_from_min_max_f32({0.0f, 0.0f}, {2.0f, 2.0f});
+  lm2_aabb2_f32 b = lm2_r2_from_min_max_f32({1.0f, 1.0f}, {3.0f, 3.0f});
+  lm2_toi2_result_f32 r = lm2_toi2_shape_to_shape_f32(lm2_shape2_from_aabb2_f32(&a), {1.0f, 0.0f},
+                                                      lm2_shape2_from_aabb2_f32(&b), {0.0f, 0.0f});
+  EXPECT_TRUE(r.hit);
+  EXPECT_EQ(r.toi, 0.0f);
+  EXPECT_EQ(r.normal.x, 0.0f);
+  EXPECT_EQ(r.normal.y, 0.0f);
+}
+
+// =============================================================================
+// Batched Queries
+// =============================================================================
+
+TEST_F(Toi2Test, BatchMatchesSingleQueries_F32) {
+  std::mt19937 rng(7);
+  std::uniform_real_distribution<float> pos(-20.0f, 20.0f);
+  std::uniform_real_distribution<float> vel(-15.0f, 15.0f);
+  const size_t shape_count = 300;
+  std::vector<lm2_circle_f32> circles;
+  std::vector<lm2_aabb2_f32> boxes;
+  std::vector<lm2_edge2_f32> edges;
+  circles.reserve(shape_count);
+  boxes.reserve(shape_count);
+  edges.reserve(shape_count);
+  std::vector<lm2_shape2_f32> shapes;
+  std::vector<lm2_v2_f32> velocities;
+  for (size_t i = 0; i < shape_count; ++i) {
+    lm2_v2_f32 c = {pos(rng), pos(rng)};
+    if (i % 3 == 0) {
+      circles.push_back(lm2_circle_make_f32(c, 0.5f));
+      shapes.push_back(lm2_shape2_from_circle_f32(&circles.back()));
+      velocities.push_back({vel(rng), vel(rng)});
+    } else if (i % 3 == 1) {
+      boxes.push_back(lm2_r2_from_min_max_f32({c.x - 1.0f, c.y - 1.0f}, {c.x + 1.0f, c.y + 1.0f}));
+      shapes.push_back(lm2_shape2_from_aabb2_f32(&boxes.back()));
+      velocities.push_back({vel(rng), vel(rng)});
+    } else {
+      edges.push_back({{c.x, c.y - 3.0f}, {c.x, c.y + 3.0f}});
+      shapes.push_back(lm2_shape2_from_edge_f32(&edges.back()));
+      velocities.push_back({0.0f, 0.0f});
+    }
+  }
+  std::vector<lm2_narrowphase2_pair> pairs;
+  for (uint32_t a = 0; a < shape_count; ++a) {
+    for (uint32_t b = a + 1; b < shape_count && b < a + 40; ++b) {
+      pairs.push_back({a, b});
+    }
+  }
+
+  size_t expected_hits = 0;
+  std::vector<lm2_toi2_result_f32> expected(pairs.size());
+  for (size_t i = 0; i < pairs.size(); ++i) {
+    expected[i] = lm2_toi2_shape_to_shape_f32(shapes[pairs[i].a], velocities[pairs[i].a], shapes[pairs[i].b], velocities[pairs[i].b]);
+    expected_hits += expected[i].hit;
+  }
+  EXPECT_GT(expected_hits, 0u);
+
+  for (uint32_t threads : {1u, 4u, 0u}) {
+    std::vector<lm2_toi2_result_f32> results(pairs.size());
+    size_t hits = lm2_toi2_collide_f32(shapes.data(), velocities.data(), pairs.data(), pairs.size(), results.data(), threads);
+    EXPECT_EQ(hits, expected_hits);
+    for (size_t i = 0; i < pairs.size(); ++i) {
+      ASSERT_EQ(results[i].hit, expected[i].hit) << "pair " << i;
+      ASSERT_EQ(results[i].toi, expected[i].toi) << "pair " << i;
+      ASSERT_EQ(results[i].normal.x, expected[i].normal.x) << "pair " << i;
+      ASSERT_EQ(results[i].normal.y, expected[i].normal.y) << "pair " << i;
+    }
+  }
+}
+
+TEST_F(Toi2Test, EmptyPairList_F64) {
+  EXPECT_EQ(lm2_toi2_collide_f64(nullptr, nullptr, nullptr, 0, nullptr, 0), 0u);
+}
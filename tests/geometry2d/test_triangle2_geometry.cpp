@@ -297,3 +297,69 @@ TEST_F(Triangle2GeometryTest, IndexedMeshToTriangleList_F32) {
   EXPECT_EQ(triangle_count, 2);
   EXPECT_FLOAT_EQ(triangles[0][0].x, 0.0f);
 }
+
+// =============================================================================
+// Vertex Welding
+// =============================================================================
+
+TEST_F(Triangle2GeometryTest, IndexedMeshWeldsWithinEpsilon_F64) {
+  // The second triangle's shared corners are off by less than epsilon
+  lm2_triangle2_f64 triangles[2] = {
+      {{0.0, 0.0}, {1.0, 0.0}, {0.0, 1.0}},
+      {{1.0005, 0.0}, {1.0, 1.0}, {-0.0005, 1.0005}}
+  };
+
+  lm2_indexed_mesh_size size = lm2_triangle2_list_to_indexed_mesh_size_f64(triangles, 2, 0.001);
+  ASSERT_EQ(size.vertex_count, 4);
+
+  std::vector<lm2_v2_f64> vertices(size.vertex_count);
+  std::vector<uint32_t> indices(size.index_count);
+  lm2_triangle2_list_to_indexed_mesh_f64(triangles, 2, 0.001, vertices.data(), vertices.size(), indices.data(), indices.size());
+
+  std::vector<uint32_t> expected = {0, 1, 2, 1, 3, 2};
+  EXPECT_EQ(indices, expected);
+  EXPECT_DOUBLE_EQ(vertices[1].x, 1.0);  // First occurrence is kept
+}
+
+TEST_F(Triangle2GeometryTest, IndexedMeshParallelMatchesSerial_F32) {
+  // 96 x 96 quads, every corner shared by up to six triangles
+  const size_t n = 96;
+  std::vector<lm2_triangle2_f32> triangles(n * n * 2);
+  for (size_t y = 0; y < n; y++) {
+    for (size_t x = 0; x < n; x++) {
+      lm2_v2_f32 a = lm2_v2_make_f32((float)x, (float)y);
+      lm2_v2_f32 b = lm2_v2_make_f32((float)(x + 1), (float)y);
+      lm2_v2_f32 c = lm2_v2_make_f32((float)(x + 1), (float)(y + 1));
+      lm2_v2_f32 d = lm2_v2_make_f32((float)x, (float)(y + 1));
+      lm2_triangle2_f32* t = &triangles[(y * n + x) * 2];
+      t[0][0] = a, t[0][1] = b, t[0][2] = c;
+      t[1][0] = a, t[1][1] = c, t[1][2] = d;
+    }
+  }
+
+  lm2_indexed_mesh_size size = lm2_triangle2_list_to_indexed_mesh_size_parallel_f32(triangles.data(), triangles.size(), 0.0f, 3);
+  ASSERT_EQ(size.vertex_count, (n + 1) * (n + 1));
+
+  std::vector<lm2_v2_f32> vertices(size.vertex_count);
+  std::vector<uint32_t> indices(size.index_count);
+  lm2_triangle2_list_to_indexed_mesh_f32(
+      triangles.data(), triangles.size(), 0.0f, vertices.data(), vertices.size(), indices.data(), indices.size());
+
+  std::vector<lm2_v2_f32> parallel_vertices(size.vertex_count);
+  std::vector<uint32_t> parallel_indices(size.index_count);
+  lm2_triangle2_list_to_indexed_mesh_parallel_f32(
+      triangles.data(),
+      triangles.size(),
+      0.0f,
+      parallel_vertices.data(),
+      parallel_vertices.size(),
+      parallel_indices.data(),
+      parallel_indices.size(),
+      3);
+
+  EXPECT_EQ(parallel_indices, indices);
+  for (size_t k = 0; k < vertices.size(); k++) {
+    EXPECT_EQ(parallel_vertices[k].x, vertices[k].x);
+    EXPECT_EQ(parallel_vertices[k].y, vertices[k].y);
+  }
+}
@@ -0,0 +1,542 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+#include <vector>
+#include "lm2/geometry3d/lm2_bvh3.h"
+#include "lm2/geometry3d/lm2_raycast3.h"
+#include "lm2/geometry3d/lm2_triangle3_geometry.h"
+#include "lm2/vectors/lm2_vector_specifics.h"
+
+// Test fixture for BVH3 tests
+class Bvh3Test : public ::testing::Test {
+ protected:
+  static constexpr float EPSILON_F32 = 1e-5f;
+  static constexpr double EPSILON_F64 = 1e-10;
+};
+
+// Random soup of small triangles inside [-10, 10]^3
+static std::vector<lm2_v3_f32> random_soup_vertices_f32(size_t triangle_count, uint32_t seed) {
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<float> pos(-10.0f, 10.0f);
+  std::uniform_real_distribution<float> off(-1.0f, 1.0f);
+  std::vector<lm2_v3_f32> vertices(triangle_count * 3);
+  for (size_t i = 0; i < triangle_count; i++) {
+    lm2_v3_f32 c = lm2_v3_make_f32(pos(rng), pos(rng), pos(rng));
+    for (int k = 0; k < 3; k++) {
+      vertices[i * 3 + k] = lm2_v3_make_f32(c.x + off(rng), c.y + off(rng), c.z + off(rng));
+    }
+  }
+  return vertices;
+}
+
+static std::vector<lm2_ray3_f32> random_rays_f32(size_t count, uint32_t seed) {
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<float> dir(-1.0f, 1.0f);
+  std::uniform_real_distribution<float> target(-8.0f, 8.0f);
+  std::vector<lm2_ray3_f32> rays(count);
+  for (auto& ray : rays) {
+    lm2_v3_f32 from = lm2_v3_mul_s_f32(lm2_v3_norm_f32(lm2_v3_make_f32(dir(rng), dir(rng), dir(rng))), 30.0f);
+    ray = lm2_ray3_from_points_f32(from, lm2_v3_make_f32(target(rng), target(rng), target(rng)));
+    ray.t_max = 60.0f;
+  }
+  return rays;
+}
+
+// Brute-force closest hit over every triangle
+static lm2_rayhit3_f32 brute_force_raycast_f32(const lm2_bvh3_f32* bvh, lm2_ray3_f32 ray) {
+  lm2_rayhit3_f32 best = {};
+  for (uint32_t i = 0; i < bvh->triangle_count; i++) {
+    lm2_triangle3_f32 tri;
+    lm2_bvh3_get_triangle_f32(bvh, i, tri);
+    lm2_rayhit3_f32 hit = lm2_raycast_triangle_f32(ray, tri[0], tri[1], tri[2]);
+    if (hit.hit && (!best.hit || hit.t < best.t)) {
+      best = hit;
+    }
+  }
+  return best;
+}
+
+// Check that every node encloses its children or triangles and that every
+// triangle appears in exactly one leaf
+static void check_bvh_invariants_f32(const lm2_bvh3_f32* bvh) {
+  std::vector<int> seen(bvh->triangle_count, 0);
+  for (uint32_t n = 0; n < bvh->node_count; n++) {
+    const lm2_bvh3_node_f32& node = bvh->nodes[n];
+    if (node.count > 0) {
+      for (uint32_t i = node.first; i < node.first + node.count; i++) {
+        uint32_t tri_index = bvh->primitive_indices[i];
+        ASSERT_LT(tri_index, bvh->triangle_count);
+        seen[tri_index]++;
+        lm2_triangle3_f32 tri;
+        lm2_bvh3_get_triangle_f32(bvh, tri_index, tri);
+        for (int k = 0; k < 3; k++) {
+          for (int axis = 0; axis < 3; axis++) {
+            EXPECT_LE(node.bounds.min.e[axis], tri[k].e[axis]);
+            EXPECT_GE(node.bounds.max.e[axis], tri[k].e[axis]);
+          }
+        }
+      }
+    } else {
+      ASSERT_LT(node.first + 1, bvh->node_count);
+      for (uint32_t c = node.first; c <= node.first + 1; c++) {
+        for (int axis = 0; axis < 3; axis++) {
+          EXPECT_LE(node.bounds.min.e[axis], bvh->nodes[c].bounds.min.e[axis]);
+          EXPECT_GE(node.bounds.max.e[axis], bvh->nodes[c].bounds.max.e[axis]);
+        }
+      }
+    }
+  }
+  for (uint32_t i = 0; i < bvh->triangle_count; i++) {
+    EXPECT_EQ(seen[i], 1);
+  }
+}
+
+// =============================================================================
+// Buffer Size Tests
+// =============================================================================
+
+TEST_F(Bvh3Test, BufferSizes) {
+  EXPECT_EQ(lm2_bvh3_node_buffer_size_f32(0), 0u);
+  EXPECT_EQ(lm2_bvh3_node_buffer_size_f32(1), 1u);
+  EXPECT_EQ(lm2_bvh3_node_buffer_size_f32(1000), 1999u);
+  EXPECT_EQ(lm2_bvh3_index_buffer_size_f32(1000), 1000u);
+  EXPECT_EQ(lm2_bvh3_node_buffer_size_f64(1000), 1999u);
+  EXPECT_EQ(lm2_bvh3_index_buffer_size_f64(1000), 1000u);
+}
+
+// =============================================================================
+// Build Tests
+// =============================================================================
+
+TEST_F(Bvh3Test, EmptyMesh_F32) {
+  lm2_bvh3_f32 bvh = lm2_bvh3_build_f32(NULL, 0, NULL, 0, NULL, 0);
+  EXPECT_EQ(bvh.node_count, 0u);
+
+  lm2_ray3_f32 ray = lm2_ray3_make_f32(lm2_v3_make_f32(0.0f, 0.0f, -5.0f), lm2_v3_make_f32(0.0f, 0.0f, 1.0f), 10.0f);
+  EXPECT_FALSE(lm2_bvh3_raycast_f32(&bvh, ray).rayhit.hit);
+  EXPECT_FALSE(lm2_bvh3_raycast_any_f32(&bvh, ray).rayhit.hit);
+}
+
+TEST_F(Bvh3Test, SingleTriangleMatchesRaycastTriangle_F32) {
+  lm2_triangle3_f32 tris[1];
+  lm2_triangle3_make_coords_f32(tris[0], -1.0f, -1.0f, 0.0f, 1.0f, -1.0f, 0.0f, 0.0f, 1.0f, 0.0f);
+  lm2_bvh3_node_f32 nodes[1];
+  uint32_t indices[1];
+  lm2_bvh3_f32 bvh = lm2_bvh3_build_f32(tris, 1, nodes, 1, indices, 1);
+  EXPECT_EQ(bvh.node_count, 1u);
+
+  lm2_ray3_f32 ray = lm2_ray3_make_f32(lm2_v3_make_f32(0.2f, 0.1f, -5.0f), lm2_v3_make_f32(0.0f, 0.0f, 1.0f), 10.0f);
+  lm2_bvh3_hit_f32 hit = lm2_bvh3_raycast_f32(&bvh, ray);
+  lm2_rayhit3_f32 expected = lm2_raycast_triangle_f32(ray, tris[0][0], tris[0][1], tris[0][2]);
+  ASSERT_TRUE(hit.rayhit.hit);
+  EXPECT_EQ(hit.triangle_index, 0u);
+  EXPECT_NEAR(hit.rayhit.t, expected.t, EPSILON_F32);
+  EXPECT_NEAR(hit.rayhit.point.x, expected.point.x, EPSILON_F32);
+  EXPECT_NEAR(hit.rayhit.point.y, expected.point.y, EPSILON_F32);
+  EXPECT_NEAR(hit.rayhit.point.z, expected.point.z, EPSILON_F32);
+  EXPECT_NEAR(hit.rayhit.normal.z, expected.normal.z, EPSILON_F32);
+
+  // Stops short of the triangle
+  ray.t_max = 4.0f;
+  EXPECT_FALSE(lm2_bvh3_raycast_f32(&bvh, ray).rayhit.hit);
+  EXPECT_FALSE(lm2_bvh3_raycast_any_f32(&bvh, ray).rayhit.hit);
+}
+
+TEST_F(Bvh3Test, RandomSoupInvariants_F32) {
+  const size_t count = 3000;
+  std::vector<lm2_v3_f32> vertices = random_soup_vertices_f32(count, 1);
+  std::vector<lm2_triangle3_f32> tris(count);
+  lm2_vertex_array_to_triangle3_list_f32(vertices.data(), vertices.size(), tris.data(), tris.size());
+
+  std::vector<lm2_bvh3_node_f32> nodes(lm2_bvh3_node_buffer_size_f32(count));
+  std::vector<uint32_t> indices(lm2_bvh3_index_buffer_size_f32(count));
+  lm2_bvh3_f32 bvh = lm2_bvh3_build_f32(tris.data(), count, nodes.data(), nodes.size(), indices.data(), indices.size());
+
+  EXPECT_GT(bvh.node_count, 1u);
+  EXPECT_LE(bvh.node_count, nodes.size());
+  check_bvh_invariants_f32(&bvh);
+}
+
+TEST_F(Bvh3Test, CoincidentTriangles_F32) {
+  // Identical centroids cannot be binned, the builder must still terminate
+  const size_t count = 100;
+  std::vector<lm2_triangle3_f32> tris(count);
+  for (auto& tri : tris) {
+    lm2_triangle3_make_coords_f32(tri, -1.0f, -1.0f, 0.0f, 1.0f, -1.0f, 0.0f, 0.0f, 1.0f, 0.0f);
+  }
+  std::vector<lm2_bvh3_node_f32> nodes(lm2_bvh3_node_buffer_size_f32(count));
+  std::vector<uint32_t> indices(count);
+  lm2_bvh3_f32 bvh = lm2_bvh3_build_f32(tris.data(), count, nodes.data(), nodes.size(), indices.data(), indices.size());
+  check_bvh_invariants_f32(&bvh);
+
+  lm2_ray3_f32 ray = lm2_ray3_make_f32(lm2_v3_make_f32(0.0f, 0.0f, 5.0f), lm2_v3_make_f32(0.0f, 0.0f, -1.0f), 10.0f);
+  lm2_bvh3_hit_f32 hit = lm2_bvh3_raycast_f32(&bvh, ray);
+  ASSERT_TRUE(hit.rayhit.hit);
+  EXPECT_NEAR(hit.rayhit.t, 5.0f, EPSILON_F32);
+}
+
+TEST_F(Bvh3Test, SmallBufferAsserts_F32) {
+  lm2_triangle3_f32 tris[2];
+  lm2_triangle3_make_coords_f32(tris[0], 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f);
+  lm2_triangle3_make_coords_f32(tris[1], 5.0f, 0.0f, 0.0f, 6.0f, 0.0f, 0.0f, 5.0f, 1.0f, 0.0f);
+  lm2_bvh3_node_f32 nodes[3];
+  uint32_t indices[2];
+  EXPECT_DEATH(lm2_bvh3_build_f32(tris, 2, nodes, 2, indices, 2), "");
+}
+
+// =============================================================================
+// Query Tests
+// =============================================================================
+
+TEST_F(Bvh3Test, RaycastMatchesBruteForce_F32) {
+  const size_t count = 2000;
+  std::vector<lm2_v3_f32> vertices = random_soup_vertices_f32(count, 2);
+  std::vector<lm2_triangle3_f32> tris(count);
+  lm2_vertex_array_to_triangle3_list_f32(vertices.data(), vertices.size(), tris.data(), tris.size());
+
+  std::vector<lm2_bvh3_node_f32> nodes(lm2_bvh3_node_buffer_size_f32(count));
+  std::vector<uint32_t> indices(count);
+  lm2_bvh3_f32 bvh = lm2_bvh3_build_f32(tris.data(), count, nodes.data(), nodes.size(), indices.data(), indices.size());
+
+  int hits = 0;
+  for (const lm2_ray3_f32& ray : random_rays_f32(500, 3)) {
+    lm2_rayhit3_f32 expected = brute_force_raycast_f32(&bvh, ray);
+    lm2_bvh3_hit_f32 hit = lm2_bvh3_raycast_f32(&bvh, ray);
+    ASSERT_EQ(hit.rayhit.hit, expected.hit);
+    EXPECT_EQ(lm2_bvh3_raycast_any_f32(&bvh, ray).rayhit.hit, expected.hit);
+    if (expected.hit) {
+      hits++;
+      EXPECT_NEAR(hit.rayhit.t, expected.t, EPSILON_F32 * 10.0f);
+      lm2_triangle3_f32 tri;
+      lm2_bvh3_get_triangle_f32(&bvh, hit.triangle_index, tri);
+      lm2_rayhit3_f32 own = lm2_raycast_triangle_f32(ray, tri[0], tri[1], tri[2]);
+      EXPECT_TRUE(own.hit);
+      EXPECT_NEAR(own.t, hit.rayhit.t, EPSILON_F32 * 10.0f);
+      EXPECT_NEAR(hit.rayhit.normal.x, own.normal.x, EPSILON_F32);
+      EXPECT_NEAR(hit.rayhit.normal.y, own.normal.y, EPSILON_F32);
+      EXPECT_NEAR(hit.rayhit.normal.z, own.normal.z, EPSILON_F32);
+    }
+  }
+  EXPECT_GT(hits, 50);
+}
+
+TEST_F(Bvh3Test, AnyHitReturnsValidHit_F32) {
+  const size_t count = 1000;
+  std::vector<lm2_v3_f32> vertices = random_soup_vertices_f32(count, 4);
+  std::vector<lm2_triangle3_f32> tris(count);
+  lm2_vertex_array_to_triangle3_list_f32(vertices.data(), vertices.size(), tris.data(), tris.size());
+
+  std::vector<lm2_bvh3_node_f32> nodes(lm2_bvh3_node_buffer_size_f32(count));
+  std::vector<uint32_t> indices(count);
+  lm2_bvh3_f32 bvh = lm2_bvh3_build_f32(tris.data(), count, nodes.data(), nodes.size(), indices.data(), indices.size());
+
+  for (const lm2_ray3_f32& ray : random_rays_f32(200, 5)) {
+    lm2_bvh3_hit_f32 hit = lm2_bvh3_raycast_any_f32(&bvh, ray);
+    if (hit.rayhit.hit) {
+      lm2_rayhit3_f32 own = lm2_raycast_triangle_f32(ray, tris[hit.triangle_index][0], tris[hit.triangle_index][1], tris[hit.triangle_index][2]);
+      EXPECT_TRUE(own.hit);
+      EXPECT_NEAR(own.t, hit.rayhit.t, EPSILON_F32 * 10.0f);
+    }
+  }
+}
+
+TEST_F(Bvh3Test, IndexedGrid_F32) {
+  // 32x32 quad grid in the XZ plane at y = 0.25 * x
+  const uint32_t n = 32;
+  std::vector<lm2_v3_f32> vertices;
+  for (uint32_t z = 0; z <= n; z++) {
+    for (uint32_t x = 0; x <= n; x++) {
+      vertices.push_back(lm2_v3_make_f32((float)x, 0.25f * (float)x, (float)z));
+    }
+  }
+  std::vector<uint32_t> mesh_indices;
+  for (uint32_t z = 0; z < n; z++) {
+    for (uint32_t x = 0; x < n; x++) {
+      uint32_t i0 = z * (n + 1) + x;
+      uint32_t i1 = i0 + 1;
+      uint32_t i2 = i0 + n + 1;
+      uint32_t i3 = i2 + 1;
+      mesh_indices.insert(mesh_indices.end(), {i0, i2, i1, i1, i2, i3});
+    }
+  }
+  const size_t triangle_count = mesh_indices.size() / 3;
+  std::vector<lm2_bvh3_node_f32> nodes(lm2_bvh3_node_buffer_size_f32(triangle_count));
+  std::vector<uint32_t> indices(lm2_bvh3_index_buffer_size_f32(triangle_count));
+  lm2_bvh3_f32 bvh = lm2_bvh3_build_indexed_f32(
+      vertices.data(), vertices.size(), mesh_indices.data(), mesh_indices.size(), nodes.data(), nodes.size(), indices.data(), indices.size());
+  EXPECT_EQ(bvh.triangle_count, triangle_count);
+  check_bvh_invariants_f32(&bvh);
+
+  for (float x = 0.3f; x < 32.0f; x += 2.7f) {
+    for (float z = 0.6f; z < 32.0f; z += 3.1f) {
+      lm2_ray3_f32 ray = lm2_ray3_make_f32(lm2_v3_make_f32(x, 20.0f, z), lm2_v3_make_f32(0.0f, -1.0f, 0.0f), 100.0f);
+      lm2_bvh3_hit_f32 hit = lm2_bvh3_raycast_f32(&bvh, ray);
+      ASSERT_TRUE(hit.rayhit.hit);
+      EXPECT_NEAR(hit.rayhit.point.y, 0.25f * x, 1e-4f);
+      EXPECT_NEAR(hit.rayhit.t, 20.0f - 0.25f * x, 1e-4f);
+      EXPECT_TRUE(lm2_bvh3_raycast_any_f32(&bvh, ray).rayhit.hit);
+
+      lm2_triangle3_f32 tri;
+      lm2_bvh3_get_triangle_f32(&bvh, hit.triangle_index, tri);
+      EXPECT_TRUE(lm2_raycast_triangle_f32(ray, tri[0], tri[1], tri[2]).hit);
+    }
+  }
+
+  // Pointing away from the grid
+  lm2_ray3_f32 up = lm2_ray3_make_f32(lm2_v3_make_f32(5.0f, 20.0f, 5.0f), lm2_v3_make_f32(0.0f, 1.0f, 0.0f), 100.0f);
+  EXPECT_FALSE(lm2_bvh3_raycast_f32(&bvh, up).rayhit.hit);
+  EXPECT_FALSE(lm2_bvh3_raycast_any_f32(&bvh, up).rayhit.hit);
+}
+
+TEST_F(Bvh3Test, RaycastMatchesBruteForce_F64) {
+  const size_t count = 1500;
+  std::vector<lm2_v3_f32> vertices_f32 = random_soup_vertices_f32(count, 6);
+  std::vector<lm2_v3_f64> vertices(vertices_f32.size());
+  for (size_t i = 0; i < vertices.size(); i++) {
+    vertices[i] = lm2_v3_make_f64(vertices_f32[i].x, vertices_f32[i].y, vertices_f32[i].z);
+  }
+  std::vector<uint32_t> mesh_indices(vertices.size());
+  for (size_t i = 0; i < mesh_indices.size(); i++) {
+    mesh_indices[i] = (uint32_t)i;
+  }
+
+  std::vector<lm2_bvh3_node_f64> nodes(lm2_bvh3_node_buffer_size_f64(count));
+  std::vector<uint32_t> indices(count);
+  lm2_bvh3_f64 bvh = lm2_bvh3_build_indexed_f64(
+      vertices.data(), vertices.size(), mesh_indices.data(), mesh_indices.size(), nodes.data(), nodes.size(), indices.data(), indices.size());
+
+  int hits = 0;
+  for (const lm2_ray3_f32& ray_f32 : random_rays_f32(300, 7)) {
+    lm2_ray3_f64 ray = lm2_ray3_make_f64(lm2_v3_make_f64(ray_f32.origin.x, ray_f32.origin.y, ray_f32.origin.z),
+                                         lm2_v3_make_f64(ray_f32.direction.x, ray_f32.direction.y, ray_f32.direction.z),
+                                         ray_f32.t_max);
+    lm2_rayhit3_f64 expected = {};
+    for (size_t i = 0; i < count; i++) {
+      lm2_rayhit3_f64 h = lm2_raycast_triangle_f64(ray, vertices[i * 3], vertices[i * 3 + 1], vertices[i * 3 + 2]);
+      if (h.hit && (!expected.hit || h.t < expected.t)) {
+        expected = h;
+      }
+    }
+    lm2_bvh3_hit_f64 hit = lm2_bvh3_raycast_f64(&bvh, ray);
+    ASSERT_EQ(hit.rayhit.hit, expected.hit);
+    EXPECT_EQ(lm2_bvh3_raycast_any_f64(&bvh, ray).rayhit.hit, expected.hit);
+    if (expected.hit) {
+      hits++;
+      EXPECT_NEAR(hit.rayhit.t, expected.t, EPSILON_F64 * 100.0);
+      EXPECT_NEAR(hit.rayhit.point.x, expected.point.x, EPSILON_F64 * 100.0);
+    }
+  }
+  EXPECT_GT(hits, 30);
+}
+
+// =============================================================================
+// Box Hierarchy Tests
+// =============================================================================
+
+static std::vector<lm2_r3_f32> random_boxes_f32(size_t count, uint32_t seed) {
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<float> pos(-100.0f, 100.0f);
+  std::uniform_real_distribution<float> size(0.0f, 2.0f);
+  std::vector<lm2_r3_f32> boxes(count);
+  for (auto& box : boxes) {
+    box.min = lm2_v3_make_f32(pos(rng), pos(rng), pos(rng));
+    box.max = lm2_v3_make_f32(box.min.x + size(rng), box.min.y + size(rng), box.min.z + size(rng));
+  }
+  return boxes;
+}
+
+// Check that every node encloses its children or boxes and that every box
+// appears in exactly one leaf
+static void check_box_invariants_f32(const std::vector<lm2_bvh3_node_f32>& nodes,
+                                     uint32_t node_count,
+                                     const std::vector<uint32_t>& primitive_indices,
+                                     const std::vector<lm2_r3_f32>& boxes) {
+  std::vector<int> seen(boxes.size(), 0);
+  for (uint32_t n = 0; n < node_count; n++) {
+    const lm2_bvh3_node_f32& node = nodes[n];
+    if (node.count > 0) {
+      for (uint32_t i = node.first; i < node.first + node.count; i++) {
+        uint32_t box_index = primitive_indices[i];
+        ASSERT_LT(box_index, boxes.size());
+        seen[box_index]++;
+        for (int axis = 0; axis < 3; axis++) {
+          EXPECT_LE(node.bounds.min.e[axis], boxes[box_index].min.e[axis]);
+          EXPECT_GE(node.bounds.max.e[axis], boxes[box_index].max.e[axis]);
+        }
+      }
+    } else {
+      ASSERT_GT(node.first, n);
+      ASSERT_LT(node.first + 1, node_count);
+      for (uint32_t c = node.first; c <= node.first + 1; c++) {
+        for (int axis = 0; axis < 3; axis++) {
+          EXPECT_LE(node.bounds.min.e[axis], nodes[c].bounds.min.e[axis]);
+          EXPECT_GE(node.bounds.max.e[axis], nodes[c].bounds.max.e[axis]);
+        }
+      }
+    }
+  }
+  for (size_t i = 0; i < boxes.size(); i++) {
+    EXPECT_EQ(seen[i], 1);
+  }
+}
+
+// Compare two trees node by node from the root, ignoring where the nodes are stored
+static void expect_same_tree_f32(const std::vector<lm2_bvh3_node_f32>& a, const std::vector<lm2_bvh3_node_f32>& b) {
+  std::vector<std::pair<uint32_t, uint32_t>> stack = {{0, 0}};
+  while (!stack.empty()) {
+    auto [ia, ib] = stack.back();
+    stack.pop_back();
+    ASSERT_EQ(a[ia].count, b[ib].count);
+    for (int axis = 0; axis < 3; axis++) {
+      ASSERT_EQ(a[ia].bounds.min.e[axis], b[ib].bounds.min.e[axis]);
+      ASSERT_EQ(a[ia].bounds.max.e[axis], b[ib].bounds.max.e[axis]);
+    }
+    if (a[ia].count > 0) {
+      ASSERT_EQ(a[ia].first, b[ib].first);
+    } else {
+      stack.push_back({a[ia].first, b[ib].first});
+      stack.push_back({a[ia].first + 1, b[ib].first + 1});
+    }
+  }
+}
+
+TEST_F(Bvh3Test, BoundsBuildInvariants_F32) {
+  EXPECT_EQ(lm2_bvh3_build_bounds_f32(NULL, 0, NULL, 0, NULL, 0), 0u);
+
+  const size_t count = 3000;
+  std::vector<lm2_r3_f32> boxes = random_boxes_f32(count, 11);
+  std::vector<lm2_bvh3_node_f32> nodes(lm2_bvh3_node_buffer_size_f32(count));
+  std::vector<uint32_t> indices(lm2_bvh3_index_buffer_size_f32(count));
+  uint32_t node_count = lm2_bvh3_build_bounds_f32(boxes.data(), count, nodes.data(), nodes.size(), indices.data(), indices.size());
+
+  EXPECT_GT(node_count, 1u);
+  EXPECT_LE(node_count, nodes.size());
+  check_box_invariants_f32(nodes, node_count, indices, boxes);
+}
+
+TEST_F(Bvh3Test, ParallelBuildMatchesSequential_F32) {
+  const size_t count = 100000;
+  std::vector<lm2_r3_f32> boxes = random_boxes_f32(count, 12);
+  std::vector<lm2_bvh3_node_f32> expected_nodes(lm2_bvh3_node_buffer_size_f32(count));
+  std::vector<uint32_t> expected_indices(count);
+  uint32_t expected_count = lm2_bvh3_build_bounds_f32(
+      boxes.data(), count, expected_nodes.data(), expected_nodes.size(), expected_indices.data(), expected_indices.size());
+
+  for (uint32_t thread_count : {1u, 2u, 3u, 8u}) {
+    std::vector<lm2_bvh3_node_f32> nodes(lm2_bvh3_node_buffer_size_f32(count));
+    std::vector<uint32_t> indices(count);
+    uint32_t node_count = lm2_bvh3_build_bounds_parallel_f32(
+        boxes.data(), count, nodes.data(), nodes.size(), indices.data(), indices.size(), thread_count);
+
+    EXPECT_EQ(node_count, expected_count);
+    EXPECT_EQ(indices, expected_indices);
+    check_box_invariants_f32(nodes, node_count, indices, boxes);
+    expect_same_tree_f32(nodes, expected_nodes);
+  }
+}
+
+TEST_F(Bvh3Test, RefitBounds_F32) {
+  const size_t count = 50000;
+  std::vector<lm2_r3_f32> boxes = random_boxes_f32(count, 13);
+  std::vector<lm2_bvh3_node_f32> nodes(lm2_bvh3_node_buffer_size_f32(count));
+  std::vector<uint32_t> indices(count);
+  uint32_t node_count = lm2_bvh3_build_bounds_parallel_f32(boxes.data(), count, nodes.data(), nodes.size(), indices.data(), indices.size(), 4);
+
+  std::mt19937 rng(14);
+  std::uniform_real_distribution<float> move(-5.0f, 5.0f);
+  lm2_r3_f32 all = boxes[0];
+  for (auto& box : boxes) {
+    lm2_v3_f32 d = lm2_v3_make_f32(move(rng), move(rng), move(rng));
+    box.min = lm2_v3_add_f32(box.min, d);
+    box.max = lm2_v3_add_f32(box.max, d);
+    all.min = lm2_v3_min_f32(all.min, box.min);
+    all.max = lm2_v3_max_f32(all.max, box.max);
+  }
+  lm2_bvh3_refit_bounds_f32(nodes.data(), node_count, indices.data(), boxes.data());
+
+  check_box_invariants_f32(nodes, node_count, indices, boxes);
+  for (int axis = 0; axis < 3; axis++) {
+    EXPECT_EQ(nodes[0].bounds.min.e[axis], all.min.e[axis]);
+    EXPECT_EQ(nodes[0].bounds.max.e[axis], all.max.e[axis]);
+  }
+}
+
+TEST_F(Bvh3Test, RefitMovedMeshMatchesBruteForce_F32) {
+  const size_t count = 2000;
+  std::vector<lm2_v3_f32> vertices = random_soup_vertices_f32(count, 15);
+  std::vector<uint32_t> mesh_indices(count * 3);
+  for (uint32_t i = 0; i < mesh_indices.size(); i++) {
+    mesh_indices[i] = i;
+  }
+  std::vector<lm2_bvh3_node_f32> nodes(lm2_bvh3_node_buffer_size_f32(count));
+  std::vector<uint32_t> indices(count);
+  lm2_bvh3_f32 bvh = lm2_bvh3_build_indexed_f32(vertices.data(), vertices.size(), mesh_indices.data(), mesh_indices.size(),
+                                                nodes.data(), nodes.size(), indices.data(), indices.size());
+
+  // Swirl the vertices around the y axis, far enough that stale bounds would miss hits
+  for (auto& v : vertices) {
+    float angle = 0.05f * v.y;
+    v = lm2_v3_make_f32(v.x * std::cos(angle) - v.z * std::sin(angle), v.y, v.x * std::sin(angle) + v.z * std::cos(angle));
+  }
+  lm2_bvh3_refit_f32(&bvh);
+  check_bvh_invariants_f32(&bvh);
+
+  int hits = 0;
+  for (const lm2_ray3_f32& ray : random_rays_f32(300, 16)) {
+    lm2_rayhit3_f32 expected = brute_force_raycast_f32(&bvh, ray);
+    lm2_bvh3_hit_f32 hit = lm2_bvh3_raycast_f32(&bvh, ray);
+    ASSERT_EQ(hit.rayhit.hit, expected.hit);
+    if (expected.hit) {
+      hits++;
+      EXPECT_NEAR(hit.rayhit.t, expected.t, EPSILON_F32 * 10.0f);
+    }
+  }
+  EXPECT_GT(hits, 30);
+}
+
+TEST_F(Bvh3Test, ParallelBuildMatchesSequential_F64) {
+  const size_t count = 70000;
+  std::vector<lm2_r3_f32> boxes_f32 = random_boxes_f32(count, 17);
+  std::vector<lm2_r3_f64> boxes(count);
+  for (size_t i = 0; i < count; i++) {
+    boxes[i].min = lm2_v3_make_f64(boxes_f32[i].min.x, boxes_f32[i].min.y, boxes_f32[i].min.z);
+    boxes[i].max = lm2_v3_make_f64(boxes_f32[i].max.x, boxes_f32[i].max.y, boxes_f32[i].max.z);
+  }
+  std::vector<lm2_bvh3_node_f64> nodes(lm2_bvh3_node_buffer_size_f64(count));
+  std::vector<uint32_t> expected_indices(count);
+  std::vector<uint32_t> indices(count);
+  uint32_t expected_count = lm2_bvh3_build_bounds_f64(boxes.data(), count, nodes.data(), nodes.size(), expected_indices.data(), count);
+  uint32_t node_count = lm2_bvh3_build_bounds_parallel_f64(boxes.data(), count, nodes.data(), nodes.size(), indices.data(), count, 4);
+
+  EXPECT_EQ(node_count, expected_count);
+  EXPECT_EQ(indices, expected_indices);
+  double min_x = boxes[0].min.x;
+  for (const auto& box : boxes) {
+    min_x = box.min.x < min_x ? box.min.x : min_x;
+  }
+  EXPECT_EQ(nodes[0].bounds.min.x, min_x);
+}
@@ -0,0 +1,197 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <map>
+#include <random>
+#include <utility>
+#include <vector>
+#include "lm2/geometry3d/lm2_convex_hull3.h"
+
+// Test fixture for ConvexHull3 tests
+class ConvexHull3Test : public ::testing::Test {
+ protected:
+  static constexpr float EPSILON_F32 = 1e-5f;
+  static constexpr double EPSILON_F64 = 1e-10;
+
+  template <typename V>
+  struct mesh {
+    std::vector<V> vertices;
+    std::vector<uint32_t> indices;
+  };
+
+  static mesh<lm2_v3_f64> hull_f64(const std::vector<lm2_v3_f64>& points, uint32_t thread_count) {
+    lm2_indexed_mesh3_size size = lm2_convex_hull3_f64(points.data(), points.size(), NULL, 0, NULL, 0, thread_count);
+    mesh<lm2_v3_f64> m;
+    m.vertices.resize(size.vertex_count);
+    m.indices.resize(size.index_count);
+    lm2_convex_hull3_f64(
+        points.data(), points.size(), m.vertices.data(), m.vertices.size(), m.indices.data(), m.indices.size(),
+        thread_count);
+    return m;
+  }
+
+  // Closed two-manifold: every directed edge is used once and its reverse once, V - E + F = 2
+  template <typename V>
+  static void expect_closed(const mesh<V>& m) {
+    std::map<std::pair<uint32_t, uint32_t>, int> edges;
+    for (size_t i = 0; i < m.indices.size(); i += 3) {
+      for (int e = 0; e < 3; e++) {
+        ASSERT_LT(m.indices[i + e], m.vertices.size());
+        edges[{m.indices[i + e], m.indices[i + (e + 1) % 3]}]++;
+      }
+    }
+    for (const auto& edge : edges) {
+      EXPECT_EQ(edge.second, 1);
+      EXPECT_EQ(edges.count({edge.first.second, edge.first.first}), 1u);
+    }
+    long faces = (long)m.indices.size() / 3;
+    EXPECT_EQ((long)m.vertices.size() - (long)edges.size() / 2 + faces, 2);
+  }
+
+  // Largest distance of a point in front of a hull face, along the outward normal
+  template <typename V>
+  static double max_outside(const std::vector<V>& points, const mesh<V>& m) {
+    double worst = -INFINITY;
+    for (size_t i = 0; i < m.indices.size(); i += 3) {
+      V a = m.vertices[m.indices[i]];
+      V b = m.vertices[m.indices[i + 1]];
+      V c = m.vertices[m.indices[i + 2]];
+      double ux = (double)b.x - a.x, uy = (double)b.y - a.y, uz = (double)b.z - a.z;
+      double vx = (double)c.x - a.x, vy = (double)c.y - a.y, vz = (double)c.z - a.z;
+      double nx = uy * vz - uz * vy, ny = uz * vx - ux * vz, nz = ux * vy - uy * vx;
+      double length = std::sqrt(nx * nx + ny * ny + nz * nz);
+      for (const V& p : points) {
+        double d = (nx * (p.x - a.x) + ny * (p.y - a.y) + nz * (p.z - a.z)) / length;
+        worst = d > worst ? d : worst;
+      }
+    }
+    return worst;
+  }
+};
+
+// =============================================================================
+// Small Inputs
+// =============================================================================
+
+TEST_F(ConvexHull3Test, CubeWithInteriorPoints_F64) {
+  std::vector<lm2_v3_f64> points;
+  for (int i = 0; i < 8; i++) {
+    points.push_back(lm2_v3_make_f64(i & 1, (i >> 1) & 1, (i >> 2) & 1));
+  }
+  points.push_back(lm2_v3_make_f64(0.5, 0.5, 0.5));
+  points.push_back(lm2_v3_make_f64(0.25, 0.5, 0.75));
+  points.push_back(lm2_v3_make_f64(0.5, 0.5, 1.0));  // On a face
+
+  mesh<lm2_v3_f64> m = hull_f64(points, 1);
+
+  EXPECT_EQ(m.vertices.size(), 8u);
+  EXPECT_EQ(m.indices.size(), 36u);
+  expect_closed(m);
+  EXPECT_LE(max_outside(points, m), EPSILON_F64);
+
+  // Counter-clockwise from outside: the signed volume is the cube's
+  double volume = 0.0;
+  for (size_t i = 0; i < m.indices.size(); i += 3) {
+    lm2_v3_f64 a = m.vertices[m.indices[i]];
+    lm2_v3_f64 b = m.vertices[m.indices[i + 1]];
+    lm2_v3_f64 c = m.vertices[m.indices[i + 2]];
+    volume += (a.x * (b.y * c.z - b.z * c.y) + a.y * (b.z * c.x - b.x * c.z) + a.z * (b.x * c.y - b.y * c.x)) / 6.0;
+  }
+  EXPECT_NEAR(volume, 1.0, EPSILON_F64);
+}
+
+TEST_F(ConvexHull3Test, FlatAndTinyInputsGiveNoHull_F32) {
+  lm2_v3_f32 flat[5] = {{0, 0, 2}, {1, 0, 2}, {0, 1, 2}, {1, 1, 2}, {0.5f, 0.5f, 2}};
+  lm2_indexed_mesh3_size size = lm2_convex_hull3_f32(flat, 5, NULL, 0, NULL, 0, 1);
+  EXPECT_EQ(size.vertex_count, 0u);
+  EXPECT_EQ(size.index_count, 0u);
+
+  size = lm2_convex_hull3_f32(flat, 3, NULL, 0, NULL, 0, 1);
+  EXPECT_EQ(size.index_count, 0u);
+
+  lm2_v3_f32 line[4] = {{0, 0, 0}, {1, 1, 1}, {2, 2, 2}, {3, 3, 3}};
+  size = lm2_convex_hull3_f32(line, 4, NULL, 0, NULL, 0, 1);
+  EXPECT_EQ(size.index_count, 0u);
+}
+
+TEST_F(ConvexHull3Test, SmallBuffersAreLeftUntouched_F32) {
+  lm2_v3_f32 points[5] = {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {0, 0, 1}, {NAN, 0, 0}};
+  lm2_v3_f32 vertices[4];
+  uint32_t indices[12] = {77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77};
+
+  lm2_indexed_mesh3_size size = lm2_convex_hull3_f32(points, 5, vertices, 4, indices, 11, 1);
+  EXPECT_EQ(size.vertex_count, 4u);
+  EXPECT_EQ(size.index_count, 12u);
+  EXPECT_EQ(indices[0], 77u);
+
+  size = lm2_convex_hull3_f32(points, 5, vertices, 4, indices, 12, 1);
+  EXPECT_EQ(size.index_count, 12u);
+  for (uint32_t index : indices) {
+    EXPECT_LT(index, 4u);
+  }
+}
+
+// =============================================================================
+// Large Inputs
+// =============================================================================
+
+TEST_F(ConvexHull3Test, LargeCloudSameForAnyThreadCount_F64) {
+  std::mt19937 rng(5);
+  std::normal_distribution<double> normal;
+  std::vector<lm2_v3_f64> points(200000);
+  for (auto& p : points) {
+    p = lm2_v3_make_f64(normal(rng), normal(rng), normal(rng));
+  }
+
+  mesh<lm2_v3_f64> m = hull_f64(points, 1);
+  mesh<lm2_v3_f64> threaded = hull_f64(points, 4);
+
+  expect_closed(m);
+  EXPECT_LE(max_outside(points, m), 1e-9);
+  EXPECT_EQ(m.indices, threaded.indices);
+  ASSERT_EQ(m.vertices.size(), threaded.vertices.size());
+  for (size_t i = 0; i < m.vertices.size(); i++) {
+    EXPECT_EQ(m.vertices[i].x, threaded.vertices[i].x);
+  }
+}
+
+TEST_F(ConvexHull3Test, PointsOnSphereAreAllOnTheHull_F64) {
+  std::mt19937 rng(9);
+  std::normal_distribution<double> normal;
+  std::vector<lm2_v3_f64> points(2000);
+  for (auto& p : points) {
+    lm2_v3_f64 d = lm2_v3_make_f64(normal(rng), normal(rng), normal(rng));
+    double length = std::sqrt(d.x * d.x + d.y * d.y + d.z * d.z);
+    p = lm2_v3_make_f64(d.x / length, d.y / length, d.z / length);
+  }
+
+  mesh<lm2_v3_f64> m = hull_f64(points, 1);
+
+  EXPECT_EQ(m.vertices.size(), points.size());
+  EXPECT_EQ(m.indices.size(), 3 * (2 * points.size() - 4));
+  expect_closed(m);
+  EXPECT_LE(max_outside(points, m), 1e-12);
+}
@@ -0,0 +1,246 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+#include <vector>
+#include "lm2/geometry3d/lm2_frustum3.h"
+#include "lm2/lm2_constants.h"
+#include "lm2/vectors/lm2_vector_specifics.h"
+
+// Test fixture for Frustum3 tests
+class Frustum3Test : public ::testing::Test {
+ protected:
+  static constexpr float EPSILON_F32 = 1e-5f;
+  static constexpr double EPSILON_F64 = 1e-10;
+};
+
+static bool bit_is_set(const std::vector<uint32_t>& bits, size_t i) {
+  return (bits[i / 32] >> (i % 32)) & 1u;
+}
+
+// =============================================================================
+// Construction
+// =============================================================================
+
+TEST_F(Frustum3Test, PlanesOfPerspectiveCamera_F64) {
+  // Looking down -z from the origin with a 90 degree vertical FOV
+  lm2_camera3_f64 camera = lm2_camera3_perspective_f64(lm2_v3_make_f64(0, 0, 0), lm2_v3_make_f64(0, 0, -1), lm2_v3_make_f64(0, 1, 0),
+                                                       LM2_PI_F64 / 2, 1.0, 1.0, 100.0);
+  lm2_frustum3_f64 f = lm2_frustum3_from_camera_f64(camera);
+
+  const double s = std::sqrt(0.5);
+  EXPECT_NEAR(f.planes[LM2_FRUSTUM3_LEFT].normal.x, s, EPSILON_F64);
+  EXPECT_NEAR(f.planes[LM2_FRUSTUM3_LEFT].normal.z, -s, EPSILON_F64);
+  EXPECT_NEAR(f.planes[LM2_FRUSTUM3_RIGHT].normal.x, -s, EPSILON_F64);
+  EXPECT_NEAR(f.planes[LM2_FRUSTUM3_BOTTOM].normal.y, s, EPSILON_F64);
+  EXPECT_NEAR(f.planes[LM2_FRUSTUM3_TOP].normal.y, -s, EPSILON_F64);
+  EXPECT_NEAR(f.planes[LM2_FRUSTUM3_NEAR].normal.z, -1.0, EPSILON_F64);
+  EXPECT_NEAR(f.planes[LM2_FRUSTUM3_NEAR].distance, 1.0, 1e-9);
+  EXPECT_NEAR(f.planes[LM2_FRUSTUM3_FAR].normal.z, 1.0, EPSILON_F64);
+  EXPECT_NEAR(f.planes[LM2_FRUSTUM3_FAR].distance, -100.0, 1e-9);
+  for (int i = 0; i < LM2_FRUSTUM3_PLANE_COUNT; i++) {
+    EXPECT_NEAR(lm2_v3_length_f64(f.planes[i].normal), 1.0, EPSILON_F64);
+  }
+
+  EXPECT_TRUE(lm2_frustum3_contains_point_f64(&f, lm2_v3_make_f64(0, 0, -50)));
+  EXPECT_TRUE(lm2_frustum3_contains_point_f64(&f, lm2_v3_make_f64(9, -9, -10)));
+  EXPECT_FALSE(lm2_frustum3_contains_point_f64(&f, lm2_v3_make_f64(11, 0, -10)));
+  EXPECT_FALSE(lm2_frustum3_contains_point_f64(&f, lm2_v3_make_f64(0, 0, -0.5)));
+  EXPECT_FALSE(lm2_frustum3_contains_point_f64(&f, lm2_v3_make_f64(0, 0, -101)));
+}
+
+TEST_F(Frustum3Test, ContainsPointAgreesWithNdc_F32) {
+  std::mt19937 rng(7);
+  std::uniform_real_distribution<float> u(-30.0f, 30.0f);
+  lm2_camera3_f32 cameras[2] = {
+      lm2_camera3_perspective_f32(lm2_v3_make_f32(3, 4, 5), lm2_v3_make_f32(-2, 1, -8), lm2_v3_make_f32(0, 1, 0), 1.0f, 1.6f, 0.5f, 40.0f),
+      lm2_camera3_orthographic_f32(lm2_v3_make_f32(-4, 2, 1), lm2_v3_make_f32(6, -1, 3), lm2_v3_make_f32(0, 1, 0), 8.0f, 0.75f, 1.0f, 30.0f),
+  };
+  for (const lm2_camera3_f32& camera : cameras) {
+    lm2_frustum3_f32 f = lm2_frustum3_from_camera_f32(camera);
+    lm2_m4x4_f32 vp = lm2_camera3_get_view_projection_f32(camera);
+    int inside = 0;
+    for (int i = 0; i < 20000; i++) {
+      lm2_v3_f32 p = lm2_v3_make_f32(u(rng), u(rng), u(rng));
+      lm2_v4_f32 clip = lm2_m4x4_transform_f32(vp, lm2_v4_make_f32(p.x, p.y, p.z, 1.0f));
+      // Skip points too close to a plane for float rounding to agree
+      float margin = 1e-3f * std::fabs(clip.w);
+      float edge = clip.w - std::fmax(std::fabs(clip.x), std::fmax(std::fabs(clip.y), std::fabs(clip.z)));
+      if (std::fabs(edge) < margin) {
+        continue;
+      }
+      bool expected = clip.w > 0 && edge > 0;
+      EXPECT_EQ(lm2_frustum3_contains_point_f32(&f, p), expected);
+      inside += expected;
+    }
+    EXPECT_GT(inside, 100);
+  }
+}
+
+// =============================================================================
+// Classification
+// =============================================================================
+
+TEST_F(Frustum3Test, ClassifyReturnsCrossedPlanes_F32) {
+  lm2_camera3_f32 camera = lm2_camera3_perspective_f32(lm2_v3_make_f32(0, 0, 0), lm2_v3_make_f32(0, 0, -1), lm2_v3_make_f32(0, 1, 0),
+                                                       LM2_PI_F32 / 2, 1.0f, 1.0f, 100.0f);
+  lm2_frustum3_f32 f = lm2_frustum3_from_camera_f32(camera);
+  uint32_t mask = 0xFFu;
+
+  lm2_r3_f32 inside = lm2_r3_from_min_max_f32(lm2_v3_make_f32(-1, -1, -20), lm2_v3_make_f32(1, 1, -10));
+  EXPECT_EQ(lm2_frustum3_classify_aabb_f32(&f, inside, LM2_FRUSTUM3_ALL_PLANES, &mask), LM2_FRUSTUM3_INSIDE);
+  EXPECT_EQ(mask, 0u);
+
+  // Crosses the left and near planes only
+  lm2_r3_f32 corner = lm2_r3_from_min_max_f32(lm2_v3_make_f32(-5, -0.5f, -3), lm2_v3_make_f32(0, 0.5f, -0.8f));
+  EXPECT_EQ(lm2_frustum3_classify_aabb_f32(&f, corner, LM2_FRUSTUM3_ALL_PLANES, &mask), LM2_FRUSTUM3_INTERSECTING);
+  EXPECT_EQ(mask, (1u << LM2_FRUSTUM3_LEFT) | (1u << LM2_FRUSTUM3_NEAR));
+
+  lm2_r3_f32 behind = lm2_r3_from_min_max_f32(lm2_v3_make_f32(-1, -1, 1), lm2_v3_make_f32(1, 1, 3));
+  EXPECT_EQ(lm2_frustum3_classify_aabb_f32(&f, behind, LM2_FRUSTUM3_ALL_PLANES, &mask), LM2_FRUSTUM3_OUTSIDE);
+  EXPECT_EQ(mask, 0u);
+  // Without the near plane in the mask nothing rejects it
+  EXPECT_EQ(lm2_frustum3_classify_aabb_f32(&f, behind, LM2_FRUSTUM3_ALL_PLANES & ~(1u << LM2_FRUSTUM3_NEAR), NULL),
+            LM2_FRUSTUM3_INTERSECTING);
+
+  // A child of the corner box only needs the planes its parent crossed
+  lm2_r3_f32 child = lm2_r3_from_min_max_f32(lm2_v3_make_f32(-2, -0.5f, -2.5f), lm2_v3_make_f32(-1, 0.5f, -1.5f));
+  uint32_t child_mask = 0xFFu;
+  EXPECT_EQ(lm2_frustum3_classify_aabb_f32(&f, child, (1u << LM2_FRUSTUM3_LEFT) | (1u << LM2_FRUSTUM3_NEAR), &child_mask),
+            LM2_FRUSTUM3_INTERSECTING);
+  EXPECT_EQ(child_mask, 1u << LM2_FRUSTUM3_LEFT);
+
+  // Spheres
+  EXPECT_EQ(lm2_frustum3_classify_sphere_f32(&f, lm2_sphere_make_f32(lm2_v3_make_f32(0, 0, -50), 5.0f), LM2_FRUSTUM3_ALL_PLANES, &mask),
+            LM2_FRUSTUM3_INSIDE);
+  EXPECT_EQ(lm2_frustum3_classify_sphere_f32(&f, lm2_sphere_make_f32(lm2_v3_make_f32(0, 0, -99), 5.0f), LM2_FRUSTUM3_ALL_PLANES, &mask),
+            LM2_FRUSTUM3_INTERSECTING);
+  EXPECT_EQ(mask, 1u << LM2_FRUSTUM3_FAR);
+  EXPECT_EQ(lm2_frustum3_classify_sphere_f32(&f, lm2_sphere_make_f32(lm2_v3_make_f32(20, 0, -10), 5.0f), LM2_FRUSTUM3_ALL_PLANES, &mask),
+            LM2_FRUSTUM3_OUTSIDE);
+}
+
+// =============================================================================
+// Batch Culling
+// =============================================================================
+
+TEST_F(Frustum3Test, BatchMatchesClassify_F32) {
+  std::mt19937 rng(11);
+  std::uniform_real_distribution<float> pos(-60.0f, 60.0f);
+  std::uniform_real_distribution<float> size(0.1f, 6.0f);
+  lm2_camera3_f32 camera = lm2_camera3_perspective_f32(lm2_v3_make_f32(1, 2, 3), lm2_v3_make_f32(10, -3, -20), lm2_v3_make_f32(0, 1, 0),
+                                                       1.2f, 1.5f, 0.5f, 50.0f);
+  lm2_frustum3_f32 f = lm2_frustum3_from_camera_f32(camera);
+
+  // 1000 is not a multiple of 32 or of any SIMD width
+  const size_t count = 1000;
+  std::vector<lm2_r3_f32> boxes;
+  std::vector<lm2_sphere_f32> spheres;
+  for (size_t i = 0; i < count; i++) {
+    lm2_v3_f32 c = lm2_v3_make_f32(pos(rng), pos(rng), pos(rng));
+    lm2_v3_f32 e = lm2_v3_make_f32(size(rng), size(rng), size(rng));
+    boxes.push_back(lm2_r3_from_center_extents_f32(c, e));
+    spheres.push_back(lm2_sphere_make_f32(c, size(rng)));
+  }
+
+  const uint32_t masks[3] = {LM2_FRUSTUM3_ALL_PLANES, (1u << LM2_FRUSTUM3_LEFT) | (1u << LM2_FRUSTUM3_FAR), 0u};
+  for (uint32_t plane_mask : masks) {
+    std::vector<uint32_t> bits((count + 31) / 32, 0xDEADBEEFu);
+    std::vector<uint32_t> indices(count);
+
+    size_t box_visible = lm2_frustum3_cull_aabbs_f32(&f, boxes.data(), count, plane_mask, bits.data());
+    size_t box_listed = lm2_frustum3_cull_aabbs_to_indices_f32(&f, boxes.data(), count, plane_mask, indices.data());
+    ASSERT_EQ(box_visible, box_listed);
+    size_t expected = 0;
+    for (size_t i = 0; i < count; i++) {
+      bool visible = lm2_frustum3_classify_aabb_f32(&f, boxes[i], plane_mask, NULL) != LM2_FRUSTUM3_OUTSIDE;
+      EXPECT_EQ(bit_is_set(bits, i), visible) << "box " << i;
+      if (visible) {
+        ASSERT_LT(expected, box_listed);
+        EXPECT_EQ(indices[expected], i);
+        expected++;
+      }
+    }
+    EXPECT_EQ(expected, box_visible);
+    // Bits past the last shape are cleared
+    EXPECT_EQ(bits.back() >> (count % 32), 0u);
+
+    size_t sphere_visible = lm2_frustum3_cull_spheres_f32(&f, spheres.data(), count, plane_mask, bits.data());
+    size_t sphere_listed = lm2_frustum3_cull_spheres_to_indices_f32(&f, spheres.data(), count, plane_mask, indices.data());
+    ASSERT_EQ(sphere_visible, sphere_listed);
+    expected = 0;
+    for (size_t i = 0; i < count; i++) {
+      bool visible = lm2_frustum3_classify_sphere_f32(&f, spheres[i], plane_mask, NULL) != LM2_FRUSTUM3_OUTSIDE;
+      EXPECT_EQ(bit_is_set(bits, i), visible) << "sphere " << i;
+      if (visible) {
+        EXPECT_EQ(indices[expected++], i);
+      }
+    }
+    EXPECT_EQ(expected, sphere_visible);
+
+    if (plane_mask == LM2_FRUSTUM3_ALL_PLANES) {
+      EXPECT_GT(box_visible, 20u);
+      EXPECT_LT(box_visible, count / 2);
+    }
+    if (plane_mask == 0) {
+      EXPECT_EQ(box_visible, count);
+      EXPECT_EQ(sphere_visible, count);
+    }
+  }
+}
+
+TEST_F(Frustum3Test, BatchIsConservative_F64) {
+  // Every box holding a point inside the frustum must be kept
+  std::mt19937 rng(3);
+  std::uniform_real_distribution<double> pos(-20.0, 20.0);
+  std::uniform_real_distribution<double> size(0.01, 2.0);
+  lm2_camera3_f64 camera = lm2_camera3_perspective_f64(lm2_v3_make_f64(0, 0, 10), lm2_v3_make_f64(0, 0, 0), lm2_v3_make_f64(0, 1, 0), 0.8,
+                                                       1.0, 1.0, 25.0);
+  lm2_frustum3_f64 f = lm2_frustum3_from_camera_f64(camera);
+
+  std::vector<lm2_r3_f64> boxes;
+  while (boxes.size() < 500) {
+    lm2_v3_f64 p = lm2_v3_make_f64(pos(rng), pos(rng), pos(rng));
+    if (!lm2_frustum3_contains_point_f64(&f, p)) {
+      continue;
+    }
+    lm2_v3_f64 lo = lm2_v3_make_f64(p.x - size(rng), p.y - size(rng), p.z - size(rng));
+    lm2_v3_f64 hi = lm2_v3_make_f64(p.x + size(rng), p.y + size(rng), p.z + size(rng));
+    boxes.push_back(lm2_r3_from_min_max_f64(lo, hi));
+  }
+  std::vector<uint32_t> indices(boxes.size());
+  EXPECT_EQ(lm2_frustum3_cull_aabbs_to_indices_f64(&f, boxes.data(), boxes.size(), LM2_FRUSTUM3_ALL_PLANES, indices.data()), boxes.size());
+
+  // Far outside the far plane, everything is rejected
+  for (lm2_r3_f64& box : boxes) {
+    box = lm2_r3_add_v_f64(box, lm2_v3_make_f64(0, 0, -100));
+  }
+  std::vector<uint32_t> bits((boxes.size() + 31) / 32);
+  EXPECT_EQ(lm2_frustum3_cull_aabbs_f64(&f, boxes.data(), boxes.size(), LM2_FRUSTUM3_ALL_PLANES, bits.data()), 0u);
+  for (uint32_t word : bits) {
+    EXPECT_EQ(word, 0u);
+  }
+}
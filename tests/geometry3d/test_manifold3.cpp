@@ -0,0 +1,263 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include "lm2/geometry3d/lm2_manifold3.h"
+#include "lm2/vectors/lm2_vector_specifics.h"
+
+// Test fixture for Manifold3 tests
+class Manifold3Test : public ::testing::Test {
+ protected:
+  static constexpr float EPSILON_F32 = 1e-5f;
+  static constexpr double EPSILON_F64 = 1e-10;
+};
+
+static lm2_aabb3_f64 box_f64(double x, double y, double z, double hx, double hy, double hz) {
+  return lm2_r3_from_scalars_f64(x - hx, y - hy, z - hz, x + hx, y + hy, z + hz);
+}
+
+// Exact distance between two separated boxes
+static double box_distance_f64(lm2_aabb3_f64 a, lm2_aabb3_f64 b) {
+  double gx = std::max({0.0, b.min.x - a.max.x, a.min.x - b.max.x});
+  double gy = std::max({0.0, b.min.y - a.max.y, a.min.y - b.max.y});
+  double gz = std::max({0.0, b.min.z - a.max.z, a.min.z - b.max.z});
+  return std::sqrt(gx * gx + gy * gy + gz * gz);
+}
+
+// =============================================================================
+// Fast Paths
+// =============================================================================
+
+TEST_F(Manifold3Test, SphereToSphere_F32) {
+  lm2_sphere_f32 a = lm2_sphere_make_coords_f32(0.0f, 0.0f, 0.0f, 1.0f);
+  lm2_sphere_f32 b = lm2_sphere_make_coords_f32(1.5f, 0.0f, 0.0f, 1.0f);
+  lm2_manifold3_f32 m;
+  lm2_manifold3_sphere_to_sphere_f32(a, b, &m);
+  ASSERT_EQ(m.count, 1);
+  EXPECT_NEAR(m.depths[0], 0.5f, EPSILON_F32);
+  EXPECT_NEAR(m.normal.x, 1.0f, EPSILON_F32);
+  EXPECT_NEAR(m.contact_points[0].x, 0.5f, EPSILON_F32);
+
+  b.center.x = 2.5f;
+  lm2_manifold3_sphere_to_sphere_f32(a, b, &m);
+  EXPECT_EQ(m.count, 0);
+}
+
+TEST_F(Manifold3Test, SphereInsideAabbLeavesThroughNearestFace_F64) {
+  lm2_aabb3_f64 box = box_f64(0.0, 0.0, 0.0, 2.0, 1.0, 2.0);
+  lm2_sphere_f64 sphere = lm2_sphere_make_coords_f64(0.5, 0.75, 0.0, 0.5);
+  lm2_manifold3_f64 m;
+  lm2_manifold3_sphere_to_aabb_f64(sphere, box, &m);
+  ASSERT_EQ(m.count, 1);
+  EXPECT_NEAR(m.normal.y, -1.0, EPSILON_F64);
+  EXPECT_NEAR(m.depths[0], 0.75, EPSILON_F64);
+  EXPECT_NEAR(m.contact_points[0].y, 1.0, EPSILON_F64);
+
+  sphere = lm2_sphere_make_coords_f64(2.3, 0.0, 0.0, 0.5);
+  lm2_manifold3_sphere_to_aabb_f64(sphere, box, &m);
+  ASSERT_EQ(m.count, 1);
+  EXPECT_NEAR(m.normal.x, -1.0, EPSILON_F64);
+  EXPECT_NEAR(m.depths[0], 0.2, EPSILON_F64);
+}
+
+TEST_F(Manifold3Test, CapsulesSideBySideHaveTwoContacts_F32) {
+  lm2_capsule3_f32 a = lm2_capsule3_make_coords_f32(-2.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 0.5f);
+  lm2_capsule3_f32 b = lm2_capsule3_make_coords_f32(-1.0f, 0.0f, 0.9f, 3.0f, 0.0f, 0.9f, 0.5f);
+  lm2_manifold3_f32 m;
+  lm2_manifold3_capsule_to_capsule_f32(a, b, &m);
+  ASSERT_EQ(m.count, 2);
+  EXPECT_NEAR(m.normal.z, 1.0f, EPSILON_F32);
+  float xs[2] = {m.contact_points[0].x, m.contact_points[1].x};
+  std::sort(xs, xs + 2);
+  EXPECT_NEAR(xs[0], -1.0f, EPSILON_F32);
+  EXPECT_NEAR(xs[1], 2.0f, EPSILON_F32);
+  for (int i = 0; i < 2; ++i) {
+    EXPECT_NEAR(m.depths[i], 0.1f, EPSILON_F32);
+    EXPECT_NEAR(m.contact_points[i].z, 0.4f, EPSILON_F32);
+  }
+}
+
+TEST_F(Manifold3Test, CrossedCapsulesHaveOneContact_F64) {
+  lm2_capsule3_f64 a = lm2_capsule3_make_coords_f64(-2.0, 0.0, 0.0, 2.0, 0.0, 0.0, 0.5);
+  lm2_capsule3_f64 b = lm2_capsule3_make_coords_f64(0.5, -2.0, 0.8, 0.5, 2.0, 0.8, 0.25);
+  lm2_manifold3_f64 m;
+  lm2_manifold3_capsule_to_capsule_f64(a, b, &m);
+  EXPECT_EQ(m.count, 0);  // radii reach 0.75, the segments are 0.8 apart
+
+  b.start.z = b.end.z = 0.6;
+  lm2_manifold3_capsule_to_capsule_f64(a, b, &m);
+  ASSERT_EQ(m.count, 1);
+  EXPECT_NEAR(m.depths[0], 0.15, EPSILON_F64);
+  EXPECT_NEAR(m.normal.z, 1.0, EPSILON_F64);
+  EXPECT_NEAR(m.contact_points[0].x, 0.5, EPSILON_F64);
+  EXPECT_NEAR(m.contact_points[0].z, 0.35, EPSILON_F64);
+}
+
+TEST_F(Manifold3Test, CapsuleLyingOnTriangleHasTwoContacts_F32) {
+  lm2_triangle3_f32 tri;
+  lm2_triangle3_make_coords_f32(tri, -4.0f, 0.0f, -4.0f, 4.0f, 0.0f, -4.0f, 0.0f, 0.0f, 4.0f);
+  lm2_capsule3_f32 capsule = lm2_capsule3_make_coords_f32(-1.0f, 0.4f, 0.0f, 1.0f, 0.4f, 0.0f, 0.5f);
+  lm2_manifold3_f32 m;
+  lm2_manifold3_capsule_to_triangle_f32(capsule, tri, &m);
+  ASSERT_EQ(m.count, 2);
+  EXPECT_NEAR(m.normal.y, -1.0f, EPSILON_F32);
+  for (int i = 0; i < 2; ++i) {
+    EXPECT_NEAR(m.depths[i], 0.1f, EPSILON_F32);
+    EXPECT_NEAR(m.contact_points[i].y, 0.0f, EPSILON_F32);
+    EXPECT_NEAR(std::fabs(m.contact_points[i].x), 1.0f, EPSILON_F32);
+  }
+
+  // Hanging off the edge z = -4: the contacts are clipped to the face
+  capsule = lm2_capsule3_make_coords_f32(0.0f, 0.4f, -6.0f, 0.0f, 0.4f, -2.0f, 0.5f);
+  lm2_manifold3_capsule_to_triangle_f32(capsule, tri, &m);
+  ASSERT_EQ(m.count, 2);
+  float zs[2] = {m.contact_points[0].z, m.contact_points[1].z};
+  std::sort(zs, zs + 2);
+  EXPECT_NEAR(zs[0], -4.0f, EPSILON_F32);
+  EXPECT_NEAR(zs[1], -2.0f, EPSILON_F32);
+}
+
+TEST_F(Manifold3Test, CapsuleNearTriangleEdgeHasOneContact_F64) {
+  lm2_triangle3_f64 tri;
+  lm2_triangle3_make_coords_f64(tri, 0.0, 0.0, 0.0, 2.0, 0.0, 0.0, 0.0, 0.0, 2.0);
+  // Vertical capsule just outside the x = 0 edge
+  lm2_capsule3_f64 capsule = lm2_capsule3_make_coords_f64(-0.3, -1.0, 0.5, -0.3, 1.0, 0.5, 0.5);
+  lm2_manifold3_f64 m;
+  lm2_manifold3_capsule_to_triangle_f64(capsule, tri, &m);
+  ASSERT_EQ(m.count, 1);
+  EXPECT_NEAR(m.normal.x, 1.0, EPSILON_F64);
+  EXPECT_NEAR(m.depths[0], 0.2, EPSILON_F64);
+  EXPECT_NEAR(m.contact_points[0].x, 0.0, EPSILON_F64);
+}
+
+// =============================================================================
+// GJK / EPA
+// =============================================================================
+
+TEST_F(Manifold3Test, CapsulePiercingTriangleUsesEpa_F64) {
+  lm2_triangle3_f64 tri;
+  lm2_triangle3_make_coords_f64(tri, -10.0, 0.0, -10.0, 10.0, 0.0, -10.0, 0.0, 0.0, 10.0);
+  lm2_capsule3_f64 capsule = lm2_capsule3_make_coords_f64(0.0, -1.0, 0.0, 0.0, 2.0, 0.0, 0.25);
+  lm2_manifold3_f64 m;
+  lm2_manifold3_capsule_to_triangle_f64(capsule, tri, &m);
+  ASSERT_EQ(m.count, 1);
+  EXPECT_NEAR(m.normal.y, -1.0, 1e-9);
+  EXPECT_NEAR(m.depths[0], 1.25, 1e-9);
+}
+
+TEST_F(Manifold3Test, GjkMatchesExactBoxDistance_F64) {
+  std::mt19937 rng(7);
+  std::uniform_real_distribution<double> pos(-4.0, 4.0);
+  std::uniform_real_distribution<double> half(0.1, 1.5);
+  int separated = 0;
+  for (int trial = 0; trial < 300; ++trial) {
+    lm2_aabb3_f64 a = box_f64(pos(rng), pos(rng), pos(rng), half(rng), half(rng), half(rng));
+    lm2_aabb3_f64 b = box_f64(pos(rng), pos(rng), pos(rng), half(rng), half(rng), half(rng));
+    lm2_gjk3_proxy_f64 pa = lm2_gjk3_proxy_from_shape_f64(lm2_shape3_from_aabb3_f64(&a));
+    lm2_gjk3_proxy_f64 pb = lm2_gjk3_proxy_from_shape_f64(lm2_shape3_from_aabb3_f64(&b));
+    lm2_gjk3_result_f64 r = lm2_gjk3_distance_f64(&pa, &pb, NULL);
+    double expected = box_distance_f64(a, b);
+    if (expected > 1e-6) {
+      ++separated;
+      EXPECT_NEAR(r.distance, expected, 1e-8) << "trial " << trial;
+      EXPECT_NEAR(lm2_v3_distance_f64(r.point_a, r.point_b), expected, 1e-8);
+    } else {
+      EXPECT_LE(r.distance, 1e-8) << "trial " << trial;
+    }
+  }
+  EXPECT_GT(separated, 100);
+}
+
+TEST_F(Manifold3Test, EpaBoxPenetrationUsesSmallestAxis_F64) {
+  std::mt19937 rng(11);
+  std::uniform_real_distribution<double> pos(-1.0, 1.0);
+  std::uniform_real_distribution<double> half(0.5, 1.5);
+  for (int trial = 0; trial < 100; ++trial) {
+    lm2_aabb3_f64 a = box_f64(0.0, 0.0, 0.0, half(rng), half(rng), half(rng));
+    lm2_aabb3_f64 b = box_f64(pos(rng), pos(rng), pos(rng), half(rng), half(rng), half(rng));
+    double ox = std::min(a.max.x, b.max.x) - std::max(a.min.x, b.min.x);
+    double oy = std::min(a.max.y, b.max.y) - std::max(a.min.y, b.min.y);
+    double oz = std::min(a.max.z, b.max.z) - std::max(a.min.z, b.min.z);
+    // Push out moves: the overlap, or fully through to the other side
+    double px = std::min(a.max.x - b.min.x, b.max.x - a.min.x);
+    double py = std::min(a.max.y - b.min.y, b.max.y - a.min.y);
+    double pz = std::min(a.max.z - b.min.z, b.max.z - a.min.z);
+    ASSERT_GT(std::min({ox, oy, oz}), 0.0);
+    double expected = std::min({px, py, pz});
+    lm2_manifold3_f64 m;
+    lm2_manifold3_shape_to_shape_f64(lm2_shape3_from_aabb3_f64(&a), lm2_shape3_from_aabb3_f64(&b), NULL, &m);
+    ASSERT_EQ(m.count, 1) << "trial " << trial;
+    EXPECT_NEAR(m.depths[0], expected, 1e-8) << "trial " << trial;
+    EXPECT_NEAR(lm2_v3_length_f64(m.normal), 1.0, 1e-8);
+  }
+}
+
+TEST_F(Manifold3Test, WarmStartConvergesInFewIterations_F64) {
+  lm2_aabb3_f64 box = box_f64(0.0, 0.0, 0.0, 1.0, 1.0, 1.0);
+  lm2_triangle3_f64 tri;
+  lm2_triangle3_make_coords_f64(tri, 2.0, 1.5, 0.3, 3.0, 2.5, -0.2, 2.4, 1.8, 1.1);
+  lm2_gjk3_proxy_f64 pa = lm2_gjk3_proxy_from_shape_f64(lm2_shape3_from_aabb3_f64(&box));
+  lm2_gjk3_proxy_f64 pb = lm2_gjk3_proxy_from_shape_f64(lm2_shape3_from_triangle_f64(&tri));
+  lm2_gjk3_cache cache = {};
+  lm2_gjk3_result_f64 cold = lm2_gjk3_distance_f64(&pa, &pb, &cache);
+  EXPECT_GT(cache.count, 0);
+  for (int step = 1; step <= 10; ++step) {
+    for (int i = 0; i < 3; ++i) {
+      pb.vertices[i].x -= 0.01;
+    }
+    lm2_gjk3_result_f64 warm = lm2_gjk3_distance_f64(&pa, &pb, &cache);
+    lm2_gjk3_result_f64 fresh = lm2_gjk3_distance_f64(&pa, &pb, NULL);
+    EXPECT_LE(warm.iterations, 2) << "step " << step;
+    EXPECT_NEAR(warm.distance, fresh.distance, 1e-9);
+  }
+  EXPECT_GT(cold.iterations, 1);
+}
+
+TEST_F(Manifold3Test, ShapeDispatchFlipsSwappedPairs_F32) {
+  lm2_aabb3_f32 box = lm2_r3_from_scalars_f32(-1.0f, -1.0f, -1.0f, 1.0f, 1.0f, 1.0f);
+  lm2_sphere_f32 sphere = lm2_sphere_make_coords_f32(1.25f, 0.0f, 0.0f, 0.5f);
+  lm2_manifold3_f32 forward, swapped;
+  lm2_manifold3_shape_to_shape_f32(lm2_shape3_from_sphere_f32(&sphere), lm2_shape3_from_aabb3_f32(&box), NULL, &forward);
+  lm2_manifold3_shape_to_shape_f32(lm2_shape3_from_aabb3_f32(&box), lm2_shape3_from_sphere_f32(&sphere), NULL, &swapped);
+  ASSERT_EQ(forward.count, 1);
+  ASSERT_EQ(swapped.count, 1);
+  EXPECT_NEAR(swapped.depths[0], 0.25f, EPSILON_F32);
+  EXPECT_NEAR(swapped.normal.x, 1.0f, EPSILON_F32);
+  EXPECT_NEAR(forward.normal.x, -1.0f, EPSILON_F32);
+  // Contact points lie on B: the box face and the sphere surface
+  EXPECT_NEAR(forward.contact_points[0].x, 1.0f, EPSILON_F32);
+  EXPECT_NEAR(swapped.contact_points[0].x, 0.75f, EPSILON_F32);
+}
+
+TEST_F(Manifold3Test, CollideEdgeAndTriangle_F32) {
+  lm2_triangle3_f32 tri;
+  lm2_triangle3_make_coords_f32(tri, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f);
+  lm2_edge3_f32 edge = lm2_edge3_make_coords_f32(0.25f, 0.25f, -1.0f, 0.25f, 0.25f, 1.0f);
+  EXPECT_TRUE(lm2_collide3_shape_to_shape_f32(lm2_shape3_from_edge_f32(&edge), lm2_shape3_from_triangle_f32(&tri)));
+  edge = lm2_edge3_make_coords_f32(1.0f, 1.0f, -1.0f, 1.0f, 1.0f, 1.0f);
+  EXPECT_FALSE(lm2_collide3_shape_to_shape_f32(lm2_shape3_from_edge_f32(&edge), lm2_shape3_from_triangle_f32(&tri)));
+}
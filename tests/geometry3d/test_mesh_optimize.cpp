@@ -0,0 +1,264 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <array>
+#include <random>
+#include <vector>
+#include "lm2/geometry3d/lm2_mesh_optimize.h"
+#include "lm2/geometry3d/lm2_triangle3_geometry.h"
+
+// Test fixture for MeshOptimize tests
+class MeshOptimizeTest : public ::testing::Test {
+ protected:
+  static constexpr float EPSILON_F32 = 1e-5f;
+  static constexpr double EPSILON_F64 = 1e-10;
+
+  // Indexed n x n quad grid with its triangles in random order
+  static std::vector<uint32_t> shuffled_grid(uint32_t n, uint32_t seed) {
+    std::vector<std::array<uint32_t, 3>> triangles;
+    for (uint32_t y = 0; y < n; y++) {
+      for (uint32_t x = 0; x < n; x++) {
+        uint32_t a = y * (n + 1) + x;
+        uint32_t b = a + 1;
+        uint32_t c = b + n + 1;
+        uint32_t d = a + n + 1;
+        triangles.push_back({a, b, c});
+        triangles.push_back({a, c, d});
+      }
+    }
+    std::mt19937 rng(seed);
+    std::shuffle(triangles.begin(), triangles.end(), rng);
+    std::vector<uint32_t> indices;
+    for (const auto& t : triangles) {
+      indices.insert(indices.end(), t.begin(), t.end());
+    }
+    return indices;
+  }
+
+  static std::vector<std::array<uint32_t, 3>> sorted_triangles(const std::vector<uint32_t>& indices) {
+    std::vector<std::array<uint32_t, 3>> out;
+    for (size_t i = 0; i < indices.size(); i += 3) {
+      out.push_back({indices[i], indices[i + 1], indices[i + 2]});
+    }
+    std::sort(out.begin(), out.end());
+    return out;
+  }
+};
+
+// =============================================================================
+// Vertex Cache
+// =============================================================================
+
+TEST_F(MeshOptimizeTest, AnalyzeVertexCacheSingleTriangle) {
+  uint32_t indices[3] = {0, 1, 2};
+  lm2_mesh_vertex_cache_stats stats = lm2_mesh_analyze_vertex_cache(indices, 3, 3, 16);
+
+  EXPECT_EQ(stats.vertices_transformed, 3);
+  EXPECT_DOUBLE_EQ(stats.acmr, 3.0);
+  EXPECT_DOUBLE_EQ(stats.atvr, 1.0);
+}
+
+TEST_F(MeshOptimizeTest, AnalyzeVertexCacheEviction) {
+  // With 3 entries the fourth vertex evicts vertex 0, so it is transformed twice
+  uint32_t indices[6] = {0, 1, 2, 3, 0, 2};
+  lm2_mesh_vertex_cache_stats fifo3 = lm2_mesh_analyze_vertex_cache(indices, 6, 4, 3);
+  lm2_mesh_vertex_cache_stats fifo4 = lm2_mesh_analyze_vertex_cache(indices, 6, 4, 4);
+
+  EXPECT_EQ(fifo3.vertices_transformed, 5);
+  EXPECT_EQ(fifo4.vertices_transformed, 4);
+  EXPECT_DOUBLE_EQ(fifo4.atvr, 1.0);
+}
+
+TEST_F(MeshOptimizeTest, OptimizeVertexCacheKeepsTriangles) {
+  std::vector<uint32_t> indices = shuffled_grid(32, 1);
+  const size_t vertex_count = 33 * 33;
+  std::vector<uint32_t> optimized(indices.size());
+
+  lm2_mesh_optimize_vertex_cache(optimized.data(), indices.data(), indices.size(), vertex_count);
+
+  // Same triangles with the same winding, in a different order
+  EXPECT_EQ(sorted_triangles(optimized), sorted_triangles(indices));
+}
+
+TEST_F(MeshOptimizeTest, OptimizeVertexCacheLowersAcmr) {
+  std::vector<uint32_t> indices = shuffled_grid(64, 2);
+  const size_t vertex_count = 65 * 65;
+  lm2_mesh_vertex_cache_stats before = lm2_mesh_analyze_vertex_cache(indices.data(), indices.size(), vertex_count, 16);
+
+  lm2_mesh_optimize_vertex_cache(indices.data(), indices.data(), indices.size(), vertex_count);
+  lm2_mesh_vertex_cache_stats after16 = lm2_mesh_analyze_vertex_cache(indices.data(), indices.size(), vertex_count, 16);
+  lm2_mesh_vertex_cache_stats after32 = lm2_mesh_analyze_vertex_cache(indices.data(), indices.size(), vertex_count, 32);
+
+  // A shuffled grid transforms nearly every corner once per triangle; an
+  // optimized regular grid gets close to the 0.5 limit
+  EXPECT_GT(before.acmr, 2.5);
+  EXPECT_LT(after16.acmr, 0.8);
+  EXPECT_LT(after32.acmr, 0.7);
+  EXPECT_LT(after32.atvr, 1.4);
+}
+
+TEST_F(MeshOptimizeTest, OptimizeVertexCacheDegenerateTriangles) {
+  uint32_t indices[9] = {0, 0, 1, 1, 2, 3, 3, 3, 3};
+  uint32_t optimized[9];
+
+  lm2_mesh_optimize_vertex_cache(optimized, indices, 9, 4);
+
+  std::vector<uint32_t> a(indices, indices + 9);
+  std::vector<uint32_t> b(optimized, optimized + 9);
+  EXPECT_EQ(sorted_triangles(b), sorted_triangles(a));
+}
+
+// =============================================================================
+// Vertex Fetch
+// =============================================================================
+
+TEST_F(MeshOptimizeTest, VertexFetchRemapFirstUseOrder) {
+  uint32_t indices[6] = {3, 1, 4, 4, 1, 0};
+  uint32_t remap[6];
+
+  size_t used = lm2_mesh_vertex_fetch_remap(remap, indices, 6, 6);
+
+  EXPECT_EQ(used, 4);
+  EXPECT_EQ(remap[3], 0u);
+  EXPECT_EQ(remap[1], 1u);
+  EXPECT_EQ(remap[4], 2u);
+  EXPECT_EQ(remap[0], 3u);
+  EXPECT_EQ(remap[2], LM2_MESH_UNUSED_VERTEX);
+  EXPECT_EQ(remap[5], LM2_MESH_UNUSED_VERTEX);
+}
+
+TEST_F(MeshOptimizeTest, OptimizeVertexFetch3_F32) {
+  lm2_v3_f32 vertices[5] = {
+      lm2_v3_make_f32(0, 0, 0),
+      lm2_v3_make_f32(1, 0, 0),
+      lm2_v3_make_f32(9, 9, 9),  // Unused
+      lm2_v3_make_f32(1, 1, 0),
+      lm2_v3_make_f32(0, 1, 0),
+  };
+  uint32_t original[6] = {3, 4, 0, 3, 0, 1};
+  uint32_t indices[6];
+  std::copy(original, original + 6, indices);
+  lm2_v3_f32 optimized[5];
+
+  size_t count = lm2_mesh_optimize_vertex_fetch3_f32(optimized, indices, 6, vertices, 5);
+
+  ASSERT_EQ(count, 4);
+  uint32_t expected[6] = {0, 1, 2, 0, 2, 3};
+  for (int i = 0; i < 6; i++) {
+    EXPECT_EQ(indices[i], expected[i]);
+    EXPECT_FLOAT_EQ(optimized[indices[i]].x, vertices[original[i]].x);
+    EXPECT_FLOAT_EQ(optimized[indices[i]].y, vertices[original[i]].y);
+    EXPECT_FLOAT_EQ(optimized[indices[i]].z, vertices[original[i]].z);
+  }
+}
+
+TEST_F(MeshOptimizeTest, OptimizeVertexFetch2_F64) {
+  lm2_v2_f64 vertices[3] = {lm2_v2_make_f64(0, 0), lm2_v2_make_f64(1, 0), lm2_v2_make_f64(0, 1)};
+  uint32_t indices[3] = {2, 0, 1};
+  lm2_v2_f64 optimized[3];
+
+  size_t count = lm2_mesh_optimize_vertex_fetch2_f64(optimized, indices, 3, vertices, 3);
+
+  ASSERT_EQ(count, 3);
+  EXPECT_DOUBLE_EQ(optimized[0].y, 1.0);
+  EXPECT_DOUBLE_EQ(optimized[1].x, 0.0);
+  EXPECT_DOUBLE_EQ(optimized[2].x, 1.0);
+}
+
+TEST_F(MeshOptimizeTest, OptimizeVertexFetchLowersOverfetch) {
+  // Vertices numbered in a random order make every corner its own cache line
+  const uint32_t n = 64;
+  const size_t vertex_count = (n + 1) * (n + 1);
+  std::vector<uint32_t> indices = shuffled_grid(n, 3);
+  std::vector<uint32_t> shuffle(vertex_count);
+  for (uint32_t v = 0; v < vertex_count; v++) {
+    shuffle[v] = v;
+  }
+  std::shuffle(shuffle.begin(), shuffle.end(), std::mt19937(4));
+  lm2_mesh_remap_indices(indices.data(), indices.data(), indices.size(), shuffle.data());
+
+  std::vector<lm2_v3_f32> vertices(vertex_count);
+  for (uint32_t v = 0; v < vertex_count; v++) {
+    vertices[shuffle[v]] = lm2_v3_make_f32((float)(v % (n + 1)), (float)(v / (n + 1)), 0.0f);
+  }
+
+  lm2_mesh_optimize_vertex_cache(indices.data(), indices.data(), indices.size(), vertex_count);
+  lm2_mesh_vertex_fetch_stats before =
+      lm2_mesh_analyze_vertex_fetch(indices.data(), indices.size(), vertex_count, sizeof(lm2_v3_f32));
+
+  std::vector<lm2_v3_f32> optimized(vertex_count);
+  lm2_mesh_optimize_vertex_fetch3_f32(optimized.data(), indices.data(), indices.size(), vertices.data(), vertex_count);
+  lm2_mesh_vertex_fetch_stats after =
+      lm2_mesh_analyze_vertex_fetch(indices.data(), indices.size(), vertex_count, sizeof(lm2_v3_f32));
+
+  EXPECT_GT(before.overfetch, 2.0);
+  EXPECT_LT(after.overfetch, 1.5);
+  EXPECT_LT(after.bytes_fetched, before.bytes_fetched);
+}
+
+TEST_F(MeshOptimizeTest, OptimizesConvertedTriangleList) {
+  // Triangle soup -> welded indexed mesh -> cache and fetch order
+  const int n = 16;
+  std::vector<lm2_triangle3_f32> triangles(n * n * 2);
+  for (int y = 0; y < n; y++) {
+    for (int x = 0; x < n; x++) {
+      lm2_triangle3_f32* t = &triangles[(y * n + x) * 2];
+      lm2_triangle3_make_coords_f32(t[0], x, y, 0, x + 1, y, 0, x + 1, y + 1, 0);
+      lm2_triangle3_make_coords_f32(t[1], x, y, 0, x + 1, y + 1, 0, x, y + 1, 0);
+    }
+  }
+  lm2_indexed_mesh3_size size = lm2_triangle3_list_to_indexed_mesh_size_f32(triangles.data(), triangles.size(), 0.0f);
+  std::vector<lm2_v3_f32> vertices(size.vertex_count);
+  std::vector<uint32_t> indices(size.index_count);
+  lm2_triangle3_list_to_indexed_mesh_f32(
+      triangles.data(), triangles.size(), 0.0f, vertices.data(), vertices.size(), indices.data(), indices.size());
+
+  lm2_mesh_optimize_vertex_cache(indices.data(), indices.data(), indices.size(), vertices.size());
+  std::vector<lm2_v3_f32> optimized(vertices.size());
+  size_t count = lm2_mesh_optimize_vertex_fetch3_f32(
+      optimized.data(), indices.data(), indices.size(), vertices.data(), vertices.size());
+  ASSERT_EQ(count, vertices.size());
+
+  std::vector<lm2_triangle3_f32> result(triangles.size());
+  lm2_indexed_mesh_to_triangle3_list_f32(optimized.data(), count, indices.data(), indices.size(), result.data(), result.size());
+
+  // Every source triangle comes back once, with the same winding
+  auto key = [](const lm2_triangle3_f32& t) {
+    std::array<float, 9> k;
+    for (int v = 0; v < 3; v++) {
+      k[v * 3 + 0] = t[v].x, k[v * 3 + 1] = t[v].y, k[v * 3 + 2] = t[v].z;
+    }
+    return k;
+  };
+  std::vector<std::array<float, 9>> expected, actual;
+  for (size_t i = 0; i < triangles.size(); i++) {
+    expected.push_back(key(triangles[i]));
+    actual.push_back(key(result[i]));
+  }
+  std::sort(expected.begin(), expected.end());
+  std::sort(actual.begin(), actual.end());
+  EXPECT_EQ(actual, expected);
+}
@@ -0,0 +1,210 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+#include <vector>
+#include "lm2/geometry3d/lm2_ray3_packet.h"
+#include "lm2/geometry3d/lm2_raycast3.h"
+#include "lm2/vectors/lm2_vector_specifics.h"
+
+// Test fixture for ray packet tests
+class Ray3PacketTest : public ::testing::Test {
+ protected:
+  static constexpr float EPSILON_F32 = 1e-4f;
+  static constexpr double EPSILON_F64 = 1e-9;
+
+  // Rays from a box around the scene towards random points near the origin
+  static lm2_ray3_f64 random_ray_f64(std::mt19937& rng) {
+    std::uniform_real_distribution<double> far(-6.0, 6.0), near(-1.5, 1.5);
+    lm2_v3_f64 from = {far(rng), far(rng), far(rng)};
+    lm2_v3_f64 to = {near(rng), near(rng), near(rng)};
+    lm2_ray3_f64 ray = lm2_ray3_from_points_f64(from, to);
+    ray.t_max *= 2.0;
+    return ray;
+  }
+
+  static lm2_ray3_f32 random_ray_f32(std::mt19937& rng) {
+    lm2_ray3_f64 r = random_ray_f64(rng);
+    return lm2_ray3_make_f32(lm2_v3_make_f32((float)r.origin.x, (float)r.origin.y, (float)r.origin.z),
+                             lm2_v3_make_f32((float)r.direction.x, (float)r.direction.y, (float)r.direction.z), (float)r.t_max);
+  }
+};
+
+// =============================================================================
+// AABB
+// =============================================================================
+
+TEST_F(Ray3PacketTest, AabbMatchesSingleRay_F32) {
+  std::mt19937 rng(11);
+  std::uniform_real_distribution<float> lo(-1.5f, 0.0f), hi(0.0f, 1.5f);
+  for (int round = 0; round < 200; round++) {
+    lm2_ray3_packet8_f32 packet;
+    for (uint32_t k = 0; k < 8; k++) {
+      lm2_ray3_packet8_set_f32(&packet, k, random_ray_f32(rng));
+    }
+    lm2_ray3_packet4_f32 packet4;
+    for (uint32_t k = 0; k < 4; k++) {
+      lm2_ray3_packet4_set_f32(&packet4, k, lm2_ray3_packet8_get_f32(&packet, k));
+    }
+    lm2_v3_f32 box_min = {lo(rng), lo(rng), lo(rng)};
+    lm2_v3_f32 box_max = {hi(rng), hi(rng), hi(rng)};
+    lm2_r3_f32 box = lm2_r3_from_min_max_f32(box_min, box_max);
+
+    lm2_rayhit3_packet8_f32 hits = {};
+    uint32_t mask = lm2_raycast_packet8_aabb3_f32(&packet, 0xFFu, box, &hits);
+    lm2_rayhit3_packet4_f32 hits4 = {};
+    uint32_t mask4 = lm2_raycast_packet4_aabb3_f32(&packet4, 0xFu, box, &hits4);
+    EXPECT_EQ(mask, hits.hit_mask);
+    EXPECT_EQ(mask4, mask & 0xFu);
+    EXPECT_EQ(lm2_raycast_packet8_aabb3_f32(&packet, 0xFFu, box, NULL), mask);
+
+    for (uint32_t k = 0; k < 8; k++) {
+      lm2_ray3_f32 ray = lm2_ray3_packet8_get_f32(&packet, k);
+      lm2_rayhit3_f32 expected = lm2_raycast_aabb3_f32(ray, box);
+      lm2_rayhit3_f32 got = lm2_rayhit3_packet8_get_f32(&hits, &packet, k);
+      ASSERT_EQ(got.hit, expected.hit) << "round " << round << " lane " << k;
+      if (!got.hit) {
+        continue;
+      }
+      EXPECT_NEAR(got.t, expected.t, EPSILON_F32);
+      if (got.t == 0.0f) {
+        continue;  // Starts inside, no normal
+      }
+      // Axis-aligned unit normal facing the ray
+      EXPECT_NEAR(lm2_v3_length_f32(got.normal), 1.0f, EPSILON_F32);
+      EXPECT_LT(lm2_v3_dot_f32(got.normal, ray.direction), 0.0f);
+    }
+    for (uint32_t k = 0; k < 4; k++) {
+      if (mask4 & (1u << k)) {
+        EXPECT_EQ(hits4.t[k], hits.t[k]);
+      }
+    }
+  }
+}
+
+TEST_F(Ray3PacketTest, AabbAxisAlignedRays_F64) {
+  lm2_r3_f64 box = lm2_r3_from_min_max_f64(lm2_v3_make_f64(-1, -1, -1), lm2_v3_make_f64(1, 1, 1));
+  lm2_ray3_packet4_f64 packet;
+  // Direction components of exactly zero, inside and outside the other slabs
+  lm2_ray3_packet4_set_f64(&packet, 0, lm2_ray3_make_f64(lm2_v3_make_f64(-5.0, 0.5, 0.0), lm2_v3_make_f64(1.0, 0.0, 0.0), 100.0));
+  lm2_ray3_packet4_set_f64(&packet, 1, lm2_ray3_make_f64(lm2_v3_make_f64(-5.0, 1.5, 0.0), lm2_v3_make_f64(1.0, 0.0, 0.0), 100.0));
+  lm2_ray3_packet4_set_f64(&packet, 2, lm2_ray3_make_f64(lm2_v3_make_f64(0.0, 0.0, 4.0), lm2_v3_make_f64(0.0, 0.0, -1.0), 100.0));
+  // Starting inside: t = 0, zero normal
+  lm2_ray3_packet4_set_f64(&packet, 3, lm2_ray3_make_f64(lm2_v3_make_f64(0.2, 0.1, 0.0), lm2_v3_make_f64(0.0, 1.0, 0.0), 100.0));
+
+  lm2_rayhit3_packet4_f64 hits = {};
+  EXPECT_EQ(lm2_raycast_packet4_aabb3_f64(&packet, 0xFu, box, &hits), 0xDu);
+  EXPECT_NEAR(hits.t[0], 4.0, EPSILON_F64);
+  EXPECT_EQ(hits.normal_x[0], -1.0);
+  EXPECT_NEAR(hits.t[2], 3.0, EPSILON_F64);
+  EXPECT_EQ(hits.normal_z[2], 1.0);
+  EXPECT_EQ(hits.t[3], 0.0);
+  EXPECT_EQ(lm2_v3_length_f64(lm2_rayhit3_packet4_get_f64(&hits, &packet, 3).normal), 0.0);
+
+  // The box lies beyond a short ray
+  packet.t_max[0] = 3.5;
+  EXPECT_EQ(lm2_raycast_packet4_aabb3_f64(&packet, 0x1u, box, NULL), 0u);
+}
+
+// =============================================================================
+// Triangle
+// =============================================================================
+
+TEST_F(Ray3PacketTest, TriangleMatchesSingleRay_F64) {
+  std::mt19937 rng(5);
+  std::uniform_real_distribution<double> coord(-2.0, 2.0);
+  int hit_count = 0;
+  for (int round = 0; round < 300; round++) {
+    lm2_ray3_packet8_f64 packet;
+    lm2_ray3_packet4_f64 packet4;
+    for (uint32_t k = 0; k < 8; k++) {
+      lm2_ray3_f64 ray = random_ray_f64(rng);
+      lm2_ray3_packet8_set_f64(&packet, k, ray);
+      if (k < 4) {
+        lm2_ray3_packet4_set_f64(&packet4, k, ray);
+      }
+    }
+    lm2_v3_f64 v0 = {coord(rng), coord(rng), coord(rng)};
+    lm2_v3_f64 v1 = {coord(rng), coord(rng), coord(rng)};
+    lm2_v3_f64 v2 = {coord(rng), coord(rng), coord(rng)};
+
+    lm2_rayhit3_packet8_f64 hits = {};
+    uint32_t mask = lm2_raycast_packet8_triangle_f64(&packet, 0xFFu, v0, v1, v2, &hits);
+    lm2_rayhit3_packet4_f64 hits4 = {};
+    EXPECT_EQ(lm2_raycast_packet4_triangle_f64(&packet4, 0xFu, v0, v1, v2, &hits4), mask & 0xFu);
+    for (uint32_t k = 0; k < 8; k++) {
+      lm2_rayhit3_f64 expected = lm2_raycast_triangle_f64(lm2_ray3_packet8_get_f64(&packet, k), v0, v1, v2);
+      lm2_rayhit3_f64 got = lm2_rayhit3_packet8_get_f64(&hits, &packet, k);
+      ASSERT_EQ(got.hit, expected.hit) << "round " << round << " lane " << k;
+      if (got.hit) {
+        hit_count++;
+        EXPECT_NEAR(got.t, expected.t, EPSILON_F64);
+        EXPECT_NEAR(got.point.x, expected.point.x, EPSILON_F64);
+        EXPECT_NEAR(got.normal.x, expected.normal.x, EPSILON_F64);
+        EXPECT_NEAR(got.normal.y, expected.normal.y, EPSILON_F64);
+        EXPECT_NEAR(got.normal.z, expected.normal.z, EPSILON_F64);
+      }
+    }
+  }
+  EXPECT_GT(hit_count, 50);
+}
+
+TEST_F(Ray3PacketTest, TriangleKeepsClosestHit_F32) {
+  // Four parallel rays down -z through two stacked triangles
+  lm2_ray3_packet4_f32 packet;
+  for (uint32_t k = 0; k < 4; k++) {
+    lm2_ray3_packet4_set_f32(&packet, k, lm2_ray3_make_f32(lm2_v3_make_f32(0.1f * k, 0.1f, 10.0f), lm2_v3_make_f32(0.0f, 0.0f, -1.0f), 100.0f));
+  }
+  lm2_v3_f32 a0 = {-1.0f, -1.0f, 0.0f}, a1 = {2.0f, -1.0f, 0.0f}, a2 = {-1.0f, 2.0f, 0.0f};
+  lm2_v3_f32 b0 = {-1.0f, -1.0f, 5.0f}, b1 = {2.0f, -1.0f, 5.0f}, b2 = {-1.0f, 2.0f, 5.0f};
+
+  lm2_rayhit3_packet4_f32 hits = {};
+  EXPECT_EQ(lm2_raycast_packet4_triangle_f32(&packet, 0xFu, a0, a1, a2, &hits), 0xFu);
+  EXPECT_NEAR(hits.t[1], 10.0f, EPSILON_F32);
+  // The closer triangle replaces the hits, the farther one is no longer hit
+  EXPECT_EQ(lm2_raycast_packet4_triangle_f32(&packet, 0xFu, b0, b1, b2, &hits), 0xFu);
+  EXPECT_NEAR(hits.t[1], 5.0f, EPSILON_F32);
+  EXPECT_EQ(lm2_raycast_packet4_triangle_f32(&packet, 0xFu, a0, a1, a2, &hits), 0u);
+  EXPECT_NEAR(hits.t[1], 5.0f, EPSILON_F32);
+  EXPECT_EQ(hits.hit_mask, 0xFu);
+  EXPECT_NEAR(hits.normal_z[2], 1.0f, EPSILON_F32);
+}
+
+TEST_F(Ray3PacketTest, InactiveLanesNeverHit_F32) {
+  lm2_ray3_packet8_f32 packet;
+  for (uint32_t k = 0; k < 8; k++) {
+    lm2_ray3_packet8_set_f32(&packet, k, lm2_ray3_make_f32(lm2_v3_make_f32(0.0f, 0.0f, 5.0f), lm2_v3_make_f32(0.0f, 0.0f, -1.0f), 100.0f));
+  }
+  packet.t_max[1] = 0.0f;
+  packet.t_max[6] = -1.0f;
+  EXPECT_EQ(lm2_ray3_packet8_active_mask_f32(&packet), 0xBDu);
+
+  lm2_r3_f32 box = lm2_r3_from_min_max_f32(lm2_v3_make_f32(-1, -1, -1), lm2_v3_make_f32(1, 1, 1));
+  EXPECT_EQ(lm2_raycast_packet8_aabb3_f32(&packet, 0xFFu, box, NULL), 0xBDu);
+  EXPECT_EQ(lm2_raycast_packet8_aabb3_f32(&packet, 0x0Fu, box, NULL), 0x0Du);
+  EXPECT_EQ(lm2_raycast_packet8_triangle_f32(&packet, 0xF0u, lm2_v3_make_f32(-1, -1, 0), lm2_v3_make_f32(1, -1, 0), lm2_v3_make_f32(0, 1, 0), NULL), 0xB0u);
+  EXPECT_EQ(lm2_raycast_packet8_aabb3_f32(&packet, 0u, box, NULL), 0u);
+}
@@ -0,0 +1,271 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+#include <vector>
+#include "lm2/geometry3d/lm2_bvh3.h"
+#include "lm2/geometry3d/lm2_manifold3.h"
+#include "lm2/geometry3d/lm2_sweep3.h"
+#include "lm2/vectors/lm2_vector_specifics.h"
+
+// Test fixture for Sweep3 tests
+class Sweep3Test : public ::testing::Test {
+ protected:
+  static constexpr float EPSILON_F32 = 1e-5f;
+  static constexpr double EPSILON_F64 = 1e-10;
+};
+
+// Flat grid of (n x n) quads in the y = 0 plane, centered on the origin
+struct FloorMesh_F32 {
+  std::vector<lm2_v3_f32> vertices;
+  std::vector<uint32_t> indices;
+  std::vector<lm2_v3_f32> triangle_vertices;
+
+  FloorMesh_F32(uint32_t n, float cell) {
+    float half = (float)n * cell / 2.0f;
+    for (uint32_t z = 0; z <= n; z++) {
+      for (uint32_t x = 0; x <= n; x++) {
+        vertices.push_back(lm2_v3_make_f32((float)x * cell - half, 0.0f, (float)z * cell - half));
+      }
+    }
+    for (uint32_t z = 0; z < n; z++) {
+      for (uint32_t x = 0; x < n; x++) {
+        uint32_t i = z * (n + 1) + x;
+        uint32_t quad[6] = {i, i + n + 1, i + 1, i + 1, i + n + 1, i + n + 2};
+        indices.insert(indices.end(), quad, quad + 6);
+      }
+    }
+    for (uint32_t index : indices) {
+      triangle_vertices.push_back(vertices[index]);
+    }
+  }
+
+  const lm2_triangle3_f32* triangles() const { return reinterpret_cast<const lm2_triangle3_f32*>(triangle_vertices.data()); }
+  size_t triangle_count() const { return indices.size() / 3; }
+};
+
+// First t at which the capsule overlaps the triangle, by scanning then bisecting
+static double brute_force_toi_f64(lm2_capsule3_f64 capsule, lm2_v3_f64 delta, const lm2_triangle3_f64 tri) {
+  auto overlaps = [&](double t) {
+    lm2_capsule3_f64 moved = capsule;
+    moved.start = lm2_v3_add_f64(capsule.start, lm2_v3_mul_s_f64(delta, t));
+    moved.end = lm2_v3_add_f64(capsule.end, lm2_v3_mul_s_f64(delta, t));
+    lm2_manifold3_f64 m;
+    lm2_manifold3_capsule_to_triangle_f64(moved, tri, &m);
+    return m.count > 0;
+  };
+  const int steps = 4000;
+  for (int i = 1; i <= steps; i++) {
+    double hi = (double)i / steps;
+    if (overlaps(hi)) {
+      double lo = (double)(i - 1) / steps;
+      for (int k = 0; k < 60; k++) {
+        double mid = (lo + hi) / 2;
+        (overlaps(mid) ? hi : lo) = mid;
+      }
+      return hi;
+    }
+  }
+  return 2.0;
+}
+
+// =============================================================================
+// Single Triangle
+// =============================================================================
+
+TEST_F(Sweep3Test, SphereHitsFace_F32) {
+  lm2_sphere_f32 sphere = {{0.2f, 2.0f, 0.1f}, 0.5f};
+  lm2_sweep3_hit_f32 hit = lm2_sweep3_sphere_triangle_f32(sphere, {0.0f, -4.0f, 0.0f}, {-1.0f, 0.0f, -1.0f}, {0.0f, 0.0f, 1.0f},
+                                                          {1.0f, 0.0f, -1.0f});
+  ASSERT_TRUE(hit.hit);
+  EXPECT_NEAR(hit.t, 0.375f, EPSILON_F32);
+  EXPECT_EQ(hit.feature, LM2_SWEEP3_FEATURE_FACE);
+  EXPECT_NEAR(hit.normal.y, 1.0f, EPSILON_F32);
+  EXPECT_NEAR(hit.point.x, 0.2f, EPSILON_F32);
+  EXPECT_NEAR(hit.point.y, 0.0f, EPSILON_F32);
+  EXPECT_NEAR(hit.point.z, 0.1f, EPSILON_F32);
+}
+
+TEST_F(Sweep3Test, SphereHitsEdgeAndVertex_F64) {
+  lm2_v3_f64 v0 = {0.0, 0.0, 0.0}, v1 = {2.0, 0.0, 0.0}, v2 = {0.0, 0.0, 2.0};
+
+  // Moving along -z towards the edge v0 v1, passing beside the triangle plane
+  lm2_sphere_f64 sphere = {{1.0, 0.3, -3.0}, 0.5};
+  lm2_sweep3_hit_f64 edge = lm2_sweep3_sphere_triangle_f64(sphere, {0.0, 0.0, 4.0}, v0, v1, v2);
+  ASSERT_TRUE(edge.hit);
+  EXPECT_EQ(edge.feature, LM2_SWEEP3_FEATURE_EDGE);
+  EXPECT_EQ(edge.feature_index, 0u);
+  EXPECT_NEAR(edge.t, (3.0 - std::sqrt(0.25 - 0.09)) / 4.0, 1e-12);
+  EXPECT_NEAR(edge.point.x, 1.0, 1e-12);
+  EXPECT_NEAR(edge.normal.y, 0.6, 1e-12);
+
+  // Head-on into the corner v1
+  lm2_sphere_f64 corner = {{5.0, 0.0, -0.5}, 0.5};
+  lm2_sweep3_hit_f64 vertex = lm2_sweep3_sphere_triangle_f64(corner, {-4.0, 0.0, 0.0}, v0, v1, v2);
+  ASSERT_TRUE(vertex.hit);
+  EXPECT_EQ(vertex.feature, LM2_SWEEP3_FEATURE_VERTEX);
+  EXPECT_EQ(vertex.feature_index, 1u);
+  EXPECT_NEAR(vertex.t, 0.75, 1e-12);
+  EXPECT_NEAR(vertex.normal.x, 0.0, 1e-12);
+  EXPECT_NEAR(vertex.normal.z, -1.0, 1e-12);
+}
+
+TEST_F(Sweep3Test, CapsuleAxisHitsEdge_F64) {
+  // Vertical triangle in the z = 0 plane with its top edge along x; the capsule
+  // lies along z above it, so only the axis can touch the edge
+  lm2_capsule3_f64 capsule = {{0.0, 2.0, -1.0}, {0.0, 2.0, 1.0}, 0.5};
+  lm2_sweep3_hit_f64 hit = lm2_sweep3_capsule_triangle_f64(capsule, {0.0, -4.0, 0.0}, {-1.0, 0.0, 0.0}, {1.0, 0.0, 0.0}, {0.0, -2.0, 0.0});
+  ASSERT_TRUE(hit.hit);
+  EXPECT_NEAR(hit.t, 0.375, 1e-12);
+  EXPECT_EQ(hit.feature, LM2_SWEEP3_FEATURE_EDGE);
+  EXPECT_EQ(hit.feature_index, 0u);
+  EXPECT_NEAR(hit.point.x, 0.0, 1e-12);
+  EXPECT_NEAR(hit.point.y, 0.0, 1e-12);
+  EXPECT_NEAR(hit.normal.y, 1.0, 1e-12);
+}
+
+TEST_F(Sweep3Test, TriangleVertexHitsCapsuleSide_F64) {
+  // Upright capsule moving along +x into a triangle pointing at its middle
+  lm2_capsule3_f64 capsule = {{0.0, -2.0, 0.0}, {0.0, 2.0, 0.0}, 0.5};
+  lm2_sweep3_hit_f64 hit = lm2_sweep3_capsule_triangle_f64(capsule, {4.0, 0.0, 0.0}, {2.5, 0.0, 0.0}, {5.0, 0.5, 0.0}, {5.0, -0.5, 0.0});
+  ASSERT_TRUE(hit.hit);
+  EXPECT_NEAR(hit.t, 0.5, 1e-12);
+  EXPECT_EQ(hit.feature, LM2_SWEEP3_FEATURE_VERTEX);
+  EXPECT_EQ(hit.feature_index, 0u);
+  EXPECT_NEAR(hit.normal.x, -1.0, 1e-12);
+}
+
+TEST_F(Sweep3Test, InitialOverlapOnlyBlocksMotionInwards_F32) {
+  lm2_v3_f32 v0 = {-1.0f, 0.0f, -1.0f}, v1 = {0.0f, 0.0f, 1.0f}, v2 = {1.0f, 0.0f, -1.0f};
+  lm2_sphere_f32 sphere = {{0.0f, 0.4f, 0.0f}, 0.5f};
+
+  lm2_sweep3_hit_f32 down = lm2_sweep3_sphere_triangle_f32(sphere, {0.0f, -1.0f, 0.0f}, v0, v1, v2);
+  ASSERT_TRUE(down.hit);
+  EXPECT_EQ(down.t, 0.0f);
+  EXPECT_NEAR(down.normal.y, 1.0f, EPSILON_F32);
+
+  EXPECT_FALSE(lm2_sweep3_sphere_triangle_f32(sphere, {0.0f, 1.0f, 0.0f}, v0, v1, v2).hit);
+  EXPECT_FALSE(lm2_sweep3_sphere_triangle_f32(sphere, {3.0f, 0.0f, 0.0f}, v0, v1, v2).hit);
+}
+
+TEST_F(Sweep3Test, CapsuleMatchesBruteForce_F64) {
+  std::mt19937 rng(11);
+  std::uniform_real_distribution<double> pos(-2.0, 2.0);
+  std::uniform_real_distribution<double> radius(0.1, 0.6);
+  int hits = 0;
+  for (int i = 0; i < 300; i++) {
+    lm2_triangle3_f64 tri;
+    for (int k = 0; k < 3; k++) {
+      tri[k] = {pos(rng), pos(rng), pos(rng)};
+    }
+    lm2_capsule3_f64 capsule = {{pos(rng) + 6.0, pos(rng), pos(rng)}, {pos(rng) + 6.0, pos(rng), pos(rng)}, radius(rng)};
+    lm2_v3_f64 delta = {-10.0 + pos(rng), pos(rng), pos(rng)};
+    double expected = brute_force_toi_f64(capsule, delta, tri);
+    lm2_sweep3_hit_f64 hit = lm2_sweep3_capsule_triangle_f64(capsule, delta, tri[0], tri[1], tri[2]);
+    ASSERT_EQ(hit.hit, expected <= 1.0) << "case " << i;
+    if (hit.hit) {
+      hits++;
+      EXPECT_NEAR(hit.t, expected, 1e-6) << "case " << i;
+      EXPECT_NEAR(lm2_v3_length_f64(hit.normal), 1.0, 1e-9) << "case " << i;
+      EXPECT_LT(lm2_v3_dot_f64(hit.normal, delta), 0.0) << "case " << i;
+    }
+  }
+  EXPECT_GT(hits, 50);
+}
+
+// =============================================================================
+// Meshes
+// =============================================================================
+
+TEST_F(Sweep3Test, MeshQueriesAgree_F32) {
+  FloorMesh_F32 floor(16, 1.0f);
+  std::vector<lm2_bvh3_node_f32> nodes(lm2_bvh3_node_buffer_size_f32(floor.triangle_count()));
+  std::vector<uint32_t> prims(lm2_bvh3_index_buffer_size_f32(floor.triangle_count()));
+  lm2_bvh3_f32 bvh = lm2_bvh3_build_indexed_f32(floor.vertices.data(), floor.vertices.size(), floor.indices.data(), floor.indices.size(),
+                                                 nodes.data(), nodes.size(), prims.data(), prims.size());
+
+  std::mt19937 rng(3);
+  std::uniform_real_distribution<float> pos(-7.0f, 7.0f);
+  std::uniform_real_distribution<float> height(0.5f, 3.0f);
+  for (int i = 0; i < 200; i++) {
+    lm2_v3_f32 base = {pos(rng), height(rng), pos(rng)};
+    lm2_capsule3_f32 capsule = {base, {base.x, base.y + 1.0f, base.z}, 0.4f};
+    lm2_v3_f32 delta = {pos(rng) * 0.2f, -height(rng) * 1.5f, pos(rng) * 0.2f};
+
+    lm2_sweep3_hit_f32 list = lm2_sweep3_capsule_triangles_f32(capsule, delta, floor.triangles(), floor.triangle_count());
+    lm2_sweep3_hit_f32 indexed = lm2_sweep3_capsule_indexed_f32(capsule, delta, floor.vertices.data(), floor.indices.data(), floor.indices.size());
+    lm2_sweep3_hit_f32 tree = lm2_sweep3_capsule_bvh_f32(&bvh, capsule, delta);
+    ASSERT_EQ(list.hit, indexed.hit);
+    ASSERT_EQ(list.hit, tree.hit);
+    EXPECT_EQ(list.t, indexed.t);
+    EXPECT_EQ(list.triangle_index, indexed.triangle_index);
+    EXPECT_EQ(list.t, tree.t);
+    if (list.hit) {
+      EXPECT_NEAR(list.t, (base.y - 0.4f) / -delta.y, 1e-5f);
+      EXPECT_NEAR(tree.normal.y, 1.0f, EPSILON_F32);
+    }
+
+    lm2_sphere_f32 sphere = {base, 0.4f};
+    lm2_sweep3_hit_f32 sphere_list = lm2_sweep3_sphere_triangles_f32(sphere, delta, floor.triangles(), floor.triangle_count());
+    lm2_sweep3_hit_f32 sphere_tree = lm2_sweep3_sphere_bvh_f32(&bvh, sphere, delta);
+    ASSERT_EQ(sphere_list.hit, sphere_tree.hit);
+    EXPECT_EQ(sphere_list.t, sphere_tree.t);
+  }
+}
+
+TEST_F(Sweep3Test, SlideAlongFloorAndIntoCrease_F32) {
+  FloorMesh_F32 floor(8, 1.0f);
+  // Wall in the x = 2 plane facing -x
+  lm2_v3_f32 wall_vertices[4] = {{2.0f, -1.0f, -4.0f}, {2.0f, -1.0f, 4.0f}, {2.0f, 4.0f, -4.0f}, {2.0f, 4.0f, 4.0f}};
+  uint32_t base = (uint32_t)floor.vertices.size();
+  floor.vertices.insert(floor.vertices.end(), wall_vertices, wall_vertices + 4);
+  uint32_t wall_indices[6] = {base, base + 1, base + 2, base + 2, base + 1, base + 3};
+  floor.indices.insert(floor.indices.end(), wall_indices, wall_indices + 6);
+  std::vector<lm2_bvh3_node_f32> nodes(lm2_bvh3_node_buffer_size_f32(floor.indices.size() / 3));
+  std::vector<uint32_t> prims(lm2_bvh3_index_buffer_size_f32(floor.indices.size() / 3));
+  lm2_bvh3_f32 bvh = lm2_bvh3_build_indexed_f32(floor.vertices.data(), floor.vertices.size(), floor.indices.data(), floor.indices.size(),
+                                                 nodes.data(), nodes.size(), prims.data(), prims.size());
+
+  const float skin = 0.01f;
+  lm2_capsule3_f32 capsule = {{0.0f, 0.6f, 0.0f}, {0.0f, 1.6f, 0.0f}, 0.5f};
+  lm2_sweep3_hit_f32 hits[4];
+  int hit_count = 0;
+
+  // Falling forward along z: lands on the floor and keeps the whole z motion
+  lm2_v3_f32 moved = lm2_sweep3_slide_capsule_f32(&bvh, capsule, {0.0f, -1.0f, 1.0f}, skin, 4, hits, &hit_count);
+  ASSERT_GE(hit_count, 1);
+  EXPECT_NEAR(hits[0].normal.y, 1.0f, EPSILON_F32);
+  EXPECT_NEAR(moved.z, 1.0f, 2e-2f);
+  EXPECT_GT(capsule.start.y + moved.y, 0.5f);
+  EXPECT_NEAR(capsule.start.y + moved.y, 0.5f, 2e-2f);
+
+  // Pushed down and into the wall: slides along the floor-wall crease
+  lm2_v3_f32 crease = lm2_sweep3_slide_capsule_f32(&bvh, capsule, {3.0f, -1.0f, 1.0f}, skin, 4, hits, &hit_count);
+  EXPECT_GE(hit_count, 2);
+  EXPECT_LT(capsule.start.x + crease.x, 1.5f);
+  EXPECT_GT(capsule.start.y + crease.y, 0.5f);
+  EXPECT_NEAR(crease.z, 1.0f, 5e-2f);
+}
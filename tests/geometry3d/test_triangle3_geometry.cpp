@@ -399,3 +399,222 @@ TEST_F(Triangle3GeometryTest, NoSharedVertices_F64) {
   EXPECT_EQ(size.vertex_count, 6);  // No sharing = 6 unique vertices
   EXPECT_EQ(size.index_count, 6);
 }
+
+// =============================================================================
+// Vertex Welding
+// =============================================================================
+
+namespace {
+
+// Reference weld: linear search for the first unique vertex within epsilon
+template <typename V, typename T>
+std::vector<uint32_t> reference_weld3(const std::vector<V>& points, T epsilon, std::vector<V>& unique) {
+  std::vector<uint32_t> remap;
+  for (const V& p : points) {
+    uint32_t found = (uint32_t)unique.size();
+    for (uint32_t k = 0; k < unique.size(); k++) {
+      if (std::fabs(unique[k].x - p.x) <= epsilon && std::fabs(unique[k].y - p.y) <= epsilon &&
+          std::fabs(unique[k].z - p.z) <= epsilon) {
+        found = k;
+        break;
+      }
+    }
+    if (found == unique.size()) {
+      unique.push_back(p);
+    }
+    remap.push_back(found);
+  }
+  return remap;
+}
+
+// Triangles of an n x n grid whose corners are jittered by up to jitter per axis
+std::vector<lm2_triangle3_f64> jittered_grid3_f64(size_t n, double jitter, uint32_t seed) {
+  auto corner = [&](size_t x, size_t y) {
+    uint32_t h = seed;
+    auto next = [&h]() {
+      h = h * 1664525u + 1013904223u;
+      return (double)(h >> 8) / 16777216.0 * 2.0 - 1.0;
+    };
+    h += (uint32_t)(x * 73856093u) ^ (uint32_t)(y * 19349663u);
+    next();
+    return lm2_v3_make_f64((double)x + next() * jitter, (double)y + next() * jitter, next() * jitter);
+  };
+  std::vector<lm2_triangle3_f64> out(n * n * 2);
+  for (size_t y = 0; y < n; y++) {
+    for (size_t x = 0; x < n; x++) {
+      lm2_triangle3_f64* t = &out[(y * n + x) * 2];
+      t[0][0] = corner(x, y), t[0][1] = corner(x + 1, y), t[0][2] = corner(x + 1, y + 1);
+      t[1][0] = corner(x, y), t[1][1] = corner(x + 1, y + 1), t[1][2] = corner(x, y + 1);
+    }
+  }
+  return out;
+}
+
+}  // namespace
+
+TEST_F(Triangle3GeometryTest, IndexedMeshClosedBox_F64) {
+  // 12 triangles over 8 corners: fewer unique vertices than triangles
+  lm2_v3_f64 c[8];
+  for (int i = 0; i < 8; i++) {
+    c[i] = lm2_v3_make_f64(i & 1, (i >> 1) & 1, (i >> 2) & 1);
+  }
+  const int faces[12][3] = {
+      {0, 2, 1}, {1, 2, 3}, {4, 5, 6}, {5, 7, 6}, {0, 1, 4}, {1, 5, 4},
+      {2, 6, 3}, {3, 6, 7}, {0, 4, 2}, {2, 4, 6}, {1, 3, 5}, {3, 7, 5}
+  };
+  lm2_triangle3_f64 triangles[12];
+  for (int t = 0; t < 12; t++) {
+    for (int k = 0; k < 3; k++) {
+      triangles[t][k] = c[faces[t][k]];
+    }
+  }
+
+  lm2_indexed_mesh3_size size = lm2_triangle3_list_to_indexed_mesh_size_f64(triangles, 12, 0.0);
+  ASSERT_EQ(size.vertex_count, 8);
+
+  std::vector<lm2_v3_f64> vertices(size.vertex_count);
+  std::vector<uint32_t> indices(size.index_count);
+  lm2_triangle3_list_to_indexed_mesh_f64(
+      triangles, 12, 0.0, vertices.data(), vertices.size(), indices.data(), indices.size());
+
+  for (int t = 0; t < 12; t++) {
+    for (int k = 0; k < 3; k++) {
+      uint32_t index = indices[t * 3 + k];
+      ASSERT_LT(index, 8u);
+      EXPECT_EQ(vertices[index].x, c[faces[t][k]].x);
+      EXPECT_EQ(vertices[index].y, c[faces[t][k]].y);
+      EXPECT_EQ(vertices[index].z, c[faces[t][k]].z);
+    }
+  }
+}
+
+TEST_F(Triangle3GeometryTest, IndexedMeshSignedZero_F64) {
+  lm2_triangle3_f64 triangles[2];
+  lm2_triangle3_make_coords_f64(triangles[0], 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0, 0.0);
+  lm2_triangle3_make_coords_f64(triangles[1], -0.0, -0.0, 0.0, 1.0, -0.0, 0.0, 0.0, 1.0, -0.0);
+
+  EXPECT_EQ(lm2_triangle3_list_to_indexed_mesh_size_f64(triangles, 2, 0.0).vertex_count, 3);
+}
+
+TEST_F(Triangle3GeometryTest, IndexedMeshMatchesLinearSearch_F64) {
+  // Jitter close to epsilon makes chains where the first match matters
+  const double epsilon = 0.01;
+  for (double jitter : {0.0, 0.004, 0.008, 0.02}) {
+    auto triangles = jittered_grid3_f64(24, jitter, 7);
+    std::vector<lm2_v3_f64> points;
+    for (const auto& t : triangles) {
+      points.insert(points.end(), t, t + 3);
+    }
+    std::vector<lm2_v3_f64> expected_vertices;
+    std::vector<uint32_t> expected_indices = reference_weld3(points, epsilon, expected_vertices);
+
+    lm2_indexed_mesh3_size size = lm2_triangle3_list_to_indexed_mesh_size_f64(triangles.data(), triangles.size(), epsilon);
+    ASSERT_EQ(size.vertex_count, expected_vertices.size());
+
+    std::vector<lm2_v3_f64> vertices(size.vertex_count);
+    std::vector<uint32_t> indices(size.index_count);
+    lm2_triangle3_list_to_indexed_mesh_f64(
+        triangles.data(), triangles.size(), epsilon, vertices.data(), vertices.size(), indices.data(), indices.size());
+
+    EXPECT_EQ(indices, expected_indices);
+    for (size_t k = 0; k < vertices.size(); k++) {
+      EXPECT_EQ(vertices[k].x, expected_vertices[k].x);
+      EXPECT_EQ(vertices[k].y, expected_vertices[k].y);
+      EXPECT_EQ(vertices[k].z, expected_vertices[k].z);
+    }
+  }
+}
+
+TEST_F(Triangle3GeometryTest, IndexedMeshMatchesLinearSearch_F32) {
+  const float epsilon = 0.01f;
+  auto source = jittered_grid3_f64(24, 0.008, 11);
+  std::vector<lm2_triangle3_f32> triangles(source.size());
+  std::vector<lm2_v3_f32> points;
+  for (size_t t = 0; t < source.size(); t++) {
+    for (int k = 0; k < 3; k++) {
+      triangles[t][k] = lm2_v3_make_f32((float)source[t][k].x, (float)source[t][k].y, (float)source[t][k].z);
+      points.push_back(triangles[t][k]);
+    }
+  }
+  std::vector<lm2_v3_f32> expected_vertices;
+  std::vector<uint32_t> expected_indices = reference_weld3(points, epsilon, expected_vertices);
+
+  std::vector<lm2_v3_f32> vertices(expected_vertices.size());
+  std::vector<uint32_t> indices(points.size());
+  lm2_triangle3_list_to_indexed_mesh_f32(
+      triangles.data(), triangles.size(), epsilon, vertices.data(), vertices.size(), indices.data(), indices.size());
+
+  EXPECT_EQ(indices, expected_indices);
+}
+
+TEST_F(Triangle3GeometryTest, IndexedMeshFarFromOriginWithSmallEpsilon) {
+  // Rounding slack at these magnitudes exceeds epsilon by orders of magnitude
+  auto source = jittered_grid3_f64(16, 0.0, 5);
+  std::vector<lm2_triangle3_f64> triangles64(source.size());
+  std::vector<lm2_triangle3_f32> triangles32(source.size());
+  std::vector<lm2_v3_f64> points64;
+  std::vector<lm2_v3_f32> points32;
+  for (size_t t = 0; t < source.size(); t++) {
+    for (int k = 0; k < 3; k++) {
+      lm2_v3_f64 p = source[t][k];
+      triangles64[t][k] = lm2_v3_make_f64(p.x * 0.5 + 1.0e9, p.y * 0.5 - 1.0e9, p.z + 1.0e9);
+      triangles32[t][k] = lm2_v3_make_f32((float)p.x * 8.0f + 1.0e5f, (float)p.y * 8.0f - 1.0e5f, 1.0e5f);
+      points64.push_back(triangles64[t][k]);
+      points32.push_back(triangles32[t][k]);
+    }
+  }
+
+  std::vector<lm2_v3_f64> expected64;
+  std::vector<uint32_t> expected_indices64 = reference_weld3(points64, 1.0e-9, expected64);
+  std::vector<lm2_v3_f64> vertices64(expected64.size());
+  std::vector<uint32_t> indices64(points64.size());
+  lm2_triangle3_list_to_indexed_mesh_f64(
+      triangles64.data(), triangles64.size(), 1.0e-9, vertices64.data(), vertices64.size(), indices64.data(), indices64.size());
+  EXPECT_EQ(expected64.size(), 17u * 17u);
+  EXPECT_EQ(indices64, expected_indices64);
+
+  std::vector<lm2_v3_f32> expected32;
+  std::vector<uint32_t> expected_indices32 = reference_weld3(points32, 1.0e-5f, expected32);
+  std::vector<lm2_v3_f32> vertices32(expected32.size());
+  std::vector<uint32_t> indices32(points32.size());
+  lm2_triangle3_list_to_indexed_mesh_f32(
+      triangles32.data(), triangles32.size(), 1.0e-5f, vertices32.data(), vertices32.size(), indices32.data(), indices32.size());
+  EXPECT_EQ(expected32.size(), 17u * 17u);
+  EXPECT_EQ(indices32, expected_indices32);
+}
+
+TEST_F(Triangle3GeometryTest, IndexedMeshParallelMatchesSerial_F64) {
+  // Large enough for several threads
+  for (double epsilon : {0.0, 0.01}) {
+    auto triangles = jittered_grid3_f64(128, 0.008, 3);
+    lm2_indexed_mesh3_size size = lm2_triangle3_list_to_indexed_mesh_size_f64(triangles.data(), triangles.size(), epsilon);
+    lm2_indexed_mesh3_size parallel_size =
+        lm2_triangle3_list_to_indexed_mesh_size_parallel_f64(triangles.data(), triangles.size(), epsilon, 4);
+    ASSERT_EQ(parallel_size.vertex_count, size.vertex_count);
+    ASSERT_EQ(parallel_size.index_count, size.index_count);
+
+    std::vector<lm2_v3_f64> vertices(size.vertex_count);
+    std::vector<uint32_t> indices(size.index_count);
+    lm2_triangle3_list_to_indexed_mesh_f64(
+        triangles.data(), triangles.size(), epsilon, vertices.data(), vertices.size(), indices.data(), indices.size());
+
+    std::vector<lm2_v3_f64> parallel_vertices(size.vertex_count);
+    std::vector<uint32_t> parallel_indices(size.index_count);
+    lm2_triangle3_list_to_indexed_mesh_parallel_f64(
+        triangles.data(),
+        triangles.size(),
+        epsilon,
+        parallel_vertices.data(),
+        parallel_vertices.size(),
+        parallel_indices.data(),
+        parallel_indices.size(),
+        4);
+
+    EXPECT_EQ(parallel_indices, indices);
+    for (size_t k = 0; k < vertices.size(); k++) {
+      EXPECT_EQ(parallel_vertices[k].x, vertices[k].x);
+      EXPECT_EQ(parallel_vertices[k].y, vertices[k].y);
+      EXPECT_EQ(parallel_vertices[k].z, vertices[k].z);
+    }
+  }
+}
@@ -0,0 +1,147 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+// Compile the hot modules as static inline in this translation unit only
+#ifndef LM2_INLINE_IMPLEMENTATION
+#  define LM2_INLINE_IMPLEMENTATION
+#endif
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include "lm2/lm2_constants.h"
+#include "lm2/matrices/lm2_matrix3x2.h"
+#include "lm2/matrices/lm2_matrix3x3.h"
+#include "lm2/matrices/lm2_matrix4x4.h"
+#include "lm2/misc/lm2_quaternion.h"
+#include "lm2/scalar/lm2_safe_ops.h"
+#include "lm2/scalar/lm2_scalar.h"
+#include "lm2/vectors/lm2_vector2.h"
+#include "lm2/vectors/lm2_vector3.h"
+#include "lm2/vectors/lm2_vector4.h"
+#include "lm2/vectors/lm2_vector_specifics.h"
+
+// Test fixture for inline implementation tests
+class InlineTest : public ::testing::Test {
+ protected:
+  static constexpr float EPSILON_F32 = 1e-5f;
+  static constexpr double EPSILON_F64 = 1e-10;
+};
+
+// =============================================================================
+// Scalar and Safe Ops Tests
+// =============================================================================
+
+TEST_F(InlineTest, SafeOps_F32) {
+  EXPECT_FLOAT_EQ(lm2_add_f32(1.5f, 2.0f), 3.5f);
+  EXPECT_FLOAT_EQ(lm2_sub_f32(1.5f, 2.0f), -0.5f);
+  EXPECT_FLOAT_EQ(lm2_mul_f32(1.5f, 2.0f), 3.0f);
+  EXPECT_FLOAT_EQ(lm2_div_f32(1.5f, 2.0f), 0.75f);
+}
+
+TEST_F(InlineTest, SafeOps_I32) {
+  EXPECT_EQ(lm2_add_i32(7, -3), 4);
+  EXPECT_EQ(lm2_mul_i32(7, -3), -21);
+  EXPECT_EQ(lm2_div_i32(7, 2), 3);
+  EXPECT_EQ(lm2_mod_i32(7, 2), 1);
+}
+
+TEST_F(InlineTest, Scalar_F64) {
+  EXPECT_DOUBLE_EQ(lm2_clamp_f64(0.0, 2.5, 1.0), 1.0);
+  EXPECT_DOUBLE_EQ(lm2_lerp_f64(2.0, 0.5, 4.0), 3.0);
+  EXPECT_DOUBLE_EQ(lm2_floor_f64(-1.5), -2.0);
+  EXPECT_DOUBLE_EQ(lm2_sqrt_f64(16.0), 4.0);
+}
+
+// =============================================================================
+// Vector Tests
+// =============================================================================
+
+TEST_F(InlineTest, Vector3_F32) {
+  lm2_v3_f32 a = lm2_v3_make_f32(1.0f, 2.0f, 3.0f);
+  lm2_v3_f32 b = lm2_v3_make_f32(4.0f, 5.0f, 6.0f);
+
+  lm2_v3_f32 sum = lm2_v3_add_f32(a, b);
+  EXPECT_FLOAT_EQ(sum.x, 5.0f);
+  EXPECT_FLOAT_EQ(sum.y, 7.0f);
+  EXPECT_FLOAT_EQ(sum.z, 9.0f);
+
+  EXPECT_FLOAT_EQ(lm2_v3_dot_f32(a, b), 32.0f);
+
+  lm2_v3_f32 cross = lm2_v3_cross_f32(a, b);
+  EXPECT_FLOAT_EQ(cross.x, -3.0f);
+  EXPECT_FLOAT_EQ(cross.y, 6.0f);
+  EXPECT_FLOAT_EQ(cross.z, -3.0f);
+
+  EXPECT_NEAR(lm2_v3_length_f32(lm2_v3_norm_f32(b)), 1.0f, EPSILON_F32);
+}
+
+TEST_F(InlineTest, Vector2And4_I32) {
+  lm2_v2_i32 a = lm2_v2_make_i32(3, -4);
+  lm2_v2_i32 abs_a = lm2_v2_abs_i32(a);
+  EXPECT_EQ(abs_a.x, 3);
+  EXPECT_EQ(abs_a.y, 4);
+
+  lm2_v4_i32 b = lm2_v4_mul_s_i32(lm2_v4_make_i32(1, 2, 3, 4), 2);
+  EXPECT_EQ(b.x, 2);
+  EXPECT_EQ(b.w, 8);
+}
+
+// =============================================================================
+// Quaternion and Matrix Tests
+// =============================================================================
+
+TEST_F(InlineTest, QuaternionRotate_F64) {
+  lm2_quat_f64 q = lm2_quat_from_axis_angle_f64(lm2_v3_make_f64(0.0, 0.0, 1.0), LM2_PI_F64 / 2.0);
+  lm2_v3_f64 v = lm2_quat_rotate_vector_f64(q, lm2_v3_make_f64(1.0, 0.0, 0.0));
+  EXPECT_NEAR(v.x, 0.0, EPSILON_F64);
+  EXPECT_NEAR(v.y, 1.0, EPSILON_F64);
+  EXPECT_NEAR(v.z, 0.0, EPSILON_F64);
+}
+
+TEST_F(InlineTest, Matrix4x4MulAndTransform_F32) {
+  lm2_m4x4_f32 t = lm2_m4x4_translate_f32(lm2_v3_make_f32(1.0f, 2.0f, 3.0f));
+  lm2_m4x4_f32 s = lm2_m4x4_scale_uniform_f32(2.0f);
+  lm2_m4x4_f32 m = lm2_m4x4_mul_f32(t, s);
+
+  lm2_v3_f32 p = lm2_m4x4_transform_point_f32(m, lm2_v3_make_f32(1.0f, 1.0f, 1.0f));
+  EXPECT_FLOAT_EQ(p.x, 3.0f);
+  EXPECT_FLOAT_EQ(p.y, 4.0f);
+  EXPECT_FLOAT_EQ(p.z, 5.0f);
+
+  lm2_m4x4_f32 inv = lm2_m4x4_inverse_f32(m);
+  lm2_v3_f32 back = lm2_m4x4_transform_point_f32(inv, p);
+  EXPECT_NEAR(back.x, 1.0f, EPSILON_F32);
+  EXPECT_NEAR(back.y, 1.0f, EPSILON_F32);
+  EXPECT_NEAR(back.z, 1.0f, EPSILON_F32);
+}
+
+TEST_F(InlineTest, Matrix3x2And3x3Transform_F64) {
+  lm2_m3x2_f64 a = lm2_m3x2_translate_f64(lm2_v2_make_f64(1.0, -1.0));
+  lm2_v2_f64 p = lm2_m3x2_transform_point_f64(a, lm2_v2_make_f64(2.0, 2.0));
+  EXPECT_DOUBLE_EQ(p.x, 3.0);
+  EXPECT_DOUBLE_EQ(p.y, 1.0);
+
+  lm2_m3x3_f64 b = lm2_m3x3_translate_f64(lm2_v2_make_f64(1.0, -1.0));
+  EXPECT_DOUBLE_EQ(lm2_m3x3_determinant_f64(b), 1.0);
+}
@@ -24,6 +24,7 @@ SOFTWARE.
 
 #include <gtest/gtest.h>
 #include <cmath>
+#include <vector>
 #include "lm2/lm2_constants.h"
 #include "lm2/matrices/lm2_matrix3x2.h"
 
@@ -494,3 +495,44 @@ TEST_F(Matrix3x2Test, TransformPointArrays_F32) {
     EXPECT_NEAR(destination[i].y, expected[i].y, EPSILON_F32);
   }
 }
+
+// =============================================================================
+// Batch Transform Tests
+// =============================================================================
+
+TEST_F(Matrix3x2Test, TransformPointsBatchMatchesTransformPoint_F32) {
+  const lm2_m3x2_f32 matrix = lm2_m3x2_make_f32(1.5f, -0.5f, 2.0f, 0.25f, 2.0f, -1.0f);
+  const uint32_t count = 1027;
+  std::vector<lm2_v2_f32> source(count);
+  for (uint32_t i = 0; i < count; i++) {
+    source[i] = {(float)(i % 17) - 8.0f, (float)(i % 11) * 0.5f};
+  }
+  std::vector<lm2_v2_f32> in_place = source;
+  std::vector<lm2_v2_f32> destination(count);
+  lm2_m3x2_transform_points_f32(matrix, in_place.data(), count);
+  lm2_m3x2_transform_points_src_dst_f32(matrix, source.data(), destination.data(), count);
+  for (uint32_t i = 0; i < count; i++) {
+    lm2_v2_f32 expected = lm2_m3x2_transform_point_f32(matrix, source[i]);
+    EXPECT_NEAR(destination[i].x, expected.x, EPSILON_F32);
+    EXPECT_NEAR(destination[i].y, expected.y, EPSILON_F32);
+    EXPECT_EQ(in_place[i].x, destination[i].x);
+    EXPECT_EQ(in_place[i].y, destination[i].y);
+  }
+}
+
+TEST_F(Matrix3x2Test, TransformPointsParallelMatchesSerial_F64) {
+  const lm2_m3x2_f64 matrix = lm2_m3x2_make_f64(1.5, -0.5, 2.0, 0.25, 2.0, -1.0);
+  const uint32_t count = 200003;
+  std::vector<lm2_v2_f64> source(count);
+  for (uint32_t i = 0; i < count; i++) {
+    source[i] = {(double)(i % 101) * 0.25, (double)(i % 37) - 18.0};
+  }
+  std::vector<lm2_v2_f64> serial(count);
+  std::vector<lm2_v2_f64> parallel(count);
+  lm2_m3x2_transform_points_src_dst_f64(matrix, source.data(), serial.data(), count);
+  lm2_m3x2_transform_points_parallel_f64(matrix, source.data(), parallel.data(), count, 3);
+  for (uint32_t i = 0; i < count; i++) {
+    ASSERT_EQ(parallel[i].x, serial[i].x);
+    ASSERT_EQ(parallel[i].y, serial[i].y);
+  }
+}
@@ -24,6 +24,7 @@ SOFTWARE.
 
 #include <gtest/gtest.h>
 #include <cmath>
+#include <vector>
 #include "lm2/lm2_constants.h"
 #include "lm2/matrices/lm2_matrix3x3.h"
 
@@ -506,3 +507,61 @@ TEST_F(Matrix3x3Test, TransformPointArrays_F32) {
     EXPECT_NEAR(destination[i].y, expected[i].y, EPSILON_F32);
   }
 }
+
+// =============================================================================
+// Batch Transform Tests
+// =============================================================================
+
+TEST_F(Matrix3x3Test, TransformPointsBatchMatchesTransformPoint_F32) {
+  // Non-trivial bottom row, so the perspective divide runs in every lane
+  const lm2_m3x3_f32 matrix = lm2_m3x3_make_f32(1.5f, -0.5f, 2.0f, 0.25f, 2.0f, -1.0f, 0.05f, 0.02f, 1.0f);
+  const uint32_t count = 1027;
+  std::vector<lm2_v2_f32> source(count);
+  for (uint32_t i = 0; i < count; i++) {
+    source[i] = {(float)(i % 17) - 8.0f, (float)(i % 11) * 0.5f};
+  }
+  std::vector<lm2_v2_f32> in_place = source;
+  std::vector<lm2_v2_f32> destination(count);
+  lm2_m3x3_transform_points_f32(matrix, in_place.data(), count);
+  lm2_m3x3_transform_points_src_dst_f32(matrix, source.data(), destination.data(), count);
+  for (uint32_t i = 0; i < count; i++) {
+    lm2_v2_f32 expected = lm2_m3x3_transform_point_f32(matrix, source[i]);
+    EXPECT_NEAR(destination[i].x, expected.x, EPSILON_F32);
+    EXPECT_NEAR(destination[i].y, expected.y, EPSILON_F32);
+    EXPECT_EQ(in_place[i].x, destination[i].x);
+    EXPECT_EQ(in_place[i].y, destination[i].y);
+  }
+}
+
+TEST_F(Matrix3x3Test, TransformPointsBatchMatchesTransformPoint_F64) {
+  const lm2_m3x3_f64 matrix = lm2_m3x3_make_f64(1.5, -0.5, 2.0, 0.25, 2.0, -1.0, 0.05, 0.02, 1.0);
+  const uint32_t count = 1027;
+  std::vector<lm2_v2_f64> source(count);
+  for (uint32_t i = 0; i < count; i++) {
+    source[i] = {(double)(i % 17) - 8.0, (double)(i % 11) * 0.5};
+  }
+  std::vector<lm2_v2_f64> destination(count);
+  lm2_m3x3_transform_points_src_dst_f64(matrix, source.data(), destination.data(), count);
+  for (uint32_t i = 0; i < count; i++) {
+    lm2_v2_f64 expected = lm2_m3x3_transform_point_f64(matrix, source[i]);
+    EXPECT_NEAR(destination[i].x, expected.x, EPSILON_F64);
+    EXPECT_NEAR(destination[i].y, expected.y, EPSILON_F64);
+  }
+}
+
+TEST_F(Matrix3x3Test, TransformPointsParallelMatchesSerial_F32) {
+  const lm2_m3x3_f32 matrix = lm2_m3x3_make_f32(1.5f, -0.5f, 2.0f, 0.25f, 2.0f, -1.0f, 0.0f, 0.0f, 1.0f);
+  const uint32_t count = 200003;
+  std::vector<lm2_v2_f32> source(count);
+  for (uint32_t i = 0; i < count; i++) {
+    source[i] = {(float)(i % 101) * 0.25f, (float)(i % 37) - 18.0f};
+  }
+  std::vector<lm2_v2_f32> serial(count);
+  std::vector<lm2_v2_f32> parallel(count);
+  lm2_m3x3_transform_points_src_dst_f32(matrix, source.data(), serial.data(), count);
+  lm2_m3x3_transform_points_parallel_f32(matrix, source.data(), parallel.data(), count, 4);
+  for (uint32_t i = 0; i < count; i++) {
+    ASSERT_EQ(parallel[i].x, serial[i].x);
+    ASSERT_EQ(parallel[i].y, serial[i].y);
+  }
+}
@@ -24,6 +24,7 @@ SOFTWARE.
 
 #include <gtest/gtest.h>
 #include <cmath>
+#include <vector>
 #include "lm2/lm2_constants.h"
 #include "lm2/matrices/lm2_matrix4x4.h"
 
@@ -791,3 +792,173 @@ TEST_F(Matrix4x4Test, TransformPointArrays_F32) {
     EXPECT_NEAR(destination[i].z, expected[i].z, EPSILON_F32);
   }
 }
+
+// =============================================================================
+// Batch Transform Tests
+// =============================================================================
+
+TEST_F(Matrix4x4Test, TransformPointsBatchMatchesTransformPoint_F32) {
+  // Projective matrix, so the perspective divide runs in every lane
+  const lm2_m4x4_f32 matrix = lm2_m4x4_mul_f32(
+      lm2_m4x4_perspective_f32(LM2_PI_F32 / 3.0f, 1.5f, 0.1f, 100.0f),
+      lm2_m4x4_look_at_f32({3.0f, 4.0f, 20.0f}, {0.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}));
+  const uint32_t count = 1027;
+  std::vector<lm2_v3_f32> source(count);
+  for (uint32_t i = 0; i < count; i++) {
+    source[i] = {(float)(i % 17) - 8.0f, (float)(i % 11) * 0.5f, (float)(i % 7) - 3.0f};
+  }
+  std::vector<lm2_v3_f32> in_place = source;
+  std::vector<lm2_v3_f32> destination(count);
+  lm2_m4x4_transform_points_f32(matrix, in_place.data(), count);
+  lm2_m4x4_transform_points_src_dst_f32(matrix, source.data(), destination.data(), count);
+  for (uint32_t i = 0; i < count; i++) {
+    lm2_v3_f32 expected = lm2_m4x4_transform_point_f32(matrix, source[i]);
+    EXPECT_NEAR(destination[i].x, expected.x, EPSILON_F32);
+    EXPECT_NEAR(destination[i].y, expected.y, EPSILON_F32);
+    EXPECT_NEAR(destination[i].z, expected.z, EPSILON_F32);
+    EXPECT_EQ(in_place[i].x, destination[i].x);
+    EXPECT_EQ(in_place[i].y, destination[i].y);
+    EXPECT_EQ(in_place[i].z, destination[i].z);
+  }
+}
+
+TEST_F(Matrix4x4Test, TransformPointsBatchMatchesTransformPoint_F64) {
+  const lm2_m4x4_f64 matrix = lm2_m4x4_world_transform_f64({1.0, -2.0, 3.0}, {2.0, 0.5, 1.5}, {0.3, -0.7, 1.1});
+  const uint32_t count = 1027;
+  std::vector<lm2_v3_f64> source(count);
+  for (uint32_t i = 0; i < count; i++) {
+    source[i] = {(double)(i % 17) - 8.0, (double)(i % 11) * 0.5, (double)(i % 7) - 3.0};
+  }
+  std::vector<lm2_v3_f64> destination(count);
+  lm2_m4x4_transform_points_src_dst_f64(matrix, source.data(), destination.data(), count);
+  for (uint32_t i = 0; i < count; i++) {
+    lm2_v3_f64 expected = lm2_m4x4_transform_point_f64(matrix, source[i]);
+    EXPECT_NEAR(destination[i].x, expected.x, EPSILON_F64);
+    EXPECT_NEAR(destination[i].y, expected.y, EPSILON_F64);
+    EXPECT_NEAR(destination[i].z, expected.z, EPSILON_F64);
+  }
+}
+
+TEST_F(Matrix4x4Test, TransformPointsParallelMatchesSerial_F32) {
+  const lm2_m4x4_f32 matrix = lm2_m4x4_world_transform_f32({1.0f, -2.0f, 3.0f}, {2.0f, 0.5f, 1.5f}, {0.3f, -0.7f, 1.1f});
+  const uint32_t count = 200003;
+  std::vector<lm2_v3_f32> source(count);
+  for (uint32_t i = 0; i < count; i++) {
+    source[i] = {(float)(i % 101) * 0.25f, (float)(i % 37) - 18.0f, (float)(i % 13)};
+  }
+  std::vector<lm2_v3_f32> serial(count);
+  lm2_m4x4_transform_points_src_dst_f32(matrix, source.data(), serial.data(), count);
+
+  // Explicit thread count, then the hardware default in place
+  std::vector<lm2_v3_f32> parallel(count);
+  lm2_m4x4_transform_points_parallel_f32(matrix, source.data(), parallel.data(), count, 4);
+  std::vector<lm2_v3_f32> in_place = source;
+  lm2_m4x4_transform_points_parallel_f32(matrix, in_place.data(), in_place.data(), count, 0);
+  for (uint32_t i = 0; i < count; i++) {
+    ASSERT_EQ(parallel[i].x, serial[i].x);
+    ASSERT_EQ(parallel[i].y, serial[i].y);
+    ASSERT_EQ(parallel[i].z, serial[i].z);
+    ASSERT_EQ(in_place[i].x, serial[i].x);
+    ASSERT_EQ(in_place[i].y, serial[i].y);
+    ASSERT_EQ(in_place[i].z, serial[i].z);
+  }
+}
+
+TEST_F(Matrix4x4Test, TransformPointsParallelSmallCount_F64) {
+  const lm2_m4x4_f64 matrix = lm2_m4x4_translate_f64({1.0, 2.0, 3.0});
+  lm2_v3_f64 points[5] = {
+      {0.0, 0.0, 0.0},
+      {1.0, 1.0, 1.0},
+      {2.0, 2.0, 2.0},
+      {3.0, 3.0, 3.0},
+      {4.0, 4.0, 4.0}
+  };
+  lm2_m4x4_transform_points_parallel_f64(matrix, points, points, 5, 8);
+  for (int i = 0; i < 5; i++) {
+    EXPECT_DOUBLE_EQ(points[i].x, i + 1.0);
+    EXPECT_DOUBLE_EQ(points[i].y, i + 2.0);
+    EXPECT_DOUBLE_EQ(points[i].z, i + 3.0);
+  }
+  lm2_m4x4_transform_points_parallel_f64(matrix, points, points, 0, 8);
+  EXPECT_DOUBLE_EQ(points[0].x, 1.0);
+}
+
+TEST_F(Matrix4x4Test, MulArrayMatchesMul_F32) {
+  const uint32_t count = 37;
+  std::vector<lm2_m4x4_f32> a(count);
+  std::vector<lm2_m4x4_f32> b(count);
+  for (uint32_t i = 0; i < count; i++) {
+    float f = (float)i;
+    a[i] = lm2_m4x4_world_transform_f32({f, -f, 0.5f * f}, {1.0f + 0.1f * f, 2.0f, 0.5f}, {0.1f * f, 0.2f, -0.3f * f});
+    b[i] = lm2_m4x4_perspective_f32(0.5f + 0.01f * f, 1.5f, 0.1f, 100.0f);
+  }
+  std::vector<lm2_m4x4_f32> dst(count);
+  lm2_m4x4_mul_array_f32(a.data(), b.data(), dst.data(), count);
+  for (uint32_t i = 0; i < count; i++) {
+    lm2_m4x4_f32 expected = lm2_m4x4_mul_f32(a[i], b[i]);
+    for (int k = 0; k < 16; k++) {
+      EXPECT_NEAR(dst[i].e[k], expected.e[k], EPSILON_F32 * fmaxf(1.0f, fabsf(expected.e[k])));
+    }
+  }
+
+  // In place over a
+  lm2_m4x4_mul_array_f32(a.data(), b.data(), a.data(), count);
+  for (uint32_t i = 0; i < count; i++) {
+    for (int k = 0; k < 16; k++) {
+      EXPECT_EQ(a[i].e[k], dst[i].e[k]);
+    }
+  }
+}
+
+TEST_F(Matrix4x4Test, PremulArrayMatchesMul_F64) {
+  const lm2_m4x4_f64 view = lm2_m4x4_look_at_f64({3.0, 4.0, 20.0}, {0.0, 0.0, 0.0}, {0.0, 1.0, 0.0});
+  const uint32_t count = 23;
+  std::vector<lm2_m4x4_f64> models(count);
+  for (uint32_t i = 0; i < count; i++) {
+    double d = (double)i;
+    models[i] = lm2_m4x4_world_transform_f64({1e6 + d, -d, 2.0 * d}, {1.0, 1.0 + 0.1 * d, 2.0}, {0.05 * d, -0.1, 0.2});
+  }
+  std::vector<lm2_m4x4_f64> expected(count);
+  for (uint32_t i = 0; i < count; i++) {
+    expected[i] = lm2_m4x4_mul_f64(view, models[i]);
+  }
+
+  // In place over b
+  lm2_m4x4_premul_array_f64(&view, models.data(), models.data(), count);
+  for (uint32_t i = 0; i < count; i++) {
+    for (int k = 0; k < 16; k++) {
+      EXPECT_NEAR(models[i].e[k], expected[i].e[k], EPSILON_F64 * fmax(1.0, fabs(expected[i].e[k])));
+    }
+  }
+}
+
+TEST_F(Matrix4x4Test, PropagateHierarchy_F32) {
+  // Two roots: 0 -> 1 -> 2 -> 4 and 3 -> 5
+  const int32_t parents[6] = {-1, 0, 1, -1, 2, 3};
+  lm2_m4x4_f32 local[6];
+  for (int i = 0; i < 6; i++) {
+    float f = (float)i;
+    local[i] = lm2_m4x4_world_transform_f32({f, 1.0f, -f}, {1.0f, 1.0f + 0.25f * f, 1.0f}, {0.0f, 0.3f * f, 0.1f});
+  }
+  lm2_m4x4_f32 world[6];
+  for (int i = 0; i < 6; i++) {
+    world[i] = parents[i] < 0 ? local[i] : lm2_m4x4_mul_f32(world[parents[i]], local[i]);
+  }
+
+  lm2_m4x4_f32 matrices[6];
+  for (int i = 0; i < 6; i++) {
+    matrices[i] = local[i];
+  }
+  lm2_m4x4_propagate_hierarchy_f32(matrices, parents, 6);
+  for (int i = 0; i < 6; i++) {
+    for (int k = 0; k < 16; k++) {
+      EXPECT_NEAR(matrices[i].e[k], world[i].e[k], EPSILON_F32 * fmaxf(1.0f, fabsf(world[i].e[k])));
+    }
+  }
+}
+
+TEST_F(Matrix4x4Test, PropagateHierarchyParentAfterChildAsserts) {
+  const int32_t parents[2] = {1, -1};
+  lm2_m4x4_f64 matrices[2] = {lm2_m4x4_identity_f64(), lm2_m4x4_identity_f64()};
+  EXPECT_DEATH(lm2_m4x4_propagate_hierarchy_f64(matrices, parents, 2), "");
+}
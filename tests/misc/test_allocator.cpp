@@ -0,0 +1,271 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+#include "lm2/geometry2d/lm2_manifold2.h"
+#include "lm2/geometry2d/lm2_polygon.h"
+#include "lm2/geometry2d/lm2_triangle2_geometry.h"
+#include "lm2/geometry3d/lm2_mesh_optimize.h"
+#include "lm2/misc/lm2_allocator.h"
+
+// Allocator hook that counts live blocks and every call that reaches the heap
+struct CountingHeap {
+  std::atomic<long> live{0};
+  std::atomic<long> calls{0};
+};
+
+static void* counting_allocate(void* user_data, size_t size) {
+  CountingHeap* heap = static_cast<CountingHeap*>(user_data);
+  heap->live++;
+  heap->calls++;
+  return malloc(size);
+}
+
+static void* counting_reallocate(void* user_data, void* ptr, size_t size) {
+  CountingHeap* heap = static_cast<CountingHeap*>(user_data);
+  if (!ptr) {
+    heap->live++;
+  }
+  heap->calls++;
+  return realloc(ptr, size);
+}
+
+static void counting_deallocate(void* user_data, void* ptr) {
+  CountingHeap* heap = static_cast<CountingHeap*>(user_data);
+  if (ptr) {
+    heap->live--;
+    heap->calls++;
+  }
+  free(ptr);
+}
+
+// Test fixture for allocator tests
+class AllocatorTest : public ::testing::Test {
+ protected:
+  CountingHeap heap;
+
+  void install_counting_heap() {
+    lm2_allocator allocator = {counting_allocate, counting_reallocate, counting_deallocate, &heap};
+    lm2_set_allocator(&allocator);
+  }
+
+  void TearDown() override {
+    lm2_set_allocator(NULL);
+  }
+};
+
+// =============================================================================
+// Arena Tests
+// =============================================================================
+
+TEST_F(AllocatorTest, ArenaOnCallerMemory) {
+  alignas(16) unsigned char buffer[257];
+  lm2_arena arena = lm2_arena_make(buffer + 1, 256);
+  EXPECT_FALSE(arena.owns_memory);
+
+  void* a = lm2_arena_alloc(&arena, 10);
+  ASSERT_NE(a, nullptr);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(a) % 16, 0u);
+  size_t mark = lm2_arena_mark(&arena);
+
+  void* b = lm2_arena_alloc(&arena, 100);
+  ASSERT_NE(b, nullptr);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(b) % 16, 0u);
+  EXPECT_GE(static_cast<unsigned char*>(b), static_cast<unsigned char*>(a) + 10);
+
+  EXPECT_EQ(lm2_arena_alloc(&arena, 1000), nullptr);
+  EXPECT_GT(arena.peak, arena.capacity);
+
+  lm2_arena_reset(&arena, mark);
+  EXPECT_EQ(lm2_arena_alloc(&arena, 100), b);
+
+  // A caller-owned block is never grown
+  lm2_arena_reset(&arena, 0);
+  EXPECT_EQ(arena.memory, buffer + 1);
+  EXPECT_EQ(arena.capacity, 256u);
+  lm2_arena_destroy(&arena);
+}
+
+TEST_F(AllocatorTest, ZeroSizeAllocationStaysInsideBlock) {
+  alignas(16) unsigned char buffer[256];
+  lm2_arena arena = lm2_arena_make(buffer, sizeof(buffer));
+  ASSERT_NE(lm2_arena_alloc(&arena, sizeof(buffer)), nullptr);
+  EXPECT_EQ(lm2_arena_alloc(&arena, 0), nullptr);
+
+  lm2_arena_reset(&arena, 0);
+  void* a = lm2_arena_alloc(&arena, 0);
+  void* b = lm2_arena_alloc(&arena, 0);
+  EXPECT_NE(a, b);
+}
+
+TEST_F(AllocatorTest, OwningArenaGrowsToPeak) {
+  install_counting_heap();
+  lm2_arena arena = lm2_arena_make(NULL, 0);
+  EXPECT_TRUE(arena.owns_memory);
+
+  EXPECT_EQ(lm2_arena_alloc(&arena, 5000), nullptr);
+  lm2_arena_reset(&arena, 0);
+  EXPECT_GE(arena.capacity, 5000u);
+  EXPECT_NE(lm2_arena_alloc(&arena, 5000), nullptr);
+
+  lm2_arena_destroy(&arena);
+  EXPECT_EQ(arena.memory, nullptr);
+  EXPECT_EQ(heap.live.load(), 0);
+}
+
+// =============================================================================
+// Allocator Hook Tests
+// =============================================================================
+
+TEST_F(AllocatorTest, HookReceivesLibraryAllocations) {
+  install_counting_heap();
+  std::vector<uint32_t> indices = {0, 1, 2, 2, 1, 3, 3, 1, 4};
+  std::vector<uint32_t> optimized(indices.size());
+  lm2_mesh_optimize_vertex_cache(optimized.data(), indices.data(), indices.size(), 5);
+  EXPECT_GT(heap.calls.load(), 0);
+  EXPECT_EQ(heap.live.load(), 0);
+}
+
+TEST_F(AllocatorTest, NoHeapAllocationsAfterWarmUp) {
+  if (lm2_arena_thread_default() == NULL) {
+    GTEST_SKIP() << "Built without thread support, the functions use the heap";
+  }
+  install_counting_heap();
+
+  std::vector<lm2_v2_f64> circle(64);
+  for (size_t i = 0; i < circle.size(); ++i) {
+    double angle = 2.0 * 3.14159265358979323846 * static_cast<double>(i) / static_cast<double>(circle.size());
+    circle[i] = lm2_v2_make_f64(cos(angle), sin(angle));
+  }
+
+  std::vector<lm2_triangle2_f64> triangles(32);
+  for (size_t i = 0; i < triangles.size(); ++i) {
+    triangles[i][0] = lm2_v2_make_f64(static_cast<double>(i), 0.0);
+    triangles[i][1] = lm2_v2_make_f64(static_cast<double>(i + 1), 0.0);
+    triangles[i][2] = lm2_v2_make_f64(static_cast<double>(i), 1.0);
+  }
+
+  auto run = [&]() {
+    std::vector<lm2_v2_f64> points = circle;
+    std::vector<lm2_v2_f64> normals(points.size());
+    lm2_polygon_f64 convex = lm2_polygon_make_f64(points.data(), points.size());
+    lm2_make_convex_polygon_f64(&convex, normals.data());
+    EXPECT_EQ(convex.vertex_count, circle.size());
+
+    std::vector<lm2_v2_f64> ring = circle;
+    std::vector<size_t> ear_indices((ring.size() - 2) * 3);
+    EXPECT_EQ(lm2_polygon_triangulate_ear_clipping_f64(lm2_polygon_make_f64(ring.data(), ring.size()), ear_indices.data()), ring.size() - 2);
+    EXPECT_TRUE(lm2_polygon_is_simple_f64(lm2_polygon_make_f64(ring.data(), ring.size())));
+
+    lm2_indexed_mesh_size size = lm2_triangle2_list_to_indexed_mesh_size_f64(triangles.data(), triangles.size(), 1e-9);
+    EXPECT_EQ(size.index_count, triangles.size() * 3);
+    std::vector<lm2_v2_f64> vertices(size.vertex_count);
+    std::vector<uint32_t> indices(size.index_count);
+    lm2_triangle2_list_to_indexed_mesh_f64(triangles.data(), triangles.size(), 1e-9, vertices.data(), vertices.size(), indices.data(), indices.size());
+  };
+
+  run();
+  run();
+  long warm_calls = heap.calls.load();
+  for (int i = 0; i < 4; ++i) {
+    run();
+  }
+  EXPECT_EQ(heap.calls.load(), warm_calls);
+}
+
+TEST_F(AllocatorTest, ThreadDefaultArenaReleasedAtThreadExit) {
+  if (lm2_arena_thread_default() == NULL) {
+    GTEST_SKIP() << "Built without thread support, there is no default arena";
+  }
+  install_counting_heap();
+  std::thread worker([]() {
+    lm2_arena* arena = lm2_arena_thread_default();
+    ASSERT_NE(arena, nullptr);
+    EXPECT_EQ(lm2_arena_thread_default(), arena);
+    lm2_arena_alloc(arena, 4096);
+    lm2_arena_reset(arena, 0);
+    EXPECT_NE(lm2_arena_alloc(arena, 4096), nullptr);
+    lm2_arena_reset(arena, 0);
+  });
+  worker.join();
+  EXPECT_EQ(heap.live.load(), 0);
+}
+
+// =============================================================================
+// Scratch Variant Tests
+// =============================================================================
+
+TEST_F(AllocatorTest, ScratchVariantsMatchWithTinyArena) {
+  std::vector<lm2_v2_f64> points(20);
+  for (size_t i = 0; i < points.size(); ++i) {
+    double angle = 2.0 * 3.14159265358979323846 * static_cast<double>(i) / static_cast<double>(points.size());
+    points[i] = lm2_v2_make_f64(2.0 * cos(angle), 2.0 * sin(angle));
+  }
+  // Interior points are dropped by the hull
+  points.push_back(lm2_v2_make_f64(0.0, 0.0));
+  points.push_back(lm2_v2_make_f64(0.5, -0.25));
+
+  alignas(16) unsigned char buffer[64];
+  lm2_arena arena = lm2_arena_make(buffer, sizeof(buffer));
+
+  std::vector<lm2_v2_f64> normals(points.size());
+  lm2_polygon_f64 convex = lm2_polygon_make_f64(points.data(), points.size());
+  lm2_make_convex_polygon_scratch_f64(&convex, normals.data(), &arena);
+  ASSERT_EQ(convex.vertex_count, 20u);
+  EXPECT_EQ(arena.offset, 0u);
+
+  for (size_t i = 0; i < convex.vertex_count; ++i) {
+    lm2_v2_f64 a = convex.vertices[i];
+    lm2_v2_f64 b = convex.vertices[(i + 1) % convex.vertex_count];
+    lm2_v2_f64 n = normals[i];
+    EXPECT_NEAR(n.x * n.x + n.y * n.y, 1.0, 1e-12);
+    EXPECT_NEAR(n.x * (b.x - a.x) + n.y * (b.y - a.y), 0.0, 1e-12);
+    // Outward for counter-clockwise winding
+    EXPECT_GT(n.x * a.x + n.y * a.y, 0.0);
+  }
+
+  std::vector<lm2_triangle2_f32> triangles(16);
+  for (size_t i = 0; i < triangles.size(); ++i) {
+    triangles[i][0] = lm2_v2_make_f32(static_cast<float>(i), 0.0f);
+    triangles[i][1] = lm2_v2_make_f32(static_cast<float>(i + 1), 0.0f);
+    triangles[i][2] = lm2_v2_make_f32(static_cast<float>(i), 1.0f);
+  }
+  lm2_indexed_mesh_size expected = lm2_triangle2_list_to_indexed_mesh_size_f32(triangles.data(), triangles.size(), 1e-6f);
+  lm2_indexed_mesh_size size = lm2_triangle2_list_to_indexed_mesh_size_scratch_f32(triangles.data(), triangles.size(), 1e-6f, &arena);
+  EXPECT_EQ(size.vertex_count, expected.vertex_count);
+  EXPECT_EQ(size.index_count, expected.index_count);
+
+  std::vector<lm2_v2_f32> expected_vertices(expected.vertex_count), vertices(size.vertex_count);
+  std::vector<uint32_t> expected_indices(expected.index_count), indices(size.index_count);
+  lm2_triangle2_list_to_indexed_mesh_f32(triangles.data(), triangles.size(), 1e-6f, expected_vertices.data(), expected_vertices.size(), expected_indices.data(), expected_indices.size());
+  lm2_triangle2_list_to_indexed_mesh_scratch_f32(triangles.data(), triangles.size(), 1e-6f, vertices.data(), vertices.size(), indices.data(), indices.size(), &arena);
+  EXPECT_EQ(indices, expected_indices);
+  EXPECT_EQ(arena.offset, 0u);
+}
@@ -0,0 +1,272 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+#include "lm2/ranges/lm2_range_sweep.h"
+
+// Test fixture for range sweep tests
+class RangeSweepTest : public ::testing::Test {
+ protected:
+  static constexpr float EPSILON_F32 = 1e-5f;
+  static constexpr double EPSILON_F64 = 1e-10;
+};
+
+typedef std::vector<std::pair<uint32_t, uint32_t>> pair_list;
+
+// Work buffer of at least size bytes, aligned for a uint64_t
+static std::vector<uint64_t> make_buffer(size_t size) {
+  return std::vector<uint64_t>((size + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+}
+
+// Random boxes centered in [lo, hi]^2 with half extents in [0.5, 2]
+static std::vector<lm2_r2_f32> random_boxes_r2_f32(size_t count, float lo, float hi, uint32_t seed) {
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<float> pos(lo, hi);
+  std::uniform_real_distribution<float> half(0.5f, 2.0f);
+  std::vector<lm2_r2_f32> boxes(count);
+  for (auto& box : boxes) {
+    float x = pos(rng);
+    float y = pos(rng);
+    float hx = half(rng);
+    float hy = half(rng);
+    box = lm2_r2_from_scalars_f32(x - hx, y - hy, x + hx, y + hy);
+  }
+  return boxes;
+}
+
+static std::vector<lm2_r3_f64> random_boxes_r3_f64(size_t count, double lo, double hi, uint32_t seed) {
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<double> pos(lo, hi);
+  std::uniform_real_distribution<double> half(0.5, 2.0);
+  std::vector<lm2_r3_f64> boxes(count);
+  for (auto& box : boxes) {
+    for (int a = 0; a < 3; a++) {
+      double c = pos(rng);
+      double h = half(rng);
+      box.min.e[a] = c - h;
+      box.max.e[a] = c + h;
+    }
+  }
+  return boxes;
+}
+
+template <typename Box, int D>
+static pair_list brute_force_pairs(const std::vector<Box>& boxes) {
+  pair_list pairs;
+  for (uint32_t i = 0; i < boxes.size(); i++) {
+    for (uint32_t j = i + 1; j < boxes.size(); j++) {
+      bool overlap = true;
+      for (int a = 0; a < D; a++) {
+        overlap = overlap && boxes[i].min.e[a] <= boxes[j].max.e[a] && boxes[j].min.e[a] <= boxes[i].max.e[a];
+      }
+      if (overlap) {
+        pairs.push_back({i, j});
+      }
+    }
+  }
+  return pairs;
+}
+
+// Sorted pair list, checking a < b on the way
+static pair_list sorted_pairs(const std::vector<lm2_sweep_pair>& out, size_t count) {
+  EXPECT_LE(count, out.size());
+  pair_list pairs;
+  for (size_t i = 0; i < count; i++) {
+    EXPECT_LT(out[i].a, out[i].b);
+    pairs.push_back({out[i].a, out[i].b});
+  }
+  std::sort(pairs.begin(), pairs.end());
+  return pairs;
+}
+
+// =============================================================================
+// Batch Sweep Tests
+// =============================================================================
+
+TEST_F(RangeSweepTest, BufferSize) {
+  EXPECT_GT(lm2_r2_sweep_buffer_size_f32(100), lm2_r2_sweep_buffer_size_f32(10));
+  EXPECT_GT(lm2_r3_sweep_buffer_size_f32(100), lm2_r2_sweep_buffer_size_f32(100));
+  EXPECT_GT(lm2_r2_sweep_buffer_size_f64(100), lm2_r2_sweep_buffer_size_f32(100));
+  EXPECT_GT(lm2_r3_sweep_buffer_size_f64(100), lm2_r3_sweep_buffer_size_f32(100));
+}
+
+TEST_F(RangeSweepTest, FewBoxes_F32) {
+  std::vector<uint64_t> buffer = make_buffer(lm2_r2_sweep_buffer_size_f32(1));
+  lm2_r2_f32 box = lm2_r2_from_scalars_f32(0, 0, 1, 1);
+  EXPECT_EQ(lm2_r2_sweep_pairs_f32(NULL, 0, buffer.data(), buffer.size() * 8, NULL, 0), 0u);
+  EXPECT_EQ(lm2_r2_sweep_pairs_f32(&box, 1, buffer.data(), buffer.size() * 8, NULL, 0), 0u);
+}
+
+TEST_F(RangeSweepTest, TouchingBoxesOverlap_F32) {
+  std::vector<lm2_r2_f32> boxes = {
+      lm2_r2_from_scalars_f32(0, 0, 1, 1),
+      lm2_r2_from_scalars_f32(1, 0, 2, 1),      // touches box 0 on x
+      lm2_r2_from_scalars_f32(0.5f, 2, 3, 3),   // overlaps on x only
+      lm2_r2_from_scalars_f32(-5, -5, 10, 0),  // touches boxes 0 and 1 on y
+  };
+  std::vector<uint64_t> buffer = make_buffer(lm2_r2_sweep_buffer_size_f32(boxes.size()));
+  std::vector<lm2_sweep_pair> out(16);
+  size_t count = lm2_r2_sweep_pairs_f32(boxes.data(), boxes.size(), buffer.data(), buffer.size() * 8, out.data(), out.size());
+  pair_list expected = {{0, 1}, {0, 3}, {1, 3}};
+  EXPECT_EQ(sorted_pairs(out, count), expected);
+}
+
+TEST_F(RangeSweepTest, RandomBoxesMatchBruteForce_R2_F32) {
+  // Centers straddle zero so the radix keys cover both signs
+  for (size_t n : {2u, 7u, 100u, 2000u}) {
+    std::vector<lm2_r2_f32> boxes = random_boxes_r2_f32(n, -60.0f, 60.0f, (uint32_t)n);
+    std::vector<uint64_t> buffer = make_buffer(lm2_r2_sweep_buffer_size_f32(n));
+    size_t total = lm2_r2_sweep_pairs_f32(boxes.data(), n, buffer.data(), buffer.size() * 8, NULL, 0);
+    std::vector<lm2_sweep_pair> out(total);
+    size_t count = lm2_r2_sweep_pairs_f32(boxes.data(), n, buffer.data(), buffer.size() * 8, out.data(), out.size());
+    EXPECT_EQ(count, total);
+    EXPECT_EQ(sorted_pairs(out, count), (brute_force_pairs<lm2_r2_f32, 2>(boxes))) << "n = " << n;
+  }
+}
+
+TEST_F(RangeSweepTest, RandomBoxesMatchBruteForce_R3_F64) {
+  for (size_t n : {3u, 50u, 1500u}) {
+    std::vector<lm2_r3_f64> boxes = random_boxes_r3_f64(n, -25.0, 25.0, (uint32_t)n);
+    std::vector<uint64_t> buffer = make_buffer(lm2_r3_sweep_buffer_size_f64(n));
+    std::vector<lm2_sweep_pair> out(n * 8);
+    size_t count = lm2_r3_sweep_pairs_f64(boxes.data(), n, buffer.data(), buffer.size() * 8, out.data(), out.size());
+    EXPECT_EQ(sorted_pairs(out, count), (brute_force_pairs<lm2_r3_f64, 3>(boxes))) << "n = " << n;
+  }
+}
+
+TEST_F(RangeSweepTest, RandomBoxesMatchBruteForce_R3_F32_R2_F64) {
+  std::vector<lm2_r3_f64> boxes64 = random_boxes_r3_f64(800, -20.0, 20.0, 3);
+  std::vector<lm2_r3_f32> boxes3(boxes64.size());
+  std::vector<lm2_r2_f64> boxes2(boxes64.size());
+  for (size_t i = 0; i < boxes64.size(); i++) {
+    for (int a = 0; a < 3; a++) {
+      boxes3[i].min.e[a] = (float)boxes64[i].min.e[a];
+      boxes3[i].max.e[a] = (float)boxes64[i].max.e[a];
+    }
+    boxes2[i] = lm2_r2_from_scalars_f64(boxes64[i].min.x, boxes64[i].min.y, boxes64[i].max.x, boxes64[i].max.y);
+  }
+  std::vector<lm2_sweep_pair> out(boxes64.size() * 16);
+
+  std::vector<uint64_t> buffer3 = make_buffer(lm2_r3_sweep_buffer_size_f32(boxes3.size()));
+  size_t count = lm2_r3_sweep_pairs_f32(boxes3.data(), boxes3.size(), buffer3.data(), buffer3.size() * 8, out.data(), out.size());
+  EXPECT_EQ(sorted_pairs(out, count), (brute_force_pairs<lm2_r3_f32, 3>(boxes3)));
+
+  std::vector<uint64_t> buffer2 = make_buffer(lm2_r2_sweep_buffer_size_f64(boxes2.size()));
+  count = lm2_r2_sweep_pairs_f64(boxes2.data(), boxes2.size(), buffer2.data(), buffer2.size() * 8, out.data(), out.size());
+  EXPECT_EQ(sorted_pairs(out, count), (brute_force_pairs<lm2_r2_f64, 2>(boxes2)));
+}
+
+TEST_F(RangeSweepTest, TruncatedOutputReturnsTotal_F32) {
+  std::vector<lm2_r2_f32> boxes(20, lm2_r2_from_scalars_f32(0, 0, 1, 1));
+  std::vector<uint64_t> buffer = make_buffer(lm2_r2_sweep_buffer_size_f32(boxes.size()));
+  std::vector<lm2_sweep_pair> out(10);
+  size_t count = lm2_r2_sweep_pairs_f32(boxes.data(), boxes.size(), buffer.data(), buffer.size() * 8, out.data(), out.size());
+  EXPECT_EQ(count, 20u * 19u / 2u);
+  for (const auto& pair : out) {
+    EXPECT_LT(pair.a, pair.b);
+    EXPECT_LT(pair.b, 20u);
+  }
+}
+
+TEST_F(RangeSweepTest, SmallBufferAsserts_F32) {
+  std::vector<lm2_r2_f32> boxes(8, lm2_r2_from_scalars_f32(0, 0, 1, 1));
+  std::vector<uint64_t> buffer = make_buffer(lm2_r2_sweep_buffer_size_f32(4));
+  EXPECT_DEATH(lm2_r2_sweep_pairs_f32(boxes.data(), boxes.size(), buffer.data(), buffer.size() * 8, NULL, 0), "");
+}
+
+// =============================================================================
+// Incremental Sweep Tests
+// =============================================================================
+
+TEST_F(RangeSweepTest, SweepAxisFollowsSpread_F64) {
+  // Spread along z, packed on x and y
+  std::vector<lm2_r3_f64> boxes(64);
+  for (size_t i = 0; i < boxes.size(); i++) {
+    double z = 3.0 * (double)i;
+    boxes[i] = lm2_r3_from_min_max_f64(lm2_v3_make_f64(0, 0, z), lm2_v3_make_f64(1, 1, z + 1));
+  }
+  std::vector<uint64_t> buffer = make_buffer(lm2_r3_sweep_buffer_size_f64(boxes.size()));
+  lm2_sweep_f64 sweep = lm2_sweep_make_f64(buffer.data(), buffer.size() * 8);
+  EXPECT_EQ(lm2_r3_sweep_update_f64(&sweep, boxes.data(), boxes.size(), NULL, 0), 0u);
+  EXPECT_EQ(sweep.axis, 2u);
+  EXPECT_EQ(sweep.count, boxes.size());
+}
+
+TEST_F(RangeSweepTest, UpdatesTrackMovingBoxes_F32) {
+  const size_t n = 1500;
+  std::vector<lm2_r2_f32> boxes = random_boxes_r2_f32(n, -80.0f, 80.0f, 11);
+  std::vector<uint64_t> buffer = make_buffer(lm2_r2_sweep_buffer_size_f32(n + 100));
+  lm2_sweep_f32 sweep = lm2_sweep_make_f32(buffer.data(), buffer.size() * 8);
+  std::vector<lm2_sweep_pair> out(n * 8);
+
+  std::mt19937 rng(5);
+  std::uniform_real_distribution<float> step(-0.3f, 0.3f);
+  for (int frame = 0; frame < 20; frame++) {
+    for (auto& box : boxes) {
+      float dx = step(rng);
+      float dy = step(rng);
+      box = lm2_r2_from_scalars_f32(box.min.x + dx, box.min.y + dy, box.max.x + dx, box.max.y + dy);
+    }
+    size_t count = lm2_r2_sweep_update_f32(&sweep, boxes.data(), boxes.size(), out.data(), out.size());
+    ASSERT_EQ(sorted_pairs(out, count), (brute_force_pairs<lm2_r2_f32, 2>(boxes))) << "frame " << frame;
+  }
+
+  // A different count sorts again from scratch
+  std::vector<lm2_r2_f32> more = random_boxes_r2_f32(100, -80.0f, 80.0f, 12);
+  boxes.insert(boxes.end(), more.begin(), more.end());
+  size_t count = lm2_r2_sweep_update_f32(&sweep, boxes.data(), boxes.size(), out.data(), out.size());
+  EXPECT_EQ(sweep.count, boxes.size());
+  EXPECT_EQ(sorted_pairs(out, count), (brute_force_pairs<lm2_r2_f32, 2>(boxes)));
+
+  // Teleporting every box exceeds the insertion sort budget
+  std::shuffle(boxes.begin(), boxes.end(), rng);
+  count = lm2_r2_sweep_update_f32(&sweep, boxes.data(), boxes.size(), out.data(), out.size());
+  EXPECT_EQ(sorted_pairs(out, count), (brute_force_pairs<lm2_r2_f32, 2>(boxes)));
+}
+
+TEST_F(RangeSweepTest, UpdatesTrackMovingBoxes_R3_F64) {
+  const size_t n = 600;
+  std::vector<lm2_r3_f64> boxes = random_boxes_r3_f64(n, -15.0, 15.0, 21);
+  std::vector<uint64_t> buffer = make_buffer(lm2_r3_sweep_buffer_size_f64(n));
+  lm2_sweep_f64 sweep = lm2_sweep_make_f64(buffer.data(), buffer.size() * 8);
+  std::vector<lm2_sweep_pair> out(n * 16);
+
+  std::mt19937 rng(6);
+  std::uniform_real_distribution<double> step(-0.2, 0.2);
+  for (int frame = 0; frame < 10; frame++) {
+    for (auto& box : boxes) {
+      for (int a = 0; a < 3; a++) {
+        double d = step(rng);
+        box.min.e[a] += d;
+        box.max.e[a] += d;
+      }
+    }
+    size_t count = lm2_r3_sweep_update_f64(&sweep, boxes.data(), boxes.size(), out.data(), out.size());
+    ASSERT_EQ(sorted_pairs(out, count), (brute_force_pairs<lm2_r3_f64, 3>(boxes))) << "frame " << frame;
+  }
+}
@@ -0,0 +1,376 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christian Luppi
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+#include "lm2/vectors/lm2_vector_soa.h"
+#include "lm2/vectors/lm2_vector_specifics.h"
+
+// Test fixture for SoA stream tests
+// Counts are chosen so that every kernel runs both its vector loop and its
+// remainder loop for any SIMD width up to 8.
+class VectorSoaTest : public ::testing::Test {
+ protected:
+  static constexpr float EPSILON_F32 = 1e-5f;
+  static constexpr double EPSILON_F64 = 1e-10;
+  static constexpr size_t COUNT = 19;
+
+  // Owns the component arrays of a stream
+  template <typename T>
+  struct storage {
+    std::vector<T> x, y, z, w;
+    explicit storage(size_t n) : x(n), y(n), z(n), w(n) {}
+  };
+
+  static lm2_v3_f32 sample3_f32(size_t i, float offset) {
+    float f = (float)i;
+    return lm2_v3_make_f32(f * 0.5f - 3.0f + offset, 2.0f - f * 0.25f, f * 0.125f + 1.0f - offset);
+  }
+
+  static lm2_v3_f64 sample3_f64(size_t i, double offset) {
+    double f = (double)i;
+    return lm2_v3_make_f64(f * 0.5 - 3.0 + offset, 2.0 - f * 0.25, f * 0.125 + 1.0 - offset);
+  }
+
+  static lm2_v3_soa_f32 fill3_f32(storage<float>& s, float offset) {
+    for (size_t i = 0; i < s.x.size(); i++) {
+      lm2_v3_f32 v = sample3_f32(i, offset);
+      s.x[i] = v.x, s.y[i] = v.y, s.z[i] = v.z;
+    }
+    return lm2_v3_soa_make_f32(s.x.data(), s.y.data(), s.z.data(), s.x.size());
+  }
+
+  static lm2_v3_soa_f64 fill3_f64(storage<double>& s, double offset) {
+    for (size_t i = 0; i < s.x.size(); i++) {
+      lm2_v3_f64 v = sample3_f64(i, offset);
+      s.x[i] = v.x, s.y[i] = v.y, s.z[i] = v.z;
+    }
+    return lm2_v3_soa_make_f64(s.x.data(), s.y.data(), s.z.data(), s.x.size());
+  }
+};
+
+// =============================================================================
+// Construction Tests
+// =============================================================================
+
+TEST_F(VectorSoaTest, Make_F32) {
+  float x[2], y[2], z[2], w[2];
+  lm2_v4_soa_f32 s = lm2_v4_soa_make_f32(x, y, z, w, 2);
+  EXPECT_EQ(s.x, x);
+  EXPECT_EQ(s.y, y);
+  EXPECT_EQ(s.z, z);
+  EXPECT_EQ(s.w, w);
+  EXPECT_EQ(s.count, 2u);
+}
+
+TEST_F(VectorSoaTest, EmptyStream_F32) {
+  lm2_v3_soa_f32 empty = lm2_v3_soa_make_f32(NULL, NULL, NULL, 0);
+  lm2_v3_soa_add_f32(empty, empty, empty);
+  lm2_v3_soa_norm_f32(empty, empty);
+  lm2_v3_soa_from_aos_f32(NULL, empty);
+  SUCCEED();
+}
+
+// =============================================================================
+// Component-wise Tests
+// =============================================================================
+
+TEST_F(VectorSoaTest, Add3_F32) {
+  storage<float> sa(COUNT), sb(COUNT), so(COUNT);
+  lm2_v3_soa_f32 a = fill3_f32(sa, 0.0f);
+  lm2_v3_soa_f32 b = fill3_f32(sb, 1.5f);
+  lm2_v3_soa_f32 out = lm2_v3_soa_make_f32(so.x.data(), so.y.data(), so.z.data(), COUNT);
+  lm2_v3_soa_add_f32(a, b, out);
+  for (size_t i = 0; i < COUNT; i++) {
+    lm2_v3_f32 expected = lm2_v3_add_f32(sample3_f32(i, 0.0f), sample3_f32(i, 1.5f));
+    EXPECT_FLOAT_EQ(out.x[i], expected.x);
+    EXPECT_FLOAT_EQ(out.y[i], expected.y);
+    EXPECT_FLOAT_EQ(out.z[i], expected.z);
+  }
+}
+
+TEST_F(VectorSoaTest, Sub3_InPlace_F64) {
+  storage<double> sa(COUNT), sb(COUNT);
+  lm2_v3_soa_f64 a = fill3_f64(sa, 0.0);
+  lm2_v3_soa_f64 b = fill3_f64(sb, 1.5);
+  lm2_v3_soa_sub_f64(a, b, a);
+  for (size_t i = 0; i < COUNT; i++) {
+    lm2_v3_f64 expected = lm2_v3_sub_f64(sample3_f64(i, 0.0), sample3_f64(i, 1.5));
+    EXPECT_DOUBLE_EQ(a.x[i], expected.x);
+    EXPECT_DOUBLE_EQ(a.y[i], expected.y);
+    EXPECT_DOUBLE_EQ(a.z[i], expected.z);
+  }
+}
+
+TEST_F(VectorSoaTest, MulDiv3_F32) {
+  storage<float> sa(COUNT), sb(COUNT), sm(COUNT), sd(COUNT);
+  lm2_v3_soa_f32 a = fill3_f32(sa, 0.0f);
+  lm2_v3_soa_f32 b = fill3_f32(sb, 0.3f);
+  lm2_v3_soa_f32 mul = lm2_v3_soa_make_f32(sm.x.data(), sm.y.data(), sm.z.data(), COUNT);
+  lm2_v3_soa_f32 div = lm2_v3_soa_make_f32(sd.x.data(), sd.y.data(), sd.z.data(), COUNT);
+  lm2_v3_soa_mul_f32(a, b, mul);
+  lm2_v3_soa_div_f32(mul, b, div);
+  for (size_t i = 0; i < COUNT; i++) {
+    lm2_v3_f32 expected = lm2_v3_mul_f32(sample3_f32(i, 0.0f), sample3_f32(i, 0.3f));
+    EXPECT_FLOAT_EQ(mul.x[i], expected.x);
+    EXPECT_FLOAT_EQ(mul.z[i], expected.z);
+    EXPECT_NEAR(div.x[i], a.x[i], EPSILON_F32);
+    EXPECT_NEAR(div.z[i], a.z[i], EPSILON_F32);
+  }
+}
+
+TEST_F(VectorSoaTest, ScalarOps2_F64) {
+  std::vector<double> x(COUNT), y(COUNT), ox(COUNT), oy(COUNT);
+  for (size_t i = 0; i < COUNT; i++) x[i] = (double)i, y[i] = -(double)i;
+  lm2_v2_soa_f64 a = lm2_v2_soa_make_f64(x.data(), y.data(), COUNT);
+  lm2_v2_soa_f64 out = lm2_v2_soa_make_f64(ox.data(), oy.data(), COUNT);
+
+  lm2_v2_soa_add_s_f64(a, 2.0, out);
+  EXPECT_DOUBLE_EQ(out.x[COUNT - 1], (double)(COUNT - 1) + 2.0);
+  lm2_v2_soa_sub_s_f64(a, 2.0, out);
+  EXPECT_DOUBLE_EQ(out.y[COUNT - 1], -(double)(COUNT - 1) - 2.0);
+  lm2_v2_soa_mul_s_f64(a, 3.0, out);
+  EXPECT_DOUBLE_EQ(out.x[5], 15.0);
+  lm2_v2_soa_div_s_f64(a, 4.0, out);
+  EXPECT_DOUBLE_EQ(out.y[6], -1.5);
+}
+
+TEST_F(VectorSoaTest, MinMax4_F32) {
+  storage<float> sa(COUNT), sb(COUNT), smin(COUNT), smax(COUNT);
+  for (size_t i = 0; i < COUNT; i++) {
+    sa.x[i] = sa.y[i] = sa.z[i] = sa.w[i] = (float)i;
+    sb.x[i] = sb.y[i] = sb.z[i] = sb.w[i] = (float)(COUNT - i);
+  }
+  lm2_v4_soa_f32 a = lm2_v4_soa_make_f32(sa.x.data(), sa.y.data(), sa.z.data(), sa.w.data(), COUNT);
+  lm2_v4_soa_f32 b = lm2_v4_soa_make_f32(sb.x.data(), sb.y.data(), sb.z.data(), sb.w.data(), COUNT);
+  lm2_v4_soa_f32 mn = lm2_v4_soa_make_f32(smin.x.data(), smin.y.data(), smin.z.data(), smin.w.data(), COUNT);
+  lm2_v4_soa_f32 mx = lm2_v4_soa_make_f32(smax.x.data(), smax.y.data(), smax.z.data(), smax.w.data(), COUNT);
+  lm2_v4_soa_min_f32(a, b, mn);
+  lm2_v4_soa_max_f32(a, b, mx);
+  for (size_t i = 0; i < COUNT; i++) {
+    EXPECT_FLOAT_EQ(mn.w[i], std::fmin(sa.w[i], sb.w[i]));
+    EXPECT_FLOAT_EQ(mx.x[i], std::fmax(sa.x[i], sb.x[i]));
+  }
+}
+
+TEST_F(VectorSoaTest, Clamp3_F32) {
+  storage<float> sa(COUNT);
+  lm2_v3_soa_f32 a = fill3_f32(sa, 0.0f);
+  lm2_v3_f32 lo = lm2_v3_make_f32(-1.0f, -1.0f, 1.5f);
+  lm2_v3_f32 hi = lm2_v3_make_f32(1.0f, 1.0f, 2.0f);
+  lm2_v3_soa_clamp_f32(a, lo, hi, a);
+  for (size_t i = 0; i < COUNT; i++) {
+    lm2_v3_f32 expected = lm2_v3_clamp_f32(sample3_f32(i, 0.0f), lo, hi);
+    EXPECT_FLOAT_EQ(a.x[i], expected.x);
+    EXPECT_FLOAT_EQ(a.y[i], expected.y);
+    EXPECT_FLOAT_EQ(a.z[i], expected.z);
+  }
+}
+
+TEST_F(VectorSoaTest, Lerp3_F64) {
+  storage<double> sa(COUNT), sb(COUNT), so(COUNT);
+  lm2_v3_soa_f64 a = fill3_f64(sa, 0.0);
+  lm2_v3_soa_f64 b = fill3_f64(sb, 4.0);
+  lm2_v3_soa_f64 out = lm2_v3_soa_make_f64(so.x.data(), so.y.data(), so.z.data(), COUNT);
+  lm2_v3_soa_lerp_f64(a, 0.25, b, out);
+  for (size_t i = 0; i < COUNT; i++) {
+    EXPECT_NEAR(out.x[i], a.x[i] + 1.0, EPSILON_F64);
+    EXPECT_NEAR(out.z[i], a.z[i] - 1.0, EPSILON_F64);
+  }
+}
+
+// =============================================================================
+// Vector Specifics Tests
+// =============================================================================
+
+TEST_F(VectorSoaTest, DotLength3_F32) {
+  storage<float> sa(COUNT), sb(COUNT);
+  lm2_v3_soa_f32 a = fill3_f32(sa, 0.0f);
+  lm2_v3_soa_f32 b = fill3_f32(sb, 0.7f);
+  std::vector<float> dot(COUNT), len(COUNT), len_sq(COUNT), dist(COUNT);
+  lm2_v3_soa_dot_f32(a, b, dot.data());
+  lm2_v3_soa_length_f32(a, len.data());
+  lm2_v3_soa_length_sq_f32(a, len_sq.data());
+  lm2_v3_soa_distance_f32(a, b, dist.data());
+  for (size_t i = 0; i < COUNT; i++) {
+    lm2_v3_f32 va = sample3_f32(i, 0.0f);
+    lm2_v3_f32 vb = sample3_f32(i, 0.7f);
+    EXPECT_NEAR(dot[i], lm2_v3_dot_f32(va, vb), EPSILON_F32);
+    EXPECT_NEAR(len[i], lm2_v3_length_f32(va), EPSILON_F32);
+    EXPECT_NEAR(len_sq[i], lm2_v3_length_sq_f32(va), EPSILON_F32);
+    EXPECT_NEAR(dist[i], lm2_v3_distance_f32(va, vb), EPSILON_F32);
+  }
+}
+
+TEST_F(VectorSoaTest, Dot4_F64) {
+  storage<double> s(COUNT);
+  for (size_t i = 0; i < COUNT; i++) s.x[i] = 1.0, s.y[i] = 2.0, s.z[i] = 3.0, s.w[i] = (double)i;
+  lm2_v4_soa_f64 a = lm2_v4_soa_make_f64(s.x.data(), s.y.data(), s.z.data(), s.w.data(), COUNT);
+  std::vector<double> dot(COUNT);
+  lm2_v4_soa_dot_f64(a, a, dot.data());
+  for (size_t i = 0; i < COUNT; i++) {
+    EXPECT_DOUBLE_EQ(dot[i], 14.0 + (double)(i * i));
+  }
+}
+
+TEST_F(VectorSoaTest, Norm2_ZeroLength_F32) {
+  std::vector<float> x(COUNT), y(COUNT);
+  for (size_t i = 0; i < COUNT; i++) x[i] = (i % 3 == 0) ? 0.0f : 3.0f * (float)i, y[i] = (i % 3 == 0) ? 0.0f : 4.0f * (float)i;
+  lm2_v2_soa_f32 a = lm2_v2_soa_make_f32(x.data(), y.data(), COUNT);
+  lm2_v2_soa_norm_f32(a, a);
+  for (size_t i = 0; i < COUNT; i++) {
+    if (i % 3 == 0) {
+      EXPECT_FLOAT_EQ(x[i], 0.0f);
+      EXPECT_FLOAT_EQ(y[i], 0.0f);
+    } else {
+      EXPECT_NEAR(x[i], 0.6f, EPSILON_F32);
+      EXPECT_NEAR(y[i], 0.8f, EPSILON_F32);
+    }
+  }
+}
+
+TEST_F(VectorSoaTest, Norm3_F64) {
+  storage<double> sa(COUNT);
+  lm2_v3_soa_f64 a = fill3_f64(sa, 0.1);
+  lm2_v3_soa_norm_f64(a, a);
+  for (size_t i = 0; i < COUNT; i++) {
+    lm2_v3_f64 expected = lm2_v3_norm_f64(sample3_f64(i, 0.1));
+    EXPECT_NEAR(a.x[i], expected.x, EPSILON_F64);
+    EXPECT_NEAR(a.y[i], expected.y, EPSILON_F64);
+    EXPECT_NEAR(a.z[i], expected.z, EPSILON_F64);
+  }
+}
+
+TEST_F(VectorSoaTest, Cross3_F32) {
+  storage<float> sa(COUNT), sb(COUNT), so(COUNT);
+  lm2_v3_soa_f32 a = fill3_f32(sa, 0.0f);
+  lm2_v3_soa_f32 b = fill3_f32(sb, 2.0f);
+  lm2_v3_soa_f32 out = lm2_v3_soa_make_f32(so.x.data(), so.y.data(), so.z.data(), COUNT);
+  lm2_v3_soa_cross_f32(a, b, out);
+  for (size_t i = 0; i < COUNT; i++) {
+    lm2_v3_f32 expected = lm2_v3_cross_f32(sample3_f32(i, 0.0f), sample3_f32(i, 2.0f));
+    EXPECT_NEAR(out.x[i], expected.x, EPSILON_F32);
+    EXPECT_NEAR(out.y[i], expected.y, EPSILON_F32);
+    EXPECT_NEAR(out.z[i], expected.z, EPSILON_F32);
+  }
+}
+
+TEST_F(VectorSoaTest, Reflect3_F64) {
+  storage<double> sv(COUNT), sn(COUNT), so(COUNT);
+  lm2_v3_soa_f64 v = fill3_f64(sv, 0.0);
+  lm2_v3_soa_f64 n = fill3_f64(sn, 0.5);
+  lm2_v3_soa_norm_f64(n, n);
+  lm2_v3_soa_f64 out = lm2_v3_soa_make_f64(so.x.data(), so.y.data(), so.z.data(), COUNT);
+  lm2_v3_soa_reflect_f64(v, n, out);
+  for (size_t i = 0; i < COUNT; i++) {
+    lm2_v3_f64 normal = lm2_v3_make_f64(n.x[i], n.y[i], n.z[i]);
+    lm2_v3_f64 expected = lm2_v3_reflect_f64(sample3_f64(i, 0.0), normal);
+    EXPECT_NEAR(out.x[i], expected.x, EPSILON_F64);
+    EXPECT_NEAR(out.y[i], expected.y, EPSILON_F64);
+    EXPECT_NEAR(out.z[i], expected.z, EPSILON_F64);
+  }
+}
+
+TEST_F(VectorSoaTest, Reflect2_F32) {
+  std::vector<float> vx(COUNT, 1.0f), vy(COUNT, -1.0f), nx(COUNT, 0.0f), ny(COUNT, 1.0f);
+  lm2_v2_soa_f32 v = lm2_v2_soa_make_f32(vx.data(), vy.data(), COUNT);
+  lm2_v2_soa_f32 n = lm2_v2_soa_make_f32(nx.data(), ny.data(), COUNT);
+  lm2_v2_soa_reflect_f32(v, n, v);
+  for (size_t i = 0; i < COUNT; i++) {
+    EXPECT_FLOAT_EQ(vx[i], 1.0f);
+    EXPECT_FLOAT_EQ(vy[i], 1.0f);
+  }
+}
+
+// =============================================================================
+// AoS <-> SoA Transpose Tests
+// =============================================================================
+
+TEST_F(VectorSoaTest, Transpose2_F32) {
+  std::vector<lm2_v2_f32> src(COUNT), back(COUNT);
+  for (size_t i = 0; i < COUNT; i++) src[i] = lm2_v2_make_f32((float)i, -(float)i);
+  storage<float> s(COUNT);
+  lm2_v2_soa_f32 soa = lm2_v2_soa_make_f32(s.x.data(), s.y.data(), COUNT);
+  lm2_v2_soa_from_aos_f32(src.data(), soa);
+  for (size_t i = 0; i < COUNT; i++) {
+    EXPECT_FLOAT_EQ(s.x[i], (float)i);
+    EXPECT_FLOAT_EQ(s.y[i], -(float)i);
+  }
+  lm2_v2_soa_to_aos_f32(soa, back.data());
+  for (size_t i = 0; i < COUNT; i++) {
+    EXPECT_FLOAT_EQ(back[i].x, src[i].x);
+    EXPECT_FLOAT_EQ(back[i].y, src[i].y);
+  }
+}
+
+TEST_F(VectorSoaTest, Transpose3_F32) {
+  std::vector<lm2_v3_f32> src(COUNT), back(COUNT);
+  for (size_t i = 0; i < COUNT; i++) src[i] = sample3_f32(i, 0.0f);
+  storage<float> s(COUNT);
+  lm2_v3_soa_f32 soa = lm2_v3_soa_make_f32(s.x.data(), s.y.data(), s.z.data(), COUNT);
+  lm2_v3_soa_from_aos_f32(src.data(), soa);
+  for (size_t i = 0; i < COUNT; i++) {
+    EXPECT_FLOAT_EQ(s.x[i], src[i].x);
+    EXPECT_FLOAT_EQ(s.y[i], src[i].y);
+    EXPECT_FLOAT_EQ(s.z[i], src[i].z);
+  }
+  lm2_v3_soa_to_aos_f32(soa, back.data());
+  for (size_t i = 0; i < COUNT; i++) {
+    EXPECT_FLOAT_EQ(back[i].x, src[i].x);
+    EXPECT_FLOAT_EQ(back[i].y, src[i].y);
+    EXPECT_FLOAT_EQ(back[i].z, src[i].z);
+  }
+}
+
+TEST_F(VectorSoaTest, Transpose4_F32) {
+  std::vector<lm2_v4_f32> src(COUNT), back(COUNT);
+  for (size_t i = 0; i < COUNT; i++) src[i] = lm2_v4_make_f32((float)i, (float)i + 0.25f, (float)i + 0.5f, (float)i + 0.75f);
+  storage<float> s(COUNT);
+  lm2_v4_soa_f32 soa = lm2_v4_soa_make_f32(s.x.data(), s.y.data(), s.z.data(), s.w.data(), COUNT);
+  lm2_v4_soa_from_aos_f32(src.data(), soa);
+  for (size_t i = 0; i < COUNT; i++) {
+    EXPECT_FLOAT_EQ(s.x[i], src[i].x);
+    EXPECT_FLOAT_EQ(s.w[i], src[i].w);
+  }
+  lm2_v4_soa_to_aos_f32(soa, back.data());
+  for (size_t i = 0; i < COUNT; i++) {
+    EXPECT_FLOAT_EQ(back[i].y, src[i].y);
+    EXPECT_FLOAT_EQ(back[i].z, src[i].z);
+  }
+}
+
+TEST_F(VectorSoaTest, Transpose3_F64) {
+  std::vector<lm2_v3_f64> src(COUNT), back(COUNT);
+  for (size_t i = 0; i < COUNT; i++) src[i] = sample3_f64(i, 0.0);
+  storage<double> s(COUNT);
+  lm2_v3_soa_f64 soa = lm2_v3_soa_make_f64(s.x.data(), s.y.data(), s.z.data(), COUNT);
+  lm2_v3_soa_from_aos_f64(src.data(), soa);
+  lm2_v3_soa_to_aos_f64(soa, back.data());
+  for (size_t i = 0; i < COUNT; i++) {
+    EXPECT_DOUBLE_EQ(s.y[i], src[i].y);
+    EXPECT_DOUBLE_EQ(back[i].x, src[i].x);
+    EXPECT_DOUBLE_EQ(back[i].z, src[i].z);
+  }
+}